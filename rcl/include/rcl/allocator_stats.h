@@ -0,0 +1,186 @@
+// Copyright 2026 Open Source Robotics Foundation, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef RCL__ALLOCATOR_STATS_H_
+#define RCL__ALLOCATOR_STATS_H_
+
+#include <stdint.h>
+
+#include "rcl/allocator.h"
+#include "rcl/macros.h"
+#include "rcl/types.h"
+#include "rcl/visibility_control.h"
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+/// Counters accumulated by a stats allocator.
+typedef struct rcl_allocator_stats_s
+{
+  /// Successful calls through allocate and zero_allocate.
+  uint64_t allocation_count;
+  /// Calls through deallocate with a non-NULL pointer.
+  uint64_t deallocation_count;
+  /// Calls through reallocate with a non-NULL pointer.
+  uint64_t reallocation_count;
+  /// Calls through allocate, reallocate or zero_allocate that returned NULL.
+  uint64_t failed_allocation_count;
+  /// Total bytes requested across successful allocations and reallocations.
+  uint64_t bytes_requested;
+} rcl_allocator_stats_t;
+
+/// A decorator that counts calls made through an allocator.
+/**
+ * rcl_stats_allocator_get_allocator() wraps the base allocator as a
+ * rcl_allocator_t which forwards every call and updates the counters, so
+ * allocation traffic of any entity can be measured by swapping the
+ * allocator in its options.
+ * The counters are not synchronized; wrap one per thread or accept
+ * approximate counts when the allocator is shared across threads.
+ */
+typedef struct rcl_stats_allocator_s
+{
+  /// Allocator the calls are forwarded to.
+  rcl_allocator_t base_allocator;
+  /// Counters, reset by rcl_stats_allocator_init().
+  rcl_allocator_stats_t stats;
+} rcl_stats_allocator_t;
+
+/// Initialize a stats allocator wrapping the given base allocator.
+RCL_PUBLIC
+RCL_WARN_UNUSED
+rcl_ret_t
+rcl_stats_allocator_init(
+  rcl_stats_allocator_t * stats_allocator,
+  const rcl_allocator_t * base_allocator);
+
+/// Return a rcl_allocator_t facade which forwards calls and counts them.
+/**
+ * The facade must not outlive the stats allocator, though memory obtained
+ * through it may, as the base allocator alone services every call.
+ */
+RCL_PUBLIC
+rcl_allocator_t
+rcl_stats_allocator_get_allocator(rcl_stats_allocator_t * stats_allocator);
+
+/// Copy the current counters into `stats`.
+RCL_PUBLIC
+RCL_WARN_UNUSED
+rcl_ret_t
+rcl_stats_allocator_get_stats(
+  const rcl_stats_allocator_t * stats_allocator,
+  rcl_allocator_stats_t * stats);
+
+/// Subsystem an allocation is attributed to by a tracking allocator.
+typedef enum rcl_alloc_domain_e
+{
+  RCL_ALLOC_DOMAIN_DEFAULT = 0,
+  RCL_ALLOC_DOMAIN_WAIT_SET,
+  RCL_ALLOC_DOMAIN_GRAPH,
+  RCL_ALLOC_DOMAIN_LOGGING,
+  RCL_ALLOC_DOMAIN_PARAMETERS,
+  /// Number of domains, not a valid domain itself.
+  RCL_ALLOC_DOMAIN_COUNT
+} rcl_alloc_domain_t;
+
+/// Counters accumulated per domain by a tracking allocator.
+typedef struct rcl_domain_alloc_stats_s
+{
+  /// Allocations not yet deallocated.
+  uint64_t live_allocation_count;
+  /// High-water mark of live_allocation_count.
+  uint64_t peak_allocation_count;
+  /// All allocations ever made, live or not.
+  uint64_t total_allocation_count;
+  /// Requested bytes not yet deallocated.
+  uint64_t live_bytes;
+  /// High-water mark of live_bytes.
+  uint64_t peak_bytes;
+  /// All requested bytes ever allocated, live or not.
+  uint64_t total_bytes;
+} rcl_domain_alloc_stats_t;
+
+struct rcl_tracking_allocator_s;
+
+/// \internal Facade state binding a tracking allocator to one domain.
+typedef struct rcl_tracking_allocator_domain_s
+{
+  struct rcl_tracking_allocator_s * tracking_allocator;
+  rcl_alloc_domain_t domain;
+} rcl_tracking_allocator_domain_t;
+
+/// A decorator that attributes allocations to rcl subsystems.
+/**
+ * rcl_tracking_allocator_get_allocator() returns one facade per domain;
+ * handing the wait set facade to rcl_wait_set_init(), the graph facade to
+ * graph queries and so on attributes each subsystem's traffic to its own
+ * live/peak/total counters, which is the measurement side of verifying
+ * that no allocation happens after initialization.
+ * Every allocation carries a small header recording its size and domain,
+ * so deallocations are attributed to the domain that allocated, not the
+ * facade they were released through.
+ * The counters are not synchronized, like rcl_stats_allocator_t.
+ */
+typedef struct rcl_tracking_allocator_s
+{
+  /// Allocator the calls are forwarded to.
+  rcl_allocator_t base_allocator;
+  /// Per-domain counters, reset by rcl_tracking_allocator_init().
+  rcl_domain_alloc_stats_t domains[RCL_ALLOC_DOMAIN_COUNT];
+  /// Facade states, one per domain, see rcl_tracking_allocator_get_allocator().
+  rcl_tracking_allocator_domain_t domain_states[RCL_ALLOC_DOMAIN_COUNT];
+} rcl_tracking_allocator_t;
+
+/// Initialize a tracking allocator wrapping the given base allocator.
+RCL_PUBLIC
+RCL_WARN_UNUSED
+rcl_ret_t
+rcl_tracking_allocator_init(
+  rcl_tracking_allocator_t * tracking_allocator,
+  const rcl_allocator_t * base_allocator);
+
+/// Return a rcl_allocator_t facade which attributes calls to `domain`.
+/**
+ * Returns a zero initialized allocator if the domain is out of range.
+ * The facade must not outlive the tracking allocator, and memory obtained
+ * through it must be released through one of its facades so the header
+ * can be stripped and the counters balanced.
+ */
+RCL_PUBLIC
+rcl_allocator_t
+rcl_tracking_allocator_get_allocator(
+  rcl_tracking_allocator_t * tracking_allocator,
+  rcl_alloc_domain_t domain);
+
+/// Copy the current counters of `domain` into `stats`.
+RCL_PUBLIC
+RCL_WARN_UNUSED
+rcl_ret_t
+rcl_tracking_allocator_get_domain_stats(
+  const rcl_tracking_allocator_t * tracking_allocator,
+  rcl_alloc_domain_t domain,
+  rcl_domain_alloc_stats_t * stats);
+
+/// Return a human readable name for the domain, or "unknown".
+RCL_PUBLIC
+const char *
+rcl_alloc_domain_name(rcl_alloc_domain_t domain);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif  // RCL__ALLOCATOR_STATS_H_
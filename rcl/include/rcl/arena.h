@@ -0,0 +1,101 @@
+// Copyright 2026 Open Source Robotics Foundation, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef RCL__ARENA_H_
+#define RCL__ARENA_H_
+
+#include <stddef.h>
+
+#include "rcl/allocator.h"
+#include "rcl/macros.h"
+#include "rcl/types.h"
+#include "rcl/visibility_control.h"
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+typedef struct rcl_arena_block_s rcl_arena_block_t;
+
+/// A bump allocator for short lived allocations.
+/**
+ * Memory is carved out of large blocks obtained from a base allocator, and
+ * is only reclaimed wholesale when the arena is finalized.
+ * rcl_arena_get_allocator() wraps the arena as a rcl_allocator_t whose
+ * deallocate is a no-op, so it can be handed to code that frees its
+ * temporaries individually without changing that code.
+ */
+typedef struct rcl_arena_s
+{
+  /// Allocator the blocks are obtained from.
+  rcl_allocator_t base_allocator;
+  /// Most recently added block, linked to the older ones.
+  rcl_arena_block_t * blocks;
+  /// Default payload capacity of a new block.
+  size_t block_size;
+} rcl_arena_t;
+
+/// Return an arena with members initialized to `NULL`.
+RCL_PUBLIC
+rcl_arena_t
+rcl_get_zero_initialized_arena(void);
+
+/// Initialize an arena; no block is allocated until the first allocation.
+RCL_PUBLIC
+RCL_WARN_UNUSED
+rcl_ret_t
+rcl_arena_init(
+  rcl_arena_t * arena,
+  size_t block_size,
+  const rcl_allocator_t * base_allocator);
+
+/// Allocate `size` bytes from the arena, or NULL if a block could not be added.
+RCL_PUBLIC
+void *
+rcl_arena_allocate(rcl_arena_t * arena, size_t size);
+
+/// Return a rcl_allocator_t facade over the arena.
+/**
+ * Deallocation through the facade is a no-op; reallocation copies into a
+ * fresh arena allocation.
+ * The facade must not outlive the arena.
+ */
+RCL_PUBLIC
+rcl_allocator_t
+rcl_arena_get_allocator(rcl_arena_t * arena);
+
+/// Invalidate all allocations while keeping one block warm for reuse.
+/**
+ * The most recent block is retained and rewound so the next scope of
+ * allocations starts without going back to the base allocator; all older
+ * blocks are released.
+ * Useful for per-iteration scratch memory, e.g. one reset per graph query.
+ */
+RCL_PUBLIC
+RCL_WARN_UNUSED
+rcl_ret_t
+rcl_arena_reset(rcl_arena_t * arena);
+
+/// Release every block of the arena, invalidating all allocations at once.
+RCL_PUBLIC
+RCL_WARN_UNUSED
+rcl_ret_t
+rcl_arena_fini(rcl_arena_t * arena);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif  // RCL__ARENA_H_
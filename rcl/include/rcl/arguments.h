@@ -17,6 +17,8 @@
 #ifndef RCL__ARGUMENTS_H_
 #define RCL__ARGUMENTS_H_
 
+#include <stdint.h>
+
 #include "rcl/allocator.h"
 #include "rcl/log_level.h"
 #include "rcl/macros.h"
@@ -311,8 +313,13 @@ rcl_arguments_get_param_files(
 
 /// Return all parameter overrides parsed from the command line.
 /**
- * Parameter overrides are parsed directly from command line arguments and
- * parameter files provided in the command line.
+ * Parameter overrides come from command line arguments and parameter files
+ * provided in the command line.
+ * Parameter files are not read during rcl_parse_arguments(); they are parsed
+ * lazily by the first call to this function, so errors in a file's contents
+ * are reported here rather than at argument parsing time.
+ * Subsequent calls reuse the materialized overrides, including calls through
+ * copies that share the same parsed arguments.
  *
  * <hr>
  * Attribute          | Adherence
@@ -403,16 +410,20 @@ rcl_arguments_get_log_levels(
 
 /// Copy one arguments structure into another.
 /**
+ * The parsed arguments are immutable, so the copy shares the underlying
+ * structure with \p args and only a reference count is incremented.
+ * Each copy must still be finalized individually with rcl_arguments_fini();
+ * the shared structure is reclaimed when the last copy is finalized.
+ *
  * <hr>
  * Attribute          | Adherence
  * ------------------ | -------------
- * Allocates Memory   | Yes
- * Thread-Safe        | No
- * Uses Atomics       | No
+ * Allocates Memory   | No
+ * Thread-Safe        | Yes
+ * Uses Atomics       | Yes
  * Lock-Free          | Yes
  *
  * \param[in] args The structure to be copied.
- *  Its allocator is used to copy memory into the new structure.
  * \param[out] args_out A zero-initialized arguments structure to be copied into.
  * \return #RCL_RET_OK if the structure was copied successfully, or
  * \return #RCL_RET_INVALID_ARGUMENT if any function arguments are invalid, or
@@ -426,6 +437,75 @@ rcl_arguments_copy(
   const rcl_arguments_t * args,
   rcl_arguments_t * args_out);
 
+/// Serialize parsed arguments into a compact binary blob.
+/**
+ * The blob captures the parsed remap rules, log levels, logging configuration
+ * flags, and security enclave so that a later process start can restore them
+ * with rcl_arguments_deserialize() without re-running the argument parser.
+ * Parameter overrides, parameter file paths, and the indices of unparsed
+ * arguments are not captured, since they refer to the original argv array.
+ * The encoding uses the host byte order and is not portable across
+ * architectures.
+ *
+ * <hr>
+ * Attribute          | Adherence
+ * ------------------ | -------------
+ * Allocates Memory   | Yes
+ * Thread-Safe        | No
+ * Uses Atomics       | No
+ * Lock-Free          | Yes
+ *
+ * \param[in] args An initialized arguments structure to serialize.
+ * \param[in] allocator A valid allocator used to allocate the blob.
+ * \param[out] buffer Set to the serialized blob on success.
+ *  The caller must deallocate it with the given allocator.
+ * \param[out] buffer_length Set to the length of the blob in bytes.
+ * \return #RCL_RET_OK if the arguments were serialized successfully, or
+ * \return #RCL_RET_INVALID_ARGUMENT if any function arguments are invalid, or
+ * \return #RCL_RET_BAD_ALLOC if allocating memory failed, or
+ * \return #RCL_RET_ERROR if an unspecified error occurs.
+ */
+RCL_PUBLIC
+RCL_WARN_UNUSED
+rcl_ret_t
+rcl_arguments_serialize(
+  const rcl_arguments_t * args,
+  rcl_allocator_t allocator,
+  uint8_t ** buffer,
+  size_t * buffer_length);
+
+/// Restore arguments from a blob produced by rcl_arguments_serialize().
+/**
+ * The blob is validated while it is read; a truncated or corrupted blob
+ * results in #RCL_RET_INVALID_ARGUMENT and leaves \p args_out finalized.
+ *
+ * <hr>
+ * Attribute          | Adherence
+ * ------------------ | -------------
+ * Allocates Memory   | Yes
+ * Thread-Safe        | No
+ * Uses Atomics       | No
+ * Lock-Free          | Yes
+ *
+ * \param[in] buffer A blob produced by rcl_arguments_serialize().
+ * \param[in] buffer_length Length of the blob in bytes.
+ * \param[in] allocator A valid allocator used to allocate the restored structure.
+ * \param[out] args_out A zero-initialized arguments structure to restore into.
+ * \return #RCL_RET_OK if the arguments were restored successfully, or
+ * \return #RCL_RET_INVALID_ARGUMENT if any function arguments are invalid, or
+ * \return #RCL_RET_INVALID_ARGUMENT if the blob fails validation, or
+ * \return #RCL_RET_BAD_ALLOC if allocating memory failed, or
+ * \return #RCL_RET_ERROR if an unspecified error occurs.
+ */
+RCL_PUBLIC
+RCL_WARN_UNUSED
+rcl_ret_t
+rcl_arguments_deserialize(
+  const uint8_t * buffer,
+  size_t buffer_length,
+  rcl_allocator_t allocator,
+  rcl_arguments_t * args_out);
+
 /// Reclaim resources held inside rcl_arguments_t structure.
 /**
  * <hr>
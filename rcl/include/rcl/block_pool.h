@@ -0,0 +1,106 @@
+// Copyright 2026 Open Source Robotics Foundation, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef RCL__BLOCK_POOL_H_
+#define RCL__BLOCK_POOL_H_
+
+#include <stddef.h>
+
+#include "rcl/allocator.h"
+#include "rcl/macros.h"
+#include "rcl/types.h"
+#include "rcl/visibility_control.h"
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+typedef struct rcl_block_pool_chunk_s rcl_block_pool_chunk_t;
+typedef struct rcl_block_pool_free_node_s rcl_block_pool_free_node_t;
+
+/// A fixed-block pool for allocations of a known maximum size.
+/**
+ * Blocks are carved out of chunks obtained from a base allocator and
+ * recycled through a free list, so steady-state allocate/deallocate pairs
+ * never touch the base allocator.
+ * rcl_block_pool_get_allocator() wraps the pool as a rcl_allocator_t;
+ * requests larger than the block size fall through to the base allocator,
+ * so the facade is a drop-in replacement for code with mixed sizes.
+ */
+typedef struct rcl_block_pool_s
+{
+  /// Allocator the chunks are obtained from.
+  rcl_allocator_t base_allocator;
+  /// Payload capacity of each block in bytes.
+  size_t block_size;
+  /// Number of blocks carved out of each new chunk.
+  size_t blocks_per_chunk;
+  /// Most recently added chunk, linked to the older ones.
+  rcl_block_pool_chunk_t * chunks;
+  /// Blocks available for reuse.
+  rcl_block_pool_free_node_t * free_list;
+} rcl_block_pool_t;
+
+/// Return a block pool with members initialized to `NULL`.
+RCL_PUBLIC
+rcl_block_pool_t
+rcl_get_zero_initialized_block_pool(void);
+
+/// Initialize a block pool; no chunk is allocated until the first allocation.
+RCL_PUBLIC
+RCL_WARN_UNUSED
+rcl_ret_t
+rcl_block_pool_init(
+  rcl_block_pool_t * pool,
+  size_t block_size,
+  size_t blocks_per_chunk,
+  const rcl_allocator_t * base_allocator);
+
+/// Take a block from the pool, or NULL if a chunk could not be added.
+RCL_PUBLIC
+void *
+rcl_block_pool_allocate(rcl_block_pool_t * pool);
+
+/// Return a block previously taken with rcl_block_pool_allocate().
+RCL_PUBLIC
+void
+rcl_block_pool_deallocate(rcl_block_pool_t * pool, void * pointer);
+
+/// Return a rcl_allocator_t facade over the pool.
+/**
+ * Requests no larger than the pool's block size are served from the pool;
+ * larger requests are forwarded to the base allocator, and deallocation
+ * routes each pointer back to wherever it came from.
+ * The facade must not outlive the pool.
+ */
+RCL_PUBLIC
+rcl_allocator_t
+rcl_block_pool_get_allocator(rcl_block_pool_t * pool);
+
+/// Release every chunk of the pool, invalidating all blocks at once.
+/**
+ * Allocations that were forwarded to the base allocator by the facade must
+ * be deallocated through the facade before finalizing.
+ */
+RCL_PUBLIC
+RCL_WARN_UNUSED
+rcl_ret_t
+rcl_block_pool_fini(rcl_block_pool_t * pool);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif  // RCL__BLOCK_POOL_H_
@@ -169,6 +169,52 @@ rcl_client_init(
   const char * service_name,
   const rcl_client_options_t * options);
 
+/// Initialize a rcl client from an already resolved service name.
+/**
+ * Behaves like rcl_client_init() but takes a service name that is already
+ * fully qualified, expanded, and remapped — as produced by a prior
+ * rcl_node_resolve_name() — and therefore skips the name expansion and
+ * remapping machinery entirely.
+ * Useful when several related clients and services are created from one
+ * base name, e.g. action clients: resolve the base name once and derive
+ * the related service names from that single resolution.
+ *
+ * The name is only checked to be non-null and to start with `/`; passing a
+ * name that did not come from a resolution is the caller's responsibility
+ * and invalid names surface as middleware errors.
+ * The string is copied as needed and stays owned by the caller.
+ *
+ * <hr>
+ * Attribute          | Adherence
+ * ------------------ | -------------
+ * Allocates Memory   | Yes
+ * Thread-Safe        | No
+ * Uses Atomics       | No
+ * Lock-Free          | Yes
+ *
+ * \param[inout] client preallocated rcl_client_t structure
+ * \param[in] node valid rcl_node_t
+ * \param[in] type_support type support object for the service's type
+ * \param[in] resolved_service_name the fully qualified service name to request
+ * \param[in] options client options, including quality of service settings
+ * \return #RCL_RET_OK if the client was initialized successfully, or
+ * \return #RCL_RET_NODE_INVALID if the node is invalid, or
+ * \return #RCL_RET_ALREADY_INIT if the client is already initialized, or
+ * \return #RCL_RET_INVALID_ARGUMENT if any arguments are invalid, or
+ * \return #RCL_RET_BAD_ALLOC if allocating memory fails, or
+ * \return #RCL_RET_SERVICE_NAME_INVALID if the name is not fully qualified, or
+ * \return #RCL_RET_ERROR if an unspecified error occurs.
+ */
+RCL_PUBLIC
+RCL_WARN_UNUSED
+rcl_ret_t
+rcl_client_init_with_resolved_name(
+  rcl_client_t * client,
+  const rcl_node_t * node,
+  const rosidl_service_type_support_t * type_support,
+  const char * resolved_service_name,
+  const rcl_client_options_t * options);
+
 /// Finalize a rcl_client_t.
 /**
  * After calling this function, calls to rcl_send_request() and
@@ -221,12 +267,12 @@ rcl_client_get_default_options(void);
  * The ROS request message given by the `ros_request` void pointer is always
  * owned by the calling code, but should remain constant during `send_request`.
  *
- * This function is thread safe so long as access to both the client and the
- * `ros_request` is synchronized.
- * That means that calling rcl_send_request() from multiple threads is allowed,
- * but calling rcl_send_request() at the same time as non-thread safe client
- * functions is not, e.g. calling rcl_send_request() and rcl_client_fini()
- * concurrently is not allowed.
+ * This function is thread safe: the client sequence number is maintained
+ * with lock-free atomics, so multiple threads may send requests through the
+ * same client concurrently without contending on a lock.
+ * Calling rcl_send_request() at the same time as non-thread safe client
+ * functions is still not allowed, e.g. calling rcl_send_request() and
+ * rcl_client_fini() concurrently is not allowed.
  * The message cannot change during the rcl_send_request() call.
  * Before calling rcl_send_request() the message can change but after calling
  * rcl_send_request() it depends on RMW implementation behavior.
@@ -238,10 +284,9 @@ rcl_client_get_default_options(void);
  * Attribute          | Adherence
  * ------------------ | -------------
  * Allocates Memory   | No
- * Thread-Safe        | Yes [1]
- * Uses Atomics       | No
+ * Thread-Safe        | Yes
+ * Uses Atomics       | Yes
  * Lock-Free          | Yes
- * <i>[1] for unique pairs of clients and requests, see above for more</i>
  *
  * \param[in] client handle to the client which will make the response
  * \param[in] ros_request type-erased pointer to the ROS request message
@@ -309,6 +354,275 @@ rcl_take_response(
   rmw_request_id_t * request_header,
   void * ros_response);
 
+/// Callback invoked when a pipelined request's response is drained.
+/**
+ * \param[in] user_data the pointer registered with the request
+ * \param[in] sequence_number sequence number the response correlates to
+ * \param[in] ros_response the deserialized response, only valid during the
+ *   callback
+ */
+typedef void (* rcl_client_response_callback_t)(
+  const void * user_data,
+  int64_t sequence_number,
+  void * ros_response);
+
+/// Initialize the pipelined request mode on a client.
+/**
+ * Attaches an outstanding-request table of `window_size` slots to the
+ * client, enabling rcl_send_request_pipelined(),
+ * rcl_client_drain_responses() and rcl_take_response_demuxed().
+ * The table uses open addressing keyed by sequence number, so correlating a
+ * response to its request is O(1) instead of a scan over every in-flight
+ * request; slots are claimed and released with atomic operations, so
+ * requests can be issued from multiple threads without serializing on a
+ * mutex.
+ *
+ * The table is released by rcl_client_fini() if it is still initialized.
+ *
+ * <hr>
+ * Attribute          | Adherence
+ * ------------------ | -------------
+ * Allocates Memory   | Yes
+ * Thread-Safe        | No
+ * Uses Atomics       | No
+ * Lock-Free          | Yes
+ *
+ * \param[in] client Client to enable pipelining on.
+ * \param[in] window_size Maximum outstanding requests, must be greater than
+ *   zero.
+ * \return #RCL_RET_OK if pipelining was enabled, or
+ * \return #RCL_RET_CLIENT_INVALID if the client is invalid, or
+ * \return #RCL_RET_INVALID_ARGUMENT if window_size is zero, or
+ * \return #RCL_RET_ALREADY_INIT if pipelining is already enabled, or
+ * \return #RCL_RET_BAD_ALLOC if allocating the table failed.
+ */
+RCL_PUBLIC
+RCL_WARN_UNUSED
+rcl_ret_t
+rcl_client_init_pipeline(rcl_client_t * client, size_t window_size);
+
+/// Finalize a client's pipelined request mode.
+/**
+ * Completion callbacks registered with outstanding requests are dropped
+ * without being invoked.
+ * Does nothing if pipelining was never enabled.
+ *
+ * <hr>
+ * Attribute          | Adherence
+ * ------------------ | -------------
+ * Allocates Memory   | No
+ * Thread-Safe        | No
+ * Uses Atomics       | No
+ * Lock-Free          | Yes
+ *
+ * \param[in] client Client to disable pipelining on.
+ * \return #RCL_RET_OK if pipelining was disabled or never enabled, or
+ * \return #RCL_RET_CLIENT_INVALID if the client is invalid.
+ */
+RCL_PUBLIC
+RCL_WARN_UNUSED
+rcl_ret_t
+rcl_client_fini_pipeline(rcl_client_t * client);
+
+/// Send a request and register a completion callback for its response.
+/**
+ * Behaves like rcl_send_request(), additionally registering `callback` and
+ * `user_data` as the request's completion context so the response can be
+ * correlated in O(1) by rcl_client_drain_responses() or
+ * rcl_take_response_demuxed().
+ * `callback` may be NULL when responses are consumed through
+ * rcl_take_response_demuxed(), which hands the context back instead of
+ * invoking it.
+ * The slot is claimed lock-free, so concurrent senders do not serialize on a
+ * mutex.
+ *
+ * <hr>
+ * Attribute          | Adherence
+ * ------------------ | -------------
+ * Allocates Memory   | No
+ * Thread-Safe        | Yes
+ * Uses Atomics       | Yes
+ * Lock-Free          | Yes
+ *
+ * \param[in] client Client with pipelining enabled (see
+ *   rcl_client_init_pipeline()).
+ * \param[in] ros_request type-erased pointer to the request message
+ * \param[in] callback invoked with the response during draining, or NULL
+ * \param[in] user_data completion context handed back with the response,
+ *   may be NULL
+ * \param[out] sequence_number the assigned sequence number
+ * \return #RCL_RET_OK if the request was sent, or
+ * \return #RCL_RET_CLIENT_INVALID if the client is invalid, or
+ * \return #RCL_RET_INVALID_ARGUMENT if any arguments are invalid or
+ *         pipelining is not enabled, or
+ * \return #RCL_RET_ERROR if the window is full or an unspecified error
+ *         occurs.
+ */
+RCL_PUBLIC
+RCL_WARN_UNUSED
+rcl_ret_t
+rcl_send_request_pipelined(
+  const rcl_client_t * client,
+  const void * ros_request,
+  rcl_client_response_callback_t callback,
+  const void * user_data,
+  int64_t * sequence_number);
+
+/// Take one response and return the completion context registered with it.
+/**
+ * Behaves like rcl_take_response_with_info(), additionally resolving the
+ * response's sequence number against the pipeline table in O(1) and handing
+ * back the `user_data` pointer that was registered with
+ * rcl_send_request_pipelined().
+ * The registered callback, if any, is not invoked; this is the caller-driven
+ * alternative to rcl_client_drain_responses().
+ *
+ * <hr>
+ * Attribute          | Adherence
+ * ------------------ | -------------
+ * Allocates Memory   | Maybe [1]
+ * Thread-Safe        | No
+ * Uses Atomics       | Yes
+ * Lock-Free          | Yes
+ * <i>[1] only if required when filling the response, avoided for fixed sizes</i>
+ *
+ * \param[in] client Client with pipelining enabled (see
+ *   rcl_client_init_pipeline()).
+ * \param[inout] request_header pointer to the response header
+ * \param[inout] ros_response type-erased pointer to an allocated response
+ *   message
+ * \param[out] context the completion context registered with the request
+ * \return #RCL_RET_OK if the response was taken and correlated, or
+ * \return #RCL_RET_CLIENT_INVALID if the client is invalid, or
+ * \return #RCL_RET_INVALID_ARGUMENT if any arguments are invalid or
+ *         pipelining is not enabled, or
+ * \return #RCL_RET_CLIENT_TAKE_FAILED if no response was available, or
+ * \return #RCL_RET_ERROR if the response matches no outstanding request or
+ *         an unspecified error occurs.
+ */
+RCL_PUBLIC
+RCL_WARN_UNUSED
+rcl_ret_t
+rcl_take_response_demuxed(
+  const rcl_client_t * client,
+  rmw_service_info_t * request_header,
+  void * ros_response,
+  const void ** context);
+
+/// Drain every queued response, completing the matching pipelined requests.
+/**
+ * Takes responses until the middleware queue is empty, deserializing each
+ * into `ros_response` and invoking the completion callback registered with
+ * the matching pipelined request.
+ * Responses without a matching outstanding request (e.g. taken after
+ * rcl_client_fini_pipeline()) are discarded.
+ * `ros_response` is reused across responses, so callbacks must consume it
+ * before returning.
+ *
+ * <hr>
+ * Attribute          | Adherence
+ * ------------------ | -------------
+ * Allocates Memory   | Maybe [1]
+ * Thread-Safe        | No
+ * Uses Atomics       | Yes
+ * Lock-Free          | Yes
+ * <i>[1] only if required when filling the response, avoided for fixed sizes</i>
+ *
+ * \param[in] client Client with pipelining enabled.
+ * \param[inout] ros_response type-erased pointer to an allocated response
+ *   message, reused for every drained response
+ * \param[out] completed set to the number of callbacks invoked
+ * \return #RCL_RET_OK if one or more responses completed a request, or
+ * \return #RCL_RET_CLIENT_INVALID if the client is invalid, or
+ * \return #RCL_RET_INVALID_ARGUMENT if any arguments are invalid or
+ *         pipelining is not enabled, or
+ * \return #RCL_RET_CLIENT_TAKE_FAILED if no response was available, or
+ * \return #RCL_RET_ERROR if an unspecified error occurs.
+ */
+RCL_PUBLIC
+RCL_WARN_UNUSED
+rcl_ret_t
+rcl_client_drain_responses(
+  const rcl_client_t * client,
+  void * ros_response,
+  size_t * completed);
+
+struct rcl_client_completion_context_s;
+
+/// Signature of the completion hook of a rcl_client_completion_context_t.
+/**
+ * Invoked from rcl_client_drain_responses() with the context's output
+ * fields filled in; see rcl_client_async_send_request().
+ *
+ * \param[in] context the completion context registered with the request
+ */
+typedef void (* rcl_client_completion_callback_t)(
+  struct rcl_client_completion_context_s * context);
+
+/// Completion token for a single asynchronous service request.
+/**
+ * The caller embeds one of these per in-flight request, e.g. in a coroutine
+ * frame or future state block, fills in `on_complete` and `user_data`, and
+ * hands it to rcl_client_async_send_request().
+ * The struct must stay alive and unmoved until `on_complete` fires or the
+ * pipeline is finalized; rcl stores a pointer to it, never a copy.
+ */
+typedef struct rcl_client_completion_context_s
+{
+  /// Completion hook, invoked once when the response is drained.
+  rcl_client_completion_callback_t on_complete;
+  /// Caller-owned pointer handed through untouched, e.g. a coroutine handle.
+  void * user_data;
+  /// The assigned sequence number, filled by
+  /// rcl_client_async_send_request().
+  int64_t sequence_number;
+  /// The taken response, only valid for the duration of `on_complete`; the
+  /// hook must copy or move what it needs before returning.
+  void * ros_response;
+} rcl_client_completion_context_t;
+
+/// Send a request whose response completes a caller-owned context.
+/**
+ * The coroutine-friendly layer over rcl_send_request_pipelined(): instead of
+ * a bare callback and user data pair, the request is tied to a
+ * rcl_client_completion_context_t owned by the caller.
+ * When rcl_client_drain_responses() takes the matching response — typically
+ * from the executor's dispatch path once the wait set reports the client
+ * ready — `context->ros_response` is pointed at the taken response and
+ * `context->on_complete` is invoked, eliminating the wake, scan, take and
+ * correlate round trip that a polling caller pays per response.
+ *
+ * The context's `sequence_number` is filled before this function returns,
+ * so `on_complete` may rely on it.
+ *
+ * <hr>
+ * Attribute          | Adherence
+ * ------------------ | -------------
+ * Allocates Memory   | No
+ * Thread-Safe        | Yes
+ * Uses Atomics       | Yes
+ * Lock-Free          | Yes
+ *
+ * \param[in] client Client with pipelining enabled (see
+ *   rcl_client_init_pipeline()).
+ * \param[in] ros_request type-erased pointer to the request message
+ * \param[inout] context completion context with `on_complete` set; must
+ *   outlive the request
+ * \return #RCL_RET_OK if the request was sent, or
+ * \return #RCL_RET_CLIENT_INVALID if the client is invalid, or
+ * \return #RCL_RET_INVALID_ARGUMENT if any arguments are invalid,
+ *         `context->on_complete` is NULL, or pipelining is not enabled, or
+ * \return #RCL_RET_ERROR if the window is full or an unspecified error
+ *         occurs.
+ */
+RCL_PUBLIC
+RCL_WARN_UNUSED
+rcl_ret_t
+rcl_client_async_send_request(
+  const rcl_client_t * client,
+  const void * ros_request,
+  rcl_client_completion_context_t * context);
+
 /// Get the name of the service that this client will request a response from.
 /**
  * This function returns the client's internal service name string.
@@ -540,6 +854,40 @@ rcl_client_configure_service_introspection(
   const rcl_publisher_options_t publisher_options,
   rcl_service_introspection_state_t introspection_state);
 
+/// Cap the serialized size of this client's introspection events.
+/**
+ * When a non-zero cap is set, full-contents introspection events whose
+ * serialized size exceeds \p max_payload_bytes are published in the
+ * payload-free metadata form instead, recognizable by their empty request
+ * and response sequences.
+ * This bounds the introspection overhead of clients exchanging large
+ * payloads without turning contents introspection off entirely.
+ * Pass 0 to remove the cap.
+ *
+ * Service introspection must already be configured on this client with
+ * rcl_client_configure_service_introspection().
+ *
+ * <hr>
+ * Attribute          | Adherence
+ * ------------------ | -------------
+ * Allocates Memory   | No
+ * Thread-Safe        | No
+ * Uses Atomics       | No
+ * Lock-Free          | Yes
+ *
+ * \param[in] client client whose introspection events should be capped
+ * \param[in] max_payload_bytes serialized event size cap, 0 for unlimited
+ * \return #RCL_RET_OK if the cap was set, or
+ * \return #RCL_RET_CLIENT_INVALID if the client is invalid, or
+ * \return #RCL_RET_ERROR if introspection is not configured on this client.
+ */
+RCL_PUBLIC
+RCL_WARN_UNUSED
+rcl_ret_t
+rcl_client_set_introspection_payload_limit(
+  rcl_client_t * client,
+  size_t max_payload_bytes);
+
 #ifdef __cplusplus
 }
 #endif
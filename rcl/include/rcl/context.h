@@ -27,7 +27,9 @@ extern "C"
 #include "rcl/allocator.h"
 #include "rcl/arguments.h"
 #include "rcl/init_options.h"
+#include "rcl/intern_pool.h"
 #include "rcl/macros.h"
+#include "rcl/type_registry.h"
 #include "rcl/types.h"
 #include "rcl/visibility_control.h"
 
@@ -314,6 +316,142 @@ RCL_WARN_UNUSED
 rmw_context_t *
 rcl_context_get_rmw_context(rcl_context_t * context);
 
+/// Create the rmw context now if its creation was deferred during init.
+/**
+ * When the context was initialized with the defer_rmw_init option, see
+ * rcl_init_options_set_defer_rmw_init(), the rmw context does not exist until
+ * this function is called. It is called implicitly when the first node, guard
+ * condition or wait set is initialized on the context, and is a no-op when the
+ * rmw context was already created.
+ *
+ * This function is not thread-safe; concurrent first-time entity creation on
+ * the same context must be synchronized by the caller.
+ *
+ * Attribute          | Adherence
+ * ------------------ | -------------
+ * Allocates Memory   | Yes
+ * Thread-Safe        | No
+ * Uses Atomics       | Yes
+ * Lock-Free          | Yes
+ *
+ * \param[inout] context object whose rmw context should be created.
+ * \return #RCL_RET_OK if the rmw context exists after the call, or
+ * \return #RCL_RET_INVALID_ARGUMENT if context is `NULL`, or
+ * \return #RCL_RET_NOT_INIT if the context is not valid, or
+ * \return #RCL_RET_ERROR if creating the rmw context fails.
+ */
+RCL_PUBLIC
+RCL_WARN_UNUSED
+rcl_ret_t
+rcl_context_ensure_rmw_context(rcl_context_t * context);
+
+/// Return the context's string interning pool, otherwise `NULL`.
+/**
+ * The pool is shared by all users of the context and is lazily initialized
+ * by the first call; it is finalized together with the context.
+ * See rcl_intern_pool_t for the pooling semantics.
+ *
+ * If context is `NULL`, then `NULL` is returned.
+ * If context is zero-initialized, then `NULL` is returned.
+ * If context is uninitialized, then it is undefined behavior.
+ *
+ * This function is not thread-safe, matching the pool it returns.
+ *
+ * Attribute          | Adherence
+ * ------------------ | -------------
+ * Allocates Memory   | Yes [1]
+ * Thread-Safe        | No
+ * Uses Atomics       | No
+ * Lock-Free          | Yes
+ * <i>[1] only on the first call for a given context</i>
+ *
+ * \param[in] context object from which the interning pool should be retrieved.
+ * \return pointer to the interning pool if valid, otherwise `NULL`
+ */
+RCL_PUBLIC
+RCL_WARN_UNUSED
+rcl_intern_pool_t *
+rcl_context_get_intern_pool(rcl_context_t * context);
+
+/// Return the context's type registry, otherwise `NULL`.
+/**
+ * The registry is shared by all users of the context and is lazily
+ * initialized by the first call; it is finalized together with the context.
+ * See rcl_type_registry_t for the caching semantics.
+ *
+ * If context is `NULL`, then `NULL` is returned.
+ * If context is zero-initialized, then `NULL` is returned.
+ * If context is uninitialized, then it is undefined behavior.
+ *
+ * This function is not thread-safe, matching the registry it returns.
+ *
+ * Attribute          | Adherence
+ * ------------------ | -------------
+ * Allocates Memory   | Yes [1]
+ * Thread-Safe        | No
+ * Uses Atomics       | No
+ * Lock-Free          | Yes
+ * <i>[1] only on the first call for a given context</i>
+ *
+ * \param[in] context object from which the type registry should be retrieved.
+ * \return pointer to the type registry if valid, otherwise `NULL`
+ */
+RCL_PUBLIC
+RCL_WARN_UNUSED
+rcl_type_registry_t *
+rcl_context_get_type_registry(rcl_context_t * context);
+
+/// Durations of the phases of context initialization, in nanoseconds.
+/**
+ * All durations are measured with a monotonic clock and recorded by
+ * rcl_init() as each phase finishes.
+ * A duration of `0` means the phase has not run (yet); in particular
+ * `rmw_init_ns` stays `0` until the rmw context is actually created when its
+ * creation was deferred with rcl_init_options_set_defer_rmw_init().
+ */
+typedef struct rcl_init_timings_s
+{
+  /// Time spent parsing the global ROS arguments.
+  int64_t argument_parsing_ns;
+  /// Time spent configuring discovery options from the environment.
+  int64_t discovery_ns;
+  /// Time spent resolving the enclave name and security options.
+  int64_t security_ns;
+  /// Time spent creating the rmw context, e.g. in rmw_init().
+  int64_t rmw_init_ns;
+  /// Total time spent in rcl_init(), excluding deferred rmw context creation.
+  int64_t total_ns;
+} rcl_init_timings_t;
+
+/// Retrieve the initialization phase timings recorded for a context.
+/**
+ * Copies the phase durations recorded while the context was initialized into
+ * the given output struct, so startup time can be attributed to argument
+ * parsing, security, discovery configuration and the middleware without
+ * external instrumentation.
+ * The same breakdown is logged at debug severity at the end of rcl_init().
+ *
+ * The given context must be non-`NULL` and initialized, but it does not need
+ * to still be valid, so timings remain retrievable after rcl_shutdown().
+ *
+ * <hr>
+ * Attribute          | Adherence
+ * ------------------ | -------------
+ * Allocates Memory   | No
+ * Thread-Safe        | No
+ * Uses Atomics       | No
+ * Lock-Free          | Yes
+ *
+ * \param[in] context object from which the timings should be retrieved
+ * \param[out] timings struct the recorded phase durations are copied into
+ * \return #RCL_RET_OK if the timings were retrieved successfully, or
+ * \return #RCL_RET_INVALID_ARGUMENT if any arguments are invalid.
+ */
+RCL_PUBLIC
+RCL_WARN_UNUSED
+rcl_ret_t
+rcl_context_get_init_timings(const rcl_context_t * context, rcl_init_timings_t * timings);
+
 #ifdef __cplusplus
 }
 #endif
@@ -45,6 +45,41 @@ RCL_WARN_UNUSED
 rcl_ret_t
 rcl_dynamic_message_type_support_handle_fini(rosidl_message_type_support_t * ts);
 
+/// Acquire a shared dynamic message type support handle
+/**
+ * Like `rcl_dynamic_message_type_support_handle_init()`, but handles are kept
+ * in a process-wide, reference-counted cache keyed by the type's hash and the
+ * serialization library name.  The first acquisition of a type constructs the
+ * handle; subsequent acquisitions of the same type return the same handle and
+ * only bump its reference count, so many subscriptions to the same described
+ * type share one constructed handle.
+ *
+ * Does not take ownership of description (copies).
+ *
+ * Every successful acquisition must be balanced with a call to
+ * `rcl_dynamic_message_type_support_handle_release()`.
+ * The cache is not synchronized; callers must serialize access themselves.
+ */
+RCL_PUBLIC
+RCL_WARN_UNUSED
+rcl_ret_t
+rcl_dynamic_message_type_support_handle_acquire(
+  const char * serialization_lib_name,
+  const rosidl_runtime_c__type_description__TypeDescription * description,
+  rcl_allocator_t * allocator,
+  const rosidl_message_type_support_t ** ts);  // OUT, borrowed from the cache
+
+/// Release a type support handle acquired with
+/// `rcl_dynamic_message_type_support_handle_acquire()`
+/**
+ * Decrements the handle's reference count and finalizes the handle when the
+ * count reaches zero.  The pointer must not be used after this call returns.
+ */
+RCL_PUBLIC
+RCL_WARN_UNUSED
+rcl_ret_t
+rcl_dynamic_message_type_support_handle_release(const rosidl_message_type_support_t * ts);
+
 #ifdef __cplusplus
 }
 #endif
@@ -0,0 +1,209 @@
+// Copyright 2026 Open Source Robotics Foundation, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef RCL__ENTITY_COST_H_
+#define RCL__ENTITY_COST_H_
+
+#include <stdint.h>
+
+#include "rcl/macros.h"
+#include "rcl/service.h"
+#include "rcl/subscription.h"
+#include "rcl/timer.h"
+#include "rcl/types.h"
+#include "rcl/visibility_control.h"
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+/// Kind of entity passed to rcl_entity_get_cost_estimate().
+typedef enum rcl_entity_type_e
+{
+  /// The entity is a `const rcl_subscription_t *`.
+  RCL_ENTITY_TYPE_SUBSCRIPTION = 1,
+  /// The entity is a `const rcl_timer_t *`.
+  RCL_ENTITY_TYPE_TIMER = 2,
+  /// The entity is a `const rcl_service_t *`.
+  RCL_ENTITY_TYPE_SERVICE = 3,
+} rcl_entity_type_t;
+
+/// Snapshot of an entity's recent service cost.
+/**
+ * Costs are wall-clock durations of the rcl-side work done to service the
+ * entity, measured with the steady clock: the duration of a successful
+ * rcl_take() for subscriptions, of rcl_timer_call() including the user
+ * callback for timers and of a successful rcl_take_request() for services.
+ * Executors can use the estimates to balance callbacks across threads.
+ */
+typedef struct rcl_entity_cost_estimate_s
+{
+  /// Number of servicing operations recorded while accounting was enabled.
+  uint64_t sample_count;
+  /// Duration of the most recently recorded operation, in nanoseconds.
+  int64_t last_cost_ns;
+  /// Exponentially weighted moving average of the operation duration,
+  /// in nanoseconds (alpha = 1/8).
+  int64_t ewma_cost_ns;
+  /// Sum of all recorded operation durations, in nanoseconds.
+  int64_t total_cost_ns;
+} rcl_entity_cost_estimate_t;
+
+/// Enable cost accounting on a subscription.
+/**
+ * While enabled, each successful rcl_take() records its duration into
+ * relaxed atomic counters readable through rcl_entity_get_cost_estimate();
+ * the cost per take is two steady-clock reads and a handful of atomic
+ * operations.
+ * Accounting is disabled by default, making the instrumentation free when
+ * unused.
+ *
+ * <hr>
+ * Attribute          | Adherence
+ * ------------------ | -------------
+ * Allocates Memory   | No
+ * Thread-Safe        | Yes
+ * Uses Atomics       | Yes
+ * Lock-Free          | Yes
+ *
+ * \param[in] subscription pointer to the rcl subscription
+ * \return #RCL_RET_OK if accounting was enabled, or
+ * \return #RCL_RET_SUBSCRIPTION_INVALID if the subscription is invalid.
+ */
+RCL_PUBLIC
+RCL_WARN_UNUSED
+rcl_ret_t
+rcl_subscription_enable_cost_accounting(rcl_subscription_t * subscription);
+
+/// Disable cost accounting on a subscription.
+/**
+ * Counter values accumulated so far are kept and remain readable through
+ * rcl_entity_get_cost_estimate().
+ *
+ * \param[in] subscription pointer to the rcl subscription
+ * \return #RCL_RET_OK if accounting was disabled, or
+ * \return #RCL_RET_SUBSCRIPTION_INVALID if the subscription is invalid.
+ */
+RCL_PUBLIC
+RCL_WARN_UNUSED
+rcl_ret_t
+rcl_subscription_disable_cost_accounting(rcl_subscription_t * subscription);
+
+/// Enable cost accounting on a timer.
+/**
+ * While enabled, each rcl_timer_call() records the duration of the call,
+ * including the user callback, into relaxed atomic counters readable
+ * through rcl_entity_get_cost_estimate().
+ * Accounting is disabled by default.
+ *
+ * \param[in] timer pointer to the rcl timer
+ * \return #RCL_RET_OK if accounting was enabled, or
+ * \return #RCL_RET_INVALID_ARGUMENT if the timer is null, or
+ * \return #RCL_RET_TIMER_INVALID if the timer is invalid.
+ */
+RCL_PUBLIC
+RCL_WARN_UNUSED
+rcl_ret_t
+rcl_timer_enable_cost_accounting(rcl_timer_t * timer);
+
+/// Disable cost accounting on a timer.
+/**
+ * Counter values accumulated so far are kept and remain readable through
+ * rcl_entity_get_cost_estimate().
+ *
+ * \param[in] timer pointer to the rcl timer
+ * \return #RCL_RET_OK if accounting was disabled, or
+ * \return #RCL_RET_INVALID_ARGUMENT if the timer is null, or
+ * \return #RCL_RET_TIMER_INVALID if the timer is invalid.
+ */
+RCL_PUBLIC
+RCL_WARN_UNUSED
+rcl_ret_t
+rcl_timer_disable_cost_accounting(rcl_timer_t * timer);
+
+/// Enable cost accounting on a service.
+/**
+ * While enabled, each successful rcl_take_request() or
+ * rcl_take_request_with_info() records its duration, including any
+ * introspection event publication, into relaxed atomic counters readable
+ * through rcl_entity_get_cost_estimate().
+ * Accounting is disabled by default.
+ *
+ * \param[in] service pointer to the rcl service
+ * \return #RCL_RET_OK if accounting was enabled, or
+ * \return #RCL_RET_SERVICE_INVALID if the service is invalid.
+ */
+RCL_PUBLIC
+RCL_WARN_UNUSED
+rcl_ret_t
+rcl_service_enable_cost_accounting(rcl_service_t * service);
+
+/// Disable cost accounting on a service.
+/**
+ * Counter values accumulated so far are kept and remain readable through
+ * rcl_entity_get_cost_estimate().
+ *
+ * \param[in] service pointer to the rcl service
+ * \return #RCL_RET_OK if accounting was disabled, or
+ * \return #RCL_RET_SERVICE_INVALID if the service is invalid.
+ */
+RCL_PUBLIC
+RCL_WARN_UNUSED
+rcl_ret_t
+rcl_service_disable_cost_accounting(rcl_service_t * service);
+
+/// Read a snapshot of an entity's cost accounting counters.
+/**
+ * `entity` must point to the handle named by `entity_type`, e.g. a
+ * `const rcl_subscription_t *` for #RCL_ENTITY_TYPE_SUBSCRIPTION.
+ * The uniform signature lets an executor keep one estimate-refresh path
+ * for every entity kind it schedules.
+ *
+ * The counters are read with individual atomic loads, so values observed
+ * concurrently with servicing may come from slightly different instants;
+ * each individual counter is always consistent.
+ * The snapshot is all zeros while no operation has been recorded.
+ *
+ * <hr>
+ * Attribute          | Adherence
+ * ------------------ | -------------
+ * Allocates Memory   | No
+ * Thread-Safe        | Yes
+ * Uses Atomics       | Yes
+ * Lock-Free          | Yes
+ *
+ * \param[in] entity_type kind of entity `entity` points to
+ * \param[in] entity pointer to the entity handle
+ * \param[out] cost_estimate filled with the current counter values
+ * \return #RCL_RET_OK if the snapshot was taken, or
+ * \return #RCL_RET_INVALID_ARGUMENT if entity or cost_estimate is null or
+ *   entity_type is not a known entity type, or
+ * \return #RCL_RET_SUBSCRIPTION_INVALID if the subscription is invalid, or
+ * \return #RCL_RET_TIMER_INVALID if the timer is invalid, or
+ * \return #RCL_RET_SERVICE_INVALID if the service is invalid.
+ */
+RCL_PUBLIC
+RCL_WARN_UNUSED
+rcl_ret_t
+rcl_entity_get_cost_estimate(
+  rcl_entity_type_t entity_type,
+  const void * entity,
+  rcl_entity_cost_estimate_t * cost_estimate);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif  // RCL__ENTITY_COST_H_
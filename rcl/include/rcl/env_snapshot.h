@@ -0,0 +1,95 @@
+// Copyright 2022 Open Source Robotics Foundation, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/// @file
+
+#ifndef RCL__ENV_SNAPSHOT_H_
+#define RCL__ENV_SNAPSHOT_H_
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+#include "rcl/macros.h"
+#include "rcl/types.h"
+#include "rcl/visibility_control.h"
+
+/// Get the captured value of a ROS environment variable.
+/**
+ * The environment variables that configure context creation
+ * (`ROS_DOMAIN_ID`, `ROS_LOCALHOST_ONLY`, `ROS_AUTOMATIC_DISCOVERY_RANGE`
+ * and `ROS_STATIC_PEERS`) are read once into a process-wide snapshot the
+ * first time any of them is requested.
+ * Subsequent calls return the captured values without touching the
+ * environment, so concurrent context creation does not serialize on the
+ * C library's environment lock.
+ * Later changes to the environment are only observed after an explicit
+ * rcl_env_snapshot_refresh().
+ *
+ * The returned value is owned by the snapshot and valid until the next
+ * refresh.
+ * Variables that are not set in the environment yield an empty string.
+ *
+ * <hr>
+ * Attribute          | Adherence
+ * ------------------ | -------------
+ * Allocates Memory   | Yes [1]
+ * Thread-Safe        | No
+ * Uses Atomics       | No
+ * Lock-Free          | Yes
+ * <i>[1] Only allocates when the snapshot is first captured.</i>
+ *
+ * \param[in] env_var name of one of the snapshotted environment variables.
+ * \param[out] env_value set to the captured value, never `NULL` on success.
+ * \return #RCL_RET_OK if the value was retrieved, or
+ * \return #RCL_RET_INVALID_ARGUMENT if any arguments are invalid, or
+ * \return #RCL_RET_INVALID_ARGUMENT if env_var is not a snapshotted variable, or
+ * \return #RCL_RET_BAD_ALLOC if allocating memory failed, or
+ * \return #RCL_RET_ERROR if reading the environment failed.
+ */
+RCL_PUBLIC
+RCL_WARN_UNUSED
+rcl_ret_t
+rcl_env_snapshot_get_value(const char * env_var, const char ** env_value);
+
+/// Re-capture the process-wide environment snapshot.
+/**
+ * Re-reads every snapshotted environment variable, replacing the captured
+ * values.
+ * Pointers returned by earlier rcl_env_snapshot_get_value() calls are
+ * invalidated.
+ *
+ * <hr>
+ * Attribute          | Adherence
+ * ------------------ | -------------
+ * Allocates Memory   | Yes
+ * Thread-Safe        | No
+ * Uses Atomics       | No
+ * Lock-Free          | Yes
+ *
+ * \return #RCL_RET_OK if the snapshot was captured, or
+ * \return #RCL_RET_BAD_ALLOC if allocating memory failed, or
+ * \return #RCL_RET_ERROR if reading the environment failed.
+ */
+RCL_PUBLIC
+RCL_WARN_UNUSED
+rcl_ret_t
+rcl_env_snapshot_refresh(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif  // RCL__ENV_SNAPSHOT_H_
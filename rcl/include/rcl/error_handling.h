@@ -17,6 +17,8 @@
 
 #include "rcutils/error_handling.h"
 
+#include "rcl/macros.h"
+
 /// The error handling in RCL is just an alias to the error handling in rcutils.
 
 typedef rcutils_error_state_t rcl_error_state_t;
@@ -27,17 +29,39 @@ typedef rcutils_error_string_t rcl_error_string_t;
 
 #define rcl_set_error_state rcutils_set_error_state
 
+/// The null checks expand in nearly every function, many of them hot, so
+/// unlike the rcutils versions the failure branch carries an unlikely hint;
+/// setting the error message is already a bare call into rcutils, keeping
+/// the off-path code at each site to a test, a call and the return.
 #define RCL_CHECK_ARGUMENT_FOR_NULL(argument, error_return_type) \
-  RCUTILS_CHECK_ARGUMENT_FOR_NULL(argument, error_return_type)
+  RCL_CHECK_FOR_NULL_WITH_MSG( \
+    argument, #argument " argument is null", return error_return_type)
 
 #define RCL_CHECK_FOR_NULL_WITH_MSG(value, msg, error_statement) \
-  RCUTILS_CHECK_FOR_NULL_WITH_MSG(value, msg, error_statement)
+  do { \
+    if (RCL_UNLIKELY(NULL == (value))) { \
+      RCL_SET_ERROR_MSG(msg); \
+      error_statement; \
+    } \
+  } while (0)
 
 #define RCL_SET_ERROR_MSG(msg) RCUTILS_SET_ERROR_MSG(msg)
 
 #define RCL_SET_ERROR_MSG_WITH_FORMAT_STRING(fmt_str, ...) \
   RCUTILS_SET_ERROR_MSG_WITH_FORMAT_STRING(fmt_str, __VA_ARGS__)
 
+/// Return an expected-miss result code without touching the error state.
+/**
+ * Result codes like #RCL_RET_TIMEOUT, #RCL_RET_TIMER_CANCELED and the
+ * `*_TAKE_FAILED` family are part of the normal control flow of executors
+ * polling at high rates: callers dispatch on the code and never read the
+ * message, so copying one into thread-local storage on every miss is
+ * wasted work. Returning through this macro makes the convention
+ * greppable; functions using it document that no error message
+ * accompanies the code.
+ */
+#define RCL_RETURN_EXPECTED(code) return (code)
+
 #define rcl_error_is_set rcutils_error_is_set
 
 #define rcl_get_error_state rcutils_get_error_state
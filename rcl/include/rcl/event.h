@@ -136,6 +136,59 @@ rcl_take_event(
   const rcl_event_t * event,
   void * event_info);
 
+// Take several pending events using the event handle.
+/**
+ * Take up to `max_events` pending events from the event handle in one call,
+ * so executors can drain an event storm with a single pass instead of one
+ * rcl_take_event() round trip per event.
+ * Each entry of `event_info_buffer` must point to a caller-allocated status
+ * struct matching the event's type.
+ * Taking stops as soon as no further event is pending; `taken` reports how
+ * many entries were filled.
+ *
+ * \param[in] event event object to take from
+ * \param[in, out] event_info_buffer array of pointers to status structs to fill
+ * \param[in] max_events capacity of `event_info_buffer`, must be greater than 0
+ * \param[out] taken number of events actually taken
+ * \return #RCL_RET_OK if at least one event was taken, or
+ * \return #RCL_RET_INVALID_ARGUMENT if any arguments are invalid, or
+ * \return #RCL_RET_EVENT_TAKE_FAILED if no event was pending, or
+ * \return #RCL_RET_ERROR if an unexpected error occurs.
+ */
+RCL_PUBLIC
+RCL_WARN_UNUSED
+rcl_ret_t
+rcl_take_events(
+  const rcl_event_t * event,
+  void ** event_info_buffer,
+  size_t max_events,
+  size_t * taken);
+
+// Take all pending events coalesced into a single status record.
+/**
+ * Drain every pending event from the event handle and collapse them into one
+ * status record: the totals and current values of the most recent event are
+ * kept, while the interval counters (the `*_count_change` fields) are summed
+ * across all drained events, so no change is lost.
+ * This keeps the executor at one wakeup and one record per ready event
+ * object, no matter how many events a network flap queued up.
+ *
+ * \param[in] event event object to take from
+ * \param[in, out] event_info status struct of the event's type to fill
+ * \param[out] coalesced_count number of events collapsed into the record
+ * \return #RCL_RET_OK if at least one event was taken, or
+ * \return #RCL_RET_INVALID_ARGUMENT if any arguments are invalid, or
+ * \return #RCL_RET_EVENT_TAKE_FAILED if no event was pending, or
+ * \return #RCL_RET_ERROR if an unexpected error occurs.
+ */
+RCL_PUBLIC
+RCL_WARN_UNUSED
+rcl_ret_t
+rcl_take_event_coalesced(
+  const rcl_event_t * event,
+  void * event_info,
+  size_t * coalesced_count);
+
 // Finalize an event.
 /**
  * Finalize an event.
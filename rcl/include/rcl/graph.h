@@ -33,6 +33,7 @@ extern "C"
 
 #include "rcl/macros.h"
 #include "rcl/client.h"
+#include "rcl/intern_pool.h"
 #include "rcl/node.h"
 #include "rcl/visibility_control.h"
 
@@ -162,6 +163,105 @@ rcl_get_subscriber_names_and_types_by_node(
   const char * node_namespace,
   rcl_names_and_types_t * topic_names_and_types);
 
+/// Return the merged publisher topic names and types for a list of nodes.
+/**
+ * Batched fan-out over rcl_get_publisher_names_and_types_by_node(): the
+ * per-node results are queried in one pass and merged into a single
+ * deduplicated set, so introspection tooling dumping the whole fleet pays
+ * one merge instead of diffing per-node results in application code.
+ * A topic published by several nodes appears once, with the union of the
+ * types seen across those nodes.
+ *
+ * `node_names` and `node_namespaces` are parallel arrays of
+ * `number_of_nodes` entries; an empty namespace string is treated as "/",
+ * like in the per-node query.
+ * If any node fails to resolve, the whole call fails with that node's error
+ * and no result is returned.
+ *
+ * The `topic_names_and_types` parameter must be allocated and zero
+ * initialized, and must be passed to rcl_names_and_types_fini() by the
+ * caller when it is no longer needed.
+ *
+ * <hr>
+ * Attribute          | Adherence
+ * ------------------ | -------------
+ * Allocates Memory   | Yes
+ * Thread-Safe        | No
+ * Uses Atomics       | No
+ * Lock-Free          | Maybe [1]
+ * <i>[1] implementation may need to protect the data structure with a lock</i>
+ *
+ * \param[in] node the handle to the node being used to query the ROS graph
+ * \param[in] allocator allocator to be used when allocating space for strings
+ * \param[in] no_demangle if true, list all topics without any demangling
+ * \param[in] node_names the node names of the topics to return
+ * \param[in] node_namespaces the node namespaces of the topics to return
+ * \param[in] number_of_nodes length of the node name and namespace arrays
+ * \param[out] topic_names_and_types merged list of topic names and types
+ * \return #RCL_RET_OK if the query was successful, or
+ * \return #RCL_RET_NODE_INVALID if the node is invalid, or
+ * \return #RCL_RET_INVALID_ARGUMENT if any arguments are invalid, or
+ * \return #RCL_RET_NODE_INVALID_NAME if a node name is invalid, or
+ * \return #RCL_RET_NODE_INVALID_NAMESPACE if a node namespace is invalid, or
+ * \return #RCL_RET_NODE_NAME_NON_EXISTENT if a node name wasn't found, or
+ * \return #RCL_RET_BAD_ALLOC if allocating memory failed, or
+ * \return #RCL_RET_ERROR if an unspecified error occurs.
+ */
+RCL_PUBLIC
+RCL_WARN_UNUSED
+rcl_ret_t
+rcl_get_publisher_names_and_types_for_nodes(
+  const rcl_node_t * node,
+  rcl_allocator_t * allocator,
+  bool no_demangle,
+  const char ** node_names,
+  const char ** node_namespaces,
+  size_t number_of_nodes,
+  rcl_names_and_types_t * topic_names_and_types);
+
+/// Return the merged subscription topic names and types for a list of nodes.
+/**
+ * The subscription counterpart of
+ * rcl_get_publisher_names_and_types_for_nodes(); see it for the merge
+ * semantics, argument requirements, and return values.
+ *
+ * <hr>
+ * Attribute          | Adherence
+ * ------------------ | -------------
+ * Allocates Memory   | Yes
+ * Thread-Safe        | No
+ * Uses Atomics       | No
+ * Lock-Free          | Maybe [1]
+ * <i>[1] implementation may need to protect the data structure with a lock</i>
+ *
+ * \param[in] node the handle to the node being used to query the ROS graph
+ * \param[in] allocator allocator to be used when allocating space for strings
+ * \param[in] no_demangle if true, list all topics without any demangling
+ * \param[in] node_names the node names of the topics to return
+ * \param[in] node_namespaces the node namespaces of the topics to return
+ * \param[in] number_of_nodes length of the node name and namespace arrays
+ * \param[out] topic_names_and_types merged list of topic names and types
+ * \return #RCL_RET_OK if the query was successful, or
+ * \return #RCL_RET_NODE_INVALID if the node is invalid, or
+ * \return #RCL_RET_INVALID_ARGUMENT if any arguments are invalid, or
+ * \return #RCL_RET_NODE_INVALID_NAME if a node name is invalid, or
+ * \return #RCL_RET_NODE_INVALID_NAMESPACE if a node namespace is invalid, or
+ * \return #RCL_RET_NODE_NAME_NON_EXISTENT if a node name wasn't found, or
+ * \return #RCL_RET_BAD_ALLOC if allocating memory failed, or
+ * \return #RCL_RET_ERROR if an unspecified error occurs.
+ */
+RCL_PUBLIC
+RCL_WARN_UNUSED
+rcl_ret_t
+rcl_get_subscriber_names_and_types_for_nodes(
+  const rcl_node_t * node,
+  rcl_allocator_t * allocator,
+  bool no_demangle,
+  const char ** node_names,
+  const char ** node_namespaces,
+  size_t number_of_nodes,
+  rcl_names_and_types_t * topic_names_and_types);
+
 /// Return a list of service names and types associated with a node.
 /**
  * The `node` parameter must point to a valid node.
@@ -401,6 +501,163 @@ RCL_WARN_UNUSED
 rcl_ret_t
 rcl_names_and_types_fini(rcl_names_and_types_t * names_and_types);
 
+/// A names and types set packed into one contiguous string buffer.
+/**
+ * Unlike rcl_names_and_types_t, where every name and type string is an
+ * individual allocation, all strings live NUL separated in `buffer` and are
+ * addressed through offset arrays, so a set of any size costs four
+ * allocations and iterating it walks memory linearly.
+ * Use the rcl_packed_names_and_types_get_*() accessors to read it.
+ */
+typedef struct rcl_packed_names_and_types_s
+{
+  /// All strings, NUL separated, names and types interleaved per topic.
+  char * buffer;
+  /// Length of buffer in bytes.
+  size_t buffer_length;
+  /// Offset into buffer of each topic name; `size` entries.
+  size_t * name_offsets;
+  /// Topic i's type offsets span [type_starts[i], type_starts[i + 1]);
+  /// `size + 1` entries.
+  size_t * type_starts;
+  /// Offsets into buffer of the flattened type strings.
+  size_t * type_offsets;
+  /// Number of topics.
+  size_t size;
+  /// Allocator used to allocate the buffer and offset arrays.
+  rcl_allocator_t allocator;
+} rcl_packed_names_and_types_t;
+
+/// Return a rcl_packed_names_and_types_t with members initialized to zero.
+RCL_PUBLIC
+RCL_WARN_UNUSED
+rcl_packed_names_and_types_t
+rcl_get_zero_initialized_packed_names_and_types(void);
+
+/// Pack a names and types set into contiguous storage.
+/**
+ * Copies every string of `source` into one buffer and builds the offset
+ * arrays; `source` is not modified and may be finalized afterwards.
+ * `packed` must be zero initialized and, on success, must be finalized with
+ * rcl_packed_names_and_types_fini() by the caller.
+ *
+ * <hr>
+ * Attribute          | Adherence
+ * ------------------ | -------------
+ * Allocates Memory   | Yes
+ * Thread-Safe        | No
+ * Uses Atomics       | No
+ * Lock-Free          | Yes
+ *
+ * \param[in] source the conventionally allocated set to be packed
+ * \param[in] allocator the allocator for the buffer and offset arrays
+ * \param[out] packed the packed representation
+ * \return #RCL_RET_OK if the set was packed successfully, or
+ * \return #RCL_RET_INVALID_ARGUMENT if any arguments are invalid, or
+ * \return #RCL_RET_BAD_ALLOC if allocating memory failed.
+ */
+RCL_PUBLIC
+RCL_WARN_UNUSED
+rcl_ret_t
+rcl_pack_names_and_types(
+  const rcl_names_and_types_t * source,
+  rcl_allocator_t * allocator,
+  rcl_packed_names_and_types_t * packed);
+
+/// Return a list of topic names and types, packed into contiguous storage.
+/**
+ * Queries like rcl_get_topic_names_and_types() and repacks the result into
+ * a rcl_packed_names_and_types_t before returning, so callers that iterate
+ * the set frequently get linear storage without holding the conventional
+ * representation.
+ *
+ * `topic_names_and_types` must be zero initialized and, on success, must be
+ * finalized with rcl_packed_names_and_types_fini() by the caller.
+ *
+ * <hr>
+ * Attribute          | Adherence
+ * ------------------ | -------------
+ * Allocates Memory   | Yes
+ * Thread-Safe        | No
+ * Uses Atomics       | No
+ * Lock-Free          | Maybe [1]
+ * <i>[1] implementation may need to protect the data structure with a lock</i>
+ *
+ * \param[in] node the handle to the node being used to query the ROS graph
+ * \param[in] allocator allocator to be used for the packed storage
+ * \param[in] no_demangle if true, list all topics without any demangling
+ * \param[out] topic_names_and_types packed list of topic names and types
+ * \return #RCL_RET_OK if the query was successful, or
+ * \return #RCL_RET_NODE_INVALID if the node is invalid, or
+ * \return #RCL_RET_INVALID_ARGUMENT if any arguments are invalid, or
+ * \return #RCL_RET_BAD_ALLOC if allocating memory failed, or
+ * \return #RCL_RET_ERROR if an unspecified error occurs.
+ */
+RCL_PUBLIC
+RCL_WARN_UNUSED
+rcl_ret_t
+rcl_get_topic_names_and_types_packed(
+  const rcl_node_t * node,
+  rcl_allocator_t * allocator,
+  bool no_demangle,
+  rcl_packed_names_and_types_t * topic_names_and_types);
+
+/// Get the name of topic `index` in a packed set.
+/**
+ * \param[in] packed the packed set to be read
+ * \param[in] index index of the topic
+ * \return the topic name, or `NULL` if the arguments are invalid.
+ */
+RCL_PUBLIC
+RCL_WARN_UNUSED
+const char *
+rcl_packed_names_and_types_get_name(
+  const rcl_packed_names_and_types_t * packed, size_t index);
+
+/// Get the number of types of topic `index` in a packed set.
+/**
+ * \param[in] packed the packed set to be read
+ * \param[in] index index of the topic
+ * \return the number of types, or `0` if the arguments are invalid.
+ */
+RCL_PUBLIC
+RCL_WARN_UNUSED
+size_t
+rcl_packed_names_and_types_get_type_count(
+  const rcl_packed_names_and_types_t * packed, size_t index);
+
+/// Get type `type_index` of topic `index` in a packed set.
+/**
+ * \param[in] packed the packed set to be read
+ * \param[in] index index of the topic
+ * \param[in] type_index index of the type within the topic
+ * \return the type name, or `NULL` if the arguments are invalid.
+ */
+RCL_PUBLIC
+RCL_WARN_UNUSED
+const char *
+rcl_packed_names_and_types_get_type(
+  const rcl_packed_names_and_types_t * packed, size_t index, size_t type_index);
+
+/// Finalize a packed names and types set.
+/**
+ * <hr>
+ * Attribute          | Adherence
+ * ------------------ | -------------
+ * Allocates Memory   | No
+ * Thread-Safe        | No
+ * Uses Atomics       | No
+ * Lock-Free          | Yes
+ *
+ * \param[inout] packed the packed set to be finalized
+ * \return #RCL_RET_OK if the set was finalized successfully, or
+ * \return #RCL_RET_INVALID_ARGUMENT if any arguments are invalid.
+ */
+RCL_PUBLIC
+RCL_WARN_UNUSED
+rcl_ret_t
+rcl_packed_names_and_types_fini(rcl_packed_names_and_types_t * packed);
+
 /// Return a list of available nodes in the ROS graph.
 /**
  * The `node` parameter must point to a valid node.
@@ -492,6 +749,103 @@ rcl_get_node_names_with_enclaves(
   rcutils_string_array_t * node_namespaces,
   rcutils_string_array_t * enclaves);
 
+/// A reusable node names query result that retains capacity across calls.
+/**
+ * The conventional usage pattern around rcl_get_node_names() is
+ * init-query-fini in a tight loop, freeing and reallocating identical-sized
+ * arrays every time.
+ * This result object keeps its pointer arrays between queries and grows them
+ * only when the graph outgrows the retained capacity; the strings themselves
+ * are canonical pointers owned by an interning pool, so a steady-state
+ * polling loop performs no allocations in the result object at all.
+ *
+ * `names[i]` and `namespaces[i]` describe node `i`; both arrays have `size`
+ * valid entries.
+ * The pointers stay valid until the interning pool is finalized, even across
+ * further queries and rcl_node_names_result_fini().
+ */
+typedef struct rcl_node_names_result_s
+{
+  /// Interned node names; `size` valid entries.
+  const char ** names;
+  /// Interned node namespaces; `size` valid entries.
+  const char ** namespaces;
+  /// Number of nodes in the last query.
+  size_t size;
+  /// Allocated length of both arrays; at least `size`.
+  size_t capacity;
+  /// Allocator used for the arrays, recorded on first growth.
+  rcl_allocator_t allocator;
+} rcl_node_names_result_t;
+
+/// Return a rcl_node_names_result_t with members initialized to zero.
+RCL_PUBLIC
+RCL_WARN_UNUSED
+rcl_node_names_result_t
+rcl_get_zero_initialized_node_names_result(void);
+
+/// Query the node names in the graph into a reusable result.
+/**
+ * Like rcl_get_node_names(), but the result object retains its capacity
+ * across calls and every string is interned into `pool`, so repeated
+ * queries allocate only when the graph grows past the retained capacity or
+ * a string is seen for the first time.
+ *
+ * `result` must be zero initialized before its first use and may then be
+ * passed again unchanged; it must be finalized with
+ * rcl_node_names_result_fini() when no longer needed.
+ * The same allocator must be used for all queries into one result.
+ *
+ * <hr>
+ * Attribute          | Adherence
+ * ------------------ | -------------
+ * Allocates Memory   | Yes [1]
+ * Thread-Safe        | No
+ * Uses Atomics       | No
+ * Lock-Free          | Maybe [2]
+ * <i>[1] not in steady state; see above</i>
+ * <i>[2] implementation may need to protect the data structure with a lock</i>
+ *
+ * \param[in] node the handle to the node being used to query the ROS graph
+ * \param[inout] pool the interning pool that owns the strings
+ * \param[in] allocator allocator used for the retained arrays
+ * \param[inout] result the reusable result to fill
+ * \return #RCL_RET_OK if the query was successful, or
+ * \return #RCL_RET_NODE_INVALID if the node is invalid, or
+ * \return #RCL_RET_INVALID_ARGUMENT if any arguments are invalid, or
+ * \return #RCL_RET_BAD_ALLOC if allocating memory failed, or
+ * \return #RCL_RET_ERROR if an unspecified error occurs.
+ */
+RCL_PUBLIC
+RCL_WARN_UNUSED
+rcl_ret_t
+rcl_get_node_names_reuse(
+  const rcl_node_t * node,
+  rcl_intern_pool_t * pool,
+  rcl_allocator_t * allocator,
+  rcl_node_names_result_t * result);
+
+/// Finalize a reusable node names result, releasing the retained arrays.
+/**
+ * The interned strings are owned by the pool and stay valid.
+ *
+ * <hr>
+ * Attribute          | Adherence
+ * ------------------ | -------------
+ * Allocates Memory   | No
+ * Thread-Safe        | No
+ * Uses Atomics       | No
+ * Lock-Free          | Yes
+ *
+ * \param[inout] result the result to be finalized
+ * \return #RCL_RET_OK if the result was finalized successfully, or
+ * \return #RCL_RET_INVALID_ARGUMENT if any arguments are invalid.
+ */
+RCL_PUBLIC
+RCL_WARN_UNUSED
+rcl_ret_t
+rcl_node_names_result_fini(rcl_node_names_result_t * result);
+
 /// Return the number of publishers on a given topic.
 /**
  * The `node` parameter must point to a valid node.
@@ -582,27 +936,33 @@ rcl_count_subscribers(
   const char * topic_name,
   size_t * count);
 
-/// Wait for there to be a specified number of publishers on a given topic.
+typedef struct rcl_count_cache_impl_s rcl_count_cache_impl_t;
+
+/// A generation tagged cache over the per-topic endpoint counts.
 /**
- * The `node` parameter must point to a valid node.
- * The nodes graph guard condition is used by this function, and therefore the caller should
- * take care not to use the guard condition concurrently in any other wait sets.
- *
- * The `allocator` parameter must point to a valid allocator.
- *
- * The `topic_name` parameter must not be `NULL`, and must not be an empty string.
- * It should also follow the topic name rules.
- *
- * This function blocks and will return when the number of publishers for `topic_name`
- * is greater than or equal to the `count` parameter, or the specified `timeout` is reached.
- *
- * The `timeout` parameter is in nanoseconds.
- * The timeout is based on system time elapsed.
- * A negative value disables the timeout (i.e. this function blocks until the number of
- * publishers is greater than or equals to `count`).
- *
- * The `success` parameter must point to a valid bool.
- * The `success` parameter is the output for this function and will be set.
+ * Callers that poll rcl_count_publishers() or rcl_count_subscribers() far
+ * more often than the graph actually changes pay an rmw query per call.
+ * The cache polls the node's graph guard condition with a zero timeout and
+ * bumps a generation counter when it fired; a count whose generation tag is
+ * current is served from memory, so repeated counts between graph events
+ * cost a hash lookup instead of an rmw round-trip.
+ */
+typedef struct rcl_count_cache_s
+{
+  /// Private implementation pointer.
+  rcl_count_cache_impl_t * impl;
+} rcl_count_cache_t;
+
+/// Return a rcl_count_cache_t struct with members initialized to `NULL`.
+RCL_PUBLIC
+RCL_WARN_UNUSED
+rcl_count_cache_t
+rcl_get_zero_initialized_count_cache(void);
+
+/// Initialize a count cache for a node.
+/**
+ * The node must stay valid for the lifetime of the cache, and the node's
+ * graph guard condition should not be used in other wait sets concurrently.
  *
  * <hr>
  * Attribute          | Adherence
@@ -610,75 +970,205 @@ rcl_count_subscribers(
  * Allocates Memory   | Yes
  * Thread-Safe        | No
  * Uses Atomics       | No
- * Lock-Free          | Maybe [1]
- * <i>[1] implementation may need to protect the data structure with a lock</i>
+ * Lock-Free          | Yes
  *
- * \param[in] node the handle to the node being used to query the ROS graph
- * \param[in] allocator to allocate space for the rcl_wait_set_t used to wait for graph events
- * \param[in] topic_name the name of the topic in question
- * \param[in] count number of publishers to wait for
- * \param[in] timeout maximum duration to wait for publishers
- * \param[out] success `true` if the number of publishers is equal to or greater than count, or
- *   `false` if a timeout occurred waiting for publishers.
- * \return #RCL_RET_OK if there was no errors, or
+ * \param[inout] cache a zero initialized count cache to be initialized
+ * \param[in] node a valid node whose graph the counts are taken from
+ * \param[in] allocator the allocator for the cache storage
+ * \return #RCL_RET_OK if the cache was initialized successfully, or
+ * \return #RCL_RET_ALREADY_INIT if the cache is already initialized, or
  * \return #RCL_RET_NODE_INVALID if the node is invalid, or
  * \return #RCL_RET_INVALID_ARGUMENT if any arguments are invalid, or
- * \return #RCL_RET_TIMEOUT if a timeout occurs before the number of publishers is detected, or
- * \return #RCL_RET_ERROR if an unspecified error occurred.
+ * \return #RCL_RET_BAD_ALLOC if allocating memory failed, or
+ * \return #RCL_RET_ERROR if an unspecified error occurs.
  */
 RCL_PUBLIC
 RCL_WARN_UNUSED
 rcl_ret_t
-rcl_wait_for_publishers(
+rcl_count_cache_init(
+  rcl_count_cache_t * cache,
   const rcl_node_t * node,
-  rcl_allocator_t * allocator,
-  const char * topic_name,
-  const size_t count,
-  rcutils_duration_value_t timeout,
-  bool * success);
+  rcl_allocator_t * allocator);
 
-/// Wait for there to be a specified number of subscribers on a given topic.
+/// Finalize a count cache.
 /**
- * \see rcl_wait_for_publishers
- *
  * <hr>
  * Attribute          | Adherence
  * ------------------ | -------------
- * Allocates Memory   | Yes
+ * Allocates Memory   | No
  * Thread-Safe        | No
  * Uses Atomics       | No
- * Lock-Free          | Maybe [1]
- * <i>[1] implementation may need to protect the data structure with a lock</i>
+ * Lock-Free          | Yes
  *
- * \param[in] node the handle to the node being used to query the ROS graph
- * \param[in] allocator to allocate space for the rcl_wait_set_t used to wait for graph events
- * \param[in] topic_name the name of the topic in question
- * \param[in] count number of subscribers to wait for
- * \param[in] timeout maximum duration to wait for subscribers
- * \param[out] success `true` if the number of subscribers is equal to or greater than count, or
- *   `false` if a timeout occurred waiting for subscribers.
- * \return #RCL_RET_OK if there was no errors, or
- * \return #RCL_RET_NODE_INVALID if the node is invalid, or
+ * \param[inout] cache the cache to be finalized
+ * \return #RCL_RET_OK if the cache was finalized successfully, or
  * \return #RCL_RET_INVALID_ARGUMENT if any arguments are invalid, or
- * \return #RCL_RET_TIMEOUT if a timeout occurs before the number of subscribers is detected, or
- * \return #RCL_RET_ERROR if an unspecified error occurred.
+ * \return #RCL_RET_ERROR if an unspecified error occurs.
  */
 RCL_PUBLIC
 RCL_WARN_UNUSED
 rcl_ret_t
-rcl_wait_for_subscribers(
-  const rcl_node_t * node,
-  rcl_allocator_t * allocator,
-  const char * topic_name,
-  const size_t count,
-  rcutils_duration_value_t timeout,
-  bool * success);
+rcl_count_cache_fini(rcl_count_cache_t * cache);
 
-/// Return a list of all publishers to a topic.
+/// Count the publishers on a topic, served from the cache when it is fresh.
 /**
- * The `node` parameter must point to a valid node.
- *
- * The `topic_name` parameter must not be `NULL`.
+ * Like rcl_count_publishers(), but the rmw layer is only queried when the
+ * topic's count has not been taken since the last graph change.
+ *
+ * <hr>
+ * Attribute          | Adherence
+ * ------------------ | -------------
+ * Allocates Memory   | Yes [1]
+ * Thread-Safe        | No
+ * Uses Atomics       | No
+ * Lock-Free          | Yes
+ * <i>[1] only the first time a given topic is counted</i>
+ *
+ * \param[inout] cache the count cache to be queried
+ * \param[in] topic_name the fully qualified name of the topic in question
+ * \param[out] count number of publishers on the given topic
+ * \return #RCL_RET_OK if the query was successful, or
+ * \return #RCL_RET_NODE_INVALID if the node is invalid, or
+ * \return #RCL_RET_INVALID_ARGUMENT if any arguments are invalid, or
+ * \return #RCL_RET_BAD_ALLOC if allocating memory failed, or
+ * \return #RCL_RET_ERROR if an unspecified error occurs.
+ */
+RCL_PUBLIC
+RCL_WARN_UNUSED
+rcl_ret_t
+rcl_count_cache_count_publishers(
+  rcl_count_cache_t * cache,
+  const char * topic_name,
+  size_t * count);
+
+/// Count the subscriptions on a topic, served from the cache when it is fresh.
+/**
+ * The subscription counterpart of rcl_count_cache_count_publishers(); see it
+ * for the caching behavior and return values.
+ *
+ * <hr>
+ * Attribute          | Adherence
+ * ------------------ | -------------
+ * Allocates Memory   | Yes [1]
+ * Thread-Safe        | No
+ * Uses Atomics       | No
+ * Lock-Free          | Yes
+ * <i>[1] only the first time a given topic is counted</i>
+ *
+ * \param[inout] cache the count cache to be queried
+ * \param[in] topic_name the fully qualified name of the topic in question
+ * \param[out] count number of subscriptions on the given topic
+ * \return #RCL_RET_OK if the query was successful, or
+ * \return #RCL_RET_NODE_INVALID if the node is invalid, or
+ * \return #RCL_RET_INVALID_ARGUMENT if any arguments are invalid, or
+ * \return #RCL_RET_BAD_ALLOC if allocating memory failed, or
+ * \return #RCL_RET_ERROR if an unspecified error occurs.
+ */
+RCL_PUBLIC
+RCL_WARN_UNUSED
+rcl_ret_t
+rcl_count_cache_count_subscribers(
+  rcl_count_cache_t * cache,
+  const char * topic_name,
+  size_t * count);
+
+/// Wait for there to be a specified number of publishers on a given topic.
+/**
+ * The `node` parameter must point to a valid node.
+ * The nodes graph guard condition is used by this function, and therefore the caller should
+ * take care not to use the guard condition concurrently in any other wait sets.
+ *
+ * The `allocator` parameter must point to a valid allocator.
+ *
+ * The `topic_name` parameter must not be `NULL`, and must not be an empty string.
+ * It should also follow the topic name rules.
+ *
+ * This function blocks and will return when the number of publishers for `topic_name`
+ * is greater than or equal to the `count` parameter, or the specified `timeout` is reached.
+ *
+ * The `timeout` parameter is in nanoseconds.
+ * The timeout is based on system time elapsed.
+ * A negative value disables the timeout (i.e. this function blocks until the number of
+ * publishers is greater than or equals to `count`).
+ *
+ * The `success` parameter must point to a valid bool.
+ * The `success` parameter is the output for this function and will be set.
+ *
+ * <hr>
+ * Attribute          | Adherence
+ * ------------------ | -------------
+ * Allocates Memory   | Yes
+ * Thread-Safe        | No
+ * Uses Atomics       | No
+ * Lock-Free          | Maybe [1]
+ * <i>[1] implementation may need to protect the data structure with a lock</i>
+ *
+ * \param[in] node the handle to the node being used to query the ROS graph
+ * \param[in] allocator to allocate space for the rcl_wait_set_t used to wait for graph events
+ * \param[in] topic_name the name of the topic in question
+ * \param[in] count number of publishers to wait for
+ * \param[in] timeout maximum duration to wait for publishers
+ * \param[out] success `true` if the number of publishers is equal to or greater than count, or
+ *   `false` if a timeout occurred waiting for publishers.
+ * \return #RCL_RET_OK if there was no errors, or
+ * \return #RCL_RET_NODE_INVALID if the node is invalid, or
+ * \return #RCL_RET_INVALID_ARGUMENT if any arguments are invalid, or
+ * \return #RCL_RET_TIMEOUT if a timeout occurs before the number of publishers is detected, or
+ * \return #RCL_RET_ERROR if an unspecified error occurred.
+ */
+RCL_PUBLIC
+RCL_WARN_UNUSED
+rcl_ret_t
+rcl_wait_for_publishers(
+  const rcl_node_t * node,
+  rcl_allocator_t * allocator,
+  const char * topic_name,
+  const size_t count,
+  rcutils_duration_value_t timeout,
+  bool * success);
+
+/// Wait for there to be a specified number of subscribers on a given topic.
+/**
+ * \see rcl_wait_for_publishers
+ *
+ * <hr>
+ * Attribute          | Adherence
+ * ------------------ | -------------
+ * Allocates Memory   | Yes
+ * Thread-Safe        | No
+ * Uses Atomics       | No
+ * Lock-Free          | Maybe [1]
+ * <i>[1] implementation may need to protect the data structure with a lock</i>
+ *
+ * \param[in] node the handle to the node being used to query the ROS graph
+ * \param[in] allocator to allocate space for the rcl_wait_set_t used to wait for graph events
+ * \param[in] topic_name the name of the topic in question
+ * \param[in] count number of subscribers to wait for
+ * \param[in] timeout maximum duration to wait for subscribers
+ * \param[out] success `true` if the number of subscribers is equal to or greater than count, or
+ *   `false` if a timeout occurred waiting for subscribers.
+ * \return #RCL_RET_OK if there was no errors, or
+ * \return #RCL_RET_NODE_INVALID if the node is invalid, or
+ * \return #RCL_RET_INVALID_ARGUMENT if any arguments are invalid, or
+ * \return #RCL_RET_TIMEOUT if a timeout occurs before the number of subscribers is detected, or
+ * \return #RCL_RET_ERROR if an unspecified error occurred.
+ */
+RCL_PUBLIC
+RCL_WARN_UNUSED
+rcl_ret_t
+rcl_wait_for_subscribers(
+  const rcl_node_t * node,
+  rcl_allocator_t * allocator,
+  const char * topic_name,
+  const size_t count,
+  rcutils_duration_value_t timeout,
+  bool * success);
+
+/// Return a list of all publishers to a topic.
+/**
+ * The `node` parameter must point to a valid node.
+ *
+ * The `topic_name` parameter must not be `NULL`.
  *
  * When the `no_mangle` parameter is `true`, the provided `topic_name` should be a valid topic name
  * for the middleware (useful when combining ROS with native middleware (e.g. DDS) apps).
@@ -839,6 +1329,599 @@ rcl_service_server_is_available(
   const rcl_client_t * client,
   bool * is_available);
 
+typedef struct rcl_client_availability_cache_impl_s rcl_client_availability_cache_impl_t;
+
+/// A cached server availability state for one service client.
+/**
+ * Clients that poll rcl_service_server_is_available() before every request
+ * burst pay an rmw graph query per call.
+ * The cache remembers the last answer: while it is "available", queries are
+ * an atomic flag read; while it is "unavailable", the node's graph guard
+ * condition is polled with a zero timeout and the rmw layer is only asked
+ * again after a graph event.
+ *
+ * A cached "available" can go stale if the server vanishes; request
+ * pipelines discover that through the failed request itself, and can force
+ * the next query to hit the rmw layer with
+ * rcl_client_availability_cache_invalidate().
+ */
+typedef struct rcl_client_availability_cache_s
+{
+  /// Private implementation pointer.
+  rcl_client_availability_cache_impl_t * impl;
+} rcl_client_availability_cache_t;
+
+/// Return a rcl_client_availability_cache_t with members initialized to `NULL`.
+RCL_PUBLIC
+RCL_WARN_UNUSED
+rcl_client_availability_cache_t
+rcl_get_zero_initialized_client_availability_cache(void);
+
+/// Initialize an availability cache for a client.
+/**
+ * The node and client must stay valid for the lifetime of the cache, the
+ * client must have been created from the node, and the node's graph guard
+ * condition should not be used in other wait sets concurrently.
+ *
+ * <hr>
+ * Attribute          | Adherence
+ * ------------------ | -------------
+ * Allocates Memory   | Yes
+ * Thread-Safe        | No
+ * Uses Atomics       | No
+ * Lock-Free          | Yes
+ *
+ * \param[inout] cache a zero initialized cache to be initialized
+ * \param[in] node the node the client was created from
+ * \param[in] client the client whose server availability is cached
+ * \param[in] allocator the allocator for the cache storage
+ * \return #RCL_RET_OK if the cache was initialized successfully, or
+ * \return #RCL_RET_ALREADY_INIT if the cache is already initialized, or
+ * \return #RCL_RET_NODE_INVALID if the node is invalid, or
+ * \return #RCL_RET_INVALID_ARGUMENT if any arguments are invalid, or
+ * \return #RCL_RET_BAD_ALLOC if allocating memory failed, or
+ * \return #RCL_RET_ERROR if an unspecified error occurs.
+ */
+RCL_PUBLIC
+RCL_WARN_UNUSED
+rcl_ret_t
+rcl_client_availability_cache_init(
+  rcl_client_availability_cache_t * cache,
+  const rcl_node_t * node,
+  const rcl_client_t * client,
+  rcl_allocator_t * allocator);
+
+/// Finalize a client availability cache.
+/**
+ * <hr>
+ * Attribute          | Adherence
+ * ------------------ | -------------
+ * Allocates Memory   | No
+ * Thread-Safe        | No
+ * Uses Atomics       | No
+ * Lock-Free          | Yes
+ *
+ * \param[inout] cache the cache to be finalized
+ * \return #RCL_RET_OK if the cache was finalized successfully, or
+ * \return #RCL_RET_INVALID_ARGUMENT if any arguments are invalid, or
+ * \return #RCL_RET_ERROR if an unspecified error occurs.
+ */
+RCL_PUBLIC
+RCL_WARN_UNUSED
+rcl_ret_t
+rcl_client_availability_cache_fini(rcl_client_availability_cache_t * cache);
+
+/// Check server availability through the cache.
+/**
+ * Like rcl_service_server_is_available(), but once a server has been seen
+ * the answer is served from an atomic flag; while no server has been seen,
+ * the rmw layer is only re-queried after the graph guard condition fired.
+ *
+ * <hr>
+ * Attribute          | Adherence
+ * ------------------ | -------------
+ * Allocates Memory   | Yes [1]
+ * Thread-Safe        | No
+ * Uses Atomics       | Yes
+ * Lock-Free          | Yes
+ * <i>[1] only when the rmw layer has to be re-queried</i>
+ *
+ * \param[inout] cache the cache to be queried
+ * \param[out] is_available set to true if there is a service server available, else false
+ * \return #RCL_RET_OK if the check was made successfully, or
+ * \return #RCL_RET_NODE_INVALID if the node is invalid, or
+ * \return #RCL_RET_INVALID_ARGUMENT if any arguments are invalid, or
+ * \return #RCL_RET_ERROR if an unspecified error occurs.
+ */
+RCL_PUBLIC
+RCL_WARN_UNUSED
+rcl_ret_t
+rcl_client_availability_cache_is_available(
+  rcl_client_availability_cache_t * cache,
+  bool * is_available);
+
+/// Drop the cached state, forcing the next query to hit the rmw layer.
+/**
+ * Call after a request failed unexpectedly, so a vanished server is
+ * noticed without waiting for a graph event.
+ *
+ * <hr>
+ * Attribute          | Adherence
+ * ------------------ | -------------
+ * Allocates Memory   | No
+ * Thread-Safe        | No
+ * Uses Atomics       | Yes
+ * Lock-Free          | Yes
+ *
+ * \param[inout] cache the cache to be invalidated
+ * \return #RCL_RET_OK if the cache was invalidated successfully, or
+ * \return #RCL_RET_INVALID_ARGUMENT if any arguments are invalid.
+ */
+RCL_PUBLIC
+RCL_WARN_UNUSED
+rcl_ret_t
+rcl_client_availability_cache_invalidate(rcl_client_availability_cache_t * cache);
+
+typedef struct rcl_graph_cache_impl_s rcl_graph_cache_impl_t;
+
+/// A cached, versioned view of the topic graph for one node.
+typedef struct rcl_graph_cache_s
+{
+  /// Private implementation pointer.
+  rcl_graph_cache_impl_t * impl;
+} rcl_graph_cache_t;
+
+/// Return a rcl_graph_cache_t struct with members initialized to `NULL`.
+RCL_PUBLIC
+RCL_WARN_UNUSED
+rcl_graph_cache_t
+rcl_get_zero_initialized_graph_cache(void);
+
+/// Initialize a graph cache for a node.
+/**
+ * A graph cache serves repeated rcl_get_topic_names_and_types() style
+ * queries from a cached snapshot that is only refreshed through the rmw
+ * layer when the node's graph guard condition reports a graph change, so
+ * periodic pollers stop paying an rmw round-trip and a full set of string
+ * allocations per query when the graph is quiescent.
+ *
+ * The node must remain valid for the lifetime of the cache.
+ *
+ * <hr>
+ * Attribute          | Adherence
+ * ------------------ | -------------
+ * Allocates Memory   | Yes
+ * Thread-Safe        | No
+ * Uses Atomics       | No
+ * Lock-Free          | Yes
+ *
+ * \param[inout] cache a zero initialized graph cache to be initialized
+ * \param[in] node the handle to the node whose graph is cached
+ * \param[in] no_demangle if true topic names are not demangled in snapshots
+ * \param[in] allocator the allocator used for snapshots and internal state
+ * \return #RCL_RET_OK if the graph cache was initialized successfully, or
+ * \return #RCL_RET_ALREADY_INIT if the graph cache is already initialized, or
+ * \return #RCL_RET_NODE_INVALID if the node is invalid, or
+ * \return #RCL_RET_INVALID_ARGUMENT if any arguments are invalid, or
+ * \return #RCL_RET_BAD_ALLOC if allocating memory failed, or
+ * \return #RCL_RET_ERROR if an unspecified error occurs.
+ */
+RCL_PUBLIC
+RCL_WARN_UNUSED
+rcl_ret_t
+rcl_graph_cache_init(
+  rcl_graph_cache_t * cache,
+  const rcl_node_t * node,
+  bool no_demangle,
+  rcl_allocator_t * allocator);
+
+/// Finalize a graph cache.
+/**
+ * Snapshot views still held by callers stay valid until they are released
+ * with rcl_graph_cache_release(); only the view that the cache itself holds
+ * is dropped here.
+ *
+ * <hr>
+ * Attribute          | Adherence
+ * ------------------ | -------------
+ * Allocates Memory   | No
+ * Thread-Safe        | No
+ * Uses Atomics       | Yes
+ * Lock-Free          | Yes
+ *
+ * \param[inout] cache the graph cache to be finalized
+ * \return #RCL_RET_OK if the graph cache was finalized successfully, or
+ * \return #RCL_RET_INVALID_ARGUMENT if any arguments are invalid, or
+ * \return #RCL_RET_ERROR if an unspecified error occurs.
+ */
+RCL_PUBLIC
+RCL_WARN_UNUSED
+rcl_ret_t
+rcl_graph_cache_fini(rcl_graph_cache_t * cache);
+
+/// Get a cached view of the topic names and types in the ROS graph.
+/**
+ * Polls the node's graph guard condition without blocking; if it fired since
+ * the last query, or no snapshot exists yet, a fresh snapshot is fetched
+ * through the rmw layer and the version is incremented.
+ * Otherwise the existing snapshot is served without touching rmw or
+ * allocating strings.
+ *
+ * The returned view is immutable and reference counted: it stays valid, even
+ * across refreshes and rcl_graph_cache_fini(), until passed to
+ * rcl_graph_cache_release().
+ * The version lets callers skip their own reprocessing when consecutive
+ * queries return the same snapshot.
+ *
+ * This function is not thread-safe with itself or with
+ * rcl_graph_cache_fini() on the same cache; views may be released from any
+ * thread.
+ *
+ * <hr>
+ * Attribute          | Adherence
+ * ------------------ | -------------
+ * Allocates Memory   | Yes [1]
+ * Thread-Safe        | No
+ * Uses Atomics       | Yes
+ * Lock-Free          | Yes
+ * <i>[1] only when the graph changed since the previous query</i>
+ *
+ * \param[inout] cache the graph cache to be queried
+ * \param[out] names_and_types the cached snapshot view
+ * \param[out] version snapshot version, incremented on refresh, may be `NULL`
+ * \return #RCL_RET_OK if the query was successful, or
+ * \return #RCL_RET_NODE_INVALID if the node is invalid, or
+ * \return #RCL_RET_INVALID_ARGUMENT if any arguments are invalid, or
+ * \return #RCL_RET_BAD_ALLOC if allocating memory failed, or
+ * \return #RCL_RET_ERROR if an unspecified error occurs.
+ */
+RCL_PUBLIC
+RCL_WARN_UNUSED
+rcl_ret_t
+rcl_graph_cache_get_topic_names_and_types(
+  rcl_graph_cache_t * cache,
+  const rcl_names_and_types_t ** names_and_types,
+  uint64_t * version);
+
+/// Release a snapshot view obtained from a graph cache.
+/**
+ * Drops one reference to the snapshot backing the view and sets the view
+ * pointer to `NULL`; the snapshot is deallocated when its last reference is
+ * released.
+ *
+ * <hr>
+ * Attribute          | Adherence
+ * ------------------ | -------------
+ * Allocates Memory   | No
+ * Thread-Safe        | Yes
+ * Uses Atomics       | Yes
+ * Lock-Free          | Yes
+ *
+ * \param[inout] names_and_types the view to be released, set to `NULL`
+ * \return #RCL_RET_OK if the view was released successfully, or
+ * \return #RCL_RET_INVALID_ARGUMENT if any arguments are invalid.
+ */
+RCL_PUBLIC
+RCL_WARN_UNUSED
+rcl_ret_t
+rcl_graph_cache_release(const rcl_names_and_types_t ** names_and_types);
+
+/// The set of graph changes between two cached snapshot versions.
+/**
+ * A topic whose type set changed is reported in both lists: its old entry
+ * disappeared and its new entry appeared.
+ */
+typedef struct rcl_graph_changes_s
+{
+  /// Topics present now that were absent at the caller's version.
+  rcl_names_and_types_t appeared;
+  /// Topics absent now that were present at the caller's version.
+  rcl_names_and_types_t disappeared;
+  /// The snapshot version this delta brings the caller up to.
+  uint64_t version;
+} rcl_graph_changes_t;
+
+/// Return a rcl_graph_changes_t struct with members initialized to zero.
+RCL_PUBLIC
+RCL_WARN_UNUSED
+rcl_graph_changes_t
+rcl_get_zero_initialized_graph_changes(void);
+
+/// Get the graph changes since a caller-held snapshot version.
+/**
+ * Refreshes the cache exactly like rcl_graph_cache_get_topic_names_and_types()
+ * and then diffs the current snapshot against the snapshot identified by
+ * `since_version`, so consumers of the graph guard condition learn which
+ * topics appeared or disappeared instead of re-diffing the whole graph.
+ *
+ * A `since_version` of `0` means "no prior snapshot": every current topic is
+ * reported as appeared.
+ * The cache retains a small number of replaced snapshots for diffing; if
+ * `since_version` is older than what is retained, #RCL_RET_INVALID_ARGUMENT
+ * is returned and the caller should resynchronize by passing `0`.
+ *
+ * `changes` must be zero initialized and, on success, must be finalized with
+ * rcl_graph_changes_fini() by the caller.
+ * After a successful call the caller's new version token is
+ * `changes->version`.
+ *
+ * <hr>
+ * Attribute          | Adherence
+ * ------------------ | -------------
+ * Allocates Memory   | Yes
+ * Thread-Safe        | No
+ * Uses Atomics       | Yes
+ * Lock-Free          | Yes
+ *
+ * \param[inout] cache the graph cache to be queried
+ * \param[in] since_version the caller's snapshot version token, or `0`
+ * \param[out] changes the topics that appeared and disappeared since then
+ * \return #RCL_RET_OK if the delta was computed successfully, or
+ * \return #RCL_RET_NODE_INVALID if the node is invalid, or
+ * \return #RCL_RET_INVALID_ARGUMENT if any arguments are invalid or the
+ *   given version is no longer retained, or
+ * \return #RCL_RET_BAD_ALLOC if allocating memory failed, or
+ * \return #RCL_RET_ERROR if an unspecified error occurs.
+ */
+RCL_PUBLIC
+RCL_WARN_UNUSED
+rcl_ret_t
+rcl_graph_cache_get_changes(
+  rcl_graph_cache_t * cache,
+  uint64_t since_version,
+  rcl_graph_changes_t * changes);
+
+/// Finalize a graph changes struct.
+/**
+ * <hr>
+ * Attribute          | Adherence
+ * ------------------ | -------------
+ * Allocates Memory   | No
+ * Thread-Safe        | No
+ * Uses Atomics       | No
+ * Lock-Free          | Yes
+ *
+ * \param[inout] changes the struct to be finalized
+ * \return #RCL_RET_OK if the struct was finalized successfully, or
+ * \return #RCL_RET_INVALID_ARGUMENT if any arguments are invalid, or
+ * \return #RCL_RET_ERROR if an unspecified error occurs.
+ */
+RCL_PUBLIC
+RCL_WARN_UNUSED
+rcl_ret_t
+rcl_graph_changes_fini(rcl_graph_changes_t * changes);
+
+typedef struct rcl_graph_debounce_impl_s rcl_graph_debounce_impl_t;
+
+/// Debounced, batched delivery of graph-change notifications.
+/**
+ * The raw graph guard condition fires once per discovery event, so during
+ * a large rollout a monitoring node wakes thousands of times in seconds
+ * and re-queries the graph each time.
+ * A debounce absorbs those firings: the first firing opens a window of the
+ * configured length, further firings inside the window are coalesced, and
+ * when the window expires one batched delta (computed through the attached
+ * graph cache, see rcl_graph_cache_get_changes()) is delivered and the
+ * debounce's own guard condition is triggered once.
+ *
+ * Like the other graph caches, the debounce is caller-driven: call
+ * rcl_graph_debounce_poll() periodically — typically on each wake of the
+ * monitoring loop — and wait on the debounced guard condition instead of
+ * the raw one.
+ */
+typedef struct rcl_graph_debounce_s
+{
+  /// Private implementation pointer.
+  rcl_graph_debounce_impl_t * impl;
+} rcl_graph_debounce_t;
+
+/// Return a rcl_graph_debounce_t struct with members initialized to `NULL`.
+RCL_PUBLIC
+RCL_WARN_UNUSED
+rcl_graph_debounce_t
+rcl_get_zero_initialized_graph_debounce(void);
+
+/// Initialize a graph debounce over a node's graph guard condition.
+/**
+ * `cache` supplies the snapshot diffs for the batched deltas; it must be
+ * initialized for the same node and must outlive the debounce.
+ * A `window_ns` of zero delivers on the first poll after a firing,
+ * degenerating to an undebounced (but still batched) notification.
+ *
+ * <hr>
+ * Attribute          | Adherence
+ * ------------------ | -------------
+ * Allocates Memory   | Yes
+ * Thread-Safe        | No
+ * Uses Atomics       | No
+ * Lock-Free          | Yes
+ *
+ * \param[inout] debounce a zero initialized debounce to be initialized
+ * \param[in] node the node whose graph guard condition is debounced
+ * \param[in] cache the graph cache the batched deltas are computed from
+ * \param[in] window_ns coalescing window length in nanoseconds
+ * \param[in] allocator the allocator used for internal state
+ * \return #RCL_RET_OK if the debounce was initialized successfully, or
+ * \return #RCL_RET_ALREADY_INIT if the debounce is already initialized, or
+ * \return #RCL_RET_NODE_INVALID if the node is invalid, or
+ * \return #RCL_RET_INVALID_ARGUMENT if any arguments are invalid, or
+ * \return #RCL_RET_BAD_ALLOC if allocating memory failed, or
+ * \return #RCL_RET_ERROR if an unspecified error occurs.
+ */
+RCL_PUBLIC
+RCL_WARN_UNUSED
+rcl_ret_t
+rcl_graph_debounce_init(
+  rcl_graph_debounce_t * debounce,
+  const rcl_node_t * node,
+  rcl_graph_cache_t * cache,
+  uint64_t window_ns,
+  rcl_allocator_t * allocator);
+
+/// Finalize a graph debounce.
+/**
+ * <hr>
+ * Attribute          | Adherence
+ * ------------------ | -------------
+ * Allocates Memory   | No
+ * Thread-Safe        | No
+ * Uses Atomics       | Yes
+ * Lock-Free          | Yes
+ *
+ * \param[inout] debounce the debounce to be finalized
+ * \return #RCL_RET_OK if the debounce was finalized successfully, or
+ * \return #RCL_RET_INVALID_ARGUMENT if any arguments are invalid, or
+ * \return #RCL_RET_ERROR if an unspecified error occurs.
+ */
+RCL_PUBLIC
+RCL_WARN_UNUSED
+rcl_ret_t
+rcl_graph_debounce_fini(rcl_graph_debounce_t * debounce);
+
+/// Poll the debounce, delivering a batched delta when a window expired.
+/**
+ * Checks the raw graph guard condition without blocking; a firing opens or
+ * extends nothing — the window length is fixed from its first firing, so a
+ * steady stream of discovery events still drains one delta per window.
+ * When a window has expired, `changes` receives the batched delta since
+ * the previous delivery, `delivered` is set to true and the debounced
+ * guard condition is triggered; otherwise `changes` is left untouched and
+ * `delivered` is false.
+ *
+ * `changes` must be zero initialized and, when a delta was delivered, must
+ * be finalized with rcl_graph_changes_fini() by the caller.
+ *
+ * <hr>
+ * Attribute          | Adherence
+ * ------------------ | -------------
+ * Allocates Memory   | Yes [1]
+ * Thread-Safe        | No
+ * Uses Atomics       | Yes
+ * Lock-Free          | Yes
+ * <i>[1] only when a delta is delivered</i>
+ *
+ * \param[inout] debounce the debounce to poll
+ * \param[out] changes set to the batched delta when one is delivered
+ * \param[out] delivered set to true when `changes` was filled
+ * \return #RCL_RET_OK if the poll succeeded, delta or not, or
+ * \return #RCL_RET_INVALID_ARGUMENT if any arguments are invalid, or
+ * \return #RCL_RET_NODE_INVALID if the node is invalid, or
+ * \return #RCL_RET_BAD_ALLOC if allocating memory failed, or
+ * \return #RCL_RET_ERROR if an unspecified error occurs.
+ */
+RCL_PUBLIC
+RCL_WARN_UNUSED
+rcl_ret_t
+rcl_graph_debounce_poll(
+  rcl_graph_debounce_t * debounce,
+  rcl_graph_changes_t * changes,
+  bool * delivered);
+
+/// Get the guard condition triggered once per delivered delta.
+/**
+ * Add it to the monitoring wait set in place of the raw graph guard
+ * condition.
+ *
+ * \param[in] debounce the debounce to query
+ * \return the debounced guard condition, or `NULL` if the debounce is
+ *   invalid.
+ */
+RCL_PUBLIC
+RCL_WARN_UNUSED
+const rcl_guard_condition_t *
+rcl_graph_debounce_get_guard_condition(const rcl_graph_debounce_t * debounce);
+
+/// A topic names and types view whose strings are owned by an interning pool.
+/**
+ * Unlike rcl_names_and_types_t, the strings are canonical pointers handed
+ * out by an rcl_intern_pool_t: equal strings are pointer-equal across
+ * queries sharing a pool, and only the arrays belong to this struct.
+ * See rcl_get_topic_names_and_types_interned().
+ */
+typedef struct rcl_interned_names_and_types_s
+{
+  /// Interned topic names.
+  const char ** names;
+  /// types[i] is an array of types_sizes[i] interned type names for names[i].
+  const char *** types;
+  /// Number of type entries per name.
+  size_t * types_sizes;
+  /// Number of names.
+  size_t size;
+  /// Allocator owning the arrays; the strings belong to the pool.
+  rcl_allocator_t allocator;
+} rcl_interned_names_and_types_t;
+
+/// Return a rcl_interned_names_and_types_t with members initialized to `NULL`.
+RCL_PUBLIC
+RCL_WARN_UNUSED
+rcl_interned_names_and_types_t
+rcl_get_zero_initialized_interned_names_and_types(void);
+
+/// Return a list of topic names and types with interned strings.
+/**
+ * Behaves like rcl_get_topic_names_and_types(), but every name and type
+ * string in the result is interned into the given pool, typically the
+ * context's pool from rcl_context_get_intern_pool().
+ * Repeated queries against a nearly-static graph therefore allocate only
+ * the result arrays, not new string copies, and successive snapshots can be
+ * diffed with pointer comparisons instead of strcmp.
+ *
+ * The result must be finalized with rcl_interned_names_and_types_fini();
+ * the interned strings themselves remain valid until the pool is finalized.
+ *
+ * <hr>
+ * Attribute          | Adherence
+ * ------------------ | -------------
+ * Allocates Memory   | Yes
+ * Thread-Safe        | No
+ * Uses Atomics       | No
+ * Lock-Free          | Maybe [1]
+ * <i>[1] implementation may need to protect the data structure with a lock</i>
+ *
+ * \param[in] node the handle to the node being used to query the ROS graph
+ * \param[inout] pool the interning pool that owns the result's strings
+ * \param[in] allocator allocator used for the result arrays
+ * \param[in] no_demangle if true, topic names are not demangled
+ * \param[out] topic_names_and_types a zero initialized struct for the result
+ * \return #RCL_RET_OK if the query was successful, or
+ * \return #RCL_RET_NODE_INVALID if the node is invalid, or
+ * \return #RCL_RET_INVALID_ARGUMENT if any arguments are invalid, or
+ * \return #RCL_RET_BAD_ALLOC if allocating memory failed, or
+ * \return #RCL_RET_ERROR if an unspecified error occurs.
+ */
+RCL_PUBLIC
+RCL_WARN_UNUSED
+rcl_ret_t
+rcl_get_topic_names_and_types_interned(
+  const rcl_node_t * node,
+  rcl_intern_pool_t * pool,
+  rcl_allocator_t * allocator,
+  bool no_demangle,
+  rcl_interned_names_and_types_t * topic_names_and_types);
+
+/// Finalize an interned names and types view, releasing its arrays.
+/**
+ * The interned strings are owned by the pool and are not released here.
+ *
+ * <hr>
+ * Attribute          | Adherence
+ * ------------------ | -------------
+ * Allocates Memory   | No
+ * Thread-Safe        | No
+ * Uses Atomics       | No
+ * Lock-Free          | Yes
+ *
+ * \param[inout] names_and_types the view to be finalized
+ * \return #RCL_RET_OK if the view was finalized successfully, or
+ * \return #RCL_RET_INVALID_ARGUMENT if any arguments are invalid.
+ */
+RCL_PUBLIC
+RCL_WARN_UNUSED
+rcl_ret_t
+rcl_interned_names_and_types_fini(
+  rcl_interned_names_and_types_t * names_and_types);
+
 #ifdef __cplusplus
 }
 #endif
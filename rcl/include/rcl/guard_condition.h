@@ -22,6 +22,8 @@ extern "C"
 {
 #endif
 
+#include <stdint.h>
+
 #include "rcl/allocator.h"
 #include "rcl/context.h"
 #include "rcl/macros.h"
@@ -206,6 +208,65 @@ RCL_WARN_UNUSED
 rcl_ret_t
 rcl_trigger_guard_condition(rcl_guard_condition_t * guard_condition);
 
+/// Trigger a rcl guard condition, coalescing redundant rmw wakeups.
+/**
+ * Like rcl_trigger_guard_condition(), but each call increments an atomic
+ * pending counter and only the zero to one transition is forwarded to
+ * rmw_trigger_guard_condition().
+ * Producers that trigger at a high rate, e.g. once per enqueued job, thus
+ * wake the consumer once per batch instead of once per call; the consumer
+ * retrieves and clears the accumulated count with
+ * rcl_guard_condition_take_pending() after waking.
+ *
+ * Coalesced and plain triggers can be mixed on the same guard condition,
+ * but plain triggers do not contribute to the pending count.
+ *
+ * <hr>
+ * Attribute          | Adherence
+ * ------------------ | -------------
+ * Allocates Memory   | No
+ * Thread-Safe        | Yes
+ * Uses Atomics       | Yes
+ * Lock-Free          | Yes
+ *
+ * \param[in] guard_condition handle to the guard_condition to be triggered
+ * \return #RCL_RET_OK if the trigger was recorded, or
+ * \return #RCL_RET_INVALID_ARGUMENT if any arguments are invalid, or
+ * \return #RCL_RET_ERROR if an unspecified error occurs.
+ */
+RCL_PUBLIC
+RCL_WARN_UNUSED
+rcl_ret_t
+rcl_trigger_guard_condition_coalesced(rcl_guard_condition_t * guard_condition);
+
+/// Fetch and clear the pending trigger count of a guard condition.
+/**
+ * Returns the number of rcl_trigger_guard_condition_coalesced() calls made
+ * since the last call to this function, and atomically resets the count to
+ * zero so the next coalesced trigger wakes the consumer again.
+ * A woken consumer should call this exactly once per wakeup, before
+ * processing, so triggers arriving during processing produce a new wakeup.
+ *
+ * <hr>
+ * Attribute          | Adherence
+ * ------------------ | -------------
+ * Allocates Memory   | No
+ * Thread-Safe        | Yes
+ * Uses Atomics       | Yes
+ * Lock-Free          | Yes
+ *
+ * \param[in] guard_condition pointer to the rcl guard_condition
+ * \param[out] pending_count number of coalesced triggers since the last call
+ * \return #RCL_RET_OK if the count was retrieved, or
+ * \return #RCL_RET_INVALID_ARGUMENT if any arguments are invalid.
+ */
+RCL_PUBLIC
+RCL_WARN_UNUSED
+rcl_ret_t
+rcl_guard_condition_take_pending(
+  const rcl_guard_condition_t * guard_condition,
+  uint64_t * pending_count);
+
 /// Return the guard condition options.
 /**
  * Returned is a pointer to the internally held rcl_guard_condition_options_t.
@@ -0,0 +1,201 @@
+// Copyright 2026 Open Source Robotics Foundation, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef RCL__HOP_LATENCY_H_
+#define RCL__HOP_LATENCY_H_
+
+#include <stdint.h>
+
+#include "rcl/macros.h"
+#include "rcl/publisher.h"
+#include "rcl/types.h"
+#include "rcl/visibility_control.h"
+
+#include "rcutils/time.h"
+
+#include "rmw/types.h"
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+/// Compact trace context carried from a take to a subsequent publish.
+/**
+ * Pipelines that republish work derived from a taken message can attribute
+ * the per-hop latency without embedding timestamps in their message
+ * definitions: derive a context from the rmw_message_info_t returned by
+ * rcl_take_with_info() and hand it back to
+ * rcl_publisher_record_hop() next to the rcl_publish() call.
+ * The context is a plain value; copying it is cheap and it owns nothing.
+ */
+typedef struct rcl_hop_context_s
+{
+  /// System-clock time the middleware received the message, in nanoseconds.
+  rcutils_time_point_value_t received_timestamp;
+  /// System-clock time the upstream publisher sent the message, in
+  /// nanoseconds; zero when the middleware does not stamp sends.
+  rcutils_time_point_value_t source_timestamp;
+  /// Global identifier of the upstream publisher.
+  rmw_gid_t publisher_gid;
+} rcl_hop_context_t;
+
+/// Number of power-of-two latency buckets in a hop histogram.
+#define RCL_HOP_HISTOGRAM_BUCKETS 64
+
+/// Snapshot of a publisher's hop-latency histogram.
+/**
+ * Bucket `i` counts hops whose latency was in `[2^i, 2^(i+1))` nanoseconds;
+ * bucket 0 additionally holds sub-nanosecond and clock-skewed samples.
+ */
+typedef struct rcl_hop_histogram_s
+{
+  /// Per-bucket hop counts; the bucket counts sum to `sample_count`.
+  uint64_t bucket_counts[RCL_HOP_HISTOGRAM_BUCKETS];
+  /// Number of hops recorded.
+  uint64_t sample_count;
+  /// Sum of all recorded hop latencies, in nanoseconds.
+  uint64_t total_latency_ns;
+  /// Largest recorded hop latency, in nanoseconds.
+  uint64_t max_latency_ns;
+} rcl_hop_histogram_t;
+
+/// Return a rcl_hop_context_t with members initialized to zero.
+RCL_PUBLIC
+RCL_WARN_UNUSED
+rcl_hop_context_t
+rcl_get_zero_initialized_hop_context(void);
+
+/// Derive a hop context from a taken message's info.
+/**
+ * Copies the receive timestamp, the source timestamp and the upstream
+ * publisher's gid out of `message_info`.
+ * When the middleware left the receive timestamp unset the current system
+ * time is used instead, since the context is expected to be built right
+ * after the take.
+ *
+ * <hr>
+ * Attribute          | Adherence
+ * ------------------ | -------------
+ * Allocates Memory   | No
+ * Thread-Safe        | Yes
+ * Uses Atomics       | No
+ * Lock-Free          | Yes
+ *
+ * \param[in] message_info info returned by rcl_take_with_info()
+ * \param[out] context filled with the hop context
+ * \return #RCL_RET_OK if the context was derived, or
+ * \return #RCL_RET_INVALID_ARGUMENT if any arguments are invalid, or
+ * \return #RCL_RET_ERROR if sampling the fallback timestamp failed.
+ */
+RCL_PUBLIC
+RCL_WARN_UNUSED
+rcl_ret_t
+rcl_hop_context_from_message_info(
+  const rmw_message_info_t * message_info,
+  rcl_hop_context_t * context);
+
+/// Enable hop-latency accounting on a publisher.
+/**
+ * Allocates the publisher's histogram storage; until this is called
+ * rcl_publisher_record_hop() is a no-op and the instrumentation costs
+ * nothing.
+ * Accounting stays enabled for the rest of the publisher's lifetime; the
+ * storage is released by rcl_publisher_fini().
+ * Enabling an already enabled publisher is a no-op.
+ *
+ * <hr>
+ * Attribute          | Adherence
+ * ------------------ | -------------
+ * Allocates Memory   | Yes
+ * Thread-Safe        | No
+ * Uses Atomics       | No
+ * Lock-Free          | Yes
+ *
+ * \param[in] publisher pointer to the rcl publisher
+ * \return #RCL_RET_OK if accounting was enabled, or
+ * \return #RCL_RET_PUBLISHER_INVALID if the publisher is invalid, or
+ * \return #RCL_RET_BAD_ALLOC if allocating memory failed.
+ */
+RCL_PUBLIC
+RCL_WARN_UNUSED
+rcl_ret_t
+rcl_publisher_enable_hop_accounting(rcl_publisher_t * publisher);
+
+/// Record one take-to-publish hop against a publisher.
+/**
+ * Call next to the rcl_publish() that forwards work derived from the taken
+ * message; the latency is the current system time minus the context's
+ * receive timestamp, folded into the publisher's histogram with relaxed
+ * atomics.
+ * A publisher is bound to one topic, so the histogram is the per-topic
+ * hop-latency distribution the monitoring side reads through
+ * rcl_publisher_get_hop_histogram().
+ * Does nothing while accounting is not enabled.
+ *
+ * <hr>
+ * Attribute          | Adherence
+ * ------------------ | -------------
+ * Allocates Memory   | No
+ * Thread-Safe        | Yes
+ * Uses Atomics       | Yes
+ * Lock-Free          | Yes
+ *
+ * \param[in] publisher pointer to the rcl publisher
+ * \param[in] context hop context derived at take time
+ * \return #RCL_RET_OK if the hop was recorded or accounting is disabled, or
+ * \return #RCL_RET_PUBLISHER_INVALID if the publisher is invalid, or
+ * \return #RCL_RET_INVALID_ARGUMENT if context is null, or
+ * \return #RCL_RET_ERROR if sampling the system clock failed.
+ */
+RCL_PUBLIC
+RCL_WARN_UNUSED
+rcl_ret_t
+rcl_publisher_record_hop(
+  const rcl_publisher_t * publisher,
+  const rcl_hop_context_t * context);
+
+/// Read a snapshot of a publisher's hop-latency histogram.
+/**
+ * The counters are read with individual atomic loads, so values observed
+ * concurrently with recording may come from slightly different instants;
+ * each individual counter is always consistent.
+ * The snapshot is all zeros while accounting has not been enabled.
+ *
+ * <hr>
+ * Attribute          | Adherence
+ * ------------------ | -------------
+ * Allocates Memory   | No
+ * Thread-Safe        | Yes
+ * Uses Atomics       | Yes
+ * Lock-Free          | Yes
+ *
+ * \param[in] publisher pointer to the rcl publisher
+ * \param[out] histogram filled with the current counter values
+ * \return #RCL_RET_OK if the snapshot was taken, or
+ * \return #RCL_RET_PUBLISHER_INVALID if the publisher is invalid, or
+ * \return #RCL_RET_INVALID_ARGUMENT if histogram is null.
+ */
+RCL_PUBLIC
+RCL_WARN_UNUSED
+rcl_ret_t
+rcl_publisher_get_hop_histogram(
+  const rcl_publisher_t * publisher,
+  rcl_hop_histogram_t * histogram);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif  // RCL__HOP_LATENCY_H_
@@ -173,6 +173,114 @@ RCL_WARN_UNUSED
 rcl_ret_t
 rcl_init_options_set_domain_id(rcl_init_options_t * init_options, size_t domain_id);
 
+/// Return whether rmw initialization is deferred.
+/**
+ * Get the defer_rmw_init flag from the specified rcl_init_options_t object.
+ *
+ * <hr>
+ * Attribute          | Adherence
+ * ------------------ | -------------
+ * Allocates Memory   | No
+ * Thread-Safe        | Yes
+ * Uses Atomics       | No
+ * Lock-Free          | Yes
+ *
+ * \param[in] init_options object from which the flag should be retrieved.
+ * \param[out] defer_rmw_init set to the flag stored in the init_options object.
+ * \return #RCL_RET_OK if successful, or
+ * \return #RCL_RET_INVALID_ARGUMENT if any arguments are invalid.
+ */
+RCL_PUBLIC
+RCL_WARN_UNUSED
+rcl_ret_t
+rcl_init_options_get_defer_rmw_init(
+  const rcl_init_options_t * init_options, bool * defer_rmw_init);
+
+/// Defer rmw initialization until the first entity needs it.
+/**
+ * When the flag is set, rcl_init() performs argument parsing and everything
+ * needed for rcl_logging_configure() but skips rmw_init(); the rmw context is
+ * created lazily by rcl_context_ensure_rmw_context() when the first node,
+ * guard condition or wait set is initialized. Processes that never touch the
+ * middleware, like short-lived command line tools, then avoid the cost of
+ * creating a middleware participant.
+ *
+ * <hr>
+ * Attribute          | Adherence
+ * ------------------ | -------------
+ * Allocates Memory   | No
+ * Thread-Safe        | Yes
+ * Uses Atomics       | No
+ * Lock-Free          | Yes
+ *
+ * \param[in] init_options object in which to set the flag.
+ * \param[in] defer_rmw_init whether rmw_init() shall be deferred.
+ * \return #RCL_RET_OK if successful, or
+ * \return #RCL_RET_INVALID_ARGUMENT if any arguments are invalid.
+ */
+RCL_PUBLIC
+RCL_WARN_UNUSED
+rcl_ret_t
+rcl_init_options_set_defer_rmw_init(rcl_init_options_t * init_options, bool defer_rmw_init);
+
+/// Return whether the rmw context is shared between matching contexts.
+/**
+ * Get the share_rmw_context flag from the specified rcl_init_options_t object.
+ *
+ * <hr>
+ * Attribute          | Adherence
+ * ------------------ | -------------
+ * Allocates Memory   | No
+ * Thread-Safe        | Yes
+ * Uses Atomics       | No
+ * Lock-Free          | Yes
+ *
+ * \param[in] init_options object from which the flag should be retrieved.
+ * \param[out] share_rmw_context set to the flag stored in the init_options object.
+ * \return #RCL_RET_OK if successful, or
+ * \return #RCL_RET_INVALID_ARGUMENT if any arguments are invalid.
+ */
+RCL_PUBLIC
+RCL_WARN_UNUSED
+rcl_ret_t
+rcl_init_options_get_share_rmw_context(
+  const rcl_init_options_t * init_options, bool * share_rmw_context);
+
+/// Share one rmw context between contexts with identical options.
+/**
+ * When the flag is set, contexts whose rmw init options match an already
+ * shared rmw context in this process — same domain id, enclave, discovery,
+ * localhost and security options — reuse that rmw context instead of creating
+ * another middleware participant, and the shared rmw context is torn down
+ * when the last context using it is shut down. Contexts without the flag, or
+ * with options that match no live shared rmw context, create their own as
+ * before.
+ *
+ * Processes with many contexts on the same domain, such as multi-context
+ * test harnesses or domain bridges, then create one participant per distinct
+ * configuration instead of one per context.
+ *
+ * Initializing and shutting down contexts concurrently is not thread-safe,
+ * with or without this flag.
+ *
+ * <hr>
+ * Attribute          | Adherence
+ * ------------------ | -------------
+ * Allocates Memory   | No
+ * Thread-Safe        | Yes
+ * Uses Atomics       | No
+ * Lock-Free          | Yes
+ *
+ * \param[in] init_options object in which to set the flag.
+ * \param[in] share_rmw_context whether the rmw context shall be shared.
+ * \return #RCL_RET_OK if successful, or
+ * \return #RCL_RET_INVALID_ARGUMENT if any arguments are invalid.
+ */
+RCL_PUBLIC
+RCL_WARN_UNUSED
+rcl_ret_t
+rcl_init_options_set_share_rmw_context(rcl_init_options_t * init_options, bool share_rmw_context);
+
 /// Return the rmw init options which are stored internally.
 /**
  * This function can fail and return `NULL` if:
@@ -223,6 +331,88 @@ RCL_WARN_UNUSED
 const rcl_allocator_t *
 rcl_init_options_get_allocator(const rcl_init_options_t * init_options);
 
+/// Allocation domains that can carry their own allocator in the init options.
+/**
+ * Entities pick the allocator for their domain via
+ * rcl_init_options_get_domain_allocator(), so on multi-socket machines the
+ * storage touched by pinned worker threads (wait-set arrays, message and
+ * buffer pools) can be placed near the cores consuming it — for example by
+ * assigning a rcl_numa_pool_t allocator per domain — while control-plane
+ * and logging storage stays on the default allocator.
+ */
+typedef enum rcl_allocation_domain_e
+{
+  /// Storage on the publish/take hot path: wait sets, message and buffer pools.
+  RCL_ALLOCATION_DOMAIN_DATA_PLANE = 0,
+  /// Entity bookkeeping: node, publisher, subscription and service impls.
+  RCL_ALLOCATION_DOMAIN_CONTROL_PLANE = 1,
+  /// Logging buffers, including the rosout ring.
+  RCL_ALLOCATION_DOMAIN_LOGGING = 2,
+  /// Number of allocation domains, not a valid domain.
+  RCL_ALLOCATION_DOMAIN_COUNT = 3,
+} rcl_allocation_domain_t;
+
+/// Set the allocator for one allocation domain in the init options.
+/**
+ * Domains without an explicitly assigned allocator fall back to the
+ * allocator the init options were initialized with.
+ * The assigned allocator's state must outlive every context initialized
+ * from these init options and all entities created in those contexts.
+ *
+ * <hr>
+ * Attribute          | Adherence
+ * ------------------ | -------------
+ * Allocates Memory   | No
+ * Thread-Safe        | No
+ * Uses Atomics       | No
+ * Lock-Free          | Yes
+ *
+ * \param[in] init_options object in which to set the domain allocator.
+ * \param[in] domain the allocation domain to assign the allocator to.
+ * \param[in] allocator the allocator for storage in that domain.
+ * \return #RCL_RET_OK if successful, or
+ * \return #RCL_RET_INVALID_ARGUMENT if any arguments are invalid.
+ */
+RCL_PUBLIC
+RCL_WARN_UNUSED
+rcl_ret_t
+rcl_init_options_set_domain_allocator(
+  rcl_init_options_t * init_options,
+  rcl_allocation_domain_t domain,
+  rcl_allocator_t allocator);
+
+/// Return the allocator for one allocation domain.
+/**
+ * Returns the allocator assigned with rcl_init_options_set_domain_allocator(),
+ * or the init options' own allocator if the domain has none assigned.
+ *
+ * This function can fail and return `NULL` if:
+ *   - init_options is NULL
+ *   - init_options is invalid, e.g. init_options->impl is NULL
+ *   - domain is out of range
+ *
+ * If NULL is returned an error message will have been set.
+ *
+ * <hr>
+ * Attribute          | Adherence
+ * ------------------ | -------------
+ * Allocates Memory   | No
+ * Thread-Safe        | Yes
+ * Uses Atomics       | No
+ * Lock-Free          | Yes
+ *
+ * \param[in] init_options object from which the allocator should be retrieved
+ * \param[in] domain the allocation domain to query.
+ * \return pointer to the rcl allocator, or
+ * \return `NULL` if there was an error
+ */
+RCL_PUBLIC
+RCL_WARN_UNUSED
+const rcl_allocator_t *
+rcl_init_options_get_domain_allocator(
+  const rcl_init_options_t * init_options,
+  rcl_allocation_domain_t domain);
+
 #ifdef __cplusplus
 }
 #endif
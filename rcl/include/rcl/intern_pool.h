@@ -0,0 +1,153 @@
+// Copyright 2026 Open Source Robotics Foundation, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/// @file
+
+#ifndef RCL__INTERN_POOL_H_
+#define RCL__INTERN_POOL_H_
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+#include "rcl/allocator.h"
+#include "rcl/macros.h"
+#include "rcl/types.h"
+#include "rcl/visibility_control.h"
+
+typedef struct rcl_intern_pool_impl_s rcl_intern_pool_impl_t;
+
+/// A string interning pool.
+/**
+ * The pool stores one canonical copy of each distinct string interned into
+ * it and hands out stable pointers to those copies, so repeated queries that
+ * produce the same nearly-static set of strings, such as graph queries,
+ * stop duplicating them.
+ * Two interned strings are equal exactly when their pointers are equal,
+ * which turns string comparisons in snapshot diffing into pointer compares.
+ *
+ * Canonical strings live until the pool is finalized; the pool never evicts.
+ */
+typedef struct rcl_intern_pool_s
+{
+  /// Private implementation pointer.
+  rcl_intern_pool_impl_t * impl;
+} rcl_intern_pool_t;
+
+/// Return a rcl_intern_pool_t struct with members initialized to `NULL`.
+RCL_PUBLIC
+RCL_WARN_UNUSED
+rcl_intern_pool_t
+rcl_get_zero_initialized_intern_pool(void);
+
+/// Initialize an interning pool.
+/**
+ * <hr>
+ * Attribute          | Adherence
+ * ------------------ | -------------
+ * Allocates Memory   | Yes
+ * Thread-Safe        | No
+ * Uses Atomics       | No
+ * Lock-Free          | Yes
+ *
+ * \param[inout] pool a zero initialized pool to be initialized
+ * \param[in] allocator the allocator used for the table and string copies
+ * \return #RCL_RET_OK if the pool was initialized successfully, or
+ * \return #RCL_RET_ALREADY_INIT if the pool is already initialized, or
+ * \return #RCL_RET_INVALID_ARGUMENT if any arguments are invalid, or
+ * \return #RCL_RET_BAD_ALLOC if allocating memory failed.
+ */
+RCL_PUBLIC
+RCL_WARN_UNUSED
+rcl_ret_t
+rcl_intern_pool_init(rcl_intern_pool_t * pool, rcl_allocator_t * allocator);
+
+/// Finalize an interning pool, releasing every canonical string.
+/**
+ * Pointers previously returned by rcl_intern_pool_intern() are invalidated.
+ *
+ * <hr>
+ * Attribute          | Adherence
+ * ------------------ | -------------
+ * Allocates Memory   | No
+ * Thread-Safe        | No
+ * Uses Atomics       | No
+ * Lock-Free          | Yes
+ *
+ * \param[inout] pool the pool to be finalized
+ * \return #RCL_RET_OK if the pool was finalized successfully, or
+ * \return #RCL_RET_INVALID_ARGUMENT if any arguments are invalid.
+ */
+RCL_PUBLIC
+RCL_WARN_UNUSED
+rcl_ret_t
+rcl_intern_pool_fini(rcl_intern_pool_t * pool);
+
+/// Intern a string, returning its stable canonical pointer.
+/**
+ * If an equal string was interned before, its existing canonical pointer is
+ * returned and no memory is allocated; otherwise the string is copied once
+ * into the pool.
+ * The returned pointer is valid until the pool is finalized and must not be
+ * deallocated by the caller; callers that need ownership beyond the pool's
+ * lifetime copy on demand.
+ *
+ * <hr>
+ * Attribute          | Adherence
+ * ------------------ | -------------
+ * Allocates Memory   | Yes [1]
+ * Thread-Safe        | No
+ * Uses Atomics       | No
+ * Lock-Free          | Yes
+ * <i>[1] only the first time a given string is interned</i>
+ *
+ * \param[inout] pool the pool to intern into
+ * \param[in] string the NUL-terminated string to be interned
+ * \param[out] interned the canonical pointer for the string
+ * \return #RCL_RET_OK if the string was interned successfully, or
+ * \return #RCL_RET_INVALID_ARGUMENT if any arguments are invalid, or
+ * \return #RCL_RET_BAD_ALLOC if allocating memory failed.
+ */
+RCL_PUBLIC
+RCL_WARN_UNUSED
+rcl_ret_t
+rcl_intern_pool_intern(
+  rcl_intern_pool_t * pool, const char * string, const char ** interned);
+
+/// Get the number of distinct strings held by the pool.
+/**
+ * <hr>
+ * Attribute          | Adherence
+ * ------------------ | -------------
+ * Allocates Memory   | No
+ * Thread-Safe        | No
+ * Uses Atomics       | No
+ * Lock-Free          | Yes
+ *
+ * \param[in] pool the pool to be queried
+ * \param[out] count the number of canonical strings
+ * \return #RCL_RET_OK if the count was retrieved successfully, or
+ * \return #RCL_RET_INVALID_ARGUMENT if any arguments are invalid.
+ */
+RCL_PUBLIC
+RCL_WARN_UNUSED
+rcl_ret_t
+rcl_intern_pool_get_count(const rcl_intern_pool_t * pool, size_t * count);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif  // RCL__INTERN_POOL_H_
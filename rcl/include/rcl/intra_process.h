@@ -0,0 +1,250 @@
+// Copyright 2026 Open Source Robotics Foundation, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/// @file
+
+#ifndef RCL__INTRA_PROCESS_H_
+#define RCL__INTRA_PROCESS_H_
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+#include <stddef.h>
+
+#include "rcl/context.h"
+#include "rcl/guard_condition.h"
+#include "rcl/macros.h"
+#include "rcl/publisher.h"
+#include "rcl/subscription.h"
+#include "rcl/types.h"
+#include "rcl/visibility_control.h"
+
+/// Opaque handle to a message delivered through the intra-process channel.
+/**
+ * The handle owns the shared reference count behind a delivered message;
+ * every message obtained from rcl_take_intra_process() must be given back
+ * through rcl_intra_process_message_release() exactly once.
+ */
+typedef struct rcl_intra_process_message_s rcl_intra_process_message_t;
+
+/// Called when the last reference to an intra-process message is released.
+/**
+ * `ros_message` is the pointer that was handed to
+ * rcl_publish_intra_process(); ownership returns to this function, which
+ * typically finalizes and deallocates the message.
+ */
+typedef void (* rcl_intra_process_message_fini_t)(void * ros_message, void * user_data);
+
+/// Attach a publisher to the intra-process channel for its topic.
+/**
+ * After this call rcl_publish_intra_process() delivers messages by pointer
+ * to every subscription on the same fully qualified topic that enabled
+ * intra-process in the same context, bypassing rmw serialization and the
+ * middleware loopback entirely.
+ * The channel registry lives in the publisher's context and is keyed by the
+ * remapped and expanded topic name, so publishers and subscriptions match
+ * exactly when the middleware would also match them by name.
+ *
+ * Enabling and disabling are composition-time operations: they are not
+ * thread-safe with concurrent intra-process publishes or takes on the same
+ * topic, mirroring the init/fini functions of the entities involved.
+ *
+ * <hr>
+ * Attribute          | Adherence
+ * ------------------ | -------------
+ * Allocates Memory   | Yes
+ * Thread-Safe        | No
+ * Uses Atomics       | No
+ * Lock-Free          | Yes
+ *
+ * \param[in] publisher the publisher to attach
+ * \return #RCL_RET_OK if the publisher was attached, or
+ * \return #RCL_RET_ALREADY_INIT if intra-process is already enabled on it, or
+ * \return #RCL_RET_PUBLISHER_INVALID if the publisher is invalid, or
+ * \return #RCL_RET_BAD_ALLOC if allocating memory failed.
+ */
+RCL_PUBLIC
+RCL_WARN_UNUSED
+rcl_ret_t
+rcl_publisher_enable_intra_process(rcl_publisher_t * publisher);
+
+/// Detach a publisher from the intra-process channel.
+/**
+ * A no-op when intra-process was never enabled on the publisher.
+ *
+ * \param[in] publisher the publisher to detach
+ * \return #RCL_RET_OK if the publisher was detached, or
+ * \return #RCL_RET_PUBLISHER_INVALID if the publisher is invalid.
+ */
+RCL_PUBLIC
+RCL_WARN_UNUSED
+rcl_ret_t
+rcl_publisher_disable_intra_process(rcl_publisher_t * publisher);
+
+/// Attach a subscription to the intra-process channel for its topic.
+/**
+ * The subscription receives a lock-free ring of `ring_capacity` message
+ * slots (rounded up to a power of two) and a guard condition that fires on
+ * every delivery; add the guard condition, obtained with
+ * rcl_subscription_get_intra_process_guard_condition(), to a wait set to be
+ * woken for intra-process messages alongside middleware traffic.
+ * When the ring is full the publish side drops the new message for this
+ * subscription rather than blocking, matching keep-last QoS semantics.
+ *
+ * \param[in] subscription the subscription to attach
+ * \param[in] context the context holding the channel registry, which must
+ *   be the context the subscription's node was created in
+ * \param[in] ring_capacity number of undelivered messages to buffer
+ * \return #RCL_RET_OK if the subscription was attached, or
+ * \return #RCL_RET_ALREADY_INIT if intra-process is already enabled on it, or
+ * \return #RCL_RET_INVALID_ARGUMENT if context is invalid or ring_capacity
+ *   is zero, or
+ * \return #RCL_RET_SUBSCRIPTION_INVALID if the subscription is invalid, or
+ * \return #RCL_RET_BAD_ALLOC if allocating memory failed.
+ */
+RCL_PUBLIC
+RCL_WARN_UNUSED
+rcl_ret_t
+rcl_subscription_enable_intra_process(
+  rcl_subscription_t * subscription,
+  rcl_context_t * context,
+  size_t ring_capacity);
+
+/// Detach a subscription from the intra-process channel.
+/**
+ * Messages still queued in the ring are released as if taken and returned.
+ * A no-op when intra-process was never enabled on the subscription.
+ *
+ * \param[in] subscription the subscription to detach
+ * \return #RCL_RET_OK if the subscription was detached, or
+ * \return #RCL_RET_SUBSCRIPTION_INVALID if the subscription is invalid.
+ */
+RCL_PUBLIC
+RCL_WARN_UNUSED
+rcl_ret_t
+rcl_subscription_disable_intra_process(rcl_subscription_t * subscription);
+
+/// Return the guard condition that fires on intra-process deliveries.
+/**
+ * The returned guard condition is owned by the channel and stays valid
+ * until rcl_subscription_disable_intra_process() is called.
+ *
+ * \param[in] subscription the subscription to query
+ * \return the guard condition, or
+ * \return `NULL` if the subscription is invalid or intra-process is not
+ *   enabled on it.
+ */
+RCL_PUBLIC
+RCL_WARN_UNUSED
+const rcl_guard_condition_t *
+rcl_subscription_get_intra_process_guard_condition(const rcl_subscription_t * subscription);
+
+/// Publish a message by pointer to co-located subscriptions.
+/**
+ * Ownership of `ros_message` transfers to the channel: the message is
+ * wrapped in a reference-counted envelope shared by every subscription it
+ * was delivered to and `fini` is invoked exactly once, after the last
+ * reference is released — immediately when no subscription received it.
+ * The message itself is never copied or serialized.
+ *
+ * This delivers only within the process; subscriptions in other processes
+ * still need a regular rcl_publish() of a separate message instance.
+ *
+ * <hr>
+ * Attribute          | Adherence
+ * ------------------ | -------------
+ * Allocates Memory   | Yes (one envelope per call)
+ * Thread-Safe        | Yes
+ * Uses Atomics       | Yes
+ * Lock-Free          | Yes
+ *
+ * \param[in] publisher the publisher to publish with, which must have
+ *   intra-process enabled
+ * \param[in] ros_message the message to deliver, ownership is transferred
+ * \param[in] fini called when the last reference is released
+ * \param[in] fini_user_data passed through to `fini`, may be `NULL`
+ * \param[out] num_delivered filled with the number of subscriptions the
+ *   message was queued for, may be `NULL`
+ * \return #RCL_RET_OK if the message was delivered (possibly to zero
+ *   subscriptions), or
+ * \return #RCL_RET_INVALID_ARGUMENT if intra-process is not enabled on the
+ *   publisher or ros_message or fini is null, or
+ * \return #RCL_RET_PUBLISHER_INVALID if the publisher is invalid, or
+ * \return #RCL_RET_BAD_ALLOC if allocating the envelope failed, in which
+ *   case ownership of ros_message stays with the caller.
+ */
+RCL_PUBLIC
+RCL_WARN_UNUSED
+rcl_ret_t
+rcl_publish_intra_process(
+  const rcl_publisher_t * publisher,
+  void * ros_message,
+  rcl_intra_process_message_fini_t fini,
+  void * fini_user_data,
+  size_t * num_delivered);
+
+/// Take one intra-process message from a subscription's ring.
+/**
+ * On success `*ros_message` points at the instance the publisher handed to
+ * rcl_publish_intra_process() — shared, so it must be treated as read-only
+ * — and `*message_handle` holds the reference that must be given back with
+ * rcl_intra_process_message_release() when the callback is done with it.
+ *
+ * <hr>
+ * Attribute          | Adherence
+ * ------------------ | -------------
+ * Allocates Memory   | No
+ * Thread-Safe        | Yes
+ * Uses Atomics       | Yes
+ * Lock-Free          | Yes
+ *
+ * \param[in] subscription the subscription to take from, which must have
+ *   intra-process enabled
+ * \param[out] ros_message set to the delivered message
+ * \param[out] message_handle set to the reference to release afterwards
+ * \return #RCL_RET_OK if a message was taken, or
+ * \return #RCL_RET_SUBSCRIPTION_TAKE_FAILED if the ring is empty, or
+ * \return #RCL_RET_INVALID_ARGUMENT if intra-process is not enabled on the
+ *   subscription or an output argument is null, or
+ * \return #RCL_RET_SUBSCRIPTION_INVALID if the subscription is invalid.
+ */
+RCL_PUBLIC
+RCL_WARN_UNUSED
+rcl_ret_t
+rcl_take_intra_process(
+  const rcl_subscription_t * subscription,
+  void ** ros_message,
+  rcl_intra_process_message_t ** message_handle);
+
+/// Release one reference on a taken intra-process message.
+/**
+ * When the last reference is released the publisher's `fini` runs and the
+ * envelope is freed; the message pointer must not be used afterwards.
+ *
+ * \param[in] message_handle the handle obtained from rcl_take_intra_process()
+ * \return #RCL_RET_OK if the reference was released, or
+ * \return #RCL_RET_INVALID_ARGUMENT if message_handle is null.
+ */
+RCL_PUBLIC
+RCL_WARN_UNUSED
+rcl_ret_t
+rcl_intra_process_message_release(rcl_intra_process_message_t * message_handle);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif  // RCL__INTRA_PROCESS_H_
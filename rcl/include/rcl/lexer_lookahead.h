@@ -236,6 +236,67 @@ rcl_lexer_lookahead2_expect(
   const char ** lexeme_text,
   size_t * lexeme_text_length);
 
+/// Analyze the entire string at once, filling the internal memo table.
+/**
+ * Every lexeme between the start of the string and the first
+ * `RCL_LEXEME_EOF` or `RCL_LEXEME_NONE` is analyzed and memoized.
+ * Afterwards peeking at any of these lexemes, including after a rewind,
+ * is a table lookup instead of a re-analysis.
+ * This does not advance the buffer; accepting lexemes works as usual.
+ * \sa rcl_lexer_lookahead2_rewind()
+ *
+ * <hr>
+ * Attribute          | Adherence
+ * ------------------ | -------------
+ * Allocates Memory   | Yes
+ * Thread-Safe        | No
+ * Uses Atomics       | No
+ * Lock-Free          | Yes
+ *
+ * \param[in] buffer the lookahead2 buffer being used to analyze a string.
+ * \param[out] lexeme_count if not `NULL`, set to the number of memoized lexemes.
+ * \return #RCL_RET_OK if the string was successfully analyzed, or
+ * \return #RCL_RET_INVALID_ARGUMENT if any function arguments are invalid, or
+ * \return #RCL_RET_ERROR if an unspecified error occurs.
+ */
+RCL_PUBLIC
+RCL_WARN_UNUSED
+rcl_ret_t
+rcl_lexer_lookahead2_tokenize(
+  rcl_lexer_lookahead2_t * buffer,
+  size_t * lexeme_count);
+
+/// Move analysis back to a previously analyzed position.
+/**
+ * This allows a parser to try one rule, and on failure re-match the same text
+ * against another rule.
+ * The position must be 0 or the start of a lexeme that has already been
+ * analyzed, either through peeking or rcl_lexer_lookahead2_tokenize().
+ * Replayed lexemes are served from the memo table without re-analysis.
+ *
+ * <hr>
+ * Attribute          | Adherence
+ * ------------------ | -------------
+ * Allocates Memory   | Yes [1]
+ * Thread-Safe        | No
+ * Uses Atomics       | No
+ * Lock-Free          | Yes
+ * <i>[1] Only allocates if an argument is invalid.</i>
+ *
+ * \param[in] buffer the lookahead2 buffer being used to analyze a string.
+ * \param[in] position index into the original text to continue analysis from.
+ * \return #RCL_RET_OK if the buffer was successfully rewound, or
+ * \return #RCL_RET_INVALID_ARGUMENT if any function arguments are invalid, or
+ * \return #RCL_RET_INVALID_ARGUMENT if position is not a known lexeme start, or
+ * \return #RCL_RET_ERROR if an unspecified error occurs.
+ */
+RCL_PUBLIC
+RCL_WARN_UNUSED
+rcl_ret_t
+rcl_lexer_lookahead2_rewind(
+  rcl_lexer_lookahead2_t * buffer,
+  size_t position);
+
 /// Get the text at the point where it is currently being analyzed.
 /**
  * <hr>
@@ -50,6 +50,9 @@ typedef struct rcl_log_levels_s
   size_t num_logger_settings;
   /// Capacity of logger settings.
   size_t capacity_logger_settings;
+  /// Indices into logger_settings ordered by name, or NULL until built
+  /// with rcl_log_levels_build_index().
+  size_t * sorted_order;
   /// Allocator used to allocate objects in this struct.
   rcl_allocator_t allocator;
 } rcl_log_levels_t;
@@ -186,6 +189,57 @@ rcl_ret_t
 rcl_log_levels_add_logger_setting(
   rcl_log_levels_t * log_levels, const char * logger_name, rcl_log_severity_t log_level);
 
+/// Build a sorted index over the logger settings to accelerate lookups.
+/**
+ * The index orders logger settings by name so rcl_log_levels_resolve() can
+ * binary search instead of scanning linearly.
+ * It is invalidated when a setting for a new logger name is added and can be
+ * rebuilt at any time; rcl_logging_configure() builds it once after parsing.
+ *
+ * <hr>
+ * Attribute          | Adherence
+ * ------------------ | -------------
+ * Allocates Memory   | Yes
+ * Thread-Safe        | No
+ * Uses Atomics       | No
+ * Lock-Free          | Yes
+ *
+ * \param[in] log_levels The structure whose settings are to be indexed.
+ * \return #RCL_RET_OK if the index was built successfully, or
+ * \return #RCL_RET_INVALID_ARGUMENT if log_levels is NULL or its allocator is invalid, or
+ * \return #RCL_RET_BAD_ALLOC if allocating memory failed.
+ */
+RCL_PUBLIC
+rcl_ret_t
+rcl_log_levels_build_index(rcl_log_levels_t * log_levels);
+
+/// Resolve the effective severity for a logger name.
+/**
+ * Looks for a setting matching the full logger name and then successively
+ * shorter dotted ancestor names (longest match wins), falling back to the
+ * default logger level when no setting matches.
+ * Uses the sorted index when it was built; otherwise each candidate name is
+ * checked with a linear scan.
+ *
+ * <hr>
+ * Attribute          | Adherence
+ * ------------------ | -------------
+ * Allocates Memory   | No
+ * Thread-Safe        | No
+ * Uses Atomics       | No
+ * Lock-Free          | Yes
+ *
+ * \param[in] log_levels The structure holding the logger settings.
+ * \param[in] logger_name The fully qualified logger name to resolve.
+ * \param[out] level The resolved severity.
+ * \return #RCL_RET_OK if the severity was resolved, or
+ * \return #RCL_RET_INVALID_ARGUMENT if any arguments are NULL.
+ */
+RCL_PUBLIC
+rcl_ret_t
+rcl_log_levels_resolve(
+  const rcl_log_levels_t * log_levels, const char * logger_name, rcl_log_severity_t * level);
+
 #ifdef __cplusplus
 }
 #endif
@@ -17,6 +17,8 @@
 #ifndef RCL__LOGGING_ROSOUT_H_
 #define RCL__LOGGING_ROSOUT_H_
 
+#include <stdint.h>
+
 #include "rcl/allocator.h"
 #include "rcl/error_handling.h"
 #include "rcl/node.h"
@@ -28,6 +30,18 @@ extern "C"
 {
 #endif
 
+/// The initial capacity in bytes of the reusable rosout message buffer.
+/**
+ * rcl_logging_rosout_init() preallocates one message buffer of this size that
+ * is reused for every published log message.
+ * The buffer grows on demand if a formatted message exceeds it and keeps its
+ * grown capacity, so steady-state logging does not allocate.
+ * May be overridden at compile time to tune the preallocation.
+ */
+#ifndef RCL_LOGGING_ROSOUT_DEFAULT_MSG_BUFFER_SIZE
+#define RCL_LOGGING_ROSOUT_DEFAULT_MSG_BUFFER_SIZE 1024
+#endif
+
 /// The default qos profile setting for topic /rosout
 /**
  * - depth = 1000
@@ -188,6 +202,269 @@ rcl_logging_rosout_output_handler(
   const char * format,
   va_list * args);
 
+/// The rosout output handler for messages that are already formatted.
+/**
+ * Behaves like rcl_logging_rosout_output_handler() but takes the final log
+ * message instead of a format string and arguments.
+ * This lets a dispatcher that formatted the record once share the same buffer
+ * with every sink; the message is referenced, not copied, for the duration of
+ * the synchronous publish.
+ *
+ * <hr>
+ * Attribute          | Adherence
+ * ------------------ | -------------
+ * Allocates Memory   | No
+ * Thread-Safe        | No
+ * Uses Atomics       | No
+ * Lock-Free          | Yes
+ *
+ * \param[in] location The pointer to the location struct or NULL
+ * \param[in] severity The severity level
+ * \param[in] name The name of the logger, must be null terminated c string
+ * \param[in] timestamp The timestamp for when the log message was made
+ * \param[in] msg The formatted log message, must be null terminated c string
+ */
+RCL_PUBLIC
+void
+rcl_logging_rosout_output_handler_preformatted(
+  const rcutils_log_location_t * location,
+  int severity,
+  const char * name,
+  rcutils_time_point_value_t timestamp,
+  const char * msg);
+
+struct rcl_logging_rosout_logger_handle_s;
+
+/// A caller-retained handle caching the resolved rosout publisher for a
+/// logger name.
+typedef struct rcl_logging_rosout_logger_handle_s rcl_logging_rosout_logger_handle_t;
+
+/// Borrow a handle for a logger name.
+/**
+ * The handle caches the publisher entry resolved for the logger name, so
+ * publishing through rcl_logging_rosout_output_handler_with_handle() is a
+ * pointer chase instead of a hash map lookup per message.
+ * The cached entry is revalidated transparently whenever publishers are
+ * added or removed, so the handle may be borrowed before the logger has a
+ * rosout publisher and stays valid across publisher churn.
+ * Every borrowed handle must be given back with
+ * rcl_logging_rosout_return_logger_handle() before the program ends.
+ *
+ * <hr>
+ * Attribute          | Adherence
+ * ------------------ | -------------
+ * Allocates Memory   | Yes
+ * Thread-Safe        | No
+ * Uses Atomics       | No
+ * Lock-Free          | Yes
+ *
+ * \param[in] logger_name The logger name to resolve, copied into the handle
+ * \param[out] logger_handle The borrowed handle
+ * \return #RCL_RET_OK if the handle was borrowed, or
+ * \return #RCL_RET_INVALID_ARGUMENT if any arguments are invalid, or
+ * \return #RCL_RET_NOT_INIT if rcl_logging_rosout_init() was not called, or
+ * \return #RCL_RET_BAD_ALLOC if allocating memory failed.
+ */
+RCL_PUBLIC
+RCL_WARN_UNUSED
+rcl_ret_t
+rcl_logging_rosout_borrow_logger_handle(
+  const char * logger_name, rcl_logging_rosout_logger_handle_t ** logger_handle);
+
+/// Return a handle borrowed with rcl_logging_rosout_borrow_logger_handle().
+/**
+ * <hr>
+ * Attribute          | Adherence
+ * ------------------ | -------------
+ * Allocates Memory   | No
+ * Thread-Safe        | No
+ * Uses Atomics       | No
+ * Lock-Free          | Yes
+ *
+ * \param[in] logger_handle The handle to give back
+ * \return #RCL_RET_OK if the handle was returned, or
+ * \return #RCL_RET_INVALID_ARGUMENT if logger_handle is NULL.
+ */
+RCL_PUBLIC
+RCL_WARN_UNUSED
+rcl_ret_t
+rcl_logging_rosout_return_logger_handle(
+  rcl_logging_rosout_logger_handle_t * logger_handle);
+
+/// Publish a log message through a borrowed logger handle.
+/**
+ * Behaves like rcl_logging_rosout_output_handler() for the handle's logger
+ * name, but skips the publisher lookup when the cached entry is still valid.
+ *
+ * <hr>
+ * Attribute          | Adherence
+ * ------------------ | -------------
+ * Allocates Memory   | Yes
+ * Thread-Safe        | No
+ * Uses Atomics       | No
+ * Lock-Free          | Yes
+ *
+ * \param[in] logger_handle The handle whose logger the message is from
+ * \param[in] location The pointer to the location struct or NULL
+ * \param[in] severity The severity level
+ * \param[in] timestamp The timestamp for when the log message was made
+ * \param[in] format The format string of the log message
+ * \param[in] args argument for the string format
+ */
+RCL_PUBLIC
+void
+rcl_logging_rosout_output_handler_with_handle(
+  rcl_logging_rosout_logger_handle_t * logger_handle,
+  const rcutils_log_location_t * location,
+  int severity,
+  rcutils_time_point_value_t timestamp,
+  const char * format,
+  va_list * args);
+
+/// Policy applied when the asynchronous rosout ring is full.
+typedef enum rcl_logging_rosout_drop_policy_e
+{
+  /// Drop the record being enqueued; already queued records are kept.
+  RCL_LOGGING_ROSOUT_DROP_NEWEST = 0,
+  /// Discard the oldest queued record to make room for the new one.
+  RCL_LOGGING_ROSOUT_DROP_OLDEST = 1,
+} rcl_logging_rosout_drop_policy_t;
+
+/// Enable asynchronous rosout publishing.
+/**
+ * When asynchronous publishing is enabled the output handler no longer calls
+ * rcl_publish() on the caller's thread.
+ * Instead each log record is formatted into a slot of a preallocated bounded
+ * lock-free ring and published later by rcl_logging_rosout_flush(), which is
+ * expected to be driven from a dedicated thread owned by the client library.
+ * When the ring is full new records are dropped and counted; the count can be
+ * read with rcl_logging_rosout_get_num_dropped_messages().
+ * Strings longer than the slot buffers are truncated.
+ *
+ * Enqueueing records is lock-free and safe to call from multiple threads
+ * concurrently, but enabling, disabling, and flushing are not thread-safe
+ * with respect to each other.
+ *
+ * <hr>
+ * Attribute          | Adherence
+ * ------------------ | -------------
+ * Allocates Memory   | Yes
+ * Thread-Safe        | No
+ * Uses Atomics       | Yes
+ * Lock-Free          | Yes
+ *
+ * \param[in] queue_depth The number of log records the ring can hold, rounded
+ *   up to the next power of two; must be greater than zero
+ * \return #RCL_RET_OK if asynchronous publishing was enabled, or
+ * \return #RCL_RET_NOT_INIT if rcl_logging_rosout_init() was not called, or
+ * \return #RCL_RET_INVALID_ARGUMENT if queue_depth is zero, or
+ * \return #RCL_RET_BAD_ALLOC if allocating the ring failed.
+ */
+RCL_PUBLIC
+RCL_WARN_UNUSED
+rcl_ret_t
+rcl_logging_rosout_enable_async_publishing(size_t queue_depth);
+
+/// Enable asynchronous rosout publishing with an explicit drop policy.
+/**
+ * Behaves like rcl_logging_rosout_enable_async_publishing(), which uses
+ * #RCL_LOGGING_ROSOUT_DROP_NEWEST, but lets the caller choose what happens
+ * when a burst fills the ring.
+ * With #RCL_LOGGING_ROSOUT_DROP_OLDEST a full producer discards the oldest
+ * queued record and retries, so the most recent records survive a burst;
+ * discarded records are counted by
+ * rcl_logging_rosout_get_num_dropped_messages() either way.
+ *
+ * <hr>
+ * Attribute          | Adherence
+ * ------------------ | -------------
+ * Allocates Memory   | Yes
+ * Thread-Safe        | No
+ * Uses Atomics       | Yes
+ * Lock-Free          | Yes
+ *
+ * \param[in] queue_depth The number of log records the ring can hold, rounded
+ *   up to the next power of two; must be greater than zero
+ * \param[in] drop_policy Which record to drop when the ring is full
+ * \return #RCL_RET_OK if asynchronous publishing was enabled, or
+ * \return #RCL_RET_NOT_INIT if rcl_logging_rosout_init() was not called, or
+ * \return #RCL_RET_INVALID_ARGUMENT if queue_depth is zero or drop_policy is
+ *   not a known policy, or
+ * \return #RCL_RET_BAD_ALLOC if allocating the ring failed.
+ */
+RCL_PUBLIC
+RCL_WARN_UNUSED
+rcl_ret_t
+rcl_logging_rosout_enable_async_publishing_with_policy(
+  size_t queue_depth, rcl_logging_rosout_drop_policy_t drop_policy);
+
+/// Disable asynchronous rosout publishing.
+/**
+ * Pending log records are flushed before the ring is deallocated, and
+ * subsequent log calls publish synchronously again.
+ * Does nothing if asynchronous publishing is not enabled.
+ *
+ * <hr>
+ * Attribute          | Adherence
+ * ------------------ | -------------
+ * Allocates Memory   | No
+ * Thread-Safe        | No
+ * Uses Atomics       | Yes
+ * Lock-Free          | Yes
+ *
+ * \return #RCL_RET_OK if asynchronous publishing was disabled, or
+ * \return #RCL_RET_ERROR if an unspecified error occurs.
+ */
+RCL_PUBLIC
+RCL_WARN_UNUSED
+rcl_ret_t
+rcl_logging_rosout_disable_async_publishing(void);
+
+/// Publish log records queued by asynchronous rosout publishing.
+/**
+ * Drains up to max_messages records from the ring, publishing each one on the
+ * rosout publisher registered for its logger name; records whose logger no
+ * longer has a publisher are discarded.
+ * Only one thread may flush at a time.
+ * Does nothing if asynchronous publishing is not enabled.
+ *
+ * <hr>
+ * Attribute          | Adherence
+ * ------------------ | -------------
+ * Allocates Memory   | No
+ * Thread-Safe        | No
+ * Uses Atomics       | Yes
+ * Lock-Free          | Yes
+ *
+ * \param[in] max_messages The maximum number of records to publish, or 0 to
+ *   drain every queued record
+ * \param[out] num_published The number of records taken from the ring, or NULL
+ * \return #RCL_RET_OK if the queued records were published.
+ */
+RCL_PUBLIC
+RCL_WARN_UNUSED
+rcl_ret_t
+rcl_logging_rosout_flush(size_t max_messages, size_t * num_published);
+
+/// Return the number of log records dropped because the ring was full.
+/**
+ * The counter is reset when asynchronous publishing is enabled.
+ *
+ * <hr>
+ * Attribute          | Adherence
+ * ------------------ | -------------
+ * Allocates Memory   | No
+ * Thread-Safe        | Yes
+ * Uses Atomics       | Yes
+ * Lock-Free          | Yes
+ *
+ * \return the number of dropped log records since asynchronous publishing
+ *   was enabled, or 0 if it is not enabled.
+ */
+RCL_PUBLIC
+uint64_t
+rcl_logging_rosout_get_num_dropped_messages(void);
+
 /// Add a subordinate logger based on a logger
 /**
  * Calling this will use the existing publisher of `logger_name` on a node to create an subordinate
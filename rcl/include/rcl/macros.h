@@ -27,6 +27,38 @@ extern "C"
 
 #define RCL_UNUSED(x) RCUTILS_UNUSED(x)
 
+/// Hint that a condition is almost always true or false, respectively.
+/**
+ * Used on the failure branches of argument validation in hot functions so
+ * the compiler lays the error handling out off the fall-through path.
+ */
+#if defined(__GNUC__) || defined(__clang__)
+# define RCL_LIKELY(condition) __builtin_expect((condition), 1)
+# define RCL_UNLIKELY(condition) __builtin_expect((condition), 0)
+#else
+# define RCL_LIKELY(condition) (condition)
+# define RCL_UNLIKELY(condition) (condition)
+#endif
+
+/// Ask the compiler to always inline a small hot helper function.
+#if defined(__GNUC__) || defined(__clang__)
+# define RCL_ALWAYS_INLINE inline __attribute__((always_inline))
+#else
+# define RCL_ALWAYS_INLINE inline
+#endif
+
+/// Assumed cache line size, used to separate hot mutable fields from cold
+/// configuration in the impl structs so concurrent readers and writers do
+/// not false-share lines.
+#define RCL_CACHE_LINE_SIZE 64
+
+/// Align a struct member to a given boundary.
+#if defined(_MSC_VER)
+# define RCL_ALIGNAS(alignment) __declspec(align(alignment))
+#else
+# define RCL_ALIGNAS(alignment) _Alignas(alignment)
+#endif
+
 #ifdef __cplusplus
 }
 #endif
@@ -88,6 +88,76 @@ rcl_publisher_get_network_flow_endpoints(
   rcutils_allocator_t * allocator,
   rcl_network_flow_endpoint_array_t * network_flow_endpoint_array);
 
+/// Refresh the cached network flow endpoints of a publisher
+/**
+ * Re-queries the underlying middleware and replaces the publisher's cached
+ * network flow endpoint view, using the publisher's allocator.
+ * Intended to be called when a QoS event (e.g. liveliness or deadline, see
+ * rcl_publisher_event_init()) indicates transport behavior may have changed;
+ * between refreshes, rcl_publisher_get_cached_network_flow_endpoints()
+ * serves the view without touching the middleware or allocating.
+ *
+ * The cache is released by rcl_publisher_fini().
+ *
+ * <hr>
+ * Attribute          | Adherence
+ * ------------------ | -------------
+ * Allocates Memory   | Yes
+ * Thread-Safe        | No
+ * Uses Atomics       | No
+ * Lock-Free          | Maybe [1]
+ * <i>[1] implementation may need to protect the data structure with a lock</i>
+ *
+ * \param[in] publisher the publisher whose cached view should be refreshed
+ * \return `RCL_RET_OK` if successful, or
+ * \return `RCL_RET_INVALID_ARGUMENT` if the publisher is invalid, or
+ * \return `RCL_RET_BAD_ALLOC` if memory allocation fails, or
+ * \return `RCL_RET_UNSUPPORTED` if not supported, or
+ * \return `RCL_RET_ERROR` if an unexpected error occurs.
+ */
+RCL_PUBLIC
+RCL_WARN_UNUSED
+rcl_ret_t
+rcl_publisher_refresh_network_flow_endpoints(
+  const rcl_publisher_t * publisher);
+
+/// Get a borrowed view of a publisher's cached network flow endpoints
+/**
+ * Returns a pointer to the publisher-owned cached endpoint array, querying
+ * the middleware only if no cached view exists yet.
+ * Subsequent calls are allocation-free reads until
+ * rcl_publisher_refresh_network_flow_endpoints() is called, making this
+ * suitable for periodic polling across many publishers.
+ *
+ * The returned array is owned by the publisher: the caller must not pass it
+ * to `rcl_network_flow_endpoint_array_fini` and the pointer is invalidated
+ * by a refresh or by rcl_publisher_fini().
+ *
+ * <hr>
+ * Attribute          | Adherence
+ * ------------------ | -------------
+ * Allocates Memory   | No [1]
+ * Thread-Safe        | No
+ * Uses Atomics       | No
+ * Lock-Free          | Maybe [2]
+ * <i>[1] except on the first call, which populates the cache</i>
+ * <i>[2] implementation may need to protect the data structure with a lock</i>
+ *
+ * \param[in] publisher the publisher instance to inspect
+ * \param[out] network_flow_endpoint_array set to the cached endpoint view
+ * \return `RCL_RET_OK` if successful, or
+ * \return `RCL_RET_INVALID_ARGUMENT` if any argument is null, or
+ * \return `RCL_RET_BAD_ALLOC` if memory allocation fails, or
+ * \return `RCL_RET_UNSUPPORTED` if not supported, or
+ * \return `RCL_RET_ERROR` if an unexpected error occurs.
+ */
+RCL_PUBLIC
+RCL_WARN_UNUSED
+rcl_ret_t
+rcl_publisher_get_cached_network_flow_endpoints(
+  const rcl_publisher_t * publisher,
+  const rcl_network_flow_endpoint_array_t ** network_flow_endpoint_array);
+
 /// Get network flow endpoints of a subscription
 /**
  * Query the underlying middleware for a given subscription's network flow endpoints
@@ -129,6 +199,89 @@ rcl_subscription_get_network_flow_endpoints(
   rcutils_allocator_t * allocator,
   rcl_network_flow_endpoint_array_t * network_flow_endpoint_array);
 
+/// Refresh the cached network flow endpoints of a subscription
+/**
+ * Subscription-side counterpart of
+ * rcl_publisher_refresh_network_flow_endpoints(); see there for the
+ * semantics and attributes. The cache is released by
+ * rcl_subscription_fini().
+ *
+ * \param[in] subscription the subscription whose cached view should be refreshed
+ * \return `RCL_RET_OK` if successful, or
+ * \return `RCL_RET_INVALID_ARGUMENT` if the subscription is invalid, or
+ * \return `RCL_RET_BAD_ALLOC` if memory allocation fails, or
+ * \return `RCL_RET_UNSUPPORTED` if not supported, or
+ * \return `RCL_RET_ERROR` if an unexpected error occurs.
+ */
+RCL_PUBLIC
+RCL_WARN_UNUSED
+rcl_ret_t
+rcl_subscription_refresh_network_flow_endpoints(
+  const rcl_subscription_t * subscription);
+
+/// Get a borrowed view of a subscription's cached network flow endpoints
+/**
+ * Subscription-side counterpart of
+ * rcl_publisher_get_cached_network_flow_endpoints(); see there for the
+ * ownership rules and attributes.
+ * The cache is re-queried automatically when a taken matched QoS event has
+ * marked it stale, so polling this getter between events is allocation-free.
+ *
+ * \param[in] subscription the subscription instance to inspect
+ * \param[out] network_flow_endpoint_array set to the cached endpoint view
+ * \return `RCL_RET_OK` if successful, or
+ * \return `RCL_RET_INVALID_ARGUMENT` if any argument is null, or
+ * \return `RCL_RET_BAD_ALLOC` if memory allocation fails, or
+ * \return `RCL_RET_UNSUPPORTED` if not supported, or
+ * \return `RCL_RET_ERROR` if an unexpected error occurs.
+ */
+RCL_PUBLIC
+RCL_WARN_UNUSED
+rcl_ret_t
+rcl_subscription_get_cached_network_flow_endpoints(
+  const rcl_subscription_t * subscription,
+  const rcl_network_flow_endpoint_array_t ** network_flow_endpoint_array);
+
+/// Compute the difference between two network flow endpoint arrays
+/**
+ * Fills `added` with the endpoints present in `current` but not in
+ * `previous`, and `removed` with those present in `previous` but not in
+ * `current`, so monitors polling many entities only have to process
+ * endpoints that actually changed.
+ *
+ * The `added` and `removed` arguments must be allocated and
+ * zero-initialized; arrays left empty stay zero-initialized, which is
+ * safe to pass to `rcl_network_flow_endpoint_array_fini`, as the caller
+ * must do with both outputs when done.
+ *
+ * <hr>
+ * Attribute          | Adherence
+ * ------------------ | -------------
+ * Allocates Memory   | Yes
+ * Thread-Safe        | Yes
+ * Uses Atomics       | No
+ * Lock-Free          | Yes
+ *
+ * \param[in] previous the earlier endpoint view
+ * \param[in] current the newer endpoint view
+ * \param[in] allocator allocator used for the output arrays
+ * \param[out] added endpoints only present in `current`
+ * \param[out] removed endpoints only present in `previous`
+ * \return `RCL_RET_OK` if successful, or
+ * \return `RCL_RET_INVALID_ARGUMENT` if any argument is null, or
+ * \return `RCL_RET_BAD_ALLOC` if memory allocation fails, or
+ * \return `RCL_RET_ERROR` if an unexpected error occurs.
+ */
+RCL_PUBLIC
+RCL_WARN_UNUSED
+rcl_ret_t
+rcl_network_flow_endpoint_array_diff(
+  const rcl_network_flow_endpoint_array_t * previous,
+  const rcl_network_flow_endpoint_array_t * current,
+  rcutils_allocator_t * allocator,
+  rcl_network_flow_endpoint_array_t * added,
+  rcl_network_flow_endpoint_array_t * removed);
+
 #ifdef __cplusplus
 }
 #endif
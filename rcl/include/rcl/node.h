@@ -153,6 +153,65 @@ rcl_node_init(
   rcl_context_t * context,
   const rcl_node_options_t * options);
 
+/// Initialize several ROS nodes at once.
+/**
+ * This behaves like calling rcl_node_init() on each node in order, with the
+ * work shared by all nodes done only once up front: the rmw context is
+ * created before the first node when its creation was deferred, see
+ * rcl_init_options_set_defer_rmw_init().
+ * All nodes are initialized in the given context and share the given options;
+ * the options are deep copied into each node.
+ *
+ * Either every node is initialized or none is: if initializing one node
+ * fails, the nodes initialized so far are finalized again and the error of
+ * the node that failed is returned.
+ *
+ * This is intended for containers which load many components at once, where
+ * the per call overhead of setting the nodes up one by one adds up.
+ *
+ * <hr>
+ * Attribute          | Adherence
+ * ------------------ | -------------
+ * Allocates Memory   | Yes
+ * Thread-Safe        | No
+ * Uses Atomics       | Yes
+ * Lock-Free          | Yes [1]
+ * <i>[1] if `atomic_is_lock_free()` returns true for `atomic_uint_least64_t`</i>
+ *
+ * \pre every node handle must be allocated, zero initialized, and invalid
+ * \pre the context handle must be allocated, initialized, and valid
+ * \post every node handle is valid and can be used in other `rcl_*` functions
+ *
+ * \param[inout] nodes array of `count` preallocated rcl_node_t pointers
+ * \param[in] names array of `count` node names, each must be a valid c-string
+ * \param[in] namespaces array of `count` node namespaces, each must be a
+ *   valid c-string
+ * \param[in] count number of nodes to initialize, may be `0`
+ * \param[in] context the context instance with which the nodes should be
+ *   associated
+ * \param[in] options the node options used for every node.
+ *   The caller is always responsible for freeing memory used options they
+ *   pass in.
+ * \return #RCL_RET_OK if all nodes were initialized successfully, or
+ * \return #RCL_RET_ALREADY_INIT if a node has already be initialized, or
+ * \return #RCL_RET_NOT_INIT if the given context is not initialized, or
+ * \return #RCL_RET_INVALID_ARGUMENT if any arguments are invalid or context is NULL, or
+ * \return #RCL_RET_BAD_ALLOC if allocating memory failed, or
+ * \return #RCL_RET_NODE_INVALID_NAME if a name is invalid, or
+ * \return #RCL_RET_NODE_INVALID_NAMESPACE if a namespace is invalid, or
+ * \return #RCL_RET_ERROR if an unspecified error occurs.
+ */
+RCL_PUBLIC
+RCL_WARN_UNUSED
+rcl_ret_t
+rcl_node_init_batch(
+  rcl_node_t ** nodes,
+  const char * const * names,
+  const char * const * namespaces,
+  size_t count,
+  rcl_context_t * context,
+  const rcl_node_options_t * options);
+
 /// Finalize a rcl_node_t.
 /**
  * Destroys any automatically created infrastructure and deallocates memory.
@@ -185,6 +244,44 @@ RCL_WARN_UNUSED
 rcl_ret_t
 rcl_node_fini(rcl_node_t * node);
 
+/// Finalize several nodes in one call.
+/**
+ * Finalizes the given nodes with rcl_node_fini() in reverse array order, the
+ * teardown counterpart of rcl_node_init_batch().
+ *
+ * Unlike calling rcl_node_fini() in a loop and stopping at the first failure,
+ * this continues past failing nodes so one stubborn teardown does not leak the
+ * remaining nodes.
+ * The error of the first failing node is preserved and returned; failures of
+ * later nodes are logged and their errors reset.
+ *
+ * Zero initialized or already finalized nodes in the array are skipped, as
+ * with rcl_node_fini().
+ * As with rcl_node_fini(), all middleware primitives created from these nodes
+ * must be finalized before this is called, and the nodes must be finalized
+ * before their context.
+ *
+ * <hr>
+ * Attribute          | Adherence
+ * ------------------ | -------------
+ * Allocates Memory   | Yes
+ * Thread-Safe        | No
+ * Uses Atomics       | Yes
+ * Lock-Free          | Yes [1]
+ * <i>[1] if `atomic_is_lock_free()` returns true for `atomic_uint_least64_t`</i>
+ *
+ * \param[in] nodes array of `count` pointers to nodes to be finalized
+ * \param[in] count number of nodes in the `nodes` array
+ * \return #RCL_RET_OK if all nodes were finalized successfully, or
+ * \return #RCL_RET_INVALID_ARGUMENT if `nodes` is null, or
+ * \return #RCL_RET_NODE_INVALID if a node pointer in the array is null, or
+ * \return #RCL_RET_ERROR if an unspecified error occurs.
+ */
+RCL_PUBLIC
+RCL_WARN_UNUSED
+rcl_ret_t
+rcl_node_fini_batch(rcl_node_t ** nodes, size_t count);
+
 /// Return `true` if the node is valid, else `false`.
 /**
  * Also return `false` if the node pointer is `NULL` or the allocator is invalid.
@@ -437,9 +534,12 @@ rcl_node_get_rcl_instance_id(const rcl_node_t * node);
 /// Return a guard condition which is triggered when the ROS graph changes.
 /**
  * The handle returned is a pointer to an internally held rcl guard condition.
+ * The guard condition is created on the first call for a given node; nodes
+ * which never watch the graph do not pay for it.
  * This function can fail, and therefore return `NULL`, if:
  *   - node is `NULL`
  *   - node is invalid
+ *   - creating the guard condition fails on the first call
  *
  * The returned handle is made invalid if the node is finialized or if
  * rcl_shutdown() is called.
@@ -454,10 +554,11 @@ rcl_node_get_rcl_instance_id(const rcl_node_t * node);
  * <hr>
  * Attribute          | Adherence
  * ------------------ | -------------
- * Allocates Memory   | No
+ * Allocates Memory   | Yes [1]
  * Thread-Safe        | No
  * Uses Atomics       | No
  * Lock-Free          | Yes
+ * <i>[1] only on the first call for a given node</i>
  *
  * \param[in] node pointer to the rcl node
  * \return rcl guard condition handle if successful, otherwise `NULL`
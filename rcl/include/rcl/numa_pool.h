@@ -0,0 +1,146 @@
+// Copyright 2026 Open Source Robotics Foundation, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/// @file
+
+#ifndef RCL__NUMA_POOL_H_
+#define RCL__NUMA_POOL_H_
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+#include <stddef.h>
+
+#include "rcl/allocator.h"
+#include "rcl/macros.h"
+#include "rcl/types.h"
+#include "rcl/visibility_control.h"
+
+typedef struct rcl_numa_pool_impl_s rcl_numa_pool_impl_t;
+
+/// A node-bound arena pool serving an rcl_allocator_t interface.
+/**
+ * The pool carves all allocations out of one arena whose pages are
+ * committed at initialization time from the calling thread, so under the
+ * operating system's first-touch placement policy the whole arena lands on
+ * the NUMA node of the initializing thread.
+ * Pin the initializing thread to the cores that will consume the storage
+ * before calling rcl_numa_pool_init(), then assign the pool's allocator to
+ * an allocation domain with rcl_init_options_set_domain_allocator(); entity
+ * storage in that domain is then local to the consuming socket.
+ *
+ * Allocation is first-fit over an address-ordered free list with
+ * coalescing on free; the pool never grows, so a full pool fails
+ * allocations rather than spilling onto a remote node.
+ *
+ * The pool itself is not thread-safe; dedicate one pool per pinned
+ * consumer domain, matching how the placement only makes sense per node
+ * anyway.
+ */
+typedef struct rcl_numa_pool_s
+{
+  /// Private implementation pointer.
+  rcl_numa_pool_impl_t * impl;
+} rcl_numa_pool_t;
+
+/// Return a rcl_numa_pool_t struct with members initialized to `NULL`.
+RCL_PUBLIC
+RCL_WARN_UNUSED
+rcl_numa_pool_t
+rcl_get_zero_initialized_numa_pool(void);
+
+/// Initialize a node-bound pool, committing its arena from this thread.
+/**
+ * Every page of the arena is touched before this returns, so call it from
+ * a thread already pinned to the target NUMA node.
+ *
+ * <hr>
+ * Attribute          | Adherence
+ * ------------------ | -------------
+ * Allocates Memory   | Yes
+ * Thread-Safe        | No
+ * Uses Atomics       | No
+ * Lock-Free          | Yes
+ *
+ * \param[inout] pool a zero initialized pool to be initialized
+ * \param[in] capacity the arena size in bytes, must be greater than zero
+ * \param[in] backing_allocator the allocator the arena is taken from
+ * \return #RCL_RET_OK if the pool was initialized successfully, or
+ * \return #RCL_RET_ALREADY_INIT if the pool is already initialized, or
+ * \return #RCL_RET_INVALID_ARGUMENT if any arguments are invalid, or
+ * \return #RCL_RET_BAD_ALLOC if allocating the arena failed.
+ */
+RCL_PUBLIC
+RCL_WARN_UNUSED
+rcl_ret_t
+rcl_numa_pool_init(
+  rcl_numa_pool_t * pool,
+  size_t capacity,
+  rcl_allocator_t backing_allocator);
+
+/// Finalize a pool, releasing its arena.
+/**
+ * Storage handed out by the pool's allocator becomes invalid; finalize
+ * every entity using the pool first.
+ *
+ * \param[inout] pool the pool to finalize
+ * \return #RCL_RET_OK if the pool was finalized, or
+ * \return #RCL_RET_INVALID_ARGUMENT if pool is null.
+ */
+RCL_PUBLIC
+RCL_WARN_UNUSED
+rcl_ret_t
+rcl_numa_pool_fini(rcl_numa_pool_t * pool);
+
+/// Return an allocator backed by the pool's arena.
+/**
+ * The returned allocator's state points into the pool, so the pool must
+ * outlive every allocation made through it.
+ * An invalid pool yields a zero initialized allocator.
+ *
+ * \param[in] pool the pool backing the allocator
+ * \return an rcl allocator carving from the pool's arena.
+ */
+RCL_PUBLIC
+RCL_WARN_UNUSED
+rcl_allocator_t
+rcl_numa_pool_get_allocator(const rcl_numa_pool_t * pool);
+
+/// Get the pool's current usage in bytes.
+/**
+ * `used` counts the bytes currently allocated including the per-block
+ * bookkeeping headers, so it reaches `capacity` when the pool is full.
+ *
+ * \param[in] pool the pool to query
+ * \param[out] used set to the bytes currently in use
+ * \param[out] capacity set to the arena size in bytes
+ * \return #RCL_RET_OK if the counters were read, or
+ * \return #RCL_RET_INVALID_ARGUMENT if any arguments are invalid, or
+ * \return #RCL_RET_NOT_INIT if the pool is zero initialized.
+ */
+RCL_PUBLIC
+RCL_WARN_UNUSED
+rcl_ret_t
+rcl_numa_pool_get_usage(
+  const rcl_numa_pool_t * pool,
+  size_t * used,
+  size_t * capacity);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif  // RCL__NUMA_POOL_H_
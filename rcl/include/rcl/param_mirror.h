@@ -0,0 +1,277 @@
+// Copyright 2026 Open Source Robotics Foundation, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/// @file
+
+#ifndef RCL__PARAM_MIRROR_H_
+#define RCL__PARAM_MIRROR_H_
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#include "rcl/allocator.h"
+#include "rcl/macros.h"
+#include "rcl/types.h"
+#include "rcl/visibility_control.h"
+
+#include "rcl_yaml_param_parser/types.h"
+
+/// Capacity of the node and parameter name fields of a mirror entry.
+#define RCL_PARAM_MIRROR_NAME_CAPACITY 128
+/// Capacity of a mirrored string value, including the terminator.
+#define RCL_PARAM_MIRROR_STRING_CAPACITY 128
+
+typedef struct rcl_param_mirror_impl_s rcl_param_mirror_impl_t;
+typedef struct rcl_param_mirror_reader_impl_s rcl_param_mirror_reader_impl_t;
+
+/// Value types representable in a parameter mirror entry.
+typedef enum rcl_param_mirror_type_e
+{
+  RCL_PARAM_MIRROR_TYPE_NOT_SET = 0,
+  RCL_PARAM_MIRROR_TYPE_BOOL = 1,
+  RCL_PARAM_MIRROR_TYPE_INTEGER = 2,
+  RCL_PARAM_MIRROR_TYPE_DOUBLE = 3,
+  RCL_PARAM_MIRROR_TYPE_STRING = 4,
+} rcl_param_mirror_type_t;
+
+/// One value read out of a parameter mirror.
+/**
+ * Only the field selected by `type` is meaningful; strings are copied out
+ * so the value stays valid after the segment changes.
+ */
+typedef struct rcl_param_mirror_value_s
+{
+  rcl_param_mirror_type_t type;
+  bool bool_value;
+  int64_t integer_value;
+  double double_value;
+  char string_value[RCL_PARAM_MIRROR_STRING_CAPACITY];
+} rcl_param_mirror_value_t;
+
+/// Writer side of a shared-memory parameter mirror.
+/**
+ * The mirror publishes a process's resolved parameters (an rcl_params_t)
+ * into a named shared-memory segment that co-located processes map
+ * read-only with rcl_param_mirror_reader_t, turning cross-process
+ * parameter polling from service round trips into plain memory reads.
+ *
+ * Each parameter occupies one fixed-size entry guarded by its own seqlock,
+ * so value refreshes never block readers and a reader of one parameter
+ * never retries because an unrelated one changed; a segment-wide
+ * generation seqlock guards structural rewrites (parameters added or
+ * removed).
+ * The segment carries a magic number and layout version, and readers
+ * refuse segments from a different layout.
+ *
+ * Scalar and string parameters are mirrored; array parameters and names
+ * or strings exceeding the fixed capacities are not representable and
+ * cause initialization to fail, keeping the mapping unambiguous.
+ * Only available on platforms with POSIX shared memory; elsewhere every
+ * function returns RCL_RET_UNSUPPORTED.
+ */
+typedef struct rcl_param_mirror_s
+{
+  /// Private implementation pointer.
+  rcl_param_mirror_impl_t * impl;
+} rcl_param_mirror_t;
+
+/// Reader side of a shared-memory parameter mirror.
+typedef struct rcl_param_mirror_reader_s
+{
+  /// Private implementation pointer.
+  rcl_param_mirror_reader_impl_t * impl;
+} rcl_param_mirror_reader_t;
+
+/// Return a rcl_param_mirror_t struct with members initialized to `NULL`.
+RCL_PUBLIC
+RCL_WARN_UNUSED
+rcl_param_mirror_t
+rcl_get_zero_initialized_param_mirror(void);
+
+/// Return a rcl_param_mirror_reader_t struct with members set to `NULL`.
+RCL_PUBLIC
+RCL_WARN_UNUSED
+rcl_param_mirror_reader_t
+rcl_get_zero_initialized_param_mirror_reader(void);
+
+/// Create a mirror segment and publish the given parameters into it.
+/**
+ * `segment_name` names the shared-memory segment and must start with a
+ * slash, e.g. `/my_process_params`; an existing segment of that name is
+ * replaced.
+ * The entry capacity is fixed at the number of parameters in `params`, so
+ * later updates may change values and types but not add parameters beyond
+ * that count.
+ *
+ * <hr>
+ * Attribute          | Adherence
+ * ------------------ | -------------
+ * Allocates Memory   | Yes
+ * Thread-Safe        | No
+ * Uses Atomics       | Yes
+ * Lock-Free          | Yes
+ *
+ * \param[inout] mirror a zero initialized mirror to be initialized
+ * \param[in] segment_name name of the shared-memory segment
+ * \param[in] params the resolved parameters to publish
+ * \param[in] allocator the allocator for the writer bookkeeping
+ * \return #RCL_RET_OK if the mirror was created, or
+ * \return #RCL_RET_ALREADY_INIT if the mirror is already initialized, or
+ * \return #RCL_RET_INVALID_ARGUMENT if any arguments are invalid or a
+ *   parameter is not representable in the mirror layout, or
+ * \return #RCL_RET_BAD_ALLOC if allocating memory failed, or
+ * \return #RCL_RET_UNSUPPORTED on platforms without POSIX shared memory, or
+ * \return #RCL_RET_ERROR if creating or mapping the segment failed.
+ */
+RCL_PUBLIC
+RCL_WARN_UNUSED
+rcl_ret_t
+rcl_param_mirror_init(
+  rcl_param_mirror_t * mirror,
+  const char * segment_name,
+  const rcl_params_t * params,
+  rcl_allocator_t allocator);
+
+/// Publish a new parameter snapshot into the mirror.
+/**
+ * When the parameter set's structure (names and order) is unchanged, only
+ * entries whose value differs are rewritten, each under its own seqlock;
+ * a structural change rewrites the whole table under the generation
+ * seqlock instead.
+ *
+ * <hr>
+ * Attribute          | Adherence
+ * ------------------ | -------------
+ * Allocates Memory   | No
+ * Thread-Safe        | No
+ * Uses Atomics       | Yes
+ * Lock-Free          | Yes
+ *
+ * \param[in] mirror the mirror to update
+ * \param[in] params the new resolved parameters
+ * \return #RCL_RET_OK if the snapshot was published, or
+ * \return #RCL_RET_INVALID_ARGUMENT if any arguments are invalid, a
+ *   parameter is not representable, or the parameter count exceeds the
+ *   segment's capacity, or
+ * \return #RCL_RET_NOT_INIT if the mirror is zero initialized, or
+ * \return #RCL_RET_UNSUPPORTED on platforms without POSIX shared memory.
+ */
+RCL_PUBLIC
+RCL_WARN_UNUSED
+rcl_ret_t
+rcl_param_mirror_update(
+  rcl_param_mirror_t * mirror,
+  const rcl_params_t * params);
+
+/// Destroy the mirror, unmapping and unlinking its segment.
+/**
+ * Readers holding a mapping keep reading the last published snapshot
+ * until they close; new opens of the name fail once unlinked.
+ *
+ * \param[inout] mirror the mirror to finalize
+ * \return #RCL_RET_OK if the mirror was finalized, or
+ * \return #RCL_RET_INVALID_ARGUMENT if mirror is null, or
+ * \return #RCL_RET_UNSUPPORTED on platforms without POSIX shared memory.
+ */
+RCL_PUBLIC
+RCL_WARN_UNUSED
+rcl_ret_t
+rcl_param_mirror_fini(rcl_param_mirror_t * mirror);
+
+/// Map an existing mirror segment read-only.
+/**
+ * Fails if the segment does not exist or carries an unknown layout
+ * version.
+ *
+ * <hr>
+ * Attribute          | Adherence
+ * ------------------ | -------------
+ * Allocates Memory   | Yes
+ * Thread-Safe        | No
+ * Uses Atomics       | No
+ * Lock-Free          | Yes
+ *
+ * \param[inout] reader a zero initialized reader to be initialized
+ * \param[in] segment_name name of the shared-memory segment to map
+ * \param[in] allocator the allocator for the reader bookkeeping
+ * \return #RCL_RET_OK if the segment was mapped, or
+ * \return #RCL_RET_ALREADY_INIT if the reader is already initialized, or
+ * \return #RCL_RET_INVALID_ARGUMENT if any arguments are invalid, or
+ * \return #RCL_RET_BAD_ALLOC if allocating memory failed, or
+ * \return #RCL_RET_UNSUPPORTED on platforms without POSIX shared memory, or
+ * \return #RCL_RET_ERROR if the segment is missing or not a mirror.
+ */
+RCL_PUBLIC
+RCL_WARN_UNUSED
+rcl_ret_t
+rcl_param_mirror_reader_open(
+  rcl_param_mirror_reader_t * reader,
+  const char * segment_name,
+  rcl_allocator_t allocator);
+
+/// Read one parameter's value from a mapped mirror.
+/**
+ * The read is wait-free against value refreshes of other parameters and
+ * retries only while the requested entry or the table structure is
+ * mid-rewrite.
+ *
+ * <hr>
+ * Attribute          | Adherence
+ * ------------------ | -------------
+ * Allocates Memory   | No
+ * Thread-Safe        | Yes
+ * Uses Atomics       | Yes
+ * Lock-Free          | Yes
+ *
+ * \param[in] reader the reader mapping the segment
+ * \param[in] node_name fully qualified name of the owning node
+ * \param[in] parameter_name name of the parameter
+ * \param[out] value set to a consistent copy of the parameter's value
+ * \return #RCL_RET_OK if the value was read, or
+ * \return #RCL_RET_INVALID_ARGUMENT if any arguments are invalid, or
+ * \return #RCL_RET_NOT_INIT if the reader is zero initialized, or
+ * \return #RCL_RET_UNSUPPORTED on platforms without POSIX shared memory, or
+ * \return #RCL_RET_ERROR if the parameter is not present in the mirror.
+ */
+RCL_PUBLIC
+RCL_WARN_UNUSED
+rcl_ret_t
+rcl_param_mirror_reader_read(
+  const rcl_param_mirror_reader_t * reader,
+  const char * node_name,
+  const char * parameter_name,
+  rcl_param_mirror_value_t * value);
+
+/// Close a reader, unmapping the segment.
+/**
+ * \param[inout] reader the reader to close
+ * \return #RCL_RET_OK if the reader was closed, or
+ * \return #RCL_RET_INVALID_ARGUMENT if reader is null, or
+ * \return #RCL_RET_UNSUPPORTED on platforms without POSIX shared memory.
+ */
+RCL_PUBLIC
+RCL_WARN_UNUSED
+rcl_ret_t
+rcl_param_mirror_reader_close(rcl_param_mirror_reader_t * reader);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif  // RCL__PARAM_MIRROR_H_
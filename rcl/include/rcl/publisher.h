@@ -160,6 +160,51 @@ rcl_publisher_init(
   const char * topic_name,
   const rcl_publisher_options_t * options);
 
+/// Initialize a rcl publisher from an already resolved topic name.
+/**
+ * Behaves like rcl_publisher_init() but takes a topic name that is already
+ * fully qualified, expanded, and remapped — as produced by a prior
+ * rcl_node_resolve_name() or a batch remap — and therefore skips the name
+ * expansion and remapping machinery entirely.
+ * Useful when entity creation latency matters, e.g. pipelines that
+ * reconstruct publisher sets at runtime and resolve all names up front.
+ *
+ * The name is only checked to be non-null and to start with `/`; passing a
+ * name that did not come from a resolution is the caller's responsibility
+ * and invalid names surface as middleware errors.
+ * The string is copied as needed and stays owned by the caller.
+ *
+ * <hr>
+ * Attribute          | Adherence
+ * ------------------ | -------------
+ * Allocates Memory   | Yes
+ * Thread-Safe        | No
+ * Uses Atomics       | No
+ * Lock-Free          | Yes
+ *
+ * \param[inout] publisher preallocated publisher structure
+ * \param[in] node valid rcl node handle
+ * \param[in] type_support type support object for the topic's type
+ * \param[in] resolved_topic_name the fully qualified topic name to publish on
+ * \param[in] options publisher options, including quality of service settings
+ * \return #RCL_RET_OK if the publisher was initialized successfully, or
+ * \return #RCL_RET_NODE_INVALID if the node is invalid, or
+ * \return #RCL_RET_ALREADY_INIT if the publisher is already initialized, or
+ * \return #RCL_RET_INVALID_ARGUMENT if any arguments are invalid, or
+ * \return #RCL_RET_BAD_ALLOC if allocating memory fails, or
+ * \return #RCL_RET_TOPIC_NAME_INVALID if the name is not fully qualified, or
+ * \return #RCL_RET_ERROR if an unspecified error occurs.
+ */
+RCL_PUBLIC
+RCL_WARN_UNUSED
+rcl_ret_t
+rcl_publisher_init_with_resolved_name(
+  rcl_publisher_t * publisher,
+  const rcl_node_t * node,
+  const rosidl_message_type_support_t * type_support,
+  const char * resolved_topic_name,
+  const rcl_publisher_options_t * options);
+
 /// Finalize a rcl_publisher_t.
 /**
  * After calling, the node will no longer be advertising that it is publishing
@@ -205,11 +250,83 @@ RCL_WARN_UNUSED
 rcl_publisher_options_t
 rcl_publisher_get_default_options(void);
 
+/// Initialize a fallback loan pool for a publisher.
+/**
+ * Middleware implementations without shared memory support return
+ * #RCL_RET_UNSUPPORTED from rcl_borrow_loaned_message(), forcing callers to
+ * keep a second allocation strategy around.
+ * With a loan pool initialized, rcl_borrow_loaned_message() always succeeds:
+ * when the rmw layer cannot loan, messages are served from a fixed-size
+ * per-publisher pool and rcl_publish_loaned_message() publishes them by copy
+ * at the rmw boundary, so the caller's path is allocation-free either way.
+ * When the rmw layer can loan, the pool is left unused and real loans are
+ * handed out as before.
+ *
+ * The pool hands out zero-initialized storage and never runs message
+ * constructors, so it is only suitable for self-contained (plain-old-data)
+ * message types without unbounded fields; the caller provides the message
+ * size, typically `sizeof()` of the concrete message type.
+ *
+ * The pool is deallocated by rcl_publisher_fini() if it is still initialized.
+ *
+ * <hr>
+ * Attribute          | Adherence
+ * ------------------ | -------------
+ * Allocates Memory   | Yes
+ * Thread-Safe        | No
+ * Uses Atomics       | No
+ * Lock-Free          | Yes
+ *
+ * \param[in] publisher Publisher to attach the pool to.
+ * \param[in] message_size Size of one message in bytes, must be greater than zero.
+ * \param[in] capacity Number of messages the pool holds, must be greater than zero.
+ * \return #RCL_RET_OK if the pool was initialized, or
+ * \return #RCL_RET_PUBLISHER_INVALID if the publisher is invalid, or
+ * \return #RCL_RET_INVALID_ARGUMENT if message_size or capacity is zero, or
+ * \return #RCL_RET_ALREADY_INIT if the publisher already has a pool, or
+ * \return #RCL_RET_BAD_ALLOC if allocating the pool failed.
+ */
+RCL_PUBLIC
+RCL_WARN_UNUSED
+rcl_ret_t
+rcl_publisher_init_loan_pool(
+  rcl_publisher_t * publisher,
+  size_t message_size,
+  size_t capacity);
+
+/// Finalize a publisher's fallback loan pool.
+/**
+ * Does nothing if the publisher has no pool.
+ * All borrowed messages must have been published or returned first.
+ *
+ * <hr>
+ * Attribute          | Adherence
+ * ------------------ | -------------
+ * Allocates Memory   | No
+ * Thread-Safe        | No
+ * Uses Atomics       | No
+ * Lock-Free          | Yes
+ *
+ * \param[in] publisher Publisher whose pool should be finalized.
+ * \return #RCL_RET_OK if the pool was finalized or did not exist, or
+ * \return #RCL_RET_PUBLISHER_INVALID if the publisher pointer or its
+ *   implementation is null, or
+ * \return #RCL_RET_ERROR if messages borrowed from the pool are still
+ *   outstanding.
+ */
+RCL_PUBLIC
+RCL_WARN_UNUSED
+rcl_ret_t
+rcl_publisher_fini_loan_pool(rcl_publisher_t * publisher);
+
 /// Borrow a loaned message.
 /**
  * The memory allocated for the ros message belongs to the middleware and must not be deallocated
  * other than by a call to \sa rcl_return_loaned_message_from_publisher.
  *
+ * If the publisher has a fallback loan pool the message may instead come from
+ * that pool, see rcl_publisher_init_loan_pool().
+ *
  * <hr>
  * Attribute          | Adherence
  * ------------------ | -------------
@@ -332,6 +449,96 @@ rcl_publish(
   const void * ros_message,
   rmw_publisher_allocation_t * allocation);
 
+/// Publish a batch of ROS messages on a topic using a publisher.
+/**
+ * Behaves like calling rcl_publish() once per message, but the publisher and
+ * its handle chain are validated a single time for the whole batch, which
+ * amortizes the per-call overhead for callers that emit messages in bursts.
+ * The messages are published in array order and publishing stops at the first
+ * failure; if `num_published` is not NULL it is set to the number of messages
+ * successfully handed to the middleware, so on error it is the index of the
+ * message that failed.
+ *
+ * All requirements and caveats of rcl_publish() apply to every message in the
+ * batch, including the thread-safety conditions and the type matching
+ * responsibility of the caller.
+ *
+ * <hr>
+ * Attribute          | Adherence
+ * ------------------ | -------------
+ * Allocates Memory   | No
+ * Thread-Safe        | Yes [1]
+ * Uses Atomics       | No
+ * Lock-Free          | Yes
+ * <i>[1] for unique pairs of publishers and messages, see rcl_publish()</i>
+ *
+ * \param[in] publisher handle to the publisher which will do the publishing
+ * \param[in] ros_messages array of type-erased pointers to the ROS messages
+ * \param[in] num_messages number of messages in the array
+ * \param[in] allocation structure pointer, used for memory preallocation (may be NULL)
+ * \param[out] num_published number of messages published before returning, or NULL
+ * \return #RCL_RET_OK if all messages were published successfully, or
+ * \return #RCL_RET_INVALID_ARGUMENT if any arguments are invalid, or
+ * \return #RCL_RET_PUBLISHER_INVALID if the publisher is invalid, or
+ * \return #RCL_RET_ERROR if an unspecified error occurs.
+ */
+RCL_PUBLIC
+RCL_WARN_UNUSED
+rcl_ret_t
+rcl_publish_batch(
+  const rcl_publisher_t * publisher,
+  const void * const * ros_messages,
+  size_t num_messages,
+  rmw_publisher_allocation_t * allocation,
+  size_t * num_published);
+
+/// Publish a ROS message, reusing the last serialization when unchanged.
+/**
+ * Intended for large, rarely-changing messages (maps, calibration) on
+ * transient-local topics that are republished for late joiners: a plain
+ * rcl_publish() re-serializes the full message every time, even when its
+ * content did not change.
+ * This function keeps the last serialization in a per-publisher cache; when
+ * `dirty` is false and the cache holds a serialization of a previous call the
+ * message is republished through rcl_publish_serialized_message() without
+ * serializing again.
+ * Pass `dirty` as true whenever the message content changed since the last
+ * call; the first call serializes regardless.
+ *
+ * The cache belongs to the publisher and is released by
+ * rcl_publisher_fini().
+ * All requirements of rcl_publish() on the message and the thread-safety
+ * caveats apply here as well; additionally two threads must not call this
+ * function on the same publisher concurrently because they share the cache.
+ *
+ * <hr>
+ * Attribute          | Adherence
+ * ------------------ | -------------
+ * Allocates Memory   | Yes [1]
+ * Thread-Safe        | No
+ * Uses Atomics       | No
+ * Lock-Free          | Yes
+ * <i>[1] only when (re)serializing, to grow the cache</i>
+ *
+ * \param[in] publisher handle to the publisher which will do the publishing
+ * \param[in] ros_message type-erased pointer to the ROS message
+ * \param[in] dirty true if the message changed since the previous call
+ * \param[in] allocation structure pointer, used for memory preallocation (may be NULL)
+ * \return #RCL_RET_OK if the message was published successfully, or
+ * \return #RCL_RET_BAD_ALLOC if allocating the cache failed, or
+ * \return #RCL_RET_INVALID_ARGUMENT if any arguments are invalid, or
+ * \return #RCL_RET_PUBLISHER_INVALID if the publisher is invalid, or
+ * \return #RCL_RET_ERROR if serialization or publishing fails.
+ */
+RCL_PUBLIC
+RCL_WARN_UNUSED
+rcl_ret_t
+rcl_publish_cached(
+  const rcl_publisher_t * publisher,
+  const void * ros_message,
+  bool dirty,
+  rmw_publisher_allocation_t * allocation);
+
 /// Publish a serialized message on a topic using a publisher.
 /**
  * It is the job of the caller to ensure that the type of the serialized message
@@ -479,6 +686,40 @@ rcl_publisher_wait_for_all_acked(
   const rcl_publisher_t * publisher,
   rcl_duration_value_t timeout);
 
+/// Check whether all published message data has been acknowledged.
+/**
+ * The non-blocking probe behind rcl_publisher_wait_for_all_acked(): the
+ * acknowledgment state is queried and returned without waiting, so callers
+ * can overlap computation with ack draining instead of stalling a thread.
+ * For event-driven completion see rcl_wait_set_add_ack_watch().
+ *
+ * If the publisher's QOS profile is not RELIABLE, `all_acked` is always set
+ * to true.
+ *
+ * <hr>
+ * Attribute          | Adherence
+ * ------------------ | -------------
+ * Allocates Memory   | No
+ * Thread-Safe        | Yes
+ * Uses Atomics       | No
+ * Lock-Free          | No
+ *
+ * \param[in] publisher handle to the publisher to check
+ * \param[out] all_acked set to true if no published message data is waiting
+ *   for acknowledgment
+ * \return #RCL_RET_OK if the check succeeded, or
+ * \return #RCL_RET_PUBLISHER_INVALID if publisher is invalid, or
+ * \return #RCL_RET_INVALID_ARGUMENT if all_acked is NULL, or
+ * \return #RCL_RET_ERROR if an unspecified error occurs, or
+ * \return #RCL_RET_UNSUPPORTED if the middleware does not support that feature.
+ */
+RCL_PUBLIC
+RCL_WARN_UNUSED
+rcl_ret_t
+rcl_publisher_check_all_acked(
+  const rcl_publisher_t * publisher,
+  bool * all_acked);
+
 /// Get the topic name for the publisher.
 /**
  * This function returns the publisher's internal topic name string.
@@ -627,6 +868,278 @@ RCL_PUBLIC
 bool
 rcl_publisher_is_valid_except_context(const rcl_publisher_t * publisher);
 
+/// Seal a publisher so publish calls skip revalidating it.
+/**
+ * Every publish call normally re-runs rcl_publisher_is_valid(), walking the
+ * publisher, implementation, and context pointers even though a publisher
+ * that published successfully once stays valid until finalized.
+ * Sealing records that the publisher is known-good: in release builds the
+ * publish functions then skip the validity walk entirely, while debug builds
+ * keep the full checks so sealing cannot hide a use-after-fini.
+ *
+ * The caller takes on the responsibility that normally sits with the checks:
+ * a sealed publisher must not be used after its context is shut down or its
+ * node finalized.
+ * rcl_publisher_fini() refuses to finalize a sealed publisher; call
+ * rcl_publisher_unseal() first.
+ *
+ * <hr>
+ * Attribute          | Adherence
+ * ------------------ | -------------
+ * Allocates Memory   | No
+ * Thread-Safe        | No
+ * Uses Atomics       | No
+ * Lock-Free          | Yes
+ *
+ * \param[in] publisher pointer to the rcl publisher to seal
+ * \return #RCL_RET_OK if the publisher was sealed, or
+ * \return #RCL_RET_PUBLISHER_INVALID if the publisher is invalid.
+ */
+RCL_PUBLIC
+RCL_WARN_UNUSED
+rcl_ret_t
+rcl_publisher_seal(rcl_publisher_t * publisher);
+
+/// Unseal a publisher, restoring per-call validation.
+/**
+ * Inverse of rcl_publisher_seal(); required before rcl_publisher_fini().
+ * Unsealing a publisher that is not sealed is a no-op.
+ *
+ * <hr>
+ * Attribute          | Adherence
+ * ------------------ | -------------
+ * Allocates Memory   | No
+ * Thread-Safe        | No
+ * Uses Atomics       | No
+ * Lock-Free          | Yes
+ *
+ * \param[in] publisher pointer to the rcl publisher to unseal
+ * \return #RCL_RET_OK if the publisher was unsealed, or
+ * \return #RCL_RET_PUBLISHER_INVALID if the publisher pointer or its
+ *   implementation is null.
+ */
+RCL_PUBLIC
+RCL_WARN_UNUSED
+rcl_ret_t
+rcl_publisher_unseal(rcl_publisher_t * publisher);
+
+/// Return true if the publisher is sealed, otherwise false.
+/**
+ * Returns `false` for a null or uninitialized publisher; never sets an error.
+ *
+ * \param[in] publisher pointer to the rcl publisher
+ * \return `true` if `publisher` is sealed, otherwise `false`
+ */
+RCL_PUBLIC
+bool
+rcl_publisher_is_sealed(const rcl_publisher_t * publisher);
+
+/// Stamp outgoing messages with the publisher's clock on publish.
+/**
+ * Callers that stamp a header immediately before rcl_publish() read the
+ * clock once for the stamp while the middleware takes its own source
+ * timestamp, costing two clock reads that can diverge.
+ * With this enabled, rcl_publish() samples the given clock once per message
+ * and writes the time into the message at `stamp_offset`, which must be the
+ * byte offset of a `builtin_interfaces/Time` field (an int32 `sec`
+ * immediately followed by a uint32 `nanosec`), typically
+ * `offsetof(MessageT, header.stamp)`.
+ * The message is written in place even though publish takes it const; the
+ * caller opts into that mutation by enabling stamping.
+ *
+ * The rmw source timestamp is still taken by the middleware, as the rmw
+ * publish interface offers no way to inject one; this removes the caller's
+ * extra clock read and makes all rcl-visible stamps come from one sample.
+ *
+ * The clock must outlive the publisher or a clear call.
+ * Stamping applies to rcl_publish() only, not to serialized, loaned, or
+ * batch publishes.
+ *
+ * <hr>
+ * Attribute          | Adherence
+ * ------------------ | -------------
+ * Allocates Memory   | No
+ * Thread-Safe        | No
+ * Uses Atomics       | No
+ * Lock-Free          | Yes
+ *
+ * \param[in] publisher pointer to the rcl publisher
+ * \param[in] clock clock to sample on each publish
+ * \param[in] stamp_offset byte offset of the stamp field inside the message
+ * \return #RCL_RET_OK if stamping was enabled, or
+ * \return #RCL_RET_PUBLISHER_INVALID if the publisher is invalid, or
+ * \return #RCL_RET_INVALID_ARGUMENT if the clock is null or invalid.
+ */
+RCL_PUBLIC
+RCL_WARN_UNUSED
+rcl_ret_t
+rcl_publisher_set_stamp_on_publish(
+  rcl_publisher_t * publisher,
+  rcl_clock_t * clock,
+  size_t stamp_offset);
+
+/// Stop stamping outgoing messages on publish.
+/**
+ * Does nothing if stamping is not enabled.
+ *
+ * \param[in] publisher pointer to the rcl publisher
+ * \return #RCL_RET_OK if stamping was disabled, or
+ * \return #RCL_RET_PUBLISHER_INVALID if the publisher is invalid.
+ */
+RCL_PUBLIC
+RCL_WARN_UNUSED
+rcl_ret_t
+rcl_publisher_clear_stamp_on_publish(rcl_publisher_t * publisher);
+
+/// Enable contention-free concurrent publishing on a publisher.
+/**
+ * Multiple threads publishing on one publisher serialize inside the
+ * middleware.
+ * This provisions `num_sessions` rmw publishers on the same topic behind the
+ * single rcl handle; rcl_publish() then routes each calling thread to a
+ * session chosen by a thread-local round-robin index, so threads publishing
+ * concurrently do not share an rmw publisher and its lock.
+ *
+ * Caveats: each session is a distinct middleware entity, so subscribers see
+ * `num_sessions` matched publishers and there is no ordering between
+ * messages published from different threads (there is none under contention
+ * today either).
+ * Loaned-message, serialized, and batch publishing keep using the primary
+ * session.
+ * The extra sessions are destroyed by
+ * rcl_publisher_disable_concurrent_publishing() or rcl_publisher_fini().
+ *
+ * <hr>
+ * Attribute          | Adherence
+ * ------------------ | -------------
+ * Allocates Memory   | Yes
+ * Thread-Safe        | No
+ * Uses Atomics       | No
+ * Lock-Free          | Yes
+ *
+ * \param[in] publisher pointer to the rcl publisher
+ * \param[in] node the node the publisher was created on
+ * \param[in] num_sessions total number of rmw sessions to publish through,
+ *   including the existing one; must be at least two
+ * \return #RCL_RET_OK if concurrent publishing was enabled, or
+ * \return #RCL_RET_PUBLISHER_INVALID if the publisher is invalid, or
+ * \return #RCL_RET_NODE_INVALID if the node is invalid, or
+ * \return #RCL_RET_INVALID_ARGUMENT if num_sessions is less than two, or
+ * \return #RCL_RET_ALREADY_INIT if concurrent publishing is already enabled, or
+ * \return #RCL_RET_BAD_ALLOC if allocating the session array failed, or
+ * \return #RCL_RET_ERROR if creating a session failed.
+ */
+RCL_PUBLIC
+RCL_WARN_UNUSED
+rcl_ret_t
+rcl_publisher_enable_concurrent_publishing(
+  rcl_publisher_t * publisher,
+  const rcl_node_t * node,
+  size_t num_sessions);
+
+/// Disable concurrent publishing, destroying the extra rmw sessions.
+/**
+ * Publishing falls back to the single primary session.
+ * Does nothing if concurrent publishing is not enabled.
+ * Must not be called while other threads are publishing on this publisher.
+ *
+ * \param[in] publisher pointer to the rcl publisher
+ * \param[in] node the node the publisher was created on
+ * \return #RCL_RET_OK if concurrent publishing was disabled, or
+ * \return #RCL_RET_PUBLISHER_INVALID if the publisher is invalid, or
+ * \return #RCL_RET_NODE_INVALID if the node is invalid, or
+ * \return #RCL_RET_ERROR if destroying a session failed.
+ */
+RCL_PUBLIC
+RCL_WARN_UNUSED
+rcl_ret_t
+rcl_publisher_disable_concurrent_publishing(
+  rcl_publisher_t * publisher,
+  const rcl_node_t * node);
+
+/// Snapshot of a publisher's telemetry counters.
+typedef struct rcl_publisher_statistics_s
+{
+  /// Number of rcl_publish() and rcl_publish_serialized_message() calls that
+  /// reached the middleware while statistics were enabled.
+  uint64_t publish_count;
+  /// Number of serialized publishes among `publish_count`.
+  uint64_t serialized_publish_count;
+  /// Sum of the serialized message sizes published, in bytes.
+  uint64_t serialized_bytes_total;
+  /// Size of the most recently published serialized message, in bytes.
+  uint64_t last_serialized_size;
+  /// Exponentially weighted moving average of the rmw publish call duration,
+  /// in nanoseconds (alpha = 1/8).
+  uint64_t ewma_rmw_publish_duration_ns;
+} rcl_publisher_statistics_t;
+
+/// Enable telemetry counters on a publisher.
+/**
+ * While enabled, rcl_publish() and rcl_publish_serialized_message() update
+ * relaxed atomic counters and an EWMA of the rmw call duration; the cost per
+ * publish is two steady-clock reads and a handful of atomic operations.
+ * Statistics are disabled by default, making the instrumentation free when
+ * unused.
+ *
+ * <hr>
+ * Attribute          | Adherence
+ * ------------------ | -------------
+ * Allocates Memory   | No
+ * Thread-Safe        | No
+ * Uses Atomics       | No
+ * Lock-Free          | Yes
+ *
+ * \param[in] publisher pointer to the rcl publisher
+ * \return #RCL_RET_OK if statistics were enabled, or
+ * \return #RCL_RET_PUBLISHER_INVALID if the publisher is invalid.
+ */
+RCL_PUBLIC
+RCL_WARN_UNUSED
+rcl_ret_t
+rcl_publisher_enable_statistics(rcl_publisher_t * publisher);
+
+/// Disable telemetry counters on a publisher.
+/**
+ * Counter values accumulated so far are kept and remain readable through
+ * rcl_publisher_get_statistics().
+ *
+ * \param[in] publisher pointer to the rcl publisher
+ * \return #RCL_RET_OK if statistics were disabled, or
+ * \return #RCL_RET_PUBLISHER_INVALID if the publisher is invalid.
+ */
+RCL_PUBLIC
+RCL_WARN_UNUSED
+rcl_ret_t
+rcl_publisher_disable_statistics(rcl_publisher_t * publisher);
+
+/// Read a snapshot of a publisher's telemetry counters.
+/**
+ * The counters are read with individual atomic loads, so values observed
+ * concurrently with publishing may come from slightly different instants;
+ * each individual counter is always consistent.
+ *
+ * <hr>
+ * Attribute          | Adherence
+ * ------------------ | -------------
+ * Allocates Memory   | No
+ * Thread-Safe        | Yes
+ * Uses Atomics       | Yes
+ * Lock-Free          | Yes
+ *
+ * \param[in] publisher pointer to the rcl publisher
+ * \param[out] statistics filled with the current counter values
+ * \return #RCL_RET_OK if the snapshot was taken, or
+ * \return #RCL_RET_INVALID_ARGUMENT if statistics is null, or
+ * \return #RCL_RET_PUBLISHER_INVALID if the publisher is invalid.
+ */
+RCL_PUBLIC
+RCL_WARN_UNUSED
+rcl_ret_t
+rcl_publisher_get_statistics(
+  const rcl_publisher_t * publisher,
+  rcl_publisher_statistics_t * statistics);
+
 /// Get the number of subscriptions matched to a publisher.
 /**
  * Used to get the internal count of subscriptions matched to a publisher.
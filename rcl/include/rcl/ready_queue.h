@@ -0,0 +1,225 @@
+// Copyright 2026 Open Source Robotics Foundation, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/// @file
+
+#ifndef RCL__READY_QUEUE_H_
+#define RCL__READY_QUEUE_H_
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include "rcl/allocator.h"
+#include "rcl/macros.h"
+#include "rcl/types.h"
+#include "rcl/visibility_control.h"
+#include "rcl/wait.h"
+
+typedef struct rcl_ready_queue_impl_s rcl_ready_queue_impl_t;
+
+/// One unit of dispatchable work: a ready entity and where it was found.
+typedef struct rcl_ready_queue_entry_s
+{
+  /// The rcl handle of the ready entity, e.g. a `const rcl_subscription_t *`
+  /// for #RCL_WAIT_SET_SUBSCRIPTION.
+  const void * entity;
+  /// Which entity class `entity` belongs to.
+  rcl_wait_set_entity_type_t entity_type;
+  /// Index of the entity in its wait set array at the time it was ready.
+  size_t wait_set_index;
+} rcl_ready_queue_entry_t;
+
+/// A bounded lock-free multi-producer multi-consumer queue of ready entities.
+/**
+ * Executors built above rcl all end up converting wait set scans into
+ * per-thread dispatch queues; this type moves that conversion inside rcl.
+ * Attach a queue to a wait set with rcl_wait_set_attach_ready_queue() and
+ * rcl_wait() pushes one entry per ready entity straight out of its post-rmw
+ * decode loop, while the readiness data is still hot in cache; worker
+ * threads pop entries concurrently without re-scanning the wait set.
+ *
+ * Push and pop use the same slot-sequence claim protocol as the other
+ * bounded rings in rcl, so any number of threads may push and pop
+ * concurrently without locks.
+ * When the queue is full a push is dropped and counted; the waiting thread
+ * still sees the entity in the wait set arrays and can rescan, so a drop
+ * degrades throughput, not correctness.
+ */
+typedef struct rcl_ready_queue_s
+{
+  /// Private implementation pointer.
+  rcl_ready_queue_impl_t * impl;
+} rcl_ready_queue_t;
+
+/// Return a rcl_ready_queue_t struct with members initialized to `NULL`.
+RCL_PUBLIC
+RCL_WARN_UNUSED
+rcl_ready_queue_t
+rcl_get_zero_initialized_ready_queue(void);
+
+/// Initialize a ready queue.
+/**
+ * `capacity` is rounded up to the next power of two for mask addressing.
+ *
+ * <hr>
+ * Attribute          | Adherence
+ * ------------------ | -------------
+ * Allocates Memory   | Yes
+ * Thread-Safe        | No
+ * Uses Atomics       | No
+ * Lock-Free          | Yes
+ *
+ * \param[inout] ready_queue a zero initialized queue to be initialized
+ * \param[in] capacity the number of entries the queue can hold
+ * \param[in] allocator the allocator for the slot storage
+ * \return #RCL_RET_OK if the queue was initialized successfully, or
+ * \return #RCL_RET_ALREADY_INIT if the queue is already initialized, or
+ * \return #RCL_RET_INVALID_ARGUMENT if any arguments are invalid or
+ *   capacity is zero, or
+ * \return #RCL_RET_BAD_ALLOC if allocating memory failed.
+ */
+RCL_PUBLIC
+RCL_WARN_UNUSED
+rcl_ret_t
+rcl_ready_queue_init(
+  rcl_ready_queue_t * ready_queue,
+  size_t capacity,
+  rcl_allocator_t allocator);
+
+/// Finalize a ready queue.
+/**
+ * Must not race concurrent pushes or pops; detach the queue from its wait
+ * set and quiesce the workers first.
+ *
+ * \param[inout] ready_queue the queue to finalize
+ * \return #RCL_RET_OK if the queue was finalized, or
+ * \return #RCL_RET_INVALID_ARGUMENT if ready_queue is null.
+ */
+RCL_PUBLIC
+RCL_WARN_UNUSED
+rcl_ret_t
+rcl_ready_queue_fini(rcl_ready_queue_t * ready_queue);
+
+/// Push one entry, dropping it when the queue is full.
+/**
+ * <hr>
+ * Attribute          | Adherence
+ * ------------------ | -------------
+ * Allocates Memory   | No
+ * Thread-Safe        | Yes
+ * Uses Atomics       | Yes
+ * Lock-Free          | Yes
+ *
+ * \param[in] ready_queue the queue to push onto
+ * \param[in] entry the entry to copy into the queue
+ * \return #RCL_RET_OK if the entry was queued, or
+ * \return #RCL_RET_WAIT_SET_FULL if the queue was full and the entry was
+ *   dropped (also counted, see rcl_ready_queue_get_dropped_count()), or
+ * \return #RCL_RET_INVALID_ARGUMENT if any arguments are invalid, or
+ * \return #RCL_RET_NOT_INIT if the queue is zero initialized.
+ */
+RCL_PUBLIC
+RCL_WARN_UNUSED
+rcl_ret_t
+rcl_ready_queue_push(
+  rcl_ready_queue_t * ready_queue,
+  const rcl_ready_queue_entry_t * entry);
+
+/// Pop the oldest entry.
+/**
+ * <hr>
+ * Attribute          | Adherence
+ * ------------------ | -------------
+ * Allocates Memory   | No
+ * Thread-Safe        | Yes
+ * Uses Atomics       | Yes
+ * Lock-Free          | Yes
+ *
+ * \param[in] ready_queue the queue to pop from
+ * \param[out] entry filled with the popped entry
+ * \return #RCL_RET_OK if an entry was popped, or
+ * \return #RCL_RET_WAIT_SET_EMPTY if the queue was empty, or
+ * \return #RCL_RET_INVALID_ARGUMENT if any arguments are invalid, or
+ * \return #RCL_RET_NOT_INIT if the queue is zero initialized.
+ */
+RCL_PUBLIC
+RCL_WARN_UNUSED
+rcl_ret_t
+rcl_ready_queue_pop(
+  rcl_ready_queue_t * ready_queue,
+  rcl_ready_queue_entry_t * entry);
+
+/// Return the number of pushes dropped because the queue was full.
+/**
+ * \param[in] ready_queue the queue to query
+ * \param[out] dropped_count filled with the total dropped pushes
+ * \return #RCL_RET_OK if the count was retrieved, or
+ * \return #RCL_RET_INVALID_ARGUMENT if any arguments are invalid, or
+ * \return #RCL_RET_NOT_INIT if the queue is zero initialized.
+ */
+RCL_PUBLIC
+RCL_WARN_UNUSED
+rcl_ret_t
+rcl_ready_queue_get_dropped_count(
+  const rcl_ready_queue_t * ready_queue,
+  uint64_t * dropped_count);
+
+/// Attach a ready queue to a wait set.
+/**
+ * While attached, every rcl_wait() on the wait set pushes one entry per
+ * ready entity onto the queue after readiness decoding, in entity array
+ * order (subscriptions, guard conditions, timers, clients, services,
+ * events). The wait set result arrays and bitmaps are still populated as
+ * usual, so consumers that want to rescan can.
+ *
+ * The queue must outlive the attachment; detach with
+ * rcl_wait_set_detach_ready_queue() before finalizing the queue.
+ *
+ * \param[in] wait_set the wait set to attach to
+ * \param[in] ready_queue the initialized queue rcl_wait() should populate
+ * \return #RCL_RET_OK if the queue was attached, or
+ * \return #RCL_RET_INVALID_ARGUMENT if ready_queue is null or not
+ *   initialized, or
+ * \return #RCL_RET_WAIT_SET_INVALID if the wait set is invalid.
+ */
+RCL_PUBLIC
+RCL_WARN_UNUSED
+rcl_ret_t
+rcl_wait_set_attach_ready_queue(
+  rcl_wait_set_t * wait_set,
+  rcl_ready_queue_t * ready_queue);
+
+/// Detach the ready queue from a wait set.
+/**
+ * A no-op when no queue is attached.
+ *
+ * \param[in] wait_set the wait set to detach from
+ * \return #RCL_RET_OK if the queue was detached, or
+ * \return #RCL_RET_WAIT_SET_INVALID if the wait set is invalid.
+ */
+RCL_PUBLIC
+RCL_WARN_UNUSED
+rcl_ret_t
+rcl_wait_set_detach_ready_queue(rcl_wait_set_t * wait_set);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif  // RCL__READY_QUEUE_H_
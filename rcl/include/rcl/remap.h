@@ -17,6 +17,8 @@
 #ifndef RCL__REMAP_H_
 #define RCL__REMAP_H_
 
+#include <stdbool.h>
+
 #include "rcl/allocator.h"
 #include "rcl/arguments.h"
 #include "rcl/macros.h"
@@ -163,6 +165,63 @@ rcl_remap_service_name(
   rcl_allocator_t allocator,
   char ** output_name);
 
+/// Remap a batch of topic and service names in one pass.
+/**
+ * Each name is remapped exactly as rcl_remap_topic_name() or
+ * rcl_remap_service_name() would remap it, but the substitution map used to
+ * expand the match side of remap rules is constructed once and shared across
+ * the whole batch instead of once per name.
+ * \sa rcl_remap_topic_name()
+ * \sa rcl_remap_service_name()
+ *
+ * All supplied names must have already been expanded to fully qualified names.
+ *
+ * On success each entry of `output_names` is either an allocated string with
+ * the remapped name or `NULL` if no rule matched that name.
+ * If an error occurs part way through the batch, entries allocated so far are
+ * deallocated and every entry of `output_names` is set to `NULL`.
+ *
+ * <hr>
+ * Attribute          | Adherence
+ * ------------------ | -------------
+ * Allocates Memory   | Yes
+ * Thread-Safe        | No
+ * Uses Atomics       | No
+ * Lock-Free          | Yes
+ *
+ * \param[in] local_arguments Command line arguments to be used before global arguments, or
+ *   if NULL or zero-initialized then only global arguments are used.
+ * \param[in] global_arguments Command line arguments to use if no local rules matched, or
+ *   `NULL` or zero-initialized to ignore global arguments.
+ * \param[in] count Number of names in the batch.
+ * \param[in] names An array of `count` fully qualified and expanded names to be remapped.
+ * \param[in] is_service An array of `count` flags where `true` means the name at the same
+ *   position is a service name, or `NULL` if every name is a topic name.
+ * \param[in] node_name The name of the node to which the names belong.
+ * \param[in] node_namespace The namespace of the node to which the names belong.
+ * \param[in] allocator A valid allocator to use.
+ * \param[out] output_names An array of `count` entries filled with remapped names or `NULL`.
+ * \return #RCL_RET_OK if the names were remapped or no rules matched, or
+ * \return #RCL_RET_INVALID_ARGUMENT if any arguments are invalid, or
+ * \return #RCL_RET_BAD_ALLOC if allocating memory failed, or
+ * \return #RCL_RET_TOPIC_NAME_INVALID if a given topic name is invalid, or
+ * \return #RCL_RET_SERVICE_NAME_INVALID if a given service name is invalid, or
+ * \return #RCL_RET_ERROR if an unspecified error occurs.
+ */
+RCL_PUBLIC
+RCL_WARN_UNUSED
+rcl_ret_t
+rcl_remap_names_batch(
+  const rcl_arguments_t * local_arguments,
+  const rcl_arguments_t * global_arguments,
+  size_t count,
+  const char * const * names,
+  const bool * is_service,
+  const char * node_name,
+  const char * node_namespace,
+  rcl_allocator_t allocator,
+  char ** output_names);
+
 /// Remap a node name based on given rules.
 /**
  * This function returns the node name that a node with the given name would be remapped to.
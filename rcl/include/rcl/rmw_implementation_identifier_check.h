@@ -33,6 +33,12 @@ extern "C"
 
 /// Check whether the RMW implementation in use matches what the user requested.
 /**
+ * This reads the two environment variables above and compares them against
+ * the rmw implementation identifier every time it is called.
+ * When rcl is built with `RCL_DISABLE_RMW_ID_CHECK` defined, for images
+ * where the middleware is fixed at build time, the check is compiled out and
+ * this always returns #RCL_RET_OK.
+ *
  * \return #RCL_RET_OK if the RMW implementation in use matches what the user requested, or
  * \return #RCL_RET_MISMATCHED_RMW_ID if the RMW implementation does not match, or
  * \return #RCL_RET_BAD_ALLOC if memory allocation failed, or
@@ -41,6 +47,28 @@ extern "C"
 RCL_PUBLIC
 rcl_ret_t rcl_rmw_implementation_identifier_check(void);
 
+/// Return the latched result of the RMW implementation identifier check.
+/**
+ * The full check runs once per process from a library constructor when
+ * librcl is loaded and its result is latched; this returns the latched
+ * result with an atomic load, without the environment lookups and string
+ * comparisons of rcl_rmw_implementation_identifier_check(), so it is cheap
+ * enough for entity creation paths.
+ * If no check has completed yet the full check is performed and latched.
+ * Calling rcl_rmw_implementation_identifier_check() directly updates the
+ * latched result.
+ *
+ * When rcl is built with `RCL_DISABLE_RMW_ID_CHECK` defined this always
+ * returns #RCL_RET_OK.
+ *
+ * \return #RCL_RET_OK if the RMW implementation in use matches what the user requested, or
+ * \return #RCL_RET_MISMATCHED_RMW_ID if the RMW implementation does not match, or
+ * \return #RCL_RET_BAD_ALLOC if memory allocation failed, or
+ * \return #RCL_RET_ERROR if some other error occurred.
+ */
+RCL_PUBLIC
+rcl_ret_t rcl_rmw_implementation_identifier_check_latched(void);
+
 #ifdef __cplusplus
 }
 #endif
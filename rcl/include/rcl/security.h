@@ -117,6 +117,12 @@ rcl_get_enforcement_policy(rmw_security_enforcement_policy_t * policy);
  * before runtime, or when testing and using additional tools that may not otherwise be easily
  * provisioned.
  *
+ * Successful resolutions are cached process-wide, keyed on the name and the two environment
+ * variables, so repeated context initializations for the same enclave avoid re-probing the
+ * file system.
+ * Cached entries are re-validated against the file system on every use, and changing either
+ * environment variable always takes effect on the next call.
+ *
  * \param[in] name validated name (a single token)
  * \param[in] allocator the allocator to use for allocation
  * \return Machine specific (absolute) enclave directory path or NULL on failure.
@@ -0,0 +1,119 @@
+// Copyright 2026 Open Source Robotics Foundation, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/// @file
+
+#ifndef RCL__SERIALIZED_MESSAGE_H_
+#define RCL__SERIALIZED_MESSAGE_H_
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+#include <stdint.h>
+
+#include "rcl/allocator.h"
+#include "rcl/macros.h"
+#include "rcl/types.h"
+#include "rcl/visibility_control.h"
+
+/// State backing an inline-buffered serialized message.
+/**
+ * Records the caller-provided inline storage and the heap allocator used
+ * when a serialization outgrows it.
+ * Must stay alive and unmoved as long as the serialized message it backs is
+ * in use, since the message's allocator points at it.
+ */
+typedef struct rcl_inline_serialized_message_state_s
+{
+  uint8_t * inline_buffer;
+  size_t inline_capacity;
+  rcl_allocator_t heap_allocator;
+} rcl_inline_serialized_message_state_t;
+
+/// Initialize a serialized message backed by a caller-provided inline buffer.
+/**
+ * Small serializations stay entirely in the given buffer — typically stack or
+ * impl-resident storage — so no heap allocation happens at all; only when a
+ * message outgrows `buffer_capacity` does the backing spill to memory from
+ * `heap_allocator`, copying the inline contents over.
+ * The resulting rcl_serialized_message_t can be passed to any consumer that
+ * grows it through its embedded allocator, e.g. `rmw_serialize()` or
+ * rcl_take_serialized_message(), and published with
+ * rcl_publish_serialized_message().
+ *
+ * The message must be finalized with rcl_serialized_message_fini_inline(),
+ * not `rmw_serialized_message_fini()`, so the inline storage is never freed.
+ * Both `state` and `buffer` must outlive the message.
+ *
+ * <hr>
+ * Attribute          | Adherence
+ * ------------------ | -------------
+ * Allocates Memory   | No
+ * Thread-Safe        | No
+ * Uses Atomics       | No
+ * Lock-Free          | Yes
+ *
+ * \param[out] serialized_message message to initialize, must be zero initialized
+ * \param[out] state backing state, filled by this call
+ * \param[in] buffer inline storage for small serializations
+ * \param[in] buffer_capacity size of `buffer` in bytes, must be greater than zero
+ * \param[in] heap_allocator allocator used when a serialization spills
+ * \return #RCL_RET_OK if the message was initialized, or
+ * \return #RCL_RET_INVALID_ARGUMENT if any argument is null or the capacity
+ *   is zero.
+ */
+RCL_PUBLIC
+RCL_WARN_UNUSED
+rcl_ret_t
+rcl_serialized_message_init_inline(
+  rcl_serialized_message_t * serialized_message,
+  rcl_inline_serialized_message_state_t * state,
+  uint8_t * buffer,
+  size_t buffer_capacity,
+  const rcl_allocator_t * heap_allocator);
+
+/// Finalize an inline-buffered serialized message.
+/**
+ * Releases the heap backing if the message spilled; the inline buffer itself
+ * is caller-owned and untouched.
+ * The message is reset to zero initialized.
+ *
+ * <hr>
+ * Attribute          | Adherence
+ * ------------------ | -------------
+ * Allocates Memory   | No
+ * Thread-Safe        | No
+ * Uses Atomics       | No
+ * Lock-Free          | Yes
+ *
+ * \param[inout] serialized_message message initialized with
+ *   rcl_serialized_message_init_inline()
+ * \param[in] state the state the message was initialized with
+ * \return #RCL_RET_OK if the message was finalized, or
+ * \return #RCL_RET_INVALID_ARGUMENT if any argument is null.
+ */
+RCL_PUBLIC
+RCL_WARN_UNUSED
+rcl_ret_t
+rcl_serialized_message_fini_inline(
+  rcl_serialized_message_t * serialized_message,
+  rcl_inline_serialized_message_state_t * state);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif  // RCL__SERIALIZED_MESSAGE_H_
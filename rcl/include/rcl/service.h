@@ -167,6 +167,52 @@ rcl_service_init(
   const char * service_name,
   const rcl_service_options_t * options);
 
+/// Initialize a rcl service from an already resolved service name.
+/**
+ * Behaves like rcl_service_init() but takes a service name that is already
+ * fully qualified, expanded, and remapped — as produced by a prior
+ * rcl_node_resolve_name() — and therefore skips the name expansion and
+ * remapping machinery entirely.
+ * Useful when several related clients and services are created from one
+ * base name, e.g. action servers: resolve the base name once and derive
+ * the related service names from that single resolution.
+ *
+ * The name is only checked to be non-null and to start with `/`; passing a
+ * name that did not come from a resolution is the caller's responsibility
+ * and invalid names surface as middleware errors.
+ * The string is copied as needed and stays owned by the caller.
+ *
+ * <hr>
+ * Attribute          | Adherence
+ * ------------------ | -------------
+ * Allocates Memory   | Yes
+ * Thread-Safe        | No
+ * Uses Atomics       | No
+ * Lock-Free          | Yes
+ *
+ * \param[inout] service preallocated rcl_service_t structure
+ * \param[in] node valid rcl_node_t
+ * \param[in] type_support type support object for the service's type
+ * \param[in] resolved_service_name the fully qualified service name to serve
+ * \param[in] options service options, including quality of service settings
+ * \return #RCL_RET_OK if the service was initialized successfully, or
+ * \return #RCL_RET_NODE_INVALID if the node is invalid, or
+ * \return #RCL_RET_ALREADY_INIT if the service is already initialized, or
+ * \return #RCL_RET_INVALID_ARGUMENT if any arguments are invalid, or
+ * \return #RCL_RET_BAD_ALLOC if allocating memory fails, or
+ * \return #RCL_RET_SERVICE_NAME_INVALID if the name is not fully qualified, or
+ * \return #RCL_RET_ERROR if an unspecified error occurs.
+ */
+RCL_PUBLIC
+RCL_WARN_UNUSED
+rcl_ret_t
+rcl_service_init_with_resolved_name(
+  rcl_service_t * service,
+  const rcl_node_t * node,
+  const rosidl_service_type_support_t * type_support,
+  const char * resolved_service_name,
+  const rcl_service_options_t * options);
+
 /// Finalize a rcl_service_t.
 /**
  * After calling, the node will no longer listen for requests for this service.
@@ -287,6 +333,49 @@ rcl_take_request(
   rmw_request_id_t * request_header,
   void * ros_request);
 
+/// Take up to `max_requests` pending requests with one validated call.
+/**
+ * Drains the service's request queue into caller-provided arrays, validating
+ * the service handle once for the whole batch instead of once per request,
+ * so a busy server crosses the rcl/rmw boundary per burst rather than per
+ * request.
+ * Each entry of `ros_requests` must point to an allocated request message of
+ * the type associated with the service, as for rcl_take_request_with_info().
+ * Fewer than `max_requests` may be taken; `taken` reports how many entries
+ * are valid.
+ *
+ * <hr>
+ * Attribute          | Adherence
+ * ------------------ | -------------
+ * Allocates Memory   | Maybe [1]
+ * Thread-Safe        | No
+ * Uses Atomics       | No
+ * Lock-Free          | Yes
+ * <i>[1] only if required when filling the requests, avoided for fixed sizes</i>
+ *
+ * \param[in] service the handle to the service from which to take
+ * \param[out] request_headers array receiving per-request meta-data
+ * \param[inout] ros_requests array of type-erased pointers to allocated
+ *   request messages
+ * \param[in] max_requests capacity of both arrays, must be greater than zero
+ * \param[out] taken set to the number of requests actually taken
+ * \return #RCL_RET_OK if one or more requests was taken, or
+ * \return #RCL_RET_INVALID_ARGUMENT if any arguments are invalid, or
+ * \return #RCL_RET_SERVICE_INVALID if the service is invalid, or
+ * \return #RCL_RET_BAD_ALLOC if allocating memory failed, or
+ * \return #RCL_RET_SERVICE_TAKE_FAILED if no request was available, or
+ * \return #RCL_RET_ERROR if an unspecified error occurs.
+ */
+RCL_PUBLIC
+RCL_WARN_UNUSED
+rcl_ret_t
+rcl_take_request_batch(
+  const rcl_service_t * service,
+  rmw_service_info_t * request_headers,
+  void ** ros_requests,
+  size_t max_requests,
+  size_t * taken);
+
 /// Send a ROS response to a client using a service.
 /**
  * It is the job of the caller to ensure that the type of the `ros_response`
@@ -340,6 +429,44 @@ rcl_send_response(
   rmw_request_id_t * response_header,
   void * ros_response);
 
+/// Send a batch of responses with one validated call.
+/**
+ * Scatters `count` responses back to their requesters, validating the
+ * service handle once for the whole batch.
+ * The header and response at the same index belong together, typically as
+ * filled by rcl_take_request_batch() and the server's handlers.
+ * If sending fails partway, `sent` reports how many responses went out
+ * before the failure.
+ *
+ * <hr>
+ * Attribute          | Adherence
+ * ------------------ | -------------
+ * Allocates Memory   | No
+ * Thread-Safe        | Yes [1]
+ * Uses Atomics       | No
+ * Lock-Free          | Yes
+ * <i>[1] for unique pairs of services and responses, as rcl_send_response()</i>
+ *
+ * \param[in] service handle to the service which will make the responses
+ * \param[inout] request_headers array of request IDs the responses answer
+ * \param[in] ros_responses array of type-erased pointers to response messages
+ * \param[in] count number of entries in both arrays, must be greater than zero
+ * \param[out] sent set to the number of responses actually sent
+ * \return #RCL_RET_OK if all responses were sent successfully, or
+ * \return #RCL_RET_INVALID_ARGUMENT if any arguments are invalid, or
+ * \return #RCL_RET_SERVICE_INVALID if the service is invalid, or
+ * \return #RCL_RET_ERROR if an unspecified error occurs.
+ */
+RCL_PUBLIC
+RCL_WARN_UNUSED
+rcl_ret_t
+rcl_send_response_batch(
+  const rcl_service_t * service,
+  rmw_request_id_t * request_headers,
+  void ** ros_responses,
+  size_t count,
+  size_t * sent);
+
 /// Get the topic name for the service.
 /**
  * This function returns the service's internal topic name string.
@@ -571,6 +698,40 @@ rcl_service_configure_service_introspection(
   const rcl_publisher_options_t publisher_options,
   rcl_service_introspection_state_t introspection_state);
 
+/// Cap the serialized size of this service's introspection events.
+/**
+ * When a non-zero cap is set, full-contents introspection events whose
+ * serialized size exceeds \p max_payload_bytes are published in the
+ * payload-free metadata form instead, recognizable by their empty request
+ * and response sequences.
+ * This bounds the introspection overhead of services carrying large
+ * payloads without turning contents introspection off entirely.
+ * Pass 0 to remove the cap.
+ *
+ * Service introspection must already be configured on this service with
+ * rcl_service_configure_service_introspection().
+ *
+ * <hr>
+ * Attribute          | Adherence
+ * ------------------ | -------------
+ * Allocates Memory   | No
+ * Thread-Safe        | No
+ * Uses Atomics       | No
+ * Lock-Free          | Yes
+ *
+ * \param[in] service service whose introspection events should be capped
+ * \param[in] max_payload_bytes serialized event size cap, 0 for unlimited
+ * \return #RCL_RET_OK if the cap was set, or
+ * \return #RCL_RET_SERVICE_INVALID if the service is invalid, or
+ * \return #RCL_RET_ERROR if introspection is not configured on this service.
+ */
+RCL_PUBLIC
+RCL_WARN_UNUSED
+rcl_ret_t
+rcl_service_set_introspection_payload_limit(
+  rcl_service_t * service,
+  size_t max_payload_bytes);
+
 #ifdef __cplusplus
 }
 #endif
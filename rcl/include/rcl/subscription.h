@@ -22,8 +22,11 @@ extern "C"
 {
 #endif
 
+#include <stdint.h>
+
 #include "rosidl_runtime_c/message_type_support_struct.h"
 
+#include "rcl/arena.h"
 #include "rcl/event_callback.h"
 #include "rcl/macros.h"
 #include "rcl/node.h"
@@ -202,6 +205,47 @@ RCL_WARN_UNUSED
 rcl_ret_t
 rcl_subscription_fini(rcl_subscription_t * subscription, rcl_node_t * node);
 
+/// Change a subscription's history depth in place, preserving the rcl handle.
+/**
+ * Replaces the underlying rmw subscription with one created with the new
+ * depth, make-before-break: the replacement exists and can match publishers
+ * before the old one is destroyed, so the unmatched window is a single rmw
+ * call rather than a full fini/init cycle with topic name re-resolution.
+ * A coalesced new-message callback installed with
+ * rcl_subscription_set_on_new_message_callback_coalesced() is re-installed
+ * on the replacement automatically.
+ *
+ * Samples queued but not yet taken are dropped with the old rmw
+ * subscription, and QoS events initialized from this subscription as well as
+ * plain callbacks set with rcl_subscription_set_on_new_message_callback()
+ * reference the old rmw object and must be re-initialized by the caller.
+ * A wait set holding this subscription must be rebuilt before waiting again.
+ *
+ * <hr>
+ * Attribute          | Adherence
+ * ------------------ | -------------
+ * Allocates Memory   | Yes
+ * Thread-Safe        | No
+ * Uses Atomics       | No
+ * Lock-Free          | Yes
+ *
+ * \param[in] subscription Subscription to change the depth of.
+ * \param[in] node Valid node the subscription was created on.
+ * \param[in] depth New history depth, must be greater than zero.
+ * \return #RCL_RET_OK if the depth was changed (or already matched), or
+ * \return #RCL_RET_SUBSCRIPTION_INVALID if the subscription is invalid, or
+ * \return #RCL_RET_NODE_INVALID if the node is invalid, or
+ * \return #RCL_RET_INVALID_ARGUMENT if depth is zero, or
+ * \return #RCL_RET_ERROR if an unspecified error occurs.
+ */
+RCL_PUBLIC
+RCL_WARN_UNUSED
+rcl_ret_t
+rcl_subscription_set_qos_depth(
+  rcl_subscription_t * subscription,
+  rcl_node_t * node,
+  size_t depth);
+
 /// Return the default subscription options in a rcl_subscription_options_t.
 /**
  * The defaults are:
@@ -382,6 +426,17 @@ rcl_subscription_is_cft_enabled(const rcl_subscription_t * subscription);
  * This function will set a filter expression and an array of expression parameters
  * for the given subscription.
  *
+ * When the middleware does not support content filtering, a fallback engine
+ * compiles expressions of the restricted form
+ * `@<offset>,<width> <op> <constant>` — an integer field addressed by byte
+ * offset within the serialized CDR body, width 1, 2, 4 or 8 and op one of
+ * ==, !=, <, <=, > or >= (e.g. "@4,4 >= 100") — and rcl_take() then
+ * evaluates it against the raw serialized buffer, dropping non-matching
+ * samples before the message is deserialized.
+ * Expressions outside that grammar still return #RCL_RET_UNSUPPORTED on
+ * such middlewares; expression parameters are not substituted by the
+ * fallback engine.
+ *
  * <hr>
  * Attribute          | Adherence
  * ------------------ | -------------
@@ -555,6 +610,54 @@ rcl_take_sequence(
   rmw_subscription_allocation_t * allocation
 );
 
+/// Take a batch of messages into caller-provided arrays.
+/**
+ * Drains up to `max_messages` queued messages in a single pass, validating
+ * the subscription once and issuing a single middleware take, so bursts on
+ * high-rate topics do not pay a full rcl round-trip per message.
+ * It behaves like rcl_take_sequence() but takes plain arrays instead of
+ * pre-initialized rmw sequence structures: the caller arrays are wrapped in
+ * stack-resident sequence views, so no sequence init/fini or allocation is
+ * involved.
+ *
+ * The `ros_messages` array must hold `max_messages` pointers, each pointing
+ * to an allocated ROS message of the subscription's type; the
+ * `message_infos` array must hold `max_messages` entries.
+ * Only the first `*taken` entries of either array are valid on return.
+ *
+ * <hr>
+ * Attribute          | Adherence
+ * ------------------ | -------------
+ * Allocates Memory   | Maybe [1]
+ * Thread-Safe        | No
+ * Uses Atomics       | No
+ * Lock-Free          | Yes
+ * <i>[1] only if required when filling the messages, avoided for fixed sizes</i>
+ *
+ * \param[in] subscription the handle to the subscription from which to take
+ * \param[inout] ros_messages array of type-erased pointers to allocated ROS messages
+ * \param[out] message_infos array receiving per-message meta-data
+ * \param[in] max_messages capacity of both arrays, must be greater than zero
+ * \param[out] taken set to the number of messages actually taken
+ * \return #RCL_RET_OK if one or more messages was taken, or
+ * \return #RCL_RET_INVALID_ARGUMENT if any arguments are invalid, or
+ * \return #RCL_RET_SUBSCRIPTION_INVALID if the subscription is invalid, or
+ * \return #RCL_RET_BAD_ALLOC if allocating memory failed, or
+ * \return #RCL_RET_SUBSCRIPTION_TAKE_FAILED if take failed but no error
+ *         occurred in the middleware, or
+ * \return #RCL_RET_ERROR if an unspecified error occurs.
+ */
+RCL_PUBLIC
+RCL_WARN_UNUSED
+rcl_ret_t
+rcl_take_batch(
+  const rcl_subscription_t * subscription,
+  void ** ros_messages,
+  rmw_message_info_t * message_infos,
+  size_t max_messages,
+  size_t * taken
+);
+
 /// Take a serialized raw message from a topic using a rcl subscription.
 /**
  * In contrast to rcl_take(), this function stores the taken message in
@@ -600,6 +703,181 @@ rcl_take_serialized_message(
   rmw_message_info_t * message_info,
   rmw_subscription_allocation_t * allocation);
 
+/// Take a message, staging its serialized form in a caller-provided arena.
+/**
+ * Behaves like rcl_take(), except that the serialized representation of the
+ * sample is staged in memory bump-allocated from `arena` instead of a
+ * heap-allocated buffer, before being deserialized into `ros_message`.
+ * The staging buffer is never individually freed: resetting or finalizing
+ * the arena after the callback returns reclaims the storage of every take
+ * wholesale, so a callback-loop arena can absorb the per-take
+ * allocate/free churn of variable-size topics.
+ *
+ * Note that the fields of `ros_message` itself (strings, sequences) are
+ * still allocated by the type support during deserialization, since the
+ * middleware's deserialize entry point takes no allocator; only the
+ * serialized staging buffer is arena-backed.
+ *
+ * <hr>
+ * Attribute          | Adherence
+ * ------------------ | -------------
+ * Allocates Memory   | Yes [1]
+ * Thread-Safe        | No
+ * Uses Atomics       | No
+ * Lock-Free          | Yes
+ * <i>[1] from the arena, plus type support allocations for message fields</i>
+ *
+ * \param[in] subscription the handle to the subscription from which to take
+ * \param[inout] arena initialized arena the serialized sample is staged in
+ * \param[inout] ros_message type-erased pointer to an allocated ROS message
+ * \param[out] message_info rmw struct which contains meta-data for the message
+ * \return #RCL_RET_OK if the message was taken, or
+ * \return #RCL_RET_INVALID_ARGUMENT if any arguments are invalid, or
+ * \return #RCL_RET_SUBSCRIPTION_INVALID if the subscription is invalid, or
+ * \return #RCL_RET_BAD_ALLOC if the arena could not satisfy the staging
+ *         buffer, or
+ * \return #RCL_RET_SUBSCRIPTION_TAKE_FAILED if take failed but no error
+ *         occurred in the middleware, or
+ * \return #RCL_RET_ERROR if an unspecified error occurs.
+ */
+RCL_PUBLIC
+RCL_WARN_UNUSED
+rcl_ret_t
+rcl_take_arena(
+  const rcl_subscription_t * subscription,
+  rcl_arena_t * arena,
+  void * ros_message,
+  rmw_message_info_t * message_info);
+
+/// Initialize the serialized buffer lending pool for a subscription.
+/**
+ * Attaches `depth` reusable serialized buffers to the subscription, enabling
+ * rcl_take_lent_serialized_message().
+ * Each buffer's storage is retained across loans, so once the pool has grown
+ * to the topic's sample size the lending take path performs no allocations —
+ * unlike rcl_take_serialized_message(), where the caller owns and manages
+ * the buffer.
+ * `depth` bounds how many samples the application may hold at once, e.g. the
+ * number of in-flight disk writes in a recording pipeline.
+ *
+ * The pool is released by rcl_subscription_fini() if it is still
+ * initialized.
+ *
+ * <hr>
+ * Attribute          | Adherence
+ * ------------------ | -------------
+ * Allocates Memory   | Yes
+ * Thread-Safe        | No
+ * Uses Atomics       | No
+ * Lock-Free          | Yes
+ *
+ * \param[in] subscription Subscription to attach the lending pool to.
+ * \param[in] depth Number of buffers, must be greater than zero.
+ * \return #RCL_RET_OK if the pool was initialized, or
+ * \return #RCL_RET_SUBSCRIPTION_INVALID if the subscription is invalid, or
+ * \return #RCL_RET_INVALID_ARGUMENT if depth is zero, or
+ * \return #RCL_RET_ALREADY_INIT if lending is already initialized, or
+ * \return #RCL_RET_BAD_ALLOC if allocating the pool failed.
+ */
+RCL_PUBLIC
+RCL_WARN_UNUSED
+rcl_ret_t
+rcl_subscription_init_serialized_lending(
+  rcl_subscription_t * subscription,
+  size_t depth);
+
+/// Finalize a subscription's serialized buffer lending pool.
+/**
+ * Does nothing if lending was never initialized.
+ * All lent buffers must have been returned first.
+ *
+ * <hr>
+ * Attribute          | Adherence
+ * ------------------ | -------------
+ * Allocates Memory   | No
+ * Thread-Safe        | No
+ * Uses Atomics       | No
+ * Lock-Free          | Yes
+ *
+ * \param[in] subscription Subscription whose lending pool should be released.
+ * \return #RCL_RET_OK if the pool was finalized or none existed, or
+ * \return #RCL_RET_SUBSCRIPTION_INVALID if the subscription is invalid, or
+ * \return #RCL_RET_ERROR if lent buffers are still outstanding.
+ */
+RCL_PUBLIC
+RCL_WARN_UNUSED
+rcl_ret_t
+rcl_subscription_fini_serialized_lending(
+  rcl_subscription_t * subscription);
+
+/// Take a serialized message as a lent, subscription-owned view.
+/**
+ * In contrast to rcl_take_serialized_message(), the sample is handed back as
+ * a borrowed pointer into the subscription's lending pool (see
+ * rcl_subscription_init_serialized_lending()) instead of being copied into
+ * caller-owned storage, so consumers that only read the serialized bytes —
+ * e.g. writing them straight to disk — manage no buffers of their own.
+ * The view stays valid until it is passed to
+ * rcl_return_lent_serialized_message(); while all pool buffers are lent out,
+ * further takes fail with #RCL_RET_BAD_ALLOC until one is returned.
+ *
+ * <hr>
+ * Attribute          | Adherence
+ * ------------------ | -------------
+ * Allocates Memory   | Maybe [1]
+ * Thread-Safe        | No
+ * Uses Atomics       | No
+ * Lock-Free          | Yes
+ * <i>[1] only while a pool buffer grows to the topic's sample size</i>
+ *
+ * \param[in] subscription the handle to the subscription from which to take
+ * \param[out] serialized_message set to a lent view of the taken sample
+ * \param[out] message_info rmw struct which contains meta-data for the message
+ * \return #RCL_RET_OK if the message was taken, or
+ * \return #RCL_RET_INVALID_ARGUMENT if any arguments are invalid or lending
+ *         is not initialized, or
+ * \return #RCL_RET_SUBSCRIPTION_INVALID if the subscription is invalid, or
+ * \return #RCL_RET_BAD_ALLOC if all lent buffers are outstanding, or
+ * \return #RCL_RET_SUBSCRIPTION_TAKE_FAILED if take failed but no error
+ *         occurred in the middleware, or
+ * \return #RCL_RET_ERROR if an unspecified error occurs.
+ */
+RCL_PUBLIC
+RCL_WARN_UNUSED
+rcl_ret_t
+rcl_take_lent_serialized_message(
+  const rcl_subscription_t * subscription,
+  const rcl_serialized_message_t ** serialized_message,
+  rmw_message_info_t * message_info);
+
+/// Return a lent serialized message to its subscription.
+/**
+ * Marks the pool buffer as available again; its storage is kept for the next
+ * loan.
+ * The view must not be used after this call.
+ *
+ * <hr>
+ * Attribute          | Adherence
+ * ------------------ | -------------
+ * Allocates Memory   | No
+ * Thread-Safe        | No
+ * Uses Atomics       | No
+ * Lock-Free          | Yes
+ *
+ * \param[in] subscription the subscription the view was lent from
+ * \param[in] serialized_message the lent view to return
+ * \return #RCL_RET_OK if the view was returned, or
+ * \return #RCL_RET_INVALID_ARGUMENT if the view does not belong to the
+ *         subscription or was not lent out, or
+ * \return #RCL_RET_SUBSCRIPTION_INVALID if the subscription is invalid.
+ */
+RCL_PUBLIC
+RCL_WARN_UNUSED
+rcl_ret_t
+rcl_return_lent_serialized_message(
+  const rcl_subscription_t * subscription,
+  const rcl_serialized_message_t * serialized_message);
+
 /// Take a dynamic type message from a topic using a rcl subscription.
 /**
  * In contrast to rcl_take(), this function takes a dynamic type message with dynamic data taken
@@ -638,6 +916,229 @@ rcl_take_dynamic_message(
   rmw_message_info_t * message_info,
   rmw_subscription_allocation_t * allocation);
 
+/// Receive-queue statistics for a subscription.
+typedef struct rcl_subscription_queue_stats_s
+{
+  /// Total number of messages successfully taken.
+  uint64_t messages_taken;
+  /// Messages drained since the queue was last observed empty.
+  /**
+   * An estimate of current queue occupancy as seen from the take side; it is
+   * reset whenever a take finds the queue empty.
+   */
+  uint64_t current_queued_estimate;
+  /// Largest value current_queued_estimate has reached.
+  /**
+   * Compare against the QoS depth to see how close the subscription has come
+   * to overflowing.
+   */
+  uint64_t high_water_mark;
+  /// Total messages the middleware reported lost.
+  /**
+   * Fed by the message-lost QoS event; only updated while an
+   * #RCL_SUBSCRIPTION_MESSAGE_LOST event is initialized on the subscription
+   * and taken by the application.
+   */
+  uint64_t messages_lost;
+} rcl_subscription_queue_stats_t;
+
+/// Get the receive-queue statistics of a subscription.
+/**
+ * Reports take-side accounting maintained by every take variant, plus losses
+ * observed through the message-lost QoS event, so backpressure can be
+ * detected before the QoS depth overflows.
+ * The queued count and high-water mark are estimates derived from drain
+ * bursts: the middleware exposes no direct queue-occupancy query, so rcl
+ * counts how many messages each burst of takes drains before finding the
+ * queue empty.
+ *
+ * <hr>
+ * Attribute          | Adherence
+ * ------------------ | -------------
+ * Allocates Memory   | No
+ * Thread-Safe        | No
+ * Uses Atomics       | No
+ * Lock-Free          | Yes
+ *
+ * \param[in] subscription the subscription to inspect
+ * \param[out] stats filled with the current statistics
+ * \return #RCL_RET_OK if the statistics were read, or
+ * \return #RCL_RET_SUBSCRIPTION_INVALID if the subscription is invalid, or
+ * \return #RCL_RET_INVALID_ARGUMENT if stats is null.
+ */
+RCL_PUBLIC
+RCL_WARN_UNUSED
+rcl_ret_t
+rcl_subscription_get_queue_stats(
+  const rcl_subscription_t * subscription,
+  rcl_subscription_queue_stats_t * stats);
+
+/// Callback invoked from the take path when a publication sequence gap is seen.
+/**
+ * \param[in] user_data the pointer given to rcl_subscription_init_gap_tracking()
+ * \param[in] missed_count number of sequence numbers skipped by the gap
+ */
+typedef void (* rcl_subscription_gap_callback_t)(
+  const void * user_data,
+  uint64_t missed_count);
+
+/// Enable per-publisher sequence gap detection on a subscription's take path.
+/**
+ * Middleware message info already carries per-publisher publication sequence
+ * numbers; this tracks the last seen number for each publisher GID in a small
+ * open-addressing table and counts any skipped numbers as detected gaps, so
+ * loss can be observed without an application-level sequence field.
+ * `callback` (may be NULL) is invoked from within the take call whenever a
+ * gap is detected, with the number of missed samples.
+ *
+ * Publishers beyond `max_publishers` distinct GIDs are not tracked, and
+ * samples whose middleware does not report publication sequence numbers are
+ * ignored.
+ *
+ * <hr>
+ * Attribute          | Adherence
+ * ------------------ | -------------
+ * Allocates Memory   | Yes
+ * Thread-Safe        | No
+ * Uses Atomics       | No
+ * Lock-Free          | Yes
+ *
+ * \param[in] subscription Subscription to enable gap tracking on.
+ * \param[in] max_publishers Capacity of the tracking table, must be greater
+ *   than zero.
+ * \param[in] callback Invoked on each detected gap, or NULL for counting only.
+ * \param[in] user_data Passed through to the callback, may be NULL.
+ * \return #RCL_RET_OK if gap tracking was enabled, or
+ * \return #RCL_RET_SUBSCRIPTION_INVALID if the subscription is invalid, or
+ * \return #RCL_RET_INVALID_ARGUMENT if max_publishers is zero, or
+ * \return #RCL_RET_ALREADY_INIT if gap tracking is already enabled, or
+ * \return #RCL_RET_BAD_ALLOC if allocating the table failed.
+ */
+RCL_PUBLIC
+RCL_WARN_UNUSED
+rcl_ret_t
+rcl_subscription_init_gap_tracking(
+  rcl_subscription_t * subscription,
+  size_t max_publishers,
+  rcl_subscription_gap_callback_t callback,
+  const void * user_data);
+
+/// Disable sequence gap detection, releasing the tracking table.
+/**
+ * Does nothing if gap tracking was never enabled.
+ *
+ * <hr>
+ * Attribute          | Adherence
+ * ------------------ | -------------
+ * Allocates Memory   | No
+ * Thread-Safe        | No
+ * Uses Atomics       | No
+ * Lock-Free          | Yes
+ *
+ * \param[in] subscription Subscription to disable gap tracking on.
+ * \return #RCL_RET_OK if gap tracking was disabled or never enabled, or
+ * \return #RCL_RET_SUBSCRIPTION_INVALID if the subscription is invalid.
+ */
+RCL_PUBLIC
+RCL_WARN_UNUSED
+rcl_ret_t
+rcl_subscription_fini_gap_tracking(rcl_subscription_t * subscription);
+
+/// Get the total number of samples lost to detected sequence gaps.
+/**
+ * <hr>
+ * Attribute          | Adherence
+ * ------------------ | -------------
+ * Allocates Memory   | No
+ * Thread-Safe        | No
+ * Uses Atomics       | No
+ * Lock-Free          | Yes
+ *
+ * \param[in] subscription Subscription to read the gap count from.
+ * \param[out] missed_count total samples skipped across all tracked publishers
+ * \return #RCL_RET_OK if the count was read, or
+ * \return #RCL_RET_SUBSCRIPTION_INVALID if the subscription is invalid, or
+ * \return #RCL_RET_INVALID_ARGUMENT if missed_count is null.
+ */
+RCL_PUBLIC
+RCL_WARN_UNUSED
+rcl_ret_t
+rcl_subscription_get_detected_gaps(
+  const rcl_subscription_t * subscription,
+  uint64_t * missed_count);
+
+/// Initialize a fallback loan pool for a subscription.
+/**
+ * Middleware implementations without shared memory support return
+ * #RCL_RET_UNSUPPORTED from rcl_take_loaned_message(), forcing callers to
+ * keep a second, deep-copying take strategy around.
+ * With a loan pool initialized, rcl_take_loaned_message() always succeeds
+ * when a message is available: when the rmw layer cannot loan, the message is
+ * taken into a fixed-size per-subscription pool block which the application
+ * releases via rcl_return_loaned_message_from_subscription(), so the
+ * caller's path is allocation-free on every rmw vendor.
+ * When the rmw layer can loan, the pool is left unused and real loans are
+ * handed out as before.
+ *
+ * The pool hands out zero-initialized storage and never runs message
+ * constructors, so it is only suitable for self-contained (plain-old-data)
+ * message types without unbounded fields; the caller provides the message
+ * size, typically `sizeof()` of the concrete message type, and sizes the
+ * capacity from the QoS depth plus the number of messages held across
+ * callbacks.
+ *
+ * The pool is deallocated by rcl_subscription_fini() if it is still
+ * initialized.
+ *
+ * <hr>
+ * Attribute          | Adherence
+ * ------------------ | -------------
+ * Allocates Memory   | Yes
+ * Thread-Safe        | No
+ * Uses Atomics       | No
+ * Lock-Free          | Yes
+ *
+ * \param[in] subscription Subscription to attach the pool to.
+ * \param[in] message_size Size of one message in bytes, must be greater than zero.
+ * \param[in] capacity Number of messages the pool holds, must be greater than zero.
+ * \return #RCL_RET_OK if the pool was initialized, or
+ * \return #RCL_RET_SUBSCRIPTION_INVALID if the subscription is invalid, or
+ * \return #RCL_RET_INVALID_ARGUMENT if message_size or capacity is zero, or
+ * \return #RCL_RET_ALREADY_INIT if the subscription already has a pool, or
+ * \return #RCL_RET_BAD_ALLOC if allocating the pool failed.
+ */
+RCL_PUBLIC
+RCL_WARN_UNUSED
+rcl_ret_t
+rcl_subscription_init_loan_pool(
+  rcl_subscription_t * subscription,
+  size_t message_size,
+  size_t capacity);
+
+/// Finalize a subscription's fallback loan pool.
+/**
+ * Does nothing if the subscription has no pool.
+ * All taken pool messages must have been returned first.
+ *
+ * <hr>
+ * Attribute          | Adherence
+ * ------------------ | -------------
+ * Allocates Memory   | No
+ * Thread-Safe        | No
+ * Uses Atomics       | No
+ * Lock-Free          | Yes
+ *
+ * \param[in] subscription Subscription whose pool should be released.
+ * \return #RCL_RET_OK if the pool was finalized or none existed, or
+ * \return #RCL_RET_SUBSCRIPTION_INVALID if the subscription is invalid, or
+ * \return #RCL_RET_ERROR if pool messages are still outstanding.
+ */
+RCL_PUBLIC
+RCL_WARN_UNUSED
+rcl_ret_t
+rcl_subscription_fini_loan_pool(
+  rcl_subscription_t * subscription);
+
 /// Take a loaned message from a topic using a rcl subscription.
 /**
  * Depending on the middleware, incoming messages can be loaned to the user's callback
@@ -645,6 +1146,8 @@ rcl_take_dynamic_message(
  * The implicit contract here is that the middleware owns the memory allocated for this message.
  * The user must not destroy the message, but rather has to return it with a call to
  * \sa rcl_return_loaned_message to the middleware.
+ * If a fallback loan pool is initialized, messages are served from it when
+ * the middleware cannot loan, see rcl_subscription_init_loan_pool().
  *
  * <hr>
  * Attribute          | Adherence
@@ -817,6 +1320,10 @@ rcl_subscription_is_valid(const rcl_subscription_t * subscription);
 /**
  * Used to get the internal count of publishers matched to a subscription.
  *
+ * While a #RCL_SUBSCRIPTION_MATCHED event is initialized on the subscription
+ * the count is served from a cache kept current by taken matched events, and
+ * no call into the rmw layer is made; otherwise the rmw layer is queried.
+ *
  * <hr>
  * Attribute          | Adherence
  * ------------------ | -------------
@@ -910,6 +1417,76 @@ rcl_subscription_set_on_new_message_callback(
   rcl_event_callback_t callback,
   const void * user_data);
 
+/// Set a coalescing on new message callback for the subscription.
+/**
+ * Like rcl_subscription_set_on_new_message_callback(), but arrival
+ * notifications are coalesced before reaching the callback: the pending
+ * count accumulates atomically, and the callback fires at most once per
+ * `interval_ns` of steady time, carrying everything accumulated since it
+ * last fired.
+ * On a 10 kHz topic with a 1 ms interval this turns ten thousand trampoline
+ * invocations per second into at most one thousand, each reporting its
+ * batch size.
+ *
+ * Counts accumulated while the rate limit holds are delivered by the next
+ * arrival after the interval elapses, or immediately via
+ * rcl_subscription_flush_coalesced_callback() — an event-driven executor
+ * typically calls the latter once per wake.
+ * Passing a NULL `callback` clears the coalesced callback.
+ * An interval of zero delivers on every arrival, differing from the plain
+ * callback only in that a flush is possible.
+ *
+ * <hr>
+ * Attribute          | Adherence
+ * ------------------ | -------------
+ * Allocates Memory   | No
+ * Thread-Safe        | Yes
+ * Uses Atomics       | Yes
+ * Lock-Free          | Yes
+ *
+ * \param[in] subscription The subscription on which to set the callback
+ * \param[in] callback The callback called with the accumulated count, may be NULL
+ * \param[in] user_data Given to the callback when called later, may be NULL
+ * \param[in] interval_ns Minimum steady-time gap between callback invocations
+ * \return #RCL_RET_OK if successful, or
+ * \return #RCL_RET_INVALID_ARGUMENT if `subscription` is NULL, or
+ * \return #RCL_RET_UNSUPPORTED if the API is not implemented in the dds implementation
+ */
+RCL_PUBLIC
+RCL_WARN_UNUSED
+rcl_ret_t
+rcl_subscription_set_on_new_message_callback_coalesced(
+  const rcl_subscription_t * subscription,
+  rcl_event_callback_t callback,
+  const void * user_data,
+  uint64_t interval_ns);
+
+/// Deliver any pending coalesced new-message count immediately.
+/**
+ * Invokes the coalesced callback with the accumulated count if it is
+ * non-zero, regardless of the rate limit, and resets the accumulator.
+ * Intended to be called from the executor's wakeup path so counts held back
+ * by the interval are never delayed past a wake.
+ *
+ * <hr>
+ * Attribute          | Adherence
+ * ------------------ | -------------
+ * Allocates Memory   | No
+ * Thread-Safe        | Yes
+ * Uses Atomics       | Yes
+ * Lock-Free          | Yes
+ *
+ * \param[in] subscription The subscription whose pending count to deliver
+ * \return #RCL_RET_OK if the pending count was delivered or none was pending, or
+ * \return #RCL_RET_INVALID_ARGUMENT if `subscription` is NULL or no
+ *         coalesced callback is installed.
+ */
+RCL_PUBLIC
+RCL_WARN_UNUSED
+rcl_ret_t
+rcl_subscription_flush_coalesced_callback(
+  const rcl_subscription_t * subscription);
+
 #ifdef __cplusplus
 }
 #endif
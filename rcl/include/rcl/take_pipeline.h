@@ -0,0 +1,262 @@
+// Copyright 2026 Open Source Robotics Foundation, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/// @file
+
+#ifndef RCL__TAKE_PIPELINE_H_
+#define RCL__TAKE_PIPELINE_H_
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+#include <stddef.h>
+
+#include "rcl/allocator.h"
+#include "rcl/context.h"
+#include "rcl/guard_condition.h"
+#include "rcl/macros.h"
+#include "rcl/subscription.h"
+#include "rcl/types.h"
+#include "rcl/visibility_control.h"
+
+typedef struct rcl_take_pipeline_impl_s rcl_take_pipeline_impl_t;
+
+/// A staged take pipeline that overlaps middleware take and deserialization.
+/**
+ * rcl_take() runs take and deserialize back to back in the calling thread,
+ * so for high-rate subscriptions with large messages the dispatching thread
+ * pays the full deserialization cost between samples.
+ * The pipeline splits the two stages over a fixed set of slots cycling
+ * through three lock-free rings:
+ *
+ * - rcl_take_pipeline_pump() drains serialized samples from the middleware
+ *   into free slots,
+ * - rcl_take_pipeline_decode() deserializes pumped slots ahead of demand,
+ * - rcl_take_pipeline_take_message() pops a ready deserialized message for
+ *   dispatch, and rcl_take_pipeline_return_message() recycles its slot.
+ *
+ * rcl owns no threads, so the stages are caller-driven: application worker
+ * threads call pump and decode concurrently (the rings use the same
+ * slot-sequence claim protocol as the other bounded rings in rcl), while
+ * the executor thread consumes ready messages.
+ * A guard condition is triggered for every decoded message, so the
+ * consuming wait set wakes without polling the pipeline.
+ *
+ * When every slot is in flight the pump stops taking and samples queue in
+ * the middleware as they would without the pipeline; backpressure degrades
+ * to plain rcl_take() behavior, never drops.
+ */
+typedef struct rcl_take_pipeline_s
+{
+  /// Private implementation pointer.
+  rcl_take_pipeline_impl_t * impl;
+} rcl_take_pipeline_t;
+
+/// Return a rcl_take_pipeline_t struct with members initialized to `NULL`.
+RCL_PUBLIC
+RCL_WARN_UNUSED
+rcl_take_pipeline_t
+rcl_get_zero_initialized_take_pipeline(void);
+
+/// Initialize a take pipeline for a subscription.
+/**
+ * `ros_messages` provides the deserialized message storage, one allocated
+ * and initialized message of the subscription's type per slot; the caller
+ * keeps ownership and must finalize them after the pipeline is finalized.
+ * The serialized staging buffers are allocated by the pipeline and grown by
+ * the middleware as needed.
+ *
+ * The subscription, the context and the message storage must outlive the
+ * pipeline.
+ *
+ * <hr>
+ * Attribute          | Adherence
+ * ------------------ | -------------
+ * Allocates Memory   | Yes
+ * Thread-Safe        | No
+ * Uses Atomics       | No
+ * Lock-Free          | Yes
+ *
+ * \param[inout] pipeline a zero initialized pipeline to be initialized
+ * \param[in] subscription the subscription the pipeline takes from
+ * \param[in] context the context, used for the ready guard condition
+ * \param[in] ros_messages one initialized message per slot, caller owned
+ * \param[in] depth the number of slots, must be greater than zero
+ * \param[in] allocator the allocator for the slot and ring storage
+ * \return #RCL_RET_OK if the pipeline was initialized successfully, or
+ * \return #RCL_RET_ALREADY_INIT if the pipeline is already initialized, or
+ * \return #RCL_RET_SUBSCRIPTION_INVALID if the subscription is invalid, or
+ * \return #RCL_RET_INVALID_ARGUMENT if any arguments are invalid or depth
+ *   is zero, or
+ * \return #RCL_RET_BAD_ALLOC if allocating memory failed, or
+ * \return #RCL_RET_ERROR if an unspecified error occurs.
+ */
+RCL_PUBLIC
+RCL_WARN_UNUSED
+rcl_ret_t
+rcl_take_pipeline_init(
+  rcl_take_pipeline_t * pipeline,
+  const rcl_subscription_t * subscription,
+  rcl_context_t * context,
+  void ** ros_messages,
+  size_t depth,
+  rcl_allocator_t allocator);
+
+/// Finalize a take pipeline.
+/**
+ * Must not race the pipeline stages; quiesce the pump and decode workers
+ * first.
+ * The caller-owned message storage is not finalized.
+ *
+ * \param[inout] pipeline the pipeline to finalize
+ * \return #RCL_RET_OK if the pipeline was finalized, or
+ * \return #RCL_RET_INVALID_ARGUMENT if pipeline is null.
+ */
+RCL_PUBLIC
+RCL_WARN_UNUSED
+rcl_ret_t
+rcl_take_pipeline_fini(rcl_take_pipeline_t * pipeline);
+
+/// Drain serialized samples from the middleware into free slots.
+/**
+ * Takes until the middleware queue is empty or no free slot remains.
+ * Safe to call from any number of pump threads concurrently.
+ *
+ * <hr>
+ * Attribute          | Adherence
+ * ------------------ | -------------
+ * Allocates Memory   | Maybe [1]
+ * Thread-Safe        | Yes
+ * Uses Atomics       | Yes
+ * Lock-Free          | Yes
+ * <i>[1] the middleware may grow a slot's staging buffer</i>
+ *
+ * \param[in] pipeline the pipeline to pump
+ * \param[out] taken set to the number of samples staged
+ * \return #RCL_RET_OK if one or more samples were staged, or
+ * \return #RCL_RET_SUBSCRIPTION_TAKE_FAILED if no sample was available or
+ *   no free slot remained, or
+ * \return #RCL_RET_INVALID_ARGUMENT if any arguments are invalid, or
+ * \return #RCL_RET_NOT_INIT if the pipeline is zero initialized, or
+ * \return #RCL_RET_ERROR if an unspecified error occurs.
+ */
+RCL_PUBLIC
+RCL_WARN_UNUSED
+rcl_ret_t
+rcl_take_pipeline_pump(rcl_take_pipeline_t * pipeline, size_t * taken);
+
+/// Deserialize pumped slots ahead of demand.
+/**
+ * Pops staged serialized samples and deserializes each into its slot's
+ * message storage until no staged sample remains.
+ * Safe to call from any number of decode threads concurrently; the ready
+ * guard condition is triggered once per decoded message.
+ *
+ * <hr>
+ * Attribute          | Adherence
+ * ------------------ | -------------
+ * Allocates Memory   | Maybe [1]
+ * Thread-Safe        | Yes
+ * Uses Atomics       | Yes
+ * Lock-Free          | Yes
+ * <i>[1] deserialization may allocate inside the message storage</i>
+ *
+ * \param[in] pipeline the pipeline to decode for
+ * \param[out] decoded set to the number of messages deserialized
+ * \return #RCL_RET_OK if one or more messages were deserialized, or
+ * \return #RCL_RET_SUBSCRIPTION_TAKE_FAILED if no staged sample remained, or
+ * \return #RCL_RET_INVALID_ARGUMENT if any arguments are invalid, or
+ * \return #RCL_RET_NOT_INIT if the pipeline is zero initialized, or
+ * \return #RCL_RET_ERROR if deserialization or an unspecified error occurs.
+ */
+RCL_PUBLIC
+RCL_WARN_UNUSED
+rcl_ret_t
+rcl_take_pipeline_decode(rcl_take_pipeline_t * pipeline, size_t * decoded);
+
+/// Pop one ready deserialized message.
+/**
+ * The returned message borrows its slot; hand it back with
+ * rcl_take_pipeline_return_message() once dispatch is done, or no pump will
+ * ever reuse the slot.
+ *
+ * <hr>
+ * Attribute          | Adherence
+ * ------------------ | -------------
+ * Allocates Memory   | No
+ * Thread-Safe        | Yes
+ * Uses Atomics       | Yes
+ * Lock-Free          | Yes
+ *
+ * \param[in] pipeline the pipeline to take from
+ * \param[out] ros_message set to the deserialized message
+ * \param[out] message_info message info of the sample, may be NULL
+ * \return #RCL_RET_OK if a message was taken, or
+ * \return #RCL_RET_SUBSCRIPTION_TAKE_FAILED if no ready message was
+ *   available, or
+ * \return #RCL_RET_INVALID_ARGUMENT if any arguments are invalid, or
+ * \return #RCL_RET_NOT_INIT if the pipeline is zero initialized.
+ */
+RCL_PUBLIC
+RCL_WARN_UNUSED
+rcl_ret_t
+rcl_take_pipeline_take_message(
+  rcl_take_pipeline_t * pipeline,
+  void ** ros_message,
+  rmw_message_info_t * message_info);
+
+/// Recycle the slot of a message taken with rcl_take_pipeline_take_message().
+/**
+ * <hr>
+ * Attribute          | Adherence
+ * ------------------ | -------------
+ * Allocates Memory   | No
+ * Thread-Safe        | Yes
+ * Uses Atomics       | Yes
+ * Lock-Free          | Yes
+ *
+ * \param[in] pipeline the pipeline the message was taken from
+ * \param[in] ros_message the message to hand back
+ * \return #RCL_RET_OK if the slot was recycled, or
+ * \return #RCL_RET_INVALID_ARGUMENT if any arguments are invalid or the
+ *   message does not belong to the pipeline, or
+ * \return #RCL_RET_NOT_INIT if the pipeline is zero initialized.
+ */
+RCL_PUBLIC
+RCL_WARN_UNUSED
+rcl_ret_t
+rcl_take_pipeline_return_message(
+  rcl_take_pipeline_t * pipeline,
+  const void * ros_message);
+
+/// Get the guard condition triggered when a decoded message becomes ready.
+/**
+ * Add it to the consuming wait set so the executor wakes on ready messages
+ * instead of polling rcl_take_pipeline_take_message().
+ *
+ * \param[in] pipeline the pipeline to query
+ * \return the ready guard condition, or `NULL` if the pipeline is invalid.
+ */
+RCL_PUBLIC
+RCL_WARN_UNUSED
+const rcl_guard_condition_t *
+rcl_take_pipeline_get_guard_condition(const rcl_take_pipeline_t * pipeline);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif  // RCL__TAKE_PIPELINE_H_
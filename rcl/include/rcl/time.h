@@ -57,6 +57,10 @@ typedef rcutils_duration_value_t rcl_duration_value_t;
  * RCL_SYSTEM_TIME reports the same value as the system clock.
  *
  * RCL_STEADY_TIME reports a value from a monotonically increasing clock.
+ *
+ * RCL_COARSE_TIME reports a cached time point that is refreshed only when
+ * rcl_coarse_clock_update() is called, trading resolution for a read that is
+ * a single atomic load. See rcl_coarse_clock_init().
  */
 typedef enum rcl_clock_type_e
 {
@@ -67,7 +71,9 @@ typedef enum rcl_clock_type_e
   /// Use system time
   RCL_SYSTEM_TIME,
   /// Use a steady clock time
-  RCL_STEADY_TIME
+  RCL_STEADY_TIME,
+  /// Use an explicitly updated, cached time
+  RCL_COARSE_TIME
 } rcl_clock_type_t;
 
 /// A duration of time, measured in nanoseconds and its source.
@@ -142,6 +148,22 @@ typedef struct rcl_clock_s
   rcl_jump_callback_info_t * jump_callbacks;
   /// Number of callbacks in jump_callbacks.
   size_t num_jump_callbacks;
+  /// Allocated capacity of jump_callbacks, managed internally.
+  size_t jump_callbacks_capacity;
+  /// Threshold-sorted index over jump_callbacks, managed internally.
+  /**
+   * Entries with a forward threshold sorted by ascending threshold, followed
+   * by entries with a backward threshold sorted by descending threshold,
+   * followed by entries with on_clock_change set, so a jump only evaluates
+   * the callbacks whose thresholds it can cross.
+   */
+  size_t * jump_callback_index;
+  /// Number of forward-threshold entries at the start of jump_callback_index.
+  size_t num_forward_jump_callbacks;
+  /// Number of backward-threshold entries following the forward entries.
+  size_t num_backward_jump_callbacks;
+  /// Number of clock-change entries following the backward entries.
+  size_t num_clock_change_jump_callbacks;
   /// Pointer to get_now function
   rcl_ret_t (* get_now)(void * data, rcl_time_point_value_t * now);
   // void (*set_now) (rcl_time_point_value_t);
@@ -471,6 +493,107 @@ rcl_ret_t
 rcl_system_clock_fini(
   rcl_clock_t * clock);
 
+/// Initialize a clock as a #RCL_COARSE_TIME time source.
+/**
+ * This will allocate all necessary internal structures, and initialize variables.
+ * A coarse clock reports a cached time point: rcl_clock_get_now() is a single
+ * atomic load, and the cached value only advances when
+ * rcl_coarse_clock_update() samples the underlying time source.
+ * The caller decides the resolution by choosing how often an owned thread or
+ * loop calls the update function, e.g. every millisecond; in between updates
+ * every reader observes the same time point.
+ * This is intended for very hot paths, such as stamping outgoing messages,
+ * that can trade resolution for avoiding a time syscall per read.
+ *
+ * The cache is seeded with one sample of the underlying source during init,
+ * so the clock never reports 0.
+ *
+ * <hr>
+ * Attribute          | Adherence
+ * ------------------ | -------------
+ * Allocates Memory   | Yes
+ * Thread-Safe        | No [1]
+ * Uses Atomics       | Yes
+ * Lock-Free          | Yes
+ *
+ * <i>[1] Function is reentrant, but concurrent calls on the same `clock` object are not safe.
+ *        Thread-safety is also affected by that of the `allocator` object.</i>
+ *
+ * \param[in] clock the handle to the clock which is being initialized
+ * \param[in] source_type the time source sampled by updates, either
+ *   #RCL_SYSTEM_TIME or #RCL_STEADY_TIME
+ * \param[in] allocator The allocator to use for allocations
+ * \return #RCL_RET_OK if the time source was successfully initialized, or
+ * \return #RCL_RET_INVALID_ARGUMENT if any arguments are invalid, or
+ * \return #RCL_RET_BAD_ALLOC if allocating memory failed, or
+ * \return #RCL_RET_ERROR an unspecified error occur.
+ */
+RCL_PUBLIC
+RCL_WARN_UNUSED
+rcl_ret_t
+rcl_coarse_clock_init(
+  rcl_clock_t * clock,
+  rcl_clock_type_t source_type,
+  rcl_allocator_t * allocator);
+
+/// Finalize a clock as a #RCL_COARSE_TIME time source.
+/**
+ * This will deallocate all necessary internal structures, and clean up any variables.
+ * It is expected to be paired with the init fuction.
+ *
+ * This function is not thread-safe with any other function operating on the same
+ * clock object.
+ *
+ * <hr>
+ * Attribute          | Adherence
+ * ------------------ | -------------
+ * Allocates Memory   | No
+ * Thread-Safe        | No [1]
+ * Uses Atomics       | No
+ * Lock-Free          | Yes
+ *
+ * <i>[1] Function is reentrant, but concurrent calls on the same `clock` object are not safe.
+ *        Thread-safety is also affected by that of the `allocator` object associated with the
+ *        `clock` object.</i>
+ *
+ * \param[in] clock the handle to the clock which is being finalized
+ * \return #RCL_RET_OK if the time source was successfully finalized, or
+ * \return #RCL_RET_INVALID_ARGUMENT if any arguments are invalid, or
+ * \return #RCL_RET_ERROR an unspecified error occur.
+ */
+RCL_PUBLIC
+RCL_WARN_UNUSED
+rcl_ret_t
+rcl_coarse_clock_fini(
+  rcl_clock_t * clock);
+
+/// Refresh the cached time point of a #RCL_COARSE_TIME clock.
+/**
+ * Samples the time source the clock was initialized with and publishes the
+ * result to all readers of the clock with a single atomic store.
+ * This is expected to be called periodically, from a thread owned by the
+ * caller, at whatever rate matches the resolution the readers can tolerate.
+ *
+ * <hr>
+ * Attribute          | Adherence
+ * ------------------ | -------------
+ * Allocates Memory   | No
+ * Thread-Safe        | Yes
+ * Uses Atomics       | Yes
+ * Lock-Free          | Yes
+ *
+ * \param[in] clock the handle to the clock which is being updated
+ * \return #RCL_RET_OK if the cached time was updated successfully, or
+ * \return #RCL_RET_INVALID_ARGUMENT if any arguments are invalid, or
+ * \return #RCL_RET_ERROR if the clock is not of type #RCL_COARSE_TIME, or
+ * \return #RCL_RET_ERROR an unspecified error occur.
+ */
+RCL_PUBLIC
+RCL_WARN_UNUSED
+rcl_ret_t
+rcl_coarse_clock_update(
+  rcl_clock_t * clock);
+
 /// Compute the difference between two time points
 /**
  * This function takes two time points and computes the duration between them.
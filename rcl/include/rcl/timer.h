@@ -235,7 +235,8 @@ rcl_timer_fini(rcl_timer_t * timer);
  * \return #RCL_RET_OK if the timer was called successfully, or
  * \return #RCL_RET_INVALID_ARGUMENT if any arguments are invalid, or
  * \return #RCL_RET_TIMER_INVALID if the timer->impl is invalid, or
- * \return #RCL_RET_TIMER_CANCELED if the timer has been canceled, or
+ * \return #RCL_RET_TIMER_CANCELED if the timer has been canceled, returned
+ *   without an error message since this is expected executor control flow, or
  * \return #RCL_RET_ERROR an unspecified error occur.
  */
 RCL_PUBLIC
@@ -243,6 +244,40 @@ RCL_WARN_UNUSED
 rcl_ret_t
 rcl_timer_call(rcl_timer_t * timer);
 
+/// Call every ready timer in an array in one pass.
+/**
+ * For each timer in the array that is ready, this behaves like
+ * rcl_timer_call(); timers that are `NULL`, canceled or not yet due are
+ * skipped without error.
+ * Readiness is evaluated against a clock sample taken once per run of
+ * timers sharing a clock, rather than once per timer, so firing a batch of
+ * k expired timers costs a single clock query in the common case of all
+ * timers using the same clock.
+ *
+ * <hr>
+ * Attribute          | Adherence
+ * ------------------ | -------------
+ * Allocates Memory   | No
+ * Thread-Safe        | Yes [1]
+ * Uses Atomics       | Yes
+ * Lock-Free          | Yes [2]
+ * <i>[1] user callbacks might not be thread-safe</i>
+ *
+ * <i>[2] if `atomic_is_lock_free()` returns true for `atomic_int_least64_t`</i>
+ *
+ * \param[inout] timers array of timers to evaluate and call, may contain `NULL` entries
+ * \param[in] number_of_timers the number of entries in `timers`
+ * \param[out] number_called the number of timers called, may be `NULL`
+ * \return #RCL_RET_OK if the ready timers were called successfully, or
+ * \return #RCL_RET_INVALID_ARGUMENT if any arguments are invalid, or
+ * \return #RCL_RET_TIMER_INVALID if a non-NULL timer->impl is invalid, or
+ * \return #RCL_RET_ERROR an unspecified error occur.
+ */
+RCL_PUBLIC
+RCL_WARN_UNUSED
+rcl_ret_t
+rcl_timers_call_ready(rcl_timer_t ** timers, size_t number_of_timers, size_t * number_called);
+
 /// Retrieve the clock of the timer.
 /**
  * This function retrieves the clock pointer and copies it into the given variable.
@@ -556,6 +591,165 @@ RCL_WARN_UNUSED
 rcl_ret_t
 rcl_timer_reset(rcl_timer_t * timer);
 
+/// Reset an array of timers with phase-staggered wakeups.
+/**
+ * Behaves like calling rcl_timer_reset() on every timer, except that all
+ * next call times are derived from a clock sample taken once per run of
+ * timers sharing a clock and each timer's first wakeup is delayed by a
+ * phase offset, so resetting hundreds of timers does not pay one clock
+ * query per timer and the timers do not all fire in the same wakeup.
+ *
+ * The timer at index i will next be due at `now + period[i] +
+ * phase_offsets[i]`; subsequent calls keep firing at the timer's period, so
+ * the offsets shift each timer's phase permanently.
+ * Offsets should normally lie in `[0, period)`; negative offsets that move
+ * the due time into the past make the timer immediately ready.
+ *
+ * If `phase_offsets` is `NULL` the phases are distributed automatically:
+ * the timer at index i receives an offset of `(period[i] / number_of_timers)
+ * * i`, spreading the wakeups of same-period timers evenly across one
+ * period.
+ *
+ * Unlike rcl_timers_call_ready(), `NULL` entries in the array are not
+ * allowed, matching the argument validation of rcl_timer_reset().
+ *
+ * <hr>
+ * Attribute          | Adherence
+ * ------------------ | -------------
+ * Allocates Memory   | No
+ * Thread-Safe        | Yes
+ * Uses Atomics       | Yes
+ * Lock-Free          | Yes [1]
+ * <i>[1] if `atomic_is_lock_free()` returns true for `atomic_int_least64_t`</i>
+ *
+ * \param[inout] timers array of timers to be reset
+ * \param[in] number_of_timers the number of entries in `timers`
+ * \param[in] phase_offsets array of `number_of_timers` per-timer offsets in
+ *   nanoseconds, or `NULL` to distribute phases across each timer's period
+ * \return #RCL_RET_OK if the timers were reset successfully, or
+ * \return #RCL_RET_INVALID_ARGUMENT if any arguments are invalid, or
+ * \return #RCL_RET_TIMER_INVALID if a timer in the array is invalid, or
+ * \return #RCL_RET_ERROR an unspecified error occur.
+ */
+RCL_PUBLIC
+RCL_WARN_UNUSED
+rcl_ret_t
+rcl_timers_reset_staggered(
+  rcl_timer_t ** timers, size_t number_of_timers, const int64_t * phase_offsets);
+
+/// A single timing sample recorded when an instrumented timer is called.
+typedef struct rcl_timer_timing_sample_s
+{
+  /// Nanoseconds between the scheduled call time and the actual call.
+  /**
+   * Positive values measure how late the callback fired relative to
+   * next_call_time; negative values indicate an early call.
+   */
+  int64_t latency;
+  /// Nanoseconds spent in the user callback, measured on the steady clock.
+  /**
+   * 0 when the timer has no callback, -1 when the steady clock could not be
+   * read around the callback.
+   */
+  int64_t callback_duration;
+} rcl_timer_timing_sample_t;
+
+/// Enable timing instrumentation on a timer.
+/**
+ * After this call, every rcl_timer_call() on the timer records a
+ * rcl_timer_timing_sample_t into a fixed-size ring buffer and increments a
+ * fire counter, at the cost of two steady clock reads and a few relaxed
+ * atomic writes per call.
+ * When the ring buffer is full the oldest samples are overwritten.
+ *
+ * This function is not thread-safe with rcl_timer_call() on the same timer;
+ * enable instrumentation before the timer starts firing, or from the thread
+ * that calls it.
+ *
+ * <hr>
+ * Attribute          | Adherence
+ * ------------------ | -------------
+ * Allocates Memory   | Yes
+ * Thread-Safe        | No
+ * Uses Atomics       | Yes
+ * Lock-Free          | Yes
+ *
+ * \param[inout] timer the timer to be instrumented
+ * \param[in] buffer_capacity number of samples retained, must be non-zero
+ * \return #RCL_RET_OK if instrumentation was enabled successfully, or
+ * \return #RCL_RET_ALREADY_INIT if instrumentation was already enabled, or
+ * \return #RCL_RET_INVALID_ARGUMENT if any arguments are invalid, or
+ * \return #RCL_RET_TIMER_INVALID if the timer is invalid, or
+ * \return #RCL_RET_BAD_ALLOC if allocating memory failed.
+ */
+RCL_PUBLIC
+RCL_WARN_UNUSED
+rcl_ret_t
+rcl_timer_enable_timing_stats(rcl_timer_t * timer, size_t buffer_capacity);
+
+/// Disable timing instrumentation on a timer.
+/**
+ * Releases the ring buffer and stops recording.
+ * Calling this on a timer without instrumentation is a no-op.
+ *
+ * This function is not thread-safe with rcl_timer_call() on the same timer.
+ *
+ * <hr>
+ * Attribute          | Adherence
+ * ------------------ | -------------
+ * Allocates Memory   | No
+ * Thread-Safe        | No
+ * Uses Atomics       | No
+ * Lock-Free          | Yes
+ *
+ * \param[inout] timer the timer to stop instrumenting
+ * \return #RCL_RET_OK if instrumentation was disabled successfully, or
+ * \return #RCL_RET_INVALID_ARGUMENT if any arguments are invalid, or
+ * \return #RCL_RET_TIMER_INVALID if the timer is invalid.
+ */
+RCL_PUBLIC
+RCL_WARN_UNUSED
+rcl_ret_t
+rcl_timer_disable_timing_stats(rcl_timer_t * timer);
+
+/// Retrieve the recorded timing samples of an instrumented timer.
+/**
+ * Copies up to `capacity` of the most recent samples into `samples`, oldest
+ * first, and reports the total number of calls recorded since
+ * instrumentation was enabled.
+ * The recording side uses only relaxed atomics, so samples read while the
+ * timer is concurrently firing may include a partially overwritten entry;
+ * read from the thread calling the timer for exact data.
+ *
+ * <hr>
+ * Attribute          | Adherence
+ * ------------------ | -------------
+ * Allocates Memory   | No
+ * Thread-Safe        | Yes [1]
+ * Uses Atomics       | Yes
+ * Lock-Free          | Yes
+ * <i>[1] concurrent recording may tear an in-flight sample, see above</i>
+ *
+ * \param[in] timer the timer to be queried
+ * \param[out] samples array with room for `capacity` samples
+ * \param[in] capacity the number of entries in `samples`
+ * \param[out] number_of_samples the number of samples copied
+ * \param[out] fire_count total calls recorded since enabling, may be `NULL`
+ * \return #RCL_RET_OK if the samples were retrieved successfully, or
+ * \return #RCL_RET_INVALID_ARGUMENT if any arguments are invalid or
+ *   instrumentation is not enabled, or
+ * \return #RCL_RET_TIMER_INVALID if the timer is invalid.
+ */
+RCL_PUBLIC
+RCL_WARN_UNUSED
+rcl_ret_t
+rcl_timer_get_timing_stats(
+  const rcl_timer_t * timer,
+  rcl_timer_timing_sample_t * samples,
+  size_t capacity,
+  size_t * number_of_samples,
+  uint64_t * fire_count);
+
 /// Return the allocator for the timer.
 /**
  * This function can fail, and therefore return `NULL`, if:
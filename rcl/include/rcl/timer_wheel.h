@@ -0,0 +1,240 @@
+// Copyright 2026 Open Source Robotics Foundation, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/// @file
+
+#ifndef RCL__TIMER_WHEEL_H_
+#define RCL__TIMER_WHEEL_H_
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#include "rcl/allocator.h"
+#include "rcl/macros.h"
+#include "rcl/time.h"
+#include "rcl/timer.h"
+#include "rcl/types.h"
+#include "rcl/visibility_control.h"
+
+typedef struct rcl_timer_wheel_impl_s rcl_timer_wheel_impl_t;
+
+/// Structure which aggregates timers and tracks their deadlines centrally.
+/**
+ * A timer wheel keeps the registered timers in a priority queue keyed on
+ * their next call time, so the next deadline and the batch of due timers can
+ * be found in time proportional to the number of expired timers rather than
+ * the number of registered timers.
+ * It is a bookkeeping layer only: the timers themselves are unmodified
+ * rcl_timer_t instances and remain owned by the caller.
+ *
+ * All registered timers must use the clock the wheel was initialized with,
+ * so that a single clock sample per query is comparable across every timer.
+ *
+ * The wheel is not thread-safe; like a wait set it is expected to be driven
+ * by a single executor thread.
+ */
+typedef struct rcl_timer_wheel_s
+{
+  /// Private implementation pointer.
+  rcl_timer_wheel_impl_t * impl;
+} rcl_timer_wheel_t;
+
+/// Return a zero initialized timer wheel.
+RCL_PUBLIC
+RCL_WARN_UNUSED
+rcl_timer_wheel_t
+rcl_get_zero_initialized_timer_wheel(void);
+
+/// Initialize a timer wheel.
+/**
+ * The timer wheel handle must be a pointer to an allocated and zero
+ * initialized rcl_timer_wheel_t struct.
+ * Calling this function on an already initialized timer wheel will fail.
+ *
+ * The clock handle must be a pointer to an initialized rcl_clock_t struct
+ * and every timer registered later must have been initialized with it.
+ * The life time of the clock must exceed the life time of the timer wheel.
+ *
+ * The initial capacity is a hint for how many timers will be registered;
+ * the storage grows geometrically when it is exceeded.
+ * A capacity of `0` defers the first allocation until a timer is added.
+ *
+ * <hr>
+ * Attribute          | Adherence
+ * ------------------ | -------------
+ * Allocates Memory   | Yes
+ * Thread-Safe        | No
+ * Uses Atomics       | No
+ * Lock-Free          | Yes
+ *
+ * \param[inout] timer_wheel the timer wheel to be initialized
+ * \param[in] clock the clock providing the current time, shared by all timers
+ * \param[in] initial_capacity the number of timer slots to preallocate
+ * \param[in] allocator the allocator to use for the internal storage
+ * \return #RCL_RET_OK if the timer wheel was initialized successfully, or
+ * \return #RCL_RET_ALREADY_INIT if the timer wheel was already initialized, or
+ * \return #RCL_RET_INVALID_ARGUMENT if any arguments are invalid, or
+ * \return #RCL_RET_BAD_ALLOC if allocating memory failed, or
+ * \return #RCL_RET_ERROR if an unspecified error occurs.
+ */
+RCL_PUBLIC
+RCL_WARN_UNUSED
+rcl_ret_t
+rcl_timer_wheel_init(
+  rcl_timer_wheel_t * timer_wheel,
+  rcl_clock_t * clock,
+  size_t initial_capacity,
+  rcl_allocator_t allocator);
+
+/// Finalize a timer wheel.
+/**
+ * Releases the internal storage; the registered timers are not finalized.
+ *
+ * \param[inout] timer_wheel the timer wheel to be finalized
+ * \return #RCL_RET_OK if the timer wheel was finalized successfully, or
+ * \return #RCL_RET_INVALID_ARGUMENT if any arguments are invalid.
+ */
+RCL_PUBLIC
+RCL_WARN_UNUSED
+rcl_ret_t
+rcl_timer_wheel_fini(rcl_timer_wheel_t * timer_wheel);
+
+/// Register a timer with the timer wheel.
+/**
+ * The timer must use the clock the wheel was initialized with and must
+ * outlive its registration; remove it before finalizing it.
+ * Registering the same timer twice will fail.
+ *
+ * <hr>
+ * Attribute          | Adherence
+ * ------------------ | -------------
+ * Allocates Memory   | Yes
+ * Thread-Safe        | No
+ * Uses Atomics       | Yes
+ * Lock-Free          | Yes
+ *
+ * \param[inout] timer_wheel the timer wheel to register the timer with
+ * \param[in] timer the timer to be registered
+ * \return #RCL_RET_OK if the timer was registered successfully, or
+ * \return #RCL_RET_INVALID_ARGUMENT if any arguments are invalid, or
+ * \return #RCL_RET_TIMER_INVALID if the timer is invalid, or
+ * \return #RCL_RET_BAD_ALLOC if allocating memory failed, or
+ * \return #RCL_RET_ERROR if an unspecified error occurs.
+ */
+RCL_PUBLIC
+RCL_WARN_UNUSED
+rcl_ret_t
+rcl_timer_wheel_add_timer(rcl_timer_wheel_t * timer_wheel, rcl_timer_t * timer);
+
+/// Unregister a timer from the timer wheel.
+/**
+ * \param[inout] timer_wheel the timer wheel to unregister the timer from
+ * \param[in] timer the timer to be unregistered
+ * \return #RCL_RET_OK if the timer was unregistered successfully, or
+ * \return #RCL_RET_INVALID_ARGUMENT if any arguments are invalid or the
+ *   timer is not registered.
+ */
+RCL_PUBLIC
+RCL_WARN_UNUSED
+rcl_ret_t
+rcl_timer_wheel_remove_timer(
+  rcl_timer_wheel_t * timer_wheel, const rcl_timer_t * timer);
+
+/// Calculate the time until the earliest registered timer is due.
+/**
+ * Only the head of the internal priority queue is consulted, so the cost is
+ * independent of the number of registered timers.
+ * If no registered timer is active, `time_until_next_call` is set to
+ * `INT64_MAX`.
+ * If a timer is already due, the value will be zero or negative.
+ *
+ * \param[inout] timer_wheel the timer wheel to query
+ * \param[out] time_until_next_call the time until the earliest due timer
+ * \return #RCL_RET_OK if the time was calculated successfully, or
+ * \return #RCL_RET_INVALID_ARGUMENT if any arguments are invalid, or
+ * \return #RCL_RET_ERROR if an unspecified error occurs.
+ */
+RCL_PUBLIC
+RCL_WARN_UNUSED
+rcl_ret_t
+rcl_timer_wheel_get_time_until_next_call(
+  rcl_timer_wheel_t * timer_wheel, int64_t * time_until_next_call);
+
+/// Collect the registered timers that are currently due.
+/**
+ * The clock is sampled once and every timer whose tracked deadline has
+ * passed is written to `ready_timers`, up to `capacity` entries; readiness
+ * is re-checked through rcl_timer_is_ready() so timers canceled or reset
+ * behind the wheel's back are never reported.
+ * The reported timers stay registered and their deadlines are refreshed
+ * after the next rcl_timer_call(), which the caller is expected to perform.
+ *
+ * The cost is proportional to the number of due timers, not the number of
+ * registered timers.
+ *
+ * \param[inout] timer_wheel the timer wheel to collect due timers from
+ * \param[out] ready_timers array to be filled with the due timers
+ * \param[in] capacity the number of entries available in `ready_timers`
+ * \param[out] number_ready the number of entries written
+ * \return #RCL_RET_OK if the due timers were collected successfully, or
+ * \return #RCL_RET_INVALID_ARGUMENT if any arguments are invalid, or
+ * \return #RCL_RET_ERROR if an unspecified error occurs.
+ */
+RCL_PUBLIC
+RCL_WARN_UNUSED
+rcl_ret_t
+rcl_timer_wheel_take_ready(
+  rcl_timer_wheel_t * timer_wheel,
+  rcl_timer_t ** ready_timers,
+  size_t capacity,
+  size_t * number_ready);
+
+/// Call every registered timer that is currently due.
+/**
+ * Equivalent to rcl_timer_wheel_take_ready() followed by rcl_timer_call()
+ * on each due timer, in deadline order, with a single clock sample for the
+ * whole batch.
+ * Timers that race to the canceled state are skipped, not treated as errors.
+ *
+ * \param[inout] timer_wheel the timer wheel whose due timers are called
+ * \param[out] number_called the number of timers called, may be `NULL`
+ * \return #RCL_RET_OK if the due timers were called successfully, or
+ * \return #RCL_RET_INVALID_ARGUMENT if any arguments are invalid, or
+ * \return #RCL_RET_ERROR if an unspecified error occurs.
+ */
+RCL_PUBLIC
+RCL_WARN_UNUSED
+rcl_ret_t
+rcl_timer_wheel_call_ready(rcl_timer_wheel_t * timer_wheel, size_t * number_called);
+
+/// Get the number of timers registered with the timer wheel.
+/**
+ * \param[in] timer_wheel the timer wheel to query
+ * \return the number of registered timers, or `0` if the wheel is invalid.
+ */
+RCL_PUBLIC
+RCL_WARN_UNUSED
+size_t
+rcl_timer_wheel_get_size(const rcl_timer_wheel_t * timer_wheel);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif  // RCL__TIMER_WHEEL_H_
@@ -0,0 +1,139 @@
+// Copyright 2022 Open Source Robotics Foundation, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/// @file
+
+#ifndef RCL__TRACE_H_
+#define RCL__TRACE_H_
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+#include <stdint.h>
+
+#include "rcl/macros.h"
+#include "rcl/types.h"
+#include "rcl/visibility_control.h"
+
+/// Hot-path trace events emitted by rcl when tracepoints are compiled in.
+/**
+ * These cover the rcl-internal work that the tracetools instrumentation
+ * cannot see: wait set bookkeeping, timer evaluation, the publish and take
+ * entry points and parameter file parsing.
+ * The meaning of the `arg0` and `arg1` handler arguments depends on the
+ * event; see the per-enumerator documentation.
+ */
+typedef enum rcl_trace_event_e
+{
+  /// rcl_wait() entered; arg0 is the number of entity slots, arg1 the timeout in nanoseconds.
+  RCL_TRACE_EVENT_WAIT_BEGIN = 0,
+  /// rcl_wait() completed; arg0 is the number of ready entities, arg1 is
+  /// nonzero when a timer determined the effective timeout.
+  RCL_TRACE_EVENT_WAIT_END,
+  /// A timer fired; arg0 is the scheduled call time and arg1 the actual call
+  /// time, both in nanoseconds on the timer's clock.
+  RCL_TRACE_EVENT_TIMER_CALL,
+  /// rcl_publish() or rcl_publish_serialized_message() entered; arg0 is the
+  /// serialized size in bytes, or 0 when the size is not known (typed
+  /// messages are serialized below rcl).
+  RCL_TRACE_EVENT_PUBLISH,
+  /// A take succeeded; arg0 is the serialized size in bytes, or 0 when the
+  /// size is not known.
+  RCL_TRACE_EVENT_TAKE,
+  /// Parsing of a parameter file begins; the entity is the file path.
+  RCL_TRACE_EVENT_PARAM_FILE_PARSE_BEGIN,
+  /// Parsing of a parameter file ended; arg0 is nonzero on success.
+  RCL_TRACE_EVENT_PARAM_FILE_PARSE_END,
+} rcl_trace_event_t;
+
+/// Signature of a trace event handler.
+/**
+ * \param[in] event which event fired
+ * \param[in] entity the rcl object the event concerns (wait set, timer,
+ *   publisher, subscription, or a path string), only valid for the duration
+ *   of the call
+ * \param[in] arg0 event specific, see rcl_trace_event_t
+ * \param[in] arg1 event specific, see rcl_trace_event_t
+ * \param[in] user_data the pointer given to rcl_trace_set_handler()
+ */
+typedef void (* rcl_trace_handler_t)(
+  rcl_trace_event_t event,
+  const void * entity,
+  int64_t arg0,
+  int64_t arg1,
+  void * user_data);
+
+/// Install a process-wide handler for rcl trace events.
+/**
+ * Tracepoints are compiled out by default; events are only emitted when rcl
+ * was built with `RCL_ENABLE_TRACEPOINTS` defined, and only while a handler
+ * is installed.
+ * Passing `NULL` for \p handler removes the current handler.
+ *
+ * The handler runs synchronously on the hot paths it observes, so it must
+ * be fast and must not call back into the rcl object it was handed.
+ * Installation is not synchronized with concurrent emission; install the
+ * handler before spinning and remove it only when the instrumented objects
+ * are quiescent.
+ *
+ * <hr>
+ * Attribute          | Adherence
+ * ------------------ | -------------
+ * Allocates Memory   | No
+ * Thread-Safe        | No
+ * Uses Atomics       | No
+ * Lock-Free          | Yes
+ *
+ * \param[in] handler the handler to install, or `NULL` to remove it
+ * \param[in] user_data opaque pointer passed through to the handler
+ */
+RCL_PUBLIC
+void
+rcl_trace_set_handler(rcl_trace_handler_t handler, void * user_data);
+
+/// Emit a trace event to the installed handler, if any.
+/**
+ * This is the function the RCL_TRACEPOINT() macro expands to; it is not
+ * meant to be called directly.
+ */
+RCL_PUBLIC
+void
+rcl_trace_emit(
+  rcl_trace_event_t event,
+  const void * entity,
+  int64_t arg0,
+  int64_t arg1);
+
+/// Emit a trace event from an rcl hot path.
+/**
+ * Expands to nothing unless rcl was compiled with `RCL_ENABLE_TRACEPOINTS`
+ * defined, in which case the event is forwarded to the handler installed
+ * with rcl_trace_set_handler().
+ * The arguments are not evaluated when tracepoints are compiled out, so
+ * event arguments may involve work that is only worth doing under tracing.
+ */
+#ifdef RCL_ENABLE_TRACEPOINTS
+#define RCL_TRACEPOINT(event, entity, arg0, arg1) \
+  rcl_trace_emit(event, entity, arg0, arg1)
+#else
+#define RCL_TRACEPOINT(event, entity, arg0, arg1) do {} while (0)
+#endif  // RCL_ENABLE_TRACEPOINTS
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif  // RCL__TRACE_H_
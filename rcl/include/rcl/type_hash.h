@@ -58,8 +58,13 @@ rcl_type_description_to_hashable_json(
  * This function produces a stable hash value for a ROS communication interface type.
  * For design motivations leading to this implementation, see REP-2011.
  *
- * This convenience wrapper calls rcl_type_description_to_hashable_json,
- * then runs sha256 hash on the result.
+ * This produces the sha256 hash of the same canonical representation
+ * rcl_type_description_to_hashable_json() returns, but streams it into the
+ * hash incrementally instead of materializing the intermediate string.
+ *
+ * Results are memoized in a process-wide table keyed on the type description
+ * content, so each distinct type pays for the JSON serialization and hashing
+ * only once per process no matter how many entities use it.
  *
  * \param[in] msg Prefilled TypeDescription message describing the type to be hashed
  * \param[out] message_digest Preallocated buffer, to be filled with calculated checksum
@@ -0,0 +1,166 @@
+// Copyright 2026 Open Source Robotics Foundation, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/// @file
+
+#ifndef RCL__TYPE_REGISTRY_H_
+#define RCL__TYPE_REGISTRY_H_
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+#include "rosidl_runtime_c/message_type_support_struct.h"
+#include "rosidl_runtime_c/type_hash.h"
+
+#include "rcl/allocator.h"
+#include "rcl/macros.h"
+#include "rcl/types.h"
+#include "rcl/visibility_control.h"
+
+typedef struct rcl_type_registry_impl_s rcl_type_registry_impl_t;
+
+/// A cache of data derived from rosidl message type supports.
+/**
+ * The registry stores one entry per distinct type support pointer, filled on
+ * first use, so entities created repeatedly for the same type, like the 20th
+ * subscription of a common sensor message, reuse the derived data instead of
+ * recomputing it.
+ *
+ * Currently the cached data is the type version hash calculated from the
+ * type support's type description with rcl_calculate_type_hash(), which
+ * serializes the description and hashes it; see type_hash.h.
+ *
+ * Type support structs are static data generated by rosidl, so entries never
+ * need invalidating; they live until the registry is finalized.
+ */
+typedef struct rcl_type_registry_s
+{
+  /// Private implementation pointer.
+  rcl_type_registry_impl_t * impl;
+} rcl_type_registry_t;
+
+/// Return a rcl_type_registry_t struct with members initialized to `NULL`.
+RCL_PUBLIC
+RCL_WARN_UNUSED
+rcl_type_registry_t
+rcl_get_zero_initialized_type_registry(void);
+
+/// Initialize a type registry.
+/**
+ * <hr>
+ * Attribute          | Adherence
+ * ------------------ | -------------
+ * Allocates Memory   | Yes
+ * Thread-Safe        | No
+ * Uses Atomics       | No
+ * Lock-Free          | Yes
+ *
+ * \param[inout] registry a zero initialized registry to be initialized
+ * \param[in] allocator the allocator used for the table and the entries
+ * \return #RCL_RET_OK if the registry was initialized successfully, or
+ * \return #RCL_RET_ALREADY_INIT if the registry is already initialized, or
+ * \return #RCL_RET_INVALID_ARGUMENT if any arguments are invalid, or
+ * \return #RCL_RET_BAD_ALLOC if allocating memory failed.
+ */
+RCL_PUBLIC
+RCL_WARN_UNUSED
+rcl_ret_t
+rcl_type_registry_init(rcl_type_registry_t * registry, rcl_allocator_t * allocator);
+
+/// Finalize a type registry, releasing every cached entry.
+/**
+ * Pointers previously returned by rcl_type_registry_get_type_hash() are
+ * invalidated.
+ *
+ * <hr>
+ * Attribute          | Adherence
+ * ------------------ | -------------
+ * Allocates Memory   | No
+ * Thread-Safe        | No
+ * Uses Atomics       | No
+ * Lock-Free          | Yes
+ *
+ * \param[inout] registry the registry to be finalized
+ * \return #RCL_RET_OK if the registry was finalized successfully, or
+ * \return #RCL_RET_INVALID_ARGUMENT if registry is `NULL`.
+ */
+RCL_PUBLIC
+RCL_WARN_UNUSED
+rcl_ret_t
+rcl_type_registry_fini(rcl_type_registry_t * registry);
+
+/// Return the cached type version hash for a message type support.
+/**
+ * On the first call for a given type support the hash is calculated from the
+ * type support's type description with rcl_calculate_type_hash() and cached;
+ * further calls return a pointer to the cached hash.
+ * The returned pointer is owned by the registry and stays valid until the
+ * registry is finalized.
+ *
+ * This function fails with #RCL_RET_ERROR if the type support does not
+ * provide a type description, which is the case for type supports generated
+ * before type descriptions were introduced.
+ *
+ * <hr>
+ * Attribute          | Adherence
+ * ------------------ | -------------
+ * Allocates Memory   | Yes [1]
+ * Thread-Safe        | No
+ * Uses Atomics       | No
+ * Lock-Free          | Yes
+ * <i>[1] only on the first call for a given type support</i>
+ *
+ * \param[inout] registry the registry to look the type support up in
+ * \param[in] type_support the message type support to derive the hash from
+ * \param[out] type_hash set to a pointer to the cached hash owned by the registry
+ * \return #RCL_RET_OK if the hash was retrieved successfully, or
+ * \return #RCL_RET_INVALID_ARGUMENT if any arguments are invalid, or
+ * \return #RCL_RET_BAD_ALLOC if allocating memory failed, or
+ * \return #RCL_RET_ERROR if calculating the hash fails.
+ */
+RCL_PUBLIC
+RCL_WARN_UNUSED
+rcl_ret_t
+rcl_type_registry_get_type_hash(
+  rcl_type_registry_t * registry,
+  const rosidl_message_type_support_t * type_support,
+  const rosidl_type_hash_t ** type_hash);
+
+/// Return the number of type supports with a cached entry.
+/**
+ * <hr>
+ * Attribute          | Adherence
+ * ------------------ | -------------
+ * Allocates Memory   | No
+ * Thread-Safe        | No
+ * Uses Atomics       | No
+ * Lock-Free          | Yes
+ *
+ * \param[in] registry the registry to query
+ * \param[out] count set to the number of cached entries
+ * \return #RCL_RET_OK if the count was retrieved successfully, or
+ * \return #RCL_RET_INVALID_ARGUMENT if any arguments are invalid.
+ */
+RCL_PUBLIC
+RCL_WARN_UNUSED
+rcl_ret_t
+rcl_type_registry_get_count(const rcl_type_registry_t * registry, size_t * count);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif  // RCL__TYPE_REGISTRY_H_
@@ -24,6 +24,7 @@ extern "C"
 
 #include <stdbool.h>
 #include <stddef.h>
+#include <stdint.h>
 
 #include "rcl/client.h"
 #include "rcl/guard_condition.h"
@@ -310,6 +311,57 @@ rcl_wait_set_resize(
   size_t services_size,
   size_t events_size);
 
+/// Reserve storage capacity for entities in the wait set.
+/**
+ * Unlike rcl_wait_set_resize(), this function does not change the sizes of
+ * the entity sets; it only ensures enough storage is allocated to hold at
+ * least the given number of entities of each class.
+ * Subsequent calls to rcl_wait_set_resize() with sizes within the reserved
+ * capacities will not touch the allocator, so an executor that knows roughly
+ * how many entities it will end up with can reserve once up front instead of
+ * reallocating the wait set storage on every growth step.
+ *
+ * Capacities are never shrunk by this function; a capacity smaller than the
+ * current one is ignored.
+ * Resizing every entity set to zero with rcl_wait_set_resize() releases the
+ * storage along with the reserved capacities.
+ *
+ * Like rcl_wait_set_resize(), this function resets the contents of the wait
+ * set, effectively the same as calling rcl_wait_set_clear().
+ *
+ * <hr>
+ * Attribute          | Adherence
+ * ------------------ | -------------
+ * Allocates Memory   | Yes
+ * Thread-Safe        | No
+ * Uses Atomics       | No
+ * Lock-Free          | Yes
+ *
+ * \param[inout] wait_set struct to reserve capacity on
+ * \param[in] subscriptions_capacity minimum capacity for subscriptions
+ * \param[in] guard_conditions_capacity minimum capacity for guard conditions
+ * \param[in] timers_capacity minimum capacity for timers
+ * \param[in] clients_capacity minimum capacity for clients
+ * \param[in] services_capacity minimum capacity for services
+ * \param[in] events_capacity minimum capacity for events
+ * \return #RCL_RET_OK if the capacity was reserved successfully, or
+ * \return #RCL_RET_INVALID_ARGUMENT if any arguments are invalid, or
+ * \return #RCL_RET_WAIT_SET_INVALID if the wait set is zero initialized, or
+ * \return #RCL_RET_BAD_ALLOC if allocating memory failed, or
+ * \return #RCL_RET_ERROR if an unspecified error occurs.
+ */
+RCL_PUBLIC
+RCL_WARN_UNUSED
+rcl_ret_t
+rcl_wait_set_reserve(
+  rcl_wait_set_t * wait_set,
+  size_t subscriptions_capacity,
+  size_t guard_conditions_capacity,
+  size_t timers_capacity,
+  size_t clients_capacity,
+  size_t services_capacity,
+  size_t events_capacity);
+
 /// Store a pointer to the guard condition in the next empty spot in the set.
 /**
  * This function behaves exactly the same as for subscriptions.
@@ -375,6 +427,190 @@ rcl_wait_set_add_event(
   const rcl_event_t * event,
   size_t * index);
 
+/// The classes of entities that can be stored in a wait set.
+typedef enum rcl_wait_set_entity_type_e
+{
+  RCL_WAIT_SET_SUBSCRIPTION = 0,
+  RCL_WAIT_SET_GUARD_CONDITION,
+  RCL_WAIT_SET_TIMER,
+  RCL_WAIT_SET_CLIENT,
+  RCL_WAIT_SET_SERVICE,
+  RCL_WAIT_SET_EVENT,
+} rcl_wait_set_entity_type_t;
+
+/// Retrieve the readiness bitmap for one entity class of the wait set.
+/**
+ * The bitmap is populated by rcl_wait(): bit `i` of the bitmap is set if the
+ * entity at index `i` of the corresponding entity array was ready.
+ * One 64 bit word covers 64 entity slots, so wide wait sets can be scanned
+ * with a handful of word loads instead of walking the entity arrays looking
+ * for non-`NULL` pointers; use rcl_wait_set_next_ready() to iterate set bits.
+ *
+ * The returned pointer refers to storage owned by the wait set; it is valid
+ * until the wait set is resized or finalized and its content is overwritten
+ * by the next call to rcl_wait().
+ * The pointer is `NULL` if the entity class has zero capacity.
+ *
+ * <hr>
+ * Attribute          | Adherence
+ * ------------------ | -------------
+ * Allocates Memory   | No
+ * Thread-Safe        | No
+ * Uses Atomics       | No
+ * Lock-Free          | Yes
+ *
+ * \param[in] wait_set the wait set to query
+ * \param[in] entity_type which entity class's bitmap to return
+ * \param[out] bitmap where the bitmap pointer is written
+ * \param[out] number_of_words the number of 64 bit words in the bitmap
+ * \return #RCL_RET_OK if the bitmap was retrieved successfully, or
+ * \return #RCL_RET_INVALID_ARGUMENT if any arguments are invalid, or
+ * \return #RCL_RET_WAIT_SET_INVALID if the wait set is zero initialized.
+ */
+RCL_PUBLIC
+RCL_WARN_UNUSED
+rcl_ret_t
+rcl_wait_set_get_ready_bitmap(
+  const rcl_wait_set_t * wait_set,
+  rcl_wait_set_entity_type_t entity_type,
+  const uint64_t ** bitmap,
+  size_t * number_of_words);
+
+/// Find the next set bit in a readiness bitmap at or after start_index.
+/**
+ * Scans word-at-a-time and uses a count-trailing-zeros instruction to locate
+ * set bits, so iterating the ready entities of a wide wait set costs
+ * O(words) rather than O(entities).
+ *
+ * \param[in] bitmap bitmap as returned by rcl_wait_set_get_ready_bitmap()
+ * \param[in] number_of_words the number of 64 bit words in the bitmap
+ * \param[in] start_index entity index at which to start the search
+ * \return the index of the next ready entity, or `SIZE_MAX` if there is none.
+ */
+RCL_PUBLIC
+size_t
+rcl_wait_set_next_ready(
+  const uint64_t * bitmap, size_t number_of_words, size_t start_index);
+
+/// Remove the subscription at the given index from the wait set.
+/**
+ * The index is the one reported by rcl_wait_set_add_subscription().
+ * The last added subscription is swapped into the vacated slot, so removal is
+ * O(1) and does not require clearing and rebuilding the wait set; callers
+ * holding on to indices must account for the index of the swapped entity
+ * changing.
+ *
+ * <hr>
+ * Attribute          | Adherence
+ * ------------------ | -------------
+ * Allocates Memory   | No
+ * Thread-Safe        | No
+ * Uses Atomics       | No
+ * Lock-Free          | Yes
+ *
+ * \param[inout] wait_set struct from which the subscription is to be removed
+ * \param[in] index index of the subscription to remove
+ * \return #RCL_RET_OK if removed successfully, or
+ * \return #RCL_RET_INVALID_ARGUMENT if the index is out of range, or
+ * \return #RCL_RET_WAIT_SET_INVALID if the wait set is zero initialized.
+ */
+RCL_PUBLIC
+RCL_WARN_UNUSED
+rcl_ret_t
+rcl_wait_set_remove_subscription(rcl_wait_set_t * wait_set, size_t index);
+
+/// Remove the guard condition at the given index from the wait set.
+/**
+ * This function behaves exactly the same as for subscriptions.
+ * \see rcl_wait_set_remove_subscription
+ */
+RCL_PUBLIC
+RCL_WARN_UNUSED
+rcl_ret_t
+rcl_wait_set_remove_guard_condition(rcl_wait_set_t * wait_set, size_t index);
+
+/// Remove the timer at the given index from the wait set.
+/**
+ * This function behaves exactly the same as for subscriptions.
+ * \see rcl_wait_set_remove_subscription
+ */
+RCL_PUBLIC
+RCL_WARN_UNUSED
+rcl_ret_t
+rcl_wait_set_remove_timer(rcl_wait_set_t * wait_set, size_t index);
+
+/// Remove the client at the given index from the wait set.
+/**
+ * This function behaves exactly the same as for subscriptions.
+ * \see rcl_wait_set_remove_subscription
+ */
+RCL_PUBLIC
+RCL_WARN_UNUSED
+rcl_ret_t
+rcl_wait_set_remove_client(rcl_wait_set_t * wait_set, size_t index);
+
+/// Remove the service at the given index from the wait set.
+/**
+ * This function behaves exactly the same as for subscriptions.
+ * \see rcl_wait_set_remove_subscription
+ */
+RCL_PUBLIC
+RCL_WARN_UNUSED
+rcl_ret_t
+rcl_wait_set_remove_service(rcl_wait_set_t * wait_set, size_t index);
+
+/// Remove the event at the given index from the wait set.
+/**
+ * This function behaves exactly the same as for subscriptions.
+ * \see rcl_wait_set_remove_subscription
+ */
+RCL_PUBLIC
+RCL_WARN_UNUSED
+rcl_ret_t
+rcl_wait_set_remove_event(rcl_wait_set_t * wait_set, size_t index);
+
+/// Enable or disable persistent mode on a wait set.
+/**
+ * In persistent mode entities are registered with the wait set once and stay
+ * registered across calls to rcl_wait(), instead of being cleared and re-added
+ * on every iteration.
+ * The first call to rcl_wait() after the contents change snapshots the
+ * registered entities, and each subsequent call restores the snapshot with a
+ * cheap copy before waiting, undoing the pruning (setting of entries to
+ * `NULL`) done by the previous wait.
+ *
+ * Calling rcl_wait_set_clear(), rcl_wait_set_resize() or any of the add
+ * functions invalidates the snapshot; the next rcl_wait() will rebuild it.
+ * Disabling persistent mode releases the snapshot storage.
+ *
+ * <hr>
+ * Attribute          | Adherence
+ * ------------------ | -------------
+ * Allocates Memory   | No
+ * Thread-Safe        | No
+ * Uses Atomics       | No
+ * Lock-Free          | Yes
+ *
+ * \param[inout] wait_set the wait set to change the mode of
+ * \param[in] persistent `true` to enable persistent mode, `false` to disable it
+ * \return #RCL_RET_OK if the mode was set successfully, or
+ * \return #RCL_RET_INVALID_ARGUMENT if any arguments are invalid, or
+ * \return #RCL_RET_WAIT_SET_INVALID if the wait set is zero initialized.
+ */
+RCL_PUBLIC
+RCL_WARN_UNUSED
+rcl_ret_t
+rcl_wait_set_set_persistent(rcl_wait_set_t * wait_set, bool persistent);
+
+/// Return `true` if the wait set is valid and in persistent mode, else `false`.
+/**
+ * \param[in] wait_set the rcl_wait_set_t to be queried
+ * \return `true` if the wait_set is valid and persistent, otherwise `false`.
+ */
+RCL_PUBLIC
+bool
+rcl_wait_set_is_persistent(const rcl_wait_set_t * wait_set);
+
 /// Block until the wait set is ready or until the timeout has been exceeded.
 /**
  * This function will collect the items in the rcl_wait_set_t and pass them
@@ -472,6 +708,298 @@ RCL_WARN_UNUSED
 rcl_ret_t
 rcl_wait(rcl_wait_set_t * wait_set, int64_t timeout);
 
+/// Enable coalesced notifications on a wait set.
+/**
+ * Allocates a single shared rmw guard condition for the wait set along with
+ * one lock-free pending flag per trigger source, so that any number of
+ * interrupt sources (up to 64) wake the wait set through one rmw object
+ * instead of each being a separate guard condition that rmw_wait must poll.
+ *
+ * Sources are identified by an index in `[0, number_of_sources)`.
+ * Trigger a source with rcl_wait_set_notify() and, after rcl_wait() returns,
+ * drain the pending sources with rcl_wait_set_take_notifications().
+ *
+ * <hr>
+ * Attribute          | Adherence
+ * ------------------ | -------------
+ * Allocates Memory   | Yes
+ * Thread-Safe        | No
+ * Uses Atomics       | No
+ * Lock-Free          | Yes
+ *
+ * \param[inout] wait_set the wait set to enable coalescing on
+ * \param[in] number_of_sources the number of trigger sources, between 1 and 64
+ * \return #RCL_RET_OK if coalescing was enabled successfully, or
+ * \return #RCL_RET_INVALID_ARGUMENT if any arguments are invalid, or
+ * \return #RCL_RET_ALREADY_INIT if coalescing is already enabled, or
+ * \return #RCL_RET_WAIT_SET_INVALID if the wait set is zero initialized, or
+ * \return #RCL_RET_BAD_ALLOC if allocating memory failed, or
+ * \return #RCL_RET_ERROR if an unspecified error occurs.
+ */
+RCL_PUBLIC
+RCL_WARN_UNUSED
+rcl_ret_t
+rcl_wait_set_enable_notification_coalescing(
+  rcl_wait_set_t * wait_set, size_t number_of_sources);
+
+/// Disable coalesced notifications and release the shared guard condition.
+/**
+ * \param[inout] wait_set the wait set to disable coalescing on
+ * \return #RCL_RET_OK if coalescing was disabled successfully, or
+ * \return #RCL_RET_INVALID_ARGUMENT if any arguments are invalid, or
+ * \return #RCL_RET_WAIT_SET_INVALID if the wait set is zero initialized.
+ */
+RCL_PUBLIC
+RCL_WARN_UNUSED
+rcl_ret_t
+rcl_wait_set_disable_notification_coalescing(rcl_wait_set_t * wait_set);
+
+/// Mark a trigger source pending and wake the wait set.
+/**
+ * This function is safe to call from any thread; the pending flag is set
+ * with an atomic store before the shared guard condition is triggered.
+ *
+ * <hr>
+ * Attribute          | Adherence
+ * ------------------ | -------------
+ * Allocates Memory   | No
+ * Thread-Safe        | Yes
+ * Uses Atomics       | Yes
+ * Lock-Free          | Yes
+ *
+ * \param[in] wait_set the wait set to notify
+ * \param[in] source_id the trigger source to mark pending
+ * \return #RCL_RET_OK if the notification was delivered, or
+ * \return #RCL_RET_INVALID_ARGUMENT if coalescing is not enabled or the
+ *   source id is out of range, or
+ * \return #RCL_RET_WAIT_SET_INVALID if the wait set is zero initialized, or
+ * \return #RCL_RET_ERROR if an unspecified error occurs.
+ */
+RCL_PUBLIC
+RCL_WARN_UNUSED
+rcl_ret_t
+rcl_wait_set_notify(const rcl_wait_set_t * wait_set, size_t source_id);
+
+/// Atomically drain the pending trigger sources into a bitmask.
+/**
+ * Bit `i` of the output is set if source `i` was notified since the last
+ * drain; each pending flag is cleared as it is read.
+ *
+ * <hr>
+ * Attribute          | Adherence
+ * ------------------ | -------------
+ * Allocates Memory   | No
+ * Thread-Safe        | Yes
+ * Uses Atomics       | Yes
+ * Lock-Free          | Yes
+ *
+ * \param[in] wait_set the wait set to drain
+ * \param[out] pending_sources bitmask of sources notified since the last drain
+ * \return #RCL_RET_OK if the pending sources were retrieved, or
+ * \return #RCL_RET_INVALID_ARGUMENT if coalescing is not enabled, or
+ * \return #RCL_RET_WAIT_SET_INVALID if the wait set is zero initialized.
+ */
+RCL_PUBLIC
+RCL_WARN_UNUSED
+rcl_ret_t
+rcl_wait_set_take_notifications(
+  const rcl_wait_set_t * wait_set, uint64_t * pending_sources);
+
+/// Register an ack watch: event-driven completion of a reliable flush.
+/**
+ * The non-blocking alternative to rcl_publisher_wait_for_all_acked(): after
+ * publishing a reliable burst, the caller registers a watch and keeps
+ * processing other work through the wait set.
+ * At the start of every rcl_wait() the publisher's acknowledgment state is
+ * probed without blocking; while acks are outstanding the wait timeout is
+ * clamped to `poll_period` so the probe reruns, and once the acks drain the
+ * given guard condition is triggered and the watch removes itself.
+ * The caller should add `guard_condition` to the wait set, so the
+ * completion surfaces as a ready entity like any other.
+ *
+ * A watch is one-shot: re-register after each flush.
+ * If the publisher's acks have already drained the guard condition is
+ * triggered immediately and no watch is registered.
+ * The publisher and guard condition must outlive the watch.
+ *
+ * <hr>
+ * Attribute          | Adherence
+ * ------------------ | -------------
+ * Allocates Memory   | Yes
+ * Thread-Safe        | No
+ * Uses Atomics       | No
+ * Lock-Free          | Yes
+ *
+ * \param[inout] wait_set the wait set whose waits run the probe
+ * \param[in] publisher the publisher whose acknowledgments are watched
+ * \param[in] guard_condition triggered once when the acks drain
+ * \param[in] poll_period upper bound, in nanoseconds, on the time between
+ *   probes while acks are outstanding; must be greater than zero
+ * \return #RCL_RET_OK if the watch was registered (or completed
+ *   immediately), or
+ * \return #RCL_RET_INVALID_ARGUMENT if any arguments are invalid, or
+ * \return #RCL_RET_WAIT_SET_INVALID if the wait set is zero initialized, or
+ * \return #RCL_RET_PUBLISHER_INVALID if the publisher is invalid, or
+ * \return #RCL_RET_UNSUPPORTED if the middleware cannot report
+ *   acknowledgment state, or
+ * \return #RCL_RET_BAD_ALLOC if allocating memory failed, or
+ * \return #RCL_RET_ERROR if an unspecified error occurs.
+ */
+RCL_PUBLIC
+RCL_WARN_UNUSED
+rcl_ret_t
+rcl_wait_set_add_ack_watch(
+  rcl_wait_set_t * wait_set,
+  const rcl_publisher_t * publisher,
+  rcl_guard_condition_t * guard_condition,
+  int64_t poll_period);
+
+/// Remove a publisher's ack watch before it completes.
+/**
+ * A no-op when no watch is registered for the publisher, since watches
+ * remove themselves on completion.
+ *
+ * \param[inout] wait_set the wait set to remove the watch from
+ * \param[in] publisher the publisher whose watch is removed
+ * \return #RCL_RET_OK if the watch was removed or none was registered, or
+ * \return #RCL_RET_INVALID_ARGUMENT if any arguments are invalid, or
+ * \return #RCL_RET_WAIT_SET_INVALID if the wait set is zero initialized.
+ */
+RCL_PUBLIC
+RCL_WARN_UNUSED
+rcl_ret_t
+rcl_wait_set_remove_ack_watch(
+  rcl_wait_set_t * wait_set,
+  const rcl_publisher_t * publisher);
+
+/// A snapshot of the instrumentation counters of a wait set.
+typedef struct rcl_wait_set_statistics_s
+{
+  /// Number of calls to rcl_wait() on this wait set.
+  uint64_t wait_count;
+  /// Number of waits that woke up with no ready entities and no pending
+  /// coalesced notifications, without the timeout having elapsed.
+  uint64_t spurious_wake_count;
+  /// Number of waits that ended because a timer deadline was reached.
+  uint64_t timer_wake_count;
+  /// Cumulative wall-clock time spent inside rmw_wait(), in nanoseconds.
+  uint64_t rmw_wait_time_ns;
+  /// Largest number of entities reported ready by a single wait.
+  uint64_t max_ready_batch_size;
+} rcl_wait_set_statistics_t;
+
+/// Enable instrumentation counters on a wait set.
+/**
+ * Once enabled, rcl_wait() accumulates the counters described by
+ * rcl_wait_set_statistics_t using relaxed atomics, so another thread can
+ * sample them through rcl_wait_set_get_statistics() without synchronization
+ * and without perturbing the waiting thread.
+ * The counters are reset to zero each time this function is called.
+ *
+ * Collection adds two clock queries per wait and a scan of the readiness
+ * bitmaps; it is off by default.
+ *
+ * <hr>
+ * Attribute          | Adherence
+ * ------------------ | -------------
+ * Allocates Memory   | No
+ * Thread-Safe        | No
+ * Uses Atomics       | Yes
+ * Lock-Free          | Yes
+ *
+ * \param[inout] wait_set the wait set to enable statistics collection on
+ * \return #RCL_RET_OK if statistics were enabled successfully, or
+ * \return #RCL_RET_INVALID_ARGUMENT if any arguments are invalid, or
+ * \return #RCL_RET_WAIT_SET_INVALID if the wait set is zero initialized.
+ */
+RCL_PUBLIC
+RCL_WARN_UNUSED
+rcl_ret_t
+rcl_wait_set_enable_statistics(rcl_wait_set_t * wait_set);
+
+/// Disable instrumentation counters on a wait set.
+/**
+ * \param[inout] wait_set the wait set to disable statistics collection on
+ * \return #RCL_RET_OK if statistics were disabled successfully, or
+ * \return #RCL_RET_INVALID_ARGUMENT if any arguments are invalid, or
+ * \return #RCL_RET_WAIT_SET_INVALID if the wait set is zero initialized.
+ */
+RCL_PUBLIC
+RCL_WARN_UNUSED
+rcl_ret_t
+rcl_wait_set_disable_statistics(rcl_wait_set_t * wait_set);
+
+/// Get a snapshot of the instrumentation counters of a wait set.
+/**
+ * <hr>
+ * Attribute          | Adherence
+ * ------------------ | -------------
+ * Allocates Memory   | No
+ * Thread-Safe        | Yes
+ * Uses Atomics       | Yes
+ * Lock-Free          | Yes
+ *
+ * \param[in] wait_set the wait set to sample
+ * \param[out] statistics filled with the current counter values
+ * \return #RCL_RET_OK if the statistics were retrieved, or
+ * \return #RCL_RET_INVALID_ARGUMENT if statistics are not enabled or any
+ *   arguments are invalid, or
+ * \return #RCL_RET_WAIT_SET_INVALID if the wait set is zero initialized.
+ */
+RCL_PUBLIC
+RCL_WARN_UNUSED
+rcl_ret_t
+rcl_wait_set_get_statistics(
+  const rcl_wait_set_t * wait_set, rcl_wait_set_statistics_t * statistics);
+
+/// Block until any of several wait sets is ready or the timeout is exceeded.
+/**
+ * This function aggregates the rmw storage of all given wait sets into a
+ * single call to the underlying rmw_wait function and demultiplexes the
+ * results back into each wait set, so one thread can service several
+ * partitions of entities instead of dedicating a blocked thread per wait
+ * set.
+ *
+ * After this function returns, each wait set looks exactly as if rcl_wait()
+ * had been called on it: not ready entries are set to `NULL` and the
+ * readiness bitmaps are populated, see rcl_wait_set_get_ready_bitmap().
+ *
+ * The first wait set's underlying rmw wait set is used for the aggregated
+ * wait, so it should be initialized with enough capacity for the combined
+ * entities of all wait sets.
+ * All wait sets must belong to the same rmw implementation; passing wait
+ * sets from different contexts of different rmw implementations is
+ * undefined behavior.
+ * Calling this function with a single wait set is equivalent to rcl_wait().
+ *
+ * The timeout semantics are the same as for rcl_wait(), with timers from
+ * every wait set considered when computing the effective timeout.
+ *
+ * <hr>
+ * Attribute          | Adherence
+ * ------------------ | -------------
+ * Allocates Memory   | Yes
+ * Thread-Safe        | No
+ * Uses Atomics       | No
+ * Lock-Free          | Yes
+ *
+ * \param[inout] wait_sets array of pointers to initialized wait sets
+ * \param[in] number_of_wait_sets the number of wait sets in the array
+ * \param[in] timeout the duration to wait for readiness, in nanoseconds
+ * \return #RCL_RET_OK something in one of the wait sets became ready, or
+ * \return #RCL_RET_INVALID_ARGUMENT if any arguments are invalid, or
+ * \return #RCL_RET_WAIT_SET_INVALID if any wait set is zero initialized, or
+ * \return #RCL_RET_WAIT_SET_EMPTY if every wait set contains no items, or
+ * \return #RCL_RET_BAD_ALLOC if allocating scratch storage failed, or
+ * \return #RCL_RET_TIMEOUT if the timeout expired before something was ready, or
+ * \return #RCL_RET_ERROR an unspecified error occur.
+ */
+RCL_PUBLIC
+RCL_WARN_UNUSED
+rcl_ret_t
+rcl_wait_multiple(
+  rcl_wait_set_t ** wait_sets, size_t number_of_wait_sets, int64_t timeout);
+
 /// Return `true` if the wait set is valid, else `false`.
 /**
  * A wait set is invalid if:
@@ -0,0 +1,302 @@
+// Copyright 2026 Open Source Robotics Foundation, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+#include "rcl/allocator_stats.h"
+
+#include <string.h>
+
+#include "rcl/error_handling.h"
+
+rcl_ret_t
+rcl_stats_allocator_init(
+  rcl_stats_allocator_t * stats_allocator,
+  const rcl_allocator_t * base_allocator)
+{
+  RCL_CHECK_ARGUMENT_FOR_NULL(stats_allocator, RCL_RET_INVALID_ARGUMENT);
+  RCL_CHECK_ALLOCATOR_WITH_MSG(
+    base_allocator, "base allocator is invalid", return RCL_RET_INVALID_ARGUMENT);
+  stats_allocator->base_allocator = *base_allocator;
+  stats_allocator->stats = (rcl_allocator_stats_t) {0};
+  return RCL_RET_OK;
+}
+
+static
+void *
+__stats_allocator_allocate(size_t size, void * state)
+{
+  rcl_stats_allocator_t * stats_allocator = state;
+  void * pointer = stats_allocator->base_allocator.allocate(
+    size, stats_allocator->base_allocator.state);
+  if (NULL != pointer) {
+    ++stats_allocator->stats.allocation_count;
+    stats_allocator->stats.bytes_requested += size;
+  } else {
+    ++stats_allocator->stats.failed_allocation_count;
+  }
+  return pointer;
+}
+
+static
+void
+__stats_allocator_deallocate(void * pointer, void * state)
+{
+  rcl_stats_allocator_t * stats_allocator = state;
+  if (NULL != pointer) {
+    ++stats_allocator->stats.deallocation_count;
+  }
+  stats_allocator->base_allocator.deallocate(
+    pointer, stats_allocator->base_allocator.state);
+}
+
+static
+void *
+__stats_allocator_reallocate(void * pointer, size_t size, void * state)
+{
+  rcl_stats_allocator_t * stats_allocator = state;
+  void * new_pointer = stats_allocator->base_allocator.reallocate(
+    pointer, size, stats_allocator->base_allocator.state);
+  if (NULL != new_pointer) {
+    if (NULL != pointer) {
+      ++stats_allocator->stats.reallocation_count;
+    } else {
+      ++stats_allocator->stats.allocation_count;
+    }
+    stats_allocator->stats.bytes_requested += size;
+  } else {
+    ++stats_allocator->stats.failed_allocation_count;
+  }
+  return new_pointer;
+}
+
+static
+void *
+__stats_allocator_zero_allocate(size_t number_of_elements, size_t size_of_element, void * state)
+{
+  rcl_stats_allocator_t * stats_allocator = state;
+  void * pointer = stats_allocator->base_allocator.zero_allocate(
+    number_of_elements, size_of_element, stats_allocator->base_allocator.state);
+  if (NULL != pointer) {
+    ++stats_allocator->stats.allocation_count;
+    stats_allocator->stats.bytes_requested += number_of_elements * size_of_element;
+  } else {
+    ++stats_allocator->stats.failed_allocation_count;
+  }
+  return pointer;
+}
+
+rcl_allocator_t
+rcl_stats_allocator_get_allocator(rcl_stats_allocator_t * stats_allocator)
+{
+  rcl_allocator_t allocator;
+  allocator.allocate = __stats_allocator_allocate;
+  allocator.deallocate = __stats_allocator_deallocate;
+  allocator.reallocate = __stats_allocator_reallocate;
+  allocator.zero_allocate = __stats_allocator_zero_allocate;
+  allocator.state = stats_allocator;
+  return allocator;
+}
+
+rcl_ret_t
+rcl_stats_allocator_get_stats(
+  const rcl_stats_allocator_t * stats_allocator,
+  rcl_allocator_stats_t * stats)
+{
+  RCL_CHECK_ARGUMENT_FOR_NULL(stats_allocator, RCL_RET_INVALID_ARGUMENT);
+  RCL_CHECK_ARGUMENT_FOR_NULL(stats, RCL_RET_INVALID_ARGUMENT);
+  *stats = stats_allocator->stats;
+  return RCL_RET_OK;
+}
+
+/// Header in front of every tracking allocation; sized to keep the payload
+/// aligned for any scalar type.
+typedef struct rcl_tracking_header_s
+{
+  size_t size;
+  size_t domain;
+} rcl_tracking_header_t;
+
+rcl_ret_t
+rcl_tracking_allocator_init(
+  rcl_tracking_allocator_t * tracking_allocator,
+  const rcl_allocator_t * base_allocator)
+{
+  RCL_CHECK_ARGUMENT_FOR_NULL(tracking_allocator, RCL_RET_INVALID_ARGUMENT);
+  RCL_CHECK_ALLOCATOR_WITH_MSG(
+    base_allocator, "base allocator is invalid", return RCL_RET_INVALID_ARGUMENT);
+  tracking_allocator->base_allocator = *base_allocator;
+  for (size_t i = 0; i < RCL_ALLOC_DOMAIN_COUNT; ++i) {
+    tracking_allocator->domains[i] = (rcl_domain_alloc_stats_t) {0};
+    tracking_allocator->domain_states[i].tracking_allocator = tracking_allocator;
+    tracking_allocator->domain_states[i].domain = (rcl_alloc_domain_t)i;
+  }
+  return RCL_RET_OK;
+}
+
+static
+void
+__tracking_count_allocation(rcl_domain_alloc_stats_t * domain_stats, size_t size)
+{
+  ++domain_stats->live_allocation_count;
+  ++domain_stats->total_allocation_count;
+  domain_stats->live_bytes += size;
+  domain_stats->total_bytes += size;
+  if (domain_stats->live_allocation_count > domain_stats->peak_allocation_count) {
+    domain_stats->peak_allocation_count = domain_stats->live_allocation_count;
+  }
+  if (domain_stats->live_bytes > domain_stats->peak_bytes) {
+    domain_stats->peak_bytes = domain_stats->live_bytes;
+  }
+}
+
+static
+void *
+__tracking_allocator_allocate(size_t size, void * state)
+{
+  rcl_tracking_allocator_domain_t * domain_state = state;
+  rcl_tracking_allocator_t * tracking_allocator = domain_state->tracking_allocator;
+  rcl_tracking_header_t * header = tracking_allocator->base_allocator.allocate(
+    sizeof(rcl_tracking_header_t) + size, tracking_allocator->base_allocator.state);
+  if (NULL == header) {
+    return NULL;
+  }
+  header->size = size;
+  header->domain = (size_t)domain_state->domain;
+  __tracking_count_allocation(&tracking_allocator->domains[header->domain], size);
+  return header + 1;
+}
+
+static
+void
+__tracking_allocator_deallocate(void * pointer, void * state)
+{
+  rcl_tracking_allocator_domain_t * domain_state = state;
+  rcl_tracking_allocator_t * tracking_allocator = domain_state->tracking_allocator;
+  if (NULL == pointer) {
+    return;
+  }
+  rcl_tracking_header_t * header = (rcl_tracking_header_t *)pointer - 1;
+  // attribute the release to the domain that allocated, which may differ
+  // from the facade the memory is released through
+  rcl_domain_alloc_stats_t * domain_stats = &tracking_allocator->domains[header->domain];
+  --domain_stats->live_allocation_count;
+  domain_stats->live_bytes -= header->size;
+  tracking_allocator->base_allocator.deallocate(
+    header, tracking_allocator->base_allocator.state);
+}
+
+static
+void *
+__tracking_allocator_reallocate(void * pointer, size_t size, void * state)
+{
+  rcl_tracking_allocator_domain_t * domain_state = state;
+  rcl_tracking_allocator_t * tracking_allocator = domain_state->tracking_allocator;
+  if (NULL == pointer) {
+    return __tracking_allocator_allocate(size, state);
+  }
+  rcl_tracking_header_t * old_header = (rcl_tracking_header_t *)pointer - 1;
+  size_t old_size = old_header->size;
+  size_t domain = old_header->domain;
+  rcl_tracking_header_t * header = tracking_allocator->base_allocator.reallocate(
+    old_header, sizeof(rcl_tracking_header_t) + size,
+    tracking_allocator->base_allocator.state);
+  if (NULL == header) {
+    return NULL;
+  }
+  header->size = size;
+  // the allocation stays attributed to its original domain
+  rcl_domain_alloc_stats_t * domain_stats = &tracking_allocator->domains[domain];
+  domain_stats->live_bytes -= old_size;
+  domain_stats->live_bytes += size;
+  if (size > old_size) {
+    domain_stats->total_bytes += size - old_size;
+  }
+  if (domain_stats->live_bytes > domain_stats->peak_bytes) {
+    domain_stats->peak_bytes = domain_stats->live_bytes;
+  }
+  return header + 1;
+}
+
+static
+void *
+__tracking_allocator_zero_allocate(
+  size_t number_of_elements, size_t size_of_element, void * state)
+{
+  size_t size = number_of_elements * size_of_element;
+  void * pointer = __tracking_allocator_allocate(size, state);
+  if (NULL != pointer) {
+    memset(pointer, 0, size);
+  }
+  return pointer;
+}
+
+rcl_allocator_t
+rcl_tracking_allocator_get_allocator(
+  rcl_tracking_allocator_t * tracking_allocator,
+  rcl_alloc_domain_t domain)
+{
+  rcl_allocator_t allocator = {NULL, NULL, NULL, NULL, NULL};
+  if (NULL == tracking_allocator || (int)domain < 0 || domain >= RCL_ALLOC_DOMAIN_COUNT) {
+    return allocator;
+  }
+  allocator.allocate = __tracking_allocator_allocate;
+  allocator.deallocate = __tracking_allocator_deallocate;
+  allocator.reallocate = __tracking_allocator_reallocate;
+  allocator.zero_allocate = __tracking_allocator_zero_allocate;
+  allocator.state = &tracking_allocator->domain_states[domain];
+  return allocator;
+}
+
+rcl_ret_t
+rcl_tracking_allocator_get_domain_stats(
+  const rcl_tracking_allocator_t * tracking_allocator,
+  rcl_alloc_domain_t domain,
+  rcl_domain_alloc_stats_t * stats)
+{
+  RCL_CHECK_ARGUMENT_FOR_NULL(tracking_allocator, RCL_RET_INVALID_ARGUMENT);
+  RCL_CHECK_ARGUMENT_FOR_NULL(stats, RCL_RET_INVALID_ARGUMENT);
+  if ((int)domain < 0 || domain >= RCL_ALLOC_DOMAIN_COUNT) {
+    RCL_SET_ERROR_MSG("domain is out of range");
+    return RCL_RET_INVALID_ARGUMENT;
+  }
+  *stats = tracking_allocator->domains[domain];
+  return RCL_RET_OK;
+}
+
+const char *
+rcl_alloc_domain_name(rcl_alloc_domain_t domain)
+{
+  switch (domain) {
+    case RCL_ALLOC_DOMAIN_DEFAULT:
+      return "default";
+    case RCL_ALLOC_DOMAIN_WAIT_SET:
+      return "wait set";
+    case RCL_ALLOC_DOMAIN_GRAPH:
+      return "graph";
+    case RCL_ALLOC_DOMAIN_LOGGING:
+      return "logging";
+    case RCL_ALLOC_DOMAIN_PARAMETERS:
+      return "parameters";
+    default:
+      return "unknown";
+  }
+}
+
+#ifdef __cplusplus
+}
+#endif
@@ -0,0 +1,212 @@
+// Copyright 2026 Open Source Robotics Foundation, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+#include "rcl/arena.h"
+
+#include <string.h>
+
+#include "rcl/error_handling.h"
+
+// Alignment of every arena allocation; large enough for any scalar type.
+#define RCL_ARENA_ALIGNMENT (2 * sizeof(void *))
+
+struct rcl_arena_block_s
+{
+  rcl_arena_block_t * next;
+  /// Payload capacity in bytes, starting after the aligned block header.
+  size_t capacity;
+  /// Payload bytes handed out so far.
+  size_t used;
+};
+
+static
+size_t
+__arena_align(size_t size)
+{
+  return (size + (RCL_ARENA_ALIGNMENT - 1)) & ~(RCL_ARENA_ALIGNMENT - 1);
+}
+
+/// Payload region of a block, after its aligned header.
+static
+char *
+__arena_block_payload(rcl_arena_block_t * block)
+{
+  return (char *)block + __arena_align(sizeof(rcl_arena_block_t));
+}
+
+rcl_arena_t
+rcl_get_zero_initialized_arena(void)
+{
+  static rcl_arena_t default_arena = {
+    .blocks = NULL,
+    .block_size = 0,
+  };
+  return default_arena;
+}
+
+rcl_ret_t
+rcl_arena_init(
+  rcl_arena_t * arena,
+  size_t block_size,
+  const rcl_allocator_t * base_allocator)
+{
+  RCL_CHECK_ARGUMENT_FOR_NULL(arena, RCL_RET_INVALID_ARGUMENT);
+  RCL_CHECK_ALLOCATOR_WITH_MSG(
+    base_allocator, "base allocator is invalid", return RCL_RET_INVALID_ARGUMENT);
+  if (NULL != arena->blocks) {
+    RCL_SET_ERROR_MSG("arena is already initialized");
+    return RCL_RET_ALREADY_INIT;
+  }
+  if (0 == block_size) {
+    RCL_SET_ERROR_MSG("block size must not be zero");
+    return RCL_RET_INVALID_ARGUMENT;
+  }
+  arena->base_allocator = *base_allocator;
+  arena->blocks = NULL;
+  arena->block_size = __arena_align(block_size);
+  return RCL_RET_OK;
+}
+
+void *
+rcl_arena_allocate(rcl_arena_t * arena, size_t size)
+{
+  if (NULL == arena || 0 == arena->block_size) {
+    return NULL;
+  }
+  // every allocation is preceded by an aligned cell recording its size,
+  // which reallocation through the facade needs to copy the old contents
+  size_t total = RCL_ARENA_ALIGNMENT + __arena_align(size);
+  rcl_arena_block_t * block = arena->blocks;
+  if (NULL == block || block->capacity - block->used < total) {
+    // oversized requests get a block of their own
+    size_t capacity = (total > arena->block_size) ? total : arena->block_size;
+    block = arena->base_allocator.allocate(
+      __arena_align(sizeof(rcl_arena_block_t)) + capacity,
+      arena->base_allocator.state);
+    if (NULL == block) {
+      return NULL;
+    }
+    block->capacity = capacity;
+    block->used = 0;
+    block->next = arena->blocks;
+    arena->blocks = block;
+  }
+  char * cell = __arena_block_payload(block) + block->used;
+  block->used += total;
+  *(size_t *)(void *)cell = size;
+  return cell + RCL_ARENA_ALIGNMENT;
+}
+
+static
+void *
+__arena_allocator_allocate(size_t size, void * state)
+{
+  return rcl_arena_allocate((rcl_arena_t *)state, size);
+}
+
+static
+void
+__arena_allocator_deallocate(void * pointer, void * state)
+{
+  // memory is reclaimed wholesale by rcl_arena_fini()
+  (void)pointer;
+  (void)state;
+}
+
+static
+void *
+__arena_allocator_reallocate(void * pointer, size_t size, void * state)
+{
+  rcl_arena_t * arena = (rcl_arena_t *)state;
+  if (NULL == pointer) {
+    return rcl_arena_allocate(arena, size);
+  }
+  size_t old_size = *(size_t *)(void *)((char *)pointer - RCL_ARENA_ALIGNMENT);
+  if (size <= old_size) {
+    return pointer;
+  }
+  void * new_pointer = rcl_arena_allocate(arena, size);
+  if (NULL != new_pointer) {
+    memcpy(new_pointer, pointer, old_size);
+  }
+  return new_pointer;
+}
+
+static
+void *
+__arena_allocator_zero_allocate(size_t number_of_elements, size_t size_of_element, void * state)
+{
+  size_t size = number_of_elements * size_of_element;
+  void * pointer = rcl_arena_allocate((rcl_arena_t *)state, size);
+  if (NULL != pointer) {
+    memset(pointer, 0, size);
+  }
+  return pointer;
+}
+
+rcl_allocator_t
+rcl_arena_get_allocator(rcl_arena_t * arena)
+{
+  rcl_allocator_t allocator;
+  allocator.allocate = __arena_allocator_allocate;
+  allocator.deallocate = __arena_allocator_deallocate;
+  allocator.reallocate = __arena_allocator_reallocate;
+  allocator.zero_allocate = __arena_allocator_zero_allocate;
+  allocator.state = arena;
+  return allocator;
+}
+
+rcl_ret_t
+rcl_arena_reset(rcl_arena_t * arena)
+{
+  RCL_CHECK_ARGUMENT_FOR_NULL(arena, RCL_RET_INVALID_ARGUMENT);
+  rcl_arena_block_t * block = arena->blocks;
+  if (NULL == block) {
+    return RCL_RET_OK;
+  }
+  // keep the newest block warm, release the rest
+  rcl_arena_block_t * older = block->next;
+  while (NULL != older) {
+    rcl_arena_block_t * next = older->next;
+    arena->base_allocator.deallocate(older, arena->base_allocator.state);
+    older = next;
+  }
+  block->next = NULL;
+  block->used = 0;
+  return RCL_RET_OK;
+}
+
+rcl_ret_t
+rcl_arena_fini(rcl_arena_t * arena)
+{
+  RCL_CHECK_ARGUMENT_FOR_NULL(arena, RCL_RET_INVALID_ARGUMENT);
+  rcl_arena_block_t * block = arena->blocks;
+  while (NULL != block) {
+    rcl_arena_block_t * next = block->next;
+    arena->base_allocator.deallocate(block, arena->base_allocator.state);
+    block = next;
+  }
+  arena->blocks = NULL;
+  arena->block_size = 0;
+  return RCL_RET_OK;
+}
+
+#ifdef __cplusplus
+}
+#endif
@@ -17,12 +17,15 @@
 #include "rcl/arguments.h"
 
 #include <assert.h>
+#include <inttypes.h>
 #include <string.h>
 
+#include "rcl/arena.h"
 #include "./arguments_impl.h"
 #include "./remap_impl.h"
 #include "rcl/error_handling.h"
 #include "rcl/lexer_lookahead.h"
+#include "rcl/trace.h"
 #include "rcl/validate_topic_name.h"
 #include "rcl_yaml_param_parser/parser.h"
 #include "rcl_yaml_param_parser/types.h"
@@ -31,6 +34,7 @@
 #include "rcutils/format_string.h"
 #include "rcutils/logging.h"
 #include "rcutils/logging_macros.h"
+#include "rcutils/stdatomic_helper.h"
 #include "rcutils/strdup.h"
 #include "rmw/validate_namespace.h"
 #include "rmw/validate_node_name.h"
@@ -44,6 +48,7 @@ extern "C"
 /**
  * \param[in] arg the argument to parse
  * \param[in] allocator an allocator to use
+ * \param[in] scratch_allocator an arena backed allocator for parse-time temporaries
  * \param[in,out] output_rule input a zero intialized rule, output a fully initialized one
  * \return RCL_RET_OK if a valid rule was parsed, or
  * \return RCL_RET_INVALID_REMAP_RULE if the argument is not a valid rule, or
@@ -55,11 +60,13 @@ rcl_ret_t
 _rcl_parse_remap_rule(
   const char * arg,
   rcl_allocator_t allocator,
+  rcl_allocator_t scratch_allocator,
   rcl_remap_t * output_rule);
 
 /// Parse an argument that may or may not be a param rule.
 /**
  * \param[in] arg the argument to parse
+ * \param[in] scratch_allocator an arena backed allocator for parse-time temporaries
  * \param[in,out] params param overrides structure to populate.
  *     This structure must have been initialized by the caller.
  * \return RCL_RET_OK if a valid rule was parsed, or
@@ -71,6 +78,7 @@ _rcl_parse_remap_rule(
 rcl_ret_t
 _rcl_parse_param_rule(
   const char * arg,
+  rcl_allocator_t scratch_allocator,
   rcl_params_t * params);
 
 rcl_ret_t
@@ -113,6 +121,65 @@ rcl_arguments_get_param_files_count(
   return args->impl->num_param_files_args;
 }
 
+/// Materialize parameter overrides from the recorded sources on first use.
+/**
+ * Parameter files are not parsed during rcl_parse_arguments(); their paths
+ * and the -p rules are recorded in command line order and parsed here the
+ * first time the overrides are requested.
+ */
+static
+rcl_ret_t
+_rcl_materialize_parameter_overrides(rcl_arguments_impl_t * args_impl)
+{
+  if (args_impl->parameter_overrides_materialized) {
+    return RCL_RET_OK;
+  }
+  rcl_params_t * params = rcl_yaml_node_struct_init(args_impl->allocator);
+  if (NULL == params) {
+    RCL_SET_ERROR_MSG("Failed to allocate memory for parameter overrides");
+    return RCL_RET_BAD_ALLOC;
+  }
+  rcl_arena_t scratch_arena = rcl_get_zero_initialized_arena();
+  rcl_ret_t ret = rcl_arena_init(&scratch_arena, 4096, &args_impl->allocator);
+  if (RCL_RET_OK != ret) {
+    rcl_yaml_node_struct_fini(params);
+    return ret;
+  }
+  rcl_allocator_t scratch_allocator = rcl_arena_get_allocator(&scratch_arena);
+  for (int i = 0; RCL_RET_OK == ret && i < args_impl->num_param_override_sources; ++i) {
+    if (args_impl->param_override_source_is_file[i]) {
+      RCL_TRACEPOINT(
+        RCL_TRACE_EVENT_PARAM_FILE_PARSE_BEGIN, args_impl->param_override_sources[i], 0, 0);
+      bool parsed = rcl_parse_yaml_file(args_impl->param_override_sources[i], params);
+      RCL_TRACEPOINT(
+        RCL_TRACE_EVENT_PARAM_FILE_PARSE_END, args_impl->param_override_sources[i],
+        parsed ? 1 : 0, 0);
+      if (!parsed) {
+        // Error message already set.
+        ret = RCL_RET_ERROR;
+      }
+    } else {
+      ret = _rcl_parse_param_rule(
+        args_impl->param_override_sources[i], scratch_allocator, params);
+    }
+  }
+  if (RCL_RET_OK != rcl_arena_fini(&scratch_arena)) {
+    RCUTILS_LOG_ERROR_NAMED(
+      ROS_PACKAGE_NAME, "Failed to fini scratch arena while materializing overrides");
+  }
+  if (RCL_RET_OK != ret) {
+    rcl_yaml_node_struct_fini(params);
+    return ret;
+  }
+  if (0U == params->num_nodes) {
+    rcl_yaml_node_struct_fini(params);
+    params = NULL;
+  }
+  args_impl->parameter_overrides = params;
+  args_impl->parameter_overrides_materialized = true;
+  return RCL_RET_OK;
+}
+
 rcl_ret_t
 rcl_arguments_get_param_overrides(
   const rcl_arguments_t * arguments,
@@ -126,6 +193,10 @@ rcl_arguments_get_param_overrides(
     RCL_SET_ERROR_MSG("Output parameter override pointer is not null. May leak memory.");
     return RCL_RET_INVALID_ARGUMENT;
   }
+  rcl_ret_t ret = _rcl_materialize_parameter_overrides(arguments->impl);
+  if (RCL_RET_OK != ret) {
+    return ret;
+  }
   *parameter_overrides = NULL;
   if (NULL != arguments->impl->parameter_overrides) {
     *parameter_overrides = rcl_yaml_node_struct_copy(arguments->impl->parameter_overrides);
@@ -163,6 +234,7 @@ RCL_LOCAL
 rcl_ret_t
 _rcl_parse_log_level(
   const char * arg,
+  rcl_allocator_t scratch_allocator,
   rcl_log_levels_t * log_levels);
 
 /// Parse an argument that may or may not be a log configuration file.
@@ -186,7 +258,6 @@ _rcl_parse_external_log_config_file(
  * The syntax of the file name is not validated.
  * \param[in] arg the argument to parse
  * \param[in] allocator an allocator to use
- * \param[in] params points to the populated parameter struct
  * \param[in,out] param_file string that could be a parameter file name
  * \return RCL_RET_OK if the rule was parsed correctly, or
  * \return RCL_RET_BAD_ALLOC if an allocation failed, or
@@ -197,7 +268,6 @@ rcl_ret_t
 _rcl_parse_param_file(
   const char * arg,
   rcl_allocator_t allocator,
-  rcl_params_t * params,
   char ** param_file);
 
 /// Parse an enclave argument.
@@ -267,6 +337,9 @@ rcl_parse_arguments(
 
   rcl_ret_t ret;
   rcl_ret_t fail_ret;
+  // Used only to validate -p rules at parse time; overrides are materialized
+  // from the recorded sources on first use.
+  rcl_params_t * validation_params = NULL;
 
   ret = _rcl_allocate_initialized_arguments_impl(args_output, &allocator);
   if (RCL_RET_OK != ret) {
@@ -279,6 +352,15 @@ rcl_parse_arguments(
     return RCL_RET_OK;
   }
 
+  // Parse-time temporaries (lexer state, name copies) are bump allocated out
+  // of one arena and reclaimed wholesale below instead of one free per piece.
+  rcl_arena_t scratch_arena = rcl_get_zero_initialized_arena();
+  ret = rcl_arena_init(&scratch_arena, 4096, &allocator);
+  if (RCL_RET_OK != ret) {
+    goto fail;
+  }
+  rcl_allocator_t scratch_allocator = rcl_arena_get_allocator(&scratch_arena);
+
   // over-allocate arrays to match the number of arguments
   args_impl->remap_rules = allocator.allocate(sizeof(rcl_remap_t) * argc, allocator.state);
   if (NULL == args_impl->remap_rules) {
@@ -286,8 +368,21 @@ rcl_parse_arguments(
     goto fail;
   }
 
-  args_impl->parameter_overrides = rcl_yaml_node_struct_init(allocator);
-  if (NULL == args_impl->parameter_overrides) {
+  validation_params = rcl_yaml_node_struct_init(allocator);
+  if (NULL == validation_params) {
+    ret = RCL_RET_BAD_ALLOC;
+    goto fail;
+  }
+
+  args_impl->param_override_sources = allocator.allocate(
+    sizeof(char *) * argc, allocator.state);
+  if (NULL == args_impl->param_override_sources) {
+    ret = RCL_RET_BAD_ALLOC;
+    goto fail;
+  }
+  args_impl->param_override_source_is_file = allocator.allocate(
+    sizeof(bool) * argc, allocator.state);
+  if (NULL == args_impl->param_override_source_is_file) {
     ret = RCL_RET_BAD_ALLOC;
     goto fail;
   }
@@ -332,7 +427,16 @@ rcl_parse_arguments(
       if (strcmp(RCL_PARAM_FLAG, argv[i]) == 0 || strcmp(RCL_SHORT_PARAM_FLAG, argv[i]) == 0) {
         if (i + 1 < argc) {
           // Attempt to parse next argument as parameter override rule
-          if (RCL_RET_OK == _rcl_parse_param_rule(argv[i + 1], args_impl->parameter_overrides)) {
+          if (RCL_RET_OK == _rcl_parse_param_rule(argv[i + 1], scratch_allocator, validation_params))
+          {
+            char * source_copy = rcutils_strdup(argv[i + 1], allocator);
+            if (NULL == source_copy) {
+              ret = RCL_RET_BAD_ALLOC;
+              goto fail;
+            }
+            args_impl->param_override_sources[args_impl->num_param_override_sources] = source_copy;
+            args_impl->param_override_source_is_file[args_impl->num_param_override_sources] = false;
+            ++(args_impl->num_param_override_sources);
             RCUTILS_LOG_DEBUG_NAMED(
               ROS_PACKAGE_NAME, "Got param override rule : %s\n", argv[i + 1]);
             ++i;  // Skip flag here, for loop will skip rule.
@@ -360,7 +464,7 @@ rcl_parse_arguments(
           // Attempt to parse next argument as remap rule
           rcl_remap_t * rule = &(args_impl->remap_rules[args_impl->num_remap_rules]);
           *rule = rcl_get_zero_initialized_remap();
-          if (RCL_RET_OK == _rcl_parse_remap_rule(argv[i + 1], allocator, rule)) {
+          if (RCL_RET_OK == _rcl_parse_remap_rule(argv[i + 1], allocator, scratch_allocator, rule)) {
             ++(args_impl->num_remap_rules);
             RCUTILS_LOG_DEBUG_NAMED(ROS_PACKAGE_NAME, "Got remap rule : %s\n", argv[i + 1]);
             ++i;  // Skip flag here, for loop will skip rule.
@@ -389,10 +493,18 @@ rcl_parse_arguments(
           args_impl->parameter_files[args_impl->num_param_files_args] = NULL;
           if (
             RCL_RET_OK == _rcl_parse_param_file(
-              argv[i + 1], allocator, args_impl->parameter_overrides,
+              argv[i + 1], allocator,
               &args_impl->parameter_files[args_impl->num_param_files_args]))
           {
             ++(args_impl->num_param_files_args);
+            char * source_copy = rcutils_strdup(argv[i + 1], allocator);
+            if (NULL == source_copy) {
+              ret = RCL_RET_BAD_ALLOC;
+              goto fail;
+            }
+            args_impl->param_override_sources[args_impl->num_param_override_sources] = source_copy;
+            args_impl->param_override_source_is_file[args_impl->num_param_override_sources] = true;
+            ++(args_impl->num_param_override_sources);
             RCUTILS_LOG_DEBUG_NAMED(
               ROS_PACKAGE_NAME,
               "Got params file : %s\ntotal num param files %d",
@@ -421,7 +533,7 @@ rcl_parse_arguments(
       if (strcmp(RCL_LOG_LEVEL_FLAG, argv[i]) == 0) {
         if (i + 1 < argc) {
           if (RCL_RET_OK ==
-            _rcl_parse_log_level(argv[i + 1], &args_impl->log_levels))
+            _rcl_parse_log_level(argv[i + 1], scratch_allocator, &args_impl->log_levels))
           {
             RCUTILS_LOG_DEBUG_NAMED(ROS_PACKAGE_NAME, "Got log level: %s\n", argv[i + 1]);
             ++i;  // Skip flag here, for loop will skip value.
@@ -572,7 +684,7 @@ rcl_parse_arguments(
       // Attempt to parse argument as remap rule in its deprecated form
       rcl_remap_t * rule = &(args_impl->remap_rules[args_impl->num_remap_rules]);
       *rule = rcl_get_zero_initialized_remap();
-      if (RCL_RET_OK == _rcl_parse_remap_rule(argv[i], allocator, rule)) {
+      if (RCL_RET_OK == _rcl_parse_remap_rule(argv[i], allocator, scratch_allocator, rule)) {
         RCUTILS_LOG_WARN_NAMED(
           ROS_PACKAGE_NAME,
           "Found remap rule '%s'. This syntax is deprecated. Use '%s %s %s' instead.",
@@ -610,6 +722,13 @@ rcl_parse_arguments(
     args_impl->remap_rules = new_remap_rules;
   }
 
+  // Compile the remap rules into a lookup index
+  ret = rcl_remap_index_init(
+    &args_impl->remap_index, args_impl->remap_rules, args_impl->num_remap_rules, allocator);
+  if (RCL_RET_OK != ret) {
+    goto fail;
+  }
+
   // Shrink Parameter files
   if (0 == args_impl->num_param_files_args) {
     allocator.deallocate(args_impl->parameter_files, allocator.state);
@@ -626,12 +745,37 @@ rcl_parse_arguments(
     args_impl->parameter_files = new_parameter_files;
   }
 
-  // Drop parameter overrides if none was found.
-  if (0U == args_impl->parameter_overrides->num_nodes) {
-    rcl_yaml_node_struct_fini(args_impl->parameter_overrides);
-    args_impl->parameter_overrides = NULL;
+  // Shrink parameter override sources; files among them are parsed lazily.
+  if (0 == args_impl->num_param_override_sources) {
+    allocator.deallocate(args_impl->param_override_sources, allocator.state);
+    args_impl->param_override_sources = NULL;
+    allocator.deallocate(args_impl->param_override_source_is_file, allocator.state);
+    args_impl->param_override_source_is_file = NULL;
+  } else if (args_impl->num_param_override_sources < argc) {
+    char ** new_sources = allocator.reallocate(
+      args_impl->param_override_sources,
+      sizeof(char *) * args_impl->num_param_override_sources,
+      &allocator);
+    if (NULL == new_sources) {
+      ret = RCL_RET_BAD_ALLOC;
+      goto fail;
+    }
+    args_impl->param_override_sources = new_sources;
+    bool * new_source_is_file = allocator.reallocate(
+      args_impl->param_override_source_is_file,
+      sizeof(bool) * args_impl->num_param_override_sources,
+      &allocator);
+    if (NULL == new_source_is_file) {
+      ret = RCL_RET_BAD_ALLOC;
+      goto fail;
+    }
+    args_impl->param_override_source_is_file = new_source_is_file;
   }
 
+  // The validation struct only existed to reject bad -p rules early.
+  rcl_yaml_node_struct_fini(validation_params);
+  validation_params = NULL;
+
   // Shrink unparsed_ros_args
   if (0 == args_impl->num_unparsed_ros_args) {
     // No unparsed ros args
@@ -666,9 +810,20 @@ rcl_parse_arguments(
     goto fail;
   }
 
+  ret = rcl_arena_fini(&scratch_arena);
+  if (RCL_RET_OK != ret) {
+    goto fail;
+  }
+
   return RCL_RET_OK;
 fail:
   fail_ret = ret;
+  if (NULL != validation_params) {
+    rcl_yaml_node_struct_fini(validation_params);
+  }
+  if (RCL_RET_OK != rcl_arena_fini(&scratch_arena)) {
+    RCUTILS_LOG_ERROR_NAMED(ROS_PACKAGE_NAME, "Failed to fini scratch arena after earlier failure");
+  }
   if (NULL != args_impl) {
     ret = rcl_arguments_fini(args_output);
     if (RCL_RET_OK != ret) {
@@ -824,108 +979,387 @@ rcl_arguments_copy(
     return RCL_RET_INVALID_ARGUMENT;
   }
 
-  rcl_allocator_t allocator = args->impl->allocator;
+  // The impl is never mutated after parsing and no public API writes through
+  // it, so a copy shares the impl and bumps its reference count instead of
+  // deep copying every rule.
+  rcutils_atomic_fetch_add_uint64_t(
+    (atomic_uint_least64_t *)(&args->impl->ref_count_storage), 1);
+  args_out->impl = args->impl;
+  return RCL_RET_OK;
+}
+
+/// Identifies a serialized arguments blob; reads as 'RCLA' on little-endian machines.
+#define ARGUMENTS_BLOB_MAGIC 0x414c4352u
+#define ARGUMENTS_BLOB_VERSION 1u
+/// Length value marking a string that was NULL.
+#define ARGUMENTS_BLOB_NULL_STRING 0xffffffffu
+
+static
+void
+__blob_write(uint8_t * buffer, size_t * offset, const void * data, size_t size)
+{
+  memcpy(buffer + *offset, data, size);
+  *offset += size;
+}
+
+static
+void
+__blob_write_u32(uint8_t * buffer, size_t * offset, uint32_t value)
+{
+  __blob_write(buffer, offset, &value, sizeof(value));
+}
+
+static
+void
+__blob_write_string(uint8_t * buffer, size_t * offset, const char * string)
+{
+  if (NULL == string) {
+    __blob_write_u32(buffer, offset, ARGUMENTS_BLOB_NULL_STRING);
+    return;
+  }
+  uint32_t length = (uint32_t)strlen(string);
+  __blob_write_u32(buffer, offset, length);
+  __blob_write(buffer, offset, string, length);
+}
+
+/// Encoded size of a string, counting its length prefix.
+static
+size_t
+__blob_string_size(const char * string)
+{
+  return sizeof(uint32_t) + ((NULL == string) ? 0u : strlen(string));
+}
 
-  rcl_ret_t ret = _rcl_allocate_initialized_arguments_impl(args_out, &allocator);
+static
+rcl_ret_t
+__blob_read(
+  const uint8_t * buffer, size_t buffer_length, size_t * offset, void * data, size_t size)
+{
+  if (buffer_length - *offset < size) {
+    RCL_SET_ERROR_MSG("serialized arguments are truncated");
+    return RCL_RET_INVALID_ARGUMENT;
+  }
+  memcpy(data, buffer + *offset, size);
+  *offset += size;
+  return RCL_RET_OK;
+}
+
+static
+rcl_ret_t
+__blob_read_u32(const uint8_t * buffer, size_t buffer_length, size_t * offset, uint32_t * value)
+{
+  return __blob_read(buffer, buffer_length, offset, value, sizeof(*value));
+}
+
+/// Read a length prefixed string into a NUL terminated copy, or NULL.
+static
+rcl_ret_t
+__blob_read_string(
+  const uint8_t * buffer, size_t buffer_length, size_t * offset,
+  rcl_allocator_t allocator, char ** string_out)
+{
+  uint32_t length;
+  rcl_ret_t ret = __blob_read_u32(buffer, buffer_length, offset, &length);
   if (RCL_RET_OK != ret) {
     return ret;
   }
+  if (ARGUMENTS_BLOB_NULL_STRING == length) {
+    *string_out = NULL;
+    return RCL_RET_OK;
+  }
+  if (buffer_length - *offset < length) {
+    RCL_SET_ERROR_MSG("serialized arguments are truncated");
+    return RCL_RET_INVALID_ARGUMENT;
+  }
+  if (NULL != memchr(buffer + *offset, '\0', length)) {
+    RCL_SET_ERROR_MSG("serialized string contains an embedded NUL");
+    return RCL_RET_INVALID_ARGUMENT;
+  }
+  char * string = allocator.allocate(length + 1u, allocator.state);
+  if (NULL == string) {
+    return RCL_RET_BAD_ALLOC;
+  }
+  memcpy(string, buffer + *offset, length);
+  string[length] = '\0';
+  *offset += length;
+  *string_out = string;
+  return RCL_RET_OK;
+}
 
-  if (args->impl->num_unparsed_args) {
-    // Copy unparsed args
-    args_out->impl->unparsed_args = allocator.allocate(
-      sizeof(int) * args->impl->num_unparsed_args, allocator.state);
-    if (NULL == args_out->impl->unparsed_args) {
-      if (RCL_RET_OK != rcl_arguments_fini(args_out)) {
-        RCL_SET_ERROR_MSG("Error while finalizing arguments due to another error");
-      }
-      return RCL_RET_BAD_ALLOC;
-    }
-    for (int i = 0; i < args->impl->num_unparsed_args; ++i) {
-      args_out->impl->unparsed_args[i] = args->impl->unparsed_args[i];
-    }
-    args_out->impl->num_unparsed_args = args->impl->num_unparsed_args;
+rcl_ret_t
+rcl_arguments_serialize(
+  const rcl_arguments_t * args,
+  rcl_allocator_t allocator,
+  uint8_t ** buffer,
+  size_t * buffer_length)
+{
+  RCL_CHECK_ARGUMENT_FOR_NULL(args, RCL_RET_INVALID_ARGUMENT);
+  RCL_CHECK_ARGUMENT_FOR_NULL(args->impl, RCL_RET_INVALID_ARGUMENT);
+  RCL_CHECK_ALLOCATOR_WITH_MSG(&allocator, "invalid allocator", return RCL_RET_INVALID_ARGUMENT);
+  RCL_CHECK_ARGUMENT_FOR_NULL(buffer, RCL_RET_INVALID_ARGUMENT);
+  RCL_CHECK_ARGUMENT_FOR_NULL(buffer_length, RCL_RET_INVALID_ARGUMENT);
+
+  const rcl_arguments_impl_t * impl = args->impl;
+  const rcl_log_levels_t * log_levels = &impl->log_levels;
+
+  // First pass computes the exact blob size.
+  size_t size = 2 * sizeof(uint32_t);  // magic and version
+  size += sizeof(uint32_t);  // number of remap rules
+  for (int i = 0; i < impl->num_remap_rules; ++i) {
+    const rcl_remap_impl_t * rule = impl->remap_rules[i].impl;
+    size += 1u;  // rule type
+    size += __blob_string_size(rule->node_name);
+    size += __blob_string_size(rule->match);
+    size += __blob_string_size(rule->replacement);
+  }
+  size += __blob_string_size(impl->enclave);
+  size += 3u;  // logging disable flags
+  size += __blob_string_size(impl->external_log_config_file);
+  size += 2 * sizeof(uint32_t);  // default severity and number of logger settings
+  for (size_t i = 0; i < log_levels->num_logger_settings; ++i) {
+    size += __blob_string_size(log_levels->logger_settings[i].name);
+    size += sizeof(uint32_t);  // severity
+  }
+
+  uint8_t * blob = allocator.allocate(size, allocator.state);
+  if (NULL == blob) {
+    RCL_SET_ERROR_MSG("failed to allocate memory for serialized arguments");
+    return RCL_RET_BAD_ALLOC;
   }
 
-  if (args->impl->num_unparsed_ros_args) {
-    // Copy unparsed ROS args
-    args_out->impl->unparsed_ros_args = allocator.allocate(
-      sizeof(int) * args->impl->num_unparsed_ros_args, allocator.state);
-    if (NULL == args_out->impl->unparsed_ros_args) {
-      if (RCL_RET_OK != rcl_arguments_fini(args_out)) {
-        RCL_SET_ERROR_MSG("Error while finalizing arguments due to another error");
-      }
-      return RCL_RET_BAD_ALLOC;
-    }
-    for (int i = 0; i < args->impl->num_unparsed_ros_args; ++i) {
-      args_out->impl->unparsed_ros_args[i] = args->impl->unparsed_ros_args[i];
-    }
-    args_out->impl->num_unparsed_ros_args = args->impl->num_unparsed_ros_args;
+  // Second pass fills it in.
+  size_t offset = 0u;
+  __blob_write_u32(blob, &offset, ARGUMENTS_BLOB_MAGIC);
+  __blob_write_u32(blob, &offset, ARGUMENTS_BLOB_VERSION);
+  __blob_write_u32(blob, &offset, (uint32_t)impl->num_remap_rules);
+  for (int i = 0; i < impl->num_remap_rules; ++i) {
+    const rcl_remap_impl_t * rule = impl->remap_rules[i].impl;
+    uint8_t type = (uint8_t)rule->type;
+    __blob_write(blob, &offset, &type, sizeof(type));
+    __blob_write_string(blob, &offset, rule->node_name);
+    __blob_write_string(blob, &offset, rule->match);
+    __blob_write_string(blob, &offset, rule->replacement);
+  }
+  __blob_write_string(blob, &offset, impl->enclave);
+  uint8_t flags[3] = {
+    impl->log_stdout_disabled, impl->log_rosout_disabled, impl->log_ext_lib_disabled};
+  __blob_write(blob, &offset, flags, sizeof(flags));
+  __blob_write_string(blob, &offset, impl->external_log_config_file);
+  __blob_write_u32(blob, &offset, (uint32_t)log_levels->default_logger_level);
+  __blob_write_u32(blob, &offset, (uint32_t)log_levels->num_logger_settings);
+  for (size_t i = 0; i < log_levels->num_logger_settings; ++i) {
+    __blob_write_string(blob, &offset, log_levels->logger_settings[i].name);
+    __blob_write_u32(blob, &offset, (uint32_t)log_levels->logger_settings[i].level);
+  }
+
+  if (offset != size) {
+    // Should never happen
+    allocator.deallocate(blob, allocator.state);
+    RCL_SET_ERROR_MSG("Internal serialization bug: wrote a different size than computed");
+    return RCL_RET_ERROR;
   }
+  *buffer = blob;
+  *buffer_length = size;
+  return RCL_RET_OK;
+}
 
-  if (args->impl->num_remap_rules) {
-    // Copy remap rules
-    args_out->impl->remap_rules = allocator.allocate(
-      sizeof(rcl_remap_t) * args->impl->num_remap_rules, allocator.state);
-    if (NULL == args_out->impl->remap_rules) {
-      if (RCL_RET_OK != rcl_arguments_fini(args_out)) {
-        RCL_SET_ERROR_MSG("Error while finalizing arguments due to another error");
-      }
-      return RCL_RET_BAD_ALLOC;
+rcl_ret_t
+rcl_arguments_deserialize(
+  const uint8_t * buffer,
+  size_t buffer_length,
+  rcl_allocator_t allocator,
+  rcl_arguments_t * args_out)
+{
+  RCL_CHECK_ARGUMENT_FOR_NULL(buffer, RCL_RET_INVALID_ARGUMENT);
+  RCL_CHECK_ALLOCATOR_WITH_MSG(&allocator, "invalid allocator", return RCL_RET_INVALID_ARGUMENT);
+  RCL_CHECK_ARGUMENT_FOR_NULL(args_out, RCL_RET_INVALID_ARGUMENT);
+  if (NULL != args_out->impl) {
+    RCL_SET_ERROR_MSG("args_out must be zero initialized");
+    return RCL_RET_INVALID_ARGUMENT;
+  }
+
+  size_t offset = 0u;
+  uint32_t magic;
+  uint32_t version;
+  rcl_ret_t ret = __blob_read_u32(buffer, buffer_length, &offset, &magic);
+  if (RCL_RET_OK != ret) {
+    return ret;
+  }
+  ret = __blob_read_u32(buffer, buffer_length, &offset, &version);
+  if (RCL_RET_OK != ret) {
+    return ret;
+  }
+  if (ARGUMENTS_BLOB_MAGIC != magic) {
+    RCL_SET_ERROR_MSG("buffer is not a serialized arguments blob");
+    return RCL_RET_INVALID_ARGUMENT;
+  }
+  if (ARGUMENTS_BLOB_VERSION != version) {
+    RCL_SET_ERROR_MSG_WITH_FORMAT_STRING(
+      "unsupported serialized arguments version %" PRIu32, version);
+    return RCL_RET_INVALID_ARGUMENT;
+  }
+
+  ret = _rcl_allocate_initialized_arguments_impl(args_out, &allocator);
+  if (RCL_RET_OK != ret) {
+    return ret;
+  }
+  rcl_arguments_impl_t * args_impl = args_out->impl;
+
+  uint32_t num_rules;
+  ret = __blob_read_u32(buffer, buffer_length, &offset, &num_rules);
+  if (RCL_RET_OK != ret) {
+    goto fail;
+  }
+  // Each rule encodes at least a type byte and three length prefixes, which
+  // bounds a corrupted rule count before the rule array is allocated.
+  if ((size_t)num_rules > (buffer_length - offset) / (1u + 3u * sizeof(uint32_t))) {
+    RCL_SET_ERROR_MSG("serialized arguments are truncated");
+    ret = RCL_RET_INVALID_ARGUMENT;
+    goto fail;
+  }
+  if (num_rules > 0u) {
+    args_impl->remap_rules = allocator.allocate(
+      sizeof(rcl_remap_t) * num_rules, allocator.state);
+    if (NULL == args_impl->remap_rules) {
+      ret = RCL_RET_BAD_ALLOC;
+      goto fail;
     }
-    for (int i = 0; i < args->impl->num_remap_rules; ++i) {
-      args_out->impl->remap_rules[i] = rcl_get_zero_initialized_remap();
-      ret = rcl_remap_copy(
-        &(args->impl->remap_rules[i]), &(args_out->impl->remap_rules[i]));
+    for (uint32_t i = 0u; i < num_rules; ++i) {
+      rcl_remap_t * rule = &(args_impl->remap_rules[i]);
+      *rule = rcl_get_zero_initialized_remap();
+      rule->impl = allocator.allocate(sizeof(rcl_remap_impl_t), allocator.state);
+      if (NULL == rule->impl) {
+        ret = RCL_RET_BAD_ALLOC;
+        goto fail;
+      }
+      rule->impl->allocator = allocator;
+      rule->impl->type = RCL_UNKNOWN_REMAP;
+      rule->impl->node_name = NULL;
+      rule->impl->match = NULL;
+      rule->impl->replacement = NULL;
+      // Count the rule now so rcl_arguments_fini() reclaims it on failure.
+      ++(args_impl->num_remap_rules);
+
+      uint8_t type;
+      ret = __blob_read(buffer, buffer_length, &offset, &type, sizeof(type));
       if (RCL_RET_OK != ret) {
-        if (RCL_RET_OK != rcl_arguments_fini(args_out)) {
-          RCL_SET_ERROR_MSG("Error while finalizing arguments due to another error");
-        }
-        return ret;
+        goto fail;
+      }
+      const uint8_t all_types =
+        RCL_TOPIC_REMAP | RCL_SERVICE_REMAP | RCL_NODENAME_REMAP | RCL_NAMESPACE_REMAP;
+      if (0u == type || 0u != (type & (uint8_t)~all_types)) {
+        RCL_SET_ERROR_MSG("serialized remap rule has an invalid type");
+        ret = RCL_RET_INVALID_ARGUMENT;
+        goto fail;
+      }
+      rule->impl->type = (rcl_remap_type_t)type;
+      ret = __blob_read_string(
+        buffer, buffer_length, &offset, allocator, &rule->impl->node_name);
+      if (RCL_RET_OK != ret) {
+        goto fail;
+      }
+      ret = __blob_read_string(buffer, buffer_length, &offset, allocator, &rule->impl->match);
+      if (RCL_RET_OK != ret) {
+        goto fail;
+      }
+      ret = __blob_read_string(
+        buffer, buffer_length, &offset, allocator, &rule->impl->replacement);
+      if (RCL_RET_OK != ret) {
+        goto fail;
+      }
+      if (NULL == rule->impl->replacement) {
+        RCL_SET_ERROR_MSG("serialized remap rule is missing its replacement");
+        ret = RCL_RET_INVALID_ARGUMENT;
+        goto fail;
+      }
+      if (0u != (type & (RCL_TOPIC_REMAP | RCL_SERVICE_REMAP)) && NULL == rule->impl->match) {
+        RCL_SET_ERROR_MSG("serialized name remap rule is missing its match side");
+        ret = RCL_RET_INVALID_ARGUMENT;
+        goto fail;
       }
-      ++(args_out->impl->num_remap_rules);
     }
   }
+  ret = rcl_remap_index_init(
+    &args_impl->remap_index, args_impl->remap_rules, args_impl->num_remap_rules, allocator);
+  if (RCL_RET_OK != ret) {
+    goto fail;
+  }
 
-  // Copy parameter rules
-  if (args->impl->parameter_overrides) {
-    args_out->impl->parameter_overrides =
-      rcl_yaml_node_struct_copy(args->impl->parameter_overrides);
+  ret = __blob_read_string(buffer, buffer_length, &offset, allocator, &args_impl->enclave);
+  if (RCL_RET_OK != ret) {
+    goto fail;
+  }
+  uint8_t flags[3];
+  ret = __blob_read(buffer, buffer_length, &offset, flags, sizeof(flags));
+  if (RCL_RET_OK != ret) {
+    goto fail;
+  }
+  args_impl->log_stdout_disabled = (0u != flags[0]);
+  args_impl->log_rosout_disabled = (0u != flags[1]);
+  args_impl->log_ext_lib_disabled = (0u != flags[2]);
+  ret = __blob_read_string(
+    buffer, buffer_length, &offset, allocator, &args_impl->external_log_config_file);
+  if (RCL_RET_OK != ret) {
+    goto fail;
   }
 
-  // Copy parameter files
-  if (args->impl->num_param_files_args) {
-    args_out->impl->parameter_files = allocator.zero_allocate(
-      args->impl->num_param_files_args, sizeof(char *), allocator.state);
-    if (NULL == args_out->impl->parameter_files) {
-      if (RCL_RET_OK != rcl_arguments_fini(args_out)) {
-        RCL_SET_ERROR_MSG("Error while finalizing arguments due to another error");
-      }
-      return RCL_RET_BAD_ALLOC;
+  uint32_t default_severity;
+  uint32_t num_settings;
+  ret = __blob_read_u32(buffer, buffer_length, &offset, &default_severity);
+  if (RCL_RET_OK != ret) {
+    goto fail;
+  }
+  ret = __blob_read_u32(buffer, buffer_length, &offset, &num_settings);
+  if (RCL_RET_OK != ret) {
+    goto fail;
+  }
+  // Each logger setting encodes at least a name length prefix and a severity.
+  if ((size_t)num_settings > (buffer_length - offset) / (2u * sizeof(uint32_t))) {
+    RCL_SET_ERROR_MSG("serialized arguments are truncated");
+    ret = RCL_RET_INVALID_ARGUMENT;
+    goto fail;
+  }
+  ret = rcl_log_levels_init(&args_impl->log_levels, &allocator, num_settings);
+  if (RCL_RET_OK != ret) {
+    goto fail;
+  }
+  args_impl->log_levels.default_logger_level = (rcl_log_severity_t)default_severity;
+  for (uint32_t i = 0u; i < num_settings; ++i) {
+    char * logger_name = NULL;
+    uint32_t severity;
+    ret = __blob_read_string(buffer, buffer_length, &offset, allocator, &logger_name);
+    if (RCL_RET_OK != ret) {
+      goto fail;
     }
-    for (int i = 0; i < args->impl->num_param_files_args; ++i) {
-      args_out->impl->parameter_files[i] =
-        rcutils_strdup(args->impl->parameter_files[i], allocator);
-      if (NULL == args_out->impl->parameter_files[i]) {
-        if (RCL_RET_OK != rcl_arguments_fini(args_out)) {
-          RCL_SET_ERROR_MSG("Error while finalizing arguments due to another error");
-        }
-        return RCL_RET_BAD_ALLOC;
-      }
-      ++(args_out->impl->num_param_files_args);
+    if (NULL == logger_name) {
+      RCL_SET_ERROR_MSG("serialized logger setting is missing its name");
+      ret = RCL_RET_INVALID_ARGUMENT;
+      goto fail;
     }
-  }
-  char * enclave_copy = rcutils_strdup(args->impl->enclave, allocator);
-  if (args->impl->enclave && !enclave_copy) {
-    if (RCL_RET_OK != rcl_arguments_fini(args_out)) {
-      RCL_SET_ERROR_MSG("Error while finalizing arguments due to another error");
-    } else {
-      RCL_SET_ERROR_MSG("Error while copying enclave argument");
+    ret = __blob_read_u32(buffer, buffer_length, &offset, &severity);
+    if (RCL_RET_OK == ret) {
+      // makes its own copy of the name
+      ret = rcl_log_levels_add_logger_setting(
+        &args_impl->log_levels, logger_name, (rcl_log_severity_t)severity);
     }
-    return RCL_RET_BAD_ALLOC;
+    allocator.deallocate(logger_name, allocator.state);
+    if (RCL_RET_OK != ret) {
+      goto fail;
+    }
+  }
+
+  if (offset != buffer_length) {
+    RCL_SET_ERROR_MSG("serialized arguments have trailing bytes");
+    ret = RCL_RET_INVALID_ARGUMENT;
+    goto fail;
   }
-  args_out->impl->enclave = enclave_copy;
   return RCL_RET_OK;
+
+fail:
+  if (RCL_RET_OK != rcl_arguments_fini(args_out)) {
+    RCL_SET_ERROR_MSG("Error while finalizing arguments due to another error");
+  }
+  return ret;
 }
 
 rcl_ret_t
@@ -934,7 +1368,21 @@ rcl_arguments_fini(
 {
   RCL_CHECK_ARGUMENT_FOR_NULL(args, RCL_RET_INVALID_ARGUMENT);
   if (args->impl) {
+    uint64_t previous_count = rcutils_atomic_fetch_add_uint64_t(
+      (atomic_uint_least64_t *)(&args->impl->ref_count_storage), -1);
+    if (previous_count > 1u) {
+      // Another rcl_arguments_t still shares this impl.
+      args->impl = NULL;
+      return RCL_RET_OK;
+    }
     rcl_ret_t ret = RCL_RET_OK;
+    rcl_ret_t index_ret = rcl_remap_index_fini(&args->impl->remap_index);
+    if (index_ret != RCL_RET_OK) {
+      ret = index_ret;
+      RCUTILS_LOG_ERROR_NAMED(
+        ROS_PACKAGE_NAME,
+        "Failed to finalize remap index while finalizing arguments. Continuing...");
+    }
     if (args->impl->remap_rules) {
       for (int i = 0; i < args->impl->num_remap_rules; ++i) {
         rcl_ret_t remap_ret = rcl_remap_fini(&(args->impl->remap_rules[i]));
@@ -971,6 +1419,20 @@ rcl_arguments_fini(
       args->impl->parameter_overrides = NULL;
     }
 
+    if (args->impl->param_override_sources) {
+      for (int i = 0; i < args->impl->num_param_override_sources; ++i) {
+        args->impl->allocator.deallocate(
+          args->impl->param_override_sources[i], args->impl->allocator.state);
+      }
+      args->impl->allocator.deallocate(
+        args->impl->param_override_sources, args->impl->allocator.state);
+      args->impl->param_override_sources = NULL;
+      args->impl->allocator.deallocate(
+        args->impl->param_override_source_is_file, args->impl->allocator.state);
+      args->impl->param_override_source_is_file = NULL;
+      args->impl->num_param_override_sources = 0;
+    }
+
     if (args->impl->parameter_files) {
       for (int p = 0; p < args->impl->num_param_files_args; ++p) {
         args->impl->allocator.deallocate(
@@ -1728,6 +2190,7 @@ _rcl_parse_log_level_name(
 rcl_ret_t
 _rcl_parse_log_level(
   const char * arg,
+  rcl_allocator_t scratch_allocator,
   rcl_log_levels_t * log_levels)
 {
   RCL_CHECK_ARGUMENT_FOR_NULL(arg, RCL_RET_INVALID_ARGUMENT);
@@ -1743,12 +2206,12 @@ _rcl_parse_log_level(
 
   rcl_lexer_lookahead2_t lex_lookahead = rcl_get_zero_initialized_lexer_lookahead2();
 
-  ret = rcl_lexer_lookahead2_init(&lex_lookahead, arg, *allocator);
+  ret = rcl_lexer_lookahead2_init(&lex_lookahead, arg, scratch_allocator);
   if (RCL_RET_OK != ret) {
     return ret;
   }
 
-  ret = _rcl_parse_log_level_name(&lex_lookahead, allocator, &logger_name);
+  ret = _rcl_parse_log_level_name(&lex_lookahead, &scratch_allocator, &logger_name);
   if (RCL_RET_OK == ret) {
     if (strlen(logger_name) == 0) {
       RCL_SET_ERROR_MSG("Argument has an invalid logger item that name is empty");
@@ -1778,7 +2241,7 @@ _rcl_parse_log_level(
     }
 
     rcutils_ret = rcutils_logging_severity_level_from_string(
-      level_token, *allocator, &level);
+      level_token, scratch_allocator, &level);
     if (RCUTILS_RET_OK == rcutils_ret) {
       ret = rcl_log_levels_add_logger_setting(
         log_levels, logger_name, (rcl_log_severity_t)level);
@@ -1788,7 +2251,7 @@ _rcl_parse_log_level(
     }
   } else {
     rcutils_ret = rcutils_logging_severity_level_from_string(
-      arg, *allocator, &level);
+      arg, scratch_allocator, &level);
     if (RCUTILS_RET_OK == rcutils_ret) {
       if (log_levels->default_logger_level != (rcl_log_severity_t)level) {
         if (log_levels->default_logger_level != RCUTILS_LOG_SEVERITY_UNSET) {
@@ -1809,7 +2272,7 @@ _rcl_parse_log_level(
 
 cleanup:
   if (logger_name) {
-    allocator->deallocate(logger_name, allocator->state);
+    scratch_allocator.deallocate(logger_name, scratch_allocator.state);
   }
   rcl_ret_t rv = rcl_lexer_lookahead2_fini(&lex_lookahead);
   if (RCL_RET_OK != rv) {
@@ -1827,6 +2290,7 @@ rcl_ret_t
 _rcl_parse_remap_rule(
   const char * arg,
   rcl_allocator_t allocator,
+  rcl_allocator_t scratch_allocator,
   rcl_remap_t * output_rule)
 {
   RCL_CHECK_ARGUMENT_FOR_NULL(arg, RCL_RET_INVALID_ARGUMENT);
@@ -1844,7 +2308,7 @@ _rcl_parse_remap_rule(
   output_rule->impl->replacement = NULL;
 
   rcl_lexer_lookahead2_t lex_lookahead = rcl_get_zero_initialized_lexer_lookahead2();
-  rcl_ret_t ret = rcl_lexer_lookahead2_init(&lex_lookahead, arg, allocator);
+  rcl_ret_t ret = rcl_lexer_lookahead2_init(&lex_lookahead, arg, scratch_allocator);
 
   if (RCL_RET_OK == ret) {
     ret = _rcl_parse_remap_begin_remap_rule(&lex_lookahead, output_rule);
@@ -1875,6 +2339,7 @@ _rcl_parse_remap_rule(
 rcl_ret_t
 _rcl_parse_param_rule(
   const char * arg,
+  rcl_allocator_t scratch_allocator,
   rcl_params_t * params)
 {
   RCL_CHECK_ARGUMENT_FOR_NULL(arg, RCL_RET_INVALID_ARGUMENT);
@@ -1882,7 +2347,7 @@ _rcl_parse_param_rule(
 
   rcl_lexer_lookahead2_t lex_lookahead = rcl_get_zero_initialized_lexer_lookahead2();
 
-  rcl_ret_t ret = rcl_lexer_lookahead2_init(&lex_lookahead, arg, params->allocator);
+  rcl_ret_t ret = rcl_lexer_lookahead2_init(&lex_lookahead, arg, scratch_allocator);
   if (RCL_RET_OK != ret) {
     return ret;
   }
@@ -1899,7 +2364,7 @@ _rcl_parse_param_rule(
   }
 
   if (RCL_LEXEME_TOKEN == lexeme1 && RCL_LEXEME_COLON == lexeme2) {
-    ret = _rcl_parse_nodename_prefix(&lex_lookahead, params->allocator, &node_name);
+    ret = _rcl_parse_nodename_prefix(&lex_lookahead, scratch_allocator, &node_name);
     if (RCL_RET_OK != ret) {
       if (RCL_RET_WRONG_LEXEME == ret) {
         ret = RCL_RET_INVALID_PARAM_RULE;
@@ -1907,7 +2372,7 @@ _rcl_parse_param_rule(
       goto cleanup;
     }
   } else {
-    node_name = rcutils_strdup("/**", params->allocator);
+    node_name = rcutils_strdup("/**", scratch_allocator);
     if (NULL == node_name) {
       ret = RCL_RET_BAD_ALLOC;
       goto cleanup;
@@ -1916,7 +2381,7 @@ _rcl_parse_param_rule(
 
   // TODO(hidmic): switch to _rcl_parse_resource_match() when parameter names
   //               are standardized to use slashes in lieu of dots.
-  ret = _rcl_parse_param_name(&lex_lookahead, params->allocator, &param_name);
+  ret = _rcl_parse_param_name(&lex_lookahead, scratch_allocator, &param_name);
   if (RCL_RET_OK != ret) {
     if (RCL_RET_WRONG_LEXEME == ret) {
       ret = RCL_RET_INVALID_PARAM_RULE;
@@ -1937,8 +2402,8 @@ _rcl_parse_param_rule(
   }
 
 cleanup:
-  params->allocator.deallocate(param_name, params->allocator.state);
-  params->allocator.deallocate(node_name, params->allocator.state);
+  scratch_allocator.deallocate(param_name, scratch_allocator.state);
+  scratch_allocator.deallocate(node_name, scratch_allocator.state);
   if (RCL_RET_OK != ret) {
     if (RCL_RET_OK != rcl_lexer_lookahead2_fini(&lex_lookahead)) {
       RCUTILS_LOG_ERROR_NAMED(ROS_PACKAGE_NAME, "Failed to fini lookahead2 after error occurred");
@@ -1953,23 +2418,16 @@ rcl_ret_t
 _rcl_parse_param_file(
   const char * arg,
   rcl_allocator_t allocator,
-  rcl_params_t * params,
   char ** param_file)
 {
   RCL_CHECK_ARGUMENT_FOR_NULL(arg, RCL_RET_INVALID_ARGUMENT);
-  RCL_CHECK_ARGUMENT_FOR_NULL(params, RCL_RET_INVALID_ARGUMENT);
   RCL_CHECK_ARGUMENT_FOR_NULL(param_file, RCL_RET_INVALID_ARGUMENT);
+  // The file is not parsed here; overrides are materialized on first use.
   *param_file = rcutils_strdup(arg, allocator);
   if (NULL == *param_file) {
     RCL_SET_ERROR_MSG("Failed to allocate memory for parameters file path");
     return RCL_RET_BAD_ALLOC;
   }
-  if (!rcl_parse_yaml_file(*param_file, params)) {
-    allocator.deallocate(*param_file, allocator.state);
-    *param_file = NULL;
-    // Error message already set.
-    return RCL_RET_ERROR;
-  }
   return RCL_RET_OK;
 }
 
@@ -2052,8 +2510,10 @@ _rcl_allocate_initialized_arguments_impl(rcl_arguments_t * args, rcl_allocator_t
   }
 
   rcl_arguments_impl_t * args_impl = args->impl;
+  atomic_init((atomic_uint_least64_t *)(&args_impl->ref_count_storage), 1);
   args_impl->num_remap_rules = 0;
   args_impl->remap_rules = NULL;
+  args_impl->remap_index = rcl_get_zero_initialized_remap_index();
   args_impl->log_levels = rcl_get_zero_initialized_log_levels();
   args_impl->external_log_config_file = NULL;
   args_impl->unparsed_args = NULL;
@@ -2061,6 +2521,10 @@ _rcl_allocate_initialized_arguments_impl(rcl_arguments_t * args, rcl_allocator_t
   args_impl->unparsed_ros_args = NULL;
   args_impl->num_unparsed_ros_args = 0;
   args_impl->parameter_overrides = NULL;
+  args_impl->parameter_overrides_materialized = false;
+  args_impl->param_override_sources = NULL;
+  args_impl->param_override_source_is_file = NULL;
+  args_impl->num_param_override_sources = 0;
   args_impl->parameter_files = NULL;
   args_impl->num_param_files_args = 0;
   args_impl->log_stdout_disabled = false;
@@ -15,11 +15,24 @@
 #ifndef RCL__ARGUMENTS_IMPL_H_
 #define RCL__ARGUMENTS_IMPL_H_
 
+#include <stdint.h>
+
 #include "rcl/arguments.h"
 #include "rcl/log_level.h"
 #include "rcl_yaml_param_parser/types.h"
 #include "./remap_impl.h"
 
+/// @cond Doxygen_Suppress
+#ifndef RCL_ALIGNAS
+#ifdef _MSC_VER
+#define RCL_ALIGNAS(N) __declspec(align(N))
+#else
+#include <stdalign.h>
+#define RCL_ALIGNAS(N) alignas(N)
+#endif
+#endif
+/// @endcond
+
 #ifdef __cplusplus
 extern "C"
 {
@@ -28,6 +41,14 @@ extern "C"
 /// \internal
 struct rcl_arguments_impl_s
 {
+  /// Number of rcl_arguments_t structures sharing this impl.
+  /**
+   * The underlying type is atomic_uint_least64_t accessed through its storage
+   * bytes, because this header is also included from C++ translation units
+   * which cannot include stdatomic.h.
+   */
+  RCL_ALIGNAS(8) uint8_t ref_count_storage[8];
+
   /// Array of indices to unknown ROS specific arguments.
   int * unparsed_ros_args;
   /// Length of unparsed_ros_args.
@@ -38,8 +59,17 @@ struct rcl_arguments_impl_s
   /// Length of unparsed_args.
   int num_unparsed_args;
 
-  /// Parameter override rules parsed from arguments.
+  /// Parameter override rules, or NULL until materialized from the sources.
   rcl_params_t * parameter_overrides;
+  /// True once parameter_overrides was materialized from the sources.
+  bool parameter_overrides_materialized;
+  /// Argument strings for parameter overrides in command line order.
+  /// Entries are either a parameter file path or a single -p override rule.
+  char ** param_override_sources;
+  /// Parallel to param_override_sources; true entries are file paths.
+  bool * param_override_source_is_file;
+  /// Length of param_override_sources.
+  int num_param_override_sources;
 
   /// Array of yaml parameter file paths
   char ** parameter_files;
@@ -50,6 +80,8 @@ struct rcl_arguments_impl_s
   rcl_remap_t * remap_rules;
   /// Length of remap_rules.
   int num_remap_rules;
+  /// Lookup index compiled from remap_rules after parsing.
+  rcl_remap_index_t remap_index;
 
   /// Log levels parsed from arguments.
   rcl_log_levels_t log_levels;
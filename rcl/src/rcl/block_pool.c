@@ -0,0 +1,261 @@
+// Copyright 2026 Open Source Robotics Foundation, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+#include "rcl/block_pool.h"
+
+#include <string.h>
+
+#include "rcl/error_handling.h"
+
+// Alignment of every pool allocation; large enough for any scalar type.
+#define RCL_BLOCK_POOL_ALIGNMENT (2 * sizeof(void *))
+
+struct rcl_block_pool_chunk_s
+{
+  rcl_block_pool_chunk_t * next;
+};
+
+struct rcl_block_pool_free_node_s
+{
+  rcl_block_pool_free_node_t * next;
+};
+
+static
+size_t
+__block_pool_align(size_t size)
+{
+  return (size + (RCL_BLOCK_POOL_ALIGNMENT - 1)) & ~(RCL_BLOCK_POOL_ALIGNMENT - 1);
+}
+
+/// Stride of one block within a chunk: an aligned header cell recording the
+/// payload size (shared with the facade, see __block_pool_allocator_allocate)
+/// followed by the aligned payload.
+static
+size_t
+__block_pool_stride(const rcl_block_pool_t * pool)
+{
+  return RCL_BLOCK_POOL_ALIGNMENT + pool->block_size;
+}
+
+rcl_block_pool_t
+rcl_get_zero_initialized_block_pool(void)
+{
+  static rcl_block_pool_t default_pool = {
+    .block_size = 0,
+    .blocks_per_chunk = 0,
+    .chunks = NULL,
+    .free_list = NULL,
+  };
+  return default_pool;
+}
+
+rcl_ret_t
+rcl_block_pool_init(
+  rcl_block_pool_t * pool,
+  size_t block_size,
+  size_t blocks_per_chunk,
+  const rcl_allocator_t * base_allocator)
+{
+  RCL_CHECK_ARGUMENT_FOR_NULL(pool, RCL_RET_INVALID_ARGUMENT);
+  RCL_CHECK_ALLOCATOR_WITH_MSG(
+    base_allocator, "base allocator is invalid", return RCL_RET_INVALID_ARGUMENT);
+  if (NULL != pool->chunks || 0 != pool->block_size) {
+    RCL_SET_ERROR_MSG("block pool is already initialized");
+    return RCL_RET_ALREADY_INIT;
+  }
+  if (0 == block_size || 0 == blocks_per_chunk) {
+    RCL_SET_ERROR_MSG("block size and blocks per chunk must not be zero");
+    return RCL_RET_INVALID_ARGUMENT;
+  }
+  // a free block doubles as a free list node, so it must be able to hold one
+  if (block_size < sizeof(rcl_block_pool_free_node_t)) {
+    block_size = sizeof(rcl_block_pool_free_node_t);
+  }
+  pool->base_allocator = *base_allocator;
+  pool->block_size = __block_pool_align(block_size);
+  pool->blocks_per_chunk = blocks_per_chunk;
+  pool->chunks = NULL;
+  pool->free_list = NULL;
+  return RCL_RET_OK;
+}
+
+/// Carve a new chunk into blocks and push them all onto the free list.
+static
+bool
+__block_pool_add_chunk(rcl_block_pool_t * pool)
+{
+  size_t header_size = __block_pool_align(sizeof(rcl_block_pool_chunk_t));
+  rcl_block_pool_chunk_t * chunk = pool->base_allocator.allocate(
+    header_size + pool->blocks_per_chunk * __block_pool_stride(pool),
+    pool->base_allocator.state);
+  if (NULL == chunk) {
+    return false;
+  }
+  chunk->next = pool->chunks;
+  pool->chunks = chunk;
+  char * cell = (char *)chunk + header_size;
+  for (size_t i = 0; i < pool->blocks_per_chunk; ++i) {
+    rcl_block_pool_free_node_t * node =
+      (rcl_block_pool_free_node_t *)(void *)(cell + RCL_BLOCK_POOL_ALIGNMENT);
+    node->next = pool->free_list;
+    pool->free_list = node;
+    cell += __block_pool_stride(pool);
+  }
+  return true;
+}
+
+void *
+rcl_block_pool_allocate(rcl_block_pool_t * pool)
+{
+  if (NULL == pool || 0 == pool->block_size) {
+    return NULL;
+  }
+  if (NULL == pool->free_list && !__block_pool_add_chunk(pool)) {
+    return NULL;
+  }
+  rcl_block_pool_free_node_t * node = pool->free_list;
+  pool->free_list = node->next;
+  return node;
+}
+
+void
+rcl_block_pool_deallocate(rcl_block_pool_t * pool, void * pointer)
+{
+  if (NULL == pool || NULL == pointer) {
+    return;
+  }
+  rcl_block_pool_free_node_t * node = pointer;
+  node->next = pool->free_list;
+  pool->free_list = node;
+}
+
+static
+void *
+__block_pool_allocator_allocate(size_t size, void * state)
+{
+  rcl_block_pool_t * pool = state;
+  if (NULL == pool || 0 == pool->block_size) {
+    return NULL;
+  }
+  char * cell;
+  if (size <= pool->block_size) {
+    char * pointer = rcl_block_pool_allocate(pool);
+    if (NULL == pointer) {
+      return NULL;
+    }
+    cell = pointer - RCL_BLOCK_POOL_ALIGNMENT;
+  } else {
+    cell = pool->base_allocator.allocate(
+      RCL_BLOCK_POOL_ALIGNMENT + size, pool->base_allocator.state);
+    if (NULL == cell) {
+      return NULL;
+    }
+  }
+  // the header cell records the requested size, which routes deallocation
+  // and bounds the copy done by reallocation
+  *(size_t *)(void *)cell = size;
+  return cell + RCL_BLOCK_POOL_ALIGNMENT;
+}
+
+static
+void
+__block_pool_allocator_deallocate(void * pointer, void * state)
+{
+  rcl_block_pool_t * pool = state;
+  if (NULL == pool || NULL == pointer) {
+    return;
+  }
+  char * cell = (char *)pointer - RCL_BLOCK_POOL_ALIGNMENT;
+  if (*(size_t *)(void *)cell <= pool->block_size) {
+    rcl_block_pool_deallocate(pool, pointer);
+  } else {
+    pool->base_allocator.deallocate(cell, pool->base_allocator.state);
+  }
+}
+
+static
+void *
+__block_pool_allocator_reallocate(void * pointer, size_t size, void * state)
+{
+  rcl_block_pool_t * pool = state;
+  if (NULL == pointer) {
+    return __block_pool_allocator_allocate(size, state);
+  }
+  if (NULL == pool) {
+    return NULL;
+  }
+  size_t old_size = *(size_t *)(void *)((char *)pointer - RCL_BLOCK_POOL_ALIGNMENT);
+  // pool blocks can absorb any growth up to their fixed capacity in place
+  if (size <= old_size || (old_size <= pool->block_size && size <= pool->block_size)) {
+    *(size_t *)(void *)((char *)pointer - RCL_BLOCK_POOL_ALIGNMENT) = size;
+    return pointer;
+  }
+  void * new_pointer = __block_pool_allocator_allocate(size, state);
+  if (NULL != new_pointer) {
+    memcpy(new_pointer, pointer, old_size);
+    __block_pool_allocator_deallocate(pointer, state);
+  }
+  return new_pointer;
+}
+
+static
+void *
+__block_pool_allocator_zero_allocate(
+  size_t number_of_elements, size_t size_of_element, void * state)
+{
+  size_t size = number_of_elements * size_of_element;
+  void * pointer = __block_pool_allocator_allocate(size, state);
+  if (NULL != pointer) {
+    memset(pointer, 0, size);
+  }
+  return pointer;
+}
+
+rcl_allocator_t
+rcl_block_pool_get_allocator(rcl_block_pool_t * pool)
+{
+  rcl_allocator_t allocator;
+  allocator.allocate = __block_pool_allocator_allocate;
+  allocator.deallocate = __block_pool_allocator_deallocate;
+  allocator.reallocate = __block_pool_allocator_reallocate;
+  allocator.zero_allocate = __block_pool_allocator_zero_allocate;
+  allocator.state = pool;
+  return allocator;
+}
+
+rcl_ret_t
+rcl_block_pool_fini(rcl_block_pool_t * pool)
+{
+  RCL_CHECK_ARGUMENT_FOR_NULL(pool, RCL_RET_INVALID_ARGUMENT);
+  rcl_block_pool_chunk_t * chunk = pool->chunks;
+  while (NULL != chunk) {
+    rcl_block_pool_chunk_t * next = chunk->next;
+    pool->base_allocator.deallocate(chunk, pool->base_allocator.state);
+    chunk = next;
+  }
+  pool->chunks = NULL;
+  pool->free_list = NULL;
+  pool->block_size = 0;
+  pool->blocks_per_chunk = 0;
+  return RCL_RET_OK;
+}
+
+#ifdef __cplusplus
+}
+#endif
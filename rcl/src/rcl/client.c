@@ -19,6 +19,8 @@ extern "C"
 
 #include "rcl/client.h"
 
+#include <assert.h>
+#include <stddef.h>
 #include <stdio.h>
 #include <string.h>
 
@@ -29,6 +31,7 @@ extern "C"
 #include "rcutils/logging_macros.h"
 #include "rcutils/macros.h"
 #include "rcutils/stdatomic_helper.h"
+#include "rcutils/strdup.h"
 #include "rmw/error_handling.h"
 #include "rmw/rmw.h"
 #include "service_msgs/msg/service_event_info.h"
@@ -39,17 +42,111 @@ extern "C"
 #include "./common.h"
 #include "./service_event_publisher.h"
 
+/// A pipelined request slot claimed and released with atomic operations.
+typedef struct rcl_client_pipeline_slot_s
+{
+  /// Correlating sequence number, or one of the _RCL_CLIENT_SLOT_* markers.
+  atomic_int_least64_t sequence_number;
+  rcl_client_response_callback_t callback;
+  const void * user_data;
+} rcl_client_pipeline_slot_t;
+
+/// Outstanding-request table backing the pipelined client mode.
+/**
+ * Open addressing keyed by sequence number: a request's slot is probed from
+ * sequence modulo capacity, so correlating a response is O(1) in the common
+ * case instead of a scan over every in-flight request.
+ */
+typedef struct rcl_client_pipeline_s
+{
+  /// Slot storage, NULL while pipelining is not enabled.
+  rcl_client_pipeline_slot_t * slots;
+  size_t capacity;
+  /// Number of requests currently in flight, bounds the window.
+  atomic_uint_least64_t outstanding;
+} rcl_client_pipeline_t;
+
+/// Slot holds no request and can be claimed.
+#define _RCL_CLIENT_SLOT_FREE (-1)
+/// Slot is claimed but its sequence number has not been published yet.
+#define _RCL_CLIENT_SLOT_CLAIMED (-2)
+
+/// Register a sent request in its hashed slot; lock-free.
+static
+bool
+_rcl_client_pipeline_insert(
+  rcl_client_pipeline_t * pipeline,
+  int64_t sequence_number,
+  rcl_client_response_callback_t callback,
+  const void * user_data)
+{
+  size_t slot_index = (size_t)((uint64_t)sequence_number % pipeline->capacity);
+  for (size_t probed = 0u; probed < pipeline->capacity; ++probed) {
+    rcl_client_pipeline_slot_t * slot = &pipeline->slots[slot_index];
+    bool exchanged = false;
+    int64_t expected = _RCL_CLIENT_SLOT_FREE;
+    rcutils_atomic_compare_exchange_strong(
+      &slot->sequence_number, exchanged, &expected, (int64_t)_RCL_CLIENT_SLOT_CLAIMED);
+    if (exchanged) {
+      slot->callback = callback;
+      slot->user_data = user_data;
+      rcutils_atomic_store(&slot->sequence_number, sequence_number);
+      return true;
+    }
+    slot_index = (slot_index + 1u) % pipeline->capacity;
+  }
+  return false;
+}
+
+/// Claim the slot correlating to a response, O(1) from the sequence hash.
+static
+bool
+_rcl_client_pipeline_extract(
+  rcl_client_pipeline_t * pipeline,
+  int64_t sequence_number,
+  rcl_client_response_callback_t * callback,
+  const void ** user_data)
+{
+  size_t slot_index = (size_t)((uint64_t)sequence_number % pipeline->capacity);
+  for (size_t probed = 0u; probed < pipeline->capacity; ++probed) {
+    rcl_client_pipeline_slot_t * slot = &pipeline->slots[slot_index];
+    bool exchanged = false;
+    int64_t expected = sequence_number;
+    rcutils_atomic_compare_exchange_strong(
+      &slot->sequence_number, exchanged, &expected, (int64_t)_RCL_CLIENT_SLOT_FREE);
+    if (exchanged) {
+      *callback = slot->callback;
+      *user_data = slot->user_data;
+      rcutils_atomic_fetch_add_uint64_t(&pipeline->outstanding, (uint64_t)-1);
+      return true;
+    }
+    slot_index = (slot_index + 1u) % pipeline->capacity;
+  }
+  return false;
+}
+
+// Cold configuration first; the sequence counter and the pipeline state
+// mutated on every send/take live on their own cache line so concurrent
+// senders do not bounce the line holding the read-mostly fields.
 struct rcl_client_impl_s
 {
   rcl_client_options_t options;
   rmw_qos_profile_t actual_request_publisher_qos;
   rmw_qos_profile_t actual_response_subscription_qos;
   rmw_client_t * rmw_handle;
-  atomic_int_least64_t sequence_number;
   rcl_service_event_publisher_t * service_event_publisher;
   char * remapped_service_name;
+
+  // --- hot mutable state, cache-line separated from the fields above ---
+  RCL_ALIGNAS(RCL_CACHE_LINE_SIZE) atomic_int_least64_t sequence_number;
+  rcl_client_pipeline_t pipeline;
 };
 
+// Pin the layout so a refactor cannot silently reintroduce false sharing.
+static_assert(
+  offsetof(struct rcl_client_impl_s, sequence_number) % RCL_CACHE_LINE_SIZE == 0,
+  "client hot state must start on a cache line boundary");
+
 rcl_client_t
 rcl_get_zero_initialized_client()
 {
@@ -80,30 +177,17 @@ unconfigure_service_introspection(
   return ret;
 }
 
-rcl_ret_t
-rcl_client_init(
+/// Shared tail of client initialization; `resolved_service_name` must
+/// already be fully expanded and remapped and stays owned by the caller.
+static rcl_ret_t
+_rcl_client_init_with_resolved_name(
   rcl_client_t * client,
   const rcl_node_t * node,
   const rosidl_service_type_support_t * type_support,
-  const char * service_name,
+  const char * resolved_service_name,
   const rcl_client_options_t * options)
 {
-  // check the options and allocator first, so the allocator can be passed to errors
-  RCL_CHECK_ARGUMENT_FOR_NULL(options, RCL_RET_INVALID_ARGUMENT);
   rcl_allocator_t * allocator = (rcl_allocator_t *)&options->allocator;
-  RCL_CHECK_ALLOCATOR_WITH_MSG(allocator, "invalid allocator", return RCL_RET_INVALID_ARGUMENT);
-  RCL_CHECK_ARGUMENT_FOR_NULL(client, RCL_RET_INVALID_ARGUMENT);
-  if (!rcl_node_is_valid(node)) {
-    return RCL_RET_NODE_INVALID;  // error already set
-  }
-  RCL_CHECK_ARGUMENT_FOR_NULL(type_support, RCL_RET_INVALID_ARGUMENT);
-  RCL_CHECK_ARGUMENT_FOR_NULL(service_name, RCL_RET_INVALID_ARGUMENT);
-  RCUTILS_LOG_DEBUG_NAMED(
-    ROS_PACKAGE_NAME, "Initializing client for service name '%s'", service_name);
-  if (client->impl) {
-    RCL_SET_ERROR_MSG("client already initialized, or memory was unintialized");
-    return RCL_RET_ALREADY_INIT;
-  }
 
   // Allocate space for the implementation struct.
   client->impl = (rcl_client_impl_t *)allocator->zero_allocate(
@@ -112,25 +196,13 @@ rcl_client_init(
     client->impl, "allocating memory failed",
     return RCL_RET_BAD_ALLOC;);
 
-  // Expand the given service name.
-  rcl_ret_t ret = rcl_node_resolve_name(
-    node,
-    service_name,
-    *allocator,
-    true,
-    false,
-    &client->impl->remapped_service_name);
-  if (ret != RCL_RET_OK) {
-    if (ret == RCL_RET_SERVICE_NAME_INVALID || ret == RCL_RET_UNKNOWN_SUBSTITUTION) {
-      ret = RCL_RET_SERVICE_NAME_INVALID;
-    } else if (RCL_RET_BAD_ALLOC != ret) {
-      ret = RCL_RET_ERROR;
-    }
+  rcl_ret_t ret = RCL_RET_OK;
+  client->impl->remapped_service_name = rcutils_strdup(resolved_service_name, *allocator);
+  if (NULL == client->impl->remapped_service_name) {
+    RCL_SET_ERROR_MSG("allocating memory failed");
+    ret = RCL_RET_BAD_ALLOC;
     goto free_client_impl;
   }
-  RCUTILS_LOG_DEBUG_NAMED(
-    ROS_PACKAGE_NAME, "Expanded and remapped service name '%s'",
-    client->impl->remapped_service_name);
 
   // Fill out implementation struct.
   // rmw handle (create rmw client)
@@ -203,6 +275,93 @@ free_client_impl:
   return ret;
 }
 
+rcl_ret_t
+rcl_client_init(
+  rcl_client_t * client,
+  const rcl_node_t * node,
+  const rosidl_service_type_support_t * type_support,
+  const char * service_name,
+  const rcl_client_options_t * options)
+{
+  // check the options and allocator first, so the allocator can be passed to errors
+  RCL_CHECK_ARGUMENT_FOR_NULL(options, RCL_RET_INVALID_ARGUMENT);
+  rcl_allocator_t * allocator = (rcl_allocator_t *)&options->allocator;
+  RCL_CHECK_ALLOCATOR_WITH_MSG(allocator, "invalid allocator", return RCL_RET_INVALID_ARGUMENT);
+  RCL_CHECK_ARGUMENT_FOR_NULL(client, RCL_RET_INVALID_ARGUMENT);
+  if (!rcl_node_is_valid(node)) {
+    return RCL_RET_NODE_INVALID;  // error already set
+  }
+  RCL_CHECK_ARGUMENT_FOR_NULL(type_support, RCL_RET_INVALID_ARGUMENT);
+  RCL_CHECK_ARGUMENT_FOR_NULL(service_name, RCL_RET_INVALID_ARGUMENT);
+  RCUTILS_LOG_DEBUG_NAMED(
+    ROS_PACKAGE_NAME, "Initializing client for service name '%s'", service_name);
+  if (client->impl) {
+    RCL_SET_ERROR_MSG("client already initialized, or memory was unintialized");
+    return RCL_RET_ALREADY_INIT;
+  }
+
+  // Expand and remap the given service name.
+  char * remapped_service_name = NULL;
+  rcl_ret_t ret = rcl_node_resolve_name(
+    node,
+    service_name,
+    *allocator,
+    true,
+    false,
+    &remapped_service_name);
+  if (ret != RCL_RET_OK) {
+    if (ret == RCL_RET_SERVICE_NAME_INVALID || ret == RCL_RET_UNKNOWN_SUBSTITUTION) {
+      ret = RCL_RET_SERVICE_NAME_INVALID;
+    } else if (RCL_RET_BAD_ALLOC != ret) {
+      ret = RCL_RET_ERROR;
+    }
+    allocator->deallocate(remapped_service_name, allocator->state);
+    return ret;
+  }
+  RCUTILS_LOG_DEBUG_NAMED(
+    ROS_PACKAGE_NAME, "Expanded and remapped service name '%s'", remapped_service_name);
+
+  ret = _rcl_client_init_with_resolved_name(
+    client, node, type_support, remapped_service_name, options);
+  allocator->deallocate(remapped_service_name, allocator->state);
+  return ret;
+}
+
+rcl_ret_t
+rcl_client_init_with_resolved_name(
+  rcl_client_t * client,
+  const rcl_node_t * node,
+  const rosidl_service_type_support_t * type_support,
+  const char * resolved_service_name,
+  const rcl_client_options_t * options)
+{
+  RCL_CHECK_ARGUMENT_FOR_NULL(options, RCL_RET_INVALID_ARGUMENT);
+  rcl_allocator_t * allocator = (rcl_allocator_t *)&options->allocator;
+  RCL_CHECK_ALLOCATOR_WITH_MSG(allocator, "invalid allocator", return RCL_RET_INVALID_ARGUMENT);
+  RCL_CHECK_ARGUMENT_FOR_NULL(client, RCL_RET_INVALID_ARGUMENT);
+  if (!rcl_node_is_valid(node)) {
+    return RCL_RET_NODE_INVALID;  // error already set
+  }
+  RCL_CHECK_ARGUMENT_FOR_NULL(type_support, RCL_RET_INVALID_ARGUMENT);
+  RCL_CHECK_ARGUMENT_FOR_NULL(resolved_service_name, RCL_RET_INVALID_ARGUMENT);
+  if (client->impl) {
+    RCL_SET_ERROR_MSG("client already initialized, or memory was unintialized");
+    return RCL_RET_ALREADY_INIT;
+  }
+  // The name is trusted to come from a prior resolution; only guard against
+  // names that obviously never went through one.
+  if ('/' != resolved_service_name[0]) {
+    RCL_SET_ERROR_MSG("resolved service name must be fully qualified");
+    return RCL_RET_SERVICE_NAME_INVALID;
+  }
+  RCUTILS_LOG_DEBUG_NAMED(
+    ROS_PACKAGE_NAME, "Initializing client for resolved service name '%s'",
+    resolved_service_name);
+
+  return _rcl_client_init_with_resolved_name(
+    client, node, type_support, resolved_service_name, options);
+}
+
 rcl_ret_t
 rcl_client_fini(rcl_client_t * client, rcl_node_t * node)
 {
@@ -239,6 +398,10 @@ rcl_client_fini(rcl_client_t * client, rcl_node_t * node)
     allocator.deallocate(client->impl->remapped_service_name, allocator.state);
     client->impl->remapped_service_name = NULL;
 
+    if (client->impl->pipeline.slots) {
+      allocator.deallocate(client->impl->pipeline.slots, allocator.state);
+    }
+
     allocator.deallocate(client->impl, allocator.state);
     client->impl = NULL;
   }
@@ -295,14 +458,17 @@ rcl_send_request(const rcl_client_t * client, const void * ros_request, int64_t
   }
   RCL_CHECK_ARGUMENT_FOR_NULL(ros_request, RCL_RET_INVALID_ARGUMENT);
   RCL_CHECK_ARGUMENT_FOR_NULL(sequence_number, RCL_RET_INVALID_ARGUMENT);
-  *sequence_number = rcutils_atomic_load_int64_t(&client->impl->sequence_number);
+  // Hand rmw a unique candidate via fetch-add so concurrent senders never
+  // race over the same value; rmw overwrites it with the assigned number.
+  *sequence_number =
+    rcutils_atomic_fetch_add_int64_t(&client->impl->sequence_number, 1) + 1;
   if (rmw_send_request(
       client->impl->rmw_handle, ros_request, sequence_number) != RMW_RET_OK)
   {
     RCL_SET_ERROR_MSG(rmw_get_error_string().str);
     return RCL_RET_ERROR;
   }
-  rcutils_atomic_exchange_int64_t(&client->impl->sequence_number, *sequence_number);
+  rcutils_atomic_store(&client->impl->sequence_number, *sequence_number);
 
   if (client->impl->service_event_publisher != NULL) {
     rmw_gid_t gid;
@@ -351,7 +517,7 @@ rcl_take_response_with_info(
   RCUTILS_LOG_DEBUG_NAMED(
     ROS_PACKAGE_NAME, "Client take response succeeded: %s", taken ? "true" : "false");
   if (!taken) {
-    return RCL_RET_CLIENT_TAKE_FAILED;
+    RCL_RETURN_EXPECTED(RCL_RET_CLIENT_TAKE_FAILED);
   }
 
   if (client->impl->service_event_publisher != NULL) {
@@ -388,6 +554,205 @@ rcl_take_response(
   return ret;
 }
 
+rcl_ret_t
+rcl_client_init_pipeline(rcl_client_t * client, size_t window_size)
+{
+  if (!rcl_client_is_valid(client)) {
+    return RCL_RET_CLIENT_INVALID;  // error already set
+  }
+  if (0u == window_size) {
+    RCL_SET_ERROR_MSG("window_size must be greater than zero");
+    return RCL_RET_INVALID_ARGUMENT;
+  }
+  rcl_client_pipeline_t * pipeline = &client->impl->pipeline;
+  if (NULL != pipeline->slots) {
+    RCL_SET_ERROR_MSG("pipelining is already initialized");
+    return RCL_RET_ALREADY_INIT;
+  }
+  rcl_allocator_t * allocator = &client->impl->options.allocator;
+  pipeline->slots = (rcl_client_pipeline_slot_t *)allocator->zero_allocate(
+    window_size, sizeof(rcl_client_pipeline_slot_t), allocator->state);
+  RCL_CHECK_FOR_NULL_WITH_MSG(
+    pipeline->slots, "allocating pipeline slots failed", return RCL_RET_BAD_ALLOC);
+  for (size_t i = 0u; i < window_size; ++i) {
+    atomic_init(&pipeline->slots[i].sequence_number, _RCL_CLIENT_SLOT_FREE);
+  }
+  pipeline->capacity = window_size;
+  atomic_init(&pipeline->outstanding, 0u);
+  return RCL_RET_OK;
+}
+
+rcl_ret_t
+rcl_client_fini_pipeline(rcl_client_t * client)
+{
+  if (!rcl_client_is_valid(client)) {
+    return RCL_RET_CLIENT_INVALID;  // error already set
+  }
+  rcl_client_pipeline_t * pipeline = &client->impl->pipeline;
+  if (NULL == pipeline->slots) {
+    return RCL_RET_OK;
+  }
+  rcl_allocator_t * allocator = &client->impl->options.allocator;
+  allocator->deallocate(pipeline->slots, allocator->state);
+  pipeline->slots = NULL;
+  pipeline->capacity = 0u;
+  return RCL_RET_OK;
+}
+
+rcl_ret_t
+rcl_send_request_pipelined(
+  const rcl_client_t * client,
+  const void * ros_request,
+  rcl_client_response_callback_t callback,
+  const void * user_data,
+  int64_t * sequence_number)
+{
+  if (!rcl_client_is_valid(client)) {
+    return RCL_RET_CLIENT_INVALID;  // error already set
+  }
+  RCL_CHECK_ARGUMENT_FOR_NULL(ros_request, RCL_RET_INVALID_ARGUMENT);
+  RCL_CHECK_ARGUMENT_FOR_NULL(sequence_number, RCL_RET_INVALID_ARGUMENT);
+  rcl_client_pipeline_t * pipeline = &client->impl->pipeline;
+  if (NULL == pipeline->slots) {
+    RCL_SET_ERROR_MSG("pipelining is not initialized, call rcl_client_init_pipeline() first");
+    return RCL_RET_INVALID_ARGUMENT;
+  }
+  // Reserve window capacity lock-free; concurrent senders race on the
+  // counter, not a mutex.
+  uint64_t outstanding =
+    rcutils_atomic_fetch_add_uint64_t(&pipeline->outstanding, 1u);
+  if (outstanding >= (uint64_t)pipeline->capacity) {
+    rcutils_atomic_fetch_add_uint64_t(&pipeline->outstanding, (uint64_t)-1);
+    RCL_SET_ERROR_MSG("all pipeline slots are outstanding");
+    return RCL_RET_ERROR;
+  }
+  rcl_ret_t ret = rcl_send_request(client, ros_request, sequence_number);
+  if (RCL_RET_OK != ret) {
+    rcutils_atomic_fetch_add_uint64_t(&pipeline->outstanding, (uint64_t)-1);
+    return ret;  // error already set
+  }
+  if (!_rcl_client_pipeline_insert(pipeline, *sequence_number, callback, user_data)) {
+    // cannot happen while the window reservation holds, but fail loudly
+    rcutils_atomic_fetch_add_uint64_t(&pipeline->outstanding, (uint64_t)-1);
+    RCL_SET_ERROR_MSG("no pipeline slot could be claimed for the request");
+    return RCL_RET_ERROR;
+  }
+  return RCL_RET_OK;
+}
+
+rcl_ret_t
+rcl_take_response_demuxed(
+  const rcl_client_t * client,
+  rmw_service_info_t * request_header,
+  void * ros_response,
+  const void ** context)
+{
+  if (!rcl_client_is_valid(client)) {
+    return RCL_RET_CLIENT_INVALID;  // error already set
+  }
+  RCL_CHECK_ARGUMENT_FOR_NULL(request_header, RCL_RET_INVALID_ARGUMENT);
+  RCL_CHECK_ARGUMENT_FOR_NULL(ros_response, RCL_RET_INVALID_ARGUMENT);
+  RCL_CHECK_ARGUMENT_FOR_NULL(context, RCL_RET_INVALID_ARGUMENT);
+  rcl_client_pipeline_t * pipeline = &client->impl->pipeline;
+  if (NULL == pipeline->slots) {
+    RCL_SET_ERROR_MSG("pipelining is not initialized, call rcl_client_init_pipeline() first");
+    return RCL_RET_INVALID_ARGUMENT;
+  }
+  rcl_ret_t ret = rcl_take_response_with_info(client, request_header, ros_response);
+  if (RCL_RET_OK != ret) {
+    return ret;  // error already set, take failed is not an error
+  }
+  *context = NULL;
+  rcl_client_response_callback_t callback = NULL;
+  if (!_rcl_client_pipeline_extract(
+      pipeline, request_header->request_id.sequence_number, &callback, context))
+  {
+    RCL_SET_ERROR_MSG("response does not correlate to any outstanding pipelined request");
+    return RCL_RET_ERROR;
+  }
+  return RCL_RET_OK;
+}
+
+rcl_ret_t
+rcl_client_drain_responses(
+  const rcl_client_t * client,
+  void * ros_response,
+  size_t * completed)
+{
+  if (!rcl_client_is_valid(client)) {
+    return RCL_RET_CLIENT_INVALID;  // error already set
+  }
+  RCL_CHECK_ARGUMENT_FOR_NULL(ros_response, RCL_RET_INVALID_ARGUMENT);
+  RCL_CHECK_ARGUMENT_FOR_NULL(completed, RCL_RET_INVALID_ARGUMENT);
+  rcl_client_pipeline_t * pipeline = &client->impl->pipeline;
+  if (NULL == pipeline->slots) {
+    RCL_SET_ERROR_MSG("pipelining is not initialized, call rcl_client_init_pipeline() first");
+    return RCL_RET_INVALID_ARGUMENT;
+  }
+  *completed = 0u;
+  for (;;) {
+    rmw_service_info_t request_header;
+    rcl_ret_t ret = rcl_take_response_with_info(client, &request_header, ros_response);
+    if (RCL_RET_CLIENT_TAKE_FAILED == ret) {
+      break;  // queue drained
+    }
+    if (RCL_RET_OK != ret) {
+      return ret;  // error already set
+    }
+    const int64_t sequence = request_header.request_id.sequence_number;
+    rcl_client_response_callback_t callback = NULL;
+    const void * user_data = NULL;
+    if (_rcl_client_pipeline_extract(pipeline, sequence, &callback, &user_data)) {
+      if (NULL != callback) {
+        callback(user_data, sequence, ros_response);
+      }
+      ++(*completed);
+    }
+    // a response no slot claims is discarded
+  }
+  if (0u == *completed) {
+    RCL_RETURN_EXPECTED(RCL_RET_CLIENT_TAKE_FAILED);
+  }
+  return RCL_RET_OK;
+}
+
+/// Bridge from the pipeline's bare callback to a completion context.
+static
+void
+_rcl_client_completion_trampoline(
+  const void * user_data,
+  int64_t sequence_number,
+  void * ros_response)
+{
+  rcl_client_completion_context_t * context =
+    (rcl_client_completion_context_t *)user_data;
+  context->sequence_number = sequence_number;
+  context->ros_response = ros_response;
+  context->on_complete(context);
+  // the response storage is reused by the drain loop after this returns
+  context->ros_response = NULL;
+}
+
+rcl_ret_t
+rcl_client_async_send_request(
+  const rcl_client_t * client,
+  const void * ros_request,
+  rcl_client_completion_context_t * context)
+{
+  if (!rcl_client_is_valid(client)) {
+    return RCL_RET_CLIENT_INVALID;  // error already set
+  }
+  RCL_CHECK_ARGUMENT_FOR_NULL(ros_request, RCL_RET_INVALID_ARGUMENT);
+  RCL_CHECK_ARGUMENT_FOR_NULL(context, RCL_RET_INVALID_ARGUMENT);
+  RCL_CHECK_FOR_NULL_WITH_MSG(
+    context->on_complete, "context->on_complete must be set",
+    return RCL_RET_INVALID_ARGUMENT);
+  context->ros_response = NULL;
+  return rcl_send_request_pipelined(
+    client, ros_request, _rcl_client_completion_trampoline, context,
+    &context->sequence_number);
+}
+
 bool
 rcl_client_is_valid(const rcl_client_t * client)
 {
@@ -479,6 +844,22 @@ rcl_client_configure_service_introspection(
     client->impl->service_event_publisher, introspection_state);
 }
 
+rcl_ret_t
+rcl_client_set_introspection_payload_limit(
+  rcl_client_t * client,
+  size_t max_payload_bytes)
+{
+  if (!rcl_client_is_valid(client)) {
+    return RCL_RET_CLIENT_INVALID;  // error already set
+  }
+  if (NULL == client->impl->service_event_publisher) {
+    RCL_SET_ERROR_MSG("service introspection is not configured on this client");
+    return RCL_RET_ERROR;
+  }
+  return rcl_service_event_publisher_set_payload_limit(
+    client->impl->service_event_publisher, max_payload_bytes);
+}
+
 #ifdef __cplusplus
 }
 #endif
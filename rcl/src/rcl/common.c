@@ -23,43 +23,51 @@ extern "C"
 
 #include "rcl/allocator.h"
 #include "rcl/error_handling.h"
+#include "rcl/macros.h"
+
+// The converters run after every rmw and rcutils call on the data plane, so
+// both are constant table lookups instead of switches. Unmapped entries are
+// zero, which cannot be confused with a real mapping because the only code
+// translating to RCL_RET_OK (also zero) is handled up front.
 
 rcl_ret_t
 rcl_convert_rmw_ret_to_rcl_ret(rmw_ret_t rmw_ret)
 {
-  switch (rmw_ret) {
-    case RMW_RET_OK:
-      return RCL_RET_OK;
-    case RMW_RET_INVALID_ARGUMENT:
-      return RCL_RET_INVALID_ARGUMENT;
-    case RMW_RET_BAD_ALLOC:
-      return RCL_RET_BAD_ALLOC;
-    case RMW_RET_UNSUPPORTED:
-      return RCL_RET_UNSUPPORTED;
-    case RMW_RET_NODE_NAME_NON_EXISTENT:
-      return RCL_RET_NODE_NAME_NON_EXISTENT;
-    default:
-      return RCL_RET_ERROR;
+  static const rcl_ret_t rmw_to_rcl_ret[] = {
+    [RMW_RET_INVALID_ARGUMENT] = RCL_RET_INVALID_ARGUMENT,
+    [RMW_RET_BAD_ALLOC] = RCL_RET_BAD_ALLOC,
+    [RMW_RET_UNSUPPORTED] = RCL_RET_UNSUPPORTED,
+    [RMW_RET_NODE_NAME_NON_EXISTENT] = RCL_RET_NODE_NAME_NON_EXISTENT,
+  };
+  if (RCL_LIKELY(RMW_RET_OK == rmw_ret)) {
+    return RCL_RET_OK;
+  }
+  size_t index = (size_t)rmw_ret;
+  if (index < sizeof(rmw_to_rcl_ret) / sizeof(rmw_to_rcl_ret[0]) && 0 != rmw_to_rcl_ret[index]) {
+    return rmw_to_rcl_ret[index];
   }
+  return RCL_RET_ERROR;
 }
 
 rcl_ret_t
 rcl_convert_rcutils_ret_to_rcl_ret(rcutils_ret_t rcutils_ret)
 {
-  switch (rcutils_ret) {
-    case RCUTILS_RET_OK:
-      return RCL_RET_OK;
-    case RCUTILS_RET_ERROR:
-      return RCL_RET_ERROR;
-    case RCUTILS_RET_BAD_ALLOC:
-      return RCL_RET_BAD_ALLOC;
-    case RCUTILS_RET_INVALID_ARGUMENT:
-      return RCL_RET_INVALID_ARGUMENT;
-    case RCUTILS_RET_NOT_INITIALIZED:
-      return RCL_RET_NOT_INIT;
-    default:
-      return RCL_RET_ERROR;
+  static const rcl_ret_t rcutils_to_rcl_ret[] = {
+    [RCUTILS_RET_ERROR] = RCL_RET_ERROR,
+    [RCUTILS_RET_BAD_ALLOC] = RCL_RET_BAD_ALLOC,
+    [RCUTILS_RET_INVALID_ARGUMENT] = RCL_RET_INVALID_ARGUMENT,
+    [RCUTILS_RET_NOT_INITIALIZED] = RCL_RET_NOT_INIT,
+  };
+  if (RCL_LIKELY(RCUTILS_RET_OK == rcutils_ret)) {
+    return RCL_RET_OK;
+  }
+  size_t index = (size_t)rcutils_ret;
+  if (index < sizeof(rcutils_to_rcl_ret) / sizeof(rcutils_to_rcl_ret[0]) &&
+    0 != rcutils_to_rcl_ret[index])
+  {
+    return rcutils_to_rcl_ret[index];
   }
+  return RCL_RET_ERROR;
 }
 
 #ifdef __cplusplus
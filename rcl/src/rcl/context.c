@@ -20,10 +20,223 @@ extern "C"
 #include "rcl/context.h"
 
 #include <stdbool.h>
+#include <string.h>
 
 #include "./common.h"
 #include "./context_impl.h"
+#include "rcutils/logging_macros.h"
 #include "rcutils/stdatomic_helper.h"
+#include "rcutils/time.h"
+#include "rmw/error_handling.h"
+
+/// Number of distinct option configurations the shared rmw context registry
+/// can hold; further configurations fall back to private rmw contexts.
+#define SHARED_RMW_CONTEXT_MAX_ENTRIES 8
+
+/// One refcounted rmw context shared by every context whose rmw init options
+/// match key_options. Initializing and shutting down contexts concurrently is
+/// not thread-safe, with or without sharing.
+typedef struct shared_rmw_context_entry_s
+{
+  rmw_context_t rmw_context;
+  rmw_init_options_t key_options;
+  uint64_t refs;
+} shared_rmw_context_entry_t;
+
+static shared_rmw_context_entry_t g_shared_rmw_contexts[SHARED_RMW_CONTEXT_MAX_ENTRIES];
+
+static bool
+_shared_context_strings_equal(const char * lhs, const char * rhs)
+{
+  if (NULL == lhs || NULL == rhs) {
+    return lhs == rhs;
+  }
+  return 0 == strcmp(lhs, rhs);
+}
+
+// Compares the option fields that decide whether two contexts may share one
+// middleware participant.
+static bool
+_shared_context_options_match(const rmw_init_options_t * lhs, const rmw_init_options_t * rhs)
+{
+  if (lhs->domain_id != rhs->domain_id ||
+    lhs->localhost_only != rhs->localhost_only ||
+    !_shared_context_strings_equal(lhs->enclave, rhs->enclave))
+  {
+    return false;
+  }
+
+  const rmw_security_options_t * lhs_security = &lhs->security_options;
+  const rmw_security_options_t * rhs_security = &rhs->security_options;
+  if (lhs_security->enforce_security != rhs_security->enforce_security ||
+    !_shared_context_strings_equal(
+      lhs_security->security_root_path, rhs_security->security_root_path))
+  {
+    return false;
+  }
+
+  const rmw_discovery_options_t * lhs_discovery = &lhs->discovery_options;
+  const rmw_discovery_options_t * rhs_discovery = &rhs->discovery_options;
+  if (lhs_discovery->automatic_discovery_range != rhs_discovery->automatic_discovery_range ||
+    lhs_discovery->static_peers_count != rhs_discovery->static_peers_count)
+  {
+    return false;
+  }
+  for (size_t i = 0; i < lhs_discovery->static_peers_count; ++i) {
+    if (!_shared_context_strings_equal(
+        lhs_discovery->static_peers[i].peer_address,
+        rhs_discovery->static_peers[i].peer_address))
+    {
+      return false;
+    }
+  }
+
+  return true;
+}
+
+static rcl_ret_t
+_private_rmw_context_create(rcl_context_t * context)
+{
+  rmw_ret_t rmw_ret = rmw_init(
+    &(context->impl->init_options.impl->rmw_init_options),
+    &(context->impl->rmw_context));
+  if (RMW_RET_OK != rmw_ret) {
+    RCL_SET_ERROR_MSG(rmw_get_error_string().str);
+    return rcl_convert_rmw_ret_to_rcl_ret(rmw_ret);
+  }
+  return RCL_RET_OK;
+}
+
+static rcl_ret_t
+_shared_rmw_context_acquire(rcl_context_t * context)
+{
+  rmw_init_options_t * init_options = &context->impl->init_options.impl->rmw_init_options;
+
+  shared_rmw_context_entry_t * free_entry = NULL;
+  for (size_t i = 0; i < SHARED_RMW_CONTEXT_MAX_ENTRIES; ++i) {
+    shared_rmw_context_entry_t * entry = &g_shared_rmw_contexts[i];
+    if (0 == entry->refs) {
+      if (NULL == free_entry) {
+        free_entry = entry;
+      }
+      continue;
+    }
+    if (_shared_context_options_match(&entry->key_options, init_options)) {
+      ++entry->refs;
+      context->impl->rmw_context = entry->rmw_context;
+      context->impl->rmw_context_is_shared = true;
+      return RCL_RET_OK;
+    }
+  }
+
+  if (NULL == free_entry) {
+    RCUTILS_LOG_WARN_NAMED(
+      ROS_PACKAGE_NAME,
+      "shared rmw context registry is full, creating a private rmw context");
+    return _private_rmw_context_create(context);
+  }
+
+  free_entry->rmw_context = rmw_get_zero_initialized_context();
+  rmw_ret_t rmw_ret = rmw_init(init_options, &free_entry->rmw_context);
+  if (RMW_RET_OK != rmw_ret) {
+    RCL_SET_ERROR_MSG(rmw_get_error_string().str);
+    return rcl_convert_rmw_ret_to_rcl_ret(rmw_ret);
+  }
+
+  free_entry->key_options = rmw_get_zero_initialized_init_options();
+  rmw_ret_t copy_ret = rmw_init_options_copy(init_options, &free_entry->key_options);
+  if (RMW_RET_OK != copy_ret) {
+    rmw_error_string_t error_string = rmw_get_error_string();
+    rmw_reset_error();
+    if (RMW_RET_OK != rmw_shutdown(&free_entry->rmw_context)) {
+      rmw_reset_error();
+    }
+    if (RMW_RET_OK != rmw_context_fini(&free_entry->rmw_context)) {
+      rmw_reset_error();
+    }
+    free_entry->rmw_context = rmw_get_zero_initialized_context();
+    RCL_SET_ERROR_MSG(error_string.str);
+    return rcl_convert_rmw_ret_to_rcl_ret(copy_ret);
+  }
+
+  free_entry->refs = 1;
+  context->impl->rmw_context = free_entry->rmw_context;
+  context->impl->rmw_context_is_shared = true;
+  return RCL_RET_OK;
+}
+
+rcl_ret_t
+__create_rmw_context(rcl_context_t * context)
+{
+  // timing is best effort and must never fail the creation itself
+  rcutils_time_point_value_t start = 0;
+  if (RCUTILS_RET_OK != rcutils_steady_time_now(&start)) {
+    rcutils_reset_error();
+  }
+  rcl_ret_t ret;
+  if (context->impl->init_options.impl->share_rmw_context) {
+    ret = _shared_rmw_context_acquire(context);
+  } else {
+    ret = _private_rmw_context_create(context);
+  }
+  if (RCL_RET_OK == ret && 0 != start) {
+    rcutils_time_point_value_t end = 0;
+    if (RCUTILS_RET_OK != rcutils_steady_time_now(&end)) {
+      rcutils_reset_error();
+    } else if (end > start) {
+      context->impl->init_timings.rmw_init_ns = end - start;
+    }
+  }
+  return ret;
+}
+
+void
+__release_shared_rmw_context(rcl_context_t * context)
+{
+  if (!context->impl->rmw_context_is_shared) {
+    return;
+  }
+
+  for (size_t i = 0; i < SHARED_RMW_CONTEXT_MAX_ENTRIES; ++i) {
+    shared_rmw_context_entry_t * entry = &g_shared_rmw_contexts[i];
+    if (0 == entry->refs || entry->rmw_context.impl != context->impl->rmw_context.impl) {
+      continue;
+    }
+    if (0 == --entry->refs) {
+      if (RMW_RET_OK != rmw_shutdown(&entry->rmw_context)) {
+        RCUTILS_SAFE_FWRITE_TO_STDERR(
+          "[rcl|context.c:" RCUTILS_STRINGIFY(__LINE__)
+          "] failed to shut down shared rmw context: ");
+        RCUTILS_SAFE_FWRITE_TO_STDERR(rmw_get_error_string().str);
+        RCUTILS_SAFE_FWRITE_TO_STDERR("\n");
+        rmw_reset_error();
+      }
+      if (RMW_RET_OK != rmw_context_fini(&entry->rmw_context)) {
+        RCUTILS_SAFE_FWRITE_TO_STDERR(
+          "[rcl|context.c:" RCUTILS_STRINGIFY(__LINE__)
+          "] failed to finalize shared rmw context, memory may be leaked: ");
+        RCUTILS_SAFE_FWRITE_TO_STDERR(rmw_get_error_string().str);
+        RCUTILS_SAFE_FWRITE_TO_STDERR("\n");
+        rmw_reset_error();
+      }
+      if (RMW_RET_OK != rmw_init_options_fini(&entry->key_options)) {
+        RCUTILS_SAFE_FWRITE_TO_STDERR(
+          "[rcl|context.c:" RCUTILS_STRINGIFY(__LINE__)
+          "] failed to finalize shared rmw context key options, memory may be leaked: ");
+        RCUTILS_SAFE_FWRITE_TO_STDERR(rmw_get_error_string().str);
+        RCUTILS_SAFE_FWRITE_TO_STDERR("\n");
+        rmw_reset_error();
+      }
+      entry->rmw_context = rmw_get_zero_initialized_context();
+    }
+    break;
+  }
+
+  // the context's copy is only a reference; dropping it must not run the rmw
+  // teardown a second time
+  context->impl->rmw_context = rmw_get_zero_initialized_context();
+  context->impl->rmw_context_is_shared = false;
+}
 
 rcl_context_t
 rcl_get_zero_initialized_context(void)
@@ -105,6 +318,68 @@ rcl_context_get_rmw_context(rcl_context_t * context)
   return &(context->impl->rmw_context);
 }
 
+rcl_ret_t
+rcl_context_ensure_rmw_context(rcl_context_t * context)
+{
+  RCL_CHECK_ARGUMENT_FOR_NULL(context, RCL_RET_INVALID_ARGUMENT);
+  if (!rcl_context_is_valid(context)) {
+    RCL_SET_ERROR_MSG(
+      "the given context is not valid, "
+      "either rcl_init() was not called or rcl_shutdown() was called.");
+    return RCL_RET_NOT_INIT;
+  }
+  if (NULL != context->impl->rmw_context.implementation_identifier) {
+    // already created, either eagerly during init or by an earlier call
+    return RCL_RET_OK;
+  }
+
+  RCUTILS_LOG_DEBUG_NAMED(
+    ROS_PACKAGE_NAME,
+    "Creating deferred rmw context, for context at address: %p", (void *) context);
+  return __create_rmw_context(context);
+}
+
+rcl_intern_pool_t *
+rcl_context_get_intern_pool(rcl_context_t * context)
+{
+  RCL_CHECK_ARGUMENT_FOR_NULL(context, NULL);
+  RCL_CHECK_FOR_NULL_WITH_MSG(context->impl, "context is zero-initialized", return NULL);
+  if (NULL == context->impl->intern_pool.impl) {
+    if (RCL_RET_OK !=
+      rcl_intern_pool_init(&(context->impl->intern_pool), &(context->impl->allocator)))
+    {
+      return NULL;  // error already set
+    }
+  }
+  return &(context->impl->intern_pool);
+}
+
+rcl_type_registry_t *
+rcl_context_get_type_registry(rcl_context_t * context)
+{
+  RCL_CHECK_ARGUMENT_FOR_NULL(context, NULL);
+  RCL_CHECK_FOR_NULL_WITH_MSG(context->impl, "context is zero-initialized", return NULL);
+  if (NULL == context->impl->type_registry.impl) {
+    if (RCL_RET_OK !=
+      rcl_type_registry_init(&(context->impl->type_registry), &(context->impl->allocator)))
+    {
+      return NULL;  // error already set
+    }
+  }
+  return &(context->impl->type_registry);
+}
+
+rcl_ret_t
+rcl_context_get_init_timings(const rcl_context_t * context, rcl_init_timings_t * timings)
+{
+  RCL_CHECK_ARGUMENT_FOR_NULL(context, RCL_RET_INVALID_ARGUMENT);
+  RCL_CHECK_ARGUMENT_FOR_NULL(timings, RCL_RET_INVALID_ARGUMENT);
+  RCL_CHECK_FOR_NULL_WITH_MSG(
+    context->impl, "context is zero-initialized", return RCL_RET_INVALID_ARGUMENT);
+  *timings = context->impl->init_timings;
+  return RCL_RET_OK;
+}
+
 rcl_ret_t
 __cleanup_context(rcl_context_t * context)
 {
@@ -146,6 +421,48 @@ __cleanup_context(rcl_context_t * context)
       }
     }
 
+    // clean up the interning pool if it was ever used
+    if (NULL != context->impl->intern_pool.impl) {
+      rcl_ret_t intern_pool_fini_ret = rcl_intern_pool_fini(&(context->impl->intern_pool));
+      if (RCL_RET_OK != intern_pool_fini_ret) {
+        if (RCL_RET_OK == ret) {
+          ret = intern_pool_fini_ret;
+        }
+        RCUTILS_SAFE_FWRITE_TO_STDERR(
+          "[rcl|context.c:" RCUTILS_STRINGIFY(__LINE__)
+          "] failed to finalize interning pool while cleaning up context, memory may be leaked: ");
+        RCUTILS_SAFE_FWRITE_TO_STDERR(rcl_get_error_string().str);
+        RCUTILS_SAFE_FWRITE_TO_STDERR("\n");
+        rcl_reset_error();
+      }
+    }
+
+    // clean up the type registry if it was ever used
+    if (NULL != context->impl->type_registry.impl) {
+      rcl_ret_t type_registry_fini_ret = rcl_type_registry_fini(&(context->impl->type_registry));
+      if (RCL_RET_OK != type_registry_fini_ret) {
+        if (RCL_RET_OK == ret) {
+          ret = type_registry_fini_ret;
+        }
+        RCUTILS_SAFE_FWRITE_TO_STDERR(
+          "[rcl|context.c:" RCUTILS_STRINGIFY(__LINE__)
+          "] failed to finalize type registry while cleaning up context, memory may be leaked: ");
+        RCUTILS_SAFE_FWRITE_TO_STDERR(rcl_get_error_string().str);
+        RCUTILS_SAFE_FWRITE_TO_STDERR("\n");
+        rcl_reset_error();
+      }
+    }
+
+    // clean up the intra-process channel registry if it was ever used
+    if (NULL != context->impl->intra_process_registry) {
+      rcl_intra_process_registry_fini(context->impl->intra_process_registry);
+      context->impl->intra_process_registry = NULL;
+    }
+
+    // drop the reference on a shared rmw context, which zeroes the copy so
+    // the private teardown below is skipped
+    __release_shared_rmw_context(context);
+
     // clean up rmw_context
     if (NULL != context->impl->rmw_context.implementation_identifier) {
       rmw_ret_t rmw_context_fini_ret = rmw_context_fini(&(context->impl->rmw_context));
@@ -17,8 +17,11 @@
 
 #include "rcl/context.h"
 #include "rcl/error_handling.h"
+#include "rcl/intern_pool.h"
+#include "rcl/type_registry.h"
 
 #include "./init_options_impl.h"
+#include "./intra_process_impl.h"
 
 #ifdef __cplusplus
 extern "C"
@@ -38,12 +41,41 @@ struct rcl_context_impl_s
   char ** argv;
   /// rmw context.
   rmw_context_t rmw_context;
+  /// True when rmw_context is a copy of a refcounted rmw context owned by the
+  /// process-wide shared context registry, see __create_rmw_context().
+  bool rmw_context_is_shared;
+  /// String interning pool shared by graph queries, lazily initialized by
+  /// rcl_context_get_intern_pool().
+  rcl_intern_pool_t intern_pool;
+  /// Cache of data derived from message type supports, lazily initialized by
+  /// rcl_context_get_type_registry().
+  rcl_type_registry_t type_registry;
+  /// Phase durations recorded during rcl_init(), see
+  /// rcl_context_get_init_timings().
+  rcl_init_timings_t init_timings;
+  /// Topic-keyed intra-process channel registry, NULL until the first
+  /// entity enables intra-process; see intra_process.c.
+  rcl_intra_process_registry_impl_t * intra_process_registry;
 };
 
 RCL_LOCAL
 rcl_ret_t
 __cleanup_context(rcl_context_t * context);
 
+/// \internal Create the rmw context for the given context, either privately
+/// with rmw_init() or by joining a matching shared rmw context when the
+/// share_rmw_context init option is set.
+RCL_LOCAL
+rcl_ret_t
+__create_rmw_context(rcl_context_t * context);
+
+/// \internal Drop the context's reference on a shared rmw context, shutting
+/// the shared rmw context down when this was the last reference. No-op for
+/// contexts with a private rmw context.
+RCL_LOCAL
+void
+__release_shared_rmw_context(rcl_context_t * context);
+
 #ifdef __cplusplus
 }
 #endif
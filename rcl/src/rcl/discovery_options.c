@@ -22,8 +22,10 @@
 #include "rcutils/logging_macros.h"
 #include "rcutils/snprintf.h"
 #include "rcutils/split.h"
+#include "rcutils/strdup.h"
 #include "rcutils/types/string_array.h"
 
+#include "rcl/env_snapshot.h"
 #include "rcl/error_handling.h"
 #include "rcl/types.h"
 
@@ -39,25 +41,83 @@ static const char * const RCL_AUTOMATIC_DISCOVERY_RANGE_ENV_VAR = "ROS_AUTOMATIC
 #define _GET_DEFAULT_DISCOVERY_RANGE(x) \
   RMW_AUTOMATIC_DISCOVERY_RANGE_ ## x
 
+// Process-wide cache of the parsed discovery environment variables, so that
+// processes creating many contexts parse each value once and clone the result,
+// instead of re-splitting the peer list per context.
+// Both caches are keyed on the raw environment variable value, which comes
+// from the process-wide environment snapshot; changes to the environment take
+// effect after rcl_env_snapshot_refresh().
+// Like context init itself, this is not thread-safe.
+
+// Raw value of ROS_AUTOMATIC_DISCOVERY_RANGE the cached range was parsed
+// from; NULL when nothing is cached yet.
+static char * __cached_range_env_val = NULL;
+static rmw_automatic_discovery_range_t __cached_range;
+
+// Raw value of ROS_STATIC_PEERS the cached peer template was parsed from;
+// NULL when nothing is cached yet.
+static char * __cached_peers_env_val = NULL;
+static rmw_discovery_options_t __cached_peers_template;
+
+// Remember the parsed peer list; on any allocation failure the cache is left
+// empty and the next call just parses again.
+static void
+__cache_static_peers(const char * env_val, const rmw_discovery_options_t * parsed)
+{
+  rcutils_allocator_t allocator = rcutils_get_default_allocator();
+  if (NULL != __cached_peers_env_val) {
+    allocator.deallocate(__cached_peers_env_val, allocator.state);
+    __cached_peers_env_val = NULL;
+    if (RMW_RET_OK != rmw_discovery_options_fini(&__cached_peers_template)) {
+      rmw_reset_error();
+      return;
+    }
+  }
+  rmw_discovery_options_t template_options = rmw_get_zero_initialized_discovery_options();
+  if (RMW_RET_OK !=
+    rmw_discovery_options_init(&template_options, parsed->static_peers_count, &allocator))
+  {
+    rmw_reset_error();
+    return;
+  }
+  if (parsed->static_peers_count > 0) {
+    memcpy(
+      template_options.static_peers, parsed->static_peers,
+      parsed->static_peers_count * sizeof(*parsed->static_peers));
+  }
+  char * env_val_copy = rcutils_strdup(env_val, allocator);
+  if (NULL == env_val_copy) {
+    if (RMW_RET_OK != rmw_discovery_options_fini(&template_options)) {
+      rmw_reset_error();
+    }
+    return;
+  }
+  __cached_peers_template = template_options;
+  __cached_peers_env_val = env_val_copy;
+}
+
 rcl_ret_t
 rcl_get_automatic_discovery_range(rmw_discovery_options_t * discovery_options)
 {
   const char * ros_automatic_discovery_range_env_val = NULL;
-  const char * get_env_error_str = NULL;
 
   RCUTILS_CAN_SET_MSG_AND_RETURN_WITH_ERROR_OF(RCL_RET_INVALID_ARGUMENT);
   RCUTILS_CAN_SET_MSG_AND_RETURN_WITH_ERROR_OF(RCL_RET_ERROR);
   RCL_CHECK_ARGUMENT_FOR_NULL(discovery_options, RCL_RET_INVALID_ARGUMENT);
 
-  get_env_error_str = rcutils_get_env(
+  rcl_ret_t snapshot_ret = rcl_env_snapshot_get_value(
     RCL_AUTOMATIC_DISCOVERY_RANGE_ENV_VAR,
     &ros_automatic_discovery_range_env_val);
-  if (NULL != get_env_error_str) {
-    RCL_SET_ERROR_MSG_WITH_FORMAT_STRING(
-      "Error getting env var '%s': %s", RCL_AUTOMATIC_DISCOVERY_RANGE_ENV_VAR,
-      get_env_error_str);
-    return RCL_RET_ERROR;
+  if (RCL_RET_OK != snapshot_ret) {
+    return snapshot_ret;
+  }
+  if (NULL != __cached_range_env_val &&
+    strcmp(ros_automatic_discovery_range_env_val, __cached_range_env_val) == 0)
+  {
+    discovery_options->automatic_discovery_range = __cached_range;
+    return RCL_RET_OK;
   }
+
   if (strcmp(ros_automatic_discovery_range_env_val, "") == 0) {
 #ifdef RCL_DEFAULT_DISCOVERY_RANGE
     discovery_options->automatic_discovery_range =
@@ -83,6 +143,16 @@ rcl_get_automatic_discovery_range(rmw_discovery_options_t * discovery_options)
     discovery_options->automatic_discovery_range = RMW_AUTOMATIC_DISCOVERY_RANGE_LOCALHOST;
   }
 
+  // latch the parsed range for this environment variable value; on failure to
+  // copy the key the next call just parses again
+  rcutils_allocator_t range_cache_allocator = rcutils_get_default_allocator();
+  range_cache_allocator.deallocate(__cached_range_env_val, range_cache_allocator.state);
+  __cached_range_env_val =
+    rcutils_strdup(ros_automatic_discovery_range_env_val, range_cache_allocator);
+  if (NULL != __cached_range_env_val) {
+    __cached_range = discovery_options->automatic_discovery_range;
+  }
+
   return RCL_RET_OK;
 }
 
@@ -112,19 +182,16 @@ rcl_get_discovery_static_peers(
   rcutils_allocator_t * allocator)
 {
   const char * ros_peers_env_val = NULL;
-  const char * get_env_error_str = NULL;
 
   RCUTILS_CAN_SET_MSG_AND_RETURN_WITH_ERROR_OF(RCL_RET_INVALID_ARGUMENT);
   RCUTILS_CAN_SET_MSG_AND_RETURN_WITH_ERROR_OF(RCL_RET_ERROR);
   RCL_CHECK_ARGUMENT_FOR_NULL(discovery_options, RCL_RET_INVALID_ARGUMENT);
   RCL_CHECK_ARGUMENT_FOR_NULL(allocator, RCL_RET_INVALID_ARGUMENT);
 
-  get_env_error_str = rcutils_get_env(RCL_STATIC_PEERS_ENV_VAR, &ros_peers_env_val);
-  if (NULL != get_env_error_str) {
-    RCL_SET_ERROR_MSG_WITH_FORMAT_STRING(
-      "Error getting environment variable '%s': %s",
-      RCL_STATIC_PEERS_ENV_VAR, get_env_error_str);
-    return RCL_RET_ERROR;
+  rcl_ret_t snapshot_ret =
+    rcl_env_snapshot_get_value(RCL_STATIC_PEERS_ENV_VAR, &ros_peers_env_val);
+  if (RCL_RET_OK != snapshot_ret) {
+    return snapshot_ret;
   }
 
   // The value of the env var should be at least "", even when not set.
@@ -135,6 +202,24 @@ rcl_get_discovery_static_peers(
     return RCL_RET_ERROR;
   }
 
+  // reuse the previously parsed peer list when the environment variable has
+  // not changed, cloning it instead of re-splitting the value
+  if (NULL != __cached_peers_env_val && strcmp(ros_peers_env_val, __cached_peers_env_val) == 0) {
+    rmw_ret_t rmw_ret = rmw_discovery_options_init(
+      discovery_options, __cached_peers_template.static_peers_count, allocator);
+    if (RMW_RET_OK != rmw_ret) {
+      RCL_SET_ERROR_MSG(rmw_get_error_string().str);
+      return rcl_convert_rmw_ret_to_rcl_ret(rmw_ret);
+    }
+    if (__cached_peers_template.static_peers_count > 0) {
+      memcpy(
+        discovery_options->static_peers, __cached_peers_template.static_peers,
+        __cached_peers_template.static_peers_count *
+        sizeof(*__cached_peers_template.static_peers));
+    }
+    return RCL_RET_OK;
+  }
+
   rcutils_string_array_t array = rcutils_get_zero_initialized_string_array();
   rcutils_ret_t split_ret = rcutils_split(ros_peers_env_val, ';', *allocator, &array);
   if (RCUTILS_RET_OK != split_ret) {
@@ -178,5 +263,7 @@ rcl_get_discovery_static_peers(
     return RCL_RET_ERROR;
   }
 
+  __cache_static_peers(ros_peers_env_val, discovery_options);
+
   return RCL_RET_OK;
 }
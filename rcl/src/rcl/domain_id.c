@@ -19,6 +19,7 @@
 
 #include "rcutils/env.h"
 
+#include "rcl/env_snapshot.h"
 #include "rcl/error_handling.h"
 #include "rcl/types.h"
 
@@ -31,16 +32,14 @@ rcl_get_default_domain_id(size_t * domain_id)
   RCUTILS_CAN_SET_MSG_AND_RETURN_WITH_ERROR_OF(RCL_RET_ERROR);
 
   const char * ros_domain_id = NULL;
-  const char * get_env_error_str = NULL;
 
   RCL_CHECK_ARGUMENT_FOR_NULL(domain_id, RCL_RET_INVALID_ARGUMENT);
 
-  get_env_error_str = rcutils_get_env(RCL_DOMAIN_ID_ENV_VAR, &ros_domain_id);
-  if (NULL != get_env_error_str) {
-    RCL_SET_ERROR_MSG_WITH_FORMAT_STRING(
-      "Error getting env var '" RCUTILS_STRINGIFY(RCL_DOMAIN_ID_ENV_VAR) "': %s\n",
-      get_env_error_str);
-    return RCL_RET_ERROR;
+  // Read from the process-wide snapshot instead of the environment, so that
+  // concurrent context creation does not serialize on the libc env lock.
+  rcl_ret_t ret = rcl_env_snapshot_get_value(RCL_DOMAIN_ID_ENV_VAR, &ros_domain_id);
+  if (RCL_RET_OK != ret) {
+    return ret;
   }
   if (ros_domain_id && strcmp(ros_domain_id, "") != 0) {
     char * end = NULL;
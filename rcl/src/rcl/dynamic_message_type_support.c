@@ -17,7 +17,10 @@ extern "C"
 {
 #endif
 
+#include <string.h>
+
 #include <rcutils/logging_macros.h>
+#include <rcutils/strdup.h>
 #include <rosidl_runtime_c/message_type_support_struct.h>
 #include <rosidl_runtime_c/type_description/type_description__struct.h>
 
@@ -30,6 +33,57 @@ extern "C"
 #include "rcl/type_hash.h"
 #include "rcl/types.h"
 
+/// One shared dynamic type support handle, keyed by type hash and serialization library.
+/**
+ * Constructing dynamic type support is expensive: it loads the serialization
+ * support library and rebuilds the dynamic type description from scratch.
+ * Entries are reference counted so that many subscriptions to the same type
+ * share a single constructed handle, and the handle is only finalized when the
+ * last user releases it.
+ *
+ * The cache is process wide because the handle itself has no context
+ * affiliation.  Like the public init/fini pair below, it is not synchronized.
+ */
+typedef struct rcl_dynamic_ts_cache_entry_s
+{
+  struct rcl_dynamic_ts_cache_entry_s * next;
+  rosidl_type_hash_t type_hash;
+  /// Owned copy, NULL when the rmw default serialization library was requested.
+  char * serialization_lib_name;
+  rosidl_message_type_support_t type_support;
+  rcl_allocator_t allocator;
+  size_t reference_count;
+} rcl_dynamic_ts_cache_entry_t;
+
+static rcl_dynamic_ts_cache_entry_t * g_dynamic_ts_cache = NULL;
+
+static bool
+__dynamic_ts_cache_names_equal(const char * lhs, const char * rhs)
+{
+  if (NULL == lhs || NULL == rhs) {
+    return lhs == rhs;
+  }
+  return 0 == strcmp(lhs, rhs);
+}
+
+static rcl_dynamic_ts_cache_entry_t *
+__dynamic_ts_cache_find(
+  const rosidl_type_hash_t * type_hash,
+  const char * serialization_lib_name)
+{
+  rcl_dynamic_ts_cache_entry_t * entry = g_dynamic_ts_cache;
+  while (NULL != entry) {
+    if (
+      entry->type_hash.version == type_hash->version &&
+      0 == memcmp(entry->type_hash.value, type_hash->value, sizeof(type_hash->value)) &&
+      __dynamic_ts_cache_names_equal(entry->serialization_lib_name, serialization_lib_name))
+    {
+      return entry;
+    }
+    entry = entry->next;
+  }
+  return NULL;
+}
 
 /// Initialize a rosidl_message_type_support_t from a TypeDescription message
 RCL_PUBLIC
@@ -122,6 +176,92 @@ rcl_dynamic_message_type_support_handle_fini(rosidl_message_type_support_t * ts)
   return rcl_convert_rcutils_ret_to_rcl_ret(rosidl_dynamic_message_type_support_handle_fini(ts));
 }
 
+RCL_PUBLIC
+RCL_WARN_UNUSED
+rcl_ret_t
+rcl_dynamic_message_type_support_handle_acquire(
+  const char * serialization_lib_name,
+  const rosidl_runtime_c__type_description__TypeDescription * description,
+  rcl_allocator_t * allocator,
+  const rosidl_message_type_support_t ** ts)
+{
+  RCL_CHECK_ARGUMENT_FOR_NULL(description, RCL_RET_INVALID_ARGUMENT);
+  RCL_CHECK_ARGUMENT_FOR_NULL(allocator, RCL_RET_INVALID_ARGUMENT);
+  RCL_CHECK_ALLOCATOR_WITH_MSG(allocator, "allocator is invalid", return RCL_RET_INVALID_ARGUMENT);
+  RCL_CHECK_ARGUMENT_FOR_NULL(ts, RCL_RET_INVALID_ARGUMENT);
+
+  rosidl_type_hash_t type_hash;
+  rcl_ret_t ret = rcl_calculate_type_hash(
+    // TODO(methylDragon): Replace this cast with the conversion function when it is ready
+    (const type_description_interfaces__msg__TypeDescription *) description, &type_hash);
+  if (ret != RCL_RET_OK) {
+    RCL_SET_ERROR_MSG("failed to get type hash");
+    return ret;
+  }
+
+  rcl_dynamic_ts_cache_entry_t * entry =
+    __dynamic_ts_cache_find(&type_hash, serialization_lib_name);
+  if (NULL != entry) {
+    ++entry->reference_count;
+    *ts = &entry->type_support;
+    return RCL_RET_OK;
+  }
+
+  entry = allocator->zero_allocate(1, sizeof(rcl_dynamic_ts_cache_entry_t), allocator->state);
+  RCL_CHECK_FOR_NULL_WITH_MSG(
+    entry, "failed to allocate dynamic type support cache entry", return RCL_RET_BAD_ALLOC);
+  entry->type_hash = type_hash;
+  entry->allocator = *allocator;
+  entry->reference_count = 1u;
+  if (NULL != serialization_lib_name) {
+    entry->serialization_lib_name = rcutils_strdup(serialization_lib_name, *allocator);
+    if (NULL == entry->serialization_lib_name) {
+      allocator->deallocate(entry, allocator->state);
+      RCL_SET_ERROR_MSG("failed to copy serialization library name");
+      return RCL_RET_BAD_ALLOC;
+    }
+  }
+
+  ret = rcl_dynamic_message_type_support_handle_init(
+    serialization_lib_name, description, allocator, &entry->type_support);
+  if (ret != RCL_RET_OK) {
+    allocator->deallocate(entry->serialization_lib_name, allocator->state);
+    allocator->deallocate(entry, allocator->state);
+    return ret;
+  }
+
+  entry->next = g_dynamic_ts_cache;
+  g_dynamic_ts_cache = entry;
+  *ts = &entry->type_support;
+  return RCL_RET_OK;
+}
+
+RCL_PUBLIC
+RCL_WARN_UNUSED
+rcl_ret_t
+rcl_dynamic_message_type_support_handle_release(const rosidl_message_type_support_t * ts)
+{
+  RCL_CHECK_ARGUMENT_FOR_NULL(ts, RCL_RET_INVALID_ARGUMENT);
+  rcl_dynamic_ts_cache_entry_t ** link = &g_dynamic_ts_cache;
+  while (NULL != *link) {
+    rcl_dynamic_ts_cache_entry_t * entry = *link;
+    if (&entry->type_support == ts) {
+      if (--entry->reference_count > 0u) {
+        return RCL_RET_OK;
+      }
+      *link = entry->next;
+      rcl_allocator_t allocator = entry->allocator;
+      rcl_ret_t ret = rcl_dynamic_message_type_support_handle_fini(&entry->type_support);
+      allocator.deallocate(entry->serialization_lib_name, allocator.state);
+      allocator.deallocate(entry, allocator.state);
+      return ret;
+    }
+    link = &entry->next;
+  }
+  RCL_SET_ERROR_MSG("type support was not acquired from the dynamic type support cache");
+  return RCL_RET_INVALID_ARGUMENT;
+}
+
 #ifdef __cplusplus
 }
 #endif
@@ -0,0 +1,132 @@
+// Copyright 2026 Open Source Robotics Foundation, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+#include "rcl/entity_cost.h"
+
+#include "rcl/error_handling.h"
+
+#include "./entity_cost_impl.h"
+
+rcl_ret_t
+rcl_subscription_enable_cost_accounting(rcl_subscription_t * subscription)
+{
+  rcl_entity_cost_record_t * record;
+  rcl_ret_t ret = rcl_subscription_get_cost_record(subscription, &record);
+  if (RCL_RET_OK != ret) {
+    return ret;  // error already set
+  }
+  COST_ATOMIC_STORE_RELAXED(&record->enabled, true);
+  return RCL_RET_OK;
+}
+
+rcl_ret_t
+rcl_subscription_disable_cost_accounting(rcl_subscription_t * subscription)
+{
+  rcl_entity_cost_record_t * record;
+  rcl_ret_t ret = rcl_subscription_get_cost_record(subscription, &record);
+  if (RCL_RET_OK != ret) {
+    return ret;  // error already set
+  }
+  COST_ATOMIC_STORE_RELAXED(&record->enabled, false);
+  return RCL_RET_OK;
+}
+
+rcl_ret_t
+rcl_timer_enable_cost_accounting(rcl_timer_t * timer)
+{
+  rcl_entity_cost_record_t * record;
+  rcl_ret_t ret = rcl_timer_get_cost_record(timer, &record);
+  if (RCL_RET_OK != ret) {
+    return ret;  // error already set
+  }
+  COST_ATOMIC_STORE_RELAXED(&record->enabled, true);
+  return RCL_RET_OK;
+}
+
+rcl_ret_t
+rcl_timer_disable_cost_accounting(rcl_timer_t * timer)
+{
+  rcl_entity_cost_record_t * record;
+  rcl_ret_t ret = rcl_timer_get_cost_record(timer, &record);
+  if (RCL_RET_OK != ret) {
+    return ret;  // error already set
+  }
+  COST_ATOMIC_STORE_RELAXED(&record->enabled, false);
+  return RCL_RET_OK;
+}
+
+rcl_ret_t
+rcl_service_enable_cost_accounting(rcl_service_t * service)
+{
+  rcl_entity_cost_record_t * record;
+  rcl_ret_t ret = rcl_service_get_cost_record(service, &record);
+  if (RCL_RET_OK != ret) {
+    return ret;  // error already set
+  }
+  COST_ATOMIC_STORE_RELAXED(&record->enabled, true);
+  return RCL_RET_OK;
+}
+
+rcl_ret_t
+rcl_service_disable_cost_accounting(rcl_service_t * service)
+{
+  rcl_entity_cost_record_t * record;
+  rcl_ret_t ret = rcl_service_get_cost_record(service, &record);
+  if (RCL_RET_OK != ret) {
+    return ret;  // error already set
+  }
+  COST_ATOMIC_STORE_RELAXED(&record->enabled, false);
+  return RCL_RET_OK;
+}
+
+rcl_ret_t
+rcl_entity_get_cost_estimate(
+  rcl_entity_type_t entity_type,
+  const void * entity,
+  rcl_entity_cost_estimate_t * cost_estimate)
+{
+  RCL_CHECK_ARGUMENT_FOR_NULL(entity, RCL_RET_INVALID_ARGUMENT);
+  RCL_CHECK_ARGUMENT_FOR_NULL(cost_estimate, RCL_RET_INVALID_ARGUMENT);
+  rcl_entity_cost_record_t * record;
+  rcl_ret_t ret;
+  switch (entity_type) {
+    case RCL_ENTITY_TYPE_SUBSCRIPTION:
+      ret = rcl_subscription_get_cost_record(
+        (const rcl_subscription_t *)entity, &record);
+      break;
+    case RCL_ENTITY_TYPE_TIMER:
+      ret = rcl_timer_get_cost_record((const rcl_timer_t *)entity, &record);
+      break;
+    case RCL_ENTITY_TYPE_SERVICE:
+      ret = rcl_service_get_cost_record((const rcl_service_t *)entity, &record);
+      break;
+    default:
+      RCL_SET_ERROR_MSG("unknown entity type");
+      return RCL_RET_INVALID_ARGUMENT;
+  }
+  if (RCL_RET_OK != ret) {
+    return ret;  // error already set
+  }
+  rcl_entity_cost_record_snapshot(record, cost_estimate);
+  return RCL_RET_OK;
+}
+
+#ifdef __cplusplus
+}
+#endif
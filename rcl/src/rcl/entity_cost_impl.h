@@ -0,0 +1,164 @@
+// Copyright 2026 Open Source Robotics Foundation, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef RCL__ENTITY_COST_IMPL_H_
+#define RCL__ENTITY_COST_IMPL_H_
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#include "rcutils/stdatomic_helper.h"
+#include "rcutils/time.h"
+
+#include "rcl/entity_cost.h"
+#include "rcl/service.h"
+#include "rcl/subscription.h"
+#include "rcl/timer.h"
+
+/* The cost counters carry no inter-thread handoff — a reader only ever wants
+ * a recent value, never a synchronized one — so explicit relaxed orderings
+ * are used whenever C11 atomics are available, keeping the accounting off
+ * the barrier budget of the take/call hot paths. The sequentially
+ * consistent rcutils helpers are the portable fallback. */
+#if !defined(__STDC_NO_ATOMICS__) && !defined(_MSC_VER)
+#define COST_ATOMIC_LOAD_BOOL_RELAXED(object) \
+  atomic_load_explicit(object, memory_order_relaxed)
+#define COST_ATOMIC_LOAD_INT64_RELAXED(object) \
+  atomic_load_explicit(object, memory_order_relaxed)
+#define COST_ATOMIC_LOAD_UINT64_RELAXED(object) \
+  atomic_load_explicit(object, memory_order_relaxed)
+#define COST_ATOMIC_STORE_RELAXED(object, value) \
+  atomic_store_explicit(object, value, memory_order_relaxed)
+#define COST_ATOMIC_FETCH_ADD_INT64_RELAXED(object, value) \
+  atomic_fetch_add_explicit(object, value, memory_order_relaxed)
+#define COST_ATOMIC_FETCH_ADD_UINT64_RELAXED(object, value) \
+  atomic_fetch_add_explicit(object, value, memory_order_relaxed)
+#else
+#define COST_ATOMIC_LOAD_BOOL_RELAXED(object) rcutils_atomic_load_bool(object)
+#define COST_ATOMIC_LOAD_INT64_RELAXED(object) rcutils_atomic_load_int64_t(object)
+#define COST_ATOMIC_LOAD_UINT64_RELAXED(object) rcutils_atomic_load_uint64_t(object)
+#define COST_ATOMIC_STORE_RELAXED(object, value) rcutils_atomic_store(object, value)
+#define COST_ATOMIC_FETCH_ADD_INT64_RELAXED(object, value) \
+  rcutils_atomic_fetch_add_int64_t(object, value)
+#define COST_ATOMIC_FETCH_ADD_UINT64_RELAXED(object, value) \
+  rcutils_atomic_fetch_add_uint64_t(object, value)
+#endif
+
+/// Per-entity cost accounting counters, embedded in each entity impl.
+/**
+ * Zero initialization is a valid disabled state, so the record needs no
+ * explicit init or fini of its own.
+ */
+typedef struct rcl_entity_cost_record_s
+{
+  /// True while accounting is enabled for the owning entity.
+  atomic_bool enabled;
+  /// Number of servicing operations recorded.
+  atomic_uint_least64_t sample_count;
+  /// Duration of the most recently recorded operation, in nanoseconds.
+  atomic_int_least64_t last_cost_ns;
+  /// Exponentially weighted moving average of the duration, in nanoseconds.
+  atomic_int_least64_t ewma_cost_ns;
+  /// Sum of all recorded durations, in nanoseconds.
+  atomic_int_least64_t total_cost_ns;
+} rcl_entity_cost_record_t;
+
+/// EWMA weight denominator: new = old + (sample - old) / 8.
+#define RCL_ENTITY_COST_EWMA_DIVISOR 8
+
+/// Start timing a servicing operation.
+/**
+ * Returns true and fills `start` only while accounting is enabled and the
+ * steady clock could be sampled; when it returns false the operation is
+ * not recorded and the caller must skip the matching commit. The disabled
+ * case costs one relaxed load.
+ */
+static inline bool
+rcl_entity_cost_record_begin(
+  rcl_entity_cost_record_t * record,
+  rcutils_time_point_value_t * start)
+{
+#ifdef RCL_PROFILE_STATIC
+  // fixed-function builds compile the accounting out; the constant false
+  // lets the compiler strip the matching commit paths entirely
+  (void)record;
+  (void)start;
+  return false;
+#else
+  if (!COST_ATOMIC_LOAD_BOOL_RELAXED(&record->enabled)) {
+    return false;
+  }
+  return RCUTILS_RET_OK == rcutils_steady_time_now(start);
+#endif
+}
+
+/// Record the duration since `start` into the counters.
+static inline void
+rcl_entity_cost_record_commit(
+  rcl_entity_cost_record_t * record,
+  rcutils_time_point_value_t start)
+{
+  rcutils_time_point_value_t end;
+  if (RCUTILS_RET_OK != rcutils_steady_time_now(&end)) {
+    return;
+  }
+  const int64_t cost = end - start;
+  const uint64_t samples =
+    COST_ATOMIC_FETCH_ADD_UINT64_RELAXED(&record->sample_count, 1) + 1;
+  COST_ATOMIC_STORE_RELAXED(&record->last_cost_ns, cost);
+  COST_ATOMIC_FETCH_ADD_INT64_RELAXED(&record->total_cost_ns, cost);
+  // The EWMA update is a read-modify-write without a compare exchange;
+  // concurrent recorders may lose an update, which is acceptable for an
+  // estimate and keeps the commit wait-free.
+  int64_t ewma = COST_ATOMIC_LOAD_INT64_RELAXED(&record->ewma_cost_ns);
+  if (1u == samples) {
+    ewma = cost;
+  } else {
+    ewma += (cost - ewma) / RCL_ENTITY_COST_EWMA_DIVISOR;
+  }
+  COST_ATOMIC_STORE_RELAXED(&record->ewma_cost_ns, ewma);
+}
+
+/// Copy the counters into a caller-visible snapshot.
+static inline void
+rcl_entity_cost_record_snapshot(
+  rcl_entity_cost_record_t * record,
+  rcl_entity_cost_estimate_t * cost_estimate)
+{
+  cost_estimate->sample_count = COST_ATOMIC_LOAD_UINT64_RELAXED(&record->sample_count);
+  cost_estimate->last_cost_ns = COST_ATOMIC_LOAD_INT64_RELAXED(&record->last_cost_ns);
+  cost_estimate->ewma_cost_ns = COST_ATOMIC_LOAD_INT64_RELAXED(&record->ewma_cost_ns);
+  cost_estimate->total_cost_ns = COST_ATOMIC_LOAD_INT64_RELAXED(&record->total_cost_ns);
+}
+
+// Validate the handle and expose its embedded cost record; each accessor
+// lives in the translation unit that owns the impl struct. On failure the
+// entity's usual invalid-handle return is produced with the error state set.
+
+rcl_ret_t
+rcl_subscription_get_cost_record(
+  const rcl_subscription_t * subscription,
+  rcl_entity_cost_record_t ** record);
+
+rcl_ret_t
+rcl_timer_get_cost_record(
+  const rcl_timer_t * timer,
+  rcl_entity_cost_record_t ** record);
+
+rcl_ret_t
+rcl_service_get_cost_record(
+  const rcl_service_t * service,
+  rcl_entity_cost_record_t ** record);
+
+#endif  // RCL__ENTITY_COST_IMPL_H_
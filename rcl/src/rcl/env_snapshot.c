@@ -0,0 +1,114 @@
+// Copyright 2022 Open Source Robotics Foundation, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "rcl/env_snapshot.h"
+
+#include <string.h>
+
+#include "rcutils/allocator.h"
+#include "rcutils/env.h"
+#include "rcutils/strdup.h"
+
+#include "rcl/error_handling.h"
+#include "rcl/types.h"
+
+// The environment variables consulted during context and init options setup.
+// The names must match the constants exported by the modules reading them.
+static const char * const __env_snapshot_names[] = {
+  "ROS_DOMAIN_ID",
+  "ROS_LOCALHOST_ONLY",
+  "ROS_AUTOMATIC_DISCOVERY_RANGE",
+  "ROS_STATIC_PEERS",
+};
+
+#define RCL_ENV_SNAPSHOT_VAR_COUNT \
+  (sizeof(__env_snapshot_names) / sizeof(__env_snapshot_names[0]))
+
+// Captured values, parallel to __env_snapshot_names; an unset variable is
+// captured as an empty string so readers never see NULL.
+static char * __env_snapshot_values[RCL_ENV_SNAPSHOT_VAR_COUNT] = {NULL};
+static bool __env_snapshot_captured = false;
+
+rcl_ret_t
+rcl_env_snapshot_refresh(void)
+{
+  RCUTILS_CAN_SET_MSG_AND_RETURN_WITH_ERROR_OF(RCL_RET_BAD_ALLOC);
+  RCUTILS_CAN_SET_MSG_AND_RETURN_WITH_ERROR_OF(RCL_RET_ERROR);
+
+  rcutils_allocator_t allocator = rcutils_get_default_allocator();
+  char * new_values[RCL_ENV_SNAPSHOT_VAR_COUNT] = {NULL};
+  rcl_ret_t ret = RCL_RET_OK;
+
+  for (size_t i = 0u; i < RCL_ENV_SNAPSHOT_VAR_COUNT; ++i) {
+    const char * env_value = NULL;
+    const char * get_env_error_str = rcutils_get_env(__env_snapshot_names[i], &env_value);
+    if (NULL != get_env_error_str) {
+      RCL_SET_ERROR_MSG_WITH_FORMAT_STRING(
+        "Error getting env var '%s': %s", __env_snapshot_names[i], get_env_error_str);
+      ret = RCL_RET_ERROR;
+      goto fail;
+    }
+    new_values[i] = rcutils_strdup((NULL != env_value) ? env_value : "", allocator);
+    if (NULL == new_values[i]) {
+      RCL_SET_ERROR_MSG("failed to copy environment variable value");
+      ret = RCL_RET_BAD_ALLOC;
+      goto fail;
+    }
+  }
+
+  for (size_t i = 0u; i < RCL_ENV_SNAPSHOT_VAR_COUNT; ++i) {
+    if (NULL != __env_snapshot_values[i]) {
+      allocator.deallocate(__env_snapshot_values[i], allocator.state);
+    }
+    __env_snapshot_values[i] = new_values[i];
+  }
+  __env_snapshot_captured = true;
+  return RCL_RET_OK;
+
+fail:
+  for (size_t i = 0u; i < RCL_ENV_SNAPSHOT_VAR_COUNT; ++i) {
+    if (NULL != new_values[i]) {
+      allocator.deallocate(new_values[i], allocator.state);
+    }
+  }
+  return ret;
+}
+
+rcl_ret_t
+rcl_env_snapshot_get_value(const char * env_var, const char ** env_value)
+{
+  RCUTILS_CAN_SET_MSG_AND_RETURN_WITH_ERROR_OF(RCL_RET_INVALID_ARGUMENT);
+  RCUTILS_CAN_SET_MSG_AND_RETURN_WITH_ERROR_OF(RCL_RET_ERROR);
+
+  RCL_CHECK_ARGUMENT_FOR_NULL(env_var, RCL_RET_INVALID_ARGUMENT);
+  RCL_CHECK_ARGUMENT_FOR_NULL(env_value, RCL_RET_INVALID_ARGUMENT);
+
+  if (!__env_snapshot_captured) {
+    rcl_ret_t ret = rcl_env_snapshot_refresh();
+    if (RCL_RET_OK != ret) {
+      return ret;
+    }
+  }
+
+  for (size_t i = 0u; i < RCL_ENV_SNAPSHOT_VAR_COUNT; ++i) {
+    if (0 == strcmp(env_var, __env_snapshot_names[i])) {
+      *env_value = __env_snapshot_values[i];
+      return RCL_RET_OK;
+    }
+  }
+
+  RCL_SET_ERROR_MSG_WITH_FORMAT_STRING(
+    "env var '%s' is not part of the environment snapshot", env_var);
+  return RCL_RET_INVALID_ARGUMENT;
+}
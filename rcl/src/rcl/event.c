@@ -83,6 +83,9 @@ rcl_publisher_event_init(
 
   event->impl->rmw_handle = rmw_get_zero_initialized_event();
   event->impl->allocator = *allocator;
+  event->impl->subscription_impl = NULL;
+  // lets taken matched events invalidate the publisher's cached network flows
+  event->impl->publisher_impl = publisher->impl;
 
   rmw_ret_t ret = rmw_publisher_event_init(
     &event->impl->rmw_handle,
@@ -143,6 +146,9 @@ rcl_subscription_event_init(
 
   event->impl->rmw_handle = rmw_get_zero_initialized_event();
   event->impl->allocator = *allocator;
+  // lets taken events feed the subscription's receive-queue statistics
+  event->impl->subscription_impl = subscription->impl;
+  event->impl->publisher_impl = NULL;
 
   rmw_ret_t ret = rmw_subscription_event_init(
     &event->impl->rmw_handle,
@@ -152,6 +158,21 @@ rcl_subscription_event_init(
     goto fail;
   }
 
+  if (RMW_EVENT_SUBSCRIPTION_MATCHED == rmw_event_type) {
+    // Seed the matched-publisher cache, then let taken matched events keep it
+    // current so rcl_subscription_get_publisher_count() polling stays in rcl.
+    size_t publisher_count = 0u;
+    rmw_ret_t count_ret = rmw_subscription_count_matched_publishers(
+      subscription->impl->rmw_handle, &publisher_count);
+    if (RMW_RET_OK == count_ret) {
+      atomic_init(&subscription->impl->matched_publisher_count, (uint64_t)publisher_count);
+      subscription->impl->matched_count_cached = true;
+    } else {
+      // best effort only, keep routing the getter to the rmw layer
+      rmw_reset_error();
+    }
+  }
+
   return RCL_RET_OK;
 fail:
   allocator->deallocate(event->impl, allocator->state);
@@ -179,11 +200,206 @@ rcl_take_event(
       ROS_PACKAGE_NAME, "take_event request complete, unable to take event");
     return RCL_RET_EVENT_TAKE_FAILED;
   }
+  if (NULL != event->impl->subscription_impl &&
+    RMW_EVENT_MESSAGE_LOST == event->impl->rmw_handle.event_type)
+  {
+    const rmw_message_lost_status_t * status = event_info;
+    event->impl->subscription_impl->queue_stats.messages_lost = status->total_count;
+  }
+  if (NULL != event->impl->subscription_impl &&
+    RMW_EVENT_SUBSCRIPTION_MATCHED == event->impl->rmw_handle.event_type)
+  {
+    const rmw_matched_status_t * status = event_info;
+    rcutils_atomic_store(
+      &event->impl->subscription_impl->matched_publisher_count,
+      (uint64_t)status->current_count);
+    // a match change can add or remove transport flows
+    event->impl->subscription_impl->network_flow_cache_stale = true;
+  }
+  if (NULL != event->impl->publisher_impl &&
+    RMW_EVENT_PUBLICATION_MATCHED == event->impl->rmw_handle.event_type)
+  {
+    // a match change can add or remove transport flows
+    event->impl->publisher_impl->network_flow_cache_stale = true;
+  }
   RCUTILS_LOG_DEBUG_NAMED(
     ROS_PACKAGE_NAME, "take_event request success");
   return rcl_convert_rmw_ret_to_rcl_ret(ret);
 }
 
+rcl_ret_t
+rcl_take_events(
+  const rcl_event_t * event,
+  void ** event_info_buffer,
+  size_t max_events,
+  size_t * taken)
+{
+  if (!rcl_event_is_valid(event)) {
+    return RCL_RET_EVENT_INVALID;
+  }
+  RCL_CHECK_ARGUMENT_FOR_NULL(event_info_buffer, RCL_RET_INVALID_ARGUMENT);
+  RCL_CHECK_ARGUMENT_FOR_NULL(taken, RCL_RET_INVALID_ARGUMENT);
+  if (0u == max_events) {
+    RCL_SET_ERROR_MSG("max_events must be greater than 0");
+    return RCL_RET_INVALID_ARGUMENT;
+  }
+  *taken = 0u;
+  while (*taken < max_events) {
+    RCL_CHECK_ARGUMENT_FOR_NULL(event_info_buffer[*taken], RCL_RET_INVALID_ARGUMENT);
+    rcl_ret_t ret = rcl_take_event(event, event_info_buffer[*taken]);
+    if (RCL_RET_EVENT_TAKE_FAILED == ret) {
+      break;
+    }
+    if (RCL_RET_OK != ret) {
+      return ret;  // error already set
+    }
+    ++(*taken);
+  }
+  if (0u == *taken) {
+    RCUTILS_LOG_DEBUG_NAMED(
+      ROS_PACKAGE_NAME, "take_events request complete, no event was pending");
+    return RCL_RET_EVENT_TAKE_FAILED;
+  }
+  RCUTILS_LOG_DEBUG_NAMED(
+    ROS_PACKAGE_NAME, "take_events request success, %zu events taken", *taken);
+  return RCL_RET_OK;
+}
+
+/// Fold the interval counters of the latest status into the accumulated one.
+/**
+ * The accumulated record keeps the latest totals and current values, but the
+ * `*_count_change` fields are summed so that draining N queued events reports
+ * the same aggregate change a caller taking them one by one would have seen.
+ */
+static void
+_rcl_event_coalesce_status(
+  rmw_event_type_t event_type,
+  void * accumulated,
+  const void * latest)
+{
+  switch (event_type) {
+    case RMW_EVENT_OFFERED_DEADLINE_MISSED:
+    case RMW_EVENT_REQUESTED_DEADLINE_MISSED:
+      {
+        rmw_requested_deadline_missed_status_t * acc = accumulated;
+        const rmw_requested_deadline_missed_status_t * last = latest;
+        int32_t change = acc->total_count_change + last->total_count_change;
+        *acc = *last;
+        acc->total_count_change = change;
+        break;
+      }
+    case RMW_EVENT_LIVELINESS_LOST:
+      {
+        rmw_liveliness_lost_status_t * acc = accumulated;
+        const rmw_liveliness_lost_status_t * last = latest;
+        int32_t change = acc->total_count_change + last->total_count_change;
+        *acc = *last;
+        acc->total_count_change = change;
+        break;
+      }
+    case RMW_EVENT_LIVELINESS_CHANGED:
+      {
+        rmw_liveliness_changed_status_t * acc = accumulated;
+        const rmw_liveliness_changed_status_t * last = latest;
+        int32_t alive_change = acc->alive_count_change + last->alive_count_change;
+        int32_t not_alive_change = acc->not_alive_count_change + last->not_alive_count_change;
+        *acc = *last;
+        acc->alive_count_change = alive_change;
+        acc->not_alive_count_change = not_alive_change;
+        break;
+      }
+    case RMW_EVENT_OFFERED_QOS_INCOMPATIBLE:
+    case RMW_EVENT_REQUESTED_QOS_INCOMPATIBLE:
+      {
+        rmw_qos_incompatible_event_status_t * acc = accumulated;
+        const rmw_qos_incompatible_event_status_t * last = latest;
+        int32_t change = acc->total_count_change + last->total_count_change;
+        *acc = *last;
+        acc->total_count_change = change;
+        break;
+      }
+    case RMW_EVENT_MESSAGE_LOST:
+      {
+        rmw_message_lost_status_t * acc = accumulated;
+        const rmw_message_lost_status_t * last = latest;
+        size_t change = acc->total_count_change + last->total_count_change;
+        *acc = *last;
+        acc->total_count_change = change;
+        break;
+      }
+    case RMW_EVENT_PUBLISHER_INCOMPATIBLE_TYPE:
+    case RMW_EVENT_SUBSCRIPTION_INCOMPATIBLE_TYPE:
+      {
+        rmw_incompatible_type_status_t * acc = accumulated;
+        const rmw_incompatible_type_status_t * last = latest;
+        int32_t change = acc->total_count_change + last->total_count_change;
+        *acc = *last;
+        acc->total_count_change = change;
+        break;
+      }
+    case RMW_EVENT_PUBLICATION_MATCHED:
+    case RMW_EVENT_SUBSCRIPTION_MATCHED:
+      {
+        rmw_matched_status_t * acc = accumulated;
+        const rmw_matched_status_t * last = latest;
+        int32_t total_change = acc->total_count_change + last->total_count_change;
+        int32_t current_change = acc->current_count_change + last->current_count_change;
+        *acc = *last;
+        acc->total_count_change = total_change;
+        acc->current_count_change = current_change;
+        break;
+      }
+    default:
+      // unknown event type, keep the latest record unmerged
+      break;
+  }
+}
+
+rcl_ret_t
+rcl_take_event_coalesced(
+  const rcl_event_t * event,
+  void * event_info,
+  size_t * coalesced_count)
+{
+  if (!rcl_event_is_valid(event)) {
+    return RCL_RET_EVENT_INVALID;
+  }
+  RCL_CHECK_ARGUMENT_FOR_NULL(event_info, RCL_RET_INVALID_ARGUMENT);
+  RCL_CHECK_ARGUMENT_FOR_NULL(coalesced_count, RCL_RET_INVALID_ARGUMENT);
+  *coalesced_count = 0u;
+  rcl_ret_t ret = rcl_take_event(event, event_info);
+  if (RCL_RET_OK != ret) {
+    return ret;  // error already set (or take failed)
+  }
+  *coalesced_count = 1u;
+  // Drain the remaining queued events into scratch space; large enough for
+  // any of the status structs handled by _rcl_event_coalesce_status().
+  union {
+    rmw_requested_deadline_missed_status_t deadline_missed;
+    rmw_liveliness_lost_status_t liveliness_lost;
+    rmw_liveliness_changed_status_t liveliness_changed;
+    rmw_qos_incompatible_event_status_t incompatible_qos;
+    rmw_message_lost_status_t message_lost;
+    rmw_incompatible_type_status_t incompatible_type;
+    rmw_matched_status_t matched;
+  } scratch;
+  while (true) {
+    ret = rcl_take_event(event, &scratch);
+    if (RCL_RET_EVENT_TAKE_FAILED == ret) {
+      break;
+    }
+    if (RCL_RET_OK != ret) {
+      return ret;  // error already set
+    }
+    _rcl_event_coalesce_status(event->impl->rmw_handle.event_type, event_info, &scratch);
+    ++(*coalesced_count);
+  }
+  RCUTILS_LOG_DEBUG_NAMED(
+    ROS_PACKAGE_NAME, "take_event_coalesced request success, %zu events coalesced",
+    *coalesced_count);
+  return RCL_RET_OK;
+}
+
 rcl_ret_t
 rcl_event_fini(rcl_event_t * event)
 {
@@ -193,6 +409,12 @@ rcl_event_fini(rcl_event_t * event)
   RCUTILS_LOG_DEBUG_NAMED(ROS_PACKAGE_NAME, "Finalizing event");
   if (NULL != event->impl) {
     rcl_allocator_t allocator = event->impl->allocator;
+    if (NULL != event->impl->subscription_impl &&
+      RMW_EVENT_SUBSCRIPTION_MATCHED == event->impl->rmw_handle.event_type)
+    {
+      // nothing refreshes the cache anymore, route the getter back to rmw
+      event->impl->subscription_impl->matched_count_cached = false;
+    }
     rmw_ret_t ret = rmw_event_fini(&event->impl->rmw_handle);
     if (ret != RMW_RET_OK) {
       RCL_SET_ERROR_MSG(rmw_get_error_string().str);
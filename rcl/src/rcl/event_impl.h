@@ -18,11 +18,25 @@
 #include "rmw/rmw.h"
 
 #include "rcl/event.h"
+#include "rcl/publisher.h"
+#include "rcl/subscription.h"
 
 struct rcl_event_impl_s
 {
   rmw_event_t rmw_handle;
   rcl_allocator_t allocator;
+  /// Owning subscription, NULL for publisher events.
+  /**
+   * Lets rcl_take_event() feed subscription-side statistics, e.g. losses
+   * reported through the message-lost event.
+   */
+  rcl_subscription_impl_t * subscription_impl;
+  /// Owning publisher, NULL for subscription events.
+  /**
+   * Lets rcl_take_event() invalidate publisher-side caches, e.g. the
+   * network flow endpoint view on matched events.
+   */
+  rcl_publisher_impl_t * publisher_impl;
 };
 
 #endif  // RCL__EVENT_IMPL_H_
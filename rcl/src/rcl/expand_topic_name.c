@@ -27,8 +27,6 @@ extern "C"
 #include "rcl/types.h"
 #include "rcl/validate_topic_name.h"
 #include "rcutils/error_handling.h"
-#include "rcutils/format_string.h"
-#include "rcutils/repl_str.h"
 #include "rcutils/strdup.h"
 #include "rmw/error_handling.h"
 #include "rmw/types.h"
@@ -40,6 +38,35 @@ extern "C"
 #define SUBSTITUION_NAMESPACE "{ns}"
 #define SUBSTITUION_NAMESPACE2 "{namespace}"
 
+/// Resolve one {substitution} token, or NULL if it is unknown.
+/**
+ * The built-in substitutions come from a static comparison table; only
+ * tokens that are not built-in fall back to the substitutions map.
+ * `token_len` includes both braces.
+ */
+static
+const char *
+rcl_resolve_substitution(
+  const char * token,
+  size_t token_len,
+  const char * node_name,
+  const char * node_namespace,
+  const rcutils_string_map_t * substitutions)
+{
+  if (0 == strncmp(SUBSTITUION_NODE_NAME, token, token_len)) {
+    return node_name;
+  }
+  if (
+    0 == strncmp(SUBSTITUION_NAMESPACE, token, token_len) ||
+    0 == strncmp(SUBSTITUION_NAMESPACE2, token, token_len))
+  {
+    return node_namespace;
+  }
+  // compare {substitution}
+  //          ^ until    ^
+  return rcutils_string_map_getn(substitutions, token + 1, token_len - 2);
+}
+
 rcl_ret_t
 rcl_expand_topic_name(
   const char * input_topic_name,
@@ -109,115 +136,102 @@ rcl_expand_topic_name(
     }
     return RCL_RET_OK;
   }
-  char * local_output = NULL;
-  // if has_a_namespace_tilde, replace that first
-  if (has_a_namespace_tilde) {
-    // special case where node_namespace is just '/'
-    // then no additional separating '/' is needed
-    const char * fmt = (strlen(node_namespace) == 1) ? "%s%s%s" : "%s/%s%s";
-    local_output =
-      rcutils_format_string(allocator, fmt, node_namespace, node_name, input_topic_name + 1);
-    if (!local_output) {
-      *output_topic_name = NULL;
-      RCL_SET_ERROR_MSG("failed to allocate memory for output topic");
-      return RCL_RET_BAD_ALLOC;
-    }
-  }
-  // if it has any substitutions, replace those
-  if (has_a_substitution) {
-    // Assumptions entering this scope about the topic string:
-    //
-    // - All {} are matched and balanced
-    // - There is no nesting, i.e. {{}}
-    // - There are no empty substitution substr, i.e. '{}' versus '{something}'
-    //
-    // These assumptions are taken because this is checked in the validation function.
-    const char * current_output = (local_output) ? local_output : input_topic_name;
-    char * next_opening_brace = NULL;
-    // current_output may be replaced on each loop if a substitution is made
-    while ((next_opening_brace = strchr(current_output, '{')) != NULL) {
-      char * next_closing_brace = strchr(current_output, '}');
-      // conclusion based on above assumptions: next_closing_brace - next_opening_brace > 1
-      size_t substitution_substr_len = next_closing_brace - next_opening_brace + 1;
-      // figure out what the replacement is for this substitution
-      const char * replacement = NULL;
-      if (strncmp(SUBSTITUION_NODE_NAME, next_opening_brace, substitution_substr_len) == 0) {
-        replacement = node_name;
-      } else if (  // NOLINT
-        strncmp(SUBSTITUION_NAMESPACE, next_opening_brace, substitution_substr_len) == 0 ||
-        strncmp(SUBSTITUION_NAMESPACE2, next_opening_brace, substitution_substr_len) == 0)
-      {
-        replacement = node_namespace;
-      } else {
-        replacement = rcutils_string_map_getn(
-          substitutions,
-          // compare {substitution}
-          //          ^ until    ^
-          next_opening_brace + 1, substitution_substr_len - 2);
-        if (!replacement) {
-          // in this case, it is neither node name nor ns nor in the substitutions map, so error
-          *output_topic_name = NULL;
-          char * unmatched_substitution =
-            rcutils_strndup(next_opening_brace, substitution_substr_len, allocator);
-          if (unmatched_substitution) {
-            RCL_SET_ERROR_MSG_WITH_FORMAT_STRING(
-              "unknown substitution: %s", unmatched_substitution);
-          } else {
-            RCUTILS_SAFE_FWRITE_TO_STDERR("failed to allocate memory for unmatched substitution\n");
-          }
-          allocator.deallocate(unmatched_substitution, allocator.state);
-          allocator.deallocate(local_output, allocator.state);
-          return RCL_RET_UNKNOWN_SUBSTITUTION;
-        }
-      }
-      // at this point replacement will be set or an error would have returned out
-      // do the replacement
-      char * next_substitution =
-        rcutils_strndup(next_opening_brace, substitution_substr_len, allocator);
-      if (!next_substitution) {
+  // Assumptions below about the topic string:
+  //
+  // - All {} are matched and balanced
+  // - There is no nesting, i.e. {{}}
+  // - There are no empty substitution substr, i.e. '{}' versus '{something}'
+  //
+  // These assumptions are taken because this is checked in the validation function.
+  //
+  // The expansion is done in two passes over the input: the first computes
+  // the output length and the first character of the expanded body (which
+  // decides whether the namespace still has to be prepended), the second
+  // writes into a single allocation.
+  size_t namespace_len = strlen(node_namespace);
+  // a tilde consumes the leading character and prepends namespace and node name
+  const char * body = has_a_namespace_tilde ? input_topic_name + 1 : input_topic_name;
+  size_t body_len = 0;
+  char first_char = '\0';
+  for (const char * current = body; '\0' != *current; ) {
+    if ('{' == *current) {
+      const char * closing_brace = strchr(current, '}');
+      size_t token_len = (size_t)(closing_brace - current) + 1;
+      const char * replacement = rcl_resolve_substitution(
+        current, token_len, node_name, node_namespace, substitutions);
+      if (NULL == replacement) {
+        // in this case, it is neither node name nor ns nor in the substitutions map, so error
         *output_topic_name = NULL;
-        RCL_SET_ERROR_MSG("failed to allocate memory for substitution");
-        allocator.deallocate(local_output, allocator.state);
-        return RCL_RET_BAD_ALLOC;
+        RCL_SET_ERROR_MSG_WITH_FORMAT_STRING(
+          "unknown substitution: %.*s", (int)token_len, current);
+        return RCL_RET_UNKNOWN_SUBSTITUTION;
       }
-      char * original_local_output = local_output;
-      local_output = rcutils_repl_str(current_output, next_substitution, replacement, &allocator);
-      allocator.deallocate(next_substitution, allocator.state);  // free no matter what
-      allocator.deallocate(original_local_output, allocator.state);  // free no matter what
-      if (!local_output) {
-        *output_topic_name = NULL;
-        RCL_SET_ERROR_MSG("failed to allocate memory for expanded topic");
-        return RCL_RET_BAD_ALLOC;
+      size_t replacement_len = strlen(replacement);
+      if ('\0' == first_char && replacement_len > 0) {
+        first_char = replacement[0];
+      }
+      body_len += replacement_len;
+      current = closing_brace + 1;
+    } else {
+      if ('\0' == first_char) {
+        first_char = *current;
       }
-      current_output = local_output;
-      // loop until all substitutions are replaced
-    }  // while
+      ++body_len;
+      ++current;
+    }
   }
-  // finally make the name absolute if it isn't already
-  if (
-    (local_output && local_output[0] != '/') ||
-    (!local_output && input_topic_name[0] != '/'))
-  {
-    char * original_local_output = local_output;
-    // special case where node_namespace is just '/'
-    // then no additional separating '/' is needed
-    const char * fmt = (strlen(node_namespace) == 1) ? "%s%s" : "%s/%s";
-    local_output = rcutils_format_string(
-      allocator, fmt, node_namespace, (local_output) ? local_output : input_topic_name);
-    if (original_local_output) {
-      allocator.deallocate(original_local_output, allocator.state);
+  // figure out what has to come before the expanded body
+  // special case where node_namespace is just '/'
+  // then no additional separating '/' is needed
+  size_t prefix_len = 0;
+  if (has_a_namespace_tilde) {
+    prefix_len = namespace_len + ((namespace_len > 1) ? 1 : 0) + strlen(node_name);
+  } else if ('/' != first_char) {
+    prefix_len = namespace_len + ((namespace_len > 1) ? 1 : 0);
+  }
+  char * local_output = allocator.allocate(prefix_len + body_len + 1, allocator.state);
+  if (NULL == local_output) {
+    *output_topic_name = NULL;
+    RCL_SET_ERROR_MSG("failed to allocate memory for output topic");
+    return RCL_RET_BAD_ALLOC;
+  }
+  char * dest = local_output;
+  if (has_a_namespace_tilde) {
+    memcpy(dest, node_namespace, namespace_len);
+    dest += namespace_len;
+    if (namespace_len > 1) {
+      *dest++ = '/';
     }
-    if (!local_output) {
-      *output_topic_name = NULL;
-      RCL_SET_ERROR_MSG("failed to allocate memory for output topic");
-      return RCL_RET_BAD_ALLOC;
+    size_t node_name_len = strlen(node_name);
+    memcpy(dest, node_name, node_name_len);
+    dest += node_name_len;
+  } else if ('/' != first_char) {
+    memcpy(dest, node_namespace, namespace_len);
+    dest += namespace_len;
+    if (namespace_len > 1) {
+      *dest++ = '/';
     }
   }
+  for (const char * current = body; '\0' != *current; ) {
+    if ('{' == *current) {
+      const char * closing_brace = strchr(current, '}');
+      size_t token_len = (size_t)(closing_brace - current) + 1;
+      // the first pass already errored out on unknown substitutions
+      const char * replacement = rcl_resolve_substitution(
+        current, token_len, node_name, node_namespace, substitutions);
+      size_t replacement_len = strlen(replacement);
+      memcpy(dest, replacement, replacement_len);
+      dest += replacement_len;
+      current = closing_brace + 1;
+    } else {
+      *dest++ = *current++;
+    }
+  }
+  *dest = '\0';
   // finally store the result in the out pointer and return
   *output_topic_name = local_output;
   return RCL_RET_OK;
 }
-
 rcl_ret_t
 rcl_get_default_topic_name_substitutions(rcutils_string_map_t * string_map)
 {
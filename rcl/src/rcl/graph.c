@@ -19,11 +19,17 @@ extern "C"
 
 #include "rcl/graph.h"
 
+#include <stdlib.h>
+#include <string.h>
+
 #include "rcl/error_handling.h"
 #include "rcl/guard_condition.h"
 #include "rcl/wait.h"
 #include "rcutils/allocator.h"
 #include "rcutils/error_handling.h"
+#include "rcutils/logging_macros.h"
+#include "rcutils/stdatomic_helper.h"
+#include "rcutils/strdup.h"
 #include "rcutils/macros.h"
 #include "rcutils/time.h"
 #include "rcutils/types.h"
@@ -156,6 +162,244 @@ rcl_get_subscriber_names_and_types_by_node(
   return rcl_convert_rmw_ret_to_rcl_ret(rmw_ret);
 }
 
+// One topic of one per-node query result, sortable by name so the merge can
+// group duplicates with a single sort.
+typedef struct rcl_graph_merge_entry_s
+{
+  const char * name;
+  size_t result_index;
+  size_t entry_index;
+} rcl_graph_merge_entry_t;
+
+static int
+__graph_merge_entry_cmp(const void * lhs, const void * rhs)
+{
+  return strcmp(
+    ((const rcl_graph_merge_entry_t *)lhs)->name,
+    ((const rcl_graph_merge_entry_t *)rhs)->name);
+}
+
+// Merge several query results into one set with unique names; a name found
+// in several results gets the union of the types seen for it.
+static rcl_ret_t
+__graph_merge_names_and_types(
+  const rcl_names_and_types_t * results,
+  size_t number_of_results,
+  rcl_allocator_t * allocator,
+  rcl_names_and_types_t * merged)
+{
+  size_t total_names = 0;
+  size_t total_types = 0;
+  for (size_t i = 0; i < number_of_results; ++i) {
+    total_names += results[i].names.size;
+    for (size_t j = 0; j < results[i].names.size; ++j) {
+      total_types += results[i].types[j].size;
+    }
+  }
+  if (0 == total_names) {
+    // An empty merged set stays zero initialized, which fini accepts.
+    return RCL_RET_OK;
+  }
+  rcl_ret_t ret = RCL_RET_OK;
+  const char ** type_scratch = NULL;
+  rcl_graph_merge_entry_t * entries = allocator->allocate(
+    total_names * sizeof(rcl_graph_merge_entry_t), allocator->state);
+  if (NULL == entries) {
+    RCL_SET_ERROR_MSG("allocating memory failed");
+    return RCL_RET_BAD_ALLOC;
+  }
+  size_t entry_count = 0;
+  for (size_t i = 0; i < number_of_results; ++i) {
+    for (size_t j = 0; j < results[i].names.size; ++j) {
+      entries[entry_count].name = results[i].names.data[j];
+      entries[entry_count].result_index = i;
+      entries[entry_count].entry_index = j;
+      ++entry_count;
+    }
+  }
+  qsort(entries, total_names, sizeof(rcl_graph_merge_entry_t), __graph_merge_entry_cmp);
+  size_t unique_names = 0;
+  for (size_t i = 0; i < total_names; ++i) {
+    if (0 == i || 0 != strcmp(entries[i].name, entries[i - 1].name)) {
+      ++unique_names;
+    }
+  }
+  // Holds the deduplicated type strings of one name at a time.
+  type_scratch =
+    allocator->allocate(total_types * sizeof(const char *), allocator->state);
+  if (NULL == type_scratch) {
+    RCL_SET_ERROR_MSG("allocating memory failed");
+    ret = RCL_RET_BAD_ALLOC;
+    goto cleanup;
+  }
+  ret = rcl_names_and_types_init(merged, unique_names, allocator);
+  if (RCL_RET_OK != ret) {
+    goto cleanup;
+  }
+  size_t out_index = 0;
+  size_t run_start = 0;
+  while (run_start < total_names) {
+    size_t run_end = run_start + 1;
+    while (run_end < total_names &&
+      0 == strcmp(entries[run_end].name, entries[run_start].name))
+    {
+      ++run_end;
+    }
+    merged->names.data[out_index] = rcutils_strdup(entries[run_start].name, *allocator);
+    if (NULL == merged->names.data[out_index]) {
+      RCL_SET_ERROR_MSG("allocating memory failed");
+      ret = RCL_RET_BAD_ALLOC;
+      goto cleanup;
+    }
+    // Union of the types across the run.
+    size_t num_types = 0;
+    for (size_t i = run_start; i < run_end; ++i) {
+      const rcutils_string_array_t * types =
+        &results[entries[i].result_index].types[entries[i].entry_index];
+      for (size_t j = 0; j < types->size; ++j) {
+        bool seen = false;
+        for (size_t k = 0; k < num_types; ++k) {
+          if (0 == strcmp(type_scratch[k], types->data[j])) {
+            seen = true;
+            break;
+          }
+        }
+        if (!seen) {
+          type_scratch[num_types++] = types->data[j];
+        }
+      }
+    }
+    rcutils_ret_t rcutils_ret = rcutils_string_array_init(
+      &merged->types[out_index], num_types, allocator);
+    if (RCUTILS_RET_OK != rcutils_ret) {
+      RCL_SET_ERROR_MSG(rcutils_get_error_string().str);
+      ret = rcl_convert_rcutils_ret_to_rcl_ret(rcutils_ret);
+      goto cleanup;
+    }
+    for (size_t k = 0; k < num_types; ++k) {
+      merged->types[out_index].data[k] = rcutils_strdup(type_scratch[k], *allocator);
+      if (NULL == merged->types[out_index].data[k]) {
+        RCL_SET_ERROR_MSG("allocating memory failed");
+        ret = RCL_RET_BAD_ALLOC;
+        goto cleanup;
+      }
+    }
+    ++out_index;
+    run_start = run_end;
+  }
+cleanup:
+  allocator->deallocate(entries, allocator->state);
+  if (NULL != type_scratch) {
+    allocator->deallocate(type_scratch, allocator->state);
+  }
+  if (RCL_RET_OK != ret && NULL != merged->names.data) {
+    if (RCL_RET_OK != rcl_names_and_types_fini(merged)) {
+      RCUTILS_LOG_ERROR_NAMED(
+        ROS_PACKAGE_NAME, "Failed to fini partially merged names and types");
+    }
+    *merged = rcl_get_zero_initialized_names_and_types();
+  }
+  return ret;
+}
+
+// Both per-node topic queries share a signature; the batched fan-out takes
+// whichever one it should apply to every node in the list.
+typedef rcl_ret_t (* rcl_names_and_types_by_node_fn_t)(
+  const rcl_node_t * node,
+  rcl_allocator_t * allocator,
+  bool no_demangle,
+  const char * node_name,
+  const char * node_namespace,
+  rcl_names_and_types_t * topic_names_and_types);
+
+static rcl_ret_t
+__graph_get_names_and_types_for_nodes(
+  rcl_names_and_types_by_node_fn_t query,
+  const rcl_node_t * node,
+  rcl_allocator_t * allocator,
+  bool no_demangle,
+  const char ** node_names,
+  const char ** node_namespaces,
+  size_t number_of_nodes,
+  rcl_names_and_types_t * topic_names_and_types)
+{
+  if (!rcl_node_is_valid(node)) {
+    return RCL_RET_NODE_INVALID;
+  }
+  RCL_CHECK_ALLOCATOR_WITH_MSG(allocator, "invalid allocator", return RCL_RET_INVALID_ARGUMENT);
+  RCL_CHECK_ARGUMENT_FOR_NULL(topic_names_and_types, RCL_RET_INVALID_ARGUMENT);
+  rmw_ret_t rmw_ret = rmw_names_and_types_check_zero(topic_names_and_types);
+  if (RMW_RET_OK != rmw_ret) {
+    return rcl_convert_rmw_ret_to_rcl_ret(rmw_ret);
+  }
+  if (0 == number_of_nodes) {
+    return RCL_RET_OK;
+  }
+  RCL_CHECK_ARGUMENT_FOR_NULL(node_names, RCL_RET_INVALID_ARGUMENT);
+  RCL_CHECK_ARGUMENT_FOR_NULL(node_namespaces, RCL_RET_INVALID_ARGUMENT);
+  rcl_names_and_types_t * results = allocator->zero_allocate(
+    number_of_nodes, sizeof(rcl_names_and_types_t), allocator->state);
+  if (NULL == results) {
+    RCL_SET_ERROR_MSG("allocating memory failed");
+    return RCL_RET_BAD_ALLOC;
+  }
+  rcl_ret_t ret = RCL_RET_OK;
+  size_t queried = 0;
+  for (; queried < number_of_nodes; ++queried) {
+    results[queried] = rcl_get_zero_initialized_names_and_types();
+    ret = query(
+      node, allocator, no_demangle, node_names[queried], node_namespaces[queried],
+      &results[queried]);
+    if (RCL_RET_OK != ret) {
+      break;  // error already set
+    }
+  }
+  if (RCL_RET_OK == ret) {
+    ret = __graph_merge_names_and_types(
+      results, number_of_nodes, allocator, topic_names_and_types);
+  }
+  for (size_t i = 0; i < queried; ++i) {
+    if (RCL_RET_OK != rcl_names_and_types_fini(&results[i])) {
+      RCUTILS_LOG_ERROR_NAMED(
+        ROS_PACKAGE_NAME, "Failed to fini per-node names and types");
+    }
+  }
+  allocator->deallocate(results, allocator->state);
+  return ret;
+}
+
+rcl_ret_t
+rcl_get_publisher_names_and_types_for_nodes(
+  const rcl_node_t * node,
+  rcl_allocator_t * allocator,
+  bool no_demangle,
+  const char ** node_names,
+  const char ** node_namespaces,
+  size_t number_of_nodes,
+  rcl_names_and_types_t * topic_names_and_types)
+{
+  return __graph_get_names_and_types_for_nodes(
+    rcl_get_publisher_names_and_types_by_node,
+    node, allocator, no_demangle, node_names, node_namespaces, number_of_nodes,
+    topic_names_and_types);
+}
+
+rcl_ret_t
+rcl_get_subscriber_names_and_types_for_nodes(
+  const rcl_node_t * node,
+  rcl_allocator_t * allocator,
+  bool no_demangle,
+  const char ** node_names,
+  const char ** node_namespaces,
+  size_t number_of_nodes,
+  rcl_names_and_types_t * topic_names_and_types)
+{
+  return __graph_get_names_and_types_for_nodes(
+    rcl_get_subscriber_names_and_types_by_node,
+    node, allocator, no_demangle, node_names, node_namespaces, number_of_nodes,
+    topic_names_and_types);
+}
+
 rcl_ret_t
 rcl_get_service_names_and_types_by_node(
   const rcl_node_t * node,
@@ -312,6 +556,157 @@ rcl_names_and_types_fini(rcl_names_and_types_t * topic_names_and_types)
   return rcl_convert_rmw_ret_to_rcl_ret(rmw_ret);
 }
 
+rcl_packed_names_and_types_t
+rcl_get_zero_initialized_packed_names_and_types(void)
+{
+  static rcl_packed_names_and_types_t null_packed = {0};
+  return null_packed;
+}
+
+rcl_ret_t
+rcl_pack_names_and_types(
+  const rcl_names_and_types_t * source,
+  rcl_allocator_t * allocator,
+  rcl_packed_names_and_types_t * packed)
+{
+  RCL_CHECK_ARGUMENT_FOR_NULL(source, RCL_RET_INVALID_ARGUMENT);
+  RCL_CHECK_ALLOCATOR_WITH_MSG(allocator, "invalid allocator", return RCL_RET_INVALID_ARGUMENT);
+  RCL_CHECK_ARGUMENT_FOR_NULL(packed, RCL_RET_INVALID_ARGUMENT);
+  if (NULL != packed->buffer || 0 != packed->size) {
+    RCL_SET_ERROR_MSG("packed names and types is not zero initialized");
+    return RCL_RET_INVALID_ARGUMENT;
+  }
+  // First pass: measure the buffer and count the flattened types.
+  size_t buffer_length = 0;
+  size_t total_types = 0;
+  for (size_t i = 0; i < source->names.size; ++i) {
+    buffer_length += strlen(source->names.data[i]) + 1;
+    total_types += source->types[i].size;
+    for (size_t j = 0; j < source->types[i].size; ++j) {
+      buffer_length += strlen(source->types[i].data[j]) + 1;
+    }
+  }
+  packed->allocator = *allocator;
+  packed->size = source->names.size;
+  if (0 == packed->size) {
+    return RCL_RET_OK;
+  }
+  packed->buffer = allocator->allocate(buffer_length, allocator->state);
+  packed->name_offsets =
+    allocator->allocate(packed->size * sizeof(size_t), allocator->state);
+  packed->type_starts =
+    allocator->allocate((packed->size + 1) * sizeof(size_t), allocator->state);
+  if (total_types > 0) {
+    packed->type_offsets =
+      allocator->allocate(total_types * sizeof(size_t), allocator->state);
+  }
+  if (NULL == packed->buffer || NULL == packed->name_offsets ||
+    NULL == packed->type_starts || (total_types > 0 && NULL == packed->type_offsets))
+  {
+    rcl_ret_t fini_ret = rcl_packed_names_and_types_fini(packed);
+    (void)fini_ret;
+    RCL_SET_ERROR_MSG("allocating memory failed");
+    return RCL_RET_BAD_ALLOC;
+  }
+  packed->buffer_length = buffer_length;
+  // Second pass: copy each topic's name and types adjacently, recording the
+  // offsets they land at.
+  size_t write_offset = 0;
+  size_t type_index = 0;
+  for (size_t i = 0; i < packed->size; ++i) {
+    packed->type_starts[i] = type_index;
+    size_t length = strlen(source->names.data[i]) + 1;
+    memcpy(packed->buffer + write_offset, source->names.data[i], length);
+    packed->name_offsets[i] = write_offset;
+    write_offset += length;
+    for (size_t j = 0; j < source->types[i].size; ++j) {
+      length = strlen(source->types[i].data[j]) + 1;
+      memcpy(packed->buffer + write_offset, source->types[i].data[j], length);
+      packed->type_offsets[type_index++] = write_offset;
+      write_offset += length;
+    }
+  }
+  packed->type_starts[packed->size] = type_index;
+  return RCL_RET_OK;
+}
+
+rcl_ret_t
+rcl_get_topic_names_and_types_packed(
+  const rcl_node_t * node,
+  rcl_allocator_t * allocator,
+  bool no_demangle,
+  rcl_packed_names_and_types_t * topic_names_and_types)
+{
+  RCL_CHECK_ALLOCATOR_WITH_MSG(allocator, "invalid allocator", return RCL_RET_INVALID_ARGUMENT);
+  RCL_CHECK_ARGUMENT_FOR_NULL(topic_names_and_types, RCL_RET_INVALID_ARGUMENT);
+  rcl_names_and_types_t temp = rcl_get_zero_initialized_names_and_types();
+  rcl_ret_t ret = rcl_get_topic_names_and_types(node, allocator, no_demangle, &temp);
+  if (RCL_RET_OK != ret) {
+    return ret;  // error already set
+  }
+  ret = rcl_pack_names_and_types(&temp, allocator, topic_names_and_types);
+  rcl_ret_t fini_ret = rcl_names_and_types_fini(&temp);
+  if (RCL_RET_OK == ret && RCL_RET_OK != fini_ret) {
+    ret = fini_ret;  // error already set
+  }
+  return ret;
+}
+
+const char *
+rcl_packed_names_and_types_get_name(
+  const rcl_packed_names_and_types_t * packed, size_t index)
+{
+  if (NULL == packed || index >= packed->size) {
+    return NULL;
+  }
+  return packed->buffer + packed->name_offsets[index];
+}
+
+size_t
+rcl_packed_names_and_types_get_type_count(
+  const rcl_packed_names_and_types_t * packed, size_t index)
+{
+  if (NULL == packed || index >= packed->size) {
+    return 0;
+  }
+  return packed->type_starts[index + 1] - packed->type_starts[index];
+}
+
+const char *
+rcl_packed_names_and_types_get_type(
+  const rcl_packed_names_and_types_t * packed, size_t index, size_t type_index)
+{
+  if (NULL == packed || index >= packed->size) {
+    return NULL;
+  }
+  const size_t start = packed->type_starts[index];
+  if (type_index >= packed->type_starts[index + 1] - start) {
+    return NULL;
+  }
+  return packed->buffer + packed->type_offsets[start + type_index];
+}
+
+rcl_ret_t
+rcl_packed_names_and_types_fini(rcl_packed_names_and_types_t * packed)
+{
+  RCL_CHECK_ARGUMENT_FOR_NULL(packed, RCL_RET_INVALID_ARGUMENT);
+  rcl_allocator_t allocator = packed->allocator;
+  if (NULL != packed->buffer) {
+    allocator.deallocate(packed->buffer, allocator.state);
+  }
+  if (NULL != packed->name_offsets) {
+    allocator.deallocate(packed->name_offsets, allocator.state);
+  }
+  if (NULL != packed->type_starts) {
+    allocator.deallocate(packed->type_starts, allocator.state);
+  }
+  if (NULL != packed->type_offsets) {
+    allocator.deallocate(packed->type_offsets, allocator.state);
+  }
+  *packed = rcl_get_zero_initialized_packed_names_and_types();
+  return RCL_RET_OK;
+}
+
 rcl_ret_t
 rcl_get_node_names(
   const rcl_node_t * node,
@@ -418,6 +813,94 @@ rcl_get_node_names_with_enclaves(
   return rcl_convert_rmw_ret_to_rcl_ret(rmw_ret);
 }
 
+rcl_node_names_result_t
+rcl_get_zero_initialized_node_names_result(void)
+{
+  static rcl_node_names_result_t null_result = {0};
+  return null_result;
+}
+
+rcl_ret_t
+rcl_get_node_names_reuse(
+  const rcl_node_t * node,
+  rcl_intern_pool_t * pool,
+  rcl_allocator_t * allocator,
+  rcl_node_names_result_t * result)
+{
+  RCL_CHECK_ARGUMENT_FOR_NULL(pool, RCL_RET_INVALID_ARGUMENT);
+  RCL_CHECK_ALLOCATOR_WITH_MSG(allocator, "invalid allocator", return RCL_RET_INVALID_ARGUMENT);
+  RCL_CHECK_ARGUMENT_FOR_NULL(result, RCL_RET_INVALID_ARGUMENT);
+  rcutils_string_array_t node_names = rcutils_get_zero_initialized_string_array();
+  rcutils_string_array_t node_namespaces = rcutils_get_zero_initialized_string_array();
+  rcl_ret_t ret = rcl_get_node_names(node, *allocator, &node_names, &node_namespaces);
+  if (RCL_RET_OK != ret) {
+    return ret;  // error already set
+  }
+  rcl_ret_t fini_ret;
+  // Grow the retained arrays only when the graph outgrew them; shrinking
+  // never happens, that is the point of reuse.
+  if (node_names.size > result->capacity) {
+    size_t new_capacity = result->capacity > 0 ? result->capacity : 8;
+    while (new_capacity < node_names.size) {
+      new_capacity *= 2;
+    }
+    const char ** new_names = allocator->reallocate(
+      result->names, new_capacity * sizeof(const char *), allocator->state);
+    if (NULL == new_names) {
+      RCL_SET_ERROR_MSG("allocating memory failed");
+      ret = RCL_RET_BAD_ALLOC;
+      goto cleanup;
+    }
+    result->names = new_names;
+    const char ** new_namespaces = allocator->reallocate(
+      result->namespaces, new_capacity * sizeof(const char *), allocator->state);
+    if (NULL == new_namespaces) {
+      RCL_SET_ERROR_MSG("allocating memory failed");
+      ret = RCL_RET_BAD_ALLOC;
+      goto cleanup;
+    }
+    result->namespaces = new_namespaces;
+    result->capacity = new_capacity;
+    result->allocator = *allocator;
+  }
+  result->size = 0;
+  for (size_t i = 0; i < node_names.size; ++i) {
+    ret = rcl_intern_pool_intern(pool, node_names.data[i], &result->names[i]);
+    if (RCL_RET_OK != ret) {
+      goto cleanup;  // error already set
+    }
+    ret = rcl_intern_pool_intern(pool, node_namespaces.data[i], &result->namespaces[i]);
+    if (RCL_RET_OK != ret) {
+      goto cleanup;  // error already set
+    }
+    ++result->size;
+  }
+cleanup:
+  fini_ret = rcl_convert_rcutils_ret_to_rcl_ret(rcutils_string_array_fini(&node_names));
+  if (RCL_RET_OK == ret && RCL_RET_OK != fini_ret) {
+    ret = fini_ret;
+  }
+  fini_ret = rcl_convert_rcutils_ret_to_rcl_ret(rcutils_string_array_fini(&node_namespaces));
+  if (RCL_RET_OK == ret && RCL_RET_OK != fini_ret) {
+    ret = fini_ret;
+  }
+  return ret;
+}
+
+rcl_ret_t
+rcl_node_names_result_fini(rcl_node_names_result_t * result)
+{
+  RCL_CHECK_ARGUMENT_FOR_NULL(result, RCL_RET_INVALID_ARGUMENT);
+  if (NULL != result->names) {
+    result->allocator.deallocate(result->names, result->allocator.state);
+  }
+  if (NULL != result->namespaces) {
+    result->allocator.deallocate(result->namespaces, result->allocator.state);
+  }
+  *result = rcl_get_zero_initialized_node_names_result();
+  return RCL_RET_OK;
+}
+
 rcl_ret_t
 rcl_count_publishers(
   const rcl_node_t * node,
@@ -456,6 +939,261 @@ rcl_count_subscribers(
   return rcl_convert_rmw_ret_to_rcl_ret(rmw_ret);
 }
 
+// One cached topic; generation tags mark which graph generation each count
+// was taken at, a tag of 0 meaning "never taken".
+typedef struct rcl_count_cache_entry_s
+{
+  // Owned copy of the topic name; NULL for empty slots.
+  char * topic_name;
+  // Cached hash of the name, so growth does not rehash the contents.
+  uint64_t hash;
+  uint64_t publisher_generation;
+  uint64_t subscriber_generation;
+  size_t publisher_count;
+  size_t subscriber_count;
+} rcl_count_cache_entry_t;
+
+// Initial number of hash table slots; always a power of two so the probe
+// sequence can mask instead of dividing.
+#define COUNT_CACHE_INITIAL_CAPACITY 32
+
+struct rcl_count_cache_impl_s
+{
+  const rcl_node_t * node;
+  rcl_allocator_t allocator;
+  // Waited on with a zero timeout to detect graph changes.
+  rcl_wait_set_t wait_set;
+  // Bumped whenever the graph guard condition fired; starts at 1 so zeroed
+  // entry tags never match.
+  uint64_t generation;
+  // Open addressing hash table with linear probing, keyed by topic name.
+  rcl_count_cache_entry_t * entries;
+  size_t capacity;
+  size_t count;
+};
+
+static uint64_t
+__count_cache_hash(const char * string)
+{
+  // FNV-1a, like the interning pool uses.
+  uint64_t hash = 0xcbf29ce484222325ULL;
+  for (const char * c = string; '\0' != *c; ++c) {
+    hash ^= (uint64_t)(unsigned char)*c;
+    hash *= 0x100000001b3ULL;
+  }
+  return hash;
+}
+
+// Find the entry for a topic, inserting an unfilled one if it is new; grows
+// the table at 3/4 load.
+static rcl_ret_t
+__count_cache_find_or_insert(
+  rcl_count_cache_impl_t * impl,
+  const char * topic_name,
+  rcl_count_cache_entry_t ** entry)
+{
+  const uint64_t hash = __count_cache_hash(topic_name);
+  size_t index = (size_t)hash & (impl->capacity - 1);
+  while (NULL != impl->entries[index].topic_name) {
+    if (impl->entries[index].hash == hash &&
+      0 == strcmp(impl->entries[index].topic_name, topic_name))
+    {
+      *entry = &impl->entries[index];
+      return RCL_RET_OK;
+    }
+    index = (index + 1) & (impl->capacity - 1);
+  }
+  if (4 * (impl->count + 1) > 3 * impl->capacity) {
+    rcl_count_cache_entry_t * old_entries = impl->entries;
+    const size_t old_capacity = impl->capacity;
+    rcl_count_cache_entry_t * new_entries = impl->allocator.zero_allocate(
+      2 * old_capacity, sizeof(rcl_count_cache_entry_t), impl->allocator.state);
+    if (NULL == new_entries) {
+      RCL_SET_ERROR_MSG("allocating memory failed");
+      return RCL_RET_BAD_ALLOC;
+    }
+    impl->entries = new_entries;
+    impl->capacity = 2 * old_capacity;
+    for (size_t i = 0; i < old_capacity; ++i) {
+      if (NULL == old_entries[i].topic_name) {
+        continue;
+      }
+      size_t new_index = (size_t)old_entries[i].hash & (impl->capacity - 1);
+      while (NULL != impl->entries[new_index].topic_name) {
+        new_index = (new_index + 1) & (impl->capacity - 1);
+      }
+      impl->entries[new_index] = old_entries[i];
+    }
+    impl->allocator.deallocate(old_entries, impl->allocator.state);
+    index = (size_t)hash & (impl->capacity - 1);
+    while (NULL != impl->entries[index].topic_name) {
+      index = (index + 1) & (impl->capacity - 1);
+    }
+  }
+  char * copy = rcutils_strdup(topic_name, impl->allocator);
+  if (NULL == copy) {
+    RCL_SET_ERROR_MSG("allocating memory failed");
+    return RCL_RET_BAD_ALLOC;
+  }
+  impl->entries[index].topic_name = copy;
+  impl->entries[index].hash = hash;
+  impl->entries[index].publisher_generation = 0;
+  impl->entries[index].subscriber_generation = 0;
+  ++impl->count;
+  *entry = &impl->entries[index];
+  return RCL_RET_OK;
+}
+
+rcl_count_cache_t
+rcl_get_zero_initialized_count_cache(void)
+{
+  static rcl_count_cache_t null_cache = {0};
+  return null_cache;
+}
+
+rcl_ret_t
+rcl_count_cache_init(
+  rcl_count_cache_t * cache,
+  const rcl_node_t * node,
+  rcl_allocator_t * allocator)
+{
+  RCL_CHECK_ARGUMENT_FOR_NULL(cache, RCL_RET_INVALID_ARGUMENT);
+  RCL_CHECK_ALLOCATOR_WITH_MSG(allocator, "invalid allocator", return RCL_RET_INVALID_ARGUMENT);
+  if (NULL != cache->impl) {
+    RCL_SET_ERROR_MSG("count cache already initialized, or memory was uninitialized");
+    return RCL_RET_ALREADY_INIT;
+  }
+  if (!rcl_node_is_valid(node)) {
+    return RCL_RET_NODE_INVALID;  // error already set
+  }
+  const rcl_guard_condition_t * graph_guard_condition =
+    rcl_node_get_graph_guard_condition(node);
+  if (NULL == graph_guard_condition) {
+    return RCL_RET_ERROR;  // error already set
+  }
+  rcl_count_cache_impl_t * impl =
+    allocator->allocate(sizeof(rcl_count_cache_impl_t), allocator->state);
+  if (NULL == impl) {
+    RCL_SET_ERROR_MSG("allocating memory failed");
+    return RCL_RET_BAD_ALLOC;
+  }
+  impl->node = node;
+  impl->allocator = *allocator;
+  impl->generation = 1;
+  impl->count = 0;
+  impl->capacity = COUNT_CACHE_INITIAL_CAPACITY;
+  impl->entries = allocator->zero_allocate(
+    impl->capacity, sizeof(rcl_count_cache_entry_t), allocator->state);
+  if (NULL == impl->entries) {
+    allocator->deallocate(impl, allocator->state);
+    RCL_SET_ERROR_MSG("allocating memory failed");
+    return RCL_RET_BAD_ALLOC;
+  }
+  impl->wait_set = rcl_get_zero_initialized_wait_set();
+  rcl_ret_t ret = rcl_wait_set_init(
+    &impl->wait_set, 0, 1, 0, 0, 0, 0, node->context, *allocator);
+  if (RCL_RET_OK != ret) {
+    allocator->deallocate(impl->entries, allocator->state);
+    allocator->deallocate(impl, allocator->state);
+    return ret;  // error already set
+  }
+  ret = rcl_wait_set_add_guard_condition(&impl->wait_set, graph_guard_condition, NULL);
+  if (RCL_RET_OK != ret) {
+    if (RCL_RET_OK != rcl_wait_set_fini(&impl->wait_set)) {
+      RCUTILS_LOG_ERROR_NAMED(
+        ROS_PACKAGE_NAME, "Failed to fini wait set after failing to add guard condition");
+    }
+    allocator->deallocate(impl->entries, allocator->state);
+    allocator->deallocate(impl, allocator->state);
+    return ret;  // error already set
+  }
+  cache->impl = impl;
+  return RCL_RET_OK;
+}
+
+rcl_ret_t
+rcl_count_cache_fini(rcl_count_cache_t * cache)
+{
+  RCL_CHECK_ARGUMENT_FOR_NULL(cache, RCL_RET_INVALID_ARGUMENT);
+  RCL_CHECK_FOR_NULL_WITH_MSG(
+    cache->impl, "count cache is invalid", return RCL_RET_INVALID_ARGUMENT);
+  rcl_count_cache_impl_t * impl = cache->impl;
+  rcl_ret_t ret = rcl_wait_set_fini(&impl->wait_set);
+  rcl_allocator_t allocator = impl->allocator;
+  for (size_t i = 0; i < impl->capacity; ++i) {
+    if (NULL != impl->entries[i].topic_name) {
+      allocator.deallocate(impl->entries[i].topic_name, allocator.state);
+    }
+  }
+  allocator.deallocate(impl->entries, allocator.state);
+  allocator.deallocate(impl, allocator.state);
+  cache->impl = NULL;
+  return ret;
+}
+
+static rcl_ret_t
+__count_cache_count(
+  rcl_count_cache_t * cache,
+  const char * topic_name,
+  bool publishers,
+  size_t * count)
+{
+  RCL_CHECK_ARGUMENT_FOR_NULL(cache, RCL_RET_INVALID_ARGUMENT);
+  RCL_CHECK_FOR_NULL_WITH_MSG(
+    cache->impl, "count cache is invalid", return RCL_RET_INVALID_ARGUMENT);
+  RCL_CHECK_ARGUMENT_FOR_NULL(topic_name, RCL_RET_INVALID_ARGUMENT);
+  RCL_CHECK_ARGUMENT_FOR_NULL(count, RCL_RET_INVALID_ARGUMENT);
+  rcl_count_cache_impl_t * impl = cache->impl;
+  // A zero timeout poll of the graph guard condition decides whether the
+  // cached counts are stale; the common quiescent case stays in memory.
+  rcl_ret_t ret = rcl_wait(&impl->wait_set, 0);
+  if (RCL_RET_OK == ret) {
+    ++impl->generation;
+  } else if (RCL_RET_TIMEOUT != ret) {
+    return ret;  // error already set
+  }
+  rcl_count_cache_entry_t * entry = NULL;
+  ret = __count_cache_find_or_insert(impl, topic_name, &entry);
+  if (RCL_RET_OK != ret) {
+    return ret;  // error already set
+  }
+  uint64_t * generation =
+    publishers ? &entry->publisher_generation : &entry->subscriber_generation;
+  size_t * cached =
+    publishers ? &entry->publisher_count : &entry->subscriber_count;
+  if (impl->generation == *generation) {
+    *count = *cached;
+    return RCL_RET_OK;
+  }
+  ret = publishers ?
+    rcl_count_publishers(impl->node, topic_name, cached) :
+    rcl_count_subscribers(impl->node, topic_name, cached);
+  if (RCL_RET_OK != ret) {
+    return ret;  // error already set
+  }
+  *generation = impl->generation;
+  *count = *cached;
+  return RCL_RET_OK;
+}
+
+rcl_ret_t
+rcl_count_cache_count_publishers(
+  rcl_count_cache_t * cache,
+  const char * topic_name,
+  size_t * count)
+{
+  return __count_cache_count(cache, topic_name, true, count);
+}
+
+rcl_ret_t
+rcl_count_cache_count_subscribers(
+  rcl_count_cache_t * cache,
+  const char * topic_name,
+  size_t * count)
+{
+  return __count_cache_count(cache, topic_name, false, count);
+}
+
 typedef rcl_ret_t (* count_entities_func_t)(
   const rcl_node_t * node,
   const char * topic_name,
@@ -493,7 +1231,9 @@ _rcl_wait_for_entities(
     return RCL_RET_OK;
   }
 
-  // Create a wait set and add the node graph guard condition to it
+  // Create a persistent wait set and register the node graph guard condition
+  // with it once; it stays registered across every wait below, so the loop
+  // does no per-iteration wait set maintenance.
   rcl_wait_set_t wait_set = rcl_get_zero_initialized_wait_set();
   ret = rcl_wait_set_init(
     &wait_set, 0, 1, 0, 0, 0, 0, node->context, *allocator);
@@ -502,6 +1242,12 @@ _rcl_wait_for_entities(
     return ret;
   }
 
+  ret = rcl_wait_set_set_persistent(&wait_set, true);
+  if (ret != RCL_RET_OK) {
+    // Error message already set
+    goto cleanup;
+  }
+
   const rcl_guard_condition_t * guard_condition = rcl_node_get_graph_guard_condition(node);
   if (!guard_condition) {
     // Error message already set
@@ -509,7 +1255,6 @@ _rcl_wait_for_entities(
     goto cleanup;
   }
 
-  // Add it to the wait set
   ret = rcl_wait_set_add_guard_condition(&wait_set, guard_condition, NULL);
   if (ret != RCL_RET_OK) {
     // Error message already set
@@ -539,15 +1284,19 @@ _rcl_wait_for_entities(
       break;
     }
 
-    // Check count
-    ret = count_entities_func(node, topic_name, &count);
-    if (ret != RCL_RET_OK) {
-      // Error already set
-      break;
-    }
-    if (expected_count <= count) {
-      *success = true;
-      break;
+    if (RCL_RET_OK == wait_ret) {
+      // The guard condition fired, so the graph changed since the previous
+      // count; this is the only wake that warrants re-querying the count.
+      // Timeout wakes skip the query, as the count cannot have changed.
+      ret = count_entities_func(node, topic_name, &count);
+      if (ret != RCL_RET_OK) {
+        // Error already set
+        break;
+      }
+      if (expected_count <= count) {
+        *success = true;
+        break;
+      }
     }
 
     // If we're not waiting indefinitely, compute time remaining
@@ -567,13 +1316,8 @@ _rcl_wait_for_entities(
         break;
       }
     }
-
-    // Clear wait set for next iteration
-    ret = rcl_wait_set_clear(&wait_set);
-    if (ret != RCL_RET_OK) {
-      // Error message already set
-      break;
-    }
+    // The wait set is persistent, so the guard condition is still registered
+    // for the next iteration; nothing to clear or re-add.
   }
 
   rcl_ret_t cleanup_ret;
@@ -739,6 +1483,916 @@ rcl_service_server_is_available(
   return rcl_convert_rmw_ret_to_rcl_ret(rmw_ret);
 }
 
+struct rcl_client_availability_cache_impl_s
+{
+  const rcl_node_t * node;
+  const rcl_client_t * client;
+  rcl_allocator_t allocator;
+  // Waited on with a zero timeout to detect graph changes while no server
+  // has been seen yet.
+  rcl_wait_set_t wait_set;
+  // Whether `available` holds a queried answer.
+  bool checked;
+  // The last queried answer; atomic so the fast path is a plain load.
+  atomic_bool available;
+};
+
+rcl_client_availability_cache_t
+rcl_get_zero_initialized_client_availability_cache(void)
+{
+  static rcl_client_availability_cache_t null_cache = {0};
+  return null_cache;
+}
+
+rcl_ret_t
+rcl_client_availability_cache_init(
+  rcl_client_availability_cache_t * cache,
+  const rcl_node_t * node,
+  const rcl_client_t * client,
+  rcl_allocator_t * allocator)
+{
+  RCL_CHECK_ARGUMENT_FOR_NULL(cache, RCL_RET_INVALID_ARGUMENT);
+  RCL_CHECK_ALLOCATOR_WITH_MSG(allocator, "invalid allocator", return RCL_RET_INVALID_ARGUMENT);
+  RCL_CHECK_ARGUMENT_FOR_NULL(client, RCL_RET_INVALID_ARGUMENT);
+  if (NULL != cache->impl) {
+    RCL_SET_ERROR_MSG("availability cache already initialized, or memory was uninitialized");
+    return RCL_RET_ALREADY_INIT;
+  }
+  if (!rcl_node_is_valid(node)) {
+    return RCL_RET_NODE_INVALID;  // error already set
+  }
+  const rcl_guard_condition_t * graph_guard_condition =
+    rcl_node_get_graph_guard_condition(node);
+  if (NULL == graph_guard_condition) {
+    return RCL_RET_ERROR;  // error already set
+  }
+  rcl_client_availability_cache_impl_t * impl =
+    allocator->allocate(sizeof(rcl_client_availability_cache_impl_t), allocator->state);
+  if (NULL == impl) {
+    RCL_SET_ERROR_MSG("allocating memory failed");
+    return RCL_RET_BAD_ALLOC;
+  }
+  impl->node = node;
+  impl->client = client;
+  impl->allocator = *allocator;
+  impl->checked = false;
+  atomic_init(&impl->available, false);
+  impl->wait_set = rcl_get_zero_initialized_wait_set();
+  rcl_ret_t ret = rcl_wait_set_init(
+    &impl->wait_set, 0, 1, 0, 0, 0, 0, node->context, *allocator);
+  if (RCL_RET_OK != ret) {
+    allocator->deallocate(impl, allocator->state);
+    return ret;  // error already set
+  }
+  ret = rcl_wait_set_add_guard_condition(&impl->wait_set, graph_guard_condition, NULL);
+  if (RCL_RET_OK != ret) {
+    if (RCL_RET_OK != rcl_wait_set_fini(&impl->wait_set)) {
+      RCUTILS_LOG_ERROR_NAMED(
+        ROS_PACKAGE_NAME, "Failed to fini wait set after failing to add guard condition");
+    }
+    allocator->deallocate(impl, allocator->state);
+    return ret;  // error already set
+  }
+  cache->impl = impl;
+  return RCL_RET_OK;
+}
+
+rcl_ret_t
+rcl_client_availability_cache_fini(rcl_client_availability_cache_t * cache)
+{
+  RCL_CHECK_ARGUMENT_FOR_NULL(cache, RCL_RET_INVALID_ARGUMENT);
+  RCL_CHECK_FOR_NULL_WITH_MSG(
+    cache->impl, "availability cache is invalid", return RCL_RET_INVALID_ARGUMENT);
+  rcl_client_availability_cache_impl_t * impl = cache->impl;
+  rcl_ret_t ret = rcl_wait_set_fini(&impl->wait_set);
+  rcl_allocator_t allocator = impl->allocator;
+  allocator.deallocate(impl, allocator.state);
+  cache->impl = NULL;
+  return ret;
+}
+
+rcl_ret_t
+rcl_client_availability_cache_is_available(
+  rcl_client_availability_cache_t * cache,
+  bool * is_available)
+{
+  RCL_CHECK_ARGUMENT_FOR_NULL(cache, RCL_RET_INVALID_ARGUMENT);
+  RCL_CHECK_FOR_NULL_WITH_MSG(
+    cache->impl, "availability cache is invalid", return RCL_RET_INVALID_ARGUMENT);
+  RCL_CHECK_ARGUMENT_FOR_NULL(is_available, RCL_RET_INVALID_ARGUMENT);
+  rcl_client_availability_cache_impl_t * impl = cache->impl;
+  // Fast path: once a server has been seen, answer from the flag alone.
+  if (impl->checked && rcutils_atomic_load_bool(&impl->available)) {
+    *is_available = true;
+    return RCL_RET_OK;
+  }
+  // Slow path: re-query only when the graph changed, or nothing was ever
+  // queried; a cached negative stays valid while the graph is quiescent.
+  bool requery = !impl->checked;
+  rcl_ret_t ret = rcl_wait(&impl->wait_set, 0);
+  if (RCL_RET_OK == ret) {
+    requery = true;
+  } else if (RCL_RET_TIMEOUT != ret) {
+    return ret;  // error already set
+  }
+  if (requery) {
+    bool available = false;
+    ret = rcl_service_server_is_available(impl->node, impl->client, &available);
+    if (RCL_RET_OK != ret) {
+      return ret;  // error already set
+    }
+    rcutils_atomic_store(&impl->available, available);
+    impl->checked = true;
+  }
+  *is_available = rcutils_atomic_load_bool(&impl->available);
+  return RCL_RET_OK;
+}
+
+rcl_ret_t
+rcl_client_availability_cache_invalidate(rcl_client_availability_cache_t * cache)
+{
+  RCL_CHECK_ARGUMENT_FOR_NULL(cache, RCL_RET_INVALID_ARGUMENT);
+  RCL_CHECK_FOR_NULL_WITH_MSG(
+    cache->impl, "availability cache is invalid", return RCL_RET_INVALID_ARGUMENT);
+  cache->impl->checked = false;
+  rcutils_atomic_store(&cache->impl->available, false);
+  return RCL_RET_OK;
+}
+
+// A reference counted, immutable graph snapshot.
+typedef struct rcl_graph_cache_snapshot_s
+{
+  // Must stay the first member: rcl_graph_cache_release() recovers the
+  // snapshot from the user facing names and types pointer.
+  rcl_names_and_types_t names_and_types;
+  uint64_t version;
+  rcl_allocator_t allocator;
+  atomic_uint_least64_t reference_count;
+} rcl_graph_cache_snapshot_t;
+
+// How many replaced snapshots the cache keeps around so deltas against
+// slightly stale version tokens can still be computed.
+#define RCL_GRAPH_CACHE_RETAINED_SNAPSHOTS 4
+
+struct rcl_graph_cache_impl_s
+{
+  const rcl_node_t * node;
+  rcl_allocator_t allocator;
+  bool no_demangle;
+  // Waited on with a zero timeout to poll for graph changes.
+  rcl_wait_set_t wait_set;
+  uint64_t next_version;
+  // The current snapshot; the cache holds one reference to it.
+  rcl_graph_cache_snapshot_t * current;
+  // Ring of recently replaced snapshots, each holding one reference.
+  rcl_graph_cache_snapshot_t * retained[RCL_GRAPH_CACHE_RETAINED_SNAPSHOTS];
+  size_t retained_next;
+};
+
+// Drop one reference, deallocating the snapshot when the last one is gone.
+static void
+__graph_cache_snapshot_unref(rcl_graph_cache_snapshot_t * snapshot)
+{
+  if (1 != rcutils_atomic_fetch_add_uint64_t(&snapshot->reference_count, (uint64_t)-1)) {
+    return;
+  }
+  rcl_allocator_t allocator = snapshot->allocator;
+  if (RCL_RET_OK != rcl_names_and_types_fini(&snapshot->names_and_types)) {
+    RCUTILS_LOG_ERROR_NAMED(
+      ROS_PACKAGE_NAME, "Failed to fini names and types of released graph snapshot");
+  }
+  allocator.deallocate(snapshot, allocator.state);
+}
+
+// Poll the graph guard condition with a zero timeout and fetch a fresh
+// snapshot if it fired, or if no snapshot exists yet; the common quiescent
+// case costs no rmw query.
+static rcl_ret_t
+__graph_cache_poll_and_refresh(rcl_graph_cache_impl_t * impl)
+{
+  bool refresh = NULL == impl->current;
+  rcl_ret_t ret = rcl_wait(&impl->wait_set, 0);
+  if (RCL_RET_OK == ret) {
+    refresh = true;
+  } else if (RCL_RET_TIMEOUT != ret) {
+    return ret;  // error already set
+  }
+  if (!refresh) {
+    return RCL_RET_OK;
+  }
+  rcl_graph_cache_snapshot_t * snapshot =
+    impl->allocator.allocate(sizeof(rcl_graph_cache_snapshot_t), impl->allocator.state);
+  if (NULL == snapshot) {
+    RCL_SET_ERROR_MSG("allocating memory failed");
+    return RCL_RET_BAD_ALLOC;
+  }
+  snapshot->names_and_types = rcl_get_zero_initialized_names_and_types();
+  ret = rcl_get_topic_names_and_types(
+    impl->node, &impl->allocator, impl->no_demangle, &snapshot->names_and_types);
+  if (RCL_RET_OK != ret) {
+    impl->allocator.deallocate(snapshot, impl->allocator.state);
+    return ret;  // error already set
+  }
+  snapshot->version = ++impl->next_version;
+  snapshot->allocator = impl->allocator;
+  // One reference for the cache itself.
+  atomic_init(&snapshot->reference_count, 1);
+  if (NULL != impl->current) {
+    // The replaced snapshot moves into the retained ring so deltas against
+    // its version can still be computed; the evicted occupant is released.
+    if (NULL != impl->retained[impl->retained_next]) {
+      __graph_cache_snapshot_unref(impl->retained[impl->retained_next]);
+    }
+    impl->retained[impl->retained_next] = impl->current;
+    impl->retained_next = (impl->retained_next + 1) % RCL_GRAPH_CACHE_RETAINED_SNAPSHOTS;
+  }
+  impl->current = snapshot;
+  return RCL_RET_OK;
+}
+
+rcl_graph_cache_t
+rcl_get_zero_initialized_graph_cache(void)
+{
+  static rcl_graph_cache_t null_cache = {0};
+  return null_cache;
+}
+
+rcl_ret_t
+rcl_graph_cache_init(
+  rcl_graph_cache_t * cache,
+  const rcl_node_t * node,
+  bool no_demangle,
+  rcl_allocator_t * allocator)
+{
+  RCL_CHECK_ARGUMENT_FOR_NULL(cache, RCL_RET_INVALID_ARGUMENT);
+  RCL_CHECK_ALLOCATOR_WITH_MSG(allocator, "invalid allocator", return RCL_RET_INVALID_ARGUMENT);
+  if (NULL != cache->impl) {
+    RCL_SET_ERROR_MSG("graph cache already initialized, or memory was uninitialized");
+    return RCL_RET_ALREADY_INIT;
+  }
+  if (!rcl_node_is_valid(node)) {
+    return RCL_RET_NODE_INVALID;  // error already set
+  }
+  const rcl_guard_condition_t * graph_guard_condition =
+    rcl_node_get_graph_guard_condition(node);
+  if (NULL == graph_guard_condition) {
+    return RCL_RET_ERROR;  // error already set
+  }
+  rcl_graph_cache_impl_t * impl =
+    allocator->allocate(sizeof(rcl_graph_cache_impl_t), allocator->state);
+  if (NULL == impl) {
+    RCL_SET_ERROR_MSG("allocating memory failed");
+    return RCL_RET_BAD_ALLOC;
+  }
+  impl->node = node;
+  impl->allocator = *allocator;
+  impl->no_demangle = no_demangle;
+  impl->next_version = 0;
+  impl->current = NULL;
+  for (size_t i = 0; i < RCL_GRAPH_CACHE_RETAINED_SNAPSHOTS; ++i) {
+    impl->retained[i] = NULL;
+  }
+  impl->retained_next = 0;
+  impl->wait_set = rcl_get_zero_initialized_wait_set();
+  rcl_ret_t ret = rcl_wait_set_init(
+    &impl->wait_set, 0, 1, 0, 0, 0, 0, node->context, *allocator);
+  if (RCL_RET_OK != ret) {
+    allocator->deallocate(impl, allocator->state);
+    return ret;  // error already set
+  }
+  ret = rcl_wait_set_add_guard_condition(&impl->wait_set, graph_guard_condition, NULL);
+  if (RCL_RET_OK != ret) {
+    if (RCL_RET_OK != rcl_wait_set_fini(&impl->wait_set)) {
+      RCUTILS_LOG_ERROR_NAMED(
+        ROS_PACKAGE_NAME, "Failed to fini wait set after failing to add guard condition");
+    }
+    allocator->deallocate(impl, allocator->state);
+    return ret;  // error already set
+  }
+  cache->impl = impl;
+  return RCL_RET_OK;
+}
+
+rcl_ret_t
+rcl_graph_cache_fini(rcl_graph_cache_t * cache)
+{
+  RCL_CHECK_ARGUMENT_FOR_NULL(cache, RCL_RET_INVALID_ARGUMENT);
+  RCL_CHECK_FOR_NULL_WITH_MSG(
+    cache->impl, "graph cache is invalid", return RCL_RET_INVALID_ARGUMENT);
+  rcl_graph_cache_impl_t * impl = cache->impl;
+  rcl_ret_t ret = rcl_wait_set_fini(&impl->wait_set);
+  if (NULL != impl->current) {
+    __graph_cache_snapshot_unref(impl->current);
+  }
+  for (size_t i = 0; i < RCL_GRAPH_CACHE_RETAINED_SNAPSHOTS; ++i) {
+    if (NULL != impl->retained[i]) {
+      __graph_cache_snapshot_unref(impl->retained[i]);
+    }
+  }
+  rcl_allocator_t allocator = impl->allocator;
+  allocator.deallocate(impl, allocator.state);
+  cache->impl = NULL;
+  return ret;
+}
+
+rcl_ret_t
+rcl_graph_cache_get_topic_names_and_types(
+  rcl_graph_cache_t * cache,
+  const rcl_names_and_types_t ** names_and_types,
+  uint64_t * version)
+{
+  RCL_CHECK_ARGUMENT_FOR_NULL(cache, RCL_RET_INVALID_ARGUMENT);
+  RCL_CHECK_FOR_NULL_WITH_MSG(
+    cache->impl, "graph cache is invalid", return RCL_RET_INVALID_ARGUMENT);
+  RCL_CHECK_ARGUMENT_FOR_NULL(names_and_types, RCL_RET_INVALID_ARGUMENT);
+  rcl_graph_cache_impl_t * impl = cache->impl;
+  rcl_ret_t ret = __graph_cache_poll_and_refresh(impl);
+  if (RCL_RET_OK != ret) {
+    return ret;  // error already set
+  }
+  rcutils_atomic_fetch_add_uint64_t(&impl->current->reference_count, 1);
+  *names_and_types = &impl->current->names_and_types;
+  if (NULL != version) {
+    *version = impl->current->version;
+  }
+  return RCL_RET_OK;
+}
+
+rcl_ret_t
+rcl_graph_cache_release(const rcl_names_and_types_t ** names_and_types)
+{
+  RCL_CHECK_ARGUMENT_FOR_NULL(names_and_types, RCL_RET_INVALID_ARGUMENT);
+  RCL_CHECK_ARGUMENT_FOR_NULL(*names_and_types, RCL_RET_INVALID_ARGUMENT);
+  rcl_graph_cache_snapshot_t * snapshot =
+    (rcl_graph_cache_snapshot_t *)(void *)(*names_and_types);
+  *names_and_types = NULL;
+  __graph_cache_snapshot_unref(snapshot);
+  return RCL_RET_OK;
+}
+
+// One topic of a snapshot, sortable by name for the delta merge walk.
+typedef struct rcl_graph_diff_entry_s
+{
+  const char * name;
+  size_t index;
+} rcl_graph_diff_entry_t;
+
+static int
+__graph_diff_entry_cmp(const void * lhs, const void * rhs)
+{
+  return strcmp(
+    ((const rcl_graph_diff_entry_t *)lhs)->name,
+    ((const rcl_graph_diff_entry_t *)rhs)->name);
+}
+
+// Whether two topics carry the same set of types, in any order.
+static bool
+__graph_topic_types_equal(
+  const rcutils_string_array_t * lhs, const rcutils_string_array_t * rhs)
+{
+  if (lhs->size != rhs->size) {
+    return false;
+  }
+  // Type sets per topic are tiny, almost always a single entry.
+  for (size_t i = 0; i < lhs->size; ++i) {
+    bool found = false;
+    for (size_t j = 0; j < rhs->size; ++j) {
+      if (0 == strcmp(lhs->data[i], rhs->data[j])) {
+        found = true;
+        break;
+      }
+    }
+    if (!found) {
+      return false;
+    }
+  }
+  return true;
+}
+
+// Build a sorted entry array over a snapshot; *entries is NULL for an empty
+// snapshot.
+static rcl_ret_t
+__graph_diff_sort(
+  const rcl_names_and_types_t * names_and_types,
+  rcl_allocator_t * allocator,
+  rcl_graph_diff_entry_t ** entries)
+{
+  *entries = NULL;
+  if (NULL == names_and_types || 0 == names_and_types->names.size) {
+    return RCL_RET_OK;
+  }
+  rcl_graph_diff_entry_t * sorted = allocator->allocate(
+    names_and_types->names.size * sizeof(rcl_graph_diff_entry_t), allocator->state);
+  if (NULL == sorted) {
+    RCL_SET_ERROR_MSG("allocating memory failed");
+    return RCL_RET_BAD_ALLOC;
+  }
+  for (size_t i = 0; i < names_and_types->names.size; ++i) {
+    sorted[i].name = names_and_types->names.data[i];
+    sorted[i].index = i;
+  }
+  qsort(
+    sorted, names_and_types->names.size, sizeof(rcl_graph_diff_entry_t),
+    __graph_diff_entry_cmp);
+  *entries = sorted;
+  return RCL_RET_OK;
+}
+
+// Deep copy the selected topics of a snapshot into an output set.
+static rcl_ret_t
+__graph_diff_copy_entries(
+  const rcl_names_and_types_t * source,
+  const size_t * indices,
+  size_t count,
+  rcl_allocator_t * allocator,
+  rcl_names_and_types_t * destination)
+{
+  if (0 == count) {
+    // An empty set stays zero initialized, which fini accepts.
+    return RCL_RET_OK;
+  }
+  rcl_ret_t ret = rcl_names_and_types_init(destination, count, allocator);
+  if (RCL_RET_OK != ret) {
+    return ret;  // error already set
+  }
+  for (size_t i = 0; i < count; ++i) {
+    const size_t index = indices[i];
+    destination->names.data[i] =
+      rcutils_strdup(source->names.data[index], *allocator);
+    if (NULL == destination->names.data[i]) {
+      RCL_SET_ERROR_MSG("allocating memory failed");
+      return RCL_RET_BAD_ALLOC;
+    }
+    rcutils_ret_t rcutils_ret = rcutils_string_array_init(
+      &destination->types[i], source->types[index].size, allocator);
+    if (RCUTILS_RET_OK != rcutils_ret) {
+      RCL_SET_ERROR_MSG(rcutils_get_error_string().str);
+      return rcl_convert_rcutils_ret_to_rcl_ret(rcutils_ret);
+    }
+    for (size_t j = 0; j < source->types[index].size; ++j) {
+      destination->types[i].data[j] =
+        rcutils_strdup(source->types[index].data[j], *allocator);
+      if (NULL == destination->types[i].data[j]) {
+        RCL_SET_ERROR_MSG("allocating memory failed");
+        return RCL_RET_BAD_ALLOC;
+      }
+    }
+  }
+  return RCL_RET_OK;
+}
+
+rcl_graph_changes_t
+rcl_get_zero_initialized_graph_changes(void)
+{
+  static rcl_graph_changes_t null_changes = {0};
+  return null_changes;
+}
+
+rcl_ret_t
+rcl_graph_cache_get_changes(
+  rcl_graph_cache_t * cache,
+  uint64_t since_version,
+  rcl_graph_changes_t * changes)
+{
+  RCL_CHECK_ARGUMENT_FOR_NULL(cache, RCL_RET_INVALID_ARGUMENT);
+  RCL_CHECK_FOR_NULL_WITH_MSG(
+    cache->impl, "graph cache is invalid", return RCL_RET_INVALID_ARGUMENT);
+  RCL_CHECK_ARGUMENT_FOR_NULL(changes, RCL_RET_INVALID_ARGUMENT);
+  rmw_ret_t rmw_ret = rmw_names_and_types_check_zero(&changes->appeared);
+  if (RMW_RET_OK == rmw_ret) {
+    rmw_ret = rmw_names_and_types_check_zero(&changes->disappeared);
+  }
+  if (RMW_RET_OK != rmw_ret) {
+    return rcl_convert_rmw_ret_to_rcl_ret(rmw_ret);
+  }
+  rcl_graph_cache_impl_t * impl = cache->impl;
+  rcl_ret_t ret = __graph_cache_poll_and_refresh(impl);
+  if (RCL_RET_OK != ret) {
+    return ret;  // error already set
+  }
+  const rcl_names_and_types_t * current = &impl->current->names_and_types;
+  // Resolve the caller's version token; 0 means "no prior snapshot".
+  const rcl_names_and_types_t * base = NULL;
+  if (0 != since_version) {
+    if (since_version == impl->current->version) {
+      base = current;
+    } else {
+      for (size_t i = 0; i < RCL_GRAPH_CACHE_RETAINED_SNAPSHOTS; ++i) {
+        if (NULL != impl->retained[i] && since_version == impl->retained[i]->version) {
+          base = &impl->retained[i]->names_and_types;
+          break;
+        }
+      }
+    }
+    if (NULL == base) {
+      RCL_SET_ERROR_MSG(
+        "graph cache no longer retains the given version, pass 0 to resynchronize");
+      return RCL_RET_INVALID_ARGUMENT;
+    }
+  }
+  // Sort both snapshots by name, then merge walk them collecting the indices
+  // that only occur on one side; a topic whose type set changed is collected
+  // on both sides.
+  rcl_graph_diff_entry_t * base_sorted = NULL;
+  rcl_graph_diff_entry_t * current_sorted = NULL;
+  size_t * disappeared_indices = NULL;
+  size_t * appeared_indices = NULL;
+  const size_t base_size = NULL != base ? base->names.size : 0;
+  ret = __graph_diff_sort(base, &impl->allocator, &base_sorted);
+  if (RCL_RET_OK != ret) {
+    goto cleanup;
+  }
+  ret = __graph_diff_sort(current, &impl->allocator, &current_sorted);
+  if (RCL_RET_OK != ret) {
+    goto cleanup;
+  }
+  size_t num_disappeared = 0;
+  size_t num_appeared = 0;
+  if (base_size > 0) {
+    disappeared_indices =
+      impl->allocator.allocate(base_size * sizeof(size_t), impl->allocator.state);
+    if (NULL == disappeared_indices) {
+      RCL_SET_ERROR_MSG("allocating memory failed");
+      ret = RCL_RET_BAD_ALLOC;
+      goto cleanup;
+    }
+  }
+  if (current->names.size > 0) {
+    appeared_indices = impl->allocator.allocate(
+      current->names.size * sizeof(size_t), impl->allocator.state);
+    if (NULL == appeared_indices) {
+      RCL_SET_ERROR_MSG("allocating memory failed");
+      ret = RCL_RET_BAD_ALLOC;
+      goto cleanup;
+    }
+  }
+  size_t base_i = 0;
+  size_t current_i = 0;
+  while (base_i < base_size || current_i < current->names.size) {
+    int order;
+    if (base_i >= base_size) {
+      order = 1;
+    } else if (current_i >= current->names.size) {
+      order = -1;
+    } else {
+      order = strcmp(base_sorted[base_i].name, current_sorted[current_i].name);
+    }
+    if (order < 0) {
+      disappeared_indices[num_disappeared++] = base_sorted[base_i++].index;
+    } else if (order > 0) {
+      appeared_indices[num_appeared++] = current_sorted[current_i++].index;
+    } else {
+      if (!__graph_topic_types_equal(
+          &base->types[base_sorted[base_i].index],
+          &current->types[current_sorted[current_i].index]))
+      {
+        disappeared_indices[num_disappeared++] = base_sorted[base_i].index;
+        appeared_indices[num_appeared++] = current_sorted[current_i].index;
+      }
+      ++base_i;
+      ++current_i;
+    }
+  }
+  ret = __graph_diff_copy_entries(
+    base, disappeared_indices, num_disappeared, &impl->allocator, &changes->disappeared);
+  if (RCL_RET_OK != ret) {
+    goto cleanup;
+  }
+  ret = __graph_diff_copy_entries(
+    current, appeared_indices, num_appeared, &impl->allocator, &changes->appeared);
+  if (RCL_RET_OK != ret) {
+    goto cleanup;
+  }
+  changes->version = impl->current->version;
+cleanup:
+  if (NULL != base_sorted) {
+    impl->allocator.deallocate(base_sorted, impl->allocator.state);
+  }
+  if (NULL != current_sorted) {
+    impl->allocator.deallocate(current_sorted, impl->allocator.state);
+  }
+  if (NULL != disappeared_indices) {
+    impl->allocator.deallocate(disappeared_indices, impl->allocator.state);
+  }
+  if (NULL != appeared_indices) {
+    impl->allocator.deallocate(appeared_indices, impl->allocator.state);
+  }
+  if (RCL_RET_OK != ret) {
+    if (RCL_RET_OK != rcl_graph_changes_fini(changes)) {
+      RCUTILS_LOG_ERROR_NAMED(
+        ROS_PACKAGE_NAME, "Failed to fini partially built graph changes");
+    }
+  }
+  return ret;
+}
+
+rcl_ret_t
+rcl_graph_changes_fini(rcl_graph_changes_t * changes)
+{
+  RCL_CHECK_ARGUMENT_FOR_NULL(changes, RCL_RET_INVALID_ARGUMENT);
+  rcl_ret_t ret = RCL_RET_OK;
+  if (NULL != changes->appeared.names.data || 0 != changes->appeared.names.size) {
+    ret = rcl_names_and_types_fini(&changes->appeared);
+  }
+  if (NULL != changes->disappeared.names.data || 0 != changes->disappeared.names.size) {
+    rcl_ret_t fini_ret = rcl_names_and_types_fini(&changes->disappeared);
+    if (RCL_RET_OK == ret) {
+      ret = fini_ret;
+    }
+  }
+  changes->version = 0;
+  return ret;
+}
+
+struct rcl_graph_debounce_impl_s
+{
+  rcl_graph_cache_t * cache;
+  rcl_allocator_t allocator;
+  // Waited on with a zero timeout to observe raw graph guard condition
+  // firings without re-querying the graph.
+  rcl_wait_set_t wait_set;
+  // Triggered once per delivered delta; what monitors wait on.
+  rcl_guard_condition_t guard_condition;
+  uint64_t window_ns;
+  // Version token of the last delivered snapshot; 0 until first delivery.
+  uint64_t delivered_version;
+  // A firing opens the window; it closes when window_ns elapsed, however
+  // many further firings it absorbed.
+  bool window_open;
+  rcutils_time_point_value_t window_start;
+};
+
+rcl_graph_debounce_t
+rcl_get_zero_initialized_graph_debounce(void)
+{
+  static rcl_graph_debounce_t null_debounce = {0};
+  return null_debounce;
+}
+
+rcl_ret_t
+rcl_graph_debounce_init(
+  rcl_graph_debounce_t * debounce,
+  const rcl_node_t * node,
+  rcl_graph_cache_t * cache,
+  uint64_t window_ns,
+  rcl_allocator_t * allocator)
+{
+  RCL_CHECK_ARGUMENT_FOR_NULL(debounce, RCL_RET_INVALID_ARGUMENT);
+  RCL_CHECK_ALLOCATOR_WITH_MSG(allocator, "invalid allocator", return RCL_RET_INVALID_ARGUMENT);
+  if (NULL != debounce->impl) {
+    RCL_SET_ERROR_MSG("graph debounce already initialized, or memory was uninitialized");
+    return RCL_RET_ALREADY_INIT;
+  }
+  RCL_CHECK_ARGUMENT_FOR_NULL(cache, RCL_RET_INVALID_ARGUMENT);
+  RCL_CHECK_FOR_NULL_WITH_MSG(
+    cache->impl, "graph cache is invalid", return RCL_RET_INVALID_ARGUMENT);
+  if (!rcl_node_is_valid(node)) {
+    return RCL_RET_NODE_INVALID;  // error already set
+  }
+  const rcl_guard_condition_t * graph_guard_condition =
+    rcl_node_get_graph_guard_condition(node);
+  if (NULL == graph_guard_condition) {
+    return RCL_RET_ERROR;  // error already set
+  }
+  rcl_graph_debounce_impl_t * impl =
+    allocator->allocate(sizeof(rcl_graph_debounce_impl_t), allocator->state);
+  if (NULL == impl) {
+    RCL_SET_ERROR_MSG("allocating memory failed");
+    return RCL_RET_BAD_ALLOC;
+  }
+  impl->cache = cache;
+  impl->allocator = *allocator;
+  impl->window_ns = window_ns;
+  impl->delivered_version = 0;
+  impl->window_open = false;
+  impl->window_start = 0;
+  impl->wait_set = rcl_get_zero_initialized_wait_set();
+  rcl_ret_t ret = rcl_wait_set_init(
+    &impl->wait_set, 0, 1, 0, 0, 0, 0, node->context, *allocator);
+  if (RCL_RET_OK != ret) {
+    allocator->deallocate(impl, allocator->state);
+    return ret;  // error already set
+  }
+  ret = rcl_wait_set_add_guard_condition(&impl->wait_set, graph_guard_condition, NULL);
+  if (RCL_RET_OK != ret) {
+    goto fail_wait_set;
+  }
+  impl->guard_condition = rcl_get_zero_initialized_guard_condition();
+  rcl_guard_condition_options_t guard_condition_options =
+    rcl_guard_condition_get_default_options();
+  guard_condition_options.allocator = *allocator;
+  ret = rcl_guard_condition_init(
+    &impl->guard_condition, node->context, guard_condition_options);
+  if (RCL_RET_OK != ret) {
+    goto fail_wait_set;
+  }
+  debounce->impl = impl;
+  return RCL_RET_OK;
+fail_wait_set:
+  if (RCL_RET_OK != rcl_wait_set_fini(&impl->wait_set)) {
+    RCUTILS_LOG_ERROR_NAMED(
+      ROS_PACKAGE_NAME, "Failed to fini wait set after failing to init graph debounce");
+  }
+  allocator->deallocate(impl, allocator->state);
+  return ret;  // error already set
+}
+
+rcl_ret_t
+rcl_graph_debounce_fini(rcl_graph_debounce_t * debounce)
+{
+  RCL_CHECK_ARGUMENT_FOR_NULL(debounce, RCL_RET_INVALID_ARGUMENT);
+  RCL_CHECK_FOR_NULL_WITH_MSG(
+    debounce->impl, "graph debounce is invalid", return RCL_RET_INVALID_ARGUMENT);
+  rcl_graph_debounce_impl_t * impl = debounce->impl;
+  rcl_ret_t ret = rcl_wait_set_fini(&impl->wait_set);
+  rcl_ret_t gc_ret = rcl_guard_condition_fini(&impl->guard_condition);
+  if (RCL_RET_OK == ret) {
+    ret = gc_ret;
+  }
+  rcl_allocator_t allocator = impl->allocator;
+  allocator.deallocate(impl, allocator.state);
+  debounce->impl = NULL;
+  return ret;
+}
+
+rcl_ret_t
+rcl_graph_debounce_poll(
+  rcl_graph_debounce_t * debounce,
+  rcl_graph_changes_t * changes,
+  bool * delivered)
+{
+  RCL_CHECK_ARGUMENT_FOR_NULL(debounce, RCL_RET_INVALID_ARGUMENT);
+  RCL_CHECK_FOR_NULL_WITH_MSG(
+    debounce->impl, "graph debounce is invalid", return RCL_RET_INVALID_ARGUMENT);
+  RCL_CHECK_ARGUMENT_FOR_NULL(changes, RCL_RET_INVALID_ARGUMENT);
+  RCL_CHECK_ARGUMENT_FOR_NULL(delivered, RCL_RET_INVALID_ARGUMENT);
+  *delivered = false;
+  rcl_graph_debounce_impl_t * impl = debounce->impl;
+  // A zero timeout poll of the raw graph guard condition; only the first
+  // firing matters, later ones land inside the already open window.
+  rcl_ret_t ret = rcl_wait(&impl->wait_set, 0);
+  if (RCL_RET_OK == ret) {
+    if (!impl->window_open) {
+      if (RCUTILS_RET_OK != rcutils_steady_time_now(&impl->window_start)) {
+        RCL_SET_ERROR_MSG(rcutils_get_error_string().str);
+        return RCL_RET_ERROR;
+      }
+      impl->window_open = true;
+    }
+  } else if (RCL_RET_TIMEOUT != ret) {
+    return ret;  // error already set
+  }
+  if (!impl->window_open) {
+    return RCL_RET_OK;
+  }
+  rcutils_time_point_value_t now;
+  if (RCUTILS_RET_OK != rcutils_steady_time_now(&now)) {
+    RCL_SET_ERROR_MSG(rcutils_get_error_string().str);
+    return RCL_RET_ERROR;
+  }
+  if ((uint64_t)(now - impl->window_start) < impl->window_ns) {
+    return RCL_RET_OK;
+  }
+  ret = rcl_graph_cache_get_changes(impl->cache, impl->delivered_version, changes);
+  if (RCL_RET_OK != ret) {
+    return ret;  // error already set
+  }
+  impl->window_open = false;
+  impl->delivered_version = changes->version;
+  ret = rcl_trigger_guard_condition(&impl->guard_condition);
+  if (RCL_RET_OK != ret) {
+    return ret;  // error already set
+  }
+  *delivered = true;
+  return RCL_RET_OK;
+}
+
+const rcl_guard_condition_t *
+rcl_graph_debounce_get_guard_condition(const rcl_graph_debounce_t * debounce)
+{
+  if (NULL == debounce || NULL == debounce->impl) {
+    return NULL;
+  }
+  return &debounce->impl->guard_condition;
+}
+
+rcl_interned_names_and_types_t
+rcl_get_zero_initialized_interned_names_and_types(void)
+{
+  static rcl_interned_names_and_types_t null_names_and_types = {0};
+  return null_names_and_types;
+}
+
+rcl_ret_t
+rcl_interned_names_and_types_fini(
+  rcl_interned_names_and_types_t * names_and_types)
+{
+  RCL_CHECK_ARGUMENT_FOR_NULL(names_and_types, RCL_RET_INVALID_ARGUMENT);
+  if (NULL == names_and_types->names && NULL == names_and_types->types &&
+    NULL == names_and_types->types_sizes)
+  {
+    return RCL_RET_OK;
+  }
+  rcl_allocator_t allocator = names_and_types->allocator;
+  // Partially built views can lack some of the arrays.
+  if (NULL != names_and_types->types) {
+    for (size_t i = 0; i < names_and_types->size; ++i) {
+      if (NULL != names_and_types->types[i]) {
+        allocator.deallocate(names_and_types->types[i], allocator.state);
+      }
+    }
+    allocator.deallocate(names_and_types->types, allocator.state);
+  }
+  if (NULL != names_and_types->types_sizes) {
+    allocator.deallocate(names_and_types->types_sizes, allocator.state);
+  }
+  if (NULL != names_and_types->names) {
+    allocator.deallocate(names_and_types->names, allocator.state);
+  }
+  *names_and_types = rcl_get_zero_initialized_interned_names_and_types();
+  return RCL_RET_OK;
+}
+
+rcl_ret_t
+rcl_get_topic_names_and_types_interned(
+  const rcl_node_t * node,
+  rcl_intern_pool_t * pool,
+  rcl_allocator_t * allocator,
+  bool no_demangle,
+  rcl_interned_names_and_types_t * topic_names_and_types)
+{
+  RCL_CHECK_ARGUMENT_FOR_NULL(pool, RCL_RET_INVALID_ARGUMENT);
+  RCL_CHECK_ALLOCATOR_WITH_MSG(allocator, "invalid allocator", return RCL_RET_INVALID_ARGUMENT);
+  RCL_CHECK_ARGUMENT_FOR_NULL(topic_names_and_types, RCL_RET_INVALID_ARGUMENT);
+  if (NULL != topic_names_and_types->names) {
+    RCL_SET_ERROR_MSG("topic_names_and_types is not zero initialized");
+    return RCL_RET_INVALID_ARGUMENT;
+  }
+  rcl_names_and_types_t source = rcl_get_zero_initialized_names_and_types();
+  rcl_ret_t ret =
+    rcl_get_topic_names_and_types(node, allocator, no_demangle, &source);
+  if (RCL_RET_OK != ret) {
+    return ret;  // error already set
+  }
+  rcl_interned_names_and_types_t result =
+    rcl_get_zero_initialized_interned_names_and_types();
+  result.allocator = *allocator;
+  result.size = source.names.size;
+  if (result.size > 0) {
+    result.names = allocator->zero_allocate(
+      result.size, sizeof(const char *), allocator->state);
+    result.types = allocator->zero_allocate(
+      result.size, sizeof(const char **), allocator->state);
+    result.types_sizes = allocator->zero_allocate(
+      result.size, sizeof(size_t), allocator->state);
+    if (NULL == result.names || NULL == result.types || NULL == result.types_sizes) {
+      RCL_SET_ERROR_MSG("allocating memory failed");
+      ret = RCL_RET_BAD_ALLOC;
+      goto fail;
+    }
+    for (size_t i = 0; i < result.size; ++i) {
+      ret = rcl_intern_pool_intern(pool, source.names.data[i], &result.names[i]);
+      if (RCL_RET_OK != ret) {
+        goto fail;  // error already set
+      }
+      result.types_sizes[i] = source.types[i].size;
+      if (0 == source.types[i].size) {
+        continue;
+      }
+      result.types[i] = allocator->zero_allocate(
+        source.types[i].size, sizeof(const char *), allocator->state);
+      if (NULL == result.types[i]) {
+        RCL_SET_ERROR_MSG("allocating memory failed");
+        ret = RCL_RET_BAD_ALLOC;
+        goto fail;
+      }
+      for (size_t j = 0; j < source.types[i].size; ++j) {
+        ret = rcl_intern_pool_intern(pool, source.types[i].data[j], &result.types[i][j]);
+        if (RCL_RET_OK != ret) {
+          goto fail;  // error already set
+        }
+      }
+    }
+  }
+  if (RCL_RET_OK != rcl_names_and_types_fini(&source)) {
+    RCUTILS_LOG_ERROR_NAMED(
+      ROS_PACKAGE_NAME, "Failed to fini temporary names and types");
+  }
+  *topic_names_and_types = result;
+  return RCL_RET_OK;
+
+fail:
+  if (RCL_RET_OK != rcl_interned_names_and_types_fini(&result)) {
+    RCUTILS_LOG_ERROR_NAMED(
+      ROS_PACKAGE_NAME, "Failed to fini partial interned names and types");
+  }
+  if (RCL_RET_OK != rcl_names_and_types_fini(&source)) {
+    RCUTILS_LOG_ERROR_NAMED(
+      ROS_PACKAGE_NAME, "Failed to fini temporary names and types");
+  }
+  return ret;
+}
+
 #ifdef __cplusplus
 }
 #endif
@@ -19,20 +19,37 @@ extern "C"
 
 #include "rcl/guard_condition.h"
 
+#include <assert.h>
+#include <stddef.h>
+
 #include "rcl/error_handling.h"
 #include "rcl/rcl.h"
+#include "rcutils/stdatomic_helper.h"
 #include "rmw/error_handling.h"
 #include "rmw/rmw.h"
 
 #include "./context_impl.h"
 
+// Cold configuration first; the pending counter hammered by trigger threads
+// lives on its own cache line so it does not bounce the line holding the
+// rmw handle the waiting thread dereferences.
 struct rcl_guard_condition_impl_s
 {
   rmw_guard_condition_t * rmw_handle;
   bool allocated_rmw_guard_condition;
   rcl_guard_condition_options_t options;
+
+  // --- hot mutable state, cache-line separated from the fields above ---
+  // Triggers recorded by rcl_trigger_guard_condition_coalesced() since the
+  // consumer last drained them; only the 0 -> 1 transition reaches rmw.
+  RCL_ALIGNAS(RCL_CACHE_LINE_SIZE) atomic_uint_least64_t pending_count;
 };
 
+// Pin the layout so a refactor cannot silently reintroduce false sharing.
+static_assert(
+  offsetof(struct rcl_guard_condition_impl_s, pending_count) % RCL_CACHE_LINE_SIZE == 0,
+  "guard condition pending counter must start on a cache line boundary");
+
 rcl_guard_condition_t
 rcl_get_zero_initialized_guard_condition()
 {
@@ -82,7 +99,15 @@ __rcl_guard_condition_init_from_rmw_impl(
     guard_condition->impl->rmw_handle = (rmw_guard_condition_t *)rmw_guard_condition;
     guard_condition->impl->allocated_rmw_guard_condition = false;
   } else {
-    // Otherwise create one.
+    // Otherwise create one, making sure the rmw context exists in case its
+    // creation was deferred during init.
+    rcl_ret_t ret = rcl_context_ensure_rmw_context(context);
+    if (RCL_RET_OK != ret) {
+      // Deallocate impl and exit.
+      allocator->deallocate(guard_condition->impl, allocator->state);
+      guard_condition->impl = NULL;
+      return ret;  // error already set
+    }
     guard_condition->impl->rmw_handle = rmw_create_guard_condition(&(context->impl->rmw_context));
     if (!guard_condition->impl->rmw_handle) {
       // Deallocate impl and exit.
@@ -95,6 +120,7 @@ __rcl_guard_condition_init_from_rmw_impl(
   }
   // Copy options into impl.
   guard_condition->impl->options = options;
+  atomic_init(&guard_condition->impl->pending_count, 0);
   return RCL_RET_OK;
 }
 
@@ -164,6 +190,41 @@ rcl_trigger_guard_condition(rcl_guard_condition_t * guard_condition)
   return RCL_RET_OK;
 }
 
+rcl_ret_t
+rcl_trigger_guard_condition_coalesced(rcl_guard_condition_t * guard_condition)
+{
+  const rcl_guard_condition_options_t * options = rcl_guard_condition_get_options(guard_condition);
+  if (!options) {
+    return RCL_RET_INVALID_ARGUMENT;  // error already set
+  }
+  // Only the first trigger after a drain needs to wake the consumer; while
+  // the count is non-zero the consumer is either awake or already signaled.
+  uint64_t previous =
+    rcutils_atomic_fetch_add_uint64_t(&guard_condition->impl->pending_count, 1);
+  if (0u != previous) {
+    return RCL_RET_OK;
+  }
+  if (rmw_trigger_guard_condition(guard_condition->impl->rmw_handle) != RMW_RET_OK) {
+    RCL_SET_ERROR_MSG(rmw_get_error_string().str);
+    return RCL_RET_ERROR;
+  }
+  return RCL_RET_OK;
+}
+
+rcl_ret_t
+rcl_guard_condition_take_pending(
+  const rcl_guard_condition_t * guard_condition,
+  uint64_t * pending_count)
+{
+  const rcl_guard_condition_options_t * options = rcl_guard_condition_get_options(guard_condition);
+  if (!options) {
+    return RCL_RET_INVALID_ARGUMENT;  // error already set
+  }
+  RCL_CHECK_ARGUMENT_FOR_NULL(pending_count, RCL_RET_INVALID_ARGUMENT);
+  rcutils_atomic_exchange(&guard_condition->impl->pending_count, *pending_count, 0);
+  return RCL_RET_OK;
+}
+
 const rcl_guard_condition_options_t *
 rcl_guard_condition_get_options(const rcl_guard_condition_t * guard_condition)
 {
@@ -0,0 +1,162 @@
+// Copyright 2026 Open Source Robotics Foundation, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+#include "rcl/hop_latency.h"
+
+#include <string.h>
+
+#include "rcl/error_handling.h"
+#include "rcl/publisher.h"
+
+#include "rcutils/stdatomic_helper.h"
+#include "rcutils/time.h"
+
+#include "./publisher_impl.h"
+
+/// Hop-latency counters, allocated per publisher on demand.
+struct rcl_hop_record_s
+{
+  atomic_uint_least64_t bucket_counts[RCL_HOP_HISTOGRAM_BUCKETS];
+  atomic_uint_least64_t sample_count;
+  atomic_uint_least64_t total_latency_ns;
+  atomic_uint_least64_t max_latency_ns;
+};
+
+rcl_hop_context_t
+rcl_get_zero_initialized_hop_context(void)
+{
+  static rcl_hop_context_t null_context = {0};
+  return null_context;
+}
+
+rcl_ret_t
+rcl_hop_context_from_message_info(
+  const rmw_message_info_t * message_info,
+  rcl_hop_context_t * context)
+{
+  RCL_CHECK_ARGUMENT_FOR_NULL(message_info, RCL_RET_INVALID_ARGUMENT);
+  RCL_CHECK_ARGUMENT_FOR_NULL(context, RCL_RET_INVALID_ARGUMENT);
+  context->received_timestamp = message_info->received_timestamp;
+  context->source_timestamp = message_info->source_timestamp;
+  context->publisher_gid = message_info->publisher_gid;
+  if (0 == context->received_timestamp) {
+    // Some middlewares do not stamp receives; the context is built right
+    // after the take, so "now" is the closest available approximation.
+    if (RCUTILS_RET_OK != rcutils_system_time_now(&context->received_timestamp)) {
+      RCL_SET_ERROR_MSG(rcutils_get_error_string().str);
+      return RCL_RET_ERROR;
+    }
+  }
+  return RCL_RET_OK;
+}
+
+rcl_ret_t
+rcl_publisher_enable_hop_accounting(rcl_publisher_t * publisher)
+{
+  if (!rcl_publisher_is_valid(publisher)) {
+    return RCL_RET_PUBLISHER_INVALID;  // error already set
+  }
+  if (NULL != publisher->impl->hop_record) {
+    return RCL_RET_OK;
+  }
+  rcl_allocator_t * allocator = &publisher->impl->options.allocator;
+  struct rcl_hop_record_s * record =
+    allocator->allocate(sizeof(struct rcl_hop_record_s), allocator->state);
+  RCL_CHECK_FOR_NULL_WITH_MSG(
+    record, "allocating memory failed", return RCL_RET_BAD_ALLOC);
+  for (size_t i = 0; i < RCL_HOP_HISTOGRAM_BUCKETS; ++i) {
+    atomic_init(&record->bucket_counts[i], 0);
+  }
+  atomic_init(&record->sample_count, 0);
+  atomic_init(&record->total_latency_ns, 0);
+  atomic_init(&record->max_latency_ns, 0);
+  publisher->impl->hop_record = record;
+  return RCL_RET_OK;
+}
+
+rcl_ret_t
+rcl_publisher_record_hop(
+  const rcl_publisher_t * publisher,
+  const rcl_hop_context_t * context)
+{
+  if (!rcl_publisher_is_valid(publisher)) {
+    return RCL_RET_PUBLISHER_INVALID;  // error already set
+  }
+  RCL_CHECK_ARGUMENT_FOR_NULL(context, RCL_RET_INVALID_ARGUMENT);
+  struct rcl_hop_record_s * record = publisher->impl->hop_record;
+  if (NULL == record) {
+    return RCL_RET_OK;
+  }
+  rcutils_time_point_value_t now;
+  if (RCUTILS_RET_OK != rcutils_system_time_now(&now)) {
+    RCL_SET_ERROR_MSG(rcutils_get_error_string().str);
+    return RCL_RET_ERROR;
+  }
+  // Clock skew between hosts can make the difference negative; those
+  // samples land in bucket 0 rather than being dropped, so the sample
+  // count still matches the pipeline's message count.
+  uint64_t latency_ns = 0;
+  if (now > context->received_timestamp) {
+    latency_ns = (uint64_t)(now - context->received_timestamp);
+  }
+  size_t bucket = 0;
+  for (uint64_t value = latency_ns; value > 1u; value >>= 1) {
+    ++bucket;
+  }
+  rcutils_atomic_fetch_add_uint64_t(&record->bucket_counts[bucket], 1);
+  rcutils_atomic_fetch_add_uint64_t(&record->sample_count, 1);
+  rcutils_atomic_fetch_add_uint64_t(&record->total_latency_ns, latency_ns);
+  // Read-modify-write without a compare exchange; concurrent recorders may
+  // lose an update, which is acceptable for telemetry and keeps the
+  // recording wait-free.
+  if (latency_ns > rcutils_atomic_load_uint64_t(&record->max_latency_ns)) {
+    rcutils_atomic_store(&record->max_latency_ns, latency_ns);
+  }
+  return RCL_RET_OK;
+}
+
+rcl_ret_t
+rcl_publisher_get_hop_histogram(
+  const rcl_publisher_t * publisher,
+  rcl_hop_histogram_t * histogram)
+{
+  if (!rcl_publisher_is_valid(publisher)) {
+    return RCL_RET_PUBLISHER_INVALID;  // error already set
+  }
+  RCL_CHECK_ARGUMENT_FOR_NULL(histogram, RCL_RET_INVALID_ARGUMENT);
+  struct rcl_hop_record_s * record = publisher->impl->hop_record;
+  if (NULL == record) {
+    memset(histogram, 0, sizeof(*histogram));
+    return RCL_RET_OK;
+  }
+  for (size_t i = 0; i < RCL_HOP_HISTOGRAM_BUCKETS; ++i) {
+    histogram->bucket_counts[i] =
+      rcutils_atomic_load_uint64_t(&record->bucket_counts[i]);
+  }
+  histogram->sample_count = rcutils_atomic_load_uint64_t(&record->sample_count);
+  histogram->total_latency_ns =
+    rcutils_atomic_load_uint64_t(&record->total_latency_ns);
+  histogram->max_latency_ns =
+    rcutils_atomic_load_uint64_t(&record->max_latency_ns);
+  return RCL_RET_OK;
+}
+
+#ifdef __cplusplus
+}
+#endif
@@ -19,9 +19,12 @@ extern "C"
 
 #include "rcl/init.h"
 
+#include <inttypes.h>
+
 #include "rcutils/logging_macros.h"
 #include "rcutils/stdatomic_helper.h"
 #include "rcutils/strdup.h"
+#include "rcutils/time.h"
 
 #include "rmw/error_handling.h"
 
@@ -43,6 +46,30 @@ extern "C"
 
 static atomic_uint_least64_t __rcl_next_unique_id = ATOMIC_VAR_INIT(1);
 
+// Sample the monotonic clock for phase timing, or 0 if it cannot be sampled;
+// the instrumentation is best effort and never fails initialization.
+static int64_t
+__init_phase_now(void)
+{
+  rcutils_time_point_value_t now = 0;
+  if (RCUTILS_RET_OK != rcutils_steady_time_now(&now)) {
+    rcutils_reset_error();
+    return 0;
+  }
+  return now;
+}
+
+// Nanoseconds elapsed since a __init_phase_now() sample, clamped to >= 0.
+static int64_t
+__init_phase_elapsed(int64_t phase_start_time)
+{
+  if (0 == phase_start_time) {
+    return 0;
+  }
+  int64_t now = __init_phase_now();
+  return (now > phase_start_time) ? (now - phase_start_time) : 0;
+}
+
 rcl_ret_t
 rcl_init(
   int argc,
@@ -73,6 +100,8 @@ rcl_init(
     ROS_PACKAGE_NAME,
     "Initializing ROS client library, for context at address: %p", (void *) context);
 
+  const int64_t init_start_time = __init_phase_now();
+
   // test expectation that given context is zero initialized
   if (NULL != context->impl) {
     // note that this can also occur when the given context is used before initialization
@@ -92,6 +121,7 @@ rcl_init(
 
   // Zero initialize rmw context first so its validity can by checked in cleanup.
   context->impl->rmw_context = rmw_get_zero_initialized_context();
+  context->impl->rmw_context_is_shared = false;
 
   // Store the allocator.
   context->impl->allocator = allocator;
@@ -125,12 +155,14 @@ rcl_init(
   }
 
   // Parse the ROS specific arguments.
+  int64_t phase_start_time = __init_phase_now();
   ret = rcl_parse_arguments(argc, argv, allocator, &context->global_arguments);
   if (RCL_RET_OK != ret) {
     fail_ret = ret;
     RCUTILS_LOG_ERROR_NAMED(ROS_PACKAGE_NAME, "Failed to parse global arguments");
     goto fail;
   }
+  context->impl->init_timings.argument_parsing_ns = __init_phase_elapsed(phase_start_time);
 
   // Set the instance id.
   uint64_t next_instance_id = rcutils_atomic_fetch_add_uint64_t(&__rcl_next_unique_id, 1);
@@ -154,6 +186,8 @@ rcl_init(
     }
   }
 
+  phase_start_time = __init_phase_now();
+
   rmw_localhost_only_t * localhost_only =
     &context->impl->init_options.impl->rmw_init_options.localhost_only;
   if (RMW_LOCALHOST_ONLY_DEFAULT != *localhost_only) {
@@ -256,6 +290,9 @@ rcl_init(
       "\t%s", discovery_options->static_peers[ii].peer_address);
   }
 
+  context->impl->init_timings.discovery_ns = __init_phase_elapsed(phase_start_time);
+  phase_start_time = __init_phase_now();
+
   if (context->global_arguments.impl->enclave) {
     context->impl->init_options.impl->rmw_init_options.enclave = rcutils_strdup(
       context->global_arguments.impl->enclave,
@@ -301,17 +338,36 @@ rcl_init(
     fail_ret = ret;
     goto fail;
   }
-
-  // Initialize rmw_init.
-  rmw_ret_t rmw_ret = rmw_init(
-    &(context->impl->init_options.impl->rmw_init_options),
-    &(context->impl->rmw_context));
-  if (RMW_RET_OK != rmw_ret) {
-    RCL_SET_ERROR_MSG(rmw_get_error_string().str);
-    fail_ret = rcl_convert_rmw_ret_to_rcl_ret(rmw_ret);
-    goto fail;
+  context->impl->init_timings.security_ns = __init_phase_elapsed(phase_start_time);
+
+  // Create the rmw context, unless its creation was deferred in which case
+  // the first node, guard condition or wait set triggers it through
+  // rcl_context_ensure_rmw_context(). Depending on the share_rmw_context
+  // option this either calls rmw_init() or joins a matching shared rmw
+  // context.
+  if (context->impl->init_options.impl->defer_rmw_init) {
+    RCUTILS_LOG_DEBUG_NAMED(
+      ROS_PACKAGE_NAME,
+      "Deferring rmw context creation, for context at address: %p", (void *) context);
+  } else {
+    ret = __create_rmw_context(context);
+    if (RCL_RET_OK != ret) {
+      fail_ret = ret;  // error message already set
+      goto fail;
+    }
   }
 
+  context->impl->init_timings.total_ns = __init_phase_elapsed(init_start_time);
+  RCUTILS_LOG_DEBUG_NAMED(
+    ROS_PACKAGE_NAME,
+    "rcl_init() phase timings (ns): arguments=%" PRId64 " discovery=%" PRId64
+    " security=%" PRId64 " rmw_init=%" PRId64 " total=%" PRId64,
+    context->impl->init_timings.argument_parsing_ns,
+    context->impl->init_timings.discovery_ns,
+    context->impl->init_timings.security_ns,
+    context->impl->init_timings.rmw_init_ns,
+    context->impl->init_timings.total_ns);
+
   TRACETOOLS_TRACEPOINT(rcl_init, (const void *)context);
 
   return RCL_RET_OK;
@@ -334,10 +390,17 @@ rcl_shutdown(rcl_context_t * context)
     return RCL_RET_ALREADY_SHUTDOWN;
   }
 
-  rmw_ret_t rmw_ret = rmw_shutdown(&(context->impl->rmw_context));
-  if (RMW_RET_OK != rmw_ret) {
-    RCL_SET_ERROR_MSG(rmw_get_error_string().str);
-    return rcl_convert_rmw_ret_to_rcl_ret(rmw_ret);
+  // the rmw context is only shut down when it was actually created, which may
+  // never have happened if its creation was deferred; shared rmw contexts are
+  // released instead, with the last reference running the full rmw teardown
+  if (context->impl->rmw_context_is_shared) {
+    __release_shared_rmw_context(context);
+  } else if (NULL != context->impl->rmw_context.implementation_identifier) {
+    rmw_ret_t rmw_ret = rmw_shutdown(&(context->impl->rmw_context));
+    if (RMW_RET_OK != rmw_ret) {
+      RCL_SET_ERROR_MSG(rmw_get_error_string().str);
+      return rcl_convert_rmw_ret_to_rcl_ret(rmw_ret);
+    }
   }
 
   // reset the instance id to 0 to indicate "invalid"
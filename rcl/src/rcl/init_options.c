@@ -46,6 +46,11 @@ _rcl_init_options_zero_init(rcl_init_options_t * init_options, rcl_allocator_t a
     return RCL_RET_BAD_ALLOC);
   init_options->impl->allocator = allocator;
   init_options->impl->rmw_init_options = rmw_get_zero_initialized_init_options();
+  init_options->impl->defer_rmw_init = false;
+  init_options->impl->share_rmw_context = false;
+  for (size_t i = 0; i < RCL_ALLOCATION_DOMAIN_COUNT; ++i) {
+    init_options->impl->domain_allocator_set[i] = false;
+  }
 
   return RCL_RET_OK;
 }
@@ -125,6 +130,13 @@ rcl_init_options_copy(const rcl_init_options_t * src, rcl_init_options_t * dst)
     return rcl_convert_rmw_ret_to_rcl_ret(rmw_ret);
   }
 
+  dst->impl->defer_rmw_init = src->impl->defer_rmw_init;
+  dst->impl->share_rmw_context = src->impl->share_rmw_context;
+  for (size_t i = 0; i < RCL_ALLOCATION_DOMAIN_COUNT; ++i) {
+    dst->impl->domain_allocators[i] = src->impl->domain_allocators[i];
+    dst->impl->domain_allocator_set[i] = src->impl->domain_allocator_set[i];
+  }
+
   return RCL_RET_OK;
 }
 
@@ -163,6 +175,46 @@ rcl_init_options_set_domain_id(rcl_init_options_t * init_options, size_t domain_
   return RCL_RET_OK;
 }
 
+rcl_ret_t
+rcl_init_options_get_defer_rmw_init(
+  const rcl_init_options_t * init_options, bool * defer_rmw_init)
+{
+  RCL_CHECK_ARGUMENT_FOR_NULL(init_options, RCL_RET_INVALID_ARGUMENT);
+  RCL_CHECK_ARGUMENT_FOR_NULL(init_options->impl, RCL_RET_INVALID_ARGUMENT);
+  RCL_CHECK_ARGUMENT_FOR_NULL(defer_rmw_init, RCL_RET_INVALID_ARGUMENT);
+  *defer_rmw_init = init_options->impl->defer_rmw_init;
+  return RCL_RET_OK;
+}
+
+rcl_ret_t
+rcl_init_options_set_defer_rmw_init(rcl_init_options_t * init_options, bool defer_rmw_init)
+{
+  RCL_CHECK_ARGUMENT_FOR_NULL(init_options, RCL_RET_INVALID_ARGUMENT);
+  RCL_CHECK_ARGUMENT_FOR_NULL(init_options->impl, RCL_RET_INVALID_ARGUMENT);
+  init_options->impl->defer_rmw_init = defer_rmw_init;
+  return RCL_RET_OK;
+}
+
+rcl_ret_t
+rcl_init_options_get_share_rmw_context(
+  const rcl_init_options_t * init_options, bool * share_rmw_context)
+{
+  RCL_CHECK_ARGUMENT_FOR_NULL(init_options, RCL_RET_INVALID_ARGUMENT);
+  RCL_CHECK_ARGUMENT_FOR_NULL(init_options->impl, RCL_RET_INVALID_ARGUMENT);
+  RCL_CHECK_ARGUMENT_FOR_NULL(share_rmw_context, RCL_RET_INVALID_ARGUMENT);
+  *share_rmw_context = init_options->impl->share_rmw_context;
+  return RCL_RET_OK;
+}
+
+rcl_ret_t
+rcl_init_options_set_share_rmw_context(rcl_init_options_t * init_options, bool share_rmw_context)
+{
+  RCL_CHECK_ARGUMENT_FOR_NULL(init_options, RCL_RET_INVALID_ARGUMENT);
+  RCL_CHECK_ARGUMENT_FOR_NULL(init_options->impl, RCL_RET_INVALID_ARGUMENT);
+  init_options->impl->share_rmw_context = share_rmw_context;
+  return RCL_RET_OK;
+}
+
 rmw_init_options_t *
 rcl_init_options_get_rmw_init_options(rcl_init_options_t * init_options)
 {
@@ -179,6 +231,41 @@ rcl_init_options_get_allocator(const rcl_init_options_t * init_options)
   return &(init_options->impl->allocator);
 }
 
+rcl_ret_t
+rcl_init_options_set_domain_allocator(
+  rcl_init_options_t * init_options,
+  rcl_allocation_domain_t domain,
+  rcl_allocator_t allocator)
+{
+  RCL_CHECK_ARGUMENT_FOR_NULL(init_options, RCL_RET_INVALID_ARGUMENT);
+  RCL_CHECK_ARGUMENT_FOR_NULL(init_options->impl, RCL_RET_INVALID_ARGUMENT);
+  if ((int)domain < 0 || domain >= RCL_ALLOCATION_DOMAIN_COUNT) {
+    RCL_SET_ERROR_MSG("domain is not a valid allocation domain");
+    return RCL_RET_INVALID_ARGUMENT;
+  }
+  RCL_CHECK_ALLOCATOR(&allocator, return RCL_RET_INVALID_ARGUMENT);
+  init_options->impl->domain_allocators[domain] = allocator;
+  init_options->impl->domain_allocator_set[domain] = true;
+  return RCL_RET_OK;
+}
+
+const rcl_allocator_t *
+rcl_init_options_get_domain_allocator(
+  const rcl_init_options_t * init_options,
+  rcl_allocation_domain_t domain)
+{
+  RCL_CHECK_ARGUMENT_FOR_NULL(init_options, NULL);
+  RCL_CHECK_ARGUMENT_FOR_NULL(init_options->impl, NULL);
+  if ((int)domain < 0 || domain >= RCL_ALLOCATION_DOMAIN_COUNT) {
+    RCL_SET_ERROR_MSG("domain is not a valid allocation domain");
+    return NULL;
+  }
+  if (!init_options->impl->domain_allocator_set[domain]) {
+    return &(init_options->impl->allocator);
+  }
+  return &(init_options->impl->domain_allocators[domain]);
+}
+
 #ifdef __cplusplus
 }
 #endif
@@ -29,6 +29,16 @@ struct rcl_init_options_impl_s
 {
   rcl_allocator_t allocator;
   rmw_init_options_t rmw_init_options;
+  /// When true, rcl_init() skips rmw_init() and the rmw context is created
+  /// lazily by the first entity that needs it.
+  bool defer_rmw_init;
+  /// When true, contexts with identical rmw init options share one refcounted
+  /// rmw context instead of each creating a middleware participant.
+  bool share_rmw_context;
+  /// Per-domain allocators, valid only where domain_allocator_set is true;
+  /// unset domains fall back to allocator.
+  rcl_allocator_t domain_allocators[RCL_ALLOCATION_DOMAIN_COUNT];
+  bool domain_allocator_set[RCL_ALLOCATION_DOMAIN_COUNT];
 };
 
 #ifdef __cplusplus
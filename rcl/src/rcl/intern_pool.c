@@ -0,0 +1,210 @@
+// Copyright 2026 Open Source Robotics Foundation, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+#include "rcl/intern_pool.h"
+
+#include <stdint.h>
+#include <string.h>
+
+#include "rcl/error_handling.h"
+
+// Initial number of hash table slots; always a power of two so the probe
+// sequence can mask instead of dividing.
+#define INTERN_POOL_INITIAL_CAPACITY 64
+
+typedef struct rcl_intern_pool_entry_s
+{
+  // Canonical copy of the string, owned by the pool; NULL for empty slots.
+  char * string;
+  // Cached hash of the string, so growth does not rehash the contents.
+  uint64_t hash;
+} rcl_intern_pool_entry_t;
+
+struct rcl_intern_pool_impl_s
+{
+  rcl_allocator_t allocator;
+  // Open addressing hash table with linear probing.
+  rcl_intern_pool_entry_t * entries;
+  // Number of slots, always a power of two.
+  size_t capacity;
+  // Number of occupied slots.
+  size_t count;
+};
+
+// FNV-1a, matching the simplicity of the strings being hashed.
+static uint64_t
+__intern_pool_hash(const char * string)
+{
+  uint64_t hash = 0xcbf29ce484222325ULL;
+  for (const char * c = string; '\0' != *c; ++c) {
+    hash ^= (uint64_t)(unsigned char)*c;
+    hash *= 0x100000001b3ULL;
+  }
+  return hash;
+}
+
+// Insert an owned string into the table; the caller guarantees the string is
+// not present and that a free slot exists.
+static void
+__intern_pool_insert(
+  rcl_intern_pool_impl_t * impl, char * string, uint64_t hash)
+{
+  size_t index = (size_t)hash & (impl->capacity - 1);
+  while (NULL != impl->entries[index].string) {
+    index = (index + 1) & (impl->capacity - 1);
+  }
+  impl->entries[index].string = string;
+  impl->entries[index].hash = hash;
+  ++impl->count;
+}
+
+// Double the table capacity, re-seating the existing entries.
+static rcl_ret_t
+__intern_pool_grow(rcl_intern_pool_impl_t * impl)
+{
+  rcl_intern_pool_entry_t * old_entries = impl->entries;
+  const size_t old_capacity = impl->capacity;
+  rcl_intern_pool_entry_t * new_entries = impl->allocator.zero_allocate(
+    2 * old_capacity, sizeof(rcl_intern_pool_entry_t), impl->allocator.state);
+  if (NULL == new_entries) {
+    RCL_SET_ERROR_MSG("allocating memory failed");
+    return RCL_RET_BAD_ALLOC;
+  }
+  impl->entries = new_entries;
+  impl->capacity = 2 * old_capacity;
+  impl->count = 0;
+  for (size_t i = 0; i < old_capacity; ++i) {
+    if (NULL != old_entries[i].string) {
+      __intern_pool_insert(impl, old_entries[i].string, old_entries[i].hash);
+    }
+  }
+  impl->allocator.deallocate(old_entries, impl->allocator.state);
+  return RCL_RET_OK;
+}
+
+rcl_intern_pool_t
+rcl_get_zero_initialized_intern_pool(void)
+{
+  static rcl_intern_pool_t null_pool = {0};
+  return null_pool;
+}
+
+rcl_ret_t
+rcl_intern_pool_init(rcl_intern_pool_t * pool, rcl_allocator_t * allocator)
+{
+  RCL_CHECK_ARGUMENT_FOR_NULL(pool, RCL_RET_INVALID_ARGUMENT);
+  RCL_CHECK_ALLOCATOR_WITH_MSG(allocator, "invalid allocator", return RCL_RET_INVALID_ARGUMENT);
+  if (NULL != pool->impl) {
+    RCL_SET_ERROR_MSG("intern pool already initialized, or memory was uninitialized");
+    return RCL_RET_ALREADY_INIT;
+  }
+  rcl_intern_pool_impl_t * impl =
+    allocator->allocate(sizeof(rcl_intern_pool_impl_t), allocator->state);
+  if (NULL == impl) {
+    RCL_SET_ERROR_MSG("allocating memory failed");
+    return RCL_RET_BAD_ALLOC;
+  }
+  impl->allocator = *allocator;
+  impl->entries = allocator->zero_allocate(
+    INTERN_POOL_INITIAL_CAPACITY, sizeof(rcl_intern_pool_entry_t), allocator->state);
+  if (NULL == impl->entries) {
+    allocator->deallocate(impl, allocator->state);
+    RCL_SET_ERROR_MSG("allocating memory failed");
+    return RCL_RET_BAD_ALLOC;
+  }
+  impl->capacity = INTERN_POOL_INITIAL_CAPACITY;
+  impl->count = 0;
+  pool->impl = impl;
+  return RCL_RET_OK;
+}
+
+rcl_ret_t
+rcl_intern_pool_fini(rcl_intern_pool_t * pool)
+{
+  RCL_CHECK_ARGUMENT_FOR_NULL(pool, RCL_RET_INVALID_ARGUMENT);
+  if (NULL == pool->impl) {
+    return RCL_RET_OK;
+  }
+  rcl_intern_pool_impl_t * impl = pool->impl;
+  rcl_allocator_t allocator = impl->allocator;
+  for (size_t i = 0; i < impl->capacity; ++i) {
+    if (NULL != impl->entries[i].string) {
+      allocator.deallocate(impl->entries[i].string, allocator.state);
+    }
+  }
+  allocator.deallocate(impl->entries, allocator.state);
+  allocator.deallocate(impl, allocator.state);
+  pool->impl = NULL;
+  return RCL_RET_OK;
+}
+
+rcl_ret_t
+rcl_intern_pool_intern(
+  rcl_intern_pool_t * pool, const char * string, const char ** interned)
+{
+  RCL_CHECK_ARGUMENT_FOR_NULL(pool, RCL_RET_INVALID_ARGUMENT);
+  RCL_CHECK_FOR_NULL_WITH_MSG(
+    pool->impl, "intern pool is invalid", return RCL_RET_INVALID_ARGUMENT);
+  RCL_CHECK_ARGUMENT_FOR_NULL(string, RCL_RET_INVALID_ARGUMENT);
+  RCL_CHECK_ARGUMENT_FOR_NULL(interned, RCL_RET_INVALID_ARGUMENT);
+  rcl_intern_pool_impl_t * impl = pool->impl;
+  const uint64_t hash = __intern_pool_hash(string);
+  size_t index = (size_t)hash & (impl->capacity - 1);
+  while (NULL != impl->entries[index].string) {
+    if (impl->entries[index].hash == hash &&
+      0 == strcmp(impl->entries[index].string, string))
+    {
+      *interned = impl->entries[index].string;
+      return RCL_RET_OK;
+    }
+    index = (index + 1) & (impl->capacity - 1);
+  }
+  // Not present; grow at 3/4 load before inserting the canonical copy.
+  if (4 * (impl->count + 1) > 3 * impl->capacity) {
+    rcl_ret_t ret = __intern_pool_grow(impl);
+    if (RCL_RET_OK != ret) {
+      return ret;  // error already set
+    }
+  }
+  const size_t length = strlen(string) + 1;
+  char * copy = impl->allocator.allocate(length, impl->allocator.state);
+  if (NULL == copy) {
+    RCL_SET_ERROR_MSG("allocating memory failed");
+    return RCL_RET_BAD_ALLOC;
+  }
+  memcpy(copy, string, length);
+  __intern_pool_insert(impl, copy, hash);
+  *interned = copy;
+  return RCL_RET_OK;
+}
+
+rcl_ret_t
+rcl_intern_pool_get_count(const rcl_intern_pool_t * pool, size_t * count)
+{
+  RCL_CHECK_ARGUMENT_FOR_NULL(pool, RCL_RET_INVALID_ARGUMENT);
+  RCL_CHECK_FOR_NULL_WITH_MSG(
+    pool->impl, "intern pool is invalid", return RCL_RET_INVALID_ARGUMENT);
+  RCL_CHECK_ARGUMENT_FOR_NULL(count, RCL_RET_INVALID_ARGUMENT);
+  *count = pool->impl->count;
+  return RCL_RET_OK;
+}
+
+#ifdef __cplusplus
+}
+#endif
@@ -0,0 +1,569 @@
+// Copyright 2026 Open Source Robotics Foundation, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+#include "rcl/intra_process.h"
+
+#include <stdint.h>
+#include <string.h>
+
+#include "rcl/error_handling.h"
+#include "rcutils/macros.h"
+#include "rcutils/stdatomic_helper.h"
+#include "rcutils/strdup.h"
+
+#include "./context_impl.h"
+#include "./intra_process_impl.h"
+#include "./publisher_impl.h"
+#include "./subscription_impl.h"
+
+/// Reference-counted envelope around one published message instance.
+struct rcl_intra_process_message_s
+{
+  /// The instance handed to rcl_publish_intra_process().
+  void * message;
+  rcl_intra_process_message_fini_t fini;
+  void * user_data;
+  /// Allocator the envelope itself was allocated with.
+  rcl_allocator_t allocator;
+  /// One reference per ring the envelope sits in or handle held by a taker.
+  atomic_uint_least64_t refcount;
+};
+
+/// One ring slot; the sequence field drives the lock-free claim protocol,
+/// matching the rosout async ring in logging_rosout.c.
+typedef struct rcl_intra_process_slot_s
+{
+  atomic_uint_least64_t sequence;
+  rcl_intra_process_message_t * envelope;
+} rcl_intra_process_slot_t;
+
+/// Per-subscription endpoint: delivery ring plus wakeup guard condition.
+struct rcl_intra_process_sub_entry_s
+{
+  const rcl_subscription_t * subscription;
+  struct rcl_intra_process_channel_s * channel;
+  /// Fires on every delivery; handed to the application for its wait set.
+  rcl_guard_condition_t guard_condition;
+  rcl_intra_process_slot_t * slots;
+  /// Allocator the entry and its slots were allocated with.
+  rcl_allocator_t allocator;
+  /// Ring capacity minus one; the capacity is a power of two.
+  uint64_t ring_mask;
+  /// Publish side, monotonically increasing claim counter.
+  atomic_uint_least64_t head;
+  /// Take side, monotonically increasing claim counter.
+  atomic_uint_least64_t tail;
+};
+
+/// All intra-process endpoints sharing one fully qualified topic name.
+typedef struct rcl_intra_process_channel_s
+{
+  char * topic_name;
+  /// Attached subscriptions; detached slots are NULL and get reused.
+  struct rcl_intra_process_sub_entry_s ** subs;
+  size_t subs_capacity;
+  /// Length of the subs prefix the publish loop scans, including holes.
+  size_t num_subs;
+  /// Attached publishers; kept for diagnostics, channels live until the
+  /// context is cleaned up.
+  size_t num_publishers;
+} rcl_intra_process_channel_t;
+
+struct rcl_intra_process_registry_impl_s
+{
+  rcl_allocator_t allocator;
+  rcl_intra_process_channel_t ** channels;
+  size_t capacity;
+  size_t count;
+};
+
+#define INTRA_PROCESS_REGISTRY_INITIAL_CAPACITY 8
+#define INTRA_PROCESS_CHANNEL_INITIAL_SUBS 4
+
+/// Drop one reference; the last one runs fini and frees the envelope.
+static void
+_rcl_intra_process_envelope_release(rcl_intra_process_message_t * envelope)
+{
+  const uint64_t previous =
+    rcutils_atomic_fetch_add_uint64_t(&envelope->refcount, (uint64_t)-1);
+  if (1u == previous) {
+    envelope->fini(envelope->message, envelope->user_data);
+    rcl_allocator_t allocator = envelope->allocator;
+    allocator.deallocate(envelope, allocator.state);
+  }
+}
+
+/// Queue an envelope on one ring, returning false when the ring is full.
+static bool
+_rcl_intra_process_ring_push(
+  struct rcl_intra_process_sub_entry_s * entry,
+  rcl_intra_process_message_t * envelope)
+{
+  rcl_intra_process_slot_t * slot = NULL;
+  uint64_t pos = rcutils_atomic_load_uint64_t(&entry->head);
+  for (;;) {
+    slot = &entry->slots[pos & entry->ring_mask];
+    uint64_t seq = rcutils_atomic_load_uint64_t(&slot->sequence);
+    int64_t dif = (int64_t)seq - (int64_t)pos;
+    if (0 == dif) {
+      bool exchanged = false;
+      uint64_t expected = pos;
+      rcutils_atomic_compare_exchange_strong(&entry->head, exchanged, &expected, pos + 1);
+      if (exchanged) {
+        break;
+      }
+      pos = expected;
+    } else if (dif < 0) {
+      // full; drop-new matches keep-last semantics from the taker's view
+      return false;
+    } else {
+      pos = rcutils_atomic_load_uint64_t(&entry->head);
+    }
+  }
+  slot->envelope = envelope;
+  // Mark the slot ready for the consumer.
+  rcutils_atomic_store(&slot->sequence, pos + 1);
+  return true;
+}
+
+/// Dequeue the oldest envelope, or NULL when the ring is empty.
+static rcl_intra_process_message_t *
+_rcl_intra_process_ring_pop(struct rcl_intra_process_sub_entry_s * entry)
+{
+  rcl_intra_process_slot_t * slot = NULL;
+  uint64_t pos = rcutils_atomic_load_uint64_t(&entry->tail);
+  for (;;) {
+    slot = &entry->slots[pos & entry->ring_mask];
+    uint64_t seq = rcutils_atomic_load_uint64_t(&slot->sequence);
+    int64_t dif = (int64_t)seq - (int64_t)(pos + 1);
+    if (0 == dif) {
+      bool exchanged = false;
+      uint64_t expected = pos;
+      rcutils_atomic_compare_exchange_strong(&entry->tail, exchanged, &expected, pos + 1);
+      if (exchanged) {
+        break;
+      }
+      pos = expected;
+    } else if (dif < 0) {
+      return NULL;
+    } else {
+      pos = rcutils_atomic_load_uint64_t(&entry->tail);
+    }
+  }
+  rcl_intra_process_message_t * envelope = slot->envelope;
+  // Recycle the slot for the producer one lap ahead.
+  rcutils_atomic_store(&slot->sequence, pos + entry->ring_mask + 1);
+  return envelope;
+}
+
+/// Return the context's registry, creating it on first use.
+static rcl_intra_process_registry_impl_t *
+_rcl_intra_process_get_registry(rcl_context_t * context)
+{
+  if (NULL != context->impl->intra_process_registry) {
+    return context->impl->intra_process_registry;
+  }
+  rcl_allocator_t * allocator = &context->impl->allocator;
+  rcl_intra_process_registry_impl_t * registry = allocator->allocate(
+    sizeof(rcl_intra_process_registry_impl_t), allocator->state);
+  if (NULL == registry) {
+    RCL_SET_ERROR_MSG("allocating memory failed");
+    return NULL;
+  }
+  registry->allocator = *allocator;
+  registry->channels = allocator->zero_allocate(
+    INTRA_PROCESS_REGISTRY_INITIAL_CAPACITY, sizeof(rcl_intra_process_channel_t *),
+    allocator->state);
+  if (NULL == registry->channels) {
+    allocator->deallocate(registry, allocator->state);
+    RCL_SET_ERROR_MSG("allocating memory failed");
+    return NULL;
+  }
+  registry->capacity = INTRA_PROCESS_REGISTRY_INITIAL_CAPACITY;
+  registry->count = 0;
+  context->impl->intra_process_registry = registry;
+  return registry;
+}
+
+/// Find the channel for a topic, creating it when absent.
+static rcl_intra_process_channel_t *
+_rcl_intra_process_get_channel(
+  rcl_intra_process_registry_impl_t * registry,
+  const char * topic_name)
+{
+  for (size_t i = 0; i < registry->count; ++i) {
+    if (0 == strcmp(registry->channels[i]->topic_name, topic_name)) {
+      return registry->channels[i];
+    }
+  }
+  rcl_allocator_t * allocator = &registry->allocator;
+  if (registry->count == registry->capacity) {
+    size_t new_capacity = 2 * registry->capacity;
+    rcl_intra_process_channel_t ** grown = allocator->reallocate(
+      registry->channels, new_capacity * sizeof(rcl_intra_process_channel_t *),
+      allocator->state);
+    if (NULL == grown) {
+      RCL_SET_ERROR_MSG("allocating memory failed");
+      return NULL;
+    }
+    registry->channels = grown;
+    registry->capacity = new_capacity;
+  }
+  rcl_intra_process_channel_t * channel = allocator->zero_allocate(
+    1, sizeof(rcl_intra_process_channel_t), allocator->state);
+  if (NULL == channel) {
+    RCL_SET_ERROR_MSG("allocating memory failed");
+    return NULL;
+  }
+  channel->topic_name = rcutils_strdup(topic_name, *allocator);
+  if (NULL == channel->topic_name) {
+    allocator->deallocate(channel, allocator->state);
+    RCL_SET_ERROR_MSG("allocating memory failed");
+    return NULL;
+  }
+  channel->subs = allocator->zero_allocate(
+    INTRA_PROCESS_CHANNEL_INITIAL_SUBS, sizeof(struct rcl_intra_process_sub_entry_s *),
+    allocator->state);
+  if (NULL == channel->subs) {
+    allocator->deallocate(channel->topic_name, allocator->state);
+    allocator->deallocate(channel, allocator->state);
+    RCL_SET_ERROR_MSG("allocating memory failed");
+    return NULL;
+  }
+  channel->subs_capacity = INTRA_PROCESS_CHANNEL_INITIAL_SUBS;
+  registry->channels[registry->count++] = channel;
+  return channel;
+}
+
+/// Drain and free one subscription endpoint.
+static void
+_rcl_intra_process_sub_entry_fini(struct rcl_intra_process_sub_entry_s * entry)
+{
+  rcl_allocator_t allocator = entry->allocator;
+  rcl_intra_process_message_t * envelope;
+  while (NULL != (envelope = _rcl_intra_process_ring_pop(entry))) {
+    _rcl_intra_process_envelope_release(envelope);
+  }
+  if (RCL_RET_OK != rcl_guard_condition_fini(&entry->guard_condition)) {
+    RCUTILS_SAFE_FWRITE_TO_STDERR(
+      "[rcl|intra_process.c:" RCUTILS_STRINGIFY(__LINE__)
+      "] failed to finalize intra-process guard condition: ");
+    RCUTILS_SAFE_FWRITE_TO_STDERR(rcl_get_error_string().str);
+    RCUTILS_SAFE_FWRITE_TO_STDERR("\n");
+    rcl_reset_error();
+  }
+  allocator.deallocate(entry->slots, allocator.state);
+  allocator.deallocate(entry, allocator.state);
+}
+
+void
+rcl_intra_process_registry_fini(rcl_intra_process_registry_impl_t * registry)
+{
+  if (NULL == registry) {
+    return;
+  }
+  rcl_allocator_t allocator = registry->allocator;
+  for (size_t i = 0; i < registry->count; ++i) {
+    rcl_intra_process_channel_t * channel = registry->channels[i];
+    for (size_t s = 0; s < channel->num_subs; ++s) {
+      if (NULL != channel->subs[s]) {
+        // the owning subscription was never detached; drain defensively
+        channel->subs[s]->subscription->impl->intra_process = NULL;
+        _rcl_intra_process_sub_entry_fini(channel->subs[s]);
+      }
+    }
+    allocator.deallocate(channel->subs, allocator.state);
+    allocator.deallocate(channel->topic_name, allocator.state);
+    allocator.deallocate(channel, allocator.state);
+  }
+  allocator.deallocate(registry->channels, allocator.state);
+  allocator.deallocate(registry, allocator.state);
+}
+
+rcl_ret_t
+rcl_publisher_enable_intra_process(rcl_publisher_t * publisher)
+{
+  if (!rcl_publisher_is_valid(publisher)) {
+    return RCL_RET_PUBLISHER_INVALID;  // error already set
+  }
+  if (NULL != publisher->impl->intra_process_channel) {
+    RCL_SET_ERROR_MSG("intra-process already enabled on this publisher");
+    return RCL_RET_ALREADY_INIT;
+  }
+  rcl_intra_process_registry_impl_t * registry =
+    _rcl_intra_process_get_registry(publisher->impl->context);
+  if (NULL == registry) {
+    return RCL_RET_BAD_ALLOC;  // error already set
+  }
+  rcl_intra_process_channel_t * channel =
+    _rcl_intra_process_get_channel(registry, publisher->impl->rmw_handle->topic_name);
+  if (NULL == channel) {
+    return RCL_RET_BAD_ALLOC;  // error already set
+  }
+  ++channel->num_publishers;
+  publisher->impl->intra_process_channel = channel;
+  return RCL_RET_OK;
+}
+
+rcl_ret_t
+rcl_publisher_disable_intra_process(rcl_publisher_t * publisher)
+{
+  if (!rcl_publisher_is_valid(publisher)) {
+    return RCL_RET_PUBLISHER_INVALID;  // error already set
+  }
+  rcl_intra_process_channel_t * channel = publisher->impl->intra_process_channel;
+  if (NULL == channel) {
+    return RCL_RET_OK;
+  }
+  --channel->num_publishers;
+  publisher->impl->intra_process_channel = NULL;
+  return RCL_RET_OK;
+}
+
+rcl_ret_t
+rcl_subscription_enable_intra_process(
+  rcl_subscription_t * subscription,
+  rcl_context_t * context,
+  size_t ring_capacity)
+{
+  if (!rcl_subscription_is_valid(subscription)) {
+    return RCL_RET_SUBSCRIPTION_INVALID;  // error already set
+  }
+  if (!rcl_context_is_valid(context)) {
+    RCL_SET_ERROR_MSG("context is invalid");
+    return RCL_RET_INVALID_ARGUMENT;
+  }
+  if (0 == ring_capacity) {
+    RCL_SET_ERROR_MSG("ring_capacity must be non-zero");
+    return RCL_RET_INVALID_ARGUMENT;
+  }
+  if (NULL != subscription->impl->intra_process) {
+    RCL_SET_ERROR_MSG("intra-process already enabled on this subscription");
+    return RCL_RET_ALREADY_INIT;
+  }
+  rcl_intra_process_registry_impl_t * registry = _rcl_intra_process_get_registry(context);
+  if (NULL == registry) {
+    return RCL_RET_BAD_ALLOC;  // error already set
+  }
+  rcl_intra_process_channel_t * channel =
+    _rcl_intra_process_get_channel(registry, subscription->impl->rmw_handle->topic_name);
+  if (NULL == channel) {
+    return RCL_RET_BAD_ALLOC;  // error already set
+  }
+  rcl_allocator_t * allocator = &registry->allocator;
+
+  // round the capacity up to a power of two for mask addressing
+  uint64_t capacity = 1;
+  while (capacity < (uint64_t)ring_capacity) {
+    capacity <<= 1;
+  }
+  struct rcl_intra_process_sub_entry_s * entry = allocator->zero_allocate(
+    1, sizeof(struct rcl_intra_process_sub_entry_s), allocator->state);
+  if (NULL == entry) {
+    RCL_SET_ERROR_MSG("allocating memory failed");
+    return RCL_RET_BAD_ALLOC;
+  }
+  entry->slots = allocator->zero_allocate(
+    (size_t)capacity, sizeof(rcl_intra_process_slot_t), allocator->state);
+  if (NULL == entry->slots) {
+    allocator->deallocate(entry, allocator->state);
+    RCL_SET_ERROR_MSG("allocating memory failed");
+    return RCL_RET_BAD_ALLOC;
+  }
+  for (uint64_t i = 0; i < capacity; ++i) {
+    atomic_init(&entry->slots[i].sequence, i);
+  }
+  entry->ring_mask = capacity - 1;
+  atomic_init(&entry->head, 0);
+  atomic_init(&entry->tail, 0);
+  entry->subscription = subscription;
+  entry->channel = channel;
+  entry->allocator = *allocator;
+
+  entry->guard_condition = rcl_get_zero_initialized_guard_condition();
+  rcl_guard_condition_options_t guard_condition_options =
+    rcl_guard_condition_get_default_options();
+  guard_condition_options.allocator = *allocator;
+  rcl_ret_t ret = rcl_guard_condition_init(
+    &entry->guard_condition, context, guard_condition_options);
+  if (RCL_RET_OK != ret) {
+    allocator->deallocate(entry->slots, allocator->state);
+    allocator->deallocate(entry, allocator->state);
+    return ret;  // error already set
+  }
+
+  // attach, reusing a hole left by a detached subscription when possible
+  size_t slot_index = channel->num_subs;
+  for (size_t i = 0; i < channel->num_subs; ++i) {
+    if (NULL == channel->subs[i]) {
+      slot_index = i;
+      break;
+    }
+  }
+  if (slot_index == channel->num_subs) {
+    if (channel->num_subs == channel->subs_capacity) {
+      size_t new_capacity = 2 * channel->subs_capacity;
+      struct rcl_intra_process_sub_entry_s ** grown = allocator->reallocate(
+        channel->subs, new_capacity * sizeof(struct rcl_intra_process_sub_entry_s *),
+        allocator->state);
+      if (NULL == grown) {
+        _rcl_intra_process_sub_entry_fini(entry);
+        RCL_SET_ERROR_MSG("allocating memory failed");
+        return RCL_RET_BAD_ALLOC;
+      }
+      channel->subs = grown;
+      channel->subs_capacity = new_capacity;
+    }
+    ++channel->num_subs;
+  }
+  channel->subs[slot_index] = entry;
+  subscription->impl->intra_process = entry;
+  return RCL_RET_OK;
+}
+
+rcl_ret_t
+rcl_subscription_disable_intra_process(rcl_subscription_t * subscription)
+{
+  if (!rcl_subscription_is_valid(subscription)) {
+    return RCL_RET_SUBSCRIPTION_INVALID;  // error already set
+  }
+  struct rcl_intra_process_sub_entry_s * entry = subscription->impl->intra_process;
+  if (NULL == entry) {
+    return RCL_RET_OK;
+  }
+  rcl_intra_process_channel_t * channel = entry->channel;
+  for (size_t i = 0; i < channel->num_subs; ++i) {
+    if (channel->subs[i] == entry) {
+      channel->subs[i] = NULL;
+      break;
+    }
+  }
+  _rcl_intra_process_sub_entry_fini(entry);
+  subscription->impl->intra_process = NULL;
+  return RCL_RET_OK;
+}
+
+const rcl_guard_condition_t *
+rcl_subscription_get_intra_process_guard_condition(const rcl_subscription_t * subscription)
+{
+  if (!rcl_subscription_is_valid(subscription)) {
+    return NULL;  // error already set
+  }
+  if (NULL == subscription->impl->intra_process) {
+    return NULL;
+  }
+  return &subscription->impl->intra_process->guard_condition;
+}
+
+rcl_ret_t
+rcl_publish_intra_process(
+  const rcl_publisher_t * publisher,
+  void * ros_message,
+  rcl_intra_process_message_fini_t fini,
+  void * fini_user_data,
+  size_t * num_delivered)
+{
+  if (!rcl_publisher_is_valid(publisher)) {
+    return RCL_RET_PUBLISHER_INVALID;  // error already set
+  }
+  RCL_CHECK_ARGUMENT_FOR_NULL(ros_message, RCL_RET_INVALID_ARGUMENT);
+  RCL_CHECK_ARGUMENT_FOR_NULL(fini, RCL_RET_INVALID_ARGUMENT);
+  rcl_intra_process_channel_t * channel = publisher->impl->intra_process_channel;
+  if (NULL == channel) {
+    RCL_SET_ERROR_MSG("intra-process is not enabled on this publisher");
+    return RCL_RET_INVALID_ARGUMENT;
+  }
+  rcl_allocator_t * allocator = &publisher->impl->options.allocator;
+  rcl_intra_process_message_t * envelope = allocator->allocate(
+    sizeof(rcl_intra_process_message_t), allocator->state);
+  if (NULL == envelope) {
+    RCL_SET_ERROR_MSG("allocating memory failed");
+    return RCL_RET_BAD_ALLOC;
+  }
+  envelope->message = ros_message;
+  envelope->fini = fini;
+  envelope->user_data = fini_user_data;
+  envelope->allocator = *allocator;
+  // the publisher holds one reference for the duration of the fan-out, so
+  // the envelope cannot be freed from under the delivery loop
+  atomic_init(&envelope->refcount, 1);
+
+  size_t delivered = 0;
+  for (size_t i = 0; i < channel->num_subs; ++i) {
+    struct rcl_intra_process_sub_entry_s * entry = channel->subs[i];
+    if (NULL == entry) {
+      continue;
+    }
+    rcutils_atomic_fetch_add_uint64_t(&envelope->refcount, 1);
+    if (_rcl_intra_process_ring_push(entry, envelope)) {
+      ++delivered;
+      rcl_ret_t trigger_ret = rcl_trigger_guard_condition(&entry->guard_condition);
+      if (RCL_RET_OK != trigger_ret) {
+        // delivery stands; the taker just was not woken through this path
+        rcl_reset_error();
+      }
+    } else {
+      _rcl_intra_process_envelope_release(envelope);
+    }
+  }
+  // drop the publisher's reference; frees immediately when nothing was queued
+  _rcl_intra_process_envelope_release(envelope);
+  if (NULL != num_delivered) {
+    *num_delivered = delivered;
+  }
+  return RCL_RET_OK;
+}
+
+rcl_ret_t
+rcl_take_intra_process(
+  const rcl_subscription_t * subscription,
+  void ** ros_message,
+  rcl_intra_process_message_t ** message_handle)
+{
+  if (!rcl_subscription_is_valid(subscription)) {
+    return RCL_RET_SUBSCRIPTION_INVALID;  // error already set
+  }
+  RCL_CHECK_ARGUMENT_FOR_NULL(ros_message, RCL_RET_INVALID_ARGUMENT);
+  RCL_CHECK_ARGUMENT_FOR_NULL(message_handle, RCL_RET_INVALID_ARGUMENT);
+  struct rcl_intra_process_sub_entry_s * entry = subscription->impl->intra_process;
+  if (NULL == entry) {
+    RCL_SET_ERROR_MSG("intra-process is not enabled on this subscription");
+    return RCL_RET_INVALID_ARGUMENT;
+  }
+  rcl_intra_process_message_t * envelope = _rcl_intra_process_ring_pop(entry);
+  if (NULL == envelope) {
+    RCL_RETURN_EXPECTED(RCL_RET_SUBSCRIPTION_TAKE_FAILED);
+  }
+  // the ring's reference becomes the caller's handle
+  *ros_message = envelope->message;
+  *message_handle = envelope;
+  return RCL_RET_OK;
+}
+
+rcl_ret_t
+rcl_intra_process_message_release(rcl_intra_process_message_t * message_handle)
+{
+  RCL_CHECK_ARGUMENT_FOR_NULL(message_handle, RCL_RET_INVALID_ARGUMENT);
+  _rcl_intra_process_envelope_release(message_handle);
+  return RCL_RET_OK;
+}
+
+#ifdef __cplusplus
+}
+#endif
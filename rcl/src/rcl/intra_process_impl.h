@@ -0,0 +1,42 @@
+// Copyright 2026 Open Source Robotics Foundation, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef RCL__INTRA_PROCESS_IMPL_H_
+#define RCL__INTRA_PROCESS_IMPL_H_
+
+#include "rcl/macros.h"
+#include "rcl/visibility_control.h"
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+/// \internal Topic-keyed channel registry owned by the context; created
+/// lazily by the first intra-process enable, see intra_process.c.
+typedef struct rcl_intra_process_registry_impl_s rcl_intra_process_registry_impl_t;
+
+/// \internal Release the registry and everything it still holds: channels,
+/// rings, queued envelopes and the per-subscription guard conditions.
+/// Called from __cleanup_context(); entities are expected to have been
+/// detached already, leftovers are drained defensively.
+RCL_LOCAL
+void
+rcl_intra_process_registry_fini(rcl_intra_process_registry_impl_t * registry);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif  // RCL__INTRA_PROCESS_IMPL_H_
@@ -15,6 +15,8 @@
 #include "rcl/error_handling.h"
 #include "rcl/lexer.h"
 
+#include "rcutils/stdatomic_helper.h"
+
 /* The lexer tries to find a lexeme in a string.
  * It looks at one character at a time, and uses that character's value to decide how to transition
  * a state machine.
@@ -594,6 +596,39 @@ static const rcl_lexeme_t g_terminals[LAST_TERMINAL + 1] = {
   RCL_LEXEME_DOT
 };
 
+/* Dense transition tables expanded from g_states the first time the lexer runs.
+ * Indexing a state and a character directly replaces the per-character scan of a
+ * state's transition list, so the analyze loop is two array lookups per character.
+ * A matching range transition always moves forwards, so its movement cell is 0;
+ * cells not covered by any range hold the state's '<else,M>' transition.
+ */
+static unsigned char g_dfa_to_state[LAST_STATE + 1][256];
+static unsigned char g_dfa_movement[LAST_STATE + 1][256];
+static atomic_bool g_dfa_expanded = ATOMIC_VAR_INIT(false);
+
+static void
+__rcl_lexer_expand_dfa(void)
+{
+  for (size_t state_idx = 0u; state_idx <= LAST_STATE; ++state_idx) {
+    const rcl_lexer_state_t * state = &(g_states[state_idx]);
+    for (size_t chr = 0u; chr < 256u; ++chr) {
+      g_dfa_to_state[state_idx][chr] = state->else_state;
+      g_dfa_movement[state_idx][chr] = state->else_movement;
+    }
+    for (size_t transition_idx = 0u; 0u != state->transitions[transition_idx].to_state;
+      ++transition_idx)
+    {
+      const rcl_lexer_transition_t * transition = &(state->transitions[transition_idx]);
+      for (size_t chr = (unsigned char)transition->range_start;
+        chr <= (unsigned char)transition->range_end; ++chr)
+      {
+        g_dfa_to_state[state_idx][chr] = transition->to_state;
+        g_dfa_movement[state_idx][chr] = 0u;
+      }
+    }
+  }
+}
+
 rcl_ret_t
 rcl_lexer_analyze(
   const char * text,
@@ -615,8 +650,13 @@ rcl_lexer_analyze(
     return RCL_RET_OK;
   }
 
-  const rcl_lexer_state_t * state;
-  char current_char;
+  if (!rcutils_atomic_load_bool(&g_dfa_expanded)) {
+    // A concurrent expansion is benign; every thread writes identical values.
+    __rcl_lexer_expand_dfa();
+    rcutils_atomic_store(&g_dfa_expanded, true);
+  }
+
+  unsigned char current_char;
   size_t next_state = S0;
   size_t movement;
 
@@ -627,28 +667,9 @@ rcl_lexer_analyze(
       RCL_SET_ERROR_MSG("Internal lexer bug: next state does not exist");
       return RCL_RET_ERROR;
     }
-    state = &(g_states[next_state]);
-    current_char = text[*length];
-    next_state = 0u;
-    movement = 0u;
-
-    // Look for a transition that contains this character in its range
-    size_t transition_idx = 0u;
-    const rcl_lexer_transition_t * transition;
-    do {
-      transition = &(state->transitions[transition_idx]);
-      if (transition->range_start <= current_char && transition->range_end >= current_char) {
-        next_state = transition->to_state;
-        break;
-      }
-      ++transition_idx;
-    } while (0u != transition->to_state);
-
-    // if no transition was found, take the else transition
-    if (0u == next_state) {
-      next_state = state->else_state;
-      movement = state->else_movement;
-    }
+    current_char = (unsigned char)text[*length];
+    movement = g_dfa_movement[next_state][current_char];
+    next_state = g_dfa_to_state[next_state][current_char];
 
     if (0u == movement) {
       if ('\0' != current_char) {
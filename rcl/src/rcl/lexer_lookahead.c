@@ -15,6 +15,17 @@
 #include "rcl/error_handling.h"
 #include "rcl/lexer_lookahead.h"
 
+// One memoized lexical analysis result
+typedef struct rcl_lexer_lookahead2_memo_s
+{
+  // first character of lexeme
+  size_t start;
+  // One past last character of lexeme
+  size_t end;
+  // Type of lexeme
+  rcl_lexeme_t type;
+} rcl_lexer_lookahead2_memo_t;
+
 struct rcl_lexer_lookahead2_impl_s
 {
   // Text that is being analyzed for lexemes
@@ -29,10 +40,79 @@ struct rcl_lexer_lookahead2_impl_s
   // Type of lexeme
   rcl_lexeme_t type[2];
 
+  // Previously analyzed lexemes ordered by start position, so that replaying
+  // a position after a rewind is a table lookup instead of a re-analysis
+  rcl_lexer_lookahead2_memo_t * memo;
+  size_t memo_count;
+  size_t memo_capacity;
+
   // Allocator to use if an error occurrs
   rcl_allocator_t allocator;
 };
 
+// Find a memoized lexeme starting at the given position, or NULL if there is none.
+static const rcl_lexer_lookahead2_memo_t *
+__lookahead2_memo_find(const rcl_lexer_lookahead2_impl_t * impl, size_t position)
+{
+  size_t low = 0u;
+  size_t high = impl->memo_count;
+  while (low < high) {
+    size_t mid = low + (high - low) / 2u;
+    if (impl->memo[mid].start < position) {
+      low = mid + 1u;
+    } else if (impl->memo[mid].start > position) {
+      high = mid;
+    } else {
+      return &(impl->memo[mid]);
+    }
+  }
+  return NULL;
+}
+
+// Analyze the lexeme starting at the given position, consulting and
+// populating the memo table.
+static rcl_ret_t
+__lookahead2_analyze(
+  rcl_lexer_lookahead2_impl_t * impl,
+  size_t position,
+  rcl_lexeme_t * type,
+  size_t * length)
+{
+  const rcl_lexer_lookahead2_memo_t * memo = __lookahead2_memo_find(impl, position);
+  if (NULL != memo) {
+    *type = memo->type;
+    *length = memo->end - memo->start;
+    return RCL_RET_OK;
+  }
+
+  rcl_ret_t ret = rcl_lexer_analyze(&(impl->text[position]), type, length);
+  if (RCL_RET_OK != ret) {
+    return ret;
+  }
+
+  // Only append results that keep the table ordered; any position at or
+  // before the last memoized lexeme is already in the table.
+  if (impl->memo_count > 0u && position <= impl->memo[impl->memo_count - 1u].start) {
+    return RCL_RET_OK;
+  }
+  if (impl->memo_count >= impl->memo_capacity) {
+    size_t new_capacity = (0u == impl->memo_capacity) ? 8u : 2u * impl->memo_capacity;
+    rcl_lexer_lookahead2_memo_t * new_memo = impl->allocator.reallocate(
+      impl->memo, new_capacity * sizeof(rcl_lexer_lookahead2_memo_t), impl->allocator.state);
+    if (NULL == new_memo) {
+      // Memoization is an optimization; the analysis result is still valid.
+      return RCL_RET_OK;
+    }
+    impl->memo = new_memo;
+    impl->memo_capacity = new_capacity;
+  }
+  impl->memo[impl->memo_count].start = position;
+  impl->memo[impl->memo_count].end = position + *length;
+  impl->memo[impl->memo_count].type = *type;
+  ++impl->memo_count;
+  return RCL_RET_OK;
+}
+
 rcl_lexer_lookahead2_t
 rcl_get_zero_initialized_lexer_lookahead2()
 {
@@ -71,6 +151,9 @@ rcl_lexer_lookahead2_init(
   buffer->impl->end[1] = 0u;
   buffer->impl->type[0] = RCL_LEXEME_NONE;
   buffer->impl->type[1] = RCL_LEXEME_NONE;
+  buffer->impl->memo = NULL;
+  buffer->impl->memo_count = 0u;
+  buffer->impl->memo_capacity = 0u;
   buffer->impl->allocator = allocator;
 
   return RCL_RET_OK;
@@ -86,6 +169,9 @@ rcl_lexer_lookahead2_fini(
   RCL_CHECK_ALLOCATOR_WITH_MSG(
     &(buffer->impl->allocator), "invalid allocator", return RCL_RET_INVALID_ARGUMENT);
 
+  if (NULL != buffer->impl->memo) {
+    buffer->impl->allocator.deallocate(buffer->impl->memo, buffer->impl->allocator.state);
+  }
   buffer->impl->allocator.deallocate(buffer->impl, buffer->impl->allocator.state);
   buffer->impl = NULL;
   return RCL_RET_OK;
@@ -108,8 +194,9 @@ rcl_lexer_lookahead2_peek(
 
   if (buffer->impl->text_idx >= buffer->impl->end[0]) {
     // No buffered lexeme; get one
-    ret = rcl_lexer_analyze(
-      rcl_lexer_lookahead2_get_text(buffer),
+    ret = __lookahead2_analyze(
+      buffer->impl,
+      buffer->impl->text_idx,
       &(buffer->impl->type[0]),
       &length);
 
@@ -151,8 +238,9 @@ rcl_lexer_lookahead2_peek2(
 
   if (buffer->impl->text_idx >= buffer->impl->end[1]) {
     // No buffered lexeme; get one
-    ret = rcl_lexer_analyze(
-      &(buffer->impl->text[buffer->impl->end[0]]),
+    ret = __lookahead2_analyze(
+      buffer->impl,
+      buffer->impl->end[0],
       &(buffer->impl->type[1]),
       &length);
 
@@ -249,6 +337,65 @@ rcl_lexer_lookahead2_expect(
   return rcl_lexer_lookahead2_accept(buffer, lexeme_text, lexeme_text_length);
 }
 
+rcl_ret_t
+rcl_lexer_lookahead2_tokenize(
+  rcl_lexer_lookahead2_t * buffer,
+  size_t * lexeme_count)
+{
+  RCUTILS_CAN_SET_MSG_AND_RETURN_WITH_ERROR_OF(RCL_RET_INVALID_ARGUMENT);
+
+  RCL_CHECK_ARGUMENT_FOR_NULL(buffer, RCL_RET_INVALID_ARGUMENT);
+  RCL_CHECK_FOR_NULL_WITH_MSG(
+    buffer->impl, "buffer not initialized", return RCL_RET_INVALID_ARGUMENT);
+
+  rcl_lexer_lookahead2_impl_t * impl = buffer->impl;
+  size_t position = 0u;
+  if (impl->memo_count > 0u) {
+    position = impl->memo[impl->memo_count - 1u].end;
+  }
+
+  rcl_lexeme_t type;
+  size_t length;
+  do {
+    rcl_ret_t ret = __lookahead2_analyze(impl, position, &type, &length);
+    if (RCL_RET_OK != ret) {
+      return ret;
+    }
+    position += length;
+  } while (RCL_LEXEME_NONE != type && RCL_LEXEME_EOF != type);
+
+  if (NULL != lexeme_count) {
+    *lexeme_count = impl->memo_count;
+  }
+  return RCL_RET_OK;
+}
+
+rcl_ret_t
+rcl_lexer_lookahead2_rewind(
+  rcl_lexer_lookahead2_t * buffer,
+  size_t position)
+{
+  RCUTILS_CAN_SET_MSG_AND_RETURN_WITH_ERROR_OF(RCL_RET_INVALID_ARGUMENT);
+
+  RCL_CHECK_ARGUMENT_FOR_NULL(buffer, RCL_RET_INVALID_ARGUMENT);
+  RCL_CHECK_FOR_NULL_WITH_MSG(
+    buffer->impl, "buffer not initialized", return RCL_RET_INVALID_ARGUMENT);
+
+  if (0u != position && NULL == __lookahead2_memo_find(buffer->impl, position)) {
+    RCL_SET_ERROR_MSG("position is not the start of a previously analyzed lexeme");
+    return RCL_RET_INVALID_ARGUMENT;
+  }
+
+  buffer->impl->text_idx = position;
+  buffer->impl->start[0] = 0u;
+  buffer->impl->start[1] = 0u;
+  buffer->impl->end[0] = 0u;
+  buffer->impl->end[1] = 0u;
+  buffer->impl->type[0] = RCL_LEXEME_NONE;
+  buffer->impl->type[1] = RCL_LEXEME_NONE;
+  return RCL_RET_OK;
+}
+
 const char *
 rcl_lexer_lookahead2_get_text(
   const rcl_lexer_lookahead2_t * buffer)
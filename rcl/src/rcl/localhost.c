@@ -19,6 +19,7 @@
 
 #include "rcutils/env.h"
 
+#include "rcl/env_snapshot.h"
 #include "rcl/error_handling.h"
 #include "rcl/types.h"
 
@@ -28,18 +29,16 @@ rcl_ret_t
 rcl_get_localhost_only(rmw_localhost_only_t * localhost_only)
 {
   const char * ros_local_host_env_val = NULL;
-  const char * get_env_error_str = NULL;
 
   RCUTILS_CAN_SET_MSG_AND_RETURN_WITH_ERROR_OF(RCL_RET_INVALID_ARGUMENT);
   RCUTILS_CAN_SET_MSG_AND_RETURN_WITH_ERROR_OF(RCL_RET_ERROR);
   RCL_CHECK_ARGUMENT_FOR_NULL(localhost_only, RCL_RET_INVALID_ARGUMENT);
 
-  get_env_error_str = rcutils_get_env(RCL_LOCALHOST_ENV_VAR, &ros_local_host_env_val);
-  if (NULL != get_env_error_str) {
-    RCL_SET_ERROR_MSG_WITH_FORMAT_STRING(
-      "Error getting env var '" RCUTILS_STRINGIFY(RCL_LOCALHOST_ENV_VAR) "': %s\n",
-      get_env_error_str);
-    return RCL_RET_ERROR;
+  // Read from the process-wide snapshot instead of the environment, so that
+  // concurrent context creation does not serialize on the libc env lock.
+  rcl_ret_t ret = rcl_env_snapshot_get_value(RCL_LOCALHOST_ENV_VAR, &ros_local_host_env_val);
+  if (RCL_RET_OK != ret) {
+    return ret;
   }
   if (ros_local_host_env_val == NULL || ros_local_host_env_val[0] == '\0') {
     *localhost_only = RMW_LOCALHOST_ONLY_DEFAULT;
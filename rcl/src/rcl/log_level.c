@@ -14,8 +14,11 @@
 
 #include "rcl/log_level.h"
 
+#include <string.h>
+
 #include "rcl/error_handling.h"
 #include "rcutils/allocator.h"
+#include "rcutils/logging.h"
 #include "rcutils/logging_macros.h"
 #include "rcutils/strdup.h"
 
@@ -27,6 +30,7 @@ rcl_get_zero_initialized_log_levels()
     .logger_settings = NULL,
     .num_logger_settings = 0,
     .capacity_logger_settings = 0,
+    .sorted_order = NULL,
     .allocator = {NULL, NULL, NULL, NULL, NULL},
   };
   return log_levels;
@@ -47,6 +51,7 @@ rcl_log_levels_init(
   log_levels->logger_settings = NULL;
   log_levels->num_logger_settings = 0;
   log_levels->capacity_logger_settings = logger_count;
+  log_levels->sorted_order = NULL;
   log_levels->allocator = *allocator;
 
   if (logger_count > 0) {
@@ -81,6 +86,8 @@ rcl_log_levels_copy(const rcl_log_levels_t * src, rcl_log_levels_t * dst)
 
   dst->default_logger_level = src->default_logger_level;
   dst->capacity_logger_settings = src->capacity_logger_settings;
+  // the copy can rebuild the index on demand
+  dst->sorted_order = NULL;
   dst->allocator = src->allocator;
   for (size_t i = 0; i < src->num_logger_settings; ++i) {
     dst->logger_settings[i].name =
@@ -114,6 +121,10 @@ rcl_log_levels_fini(rcl_log_levels_t * log_levels)
     allocator->deallocate(log_levels->logger_settings, allocator->state);
     log_levels->logger_settings = NULL;
   }
+  if (log_levels->sorted_order) {
+    allocator->deallocate(log_levels->sorted_order, allocator->state);
+    log_levels->sorted_order = NULL;
+  }
   return RCL_RET_OK;
 }
 
@@ -181,5 +192,129 @@ rcl_log_levels_add_logger_setting(
   logger_setting->name = name;
   logger_setting->level = log_level;
   log_levels->num_logger_settings += 1;
+  // a new name changes the sorted order; drop the index so it gets rebuilt
+  if (log_levels->sorted_order) {
+    allocator->deallocate(log_levels->sorted_order, allocator->state);
+    log_levels->sorted_order = NULL;
+  }
+  return RCL_RET_OK;
+}
+
+/// Compare a stored logger name against the first name_length bytes of
+/// logger_name, as if the latter were truncated to that length.
+static int
+_rcl_log_levels_compare_truncated(
+  const char * setting_name, const char * logger_name, size_t name_length)
+{
+  int cmp = strncmp(setting_name, logger_name, name_length);
+  if (0 != cmp) {
+    return cmp;
+  }
+  return (int)(unsigned char)setting_name[name_length];
+}
+
+/// Find the setting whose name equals logger_name truncated to name_length.
+static const rcl_logger_setting_t *
+_rcl_log_levels_find(
+  const rcl_log_levels_t * log_levels, const char * logger_name, size_t name_length)
+{
+  if (log_levels->sorted_order) {
+    size_t low = 0;
+    size_t high = log_levels->num_logger_settings;
+    while (low < high) {
+      size_t mid = low + (high - low) / 2;
+      const rcl_logger_setting_t * setting =
+        &log_levels->logger_settings[log_levels->sorted_order[mid]];
+      int cmp = _rcl_log_levels_compare_truncated(setting->name, logger_name, name_length);
+      if (0 == cmp) {
+        return setting;
+      }
+      if (cmp < 0) {
+        low = mid + 1;
+      } else {
+        high = mid;
+      }
+    }
+    return NULL;
+  }
+  for (size_t i = 0; i < log_levels->num_logger_settings; ++i) {
+    const rcl_logger_setting_t * setting = &log_levels->logger_settings[i];
+    if (0 == _rcl_log_levels_compare_truncated(setting->name, logger_name, name_length)) {
+      return setting;
+    }
+  }
+  return NULL;
+}
+
+rcl_ret_t
+rcl_log_levels_build_index(rcl_log_levels_t * log_levels)
+{
+  RCL_CHECK_ARGUMENT_FOR_NULL(log_levels, RCL_RET_INVALID_ARGUMENT);
+  rcl_allocator_t * allocator = &log_levels->allocator;
+  RCL_CHECK_ALLOCATOR_WITH_MSG(allocator, "invalid allocator", return RCL_RET_INVALID_ARGUMENT);
+
+  if (log_levels->sorted_order) {
+    allocator->deallocate(log_levels->sorted_order, allocator->state);
+    log_levels->sorted_order = NULL;
+  }
+  if (0U == log_levels->num_logger_settings) {
+    return RCL_RET_OK;
+  }
+
+  size_t * sorted_order = allocator->allocate(
+    sizeof(size_t) * log_levels->num_logger_settings, allocator->state);
+  if (NULL == sorted_order) {
+    RCL_SET_ERROR_MSG("Error allocating memory");
+    return RCL_RET_BAD_ALLOC;
+  }
+  for (size_t i = 0; i < log_levels->num_logger_settings; ++i) {
+    sorted_order[i] = i;
+  }
+  // insertion sort by name; the settings count is small and set once
+  for (size_t i = 1; i < log_levels->num_logger_settings; ++i) {
+    size_t key = sorted_order[i];
+    size_t j = i;
+    while (j > 0 &&
+      strcmp(
+        log_levels->logger_settings[sorted_order[j - 1]].name,
+        log_levels->logger_settings[key].name) > 0)
+    {
+      sorted_order[j] = sorted_order[j - 1];
+      --j;
+    }
+    sorted_order[j] = key;
+  }
+  log_levels->sorted_order = sorted_order;
+  return RCL_RET_OK;
+}
+
+rcl_ret_t
+rcl_log_levels_resolve(
+  const rcl_log_levels_t * log_levels, const char * logger_name, rcl_log_severity_t * level)
+{
+  RCL_CHECK_ARGUMENT_FOR_NULL(log_levels, RCL_RET_INVALID_ARGUMENT);
+  RCL_CHECK_ARGUMENT_FOR_NULL(logger_name, RCL_RET_INVALID_ARGUMENT);
+  RCL_CHECK_ARGUMENT_FOR_NULL(level, RCL_RET_INVALID_ARGUMENT);
+
+  *level = log_levels->default_logger_level;
+  size_t name_length = strlen(logger_name);
+  // try the full name first, then successively shorter dotted ancestors
+  while (name_length > 0) {
+    const rcl_logger_setting_t * setting =
+      _rcl_log_levels_find(log_levels, logger_name, name_length);
+    if (NULL != setting) {
+      *level = setting->level;
+      return RCL_RET_OK;
+    }
+    while (name_length > 0 &&
+      logger_name[name_length - 1] != RCUTILS_LOGGING_SEPARATOR_STRING[0])
+    {
+      --name_length;
+    }
+    if (name_length > 0) {
+      // drop the separator itself
+      --name_length;
+    }
+  }
   return RCL_RET_OK;
 }
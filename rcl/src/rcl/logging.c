@@ -19,6 +19,7 @@ extern "C"
 
 #include <ctype.h>
 #include <inttypes.h>
+#include <stdarg.h>
 #include <stdint.h>
 #include <string.h>
 
@@ -31,6 +32,7 @@ extern "C"
 #include "rcl/macros.h"
 #include "rcutils/logging.h"
 #include "rcutils/time.h"
+#include "rcutils/types/char_array.h"
 
 #define RCL_LOGGING_MAX_OUTPUT_FUNCS (4)
 
@@ -38,6 +40,12 @@ static rcutils_logging_output_handler_t
   g_rcl_logging_out_handlers[RCL_LOGGING_MAX_OUTPUT_FUNCS] = {0};
 
 static uint8_t g_rcl_logging_num_out_handlers = 0;
+// Minimum severity each registered handler will act on; messages below it are
+// dropped by the sink anyway, so dispatch can skip the handler entirely.
+static int g_rcl_logging_handler_min_severity[RCL_LOGGING_MAX_OUTPUT_FUNCS] = {0};
+// Bitmap of handler indices to call, indexed by severity / 10.
+#define RCL_LOGGING_SEVERITY_BITMAP_SIZE ((RCUTILS_LOG_SEVERITY_FATAL / 10) + 1)
+static uint8_t g_rcl_logging_severity_bitmaps[RCL_LOGGING_SEVERITY_BITMAP_SIZE] = {0};
 static rcl_allocator_t g_logging_allocator;
 static bool g_rcl_logging_stdout_enabled = false;
 static bool g_rcl_logging_rosout_enabled = false;
@@ -53,6 +61,37 @@ rcl_logging_ext_lib_output_handler(
   int severity, const char * name, rcutils_time_point_value_t timestamp,
   const char * format, va_list * args);
 
+/**
+ * An output function that sends an already formatted message to the external
+ * logger library.
+ */
+static
+void
+rcl_logging_ext_lib_output_preformatted(
+  const rcutils_log_location_t * location,
+  int severity, const char * name, rcutils_time_point_value_t timestamp,
+  const char * msg);
+
+/// Precompute, for every severity, which handlers want the message.
+static
+void
+rcl_logging_rebuild_severity_bitmaps(void)
+{
+  for (int severity_index = 0; severity_index < RCL_LOGGING_SEVERITY_BITMAP_SIZE;
+    ++severity_index)
+  {
+    uint8_t bitmap = 0;
+    for (uint8_t i = 0;
+      i < g_rcl_logging_num_out_handlers && NULL != g_rcl_logging_out_handlers[i]; ++i)
+    {
+      if (severity_index * 10 >= g_rcl_logging_handler_min_severity[i]) {
+        bitmap |= (uint8_t)(1u << i);
+      }
+    }
+    g_rcl_logging_severity_bitmaps[severity_index] = bitmap;
+  }
+}
+
 rcl_ret_t
 rcl_logging_configure_with_output_handler(
   const rcl_arguments_t * global_args,
@@ -87,14 +126,23 @@ rcl_logging_configure_with_output_handler(
         return RCL_RET_ERROR;
       }
     }
+
+    // build the lookup index once so later per-logger resolution is fast
+    status = rcl_log_levels_build_index(log_levels);
+    if (RCL_RET_OK != status) {
+      return status;
+    }
   }
   if (g_rcl_logging_stdout_enabled) {
+    // The console sink relies on the rcutils severity filter upstream.
+    g_rcl_logging_handler_min_severity[g_rcl_logging_num_out_handlers] = 0;
     g_rcl_logging_out_handlers[g_rcl_logging_num_out_handlers++] =
       rcutils_logging_console_output_handler;
   }
   if (g_rcl_logging_rosout_enabled) {
     status = rcl_logging_rosout_init(allocator);
     if (RCL_RET_OK == status) {
+      g_rcl_logging_handler_min_severity[g_rcl_logging_num_out_handlers] = 0;
       g_rcl_logging_out_handlers[g_rcl_logging_num_out_handlers++] =
         rcl_logging_rosout_output_handler;
     }
@@ -107,10 +155,15 @@ rcl_logging_configure_with_output_handler(
       if (RCL_LOGGING_RET_OK != logging_status) {
         status = RCL_RET_ERROR;
       }
+      // The external library drops messages below its configured level
+      // internally; skipping the handler saves formatting them at all.
+      g_rcl_logging_handler_min_severity[g_rcl_logging_num_out_handlers] =
+        default_level > 0 ? default_level : 0;
       g_rcl_logging_out_handlers[g_rcl_logging_num_out_handlers++] =
         rcl_logging_ext_lib_output_handler;
     }
   }
+  rcl_logging_rebuild_severity_bitmaps();
   rcutils_logging_set_output_handler(output_handler);
   return status;
 }
@@ -132,6 +185,8 @@ rcl_ret_t rcl_logging_fini(void)
   // the `g_rcl_logging_num_out_handlers` and `g_rcl_logging_out_handlers` must be updated.
   g_rcl_logging_num_out_handlers = 1;
   g_rcl_logging_out_handlers[0] = rcutils_logging_console_output_handler;
+  g_rcl_logging_handler_min_severity[0] = 0;
+  rcl_logging_rebuild_severity_bitmaps();
 
   if (g_rcl_logging_rosout_enabled) {
     status = rcl_logging_rosout_fini();
@@ -148,19 +203,136 @@ bool rcl_logging_rosout_enabled(void)
   return g_rcl_logging_rosout_enabled;
 }
 
+/// Call an output handler with an already formatted message.
+static
+void
+rcl_logging_forward_formatted_message(
+  rcutils_logging_output_handler_t handler,
+  const rcutils_log_location_t * location,
+  int severity, const char * name, rcutils_time_point_value_t timestamp,
+  const char * format, ...)
+{
+  va_list args;
+  va_start(args, format);
+  handler(location, severity, name, timestamp, format, &args);
+  va_end(args);
+}
+
 void
 rcl_logging_multiple_output_handler(
   const rcutils_log_location_t * location,
   int severity, const char * name, rcutils_time_point_value_t timestamp,
   const char * format, va_list * args)
 {
+  int severity_index = severity / 10;
+  if (severity_index < 0) {
+    severity_index = 0;
+  } else if (severity_index >= RCL_LOGGING_SEVERITY_BITMAP_SIZE) {
+    severity_index = RCL_LOGGING_SEVERITY_BITMAP_SIZE - 1;
+  }
+  const uint8_t bitmap = g_rcl_logging_severity_bitmaps[severity_index];
+  if (0u == bitmap) {
+    return;
+  }
+  uint8_t num_active_handlers = 0;
+  for (uint8_t bits = bitmap; 0u != bits; bits &= (uint8_t)(bits - 1u)) {
+    ++num_active_handlers;
+  }
+  if (num_active_handlers > 1) {
+    // With several sinks each handler would format the same arguments
+    // independently; format the user message once here and hand every sink
+    // the result through a trivial "%s" pass-through instead.
+    char msg_buf[1024] = "";
+    rcutils_char_array_t msg_array = {
+      .buffer = msg_buf,
+      .owns_buffer = false,
+      .buffer_length = 0u,
+      .buffer_capacity = sizeof(msg_buf),
+      .allocator = g_logging_allocator
+    };
+    rcutils_ret_t status = rcutils_char_array_vsprintf(&msg_array, format, *args);
+    if (RCUTILS_RET_OK == status) {
+      for (uint8_t i = 0;
+        i < g_rcl_logging_num_out_handlers && NULL != g_rcl_logging_out_handlers[i]; ++i)
+      {
+        if (0u == (bitmap & (uint8_t)(1u << i))) {
+          continue;
+        }
+        // The sinks rcl owns consume the shared buffer directly; only
+        // handlers with the rcutils signature need the "%s" pass-through,
+        // and formatting that costs one more copy inside the sink.
+        if (rcl_logging_rosout_output_handler == g_rcl_logging_out_handlers[i]) {
+          rcl_logging_rosout_output_handler_preformatted(
+            location, severity, name, timestamp, msg_array.buffer);
+        } else if (rcl_logging_ext_lib_output_handler == g_rcl_logging_out_handlers[i]) {
+          rcl_logging_ext_lib_output_preformatted(
+            location, severity, name, timestamp, msg_array.buffer);
+        } else {
+          rcl_logging_forward_formatted_message(
+            g_rcl_logging_out_handlers[i], location, severity, name, timestamp,
+            "%s", msg_array.buffer);
+        }
+      }
+    }
+    if (RCUTILS_RET_OK != rcutils_char_array_fini(&msg_array)) {
+      RCUTILS_SAFE_FWRITE_TO_STDERR("failed to finalize char array: ");
+      RCUTILS_SAFE_FWRITE_TO_STDERR(rcutils_get_error_string().str);
+      rcutils_reset_error();
+      RCUTILS_SAFE_FWRITE_TO_STDERR("\n");
+    }
+    if (RCUTILS_RET_OK == status) {
+      return;
+    }
+    // Formatting failed; fall through and let each sink try for itself.
+    rcutils_reset_error();
+  }
   for (uint8_t i = 0;
     i < g_rcl_logging_num_out_handlers && NULL != g_rcl_logging_out_handlers[i]; ++i)
   {
+    if (0u == (bitmap & (uint8_t)(1u << i))) {
+      continue;
+    }
     g_rcl_logging_out_handlers[i](location, severity, name, timestamp, format, args);
   }
 }
 
+static
+void
+rcl_logging_ext_lib_output_preformatted(
+  const rcutils_log_location_t * location,
+  int severity,
+  const char * name,
+  rcutils_time_point_value_t timestamp,
+  const char * msg)
+{
+  rcl_ret_t status;
+  char output_buf[1024] = "";
+  rcutils_char_array_t output_array = {
+    .buffer = output_buf,
+    .owns_buffer = false,
+    .buffer_length = 0u,
+    .buffer_capacity = sizeof(output_buf),
+    .allocator = g_logging_allocator
+  };
+
+  status = rcutils_logging_format_message(
+    location, severity, name, timestamp, msg, &output_array);
+  if (RCL_RET_OK != status) {
+    RCUTILS_SAFE_FWRITE_TO_STDERR("failed to format log message: ");
+    RCUTILS_SAFE_FWRITE_TO_STDERR(rcl_get_error_string().str);
+    rcl_reset_error();
+    RCUTILS_SAFE_FWRITE_TO_STDERR("\n");
+  }
+  rcl_logging_external_log(severity, name, output_array.buffer);
+  status = rcutils_char_array_fini(&output_array);
+  if (RCL_RET_OK != status) {
+    RCUTILS_SAFE_FWRITE_TO_STDERR("failed to finalize char array: ");
+    RCUTILS_SAFE_FWRITE_TO_STDERR(rcl_get_error_string().str);
+    rcl_reset_error();
+    RCUTILS_SAFE_FWRITE_TO_STDERR("\n");
+  }
+}
+
 static
 void
 rcl_logging_ext_lib_output_handler(
@@ -181,33 +353,16 @@ rcl_logging_ext_lib_output_handler(
     .allocator = g_logging_allocator
   };
 
-  char output_buf[1024] = "";
-  rcutils_char_array_t output_array = {
-    .buffer = output_buf,
-    .owns_buffer = false,
-    .buffer_length = 0u,
-    .buffer_capacity = sizeof(output_buf),
-    .allocator = g_logging_allocator
-  };
-
   status = rcutils_char_array_vsprintf(&msg_array, format, *args);
-
   if (RCL_RET_OK == status) {
-    status = rcutils_logging_format_message(
-      location, severity, name, timestamp, msg_array.buffer, &output_array);
-    if (RCL_RET_OK != status) {
-      RCUTILS_SAFE_FWRITE_TO_STDERR("failed to format log message: ");
-      RCUTILS_SAFE_FWRITE_TO_STDERR(rcl_get_error_string().str);
-      rcl_reset_error();
-      RCUTILS_SAFE_FWRITE_TO_STDERR("\n");
-    }
+    rcl_logging_ext_lib_output_preformatted(
+      location, severity, name, timestamp, msg_array.buffer);
   } else {
     RCUTILS_SAFE_FWRITE_TO_STDERR("failed to format user log message: ");
     RCUTILS_SAFE_FWRITE_TO_STDERR(rcl_get_error_string().str);
     rcl_reset_error();
     RCUTILS_SAFE_FWRITE_TO_STDERR("\n");
   }
-  rcl_logging_external_log(severity, name, output_array.buffer);
   status = rcutils_char_array_fini(&msg_array);
   if (RCL_RET_OK != status) {
     RCUTILS_SAFE_FWRITE_TO_STDERR("failed to finalize char array: ");
@@ -215,13 +370,6 @@ rcl_logging_ext_lib_output_handler(
     rcl_reset_error();
     RCUTILS_SAFE_FWRITE_TO_STDERR("\n");
   }
-  status = rcutils_char_array_fini(&output_array);
-  if (RCL_RET_OK != status) {
-    RCUTILS_SAFE_FWRITE_TO_STDERR("failed to finalize char array: ");
-    RCUTILS_SAFE_FWRITE_TO_STDERR(rcl_get_error_string().str);
-    rcl_reset_error();
-    RCUTILS_SAFE_FWRITE_TO_STDERR("\n");
-  }
 }
 
 #ifdef __cplusplus
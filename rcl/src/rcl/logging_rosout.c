@@ -25,6 +25,10 @@
 #include "rcutils/format_string.h"
 #include "rcutils/logging_macros.h"
 #include "rcutils/macros.h"
+#include "rcutils/snprintf.h"
+#include "rcutils/stdatomic_helper.h"
+#include "rcutils/strdup.h"
+#include "rcutils/types/char_array.h"
 #include "rcutils/types/hash_map.h"
 #include "rcutils/types/rcutils_ret.h"
 #include "rosidl_runtime_c/string_functions.h"
@@ -75,6 +79,44 @@ typedef struct rosout_map_entry_t
 static rcutils_hash_map_t __logger_map;
 static bool __is_initialized = false;
 static rcl_allocator_t __rosout_allocator;
+// Reusable buffer for formatted log messages, preallocated at init.
+// It grows on demand and keeps its grown capacity, so steady-state logging
+// does not allocate.  Sharing one buffer is fine because the output handler
+// is not thread-safe (see rcl/logging_rosout.h).
+static rcutils_char_array_t __rosout_msg_array;
+
+#define ROSOUT_ASYNC_NAME_BUFFER_SIZE 256
+#define ROSOUT_ASYNC_FILE_BUFFER_SIZE 256
+#define ROSOUT_ASYNC_FUNCTION_BUFFER_SIZE 128
+
+/// One slot of the bounded lock-free ring used for asynchronous publishing.
+/**
+ * The ring is a Vyukov bounded MPMC queue: producers claim a slot by
+ * advancing the head with a compare-and-swap and publish it by storing
+ * sequence = claim position + 1; the consumer recycles a drained slot by
+ * storing sequence = position + capacity.
+ */
+typedef struct rosout_async_entry_t
+{
+  atomic_uint_least64_t sequence;
+  int severity;
+  rcutils_time_point_value_t timestamp;
+  size_t line_number;
+  char name[ROSOUT_ASYNC_NAME_BUFFER_SIZE];
+  char file[ROSOUT_ASYNC_FILE_BUFFER_SIZE];
+  char function[ROSOUT_ASYNC_FUNCTION_BUFFER_SIZE];
+  char msg[RCL_LOGGING_ROSOUT_DEFAULT_MSG_BUFFER_SIZE];
+} rosout_async_entry_t;
+
+static bool __async_enabled = false;
+static rosout_async_entry_t * __async_ring = NULL;
+static uint64_t __async_ring_mask = 0;
+static atomic_uint_least64_t __async_head;
+// Atomic because with the drop-oldest policy full producers discard from the
+// tail concurrently with the flusher.
+static atomic_uint_least64_t __async_tail;
+static atomic_uint_least64_t __async_num_dropped;
+static rcl_logging_rosout_drop_policy_t __async_drop_policy = RCL_LOGGING_ROSOUT_DROP_NEWEST;
 
 typedef struct rosout_sublogger_entry_t
 {
@@ -86,6 +128,56 @@ typedef struct rosout_sublogger_entry_t
 
 static rcutils_hash_map_t __sublogger_map;
 
+// Memo of the most recently looked up logger entry.  Consecutive log lines
+// usually come from the same logger, so one slot skips most per-line hash
+// lookups.  Log calls are serialized by the logging system's caller (the
+// output handler is not thread-safe), so no synchronization is needed.
+#define ROSOUT_ENTRY_CACHE_NAME_SIZE 256
+static char __entry_cache_name[ROSOUT_ENTRY_CACHE_NAME_SIZE];
+static rosout_map_entry_t __entry_cache_entry;
+static bool __entry_cache_valid = false;
+
+// Bumped on every logger map mutation; borrowed logger handles compare it to
+// decide whether their cached entry is still valid.
+static uint64_t __logger_map_generation = 0;
+
+/// Record that the logger map changed: drop the memo slot and invalidate
+/// every borrowed logger handle.
+static void
+_rcl_logging_rosout_note_map_changed(void)
+{
+  __entry_cache_valid = false;
+  ++__logger_map_generation;
+}
+
+/// \internal Resolved logger-name -> publisher entry retained by a caller.
+struct rcl_logging_rosout_logger_handle_s
+{
+  char * logger_name;
+  rosout_map_entry_t entry;
+  bool entry_valid;
+  uint64_t generation;
+};
+
+/// Look up the rosout publisher entry for a logger name, memoizing the result.
+static rcutils_ret_t
+_rcl_logging_rosout_get_entry(const char * name, rosout_map_entry_t * entry)
+{
+  if (__entry_cache_valid && 0 == strcmp(__entry_cache_name, name)) {
+    *entry = __entry_cache_entry;
+    return RCUTILS_RET_OK;
+  }
+  rcutils_ret_t rcutils_ret = rcutils_hash_map_get(&__logger_map, &name, entry);
+  if (RCUTILS_RET_OK == rcutils_ret && strlen(name) < sizeof(__entry_cache_name)) {
+    // Only successful lookups are cached, so adding entries for new names
+    // never requires invalidation; removals do.
+    (void)rcutils_snprintf(__entry_cache_name, sizeof(__entry_cache_name), "%s", name);
+    __entry_cache_entry = *entry;
+    __entry_cache_valid = true;
+  }
+  return rcutils_ret;
+}
+
 rcl_ret_t rcl_logging_rosout_init(const rcl_allocator_t * allocator)
 {
   RCL_CHECK_ARGUMENT_FOR_NULL(allocator, RCL_RET_INVALID_ARGUMENT);
@@ -118,6 +210,25 @@ rcl_ret_t rcl_logging_rosout_init(const rcl_allocator_t * allocator)
     return status;
   }
 
+  __rosout_msg_array = rcutils_get_zero_initialized_char_array();
+  status = rcl_ret_from_rcutils_ret(
+    rcutils_char_array_init(
+      &__rosout_msg_array, RCL_LOGGING_ROSOUT_DEFAULT_MSG_BUFFER_SIZE, allocator));
+  if (RCL_RET_OK != status) {
+    rcl_ret_t fini_status = rcl_ret_from_rcutils_ret(rcutils_hash_map_fini(&__sublogger_map));
+    if (RCL_RET_OK == fini_status) {
+      fini_status = rcl_ret_from_rcutils_ret(rcutils_hash_map_fini(&__logger_map));
+    }
+    if (RCL_RET_OK != fini_status) {
+      RCUTILS_SAFE_FWRITE_TO_STDERR("Failed to finalize a hash map: ");
+      RCUTILS_SAFE_FWRITE_TO_STDERR(rcl_get_error_string().str);
+      rcl_reset_error();
+      RCUTILS_SAFE_FWRITE_TO_STDERR("\n");
+    }
+    return status;
+  }
+
+  _rcl_logging_rosout_note_map_changed();
   __rosout_allocator = *allocator;
   __is_initialized = true;
 
@@ -129,6 +240,8 @@ _rcl_logging_rosout_remove_logger_map(rcl_node_t * node)
 {
   RCL_CHECK_ARGUMENT_FOR_NULL(node, RCL_RET_INVALID_ARGUMENT);
 
+  _rcl_logging_rosout_note_map_changed();
+
   rcl_ret_t status = RCL_RET_OK;
   char * previous_key = NULL;
   char * key = NULL;
@@ -213,6 +326,12 @@ rcl_ret_t rcl_logging_rosout_fini()
   rosout_map_entry_t entry;
   rosout_sublogger_entry_t sublogger_entry;
 
+  // Flush and free the asynchronous ring while the publishers are still valid
+  status = rcl_logging_rosout_disable_async_publishing();
+  if (RCL_RET_OK != status) {
+    return status;
+  }
+
   status = _rcl_logging_rosout_clear_hashmap(
     &__logger_map, _rcl_logging_rosout_clear_logger_map_item, &entry);
   if (RCL_RET_OK != status) {
@@ -225,6 +344,11 @@ rcl_ret_t rcl_logging_rosout_fini()
     return status;
   }
 
+  status = rcl_ret_from_rcutils_ret(rcutils_char_array_fini(&__rosout_msg_array));
+  if (RCL_RET_OK != status) {
+    return status;
+  }
+
   __is_initialized = false;
 
   return status;
@@ -280,6 +404,7 @@ rcl_ret_t rcl_logging_rosout_init_publisher_for_node(rcl_node_t * node)
     new_entry.node = node;
     status = rcl_ret_from_rcutils_ret(
       rcutils_hash_map_set(&__logger_map, &logger_name, &new_entry));
+    _rcl_logging_rosout_note_map_changed();
     if (RCL_RET_OK != status) {
       RCL_SET_ERROR_MSG("Failed to add publisher to map.");
       // We failed to add to the map so destroy the publisher that we created
@@ -333,6 +458,152 @@ static void shallow_assign(rosidl_runtime_c__String * target, const char * sourc
   target->capacity = len + 1;
 }
 
+/// Copy a string into a fixed-size slot buffer, truncating if necessary.
+static void
+_rcl_logging_rosout_copy_truncated(char * buffer, size_t buffer_size, const char * source)
+{
+  if (rcutils_snprintf(buffer, buffer_size, "%s", source) < 0) {
+    buffer[0] = '\0';
+  }
+}
+
+/// Discard the oldest queued record to make room for a new one.
+static void
+_rcl_logging_rosout_async_discard_oldest(void)
+{
+  uint64_t pos = rcutils_atomic_load_uint64_t(&__async_tail);
+  for (;;) {
+    rosout_async_entry_t * entry = &__async_ring[pos & __async_ring_mask];
+    uint64_t seq = rcutils_atomic_load_uint64_t(&entry->sequence);
+    if (seq != pos + 1) {
+      // the ring drained in the meantime or the slot is still being written
+      return;
+    }
+    bool exchanged = false;
+    uint64_t expected = pos;
+    rcutils_atomic_compare_exchange_strong(&__async_tail, exchanged, &expected, pos + 1);
+    if (exchanged) {
+      rcutils_atomic_store(&entry->sequence, pos + __async_ring_mask + 1);
+      rcutils_atomic_fetch_add_uint64_t(&__async_num_dropped, 1);
+      return;
+    }
+    pos = expected;
+  }
+}
+
+/// Claim a ring slot, format the log record into it and publish the slot.
+/**
+ * Returns false if the ring was full and the record was dropped.
+ */
+static bool
+_rcl_logging_rosout_async_enqueue(
+  const rcutils_log_location_t * location,
+  int severity,
+  const char * name,
+  rcutils_time_point_value_t timestamp,
+  const char * format,
+  va_list * args)
+{
+  rosout_async_entry_t * entry = NULL;
+  uint64_t pos = rcutils_atomic_load_uint64_t(&__async_head);
+  for (;;) {
+    entry = &__async_ring[pos & __async_ring_mask];
+    uint64_t seq = rcutils_atomic_load_uint64_t(&entry->sequence);
+    int64_t dif = (int64_t)seq - (int64_t)pos;
+    if (0 == dif) {
+      bool exchanged = false;
+      uint64_t expected = pos;
+      rcutils_atomic_compare_exchange_strong(&__async_head, exchanged, &expected, pos + 1);
+      if (exchanged) {
+        break;
+      }
+      pos = expected;
+    } else if (dif < 0) {
+      if (RCL_LOGGING_ROSOUT_DROP_OLDEST == __async_drop_policy) {
+        // The ring is full; make room by discarding the oldest record.
+        _rcl_logging_rosout_async_discard_oldest();
+        pos = rcutils_atomic_load_uint64_t(&__async_head);
+        continue;
+      }
+      // The ring is full; bounded-drop policy.
+      rcutils_atomic_fetch_add_uint64_t(&__async_num_dropped, 1);
+      return false;
+    } else {
+      pos = rcutils_atomic_load_uint64_t(&__async_head);
+    }
+  }
+
+  entry->severity = severity;
+  entry->timestamp = timestamp;
+  entry->line_number = location->line_number;
+  _rcl_logging_rosout_copy_truncated(entry->name, sizeof(entry->name), name);
+  _rcl_logging_rosout_copy_truncated(entry->file, sizeof(entry->file), location->file_name);
+  _rcl_logging_rosout_copy_truncated(
+    entry->function, sizeof(entry->function), location->function_name);
+  if (NULL == args) {
+    // format already is the final message (shared-record dispatch)
+    _rcl_logging_rosout_copy_truncated(entry->msg, sizeof(entry->msg), format);
+  } else if (rcutils_vsnprintf(entry->msg, sizeof(entry->msg), format, *args) < 0) {
+    entry->msg[0] = '\0';
+  }
+  // Mark the slot ready for the consumer.
+  rcutils_atomic_store(&entry->sequence, pos + 1);
+  return true;
+}
+
+/// Synchronously publish one already formatted log record on a resolved publisher.
+static void
+_rcl_logging_rosout_publish_msg_on_entry(
+  const rosout_map_entry_t * entry,
+  const rcutils_log_location_t * location,
+  int severity,
+  const char * name,
+  rcutils_time_point_value_t timestamp,
+  const char * msg)
+{
+  rcl_interfaces__msg__Log log_message;
+  log_message.stamp.sec = (int32_t) RCL_NS_TO_S(timestamp);
+  log_message.stamp.nanosec = (timestamp % RCL_S_TO_NS(1));
+  log_message.level = severity;
+  log_message.line = (int32_t) location->line_number;
+  shallow_assign(&log_message.name, name);
+  shallow_assign(&log_message.msg, msg);
+  shallow_assign(&log_message.file, location->file_name);
+  shallow_assign(&log_message.function, location->function_name);
+  rcl_ret_t status = rcl_publish(&entry->publisher, &log_message, NULL);
+  if (RCL_RET_OK != status) {
+    RCUTILS_SAFE_FWRITE_TO_STDERR("Failed to publish log message to rosout: ");
+    RCUTILS_SAFE_FWRITE_TO_STDERR(rcl_get_error_string().str);
+    rcl_reset_error();
+    RCUTILS_SAFE_FWRITE_TO_STDERR("\n");
+  }
+}
+
+/// Format and synchronously publish one log record on a resolved publisher.
+static void
+_rcl_logging_rosout_publish_on_entry(
+  const rosout_map_entry_t * entry,
+  const rcutils_log_location_t * location,
+  int severity,
+  const char * name,
+  rcutils_time_point_value_t timestamp,
+  const char * format,
+  va_list * args)
+{
+  __rosout_msg_array.buffer_length = 0u;
+  rcl_ret_t status = rcl_ret_from_rcutils_ret(
+    rcutils_char_array_vsprintf(&__rosout_msg_array, format, *args));
+  if (RCL_RET_OK != status) {
+    RCUTILS_SAFE_FWRITE_TO_STDERR("Failed to format log string: ");
+    RCUTILS_SAFE_FWRITE_TO_STDERR(rcl_get_error_string().str);
+    rcl_reset_error();
+    RCUTILS_SAFE_FWRITE_TO_STDERR("\n");
+    return;
+  }
+  _rcl_logging_rosout_publish_msg_on_entry(
+    entry, location, severity, name, timestamp, __rosout_msg_array.buffer);
+}
+
 void rcl_logging_rosout_output_handler(
   const rcutils_log_location_t * location,
   int severity,
@@ -342,38 +613,226 @@ void rcl_logging_rosout_output_handler(
   va_list * args)
 {
   rosout_map_entry_t entry;
-  rcl_ret_t status = RCL_RET_OK;
   if (!__is_initialized) {
     return;
   }
-  rcutils_ret_t rcutils_ret = rcutils_hash_map_get(&__logger_map, &name, &entry);
-  if (RCUTILS_RET_OK == rcutils_ret) {
-    char msg_buf[1024] = "";
-    rcutils_char_array_t msg_array = {
-      .buffer = msg_buf,
-      .owns_buffer = false,
-      .buffer_length = 0u,
-      .buffer_capacity = sizeof(msg_buf),
-      .allocator = __rosout_allocator
-    };
-
-    status = rcl_ret_from_rcutils_ret(rcutils_char_array_vsprintf(&msg_array, format, *args));
-    if (RCL_RET_OK != status) {
-      RCUTILS_SAFE_FWRITE_TO_STDERR("Failed to format log string: ");
-      RCUTILS_SAFE_FWRITE_TO_STDERR(rcl_get_error_string().str);
-      rcl_reset_error();
-      RCUTILS_SAFE_FWRITE_TO_STDERR("\n");
-    } else {
+  if (__async_enabled) {
+    // Formatting has to happen here because the va_list cannot outlive the
+    // call, but the rcl_publish() and the publisher lookup are deferred to
+    // rcl_logging_rosout_flush() so the caller never pays for them.
+    (void)_rcl_logging_rosout_async_enqueue(
+      location, severity, name, timestamp, format, args);
+    return;
+  }
+  if (RCUTILS_RET_OK == _rcl_logging_rosout_get_entry(name, &entry)) {
+    _rcl_logging_rosout_publish_on_entry(
+      &entry, location, severity, name, timestamp, format, args);
+  }
+}
+
+void rcl_logging_rosout_output_handler_preformatted(
+  const rcutils_log_location_t * location,
+  int severity,
+  const char * name,
+  rcutils_time_point_value_t timestamp,
+  const char * msg)
+{
+  rosout_map_entry_t entry;
+  if (!__is_initialized) {
+    return;
+  }
+  if (__async_enabled) {
+    (void)_rcl_logging_rosout_async_enqueue(
+      location, severity, name, timestamp, msg, NULL);
+    return;
+  }
+  if (RCUTILS_RET_OK == _rcl_logging_rosout_get_entry(name, &entry)) {
+    // The record was formatted by the caller; hand the buffer straight to the
+    // message without another copy.
+    _rcl_logging_rosout_publish_msg_on_entry(
+      &entry, location, severity, name, timestamp, msg);
+  }
+}
+
+rcl_ret_t
+rcl_logging_rosout_borrow_logger_handle(
+  const char * logger_name, rcl_logging_rosout_logger_handle_t ** logger_handle)
+{
+  RCL_CHECK_ARGUMENT_FOR_NULL(logger_name, RCL_RET_INVALID_ARGUMENT);
+  RCL_CHECK_ARGUMENT_FOR_NULL(logger_handle, RCL_RET_INVALID_ARGUMENT);
+  if (!__is_initialized) {
+    RCL_SET_ERROR_MSG("rcl_logging_rosout is not initialized");
+    return RCL_RET_NOT_INIT;
+  }
+
+  rcl_logging_rosout_logger_handle_t * handle = __rosout_allocator.allocate(
+    sizeof(rcl_logging_rosout_logger_handle_t), __rosout_allocator.state);
+  if (NULL == handle) {
+    RCL_SET_ERROR_MSG("Failed to allocate memory for a logger handle.");
+    return RCL_RET_BAD_ALLOC;
+  }
+  handle->logger_name = rcutils_strdup(logger_name, __rosout_allocator);
+  if (NULL == handle->logger_name) {
+    __rosout_allocator.deallocate(handle, __rosout_allocator.state);
+    RCL_SET_ERROR_MSG("Failed to copy the logger name for a logger handle.");
+    return RCL_RET_BAD_ALLOC;
+  }
+  // Resolve eagerly; a logger registered later is picked up through the
+  // generation check.
+  handle->entry_valid = (RCUTILS_RET_OK == rcutils_hash_map_get(
+      &__logger_map, &logger_name, &handle->entry));
+  handle->generation = __logger_map_generation;
+
+  *logger_handle = handle;
+  return RCL_RET_OK;
+}
+
+rcl_ret_t
+rcl_logging_rosout_return_logger_handle(rcl_logging_rosout_logger_handle_t * logger_handle)
+{
+  RCL_CHECK_ARGUMENT_FOR_NULL(logger_handle, RCL_RET_INVALID_ARGUMENT);
+  __rosout_allocator.deallocate(logger_handle->logger_name, __rosout_allocator.state);
+  __rosout_allocator.deallocate(logger_handle, __rosout_allocator.state);
+  return RCL_RET_OK;
+}
+
+void
+rcl_logging_rosout_output_handler_with_handle(
+  rcl_logging_rosout_logger_handle_t * logger_handle,
+  const rcutils_log_location_t * location,
+  int severity,
+  rcutils_time_point_value_t timestamp,
+  const char * format,
+  va_list * args)
+{
+  if (!__is_initialized || NULL == logger_handle) {
+    return;
+  }
+  if (__async_enabled) {
+    (void)_rcl_logging_rosout_async_enqueue(
+      location, severity, logger_handle->logger_name, timestamp, format, args);
+    return;
+  }
+  if (logger_handle->generation != __logger_map_generation) {
+    const char * name = logger_handle->logger_name;
+    logger_handle->entry_valid = (RCUTILS_RET_OK == rcutils_hash_map_get(
+        &__logger_map, &name, &logger_handle->entry));
+    logger_handle->generation = __logger_map_generation;
+  }
+  if (logger_handle->entry_valid) {
+    _rcl_logging_rosout_publish_on_entry(
+      &logger_handle->entry, location, severity, logger_handle->logger_name,
+      timestamp, format, args);
+  }
+}
+
+rcl_ret_t
+rcl_logging_rosout_enable_async_publishing(size_t queue_depth)
+{
+  return rcl_logging_rosout_enable_async_publishing_with_policy(
+    queue_depth, RCL_LOGGING_ROSOUT_DROP_NEWEST);
+}
+
+rcl_ret_t
+rcl_logging_rosout_enable_async_publishing_with_policy(
+  size_t queue_depth, rcl_logging_rosout_drop_policy_t drop_policy)
+{
+  if (!__is_initialized) {
+    RCL_SET_ERROR_MSG("rcl_logging_rosout is not initialized");
+    return RCL_RET_NOT_INIT;
+  }
+  if (__async_enabled) {
+    return RCL_RET_OK;
+  }
+  if (0u == queue_depth) {
+    RCL_SET_ERROR_MSG("queue_depth must be greater than zero");
+    return RCL_RET_INVALID_ARGUMENT;
+  }
+  if (RCL_LOGGING_ROSOUT_DROP_NEWEST != drop_policy &&
+    RCL_LOGGING_ROSOUT_DROP_OLDEST != drop_policy)
+  {
+    RCL_SET_ERROR_MSG("unknown drop policy");
+    return RCL_RET_INVALID_ARGUMENT;
+  }
+
+  uint64_t capacity = 1;
+  while (capacity < queue_depth) {
+    capacity <<= 1;
+  }
+
+  __async_ring = __rosout_allocator.allocate(
+    (size_t)capacity * sizeof(rosout_async_entry_t), __rosout_allocator.state);
+  if (NULL == __async_ring) {
+    RCL_SET_ERROR_MSG("Failed to allocate memory for the rosout ring.");
+    return RCL_RET_BAD_ALLOC;
+  }
+  for (uint64_t i = 0; i < capacity; ++i) {
+    atomic_init(&__async_ring[i].sequence, i);
+  }
+  __async_ring_mask = capacity - 1;
+  atomic_init(&__async_head, 0);
+  atomic_init(&__async_tail, 0);
+  atomic_init(&__async_num_dropped, 0);
+  __async_drop_policy = drop_policy;
+  __async_enabled = true;
+
+  return RCL_RET_OK;
+}
+
+rcl_ret_t
+rcl_logging_rosout_disable_async_publishing(void)
+{
+  if (!__async_enabled) {
+    return RCL_RET_OK;
+  }
+  rcl_ret_t status = rcl_logging_rosout_flush(0, NULL);
+  __async_enabled = false;
+  __rosout_allocator.deallocate(__async_ring, __rosout_allocator.state);
+  __async_ring = NULL;
+  __async_ring_mask = 0;
+  return status;
+}
+
+rcl_ret_t
+rcl_logging_rosout_flush(size_t max_messages, size_t * num_published)
+{
+  size_t published = 0;
+  if (num_published) {
+    *num_published = 0;
+  }
+  if (!__is_initialized || !__async_enabled) {
+    return RCL_RET_OK;
+  }
+
+  while (0u == max_messages || published < max_messages) {
+    uint64_t pos = rcutils_atomic_load_uint64_t(&__async_tail);
+    rosout_async_entry_t * entry = &__async_ring[pos & __async_ring_mask];
+    uint64_t seq = rcutils_atomic_load_uint64_t(&entry->sequence);
+    if (seq != pos + 1) {
+      // The next slot has not been published yet; the ring is drained.
+      break;
+    }
+    bool exchanged = false;
+    uint64_t expected = pos;
+    rcutils_atomic_compare_exchange_strong(&__async_tail, exchanged, &expected, pos + 1);
+    if (!exchanged) {
+      // a full producer discarded this record first
+      continue;
+    }
+
+    const char * name = entry->name;
+    rosout_map_entry_t map_entry;
+    if (RCUTILS_RET_OK == _rcl_logging_rosout_get_entry(name, &map_entry)) {
       rcl_interfaces__msg__Log log_message;
-      log_message.stamp.sec = (int32_t) RCL_NS_TO_S(timestamp);
-      log_message.stamp.nanosec = (timestamp % RCL_S_TO_NS(1));
-      log_message.level = severity;
-      log_message.line = (int32_t) location->line_number;
-      shallow_assign(&log_message.name, name);
-      shallow_assign(&log_message.msg, msg_array.buffer);
-      shallow_assign(&log_message.file, location->file_name);
-      shallow_assign(&log_message.function, location->function_name);
-      status = rcl_publish(&entry.publisher, &log_message, NULL);
+      log_message.stamp.sec = (int32_t) RCL_NS_TO_S(entry->timestamp);
+      log_message.stamp.nanosec = (entry->timestamp % RCL_S_TO_NS(1));
+      log_message.level = entry->severity;
+      log_message.line = (int32_t) entry->line_number;
+      shallow_assign(&log_message.name, entry->name);
+      shallow_assign(&log_message.msg, entry->msg);
+      shallow_assign(&log_message.file, entry->file);
+      shallow_assign(&log_message.function, entry->function);
+      rcl_ret_t status = rcl_publish(&map_entry.publisher, &log_message, NULL);
       if (RCL_RET_OK != status) {
         RCUTILS_SAFE_FWRITE_TO_STDERR("Failed to publish log message to rosout: ");
         RCUTILS_SAFE_FWRITE_TO_STDERR(rcl_get_error_string().str);
@@ -382,14 +841,24 @@ void rcl_logging_rosout_output_handler(
       }
     }
 
-    status = rcl_ret_from_rcutils_ret(rcutils_char_array_fini(&msg_array));
-    if (RCL_RET_OK != status) {
-      RCUTILS_SAFE_FWRITE_TO_STDERR("failed to fini char_array: ");
-      RCUTILS_SAFE_FWRITE_TO_STDERR(rcl_get_error_string().str);
-      rcl_reset_error();
-      RCUTILS_SAFE_FWRITE_TO_STDERR("\n");
-    }
+    // Recycle the slot for the producers one lap ahead.
+    rcutils_atomic_store(&entry->sequence, pos + __async_ring_mask + 1);
+    ++published;
+  }
+
+  if (num_published) {
+    *num_published = published;
+  }
+  return RCL_RET_OK;
+}
+
+uint64_t
+rcl_logging_rosout_get_num_dropped_messages(void)
+{
+  if (!__async_enabled) {
+    return 0;
   }
+  return rcutils_atomic_load_uint64_t(&__async_num_dropped);
 }
 
 static rcl_ret_t
@@ -459,6 +928,7 @@ rcl_logging_rosout_add_sublogger(
 
   status = rcl_ret_from_rcutils_ret(
     rcutils_hash_map_set(&__logger_map, &full_sublogger_name, &entry));
+  _rcl_logging_rosout_note_map_changed();
   if (RCL_RET_OK != status) {
     RCL_SET_ERROR_MSG_WITH_FORMAT_STRING(
       "Failed to add publisher to map for logger '%s'.", full_sublogger_name);
@@ -536,6 +1006,7 @@ rcl_logging_rosout_remove_sublogger(
   if (*sublogger_entry.count == 0) {
     status = rcl_ret_from_rcutils_ret(rcutils_hash_map_unset(&__logger_map, &full_sublogger_name));
     if (RCL_RET_OK == status) {
+      _rcl_logging_rosout_note_map_changed();
       status =
         rcl_ret_from_rcutils_ret(rcutils_hash_map_unset(&__sublogger_map, &full_sublogger_name));
       __rosout_allocator.deallocate(sublogger_entry.name, __rosout_allocator.state);
@@ -17,6 +17,8 @@ extern "C"
 {
 #endif
 
+#include <string.h>
+
 #include "rcl/error_handling.h"
 #include "rcl/graph.h"
 #include "rcl/network_flow_endpoints.h"
@@ -33,6 +35,8 @@ extern "C"
 #include "rmw/types.h"
 
 #include "./common.h"
+#include "./publisher_impl.h"
+#include "./subscription_impl.h"
 
 rcl_ret_t
 __validate_network_flow_endpoint_array(
@@ -85,6 +89,63 @@ rcl_publisher_get_network_flow_endpoints(
   return rcl_convert_rmw_ret_to_rcl_ret(rmw_ret);
 }
 
+rcl_ret_t
+rcl_publisher_refresh_network_flow_endpoints(
+  const rcl_publisher_t * publisher)
+{
+  if (!rcl_publisher_is_valid(publisher)) {
+    return RCL_RET_INVALID_ARGUMENT;
+  }
+  rcl_publisher_impl_t * impl = publisher->impl;
+
+  rmw_error_string_t error_string;
+  rmw_ret_t rmw_ret;
+  if (impl->network_flow_cache_valid) {
+    impl->network_flow_cache_valid = false;
+    rmw_ret = rmw_network_flow_endpoint_array_fini(&impl->network_flow_cache);
+    if (rmw_ret != RMW_RET_OK) {
+      error_string = rmw_get_error_string();
+      rmw_reset_error();
+      RCL_SET_ERROR_MSG(error_string.str);
+      return rcl_convert_rmw_ret_to_rcl_ret(rmw_ret);
+    }
+  }
+
+  rmw_ret = rmw_publisher_get_network_flow_endpoints(
+    impl->rmw_handle,
+    &impl->options.allocator,
+    &impl->network_flow_cache);
+  if (rmw_ret != RMW_RET_OK) {
+    error_string = rmw_get_error_string();
+    rmw_reset_error();
+    RCL_SET_ERROR_MSG(error_string.str);
+    return rcl_convert_rmw_ret_to_rcl_ret(rmw_ret);
+  }
+  impl->network_flow_cache_valid = true;
+  impl->network_flow_cache_stale = false;
+  return RCL_RET_OK;
+}
+
+rcl_ret_t
+rcl_publisher_get_cached_network_flow_endpoints(
+  const rcl_publisher_t * publisher,
+  const rcl_network_flow_endpoint_array_t ** network_flow_endpoint_array)
+{
+  if (!rcl_publisher_is_valid(publisher)) {
+    return RCL_RET_INVALID_ARGUMENT;
+  }
+  RCL_CHECK_ARGUMENT_FOR_NULL(network_flow_endpoint_array, RCL_RET_INVALID_ARGUMENT);
+
+  if (!publisher->impl->network_flow_cache_valid || publisher->impl->network_flow_cache_stale) {
+    rcl_ret_t rcl_ret = rcl_publisher_refresh_network_flow_endpoints(publisher);
+    if (rcl_ret != RCL_RET_OK) {
+      return rcl_ret;
+    }
+  }
+  *network_flow_endpoint_array = &publisher->impl->network_flow_cache;
+  return RCL_RET_OK;
+}
+
 rcl_ret_t
 rcl_subscription_get_network_flow_endpoints(
   const rcl_subscription_t * subscription,
@@ -116,6 +177,163 @@ rcl_subscription_get_network_flow_endpoints(
   return rcl_convert_rmw_ret_to_rcl_ret(rmw_ret);
 }
 
+rcl_ret_t
+rcl_subscription_refresh_network_flow_endpoints(
+  const rcl_subscription_t * subscription)
+{
+  if (!rcl_subscription_is_valid(subscription)) {
+    return RCL_RET_INVALID_ARGUMENT;
+  }
+  rcl_subscription_impl_t * impl = subscription->impl;
+
+  rmw_error_string_t error_string;
+  rmw_ret_t rmw_ret;
+  if (impl->network_flow_cache_valid) {
+    impl->network_flow_cache_valid = false;
+    rmw_ret = rmw_network_flow_endpoint_array_fini(&impl->network_flow_cache);
+    if (rmw_ret != RMW_RET_OK) {
+      error_string = rmw_get_error_string();
+      rmw_reset_error();
+      RCL_SET_ERROR_MSG(error_string.str);
+      return rcl_convert_rmw_ret_to_rcl_ret(rmw_ret);
+    }
+  }
+
+  rmw_ret = rmw_subscription_get_network_flow_endpoints(
+    impl->rmw_handle,
+    &impl->options.allocator,
+    &impl->network_flow_cache);
+  if (rmw_ret != RMW_RET_OK) {
+    error_string = rmw_get_error_string();
+    rmw_reset_error();
+    RCL_SET_ERROR_MSG(error_string.str);
+    return rcl_convert_rmw_ret_to_rcl_ret(rmw_ret);
+  }
+  impl->network_flow_cache_valid = true;
+  impl->network_flow_cache_stale = false;
+  return RCL_RET_OK;
+}
+
+rcl_ret_t
+rcl_subscription_get_cached_network_flow_endpoints(
+  const rcl_subscription_t * subscription,
+  const rcl_network_flow_endpoint_array_t ** network_flow_endpoint_array)
+{
+  if (!rcl_subscription_is_valid(subscription)) {
+    return RCL_RET_INVALID_ARGUMENT;
+  }
+  RCL_CHECK_ARGUMENT_FOR_NULL(network_flow_endpoint_array, RCL_RET_INVALID_ARGUMENT);
+
+  if (!subscription->impl->network_flow_cache_valid ||
+    subscription->impl->network_flow_cache_stale)
+  {
+    rcl_ret_t rcl_ret = rcl_subscription_refresh_network_flow_endpoints(subscription);
+    if (rcl_ret != RCL_RET_OK) {
+      return rcl_ret;
+    }
+  }
+  *network_flow_endpoint_array = &subscription->impl->network_flow_cache;
+  return RCL_RET_OK;
+}
+
+static bool
+__network_flow_endpoint_equal(
+  const rcl_network_flow_endpoint_t * lhs,
+  const rcl_network_flow_endpoint_t * rhs)
+{
+  return lhs->transport_protocol == rhs->transport_protocol &&
+         lhs->internet_protocol == rhs->internet_protocol &&
+         lhs->transport_port == rhs->transport_port &&
+         lhs->flow_label == rhs->flow_label &&
+         lhs->dscp == rhs->dscp &&
+         0 == strncmp(
+    lhs->internet_address, rhs->internet_address, RMW_INET_ADDRSTRLEN);
+}
+
+/// True when `endpoint` appears in `haystack`.
+static bool
+__network_flow_endpoint_array_contains(
+  const rcl_network_flow_endpoint_array_t * haystack,
+  const rcl_network_flow_endpoint_t * endpoint)
+{
+  for (size_t i = 0; i < haystack->size; ++i) {
+    if (__network_flow_endpoint_equal(&haystack->network_flow_endpoint[i], endpoint)) {
+      return true;
+    }
+  }
+  return false;
+}
+
+/// Copy the endpoints of `from` missing in `reference` into `out`.
+static rcl_ret_t
+__network_flow_endpoint_array_difference(
+  const rcl_network_flow_endpoint_array_t * from,
+  const rcl_network_flow_endpoint_array_t * reference,
+  rcutils_allocator_t * allocator,
+  rcl_network_flow_endpoint_array_t * out)
+{
+  size_t count = 0;
+  for (size_t i = 0; i < from->size; ++i) {
+    if (!__network_flow_endpoint_array_contains(reference, &from->network_flow_endpoint[i])) {
+      ++count;
+    }
+  }
+  if (0 == count) {
+    // a zero initialized array is a valid, fini-able empty result
+    return RCL_RET_OK;
+  }
+  rmw_ret_t rmw_ret = rmw_network_flow_endpoint_array_init(out, count, allocator);
+  if (rmw_ret != RMW_RET_OK) {
+    rmw_error_string_t error_string = rmw_get_error_string();
+    rmw_reset_error();
+    RCL_SET_ERROR_MSG(error_string.str);
+    return rcl_convert_rmw_ret_to_rcl_ret(rmw_ret);
+  }
+  size_t next = 0;
+  for (size_t i = 0; i < from->size; ++i) {
+    if (!__network_flow_endpoint_array_contains(reference, &from->network_flow_endpoint[i])) {
+      out->network_flow_endpoint[next++] = from->network_flow_endpoint[i];
+    }
+  }
+  return RCL_RET_OK;
+}
+
+rcl_ret_t
+rcl_network_flow_endpoint_array_diff(
+  const rcl_network_flow_endpoint_array_t * previous,
+  const rcl_network_flow_endpoint_array_t * current,
+  rcutils_allocator_t * allocator,
+  rcl_network_flow_endpoint_array_t * added,
+  rcl_network_flow_endpoint_array_t * removed)
+{
+  RCL_CHECK_ARGUMENT_FOR_NULL(previous, RCL_RET_INVALID_ARGUMENT);
+  RCL_CHECK_ARGUMENT_FOR_NULL(current, RCL_RET_INVALID_ARGUMENT);
+  RCL_CHECK_ALLOCATOR_WITH_MSG(allocator, "invalid allocator", return RCL_RET_INVALID_ARGUMENT);
+
+  rcl_ret_t rcl_ret = __validate_network_flow_endpoint_array(added);
+  if (rcl_ret != RCL_RET_OK) {
+    return rcl_ret;
+  }
+  rcl_ret = __validate_network_flow_endpoint_array(removed);
+  if (rcl_ret != RCL_RET_OK) {
+    return rcl_ret;
+  }
+
+  rcl_ret = __network_flow_endpoint_array_difference(current, previous, allocator, added);
+  if (rcl_ret != RCL_RET_OK) {
+    return rcl_ret;
+  }
+  rcl_ret = __network_flow_endpoint_array_difference(previous, current, allocator, removed);
+  if (rcl_ret != RCL_RET_OK) {
+    rmw_ret_t fini_ret = rmw_network_flow_endpoint_array_fini(added);
+    if (fini_ret != RMW_RET_OK) {
+      rmw_reset_error();
+    }
+    return rcl_ret;
+  }
+  return RCL_RET_OK;
+}
+
 #ifdef __cplusplus
 }
 #endif
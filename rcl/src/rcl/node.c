@@ -19,6 +19,7 @@ extern "C"
 
 #include "rcl/node.h"
 
+#include <inttypes.h>
 #include <limits.h>
 #include <stdio.h>
 #include <stdlib.h>
@@ -26,6 +27,7 @@ extern "C"
 
 #include "rcl/arguments.h"
 #include "rcl/error_handling.h"
+#include "rcl/expand_topic_name.h"
 #include "rcl/init_options.h"
 #include "rcl/localhost.h"
 #include "rcl/logging.h"
@@ -43,6 +45,7 @@ extern "C"
 #include "rcutils/repl_str.h"
 #include "rcutils/snprintf.h"
 #include "rcutils/strdup.h"
+#include "rcutils/time.h"
 
 #include "rmw/error_handling.h"
 #include "rmw/security_options.h"
@@ -52,19 +55,10 @@ extern "C"
 #include "tracetools/tracetools.h"
 
 #include "./context_impl.h"
+#include "./node_impl.h"
 
 const char * const RCL_DISABLE_LOANED_MESSAGES_ENV_VAR = "ROS_DISABLE_LOANED_MESSAGES";
 
-struct rcl_node_impl_s
-{
-  rcl_node_options_t options;
-  rmw_node_t * rmw_node_handle;
-  rcl_guard_condition_t * graph_guard_condition;
-  const char * logger_name;
-  const char * fq_name;
-};
-
-
 /// Return the logger name associated with a node given the validated node name and namespace.
 /**
  * E.g. for a node named "c" in namespace "/a/b", the logger name will be
@@ -85,6 +79,27 @@ const char * rcl_create_node_logger_name(
     return rcutils_strdup(node_name, *allocator);
   }
 
+  // When the separator is a single character, like "/", the logger name has the
+  // same length as the joined namespace and node name, so it can be built with
+  // a single allocation and the slashes rewritten in place.
+  // The condition is a compile time constant, so one of the branches is elided.
+  if (1 == strlen(RCUTILS_LOGGING_SEPARATOR_STRING)) {
+    // The input namespace has already been expanded and therefore will always be
+    // absolute, i.e. it will start with a forward slash, which we want to ignore.
+    char * node_logger_name = rcutils_format_string(
+      *allocator, "%s/%s", node_namespace + 1, node_name);
+    if (NULL == node_logger_name) {
+      return NULL;
+    }
+    // The node name is a single validated token, so only namespace slashes match.
+    for (char * current = node_logger_name; '\0' != *current; ++current) {
+      if ('/' == *current) {
+        *current = RCUTILS_LOGGING_SEPARATOR_STRING[0];
+      }
+    }
+    return node_logger_name;
+  }
+
   // Convert the forward slashes in the namespace to the separator used for logger names.
   // The input namespace has already been expanded and therefore will always be absolute,
   // i.e. it will start with a forward slash, which we want to ignore.
@@ -121,9 +136,6 @@ rcl_node_init(
   rcl_context_t * context,
   const rcl_node_options_t * options)
 {
-  const rmw_guard_condition_t * rmw_graph_guard_condition = NULL;
-  rcl_guard_condition_options_t graph_guard_condition_options =
-    rcl_guard_condition_get_default_options();
   rcl_ret_t ret;
   rcl_ret_t fail_ret = RCL_RET_ERROR;
   char * remapped_node_name = NULL;
@@ -138,6 +150,15 @@ rcl_node_init(
   RCL_CHECK_ARGUMENT_FOR_NULL(node, RCL_RET_INVALID_ARGUMENT);
   RCUTILS_LOG_DEBUG_NAMED(
     ROS_PACKAGE_NAME, "Initializing node '%s' in namespace '%s'", name, namespace_);
+  // phase timing for the startup breakdown logged below; sampling failures
+  // leave the values at 0 and are otherwise ignored
+  rcutils_time_point_value_t node_start_time = 0;
+  rcutils_time_point_value_t rmw_create_duration = 0;
+  rcutils_time_point_value_t rosout_duration = 0;
+  rcutils_time_point_value_t phase_time = 0;
+  if (RCUTILS_RET_OK != rcutils_steady_time_now(&node_start_time)) {
+    rcutils_reset_error();
+  }
   if (node->impl) {
     RCL_SET_ERROR_MSG("node already initialized, or struct memory was unintialized");
     return RCL_RET_ALREADY_INIT;
@@ -206,6 +227,9 @@ rcl_node_init(
   node->impl->graph_guard_condition = NULL;
   node->impl->logger_name = NULL;
   node->impl->fq_name = NULL;
+  node->impl->ns_prefix = NULL;
+  node->impl->substitutions_map = rcutils_get_zero_initialized_string_map();
+  memset(&node->impl->resolved_name_cache, 0, sizeof(node->impl->resolved_name_cache));
   node->impl->options = rcl_node_get_default_options();
   node->context = context;
   // Initialize node impl.
@@ -248,50 +272,83 @@ rcl_node_init(
     node->impl->fq_name = rcutils_format_string(*allocator, "%s/%s", local_namespace_, name);
   }
 
+  // namespace with a trailing slash, reused when expanding relative names
+  if ('/' == local_namespace_[strlen(local_namespace_) - 1]) {
+    node->impl->ns_prefix = rcutils_strdup(local_namespace_, *allocator);
+  } else {
+    node->impl->ns_prefix = rcutils_format_string(*allocator, "%s/", local_namespace_);
+  }
+  RCL_CHECK_FOR_NULL_WITH_MSG(
+    node->impl->ns_prefix, "creating namespace prefix failed", goto fail);
+
+  // substitutions map shared by every name resolution through this node
+  rcutils_ret_t rcutils_ret =
+    rcutils_string_map_init(&node->impl->substitutions_map, 0, *allocator);
+  if (RCUTILS_RET_OK != rcutils_ret) {
+    rcutils_error_string_t error_string = rcutils_get_error_string();
+    rcutils_reset_error();
+    RCL_SET_ERROR_MSG(error_string.str);
+    goto fail;
+  }
+  ret = rcl_get_default_topic_name_substitutions(&node->impl->substitutions_map);
+  if (RCL_RET_OK != ret) {
+    goto fail;
+  }
+
   // node logger name
   node->impl->logger_name = rcl_create_node_logger_name(name, local_namespace_, allocator);
   RCL_CHECK_FOR_NULL_WITH_MSG(
     node->impl->logger_name, "creating logger name failed", goto fail);
 
+  // create the rmw context now if its creation was deferred during init
+  ret = rcl_context_ensure_rmw_context(context);
+  if (RCL_RET_OK != ret) {
+    goto fail;
+  }
+
   RCUTILS_LOG_DEBUG_NAMED(
     ROS_PACKAGE_NAME, "Using domain ID of '%zu'", context->impl->rmw_context.actual_domain_id);
 
+  if (RCUTILS_RET_OK != rcutils_steady_time_now(&phase_time)) {
+    rcutils_reset_error();
+    phase_time = 0;
+  }
   node->impl->rmw_node_handle = rmw_create_node(
     &(node->context->impl->rmw_context),
     name, local_namespace_);
 
   RCL_CHECK_FOR_NULL_WITH_MSG(
     node->impl->rmw_node_handle, rmw_get_error_string().str, goto fail);
-  // graph guard condition
-  rmw_graph_guard_condition = rmw_node_get_graph_guard_condition(node->impl->rmw_node_handle);
-  RCL_CHECK_FOR_NULL_WITH_MSG(
-    rmw_graph_guard_condition, rmw_get_error_string().str, goto fail);
-
-  node->impl->graph_guard_condition = (rcl_guard_condition_t *)allocator->allocate(
-    sizeof(rcl_guard_condition_t), allocator->state);
-  RCL_CHECK_FOR_NULL_WITH_MSG(
-    node->impl->graph_guard_condition,
-    "allocating memory failed",
-    goto fail);
-  *node->impl->graph_guard_condition = rcl_get_zero_initialized_guard_condition();
-  graph_guard_condition_options.allocator = *allocator;
-  ret = rcl_guard_condition_init_from_rmw(
-    node->impl->graph_guard_condition,
-    rmw_graph_guard_condition,
-    context,
-    graph_guard_condition_options);
-  if (ret != RCL_RET_OK) {
-    // error message already set
-    goto fail;
+  if (0 != phase_time) {
+    if (RCUTILS_RET_OK == rcutils_steady_time_now(&rmw_create_duration)) {
+      rmw_create_duration -= phase_time;
+    } else {
+      rcutils_reset_error();
+      rmw_create_duration = 0;
+    }
   }
+  // The graph guard condition is created lazily by
+  // rcl_node_get_graph_guard_condition(), since most nodes never watch the graph.
   // The initialization for the rosout publisher requires the node to be in initialized to a point
   // that it can create new topic publishers
   if (rcl_logging_rosout_enabled() && node->impl->options.enable_rosout) {
+    if (RCUTILS_RET_OK != rcutils_steady_time_now(&phase_time)) {
+      rcutils_reset_error();
+      phase_time = 0;
+    }
     ret = rcl_logging_rosout_init_publisher_for_node(node);
     if (ret != RCL_RET_OK) {
       // error message already set
       goto fail;
     }
+    if (0 != phase_time) {
+      if (RCUTILS_RET_OK == rcutils_steady_time_now(&rosout_duration)) {
+        rosout_duration -= phase_time;
+      } else {
+        rcutils_reset_error();
+        rosout_duration = 0;
+      }
+    }
   }
   if (node->impl->options.enable_type_description_service) {
     RCUTILS_LOG_WARN_NAMED(
@@ -299,6 +356,17 @@ rcl_node_init(
       "Requested ~/get_type_description service enabled, but feature is not yet implemented. "
       "Service is not created.");
   }
+  if (0 != node_start_time) {
+    if (RCUTILS_RET_OK == rcutils_steady_time_now(&phase_time)) {
+      RCUTILS_LOG_DEBUG_NAMED(
+        ROS_PACKAGE_NAME,
+        "node '%s' bring-up timings (ns): rmw_create_node=%" PRId64
+        " rosout=%" PRId64 " total=%" PRId64,
+        name, rmw_create_duration, rosout_duration, phase_time - node_start_time);
+    } else {
+      rcutils_reset_error();
+    }
+  }
   RCUTILS_LOG_DEBUG_NAMED(ROS_PACKAGE_NAME, "Node initialized");
   ret = RCL_RET_OK;
   TRACETOOLS_TRACEPOINT(
@@ -323,6 +391,17 @@ fail:
     if (node->impl->fq_name) {
       allocator->deallocate((char *)node->impl->fq_name, allocator->state);
     }
+    if (node->impl->ns_prefix) {
+      allocator->deallocate((char *)node->impl->ns_prefix, allocator->state);
+    }
+    if (RCUTILS_RET_OK != rcutils_string_map_fini(&node->impl->substitutions_map)) {
+      RCUTILS_LOG_ERROR_NAMED(
+        ROS_PACKAGE_NAME,
+        "failed to fini substitutions map in error recovery: %s",
+        rcutils_get_error_string().str
+      );
+      rcutils_reset_error();
+    }
     if (node->impl->rmw_node_handle) {
       ret = rmw_destroy_node(node->impl->rmw_node_handle);
       if (ret != RMW_RET_OK) {
@@ -332,16 +411,6 @@ fail:
         );
       }
     }
-    if (node->impl->graph_guard_condition) {
-      ret = rcl_guard_condition_fini(node->impl->graph_guard_condition);
-      if (ret != RCL_RET_OK) {
-        RCUTILS_LOG_ERROR_NAMED(
-          ROS_PACKAGE_NAME,
-          "failed to fini guard condition in error recovery: %s", rcl_get_error_string().str
-        );
-      }
-      allocator->deallocate(node->impl->graph_guard_condition, allocator->state);
-    }
     if (NULL != node->impl->options.arguments.impl) {
       ret = rcl_arguments_fini(&(node->impl->options.arguments));
       if (ret != RCL_RET_OK) {
@@ -351,6 +420,7 @@ fail:
         );
       }
     }
+    rcl_node_resolved_name_cache_fini(&node->impl->resolved_name_cache, allocator);
     allocator->deallocate(node->impl, allocator->state);
   }
   *node = rcl_get_zero_initialized_node();
@@ -368,6 +438,95 @@ cleanup:
   return ret;
 }
 
+rcl_ret_t
+rcl_node_init_batch(
+  rcl_node_t ** nodes,
+  const char * const * names,
+  const char * const * namespaces,
+  size_t count,
+  rcl_context_t * context,
+  const rcl_node_options_t * options)
+{
+  RCL_CHECK_ARGUMENT_FOR_NULL(nodes, RCL_RET_INVALID_ARGUMENT);
+  RCL_CHECK_ARGUMENT_FOR_NULL(names, RCL_RET_INVALID_ARGUMENT);
+  RCL_CHECK_ARGUMENT_FOR_NULL(namespaces, RCL_RET_INVALID_ARGUMENT);
+  RCL_CHECK_ARGUMENT_FOR_NULL(options, RCL_RET_INVALID_ARGUMENT);
+  RCL_CHECK_FOR_NULL_WITH_MSG(
+    context, "given context is NULL", return RCL_RET_INVALID_ARGUMENT);
+  if (!rcl_context_is_valid(context)) {
+    RCL_SET_ERROR_MSG(
+      "the given context is not valid, "
+      "either rcl_init() was not called or rcl_shutdown() was called.");
+    return RCL_RET_NOT_INIT;
+  }
+  if (0u == count) {
+    return RCL_RET_OK;
+  }
+  // Create the rmw context up front, so that every node takes the cheap
+  // already-created path through rcl_context_ensure_rmw_context() and a
+  // deferred rmw_init() failure surfaces before any node is initialized.
+  rcl_ret_t ret = rcl_context_ensure_rmw_context(context);
+  if (RCL_RET_OK != ret) {
+    return ret;
+  }
+  size_t initialized = 0u;
+  for (; initialized < count; ++initialized) {
+    ret = rcl_node_init(
+      nodes[initialized], names[initialized], namespaces[initialized], context, options);
+    if (RCL_RET_OK != ret) {
+      break;
+    }
+  }
+  if (RCL_RET_OK != ret) {
+    // preserve the error of the node that failed across the rollback
+    rcl_error_string_t error_string = rcl_get_error_string();
+    rcl_reset_error();
+    while (initialized > 0u) {
+      --initialized;
+      rcl_ret_t fini_ret = rcl_node_fini(nodes[initialized]);
+      if (RCL_RET_OK != fini_ret) {
+        RCUTILS_LOG_ERROR_NAMED(
+          ROS_PACKAGE_NAME,
+          "failed to fini node in error recovery: %s", rcl_get_error_string().str
+        );
+        rcl_reset_error();
+      }
+    }
+    RCL_SET_ERROR_MSG(error_string.str);
+  }
+  return ret;
+}
+
+rcl_ret_t
+rcl_node_fini_batch(rcl_node_t ** nodes, size_t count)
+{
+  RCL_CHECK_ARGUMENT_FOR_NULL(nodes, RCL_RET_INVALID_ARGUMENT);
+  rcl_ret_t result = RCL_RET_OK;
+  rcl_error_string_t first_error_string;
+  // tear down in reverse initialization order, and keep going past failures
+  // so one stubborn node does not leak the remaining ones
+  for (size_t remaining = count; remaining > 0u; --remaining) {
+    rcl_ret_t ret = rcl_node_fini(nodes[remaining - 1u]);
+    if (RCL_RET_OK != ret) {
+      if (RCL_RET_OK == result) {
+        // preserve the first failure; later ones are only logged
+        result = ret;
+        first_error_string = rcl_get_error_string();
+      } else {
+        RCUTILS_LOG_ERROR_NAMED(
+          ROS_PACKAGE_NAME,
+          "failed to fini node in batch fini: %s", rcl_get_error_string().str
+        );
+      }
+      rcl_reset_error();
+    }
+  }
+  if (RCL_RET_OK != result) {
+    RCL_SET_ERROR_MSG(first_error_string.str);
+  }
+  return result;
+}
+
 rcl_ret_t
 rcl_node_fini(rcl_node_t * node)
 {
@@ -392,21 +551,32 @@ rcl_node_fini(rcl_node_t * node)
     RCL_SET_ERROR_MSG(rmw_get_error_string().str);
     result = RCL_RET_ERROR;
   }
-  rcl_ret = rcl_guard_condition_fini(node->impl->graph_guard_condition);
-  if (rcl_ret != RCL_RET_OK) {
-    RCL_SET_ERROR_MSG(rmw_get_error_string().str);
-    result = RCL_RET_ERROR;
+  // NULL if rcl_node_get_graph_guard_condition() was never called on this node
+  if (NULL != node->impl->graph_guard_condition) {
+    rcl_ret = rcl_guard_condition_fini(node->impl->graph_guard_condition);
+    if (rcl_ret != RCL_RET_OK) {
+      RCL_SET_ERROR_MSG(rmw_get_error_string().str);
+      result = RCL_RET_ERROR;
+    }
+    allocator.deallocate(node->impl->graph_guard_condition, allocator.state);
   }
-  allocator.deallocate(node->impl->graph_guard_condition, allocator.state);
   // assuming that allocate and deallocate are ok since they are checked in init
   allocator.deallocate((char *)node->impl->logger_name, allocator.state);
   allocator.deallocate((char *)node->impl->fq_name, allocator.state);
+  allocator.deallocate((char *)node->impl->ns_prefix, allocator.state);
+  if (RCUTILS_RET_OK != rcutils_string_map_fini(&node->impl->substitutions_map)) {
+    rcutils_error_string_t error_string = rcutils_get_error_string();
+    rcutils_reset_error();
+    RCL_SET_ERROR_MSG(error_string.str);
+    result = RCL_RET_ERROR;
+  }
   if (NULL != node->impl->options.arguments.impl) {
     rcl_ret_t ret = rcl_arguments_fini(&(node->impl->options.arguments));
     if (ret != RCL_RET_OK) {
       return ret;
     }
   }
+  rcl_node_resolved_name_cache_fini(&node->impl->resolved_name_cache, &allocator);
   allocator.deallocate(node->impl, allocator.state);
   node->impl = NULL;
   RCUTILS_LOG_DEBUG_NAMED(ROS_PACKAGE_NAME, "Node finalized");
@@ -505,12 +675,50 @@ rcl_node_get_rcl_instance_id(const rcl_node_t * node)
   return rcl_context_get_instance_id(node->context);
 }
 
+/// Create the node's graph guard condition if it does not exist yet.
+static rcl_ret_t
+rcl_node_ensure_graph_guard_condition(const rcl_node_t * node)
+{
+  rcl_node_impl_t * impl = node->impl;
+  if (NULL != impl->graph_guard_condition) {
+    return RCL_RET_OK;
+  }
+  const rcl_allocator_t * allocator = &impl->options.allocator;
+  const rmw_guard_condition_t * rmw_graph_guard_condition =
+    rmw_node_get_graph_guard_condition(impl->rmw_node_handle);
+  RCL_CHECK_FOR_NULL_WITH_MSG(
+    rmw_graph_guard_condition, rmw_get_error_string().str, return RCL_RET_ERROR);
+  rcl_guard_condition_t * graph_guard_condition = (rcl_guard_condition_t *)allocator->allocate(
+    sizeof(rcl_guard_condition_t), allocator->state);
+  RCL_CHECK_FOR_NULL_WITH_MSG(
+    graph_guard_condition, "allocating memory failed", return RCL_RET_BAD_ALLOC);
+  *graph_guard_condition = rcl_get_zero_initialized_guard_condition();
+  rcl_guard_condition_options_t graph_guard_condition_options =
+    rcl_guard_condition_get_default_options();
+  graph_guard_condition_options.allocator = *allocator;
+  rcl_ret_t ret = rcl_guard_condition_init_from_rmw(
+    graph_guard_condition,
+    rmw_graph_guard_condition,
+    node->context,
+    graph_guard_condition_options);
+  if (RCL_RET_OK != ret) {
+    // error message already set
+    allocator->deallocate(graph_guard_condition, allocator->state);
+    return ret;
+  }
+  impl->graph_guard_condition = graph_guard_condition;
+  return RCL_RET_OK;
+}
+
 const rcl_guard_condition_t *
 rcl_node_get_graph_guard_condition(const rcl_node_t * node)
 {
   if (!rcl_node_is_valid_except_context(node)) {
     return NULL;  // error already set
   }
+  if (RCL_RET_OK != rcl_node_ensure_graph_guard_condition(node)) {
+    return NULL;  // error already set
+  }
   return node->impl->graph_guard_condition;
 }
 
@@ -0,0 +1,91 @@
+// Copyright 2026 Open Source Robotics Foundation, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef RCL__NODE_IMPL_H_
+#define RCL__NODE_IMPL_H_
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#include "rcl/guard_condition.h"
+#include "rcl/macros.h"
+#include "rcl/node.h"
+#include "rcl/node_options.h"
+
+#include "rcutils/types/string_map.h"
+
+#include "rmw/types.h"
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+/// Number of entries retained by a node's resolved name cache.
+#define RCL_NODE_RESOLVED_NAME_CACHE_SIZE 16
+
+/// One name previously resolved through rcl_node_resolve_name().
+typedef struct rcl_resolved_name_cache_entry_s
+{
+  /// Input name as given to rcl_node_resolve_name(), or NULL if the slot is empty.
+  char * input_name;
+  /// Fully qualified name the input resolved to.
+  char * resolved_name;
+  /// True if the name was resolved with service remap rules.
+  bool is_service;
+  /// True if remap rules were skipped while resolving.
+  bool only_expand;
+  /// Tick of the most recent hit, used for least recently used eviction.
+  uint64_t last_used;
+} rcl_resolved_name_cache_entry_t;
+
+/// A small least recently used cache of input name to fully qualified name.
+/**
+ * Remap rules cannot change after the node is initialized, so entries never
+ * need invalidating; they are only evicted to bound the cache size.
+ */
+typedef struct rcl_resolved_name_cache_s
+{
+  rcl_resolved_name_cache_entry_t entries[RCL_NODE_RESOLVED_NAME_CACHE_SIZE];
+  /// Monotonic tick incremented on every lookup.
+  uint64_t tick;
+} rcl_resolved_name_cache_t;
+
+/// Release every entry of a resolved name cache.
+RCL_LOCAL
+void
+rcl_node_resolved_name_cache_fini(
+  rcl_resolved_name_cache_t * cache,
+  const rcl_allocator_t * allocator);
+
+struct rcl_node_impl_s
+{
+  rcl_node_options_t options;
+  rmw_node_t * rmw_node_handle;
+  rcl_guard_condition_t * graph_guard_condition;
+  const char * logger_name;
+  const char * fq_name;
+  /// Node namespace with a trailing slash, ready to prepend to relative names.
+  const char * ns_prefix;
+  /// Topic name substitutions map shared by every resolution through this node.
+  rcutils_string_map_t substitutions_map;
+  /// Cache of names resolved through rcl_node_resolve_name().
+  rcl_resolved_name_cache_t resolved_name_cache;
+};
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif  // RCL__NODE_IMPL_H_
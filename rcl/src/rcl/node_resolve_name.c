@@ -14,8 +14,10 @@
 
 #include "rcl/node.h"
 
-#include "rcutils/error_handling.h"
-#include "rcutils/logging_macros.h"
+#include <string.h>
+
+#include "rcutils/format_string.h"
+#include "rcutils/strdup.h"
 #include "rcutils/types/string_map.h"
 
 #include "rmw/error_handling.h"
@@ -24,9 +26,100 @@
 #include "rcl/error_handling.h"
 #include "rcl/expand_topic_name.h"
 #include "rcl/remap.h"
+#include "rcl/validate_topic_name.h"
 
+#include "./node_impl.h"
 #include "./remap_impl.h"
 
+void
+rcl_node_resolved_name_cache_fini(
+  rcl_resolved_name_cache_t * cache,
+  const rcl_allocator_t * allocator)
+{
+  for (size_t i = 0; i < RCL_NODE_RESOLVED_NAME_CACHE_SIZE; ++i) {
+    rcl_resolved_name_cache_entry_t * entry = &cache->entries[i];
+    if (NULL != entry->input_name) {
+      allocator->deallocate(entry->input_name, allocator->state);
+      entry->input_name = NULL;
+    }
+    if (NULL != entry->resolved_name) {
+      allocator->deallocate(entry->resolved_name, allocator->state);
+      entry->resolved_name = NULL;
+    }
+  }
+  cache->tick = 0;
+}
+
+/// Find a previously resolved name, or NULL if it was not cached.
+static
+const char *
+rcl_resolved_name_cache_lookup(
+  rcl_resolved_name_cache_t * cache,
+  const char * input_topic_name,
+  bool is_service,
+  bool only_expand)
+{
+  for (size_t i = 0; i < RCL_NODE_RESOLVED_NAME_CACHE_SIZE; ++i) {
+    rcl_resolved_name_cache_entry_t * entry = &cache->entries[i];
+    if (
+      NULL != entry->input_name &&
+      entry->is_service == is_service &&
+      entry->only_expand == only_expand &&
+      0 == strcmp(entry->input_name, input_topic_name))
+    {
+      entry->last_used = ++cache->tick;
+      return entry->resolved_name;
+    }
+  }
+  return NULL;
+}
+
+/// Remember a resolved name, evicting the least recently used entry if full.
+/**
+ * Failing to allocate the cached copies only skips caching; the caller's
+ * result is not affected.
+ */
+static
+void
+rcl_resolved_name_cache_store(
+  rcl_resolved_name_cache_t * cache,
+  const char * input_topic_name,
+  const char * resolved_name,
+  bool is_service,
+  bool only_expand,
+  const rcl_allocator_t * allocator)
+{
+  rcl_resolved_name_cache_entry_t * victim = &cache->entries[0];
+  for (size_t i = 0; i < RCL_NODE_RESOLVED_NAME_CACHE_SIZE; ++i) {
+    rcl_resolved_name_cache_entry_t * entry = &cache->entries[i];
+    if (NULL == entry->input_name) {
+      victim = entry;
+      break;
+    }
+    if (entry->last_used < victim->last_used) {
+      victim = entry;
+    }
+  }
+  char * input_copy = rcutils_strdup(input_topic_name, *allocator);
+  if (NULL == input_copy) {
+    return;
+  }
+  char * resolved_copy = rcutils_strdup(resolved_name, *allocator);
+  if (NULL == resolved_copy) {
+    allocator->deallocate(input_copy, allocator->state);
+    return;
+  }
+  if (NULL != victim->input_name) {
+    allocator->deallocate(victim->input_name, allocator->state);
+    allocator->deallocate(victim->resolved_name, allocator->state);
+  }
+  victim->input_name = input_copy;
+  victim->resolved_name = resolved_copy;
+  victim->is_service = is_service;
+  victim->only_expand = only_expand;
+  victim->last_used = ++cache->tick;
+}
+
 static
 rcl_ret_t
 rcl_resolve_name(
@@ -35,6 +128,8 @@ rcl_resolve_name(
   const char * input_topic_name,
   const char * node_name,
   const char * node_namespace,
+  const rcutils_string_map_t * substitutions_map,
+  char * expanded_topic_name,
   rcl_allocator_t allocator,
   bool is_service,
   bool only_expand,
@@ -42,43 +137,26 @@ rcl_resolve_name(
 {
   // the other arguments are checked by rcl_expand_topic_name() and rcl_remap_name()
   RCL_CHECK_ARGUMENT_FOR_NULL(output_topic_name, RCL_RET_INVALID_ARGUMENT);
-  // Create default topic name substitutions map
-  rcutils_string_map_t substitutions_map = rcutils_get_zero_initialized_string_map();
-  rcutils_ret_t rcutils_ret = rcutils_string_map_init(&substitutions_map, 0, allocator);
-  if (rcutils_ret != RCUTILS_RET_OK) {
-    rcutils_error_string_t error = rcutils_get_error_string();
-    rcutils_reset_error();
-    RCL_SET_ERROR_MSG(error.str);
-    if (RCUTILS_RET_BAD_ALLOC == rcutils_ret) {
-      return RCL_RET_BAD_ALLOC;
-    }
-    return RCL_RET_ERROR;
-  }
-  char * expanded_topic_name = NULL;
   char * remapped_topic_name = NULL;
-  rcl_ret_t ret = rcl_get_default_topic_name_substitutions(&substitutions_map);
-  if (ret != RCL_RET_OK) {
-    if (RCL_RET_BAD_ALLOC != ret) {
-      ret = RCL_RET_ERROR;
+  rcl_ret_t ret = RCL_RET_OK;
+  // expand topic name, unless the caller already expanded it
+  if (NULL == expanded_topic_name) {
+    ret = rcl_expand_topic_name(
+      input_topic_name,
+      node_name,
+      node_namespace,
+      substitutions_map,
+      allocator,
+      &expanded_topic_name);
+    if (RCL_RET_OK != ret) {
+      goto cleanup;
     }
-    goto cleanup;
-  }
-  // expand topic name
-  ret = rcl_expand_topic_name(
-    input_topic_name,
-    node_name,
-    node_namespace,
-    &substitutions_map,
-    allocator,
-    &expanded_topic_name);
-  if (RCL_RET_OK != ret) {
-    goto cleanup;
   }
   // remap topic name
   if (!only_expand) {
     ret = rcl_remap_name(
       local_args, global_args, is_service ? RCL_SERVICE_REMAP : RCL_TOPIC_REMAP,
-      expanded_topic_name, node_name, node_namespace, &substitutions_map, allocator,
+      expanded_topic_name, node_name, node_namespace, substitutions_map, allocator,
       &remapped_topic_name);
     if (RCL_RET_OK != ret) {
       goto cleanup;
@@ -107,21 +185,6 @@ rcl_resolve_name(
   remapped_topic_name = NULL;
 
 cleanup:
-  rcutils_ret = rcutils_string_map_fini(&substitutions_map);
-  if (rcutils_ret != RCUTILS_RET_OK) {
-    rcutils_error_string_t error = rcutils_get_error_string();
-    rcutils_reset_error();
-    if (RCL_RET_OK == ret) {
-      RCL_SET_ERROR_MSG(error.str);
-      ret = RCL_RET_ERROR;
-    } else {
-      RCUTILS_LOG_ERROR_NAMED(
-        ROS_PACKAGE_NAME,
-        "failed to fini string_map (%d) during error handling: %s",
-        rcutils_ret,
-        error.str);
-    }
-  }
   allocator.deallocate(expanded_topic_name, allocator.state);
   allocator.deallocate(remapped_topic_name, allocator.state);
   if (is_service && RCL_RET_TOPIC_NAME_INVALID == ret) {
@@ -149,14 +212,71 @@ rcl_node_resolve_name(
     global_args = &(node->context->global_arguments);
   }
 
-  return rcl_resolve_name(
+  // Remap rules are fixed after node initialization, so a name that resolved
+  // once resolves the same way every time; repeat resolutions only pay for a
+  // cache scan and one copy with the caller's allocator.
+  rcl_resolved_name_cache_t * cache = &node->impl->resolved_name_cache;
+  if (NULL != input_topic_name && NULL != output_topic_name) {
+    const char * cached = rcl_resolved_name_cache_lookup(
+      cache, input_topic_name, is_service, only_expand);
+    if (NULL != cached) {
+      *output_topic_name = rcutils_strdup(cached, allocator);
+      if (NULL == *output_topic_name) {
+        RCL_SET_ERROR_MSG("failed to allocate memory for output topic");
+        return RCL_RET_BAD_ALLOC;
+      }
+      return RCL_RET_OK;
+    }
+  }
+
+  // Names without substitution tokens are expanded directly from the node's
+  // canonical strings; the node name and namespace were already validated at
+  // node init, so only the input name itself still needs validating.
+  char * expanded_topic_name = NULL;
+  if (NULL != input_topic_name && NULL != output_topic_name &&
+    NULL == strchr(input_topic_name, '{'))
+  {
+    int validation_result;
+    rcl_ret_t validation_ret =
+      rcl_validate_topic_name(input_topic_name, &validation_result, NULL);
+    if (RCL_RET_OK != validation_ret) {
+      return validation_ret;
+    }
+    if (RCL_TOPIC_NAME_VALID != validation_result) {
+      RCL_SET_ERROR_MSG(rcl_topic_name_validation_result_string(validation_result));
+      return is_service ? RCL_RET_SERVICE_NAME_INVALID : RCL_RET_TOPIC_NAME_INVALID;
+    }
+    if ('~' == input_topic_name[0]) {
+      expanded_topic_name = rcutils_format_string(
+        allocator, "%s%s", node->impl->fq_name, input_topic_name + 1);
+    } else if ('/' == input_topic_name[0]) {
+      expanded_topic_name = rcutils_strdup(input_topic_name, allocator);
+    } else {
+      expanded_topic_name = rcutils_format_string(
+        allocator, "%s%s", node->impl->ns_prefix, input_topic_name);
+    }
+    if (NULL == expanded_topic_name) {
+      RCL_SET_ERROR_MSG("failed to allocate memory for expanded topic name");
+      return RCL_RET_BAD_ALLOC;
+    }
+  }
+
+  rcl_ret_t ret = rcl_resolve_name(
     &(node_options->arguments),
     global_args,
     input_topic_name,
     rcl_node_get_name(node),
     rcl_node_get_namespace(node),
+    &node->impl->substitutions_map,
+    expanded_topic_name,
     allocator,
     is_service,
     only_expand,
     output_topic_name);
+  if (RCL_RET_OK == ret && NULL != input_topic_name && NULL != output_topic_name) {
+    rcl_resolved_name_cache_store(
+      cache, input_topic_name, *output_topic_name, is_service, only_expand,
+      &node->impl->options.allocator);
+  }
+  return ret;
 }
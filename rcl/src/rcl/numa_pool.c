@@ -0,0 +1,265 @@
+// Copyright 2026 Open Source Robotics Foundation, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+#include "rcl/numa_pool.h"
+
+#include <stdint.h>
+#include <string.h>
+
+#include "rcl/error_handling.h"
+
+/// Alignment of every block payload handed out by the pool.
+#define _RCL_NUMA_POOL_ALIGNMENT (sizeof(max_align_t))
+
+/// Block header; `size` is the total block size including this header.
+/**
+ * Free blocks additionally thread `next` through the address-ordered free
+ * list; allocated blocks only keep `size` so free can find the extent.
+ */
+typedef struct rcl_numa_pool_block_s
+{
+  size_t size;
+  struct rcl_numa_pool_block_s * next;
+} rcl_numa_pool_block_t;
+
+/// Header bytes preserved in front of every allocated payload.
+#define _RCL_NUMA_POOL_HEADER_SIZE \
+  ((sizeof(rcl_numa_pool_block_t) + _RCL_NUMA_POOL_ALIGNMENT - 1) & \
+  ~(_RCL_NUMA_POOL_ALIGNMENT - 1))
+
+struct rcl_numa_pool_impl_s
+{
+  rcl_allocator_t backing_allocator;
+  uint8_t * arena;
+  size_t capacity;
+  size_t used;
+  /// Address-ordered list of free blocks, coalesced on free.
+  rcl_numa_pool_block_t * free_list;
+};
+
+static void *
+_rcl_numa_pool_allocate(size_t size, void * state)
+{
+  rcl_numa_pool_impl_t * impl = state;
+  if (NULL == impl || 0 == size) {
+    return NULL;
+  }
+  size_t payload = (size + _RCL_NUMA_POOL_ALIGNMENT - 1) & ~(_RCL_NUMA_POOL_ALIGNMENT - 1);
+  size_t total = _RCL_NUMA_POOL_HEADER_SIZE + payload;
+  rcl_numa_pool_block_t ** link = &impl->free_list;
+  while (NULL != *link) {
+    rcl_numa_pool_block_t * block = *link;
+    if (block->size >= total) {
+      if (block->size - total >= _RCL_NUMA_POOL_HEADER_SIZE + _RCL_NUMA_POOL_ALIGNMENT) {
+        // split, keeping the tail on the free list
+        rcl_numa_pool_block_t * tail =
+          (rcl_numa_pool_block_t *)((uint8_t *)block + total);
+        tail->size = block->size - total;
+        tail->next = block->next;
+        block->size = total;
+        *link = tail;
+      } else {
+        // remainder too small to be a block, hand out the whole thing
+        *link = block->next;
+      }
+      impl->used += block->size;
+      return (uint8_t *)block + _RCL_NUMA_POOL_HEADER_SIZE;
+    }
+    link = &block->next;
+  }
+  // full; fail rather than spill onto a remote node
+  return NULL;
+}
+
+static void
+_rcl_numa_pool_deallocate(void * pointer, void * state)
+{
+  rcl_numa_pool_impl_t * impl = state;
+  if (NULL == impl || NULL == pointer) {
+    return;
+  }
+  rcl_numa_pool_block_t * block =
+    (rcl_numa_pool_block_t *)((uint8_t *)pointer - _RCL_NUMA_POOL_HEADER_SIZE);
+  impl->used -= block->size;
+  // insert address-ordered so adjacent free blocks can coalesce
+  rcl_numa_pool_block_t ** link = &impl->free_list;
+  while (NULL != *link && *link < block) {
+    link = &(*link)->next;
+  }
+  block->next = *link;
+  *link = block;
+  if (NULL != block->next &&
+    (uint8_t *)block + block->size == (uint8_t *)block->next)
+  {
+    block->size += block->next->size;
+    block->next = block->next->next;
+  }
+  if (link != &impl->free_list) {
+    rcl_numa_pool_block_t * prev =
+      (rcl_numa_pool_block_t *)((uint8_t *)link - offsetof(rcl_numa_pool_block_t, next));
+    if ((uint8_t *)prev + prev->size == (uint8_t *)block) {
+      prev->size += block->size;
+      prev->next = block->next;
+    }
+  }
+}
+
+static void *
+_rcl_numa_pool_reallocate(void * pointer, size_t size, void * state)
+{
+  rcl_numa_pool_impl_t * impl = state;
+  if (NULL == impl) {
+    return NULL;
+  }
+  if (NULL == pointer) {
+    return _rcl_numa_pool_allocate(size, state);
+  }
+  if (0 == size) {
+    _rcl_numa_pool_deallocate(pointer, state);
+    return NULL;
+  }
+  rcl_numa_pool_block_t * block =
+    (rcl_numa_pool_block_t *)((uint8_t *)pointer - _RCL_NUMA_POOL_HEADER_SIZE);
+  size_t old_payload = block->size - _RCL_NUMA_POOL_HEADER_SIZE;
+  if (old_payload >= size) {
+    return pointer;
+  }
+  void * moved = _rcl_numa_pool_allocate(size, state);
+  if (NULL == moved) {
+    return NULL;
+  }
+  memcpy(moved, pointer, old_payload);
+  _rcl_numa_pool_deallocate(pointer, state);
+  return moved;
+}
+
+static void *
+_rcl_numa_pool_zero_allocate(size_t number_of_elements, size_t size_of_element, void * state)
+{
+  if (0 != size_of_element && number_of_elements > SIZE_MAX / size_of_element) {
+    return NULL;
+  }
+  void * pointer = _rcl_numa_pool_allocate(number_of_elements * size_of_element, state);
+  if (NULL != pointer) {
+    memset(pointer, 0, number_of_elements * size_of_element);
+  }
+  return pointer;
+}
+
+rcl_numa_pool_t
+rcl_get_zero_initialized_numa_pool(void)
+{
+  static rcl_numa_pool_t null_pool = {0};
+  return null_pool;
+}
+
+rcl_ret_t
+rcl_numa_pool_init(
+  rcl_numa_pool_t * pool,
+  size_t capacity,
+  rcl_allocator_t backing_allocator)
+{
+  RCL_CHECK_ARGUMENT_FOR_NULL(pool, RCL_RET_INVALID_ARGUMENT);
+  RCL_CHECK_ALLOCATOR_WITH_MSG(
+    &backing_allocator, "invalid allocator", return RCL_RET_INVALID_ARGUMENT);
+  if (capacity < _RCL_NUMA_POOL_HEADER_SIZE + _RCL_NUMA_POOL_ALIGNMENT) {
+    RCL_SET_ERROR_MSG("capacity too small to hold a single block");
+    return RCL_RET_INVALID_ARGUMENT;
+  }
+  if (NULL != pool->impl) {
+    RCL_SET_ERROR_MSG("numa pool already initialized, or memory was uninitialized");
+    return RCL_RET_ALREADY_INIT;
+  }
+  rcl_numa_pool_impl_t * impl = backing_allocator.allocate(
+    sizeof(rcl_numa_pool_impl_t), backing_allocator.state);
+  if (NULL == impl) {
+    RCL_SET_ERROR_MSG("allocating memory failed");
+    return RCL_RET_BAD_ALLOC;
+  }
+  // round down so the arena is a whole number of aligned blocks
+  capacity &= ~(_RCL_NUMA_POOL_ALIGNMENT - 1);
+  impl->arena = backing_allocator.allocate(capacity, backing_allocator.state);
+  if (NULL == impl->arena) {
+    backing_allocator.deallocate(impl, backing_allocator.state);
+    RCL_SET_ERROR_MSG("allocating memory failed");
+    return RCL_RET_BAD_ALLOC;
+  }
+  // touch every page from this thread; first-touch placement binds the
+  // arena to the calling thread's NUMA node
+  memset(impl->arena, 0, capacity);
+  impl->backing_allocator = backing_allocator;
+  impl->capacity = capacity;
+  impl->used = 0;
+  impl->free_list = (rcl_numa_pool_block_t *)impl->arena;
+  impl->free_list->size = capacity;
+  impl->free_list->next = NULL;
+  pool->impl = impl;
+  return RCL_RET_OK;
+}
+
+rcl_ret_t
+rcl_numa_pool_fini(rcl_numa_pool_t * pool)
+{
+  RCL_CHECK_ARGUMENT_FOR_NULL(pool, RCL_RET_INVALID_ARGUMENT);
+  if (NULL == pool->impl) {
+    return RCL_RET_OK;
+  }
+  rcl_allocator_t backing_allocator = pool->impl->backing_allocator;
+  backing_allocator.deallocate(pool->impl->arena, backing_allocator.state);
+  backing_allocator.deallocate(pool->impl, backing_allocator.state);
+  pool->impl = NULL;
+  return RCL_RET_OK;
+}
+
+rcl_allocator_t
+rcl_numa_pool_get_allocator(const rcl_numa_pool_t * pool)
+{
+  if (NULL == pool || NULL == pool->impl) {
+    static rcl_allocator_t null_allocator = {0};
+    return null_allocator;
+  }
+  rcl_allocator_t allocator = {
+    .allocate = _rcl_numa_pool_allocate,
+    .deallocate = _rcl_numa_pool_deallocate,
+    .reallocate = _rcl_numa_pool_reallocate,
+    .zero_allocate = _rcl_numa_pool_zero_allocate,
+    .state = pool->impl,
+  };
+  return allocator;
+}
+
+rcl_ret_t
+rcl_numa_pool_get_usage(
+  const rcl_numa_pool_t * pool,
+  size_t * used,
+  size_t * capacity)
+{
+  RCL_CHECK_ARGUMENT_FOR_NULL(pool, RCL_RET_INVALID_ARGUMENT);
+  RCL_CHECK_ARGUMENT_FOR_NULL(used, RCL_RET_INVALID_ARGUMENT);
+  RCL_CHECK_ARGUMENT_FOR_NULL(capacity, RCL_RET_INVALID_ARGUMENT);
+  RCL_CHECK_FOR_NULL_WITH_MSG(
+    pool->impl, "numa pool is not initialized", return RCL_RET_NOT_INIT);
+  *used = pool->impl->used;
+  *capacity = pool->impl->capacity;
+  return RCL_RET_OK;
+}
+
+#ifdef __cplusplus
+}
+#endif
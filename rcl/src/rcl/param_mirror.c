@@ -0,0 +1,587 @@
+// Copyright 2026 Open Source Robotics Foundation, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+#include "rcl/param_mirror.h"
+
+#include <stdio.h>
+#include <string.h>
+
+#include "rcl/error_handling.h"
+#include "rcutils/stdatomic_helper.h"
+#include "rcutils/strdup.h"
+
+#if !defined(_WIN32)
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+rcl_param_mirror_t
+rcl_get_zero_initialized_param_mirror(void)
+{
+  static rcl_param_mirror_t null_mirror = {0};
+  return null_mirror;
+}
+
+rcl_param_mirror_reader_t
+rcl_get_zero_initialized_param_mirror_reader(void)
+{
+  static rcl_param_mirror_reader_t null_reader = {0};
+  return null_reader;
+}
+
+#if defined(_WIN32)
+
+// The mirror rides POSIX shared memory; keep the API linkable elsewhere.
+
+rcl_ret_t
+rcl_param_mirror_init(
+  rcl_param_mirror_t * mirror,
+  const char * segment_name,
+  const rcl_params_t * params,
+  rcl_allocator_t allocator)
+{
+  (void)mirror;
+  (void)segment_name;
+  (void)params;
+  (void)allocator;
+  RCL_SET_ERROR_MSG("parameter mirror requires POSIX shared memory");
+  return RCL_RET_UNSUPPORTED;
+}
+
+rcl_ret_t
+rcl_param_mirror_update(rcl_param_mirror_t * mirror, const rcl_params_t * params)
+{
+  (void)mirror;
+  (void)params;
+  RCL_SET_ERROR_MSG("parameter mirror requires POSIX shared memory");
+  return RCL_RET_UNSUPPORTED;
+}
+
+rcl_ret_t
+rcl_param_mirror_fini(rcl_param_mirror_t * mirror)
+{
+  (void)mirror;
+  RCL_SET_ERROR_MSG("parameter mirror requires POSIX shared memory");
+  return RCL_RET_UNSUPPORTED;
+}
+
+rcl_ret_t
+rcl_param_mirror_reader_open(
+  rcl_param_mirror_reader_t * reader,
+  const char * segment_name,
+  rcl_allocator_t allocator)
+{
+  (void)reader;
+  (void)segment_name;
+  (void)allocator;
+  RCL_SET_ERROR_MSG("parameter mirror requires POSIX shared memory");
+  return RCL_RET_UNSUPPORTED;
+}
+
+rcl_ret_t
+rcl_param_mirror_reader_read(
+  const rcl_param_mirror_reader_t * reader,
+  const char * node_name,
+  const char * parameter_name,
+  rcl_param_mirror_value_t * value)
+{
+  (void)reader;
+  (void)node_name;
+  (void)parameter_name;
+  (void)value;
+  RCL_SET_ERROR_MSG("parameter mirror requires POSIX shared memory");
+  return RCL_RET_UNSUPPORTED;
+}
+
+rcl_ret_t
+rcl_param_mirror_reader_close(rcl_param_mirror_reader_t * reader)
+{
+  (void)reader;
+  RCL_SET_ERROR_MSG("parameter mirror requires POSIX shared memory");
+  return RCL_RET_UNSUPPORTED;
+}
+
+#else  // !defined(_WIN32)
+
+#define _RCL_PARAM_MIRROR_MAGIC 0x52434c50u  // "RCLP"
+#define _RCL_PARAM_MIRROR_LAYOUT_VERSION 1u
+
+/// One shared parameter entry; `sequence` is odd while its value is being
+/// rewritten, the usual seqlock convention.
+typedef struct rcl_param_mirror_entry_s
+{
+  atomic_uint_least64_t sequence;
+  uint32_t type;
+  char node_name[RCL_PARAM_MIRROR_NAME_CAPACITY];
+  char parameter_name[RCL_PARAM_MIRROR_NAME_CAPACITY];
+  bool bool_value;
+  int64_t integer_value;
+  double double_value;
+  char string_value[RCL_PARAM_MIRROR_STRING_CAPACITY];
+} rcl_param_mirror_entry_t;
+
+/// Segment header followed by `capacity_entries` entries.
+/**
+ * `generation` is odd while the table structure is being rewritten; value
+ * refreshes leave it untouched so readers of unrelated parameters never
+ * retry.
+ */
+typedef struct rcl_param_mirror_header_s
+{
+  uint32_t magic;
+  uint32_t layout_version;
+  atomic_uint_least64_t generation;
+  uint64_t num_entries;
+  uint64_t capacity_entries;
+} rcl_param_mirror_header_t;
+
+struct rcl_param_mirror_impl_s
+{
+  rcl_allocator_t allocator;
+  char * segment_name;
+  rcl_param_mirror_header_t * header;
+  size_t map_size;
+};
+
+struct rcl_param_mirror_reader_impl_s
+{
+  rcl_allocator_t allocator;
+  const rcl_param_mirror_header_t * header;
+  size_t map_size;
+};
+
+static rcl_param_mirror_entry_t *
+_rcl_param_mirror_entries(rcl_param_mirror_header_t * header)
+{
+  return (rcl_param_mirror_entry_t *)(header + 1);
+}
+
+static const rcl_param_mirror_entry_t *
+_rcl_param_mirror_entries_const(const rcl_param_mirror_header_t * header)
+{
+  return (const rcl_param_mirror_entry_t *)(header + 1);
+}
+
+/// Count the parameters in a snapshot, validating each is representable.
+static rcl_ret_t
+_rcl_param_mirror_count(const rcl_params_t * params, size_t * count)
+{
+  *count = 0;
+  for (size_t n = 0; n < params->num_nodes; ++n) {
+    if (strlen(params->node_names[n]) >= RCL_PARAM_MIRROR_NAME_CAPACITY) {
+      RCL_SET_ERROR_MSG("node name too long for the mirror layout");
+      return RCL_RET_INVALID_ARGUMENT;
+    }
+    const rcl_node_params_t * node_params = &params->params[n];
+    for (size_t p = 0; p < node_params->num_params; ++p) {
+      if (strlen(node_params->parameter_names[p]) >= RCL_PARAM_MIRROR_NAME_CAPACITY) {
+        RCL_SET_ERROR_MSG("parameter name too long for the mirror layout");
+        return RCL_RET_INVALID_ARGUMENT;
+      }
+      const rcl_variant_t * variant = &node_params->parameter_values[p];
+      if (NULL != variant->byte_array_value || NULL != variant->bool_array_value ||
+        NULL != variant->integer_array_value || NULL != variant->double_array_value ||
+        NULL != variant->string_array_value)
+      {
+        RCL_SET_ERROR_MSG("array parameters are not representable in the mirror layout");
+        return RCL_RET_INVALID_ARGUMENT;
+      }
+      if (NULL != variant->string_value &&
+        strlen(variant->string_value) >= RCL_PARAM_MIRROR_STRING_CAPACITY)
+      {
+        RCL_SET_ERROR_MSG("string parameter too long for the mirror layout");
+        return RCL_RET_INVALID_ARGUMENT;
+      }
+      ++(*count);
+    }
+  }
+  return RCL_RET_OK;
+}
+
+/// Fill an entry's identity and value fields; the sequence is not touched.
+static void
+_rcl_param_mirror_fill_entry(
+  rcl_param_mirror_entry_t * entry,
+  const char * node_name,
+  const char * parameter_name,
+  const rcl_variant_t * variant)
+{
+  snprintf(entry->node_name, sizeof(entry->node_name), "%s", node_name);
+  snprintf(entry->parameter_name, sizeof(entry->parameter_name), "%s", parameter_name);
+  entry->bool_value = false;
+  entry->integer_value = 0;
+  entry->double_value = 0.0;
+  entry->string_value[0] = '\0';
+  if (NULL != variant->bool_value) {
+    entry->type = RCL_PARAM_MIRROR_TYPE_BOOL;
+    entry->bool_value = *variant->bool_value;
+  } else if (NULL != variant->integer_value) {
+    entry->type = RCL_PARAM_MIRROR_TYPE_INTEGER;
+    entry->integer_value = *variant->integer_value;
+  } else if (NULL != variant->double_value) {
+    entry->type = RCL_PARAM_MIRROR_TYPE_DOUBLE;
+    entry->double_value = *variant->double_value;
+  } else if (NULL != variant->string_value) {
+    entry->type = RCL_PARAM_MIRROR_TYPE_STRING;
+    snprintf(entry->string_value, sizeof(entry->string_value), "%s", variant->string_value);
+  } else {
+    entry->type = RCL_PARAM_MIRROR_TYPE_NOT_SET;
+  }
+}
+
+/// True when the entry already carries exactly this value.
+static bool
+_rcl_param_mirror_entry_matches_value(
+  const rcl_param_mirror_entry_t * entry,
+  const rcl_variant_t * variant)
+{
+  if (NULL != variant->bool_value) {
+    return RCL_PARAM_MIRROR_TYPE_BOOL == entry->type &&
+           entry->bool_value == *variant->bool_value;
+  }
+  if (NULL != variant->integer_value) {
+    return RCL_PARAM_MIRROR_TYPE_INTEGER == entry->type &&
+           entry->integer_value == *variant->integer_value;
+  }
+  if (NULL != variant->double_value) {
+    return RCL_PARAM_MIRROR_TYPE_DOUBLE == entry->type &&
+           entry->double_value == *variant->double_value;
+  }
+  if (NULL != variant->string_value) {
+    return RCL_PARAM_MIRROR_TYPE_STRING == entry->type &&
+           0 == strcmp(entry->string_value, variant->string_value);
+  }
+  return RCL_PARAM_MIRROR_TYPE_NOT_SET == entry->type;
+}
+
+rcl_ret_t
+rcl_param_mirror_init(
+  rcl_param_mirror_t * mirror,
+  const char * segment_name,
+  const rcl_params_t * params,
+  rcl_allocator_t allocator)
+{
+  RCL_CHECK_ARGUMENT_FOR_NULL(mirror, RCL_RET_INVALID_ARGUMENT);
+  RCL_CHECK_ARGUMENT_FOR_NULL(segment_name, RCL_RET_INVALID_ARGUMENT);
+  RCL_CHECK_ARGUMENT_FOR_NULL(params, RCL_RET_INVALID_ARGUMENT);
+  RCL_CHECK_ALLOCATOR_WITH_MSG(&allocator, "invalid allocator", return RCL_RET_INVALID_ARGUMENT);
+  if ('/' != segment_name[0]) {
+    RCL_SET_ERROR_MSG("segment_name must start with a slash");
+    return RCL_RET_INVALID_ARGUMENT;
+  }
+  if (NULL != mirror->impl) {
+    RCL_SET_ERROR_MSG("param mirror already initialized, or memory was uninitialized");
+    return RCL_RET_ALREADY_INIT;
+  }
+  size_t count = 0;
+  rcl_ret_t ret = _rcl_param_mirror_count(params, &count);
+  if (RCL_RET_OK != ret) {
+    return ret;  // error already set
+  }
+
+  rcl_param_mirror_impl_t * impl = allocator.allocate(
+    sizeof(rcl_param_mirror_impl_t), allocator.state);
+  if (NULL == impl) {
+    RCL_SET_ERROR_MSG("allocating memory failed");
+    return RCL_RET_BAD_ALLOC;
+  }
+  impl->allocator = allocator;
+  impl->segment_name = rcutils_strdup(segment_name, allocator);
+  if (NULL == impl->segment_name) {
+    allocator.deallocate(impl, allocator.state);
+    RCL_SET_ERROR_MSG("allocating memory failed");
+    return RCL_RET_BAD_ALLOC;
+  }
+  impl->map_size =
+    sizeof(rcl_param_mirror_header_t) + count * sizeof(rcl_param_mirror_entry_t);
+
+  // replace any stale segment from a previous incarnation
+  (void)shm_unlink(segment_name);
+  int fd = shm_open(segment_name, O_CREAT | O_EXCL | O_RDWR, 0644);
+  if (fd < 0) {
+    allocator.deallocate(impl->segment_name, allocator.state);
+    allocator.deallocate(impl, allocator.state);
+    RCL_SET_ERROR_MSG("failed to create the shared-memory segment");
+    return RCL_RET_ERROR;
+  }
+  if (0 != ftruncate(fd, (off_t)impl->map_size)) {
+    close(fd);
+    (void)shm_unlink(segment_name);
+    allocator.deallocate(impl->segment_name, allocator.state);
+    allocator.deallocate(impl, allocator.state);
+    RCL_SET_ERROR_MSG("failed to size the shared-memory segment");
+    return RCL_RET_ERROR;
+  }
+  void * map = mmap(NULL, impl->map_size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+  close(fd);
+  if (MAP_FAILED == map) {
+    (void)shm_unlink(segment_name);
+    allocator.deallocate(impl->segment_name, allocator.state);
+    allocator.deallocate(impl, allocator.state);
+    RCL_SET_ERROR_MSG("failed to map the shared-memory segment");
+    return RCL_RET_ERROR;
+  }
+  impl->header = map;
+
+  // publish under an odd generation so readers never see a half-built table
+  impl->header->magic = _RCL_PARAM_MIRROR_MAGIC;
+  impl->header->layout_version = _RCL_PARAM_MIRROR_LAYOUT_VERSION;
+  atomic_init(&impl->header->generation, 1);
+  impl->header->num_entries = count;
+  impl->header->capacity_entries = count;
+  rcl_param_mirror_entry_t * entries = _rcl_param_mirror_entries(impl->header);
+  size_t index = 0;
+  for (size_t n = 0; n < params->num_nodes; ++n) {
+    const rcl_node_params_t * node_params = &params->params[n];
+    for (size_t p = 0; p < node_params->num_params; ++p) {
+      atomic_init(&entries[index].sequence, 0);
+      _rcl_param_mirror_fill_entry(
+        &entries[index], params->node_names[n], node_params->parameter_names[p],
+        &node_params->parameter_values[p]);
+      ++index;
+    }
+  }
+  rcutils_atomic_store(&impl->header->generation, 2);
+  mirror->impl = impl;
+  return RCL_RET_OK;
+}
+
+rcl_ret_t
+rcl_param_mirror_update(rcl_param_mirror_t * mirror, const rcl_params_t * params)
+{
+  RCL_CHECK_ARGUMENT_FOR_NULL(mirror, RCL_RET_INVALID_ARGUMENT);
+  RCL_CHECK_ARGUMENT_FOR_NULL(params, RCL_RET_INVALID_ARGUMENT);
+  RCL_CHECK_FOR_NULL_WITH_MSG(
+    mirror->impl, "param mirror is not initialized", return RCL_RET_NOT_INIT);
+  size_t count = 0;
+  rcl_ret_t ret = _rcl_param_mirror_count(params, &count);
+  if (RCL_RET_OK != ret) {
+    return ret;  // error already set
+  }
+  rcl_param_mirror_header_t * header = mirror->impl->header;
+  if (count > header->capacity_entries) {
+    RCL_SET_ERROR_MSG("parameter count exceeds the mirror segment's capacity");
+    return RCL_RET_INVALID_ARGUMENT;
+  }
+  rcl_param_mirror_entry_t * entries = _rcl_param_mirror_entries(header);
+
+  // structural check: same names in the same flatten order
+  bool structure_unchanged = count == header->num_entries;
+  size_t index = 0;
+  for (size_t n = 0; structure_unchanged && n < params->num_nodes; ++n) {
+    const rcl_node_params_t * node_params = &params->params[n];
+    for (size_t p = 0; structure_unchanged && p < node_params->num_params; ++p) {
+      structure_unchanged =
+        0 == strcmp(entries[index].node_name, params->node_names[n]) &&
+        0 == strcmp(entries[index].parameter_name, node_params->parameter_names[p]);
+      ++index;
+    }
+  }
+
+  if (structure_unchanged) {
+    // refresh changed values in place, each under its own seqlock
+    index = 0;
+    for (size_t n = 0; n < params->num_nodes; ++n) {
+      const rcl_node_params_t * node_params = &params->params[n];
+      for (size_t p = 0; p < node_params->num_params; ++p) {
+        const rcl_variant_t * variant = &node_params->parameter_values[p];
+        if (!_rcl_param_mirror_entry_matches_value(&entries[index], variant)) {
+          uint64_t seq = rcutils_atomic_load_uint64_t(&entries[index].sequence);
+          rcutils_atomic_store(&entries[index].sequence, seq + 1);
+          _rcl_param_mirror_fill_entry(
+            &entries[index], params->node_names[n], node_params->parameter_names[p], variant);
+          rcutils_atomic_store(&entries[index].sequence, seq + 2);
+        }
+        ++index;
+      }
+    }
+    return RCL_RET_OK;
+  }
+
+  // structural rewrite under the generation seqlock
+  uint64_t generation = rcutils_atomic_load_uint64_t(&header->generation);
+  rcutils_atomic_store(&header->generation, generation + 1);
+  header->num_entries = count;
+  index = 0;
+  for (size_t n = 0; n < params->num_nodes; ++n) {
+    const rcl_node_params_t * node_params = &params->params[n];
+    for (size_t p = 0; p < node_params->num_params; ++p) {
+      _rcl_param_mirror_fill_entry(
+        &entries[index], params->node_names[n], node_params->parameter_names[p],
+        &node_params->parameter_values[p]);
+      ++index;
+    }
+  }
+  rcutils_atomic_store(&header->generation, generation + 2);
+  return RCL_RET_OK;
+}
+
+rcl_ret_t
+rcl_param_mirror_fini(rcl_param_mirror_t * mirror)
+{
+  RCL_CHECK_ARGUMENT_FOR_NULL(mirror, RCL_RET_INVALID_ARGUMENT);
+  if (NULL == mirror->impl) {
+    return RCL_RET_OK;
+  }
+  rcl_allocator_t allocator = mirror->impl->allocator;
+  munmap(mirror->impl->header, mirror->impl->map_size);
+  (void)shm_unlink(mirror->impl->segment_name);
+  allocator.deallocate(mirror->impl->segment_name, allocator.state);
+  allocator.deallocate(mirror->impl, allocator.state);
+  mirror->impl = NULL;
+  return RCL_RET_OK;
+}
+
+rcl_ret_t
+rcl_param_mirror_reader_open(
+  rcl_param_mirror_reader_t * reader,
+  const char * segment_name,
+  rcl_allocator_t allocator)
+{
+  RCL_CHECK_ARGUMENT_FOR_NULL(reader, RCL_RET_INVALID_ARGUMENT);
+  RCL_CHECK_ARGUMENT_FOR_NULL(segment_name, RCL_RET_INVALID_ARGUMENT);
+  RCL_CHECK_ALLOCATOR_WITH_MSG(&allocator, "invalid allocator", return RCL_RET_INVALID_ARGUMENT);
+  if (NULL != reader->impl) {
+    RCL_SET_ERROR_MSG("param mirror reader already initialized, or memory was uninitialized");
+    return RCL_RET_ALREADY_INIT;
+  }
+  int fd = shm_open(segment_name, O_RDONLY, 0);
+  if (fd < 0) {
+    RCL_SET_ERROR_MSG("failed to open the shared-memory segment");
+    return RCL_RET_ERROR;
+  }
+  struct stat segment_stat;
+  if (0 != fstat(fd, &segment_stat) ||
+    (size_t)segment_stat.st_size < sizeof(rcl_param_mirror_header_t))
+  {
+    close(fd);
+    RCL_SET_ERROR_MSG("shared-memory segment is not a parameter mirror");
+    return RCL_RET_ERROR;
+  }
+  size_t map_size = (size_t)segment_stat.st_size;
+  void * map = mmap(NULL, map_size, PROT_READ, MAP_SHARED, fd, 0);
+  close(fd);
+  if (MAP_FAILED == map) {
+    RCL_SET_ERROR_MSG("failed to map the shared-memory segment");
+    return RCL_RET_ERROR;
+  }
+  const rcl_param_mirror_header_t * header = map;
+  if (_RCL_PARAM_MIRROR_MAGIC != header->magic ||
+    _RCL_PARAM_MIRROR_LAYOUT_VERSION != header->layout_version ||
+    map_size < sizeof(rcl_param_mirror_header_t) +
+    header->capacity_entries * sizeof(rcl_param_mirror_entry_t))
+  {
+    munmap(map, map_size);
+    RCL_SET_ERROR_MSG("shared-memory segment is not a parameter mirror of this layout");
+    return RCL_RET_ERROR;
+  }
+  rcl_param_mirror_reader_impl_t * impl = allocator.allocate(
+    sizeof(rcl_param_mirror_reader_impl_t), allocator.state);
+  if (NULL == impl) {
+    munmap(map, map_size);
+    RCL_SET_ERROR_MSG("allocating memory failed");
+    return RCL_RET_BAD_ALLOC;
+  }
+  impl->allocator = allocator;
+  impl->header = header;
+  impl->map_size = map_size;
+  reader->impl = impl;
+  return RCL_RET_OK;
+}
+
+rcl_ret_t
+rcl_param_mirror_reader_read(
+  const rcl_param_mirror_reader_t * reader,
+  const char * node_name,
+  const char * parameter_name,
+  rcl_param_mirror_value_t * value)
+{
+  RCL_CHECK_ARGUMENT_FOR_NULL(reader, RCL_RET_INVALID_ARGUMENT);
+  RCL_CHECK_ARGUMENT_FOR_NULL(node_name, RCL_RET_INVALID_ARGUMENT);
+  RCL_CHECK_ARGUMENT_FOR_NULL(parameter_name, RCL_RET_INVALID_ARGUMENT);
+  RCL_CHECK_ARGUMENT_FOR_NULL(value, RCL_RET_INVALID_ARGUMENT);
+  RCL_CHECK_FOR_NULL_WITH_MSG(
+    reader->impl, "param mirror reader is not initialized", return RCL_RET_NOT_INIT);
+  // the atomics in the segment are in read-only pages for us; loading
+  // them is fine, the writer is the only side that stores
+  rcl_param_mirror_header_t * header =
+    (rcl_param_mirror_header_t *)reader->impl->header;
+  for (;;) {
+    uint64_t generation = rcutils_atomic_load_uint64_t(&header->generation);
+    if (generation & 1u) {
+      continue;  // structural rewrite in flight
+    }
+    const rcl_param_mirror_entry_t * entries = _rcl_param_mirror_entries_const(header);
+    bool found = false;
+    for (uint64_t i = 0; i < header->num_entries && !found; ++i) {
+      const rcl_param_mirror_entry_t * entry = &entries[i];
+      if (0 != strncmp(entry->node_name, node_name, RCL_PARAM_MIRROR_NAME_CAPACITY) ||
+        0 != strncmp(entry->parameter_name, parameter_name, RCL_PARAM_MIRROR_NAME_CAPACITY))
+      {
+        continue;
+      }
+      found = true;
+      uint64_t seq = rcutils_atomic_load_uint64_t(
+        (atomic_uint_least64_t *)&entry->sequence);
+      if (seq & 1u) {
+        break;  // value rewrite in flight, rescan
+      }
+      value->type = (rcl_param_mirror_type_t)entry->type;
+      value->bool_value = entry->bool_value;
+      value->integer_value = entry->integer_value;
+      value->double_value = entry->double_value;
+      memcpy(value->string_value, entry->string_value, sizeof(value->string_value));
+      value->string_value[sizeof(value->string_value) - 1] = '\0';
+      if (seq != rcutils_atomic_load_uint64_t((atomic_uint_least64_t *)&entry->sequence) ||
+        generation != rcutils_atomic_load_uint64_t(&header->generation))
+      {
+        break;  // torn read, rescan
+      }
+      return RCL_RET_OK;
+    }
+    if (!found &&
+      generation == rcutils_atomic_load_uint64_t(&header->generation))
+    {
+      RCL_SET_ERROR_MSG("parameter is not present in the mirror");
+      return RCL_RET_ERROR;
+    }
+  }
+}
+
+rcl_ret_t
+rcl_param_mirror_reader_close(rcl_param_mirror_reader_t * reader)
+{
+  RCL_CHECK_ARGUMENT_FOR_NULL(reader, RCL_RET_INVALID_ARGUMENT);
+  if (NULL == reader->impl) {
+    return RCL_RET_OK;
+  }
+  rcl_allocator_t allocator = reader->impl->allocator;
+  munmap((void *)reader->impl->header, reader->impl->map_size);
+  allocator.deallocate(reader->impl, allocator.state);
+  reader->impl = NULL;
+  return RCL_RET_OK;
+}
+
+#endif  // defined(_WIN32)
+
+#ifdef __cplusplus
+}
+#endif
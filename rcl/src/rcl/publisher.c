@@ -25,8 +25,10 @@ extern "C"
 #include "rcl/allocator.h"
 #include "rcl/error_handling.h"
 #include "rcl/node.h"
+#include "rcl/trace.h"
 #include "rcutils/logging_macros.h"
 #include "rcutils/macros.h"
+#include "rcutils/time.h"
 #include "rcl/time.h"
 #include "rmw/time.h"
 #include "rmw/error_handling.h"
@@ -42,61 +44,21 @@ rcl_get_zero_initialized_publisher()
   return null_publisher;
 }
 
-rcl_ret_t
-rcl_publisher_init(
+/// Shared tail of publisher initialization; `resolved_topic_name` must
+/// already be fully expanded and remapped and stays owned by the caller.
+static rcl_ret_t
+_rcl_publisher_init_with_resolved_name(
   rcl_publisher_t * publisher,
   const rcl_node_t * node,
   const rosidl_message_type_support_t * type_support,
-  const char * topic_name,
+  const char * resolved_topic_name,
   const rcl_publisher_options_t * options
 )
 {
-  RCUTILS_CAN_RETURN_WITH_ERROR_OF(RCL_RET_INVALID_ARGUMENT);
-  RCUTILS_CAN_RETURN_WITH_ERROR_OF(RCL_RET_ALREADY_INIT);
-  RCUTILS_CAN_RETURN_WITH_ERROR_OF(RCL_RET_NODE_INVALID);
-  RCUTILS_CAN_RETURN_WITH_ERROR_OF(RCL_RET_BAD_ALLOC);
-  RCUTILS_CAN_RETURN_WITH_ERROR_OF(RCL_RET_ERROR);
-  RCUTILS_CAN_RETURN_WITH_ERROR_OF(RCL_RET_TOPIC_NAME_INVALID);
-
+  rcl_ret_t ret = RCL_RET_OK;
   rcl_ret_t fail_ret = RCL_RET_ERROR;
-
-  // Check options and allocator first, so allocator can be used with errors.
-  RCL_CHECK_ARGUMENT_FOR_NULL(options, RCL_RET_INVALID_ARGUMENT);
   rcl_allocator_t * allocator = (rcl_allocator_t *)&options->allocator;
-  RCL_CHECK_ALLOCATOR_WITH_MSG(allocator, "invalid allocator", return RCL_RET_INVALID_ARGUMENT);
-
-  RCL_CHECK_ARGUMENT_FOR_NULL(publisher, RCL_RET_INVALID_ARGUMENT);
-  if (publisher->impl) {
-    RCL_SET_ERROR_MSG("publisher already initialized, or memory was unintialized");
-    return RCL_RET_ALREADY_INIT;
-  }
-  if (!rcl_node_is_valid(node)) {
-    return RCL_RET_NODE_INVALID;  // error already set
-  }
-  RCL_CHECK_ARGUMENT_FOR_NULL(type_support, RCL_RET_INVALID_ARGUMENT);
-  RCL_CHECK_ARGUMENT_FOR_NULL(topic_name, RCL_RET_INVALID_ARGUMENT);
-  RCUTILS_LOG_DEBUG_NAMED(
-    ROS_PACKAGE_NAME, "Initializing publisher for topic name '%s'", topic_name);
-
-  // Expand and remap the given topic name.
-  char * remapped_topic_name = NULL;
-  rcl_ret_t ret = rcl_node_resolve_name(
-    node,
-    topic_name,
-    *allocator,
-    false,
-    false,
-    &remapped_topic_name);
-  if (ret != RCL_RET_OK) {
-    if (ret == RCL_RET_TOPIC_NAME_INVALID || ret == RCL_RET_UNKNOWN_SUBSTITUTION) {
-      ret = RCL_RET_TOPIC_NAME_INVALID;
-    } else if (ret != RCL_RET_BAD_ALLOC) {
-      ret = RCL_RET_ERROR;
-    }
-    goto cleanup;
-  }
-  RCUTILS_LOG_DEBUG_NAMED(
-    ROS_PACKAGE_NAME, "Expanded and remapped topic name '%s'", remapped_topic_name);
+  const char * remapped_topic_name = resolved_topic_name;
 
   // Allocate space for the implementation struct.
   publisher->impl = (rcl_publisher_impl_t *)allocator->allocate(
@@ -130,6 +92,26 @@ rcl_publisher_init(
   RCUTILS_LOG_DEBUG_NAMED(ROS_PACKAGE_NAME, "Publisher initialized");
   // context
   publisher->impl->context = node->context;
+  publisher->impl->sealed = false;
+  memset(&publisher->impl->loan_pool, 0, sizeof(publisher->impl->loan_pool));
+  publisher->impl->type_support = type_support;
+  publisher->impl->serialized_cache = rmw_get_zero_initialized_serialized_message();
+  publisher->impl->serialized_cache_valid = false;
+  publisher->impl->statistics_enabled = false;
+  atomic_init(&publisher->impl->stat_publish_count, 0);
+  atomic_init(&publisher->impl->stat_serialized_publish_count, 0);
+  atomic_init(&publisher->impl->stat_serialized_bytes_total, 0);
+  atomic_init(&publisher->impl->stat_last_serialized_size, 0);
+  atomic_init(&publisher->impl->stat_ewma_rmw_publish_duration_ns, 0);
+  publisher->impl->network_flow_cache = rmw_get_zero_initialized_network_flow_endpoint_array();
+  publisher->impl->network_flow_cache_valid = false;
+  publisher->impl->network_flow_cache_stale = false;
+  publisher->impl->extra_sessions = NULL;
+  publisher->impl->num_extra_sessions = 0u;
+  publisher->impl->stamp_clock = NULL;
+  publisher->impl->stamp_offset = 0u;
+  publisher->impl->intra_process_channel = NULL;
+  publisher->impl->hop_record = NULL;
   TRACETOOLS_TRACEPOINT(
     rcl_publisher_init,
     (const void *)publisher,
@@ -156,10 +138,114 @@ fail:
   ret = fail_ret;
   // Fall through to cleanup
 cleanup:
+  return ret;
+}
+
+rcl_ret_t
+rcl_publisher_init(
+  rcl_publisher_t * publisher,
+  const rcl_node_t * node,
+  const rosidl_message_type_support_t * type_support,
+  const char * topic_name,
+  const rcl_publisher_options_t * options
+)
+{
+  RCUTILS_CAN_RETURN_WITH_ERROR_OF(RCL_RET_INVALID_ARGUMENT);
+  RCUTILS_CAN_RETURN_WITH_ERROR_OF(RCL_RET_ALREADY_INIT);
+  RCUTILS_CAN_RETURN_WITH_ERROR_OF(RCL_RET_NODE_INVALID);
+  RCUTILS_CAN_RETURN_WITH_ERROR_OF(RCL_RET_BAD_ALLOC);
+  RCUTILS_CAN_RETURN_WITH_ERROR_OF(RCL_RET_ERROR);
+  RCUTILS_CAN_RETURN_WITH_ERROR_OF(RCL_RET_TOPIC_NAME_INVALID);
+
+  // Check options and allocator first, so allocator can be used with errors.
+  RCL_CHECK_ARGUMENT_FOR_NULL(options, RCL_RET_INVALID_ARGUMENT);
+  rcl_allocator_t * allocator = (rcl_allocator_t *)&options->allocator;
+  RCL_CHECK_ALLOCATOR_WITH_MSG(allocator, "invalid allocator", return RCL_RET_INVALID_ARGUMENT);
+
+  RCL_CHECK_ARGUMENT_FOR_NULL(publisher, RCL_RET_INVALID_ARGUMENT);
+  if (publisher->impl) {
+    RCL_SET_ERROR_MSG("publisher already initialized, or memory was unintialized");
+    return RCL_RET_ALREADY_INIT;
+  }
+  if (!rcl_node_is_valid(node)) {
+    return RCL_RET_NODE_INVALID;  // error already set
+  }
+  RCL_CHECK_ARGUMENT_FOR_NULL(type_support, RCL_RET_INVALID_ARGUMENT);
+  RCL_CHECK_ARGUMENT_FOR_NULL(topic_name, RCL_RET_INVALID_ARGUMENT);
+  RCUTILS_LOG_DEBUG_NAMED(
+    ROS_PACKAGE_NAME, "Initializing publisher for topic name '%s'", topic_name);
+
+  // Expand and remap the given topic name.
+  char * remapped_topic_name = NULL;
+  rcl_ret_t ret = rcl_node_resolve_name(
+    node,
+    topic_name,
+    *allocator,
+    false,
+    false,
+    &remapped_topic_name);
+  if (ret != RCL_RET_OK) {
+    if (ret == RCL_RET_TOPIC_NAME_INVALID || ret == RCL_RET_UNKNOWN_SUBSTITUTION) {
+      ret = RCL_RET_TOPIC_NAME_INVALID;
+    } else if (ret != RCL_RET_BAD_ALLOC) {
+      ret = RCL_RET_ERROR;
+    }
+    allocator->deallocate(remapped_topic_name, allocator->state);
+    return ret;
+  }
+  RCUTILS_LOG_DEBUG_NAMED(
+    ROS_PACKAGE_NAME, "Expanded and remapped topic name '%s'", remapped_topic_name);
+
+  ret = _rcl_publisher_init_with_resolved_name(
+    publisher, node, type_support, remapped_topic_name, options);
   allocator->deallocate(remapped_topic_name, allocator->state);
   return ret;
 }
 
+rcl_ret_t
+rcl_publisher_init_with_resolved_name(
+  rcl_publisher_t * publisher,
+  const rcl_node_t * node,
+  const rosidl_message_type_support_t * type_support,
+  const char * resolved_topic_name,
+  const rcl_publisher_options_t * options
+)
+{
+  RCUTILS_CAN_RETURN_WITH_ERROR_OF(RCL_RET_INVALID_ARGUMENT);
+  RCUTILS_CAN_RETURN_WITH_ERROR_OF(RCL_RET_ALREADY_INIT);
+  RCUTILS_CAN_RETURN_WITH_ERROR_OF(RCL_RET_NODE_INVALID);
+  RCUTILS_CAN_RETURN_WITH_ERROR_OF(RCL_RET_BAD_ALLOC);
+  RCUTILS_CAN_RETURN_WITH_ERROR_OF(RCL_RET_ERROR);
+  RCUTILS_CAN_RETURN_WITH_ERROR_OF(RCL_RET_TOPIC_NAME_INVALID);
+
+  RCL_CHECK_ARGUMENT_FOR_NULL(options, RCL_RET_INVALID_ARGUMENT);
+  rcl_allocator_t * allocator = (rcl_allocator_t *)&options->allocator;
+  RCL_CHECK_ALLOCATOR_WITH_MSG(allocator, "invalid allocator", return RCL_RET_INVALID_ARGUMENT);
+
+  RCL_CHECK_ARGUMENT_FOR_NULL(publisher, RCL_RET_INVALID_ARGUMENT);
+  if (publisher->impl) {
+    RCL_SET_ERROR_MSG("publisher already initialized, or memory was unintialized");
+    return RCL_RET_ALREADY_INIT;
+  }
+  if (!rcl_node_is_valid(node)) {
+    return RCL_RET_NODE_INVALID;  // error already set
+  }
+  RCL_CHECK_ARGUMENT_FOR_NULL(type_support, RCL_RET_INVALID_ARGUMENT);
+  RCL_CHECK_ARGUMENT_FOR_NULL(resolved_topic_name, RCL_RET_INVALID_ARGUMENT);
+  // The name is trusted to come from a prior resolution; only guard against
+  // names that obviously never went through one.
+  if ('/' != resolved_topic_name[0]) {
+    RCL_SET_ERROR_MSG("resolved topic name must be fully qualified");
+    return RCL_RET_TOPIC_NAME_INVALID;
+  }
+  RCUTILS_LOG_DEBUG_NAMED(
+    ROS_PACKAGE_NAME, "Initializing publisher for resolved topic name '%s'",
+    resolved_topic_name);
+
+  return _rcl_publisher_init_with_resolved_name(
+    publisher, node, type_support, resolved_topic_name, options);
+}
+
 rcl_ret_t
 rcl_publisher_fini(rcl_publisher_t * publisher, rcl_node_t * node)
 {
@@ -176,11 +262,49 @@ rcl_publisher_fini(rcl_publisher_t * publisher, rcl_node_t * node)
 
   RCUTILS_LOG_DEBUG_NAMED(ROS_PACKAGE_NAME, "Finalizing publisher");
   if (publisher->impl) {
+    if (publisher->impl->sealed) {
+      RCL_SET_ERROR_MSG("publisher is sealed, call rcl_publisher_unseal() before fini");
+      return RCL_RET_ERROR;
+    }
     rcl_allocator_t allocator = publisher->impl->options.allocator;
+    if (publisher->impl->loan_pool.storage) {
+      allocator.deallocate(publisher->impl->loan_pool.storage, allocator.state);
+      allocator.deallocate(publisher->impl->loan_pool.free_blocks, allocator.state);
+    }
+    if (NULL != publisher->impl->serialized_cache.buffer) {
+      rmw_ret_t serialized_fini_ret =
+        rmw_serialized_message_fini(&publisher->impl->serialized_cache);
+      if (RMW_RET_OK != serialized_fini_ret) {
+        RCUTILS_SAFE_FWRITE_TO_STDERR(rmw_get_error_string().str);
+        RCUTILS_SAFE_FWRITE_TO_STDERR("\n");
+      }
+    }
+    if (publisher->impl->network_flow_cache_valid) {
+      rmw_ret_t flow_fini_ret =
+        rmw_network_flow_endpoint_array_fini(&publisher->impl->network_flow_cache);
+      if (RMW_RET_OK != flow_fini_ret) {
+        RCUTILS_SAFE_FWRITE_TO_STDERR(rmw_get_error_string().str);
+        RCUTILS_SAFE_FWRITE_TO_STDERR("\n");
+      }
+    }
     rmw_node_t * rmw_node = rcl_node_get_rmw_handle(node);
     if (!rmw_node) {
       return RCL_RET_INVALID_ARGUMENT;
     }
+    for (size_t i = 0; i < publisher->impl->num_extra_sessions; ++i) {
+      rmw_ret_t session_ret =
+        rmw_destroy_publisher(rmw_node, publisher->impl->extra_sessions[i]);
+      if (RMW_RET_OK != session_ret) {
+        RCL_SET_ERROR_MSG(rmw_get_error_string().str);
+        result = RCL_RET_ERROR;
+      }
+    }
+    if (NULL != publisher->impl->extra_sessions) {
+      allocator.deallocate(publisher->impl->extra_sessions, allocator.state);
+    }
+    if (NULL != publisher->impl->hop_record) {
+      allocator.deallocate(publisher->impl->hop_record, allocator.state);
+    }
     rmw_ret_t ret =
       rmw_destroy_publisher(rmw_node, publisher->impl->rmw_handle);
     if (ret != RMW_RET_OK) {
@@ -219,6 +343,79 @@ rcl_publisher_get_default_options()
   return default_options;
 }
 
+/// Return true if the message points into the publisher's fallback loan pool.
+static bool
+_rcl_publisher_loan_pool_owns(const rcl_publisher_impl_t * impl, const void * ros_message)
+{
+  const uint8_t * block = (const uint8_t *)ros_message;
+  return NULL != impl->loan_pool.storage &&
+         block >= impl->loan_pool.storage &&
+         block < impl->loan_pool.storage + impl->loan_pool.capacity * impl->loan_pool.block_size;
+}
+
+rcl_ret_t
+rcl_publisher_init_loan_pool(
+  rcl_publisher_t * publisher,
+  size_t message_size,
+  size_t capacity)
+{
+  if (!rcl_publisher_is_valid(publisher)) {
+    return RCL_RET_PUBLISHER_INVALID;  // error already set
+  }
+  if (0u == message_size || 0u == capacity) {
+    RCL_SET_ERROR_MSG("message_size and capacity must be greater than zero");
+    return RCL_RET_INVALID_ARGUMENT;
+  }
+  rcl_publisher_loan_pool_t * pool = &publisher->impl->loan_pool;
+  if (NULL != pool->storage) {
+    RCL_SET_ERROR_MSG("loan pool already initialized");
+    return RCL_RET_ALREADY_INIT;
+  }
+  rcl_allocator_t * allocator = &publisher->impl->options.allocator;
+  // Round each block up so every block starts suitably aligned for any type.
+  size_t block_size = (message_size + 15u) & ~(size_t)15u;
+  pool->free_blocks = (void **)allocator->allocate(
+    capacity * sizeof(void *), allocator->state);
+  RCL_CHECK_FOR_NULL_WITH_MSG(
+    pool->free_blocks, "allocating loan pool free list failed", return RCL_RET_BAD_ALLOC);
+  pool->storage = (uint8_t *)allocator->zero_allocate(
+    capacity, block_size, allocator->state);
+  if (NULL == pool->storage) {
+    allocator->deallocate(pool->free_blocks, allocator->state);
+    pool->free_blocks = NULL;
+    RCL_SET_ERROR_MSG("allocating loan pool storage failed");
+    return RCL_RET_BAD_ALLOC;
+  }
+  pool->block_size = block_size;
+  pool->capacity = capacity;
+  pool->num_free = capacity;
+  for (size_t i = 0; i < capacity; ++i) {
+    pool->free_blocks[i] = pool->storage + i * block_size;
+  }
+  return RCL_RET_OK;
+}
+
+rcl_ret_t
+rcl_publisher_fini_loan_pool(rcl_publisher_t * publisher)
+{
+  RCL_CHECK_ARGUMENT_FOR_NULL(publisher, RCL_RET_PUBLISHER_INVALID);
+  RCL_CHECK_FOR_NULL_WITH_MSG(
+    publisher->impl, "publisher implementation is invalid", return RCL_RET_PUBLISHER_INVALID);
+  rcl_publisher_loan_pool_t * pool = &publisher->impl->loan_pool;
+  if (NULL == pool->storage) {
+    return RCL_RET_OK;
+  }
+  if (pool->num_free != pool->capacity) {
+    RCL_SET_ERROR_MSG("loaned messages from the pool are still outstanding");
+    return RCL_RET_ERROR;
+  }
+  rcl_allocator_t * allocator = &publisher->impl->options.allocator;
+  allocator->deallocate(pool->storage, allocator->state);
+  allocator->deallocate(pool->free_blocks, allocator->state);
+  memset(pool, 0, sizeof(*pool));
+  return RCL_RET_OK;
+}
+
 rcl_ret_t
 rcl_borrow_loaned_message(
   const rcl_publisher_t * publisher,
@@ -228,8 +425,26 @@ rcl_borrow_loaned_message(
   if (!rcl_publisher_is_valid(publisher)) {
     return RCL_RET_PUBLISHER_INVALID;  // error already set
   }
-  return rcl_convert_rmw_ret_to_rcl_ret(
-    rmw_borrow_loaned_message(publisher->impl->rmw_handle, type_support, ros_message));
+  rcl_publisher_loan_pool_t * pool = &publisher->impl->loan_pool;
+  if (NULL != pool->storage && !publisher->impl->rmw_handle->can_loan_messages) {
+    RCL_CHECK_ARGUMENT_FOR_NULL(ros_message, RCL_RET_INVALID_ARGUMENT);
+    if (0u == pool->num_free) {
+      RCL_SET_ERROR_MSG("publisher loan pool is exhausted");
+      return RCL_RET_BAD_ALLOC;
+    }
+    void * block = pool->free_blocks[--pool->num_free];
+    // Blocks are handed out zeroed; the pool only supports self-contained
+    // (plain-old-data) message types, see rcl_publisher_init_loan_pool().
+    memset(block, 0, pool->block_size);
+    *ros_message = block;
+    return RCL_RET_OK;
+  }
+  rmw_ret_t rmw_ret =
+    rmw_borrow_loaned_message(publisher->impl->rmw_handle, type_support, ros_message);
+  if (RCL_LIKELY(RMW_RET_OK == rmw_ret)) {
+    return RCL_RET_OK;
+  }
+  return rcl_convert_rmw_ret_to_rcl_ret(rmw_ret);
 }
 
 rcl_ret_t
@@ -241,8 +456,214 @@ rcl_return_loaned_message_from_publisher(
     return RCL_RET_PUBLISHER_INVALID;  // error already set
   }
   RCL_CHECK_ARGUMENT_FOR_NULL(loaned_message, RCL_RET_INVALID_ARGUMENT);
-  return rcl_convert_rmw_ret_to_rcl_ret(
-    rmw_return_loaned_message_from_publisher(publisher->impl->rmw_handle, loaned_message));
+  if (_rcl_publisher_loan_pool_owns(publisher->impl, loaned_message)) {
+    rcl_publisher_loan_pool_t * pool = &publisher->impl->loan_pool;
+    pool->free_blocks[pool->num_free++] = loaned_message;
+    return RCL_RET_OK;
+  }
+  rmw_ret_t rmw_ret =
+    rmw_return_loaned_message_from_publisher(publisher->impl->rmw_handle, loaned_message);
+  if (RCL_LIKELY(RMW_RET_OK == rmw_ret)) {
+    return RCL_RET_OK;
+  }
+  return rcl_convert_rmw_ret_to_rcl_ret(rmw_ret);
+}
+
+/// Validate a publisher for a publish call, honoring sealed handles.
+/**
+ * A sealed publisher skips the full handle chain walk in release builds;
+ * debug builds always run the complete validation so sealing cannot mask a
+ * use-after-fini during development.
+ */
+static RCL_ALWAYS_INLINE bool
+_rcl_publisher_check_for_publish(const rcl_publisher_t * publisher)
+{
+#ifdef NDEBUG
+  if (NULL != publisher && NULL != publisher->impl && publisher->impl->sealed) {
+    return true;
+  }
+#endif
+  return rcl_publisher_is_valid(publisher);
+}
+
+rcl_ret_t
+rcl_publisher_set_stamp_on_publish(
+  rcl_publisher_t * publisher,
+  rcl_clock_t * clock,
+  size_t stamp_offset)
+{
+  if (!rcl_publisher_is_valid(publisher)) {
+    return RCL_RET_PUBLISHER_INVALID;  // error already set
+  }
+  RCL_CHECK_ARGUMENT_FOR_NULL(clock, RCL_RET_INVALID_ARGUMENT);
+  if (!rcl_clock_valid(clock)) {
+    RCL_SET_ERROR_MSG("clock is invalid");
+    return RCL_RET_INVALID_ARGUMENT;
+  }
+  publisher->impl->stamp_offset = stamp_offset;
+  publisher->impl->stamp_clock = clock;
+  return RCL_RET_OK;
+}
+
+rcl_ret_t
+rcl_publisher_clear_stamp_on_publish(rcl_publisher_t * publisher)
+{
+  if (!rcl_publisher_is_valid(publisher)) {
+    return RCL_RET_PUBLISHER_INVALID;  // error already set
+  }
+  publisher->impl->stamp_clock = NULL;
+  publisher->impl->stamp_offset = 0u;
+  return RCL_RET_OK;
+}
+
+/// Sample the publisher's stamp clock and write it into the message.
+static void
+_rcl_publisher_stamp_message(const rcl_publisher_impl_t * impl, const void * ros_message)
+{
+  rcl_time_point_value_t now = 0;
+  if (RCL_RET_OK != rcl_clock_get_now(impl->stamp_clock, &now)) {
+    RCUTILS_SAFE_FWRITE_TO_STDERR("Failed to sample clock for publish stamping: ");
+    RCUTILS_SAFE_FWRITE_TO_STDERR(rcl_get_error_string().str);
+    rcl_reset_error();
+    RCUTILS_SAFE_FWRITE_TO_STDERR("\n");
+    return;
+  }
+  // The message is caller-owned and the caller opted into in-place stamping,
+  // so writing through the const pointer is part of the contract.
+  uint8_t * stamp_field = (uint8_t *)(uintptr_t)ros_message + impl->stamp_offset;
+  int32_t sec = (int32_t)RCL_NS_TO_S(now);
+  uint32_t nanosec = (uint32_t)(now % RCL_S_TO_NS(1));
+  memcpy(stamp_field, &sec, sizeof(sec));
+  memcpy(stamp_field + sizeof(sec), &nanosec, sizeof(nanosec));
+}
+
+// Round-robin assignment of publishing threads to concurrent sessions.
+static atomic_uint_least64_t g_rcl_publisher_thread_counter;
+static RCUTILS_THREAD_LOCAL uint64_t t_rcl_publisher_thread_id = 0;
+
+/// Pick the rmw session this thread publishes on.
+static rmw_publisher_t *
+_rcl_publisher_session_for_thread(rcl_publisher_impl_t * impl)
+{
+  if (0u == t_rcl_publisher_thread_id) {
+    t_rcl_publisher_thread_id =
+      rcutils_atomic_fetch_add_uint64_t(&g_rcl_publisher_thread_counter, 1) + 1u;
+  }
+  size_t num_sessions = impl->num_extra_sessions + 1u;
+  size_t index = (size_t)((t_rcl_publisher_thread_id - 1u) % num_sessions);
+  if (0u == index) {
+    return impl->rmw_handle;
+  }
+  return impl->extra_sessions[index - 1u];
+}
+
+rcl_ret_t
+rcl_publisher_enable_concurrent_publishing(
+  rcl_publisher_t * publisher,
+  const rcl_node_t * node,
+  size_t num_sessions)
+{
+  if (!rcl_publisher_is_valid(publisher)) {
+    return RCL_RET_PUBLISHER_INVALID;  // error already set
+  }
+  if (!rcl_node_is_valid(node)) {
+    return RCL_RET_NODE_INVALID;  // error already set
+  }
+  if (num_sessions < 2u) {
+    RCL_SET_ERROR_MSG("num_sessions must be at least two");
+    return RCL_RET_INVALID_ARGUMENT;
+  }
+  rcl_publisher_impl_t * impl = publisher->impl;
+  if (NULL != impl->extra_sessions) {
+    RCL_SET_ERROR_MSG("concurrent publishing already enabled");
+    return RCL_RET_ALREADY_INIT;
+  }
+  rcl_allocator_t * allocator = &impl->options.allocator;
+  size_t num_extra = num_sessions - 1u;
+  impl->extra_sessions = (rmw_publisher_t **)allocator->allocate(
+    num_extra * sizeof(rmw_publisher_t *), allocator->state);
+  RCL_CHECK_FOR_NULL_WITH_MSG(
+    impl->extra_sessions, "allocating session array failed", return RCL_RET_BAD_ALLOC);
+  for (size_t i = 0; i < num_extra; ++i) {
+    impl->extra_sessions[i] = rmw_create_publisher(
+      rcl_node_get_rmw_handle(node),
+      impl->type_support,
+      impl->rmw_handle->topic_name,
+      &impl->options.qos,
+      &impl->options.rmw_publisher_options);
+    if (NULL == impl->extra_sessions[i]) {
+      RCL_SET_ERROR_MSG(rmw_get_error_string().str);
+      for (size_t j = 0; j < i; ++j) {
+        rmw_ret_t destroy_ret = rmw_destroy_publisher(
+          rcl_node_get_rmw_handle(node), impl->extra_sessions[j]);
+        if (RMW_RET_OK != destroy_ret) {
+          RCUTILS_SAFE_FWRITE_TO_STDERR(rmw_get_error_string().str);
+          RCUTILS_SAFE_FWRITE_TO_STDERR("\n");
+        }
+      }
+      allocator->deallocate(impl->extra_sessions, allocator->state);
+      impl->extra_sessions = NULL;
+      return RCL_RET_ERROR;
+    }
+  }
+  impl->num_extra_sessions = num_extra;
+  return RCL_RET_OK;
+}
+
+rcl_ret_t
+rcl_publisher_disable_concurrent_publishing(
+  rcl_publisher_t * publisher,
+  const rcl_node_t * node)
+{
+  if (!rcl_publisher_is_valid(publisher)) {
+    return RCL_RET_PUBLISHER_INVALID;  // error already set
+  }
+  if (!rcl_node_is_valid_except_context(node)) {
+    return RCL_RET_NODE_INVALID;  // error already set
+  }
+  rcl_publisher_impl_t * impl = publisher->impl;
+  if (NULL == impl->extra_sessions) {
+    return RCL_RET_OK;
+  }
+  rcl_ret_t result = RCL_RET_OK;
+  // Stop routing to the extra sessions before tearing them down.
+  size_t num_extra = impl->num_extra_sessions;
+  impl->num_extra_sessions = 0u;
+  for (size_t i = 0; i < num_extra; ++i) {
+    rmw_ret_t destroy_ret = rmw_destroy_publisher(
+      rcl_node_get_rmw_handle(node), impl->extra_sessions[i]);
+    if (RMW_RET_OK != destroy_ret) {
+      RCL_SET_ERROR_MSG(rmw_get_error_string().str);
+      result = RCL_RET_ERROR;
+    }
+  }
+  rcl_allocator_t * allocator = &impl->options.allocator;
+  allocator->deallocate(impl->extra_sessions, allocator->state);
+  impl->extra_sessions = NULL;
+  return result;
+}
+
+/// Fold one rmw publish duration into the telemetry counters.
+/**
+ * The counters are updated with independent relaxed atomics; a concurrent
+ * reader may see the count and the EWMA from slightly different instants,
+ * which is acceptable for telemetry.
+ */
+static void
+_rcl_publisher_record_rmw_duration(rcl_publisher_impl_t * impl, uint64_t duration_ns)
+{
+  rcutils_atomic_fetch_add_uint64_t(&impl->stat_publish_count, 1);
+  uint64_t previous =
+    rcutils_atomic_load_uint64_t(&impl->stat_ewma_rmw_publish_duration_ns);
+  uint64_t updated;
+  if (0u == previous) {
+    updated = duration_ns;
+  } else {
+    // alpha = 1/8; losing a concurrent update only delays convergence
+    updated = (uint64_t)((int64_t)previous +
+      ((int64_t)duration_ns - (int64_t)previous) / 8);
+  }
+  rcutils_atomic_store(&impl->stat_ewma_rmw_publish_duration_ns, updated);
 }
 
 rcl_ret_t
@@ -254,18 +675,109 @@ rcl_publish(
   RCUTILS_CAN_RETURN_WITH_ERROR_OF(RCL_RET_PUBLISHER_INVALID);
   RCUTILS_CAN_RETURN_WITH_ERROR_OF(RCL_RET_ERROR);
 
-  if (!rcl_publisher_is_valid(publisher)) {
+  if (!_rcl_publisher_check_for_publish(publisher)) {
     return RCL_RET_PUBLISHER_INVALID;  // error already set
   }
   RCL_CHECK_ARGUMENT_FOR_NULL(ros_message, RCL_RET_INVALID_ARGUMENT);
   TRACETOOLS_TRACEPOINT(rcl_publish, (const void *)publisher, (const void *)ros_message);
-  if (rmw_publish(publisher->impl->rmw_handle, ros_message, allocation) != RMW_RET_OK) {
+  // Size 0: typed messages are serialized below rcl, so the size is unknown here.
+  RCL_TRACEPOINT(RCL_TRACE_EVENT_PUBLISH, publisher, 0, 0);
+  if (NULL != publisher->impl->stamp_clock) {
+    _rcl_publisher_stamp_message(publisher->impl, ros_message);
+  }
+  rmw_publisher_t * rmw_handle = publisher->impl->rmw_handle;
+  if (publisher->impl->num_extra_sessions > 0u) {
+    rmw_handle = _rcl_publisher_session_for_thread(publisher->impl);
+  }
+  const bool record_statistics = publisher->impl->statistics_enabled;
+  rcutils_time_point_value_t start = 0;
+  if (record_statistics) {
+    (void)rcutils_steady_time_now(&start);
+  }
+  if (rmw_publish(rmw_handle, ros_message, allocation) != RMW_RET_OK) {
     RCL_SET_ERROR_MSG(rmw_get_error_string().str);
     return RCL_RET_ERROR;
   }
+  if (record_statistics) {
+    rcutils_time_point_value_t end = start;
+    (void)rcutils_steady_time_now(&end);
+    _rcl_publisher_record_rmw_duration(publisher->impl, (uint64_t)(end - start));
+  }
+  return RCL_RET_OK;
+}
+
+rcl_ret_t
+rcl_publish_batch(
+  const rcl_publisher_t * publisher,
+  const void * const * ros_messages,
+  size_t num_messages,
+  rmw_publisher_allocation_t * allocation,
+  size_t * num_published)
+{
+  RCUTILS_CAN_RETURN_WITH_ERROR_OF(RCL_RET_PUBLISHER_INVALID);
+  RCUTILS_CAN_RETURN_WITH_ERROR_OF(RCL_RET_ERROR);
+
+  if (num_published) {
+    *num_published = 0;
+  }
+  // Validate the publisher chain once for the whole batch instead of once per
+  // message.
+  if (!_rcl_publisher_check_for_publish(publisher)) {
+    return RCL_RET_PUBLISHER_INVALID;  // error already set
+  }
+  RCL_CHECK_ARGUMENT_FOR_NULL(ros_messages, RCL_RET_INVALID_ARGUMENT);
+  rmw_publisher_t * rmw_handle = publisher->impl->rmw_handle;
+  for (size_t i = 0; i < num_messages; ++i) {
+    RCL_CHECK_ARGUMENT_FOR_NULL(ros_messages[i], RCL_RET_INVALID_ARGUMENT);
+    TRACETOOLS_TRACEPOINT(rcl_publish, (const void *)publisher, ros_messages[i]);
+    if (rmw_publish(rmw_handle, ros_messages[i], allocation) != RMW_RET_OK) {
+      RCL_SET_ERROR_MSG(rmw_get_error_string().str);
+      return RCL_RET_ERROR;
+    }
+    if (num_published) {
+      ++*num_published;
+    }
+  }
   return RCL_RET_OK;
 }
 
+rcl_ret_t
+rcl_publish_cached(
+  const rcl_publisher_t * publisher,
+  const void * ros_message,
+  bool dirty,
+  rmw_publisher_allocation_t * allocation)
+{
+  RCUTILS_CAN_RETURN_WITH_ERROR_OF(RCL_RET_PUBLISHER_INVALID);
+  RCUTILS_CAN_RETURN_WITH_ERROR_OF(RCL_RET_ERROR);
+
+  if (!_rcl_publisher_check_for_publish(publisher)) {
+    return RCL_RET_PUBLISHER_INVALID;  // error already set
+  }
+  RCL_CHECK_ARGUMENT_FOR_NULL(ros_message, RCL_RET_INVALID_ARGUMENT);
+  rcl_publisher_impl_t * impl = publisher->impl;
+  if (dirty || !impl->serialized_cache_valid) {
+    if (NULL == impl->serialized_cache.allocator.allocate) {
+      // first use; bind the cache to the publisher's allocator
+      rmw_ret_t init_ret = rmw_serialized_message_init(
+        &impl->serialized_cache, 0u, &impl->options.allocator);
+      if (RMW_RET_OK != init_ret) {
+        RCL_SET_ERROR_MSG(rmw_get_error_string().str);
+        return RCL_RET_BAD_ALLOC;
+      }
+    }
+    rmw_ret_t serialize_ret = rmw_serialize(
+      ros_message, impl->type_support, &impl->serialized_cache);
+    if (RMW_RET_OK != serialize_ret) {
+      impl->serialized_cache_valid = false;
+      RCL_SET_ERROR_MSG(rmw_get_error_string().str);
+      return RCL_RET_ERROR;
+    }
+    impl->serialized_cache_valid = true;
+  }
+  return rcl_publish_serialized_message(publisher, &impl->serialized_cache, allocation);
+}
+
 rcl_ret_t
 rcl_publish_serialized_message(
   const rcl_publisher_t * publisher,
@@ -276,6 +788,14 @@ rcl_publish_serialized_message(
     return RCL_RET_PUBLISHER_INVALID;  // error already set
   }
   RCL_CHECK_ARGUMENT_FOR_NULL(serialized_message, RCL_RET_INVALID_ARGUMENT);
+  RCL_TRACEPOINT(
+    RCL_TRACE_EVENT_PUBLISH, publisher,
+    (int64_t)serialized_message->buffer_length, 0);
+  const bool record_statistics = publisher->impl->statistics_enabled;
+  rcutils_time_point_value_t start = 0;
+  if (record_statistics) {
+    (void)rcutils_steady_time_now(&start);
+  }
   rmw_ret_t ret = rmw_publish_serialized_message(
     publisher->impl->rmw_handle, serialized_message, allocation);
   if (ret != RMW_RET_OK) {
@@ -285,6 +805,17 @@ rcl_publish_serialized_message(
     }
     return RCL_RET_ERROR;
   }
+  if (record_statistics) {
+    rcutils_time_point_value_t end = start;
+    (void)rcutils_steady_time_now(&end);
+    _rcl_publisher_record_rmw_duration(publisher->impl, (uint64_t)(end - start));
+    rcutils_atomic_fetch_add_uint64_t(&publisher->impl->stat_serialized_publish_count, 1);
+    rcutils_atomic_fetch_add_uint64_t(
+      &publisher->impl->stat_serialized_bytes_total, serialized_message->buffer_length);
+    rcutils_atomic_store(
+      &publisher->impl->stat_last_serialized_size,
+      (uint64_t)serialized_message->buffer_length);
+  }
   return RCL_RET_OK;
 }
 
@@ -298,6 +829,18 @@ rcl_publish_loaned_message(
     return RCL_RET_PUBLISHER_INVALID;  // error already set
   }
   RCL_CHECK_ARGUMENT_FOR_NULL(ros_message, RCL_RET_INVALID_ARGUMENT);
+  if (_rcl_publisher_loan_pool_owns(publisher->impl, ros_message)) {
+    // The fallback pool only avoids copies up to the rmw boundary; publish by
+    // copy there and recycle the block either way.
+    rmw_ret_t pool_ret = rmw_publish(publisher->impl->rmw_handle, ros_message, allocation);
+    rcl_publisher_loan_pool_t * pool = &publisher->impl->loan_pool;
+    pool->free_blocks[pool->num_free++] = ros_message;
+    if (pool_ret != RMW_RET_OK) {
+      RCL_SET_ERROR_MSG(rmw_get_error_string().str);
+      return RCL_RET_ERROR;
+    }
+    return RCL_RET_OK;
+  }
   rmw_ret_t ret = rmw_publish_loaned_message(publisher->impl->rmw_handle, ros_message, allocation);
   if (ret != RMW_RET_OK) {
     RCL_SET_ERROR_MSG(rmw_get_error_string().str);
@@ -354,6 +897,26 @@ rcl_publisher_wait_for_all_acked(const rcl_publisher_t * publisher, rcl_duration
   return RCL_RET_OK;
 }
 
+rcl_ret_t
+rcl_publisher_check_all_acked(const rcl_publisher_t * publisher, bool * all_acked)
+{
+  if (!rcl_publisher_is_valid(publisher)) {
+    return RCL_RET_PUBLISHER_INVALID;  // error already set
+  }
+  RCL_CHECK_ARGUMENT_FOR_NULL(all_acked, RCL_RET_INVALID_ARGUMENT);
+
+  rcl_ret_t ret = rcl_publisher_wait_for_all_acked(publisher, 0);
+  if (RCL_RET_TIMEOUT == ret) {
+    *all_acked = false;
+    return RCL_RET_OK;
+  }
+  if (RCL_RET_OK != ret) {
+    return ret;  // error already set
+  }
+  *all_acked = true;
+  return RCL_RET_OK;
+}
+
 const char *
 rcl_publisher_get_topic_name(const rcl_publisher_t * publisher)
 {
@@ -392,6 +955,80 @@ rcl_publisher_get_context(const rcl_publisher_t * publisher)
   return publisher->impl->context;
 }
 
+rcl_ret_t
+rcl_publisher_enable_statistics(rcl_publisher_t * publisher)
+{
+  if (!rcl_publisher_is_valid(publisher)) {
+    return RCL_RET_PUBLISHER_INVALID;  // error already set
+  }
+  publisher->impl->statistics_enabled = true;
+  return RCL_RET_OK;
+}
+
+rcl_ret_t
+rcl_publisher_disable_statistics(rcl_publisher_t * publisher)
+{
+  if (!rcl_publisher_is_valid(publisher)) {
+    return RCL_RET_PUBLISHER_INVALID;  // error already set
+  }
+  publisher->impl->statistics_enabled = false;
+  return RCL_RET_OK;
+}
+
+rcl_ret_t
+rcl_publisher_get_statistics(
+  const rcl_publisher_t * publisher,
+  rcl_publisher_statistics_t * statistics)
+{
+  if (!rcl_publisher_is_valid(publisher)) {
+    return RCL_RET_PUBLISHER_INVALID;  // error already set
+  }
+  RCL_CHECK_ARGUMENT_FOR_NULL(statistics, RCL_RET_INVALID_ARGUMENT);
+  rcl_publisher_impl_t * impl = publisher->impl;
+  statistics->publish_count =
+    rcutils_atomic_load_uint64_t(&impl->stat_publish_count);
+  statistics->serialized_publish_count =
+    rcutils_atomic_load_uint64_t(&impl->stat_serialized_publish_count);
+  statistics->serialized_bytes_total =
+    rcutils_atomic_load_uint64_t(&impl->stat_serialized_bytes_total);
+  statistics->last_serialized_size =
+    rcutils_atomic_load_uint64_t(&impl->stat_last_serialized_size);
+  statistics->ewma_rmw_publish_duration_ns =
+    rcutils_atomic_load_uint64_t(&impl->stat_ewma_rmw_publish_duration_ns);
+  return RCL_RET_OK;
+}
+
+rcl_ret_t
+rcl_publisher_seal(rcl_publisher_t * publisher)
+{
+  // Sealing asserts the publisher is fully valid right now; the fast path
+  // only ever skips checks that passed here.
+  if (!rcl_publisher_is_valid(publisher)) {
+    return RCL_RET_PUBLISHER_INVALID;  // error already set
+  }
+  publisher->impl->sealed = true;
+  return RCL_RET_OK;
+}
+
+rcl_ret_t
+rcl_publisher_unseal(rcl_publisher_t * publisher)
+{
+  RCL_CHECK_ARGUMENT_FOR_NULL(publisher, RCL_RET_PUBLISHER_INVALID);
+  RCL_CHECK_FOR_NULL_WITH_MSG(
+    publisher->impl, "publisher implementation is invalid", return RCL_RET_PUBLISHER_INVALID);
+  publisher->impl->sealed = false;
+  return RCL_RET_OK;
+}
+
+bool
+rcl_publisher_is_sealed(const rcl_publisher_t * publisher)
+{
+  if (NULL == publisher || NULL == publisher->impl) {
+    return false;
+  }
+  return publisher->impl->sealed;
+}
+
 bool
 rcl_publisher_is_valid(const rcl_publisher_t * publisher)
 {
@@ -458,6 +1095,10 @@ rcl_publisher_can_loan_messages(const rcl_publisher_t * publisher)
     return false;
   }
 
+  if (NULL != publisher->impl->loan_pool.storage) {
+    // the fallback pool makes borrowing available regardless of the rmw
+    return true;
+  }
   return publisher->impl->rmw_handle->can_loan_messages;
 }
 
@@ -15,16 +15,73 @@
 #ifndef RCL__PUBLISHER_IMPL_H_
 #define RCL__PUBLISHER_IMPL_H_
 
+#include "rmw/network_flow_endpoint_array.h"
 #include "rmw/rmw.h"
 
+#include "rcutils/stdatomic_helper.h"
+
 #include "rcl/publisher.h"
 
+struct rcl_intra_process_channel_s;
+
+/// Fixed-size message pool backing loans when the rmw layer cannot.
+typedef struct rcl_publisher_loan_pool_s
+{
+  /// Contiguous storage for all blocks, NULL while the pool is not initialized.
+  uint8_t * storage;
+  /// Stack of currently available blocks.
+  void ** free_blocks;
+  /// Size of one block, rounded up for alignment.
+  size_t block_size;
+  size_t capacity;
+  size_t num_free;
+} rcl_publisher_loan_pool_t;
+
 struct rcl_publisher_impl_s
 {
   rcl_publisher_options_t options;
   rmw_qos_profile_t actual_qos;
   rcl_context_t * context;
   rmw_publisher_t * rmw_handle;
+  /// When true the publish fast path skips revalidating the handle chain.
+  bool sealed;
+  rcl_publisher_loan_pool_t loan_pool;
+  /// Type support the publisher was created with, kept for serialization.
+  const rosidl_message_type_support_t * type_support;
+  /// Last serialization produced by rcl_publish_cached().
+  rcl_serialized_message_t serialized_cache;
+  bool serialized_cache_valid;
+  /// When true the publish paths record the telemetry counters below.
+  bool statistics_enabled;
+  atomic_uint_least64_t stat_publish_count;
+  atomic_uint_least64_t stat_serialized_publish_count;
+  atomic_uint_least64_t stat_serialized_bytes_total;
+  atomic_uint_least64_t stat_last_serialized_size;
+  /// EWMA of the rmw publish call duration in nanoseconds.
+  atomic_uint_least64_t stat_ewma_rmw_publish_duration_ns;
+  /// Cached network flow endpoints, refreshed on demand so polling between
+  /// changes is allocation-free.
+  rmw_network_flow_endpoint_array_t network_flow_cache;
+  bool network_flow_cache_valid;
+  /// True when a matched QoS event signaled the cached flows may be outdated.
+  bool network_flow_cache_stale;
+  /// Additional rmw publishers on the same topic for concurrent publishing;
+  /// NULL unless rcl_publisher_enable_concurrent_publishing() was called.
+  rmw_publisher_t ** extra_sessions;
+  size_t num_extra_sessions;
+  /// Clock sampled on publish to stamp the outgoing message, NULL when
+  /// inline stamping is disabled.
+  rcl_clock_t * stamp_clock;
+  /// Byte offset of the message's stamp field (builtin_interfaces/Time
+  /// layout: int32 sec followed by uint32 nanosec).
+  size_t stamp_offset;
+  /// Intra-process channel for this topic, NULL unless
+  /// rcl_publisher_enable_intra_process() was called.
+  struct rcl_intra_process_channel_s * intra_process_channel;
+  /// Hop-latency histogram storage, NULL unless
+  /// rcl_publisher_enable_hop_accounting() was called; owned by the impl
+  /// and defined in hop_latency.c.
+  struct rcl_hop_record_s * hop_record;
 };
 
 #endif  // RCL__PUBLISHER_IMPL_H_
@@ -0,0 +1,204 @@
+// Copyright 2026 Open Source Robotics Foundation, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+#include "rcl/ready_queue.h"
+
+#include "rcl/error_handling.h"
+#include "rcutils/stdatomic_helper.h"
+
+/// One queue slot; the sequence field drives the lock-free claim protocol,
+/// matching the other bounded rings in rcl.
+typedef struct rcl_ready_queue_slot_s
+{
+  atomic_uint_least64_t sequence;
+  rcl_ready_queue_entry_t entry;
+} rcl_ready_queue_slot_t;
+
+struct rcl_ready_queue_impl_s
+{
+  rcl_allocator_t allocator;
+  rcl_ready_queue_slot_t * slots;
+  /// Capacity minus one; the capacity is a power of two.
+  uint64_t mask;
+  /// Producer side, monotonically increasing claim counter.
+  atomic_uint_least64_t head;
+  /// Consumer side, monotonically increasing claim counter.
+  atomic_uint_least64_t tail;
+  /// Pushes dropped because the queue was full.
+  atomic_uint_least64_t dropped;
+};
+
+rcl_ready_queue_t
+rcl_get_zero_initialized_ready_queue(void)
+{
+  static rcl_ready_queue_t null_ready_queue = {0};
+  return null_ready_queue;
+}
+
+rcl_ret_t
+rcl_ready_queue_init(
+  rcl_ready_queue_t * ready_queue,
+  size_t capacity,
+  rcl_allocator_t allocator)
+{
+  RCL_CHECK_ARGUMENT_FOR_NULL(ready_queue, RCL_RET_INVALID_ARGUMENT);
+  RCL_CHECK_ALLOCATOR_WITH_MSG(&allocator, "invalid allocator", return RCL_RET_INVALID_ARGUMENT);
+  if (0 == capacity) {
+    RCL_SET_ERROR_MSG("capacity must be non-zero");
+    return RCL_RET_INVALID_ARGUMENT;
+  }
+  if (NULL != ready_queue->impl) {
+    RCL_SET_ERROR_MSG("ready queue already initialized, or memory was uninitialized");
+    return RCL_RET_ALREADY_INIT;
+  }
+  rcl_ready_queue_impl_t * impl = allocator.allocate(
+    sizeof(rcl_ready_queue_impl_t), allocator.state);
+  if (NULL == impl) {
+    RCL_SET_ERROR_MSG("allocating memory failed");
+    return RCL_RET_BAD_ALLOC;
+  }
+  // round the capacity up to a power of two for mask addressing
+  uint64_t rounded = 1;
+  while (rounded < (uint64_t)capacity) {
+    rounded <<= 1;
+  }
+  impl->slots = allocator.zero_allocate(
+    (size_t)rounded, sizeof(rcl_ready_queue_slot_t), allocator.state);
+  if (NULL == impl->slots) {
+    allocator.deallocate(impl, allocator.state);
+    RCL_SET_ERROR_MSG("allocating memory failed");
+    return RCL_RET_BAD_ALLOC;
+  }
+  for (uint64_t i = 0; i < rounded; ++i) {
+    atomic_init(&impl->slots[i].sequence, i);
+  }
+  impl->allocator = allocator;
+  impl->mask = rounded - 1;
+  atomic_init(&impl->head, 0);
+  atomic_init(&impl->tail, 0);
+  atomic_init(&impl->dropped, 0);
+  ready_queue->impl = impl;
+  return RCL_RET_OK;
+}
+
+rcl_ret_t
+rcl_ready_queue_fini(rcl_ready_queue_t * ready_queue)
+{
+  RCL_CHECK_ARGUMENT_FOR_NULL(ready_queue, RCL_RET_INVALID_ARGUMENT);
+  if (NULL == ready_queue->impl) {
+    return RCL_RET_OK;
+  }
+  rcl_allocator_t allocator = ready_queue->impl->allocator;
+  allocator.deallocate(ready_queue->impl->slots, allocator.state);
+  allocator.deallocate(ready_queue->impl, allocator.state);
+  ready_queue->impl = NULL;
+  return RCL_RET_OK;
+}
+
+rcl_ret_t
+rcl_ready_queue_push(
+  rcl_ready_queue_t * ready_queue,
+  const rcl_ready_queue_entry_t * entry)
+{
+  RCL_CHECK_ARGUMENT_FOR_NULL(ready_queue, RCL_RET_INVALID_ARGUMENT);
+  RCL_CHECK_ARGUMENT_FOR_NULL(entry, RCL_RET_INVALID_ARGUMENT);
+  RCL_CHECK_FOR_NULL_WITH_MSG(
+    ready_queue->impl, "ready queue is not initialized", return RCL_RET_NOT_INIT);
+  rcl_ready_queue_impl_t * impl = ready_queue->impl;
+  rcl_ready_queue_slot_t * slot = NULL;
+  uint64_t pos = rcutils_atomic_load_uint64_t(&impl->head);
+  for (;;) {
+    slot = &impl->slots[pos & impl->mask];
+    uint64_t seq = rcutils_atomic_load_uint64_t(&slot->sequence);
+    int64_t dif = (int64_t)seq - (int64_t)pos;
+    if (0 == dif) {
+      bool exchanged = false;
+      uint64_t expected = pos;
+      rcutils_atomic_compare_exchange_strong(&impl->head, exchanged, &expected, pos + 1);
+      if (exchanged) {
+        break;
+      }
+      pos = expected;
+    } else if (dif < 0) {
+      // full; the entity stays visible in the wait set arrays, so the
+      // consumer can recover by rescanning
+      rcutils_atomic_fetch_add_uint64_t(&impl->dropped, 1);
+      RCL_RETURN_EXPECTED(RCL_RET_WAIT_SET_FULL);
+    } else {
+      pos = rcutils_atomic_load_uint64_t(&impl->head);
+    }
+  }
+  slot->entry = *entry;
+  // Mark the slot ready for the consumers.
+  rcutils_atomic_store(&slot->sequence, pos + 1);
+  return RCL_RET_OK;
+}
+
+rcl_ret_t
+rcl_ready_queue_pop(
+  rcl_ready_queue_t * ready_queue,
+  rcl_ready_queue_entry_t * entry)
+{
+  RCL_CHECK_ARGUMENT_FOR_NULL(ready_queue, RCL_RET_INVALID_ARGUMENT);
+  RCL_CHECK_ARGUMENT_FOR_NULL(entry, RCL_RET_INVALID_ARGUMENT);
+  RCL_CHECK_FOR_NULL_WITH_MSG(
+    ready_queue->impl, "ready queue is not initialized", return RCL_RET_NOT_INIT);
+  rcl_ready_queue_impl_t * impl = ready_queue->impl;
+  rcl_ready_queue_slot_t * slot = NULL;
+  uint64_t pos = rcutils_atomic_load_uint64_t(&impl->tail);
+  for (;;) {
+    slot = &impl->slots[pos & impl->mask];
+    uint64_t seq = rcutils_atomic_load_uint64_t(&slot->sequence);
+    int64_t dif = (int64_t)seq - (int64_t)(pos + 1);
+    if (0 == dif) {
+      bool exchanged = false;
+      uint64_t expected = pos;
+      rcutils_atomic_compare_exchange_strong(&impl->tail, exchanged, &expected, pos + 1);
+      if (exchanged) {
+        break;
+      }
+      pos = expected;
+    } else if (dif < 0) {
+      RCL_RETURN_EXPECTED(RCL_RET_WAIT_SET_EMPTY);
+    } else {
+      pos = rcutils_atomic_load_uint64_t(&impl->tail);
+    }
+  }
+  *entry = slot->entry;
+  // Recycle the slot for the producers one lap ahead.
+  rcutils_atomic_store(&slot->sequence, pos + impl->mask + 1);
+  return RCL_RET_OK;
+}
+
+rcl_ret_t
+rcl_ready_queue_get_dropped_count(
+  const rcl_ready_queue_t * ready_queue,
+  uint64_t * dropped_count)
+{
+  RCL_CHECK_ARGUMENT_FOR_NULL(ready_queue, RCL_RET_INVALID_ARGUMENT);
+  RCL_CHECK_ARGUMENT_FOR_NULL(dropped_count, RCL_RET_INVALID_ARGUMENT);
+  RCL_CHECK_FOR_NULL_WITH_MSG(
+    ready_queue->impl, "ready queue is not initialized", return RCL_RET_NOT_INIT);
+  *dropped_count = rcutils_atomic_load_uint64_t(&ready_queue->impl->dropped);
+  return RCL_RET_OK;
+}
+
+#ifdef __cplusplus
+}
+#endif
@@ -14,6 +14,8 @@
 
 #include "rcl/remap.h"
 
+#include <string.h>
+
 #include "./arguments_impl.h"
 #include "./remap_impl.h"
 #include "rcl/error_handling.h"
@@ -97,6 +99,232 @@ fail:
   return RCL_RET_BAD_ALLOC;
 }
 
+/// Hash a fully qualified name with FNV-1a.
+static
+uint64_t
+__remap_index_hash(const char * name)
+{
+  uint64_t hash = 0xcbf29ce484222325ULL;
+  for (const char * c = name; '\0' != *c; ++c) {
+    hash ^= (uint64_t)(unsigned char)(*c);
+    hash *= 0x100000001b3ULL;
+  }
+  return hash;
+}
+
+/// Return true if a rule's match side can be compared without expansion.
+/**
+ * That is the case when the match is already a fully qualified name:
+ * absolute, no substitutions, no private namespace, and the rule is not
+ * limited to a particular node.
+ */
+static
+bool
+__remap_rule_is_exact(const rcl_remap_t * rule)
+{
+  if (!(rule->impl->type & (RCL_TOPIC_REMAP | RCL_SERVICE_REMAP))) {
+    return false;
+  }
+  if (NULL != rule->impl->node_name || NULL == rule->impl->match) {
+    return false;
+  }
+  if ('/' != rule->impl->match[0]) {
+    return false;
+  }
+  return NULL == strchr(rule->impl->match, '{') && NULL == strchr(rule->impl->match, '~');
+}
+
+rcl_remap_index_t
+rcl_get_zero_initialized_remap_index(void)
+{
+  static rcl_remap_index_t default_index = {
+    .compiled = false,
+    .table = NULL,
+    .capacity = 0,
+    .fallback_rules = NULL,
+    .num_fallback_rules = 0,
+  };
+  return default_index;
+}
+
+rcl_ret_t
+rcl_remap_index_init(
+  rcl_remap_index_t * index,
+  const rcl_remap_t * remap_rules,
+  int num_rules,
+  rcl_allocator_t allocator)
+{
+  RCL_CHECK_ARGUMENT_FOR_NULL(index, RCL_RET_INVALID_ARGUMENT);
+  RCL_CHECK_ALLOCATOR_WITH_MSG(&allocator, "allocator is invalid", return RCL_RET_INVALID_ARGUMENT);
+  if (NULL != index->table || NULL != index->fallback_rules) {
+    RCL_SET_ERROR_MSG("remap index is already initialized");
+    return RCL_RET_INVALID_ARGUMENT;
+  }
+  if (num_rules > 0) {
+    RCL_CHECK_ARGUMENT_FOR_NULL(remap_rules, RCL_RET_INVALID_ARGUMENT);
+  }
+
+  index->allocator = allocator;
+
+  size_t num_exact = 0;
+  size_t num_fallback = 0;
+  for (int i = 0; i < num_rules; ++i) {
+    if (__remap_rule_is_exact(&remap_rules[i])) {
+      ++num_exact;
+    } else {
+      ++num_fallback;
+    }
+  }
+
+  if (num_exact > 0) {
+    // Power of two capacity with at most half the slots occupied.
+    size_t capacity = 8;
+    while (capacity < 2 * num_exact) {
+      capacity *= 2;
+    }
+    index->table = allocator.allocate(
+      sizeof(rcl_remap_index_entry_t) * capacity, allocator.state);
+    if (NULL == index->table) {
+      return RCL_RET_BAD_ALLOC;
+    }
+    index->capacity = capacity;
+    for (size_t s = 0; s < capacity; ++s) {
+      index->table[s].hash = 0;
+      index->table[s].rule = -1;
+    }
+  }
+  if (num_fallback > 0) {
+    index->fallback_rules = allocator.allocate(sizeof(int) * num_fallback, allocator.state);
+    if (NULL == index->fallback_rules) {
+      allocator.deallocate(index->table, allocator.state);
+      index->table = NULL;
+      index->capacity = 0;
+      return RCL_RET_BAD_ALLOC;
+    }
+  }
+
+  for (int i = 0; i < num_rules; ++i) {
+    if (__remap_rule_is_exact(&remap_rules[i])) {
+      uint64_t hash = __remap_index_hash(remap_rules[i].impl->match);
+      size_t slot = (size_t)hash & (index->capacity - 1);
+      while (-1 != index->table[slot].rule) {
+        slot = (slot + 1) & (index->capacity - 1);
+      }
+      index->table[slot].hash = hash;
+      index->table[slot].rule = i;
+    } else {
+      index->fallback_rules[index->num_fallback_rules++] = i;
+    }
+  }
+  index->compiled = true;
+  return RCL_RET_OK;
+}
+
+rcl_ret_t
+rcl_remap_index_fini(rcl_remap_index_t * index)
+{
+  RCL_CHECK_ARGUMENT_FOR_NULL(index, RCL_RET_INVALID_ARGUMENT);
+  if (NULL != index->table) {
+    index->allocator.deallocate(index->table, index->allocator.state);
+    index->table = NULL;
+  }
+  index->capacity = 0;
+  if (NULL != index->fallback_rules) {
+    index->allocator.deallocate(index->fallback_rules, index->allocator.state);
+    index->fallback_rules = NULL;
+  }
+  index->num_fallback_rules = 0;
+  index->compiled = false;
+  return RCL_RET_OK;
+}
+
+/// Find the first exact-match rule for a name, or -1 if there is none.
+static
+int
+__remap_index_lookup(
+  const rcl_remap_index_t * index,
+  const rcl_remap_t * remap_rules,
+  rcl_remap_type_t type_bitmask,
+  const char * name)
+{
+  if (0 == index->capacity) {
+    return -1;
+  }
+  uint64_t hash = __remap_index_hash(name);
+  size_t slot = (size_t)hash & (index->capacity - 1);
+  int first_rule = -1;
+  // Rules with equal match names share a probe cluster; scan to the first
+  // empty slot and keep the earliest rule so first-match precedence holds.
+  while (-1 != index->table[slot].rule) {
+    int rule_index = index->table[slot].rule;
+    const rcl_remap_t * rule = &(remap_rules[rule_index]);
+    if (
+      index->table[slot].hash == hash &&
+      (rule->impl->type & type_bitmask) &&
+      0 == strcmp(rule->impl->match, name))
+    {
+      if (-1 == first_rule || rule_index < first_rule) {
+        first_rule = rule_index;
+      }
+    }
+    slot = (slot + 1) & (index->capacity - 1);
+  }
+  return first_rule;
+}
+
+/// Check whether a single rule matches, expanding its match side if needed.
+/**
+ * \return RCL_RET_OK unless an error occurred that will affect every rule,
+ *   in which case rule processing should stop.
+ */
+static
+rcl_ret_t
+rcl_remap_rule_matches(
+  const rcl_remap_t * rule,
+  const char * name,
+  const char * node_name,
+  const char * node_namespace,
+  const rcutils_string_map_t * substitutions,
+  rcutils_allocator_t allocator,
+  bool * matched)
+{
+  *matched = false;
+  if (rule->impl->node_name != NULL && 0 != strcmp(rule->impl->node_name, node_name)) {
+    // Rule has a node name prefix and the supplied node name didn't match
+    return RCL_RET_OK;
+  }
+  if (rule->impl->type & (RCL_TOPIC_REMAP | RCL_SERVICE_REMAP)) {
+    // topic and service rules need the match side to be expanded to a FQN
+    char * expanded_match = NULL;
+    rcl_ret_t ret = rcl_expand_topic_name(
+      rule->impl->match, node_name, node_namespace,
+      substitutions, allocator, &expanded_match);
+    if (RCL_RET_OK != ret) {
+      rcl_reset_error();
+      if (
+        RCL_RET_NODE_INVALID_NAMESPACE == ret ||
+        RCL_RET_NODE_INVALID_NAME == ret ||
+        RCL_RET_BAD_ALLOC == ret)
+      {
+        // these are probably going to happen again. Stop processing rules
+        return ret;
+      }
+      return RCL_RET_OK;
+    }
+    if (NULL != name) {
+      // this check is to satisfy clang-tidy – name is always not null when type_bitmask is
+      // RCL_TOPIC_REMAP or RCL_SERVICE_REMAP. That is guaranteed because rcl_remap_first_match
+      // and rcl_remap_name are not public.
+      *matched = (0 == strcmp(expanded_match, name));
+    }
+    allocator.deallocate(expanded_match, allocator.state);
+  } else {
+    // nodename and namespace replacement apply if the type and node name prefix checks passed
+    *matched = true;
+  }
+  return RCL_RET_OK;
+}
+
 /// Get the first matching rule in a chain.
 /// \return RCL_RET_OK if no errors occurred while searching for a rule
 static
@@ -104,6 +332,7 @@ rcl_ret_t
 rcl_remap_first_match(
   rcl_remap_t * remap_rules,
   int num_rules,
+  const rcl_remap_index_t * index,
   rcl_remap_type_t type_bitmask,
   const char * name,
   const char * node_name,
@@ -113,45 +342,51 @@ rcl_remap_first_match(
   rcl_remap_t ** output_rule)
 {
   *output_rule = NULL;
+  if (NULL != index && index->compiled) {
+    // Exact topic and service rules are found with one hash probe; only the
+    // (usually empty) fallback list still needs per-rule expansion, and only
+    // the part of it that would win over the probed rule under first-match.
+    int exact_rule = -1;
+    if (NULL != name) {
+      exact_rule = __remap_index_lookup(index, remap_rules, type_bitmask, name);
+    }
+    for (size_t f = 0; f < index->num_fallback_rules; ++f) {
+      int rule_index = index->fallback_rules[f];
+      if (-1 != exact_rule && rule_index > exact_rule) {
+        break;
+      }
+      rcl_remap_t * rule = &(remap_rules[rule_index]);
+      if (!(rule->impl->type & type_bitmask)) {
+        // Not the type of remap rule we're looking fore
+        continue;
+      }
+      bool matched = false;
+      rcl_ret_t ret = rcl_remap_rule_matches(
+        rule, name, node_name, node_namespace, substitutions, allocator, &matched);
+      if (RCL_RET_OK != ret) {
+        return ret;
+      }
+      if (matched) {
+        *output_rule = rule;
+        return RCL_RET_OK;
+      }
+    }
+    if (-1 != exact_rule) {
+      *output_rule = &(remap_rules[exact_rule]);
+    }
+    return RCL_RET_OK;
+  }
   for (int i = 0; i < num_rules; ++i) {
     rcl_remap_t * rule = &(remap_rules[i]);
     if (!(rule->impl->type & type_bitmask)) {
       // Not the type of remap rule we're looking fore
       continue;
     }
-    if (rule->impl->node_name != NULL && 0 != strcmp(rule->impl->node_name, node_name)) {
-      // Rule has a node name prefix and the supplied node name didn't match
-      continue;
-    }
     bool matched = false;
-    if (rule->impl->type & (RCL_TOPIC_REMAP | RCL_SERVICE_REMAP)) {
-      // topic and service rules need the match side to be expanded to a FQN
-      char * expanded_match = NULL;
-      rcl_ret_t ret = rcl_expand_topic_name(
-        rule->impl->match, node_name, node_namespace,
-        substitutions, allocator, &expanded_match);
-      if (RCL_RET_OK != ret) {
-        rcl_reset_error();
-        if (
-          RCL_RET_NODE_INVALID_NAMESPACE == ret ||
-          RCL_RET_NODE_INVALID_NAME == ret ||
-          RCL_RET_BAD_ALLOC == ret)
-        {
-          // these are probably going to happen again. Stop processing rules
-          return ret;
-        }
-        continue;
-      }
-      if (NULL != name) {
-        // this check is to satisfy clang-tidy – name is always not null when type_bitmask is
-        // RCL_TOPIC_REMAP or RCL_SERVICE_REMAP. That is guaranteed because rcl_remap_first_match
-        // and rcl_remap_name are not public.
-        matched = (0 == strcmp(expanded_match, name));
-      }
-      allocator.deallocate(expanded_match, allocator.state);
-    } else {
-      // nodename and namespace replacement apply if the type and node name prefix checks passed
-      matched = true;
+    rcl_ret_t ret = rcl_remap_rule_matches(
+      rule, name, node_name, node_namespace, substitutions, allocator, &matched);
+    if (RCL_RET_OK != ret) {
+      return ret;
     }
     if (matched) {
       *output_rule = rule;
@@ -194,7 +429,8 @@ rcl_remap_name(
   // Look at local rules first
   if (NULL != local_arguments) {
     rcl_ret_t ret = rcl_remap_first_match(
-      local_arguments->impl->remap_rules, local_arguments->impl->num_remap_rules, type_bitmask,
+      local_arguments->impl->remap_rules, local_arguments->impl->num_remap_rules,
+      &local_arguments->impl->remap_index, type_bitmask,
       name, node_name, node_namespace, substitutions, allocator, &rule);
     if (ret != RCL_RET_OK) {
       return ret;
@@ -203,7 +439,8 @@ rcl_remap_name(
   // Check global rules if no local rule matched
   if (NULL == rule && NULL != global_arguments) {
     rcl_ret_t ret = rcl_remap_first_match(
-      global_arguments->impl->remap_rules, global_arguments->impl->num_remap_rules, type_bitmask,
+      global_arguments->impl->remap_rules, global_arguments->impl->num_remap_rules,
+      &global_arguments->impl->remap_index, type_bitmask,
       name, node_name, node_namespace, substitutions, allocator, &rule);
     if (ret != RCL_RET_OK) {
       return ret;
@@ -290,6 +527,65 @@ rcl_remap_service_name(
   return ret;
 }
 
+rcl_ret_t
+rcl_remap_names_batch(
+  const rcl_arguments_t * local_arguments,
+  const rcl_arguments_t * global_arguments,
+  size_t count,
+  const char * const * names,
+  const bool * is_service,
+  const char * node_name,
+  const char * node_namespace,
+  rcl_allocator_t allocator,
+  char ** output_names)
+{
+  RCL_CHECK_ALLOCATOR_WITH_MSG(&allocator, "allocator is invalid", return RCL_RET_INVALID_ARGUMENT);
+  if (count > 0) {
+    RCL_CHECK_ARGUMENT_FOR_NULL(names, RCL_RET_INVALID_ARGUMENT);
+    RCL_CHECK_ARGUMENT_FOR_NULL(output_names, RCL_RET_INVALID_ARGUMENT);
+  }
+  for (size_t i = 0; i < count; ++i) {
+    RCL_CHECK_ARGUMENT_FOR_NULL(names[i], RCL_RET_INVALID_ARGUMENT);
+    output_names[i] = NULL;
+  }
+  if (0 == count) {
+    return RCL_RET_OK;
+  }
+
+  // The substitution map is built once and shared by every name in the batch.
+  rcutils_string_map_t substitutions = rcutils_get_zero_initialized_string_map();
+  rcutils_ret_t rcutils_ret = rcutils_string_map_init(&substitutions, 0, allocator);
+  rcl_ret_t ret = RCL_RET_ERROR;
+  if (RCUTILS_RET_OK == rcutils_ret) {
+    ret = rcl_get_default_topic_name_substitutions(&substitutions);
+    if (RCL_RET_OK == ret) {
+      for (size_t i = 0; i < count; ++i) {
+        rcl_remap_type_t type_bitmask =
+          (NULL != is_service && is_service[i]) ? RCL_SERVICE_REMAP : RCL_TOPIC_REMAP;
+        ret = rcl_remap_name(
+          local_arguments, global_arguments, type_bitmask, names[i], node_name,
+          node_namespace, &substitutions, allocator, &output_names[i]);
+        if (RCL_RET_OK != ret) {
+          break;
+        }
+      }
+    }
+  }
+  if (RCL_RET_OK != ret) {
+    // Leave no partially filled output behind.
+    for (size_t i = 0; i < count; ++i) {
+      if (NULL != output_names[i]) {
+        allocator.deallocate(output_names[i], allocator.state);
+        output_names[i] = NULL;
+      }
+    }
+  }
+  if (RCUTILS_RET_OK != rcutils_string_map_fini(&substitutions)) {
+    return RCL_RET_ERROR;
+  }
+  return ret;
+}
+
 rcl_ret_t
 rcl_remap_node_name(
   const rcl_arguments_t * local_arguments,
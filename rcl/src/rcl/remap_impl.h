@@ -15,6 +15,9 @@
 #ifndef RCL__REMAP_IMPL_H_
 #define RCL__REMAP_IMPL_H_
 
+#include <stdbool.h>
+#include <stdint.h>
+
 #include "rcl/allocator.h"
 #include "rcl/macros.h"
 #include "rcl/remap.h"
@@ -51,6 +54,63 @@ struct rcl_remap_impl_s
   rcl_allocator_t allocator;
 };
 
+/// One slot of the exact-match hash table in a rcl_remap_index_t.
+typedef struct rcl_remap_index_entry_s
+{
+  /// Hash of the rule's fully qualified match name.
+  uint64_t hash;
+  /// Index of the rule in the rule array, or -1 if the slot is empty.
+  int rule;
+} rcl_remap_index_entry_t;
+
+/// Lookup index compiled once from an array of remap rules.
+/**
+ * Topic and service rules whose match side is already a fully qualified name
+ * (no substitutions, no private or relative names, no node name prefix) go
+ * into a hash table so the common exact-name remap is a single probe instead
+ * of a lexer based expansion per rule.
+ * All remaining rules keep their original order in a fallback list so
+ * first-match precedence between the two groups is preserved.
+ */
+typedef struct rcl_remap_index_s
+{
+  /// True if the index was compiled from a rule array.
+  bool compiled;
+  /// Open addressed hash table over exact-match rules, or NULL if none.
+  rcl_remap_index_entry_t * table;
+  /// Capacity of table, a power of two, or 0 if no exact-match rules.
+  size_t capacity;
+  /// Indices of rules needing per-lookup expansion, in original order.
+  int * fallback_rules;
+  /// Length of fallback_rules.
+  size_t num_fallback_rules;
+  /// Allocator used to allocate the index storage.
+  rcl_allocator_t allocator;
+} rcl_remap_index_t;
+
+/// Return an index with members initialized to `NULL`.
+RCL_LOCAL
+rcl_remap_index_t
+rcl_get_zero_initialized_remap_index(void);
+
+/// Compile an index over a rule array owned by the caller.
+/**
+ * The index stores rule indices, not pointers, so the rule array may be
+ * reallocated as long as the index is rebuilt afterwards.
+ */
+RCL_LOCAL
+rcl_ret_t
+rcl_remap_index_init(
+  rcl_remap_index_t * index,
+  const rcl_remap_t * remap_rules,
+  int num_rules,
+  rcl_allocator_t allocator);
+
+/// Finalize an index, leaving it zero initialized.
+RCL_LOCAL
+rcl_ret_t
+rcl_remap_index_fini(rcl_remap_index_t * index);
+
 RCL_LOCAL
 rcl_ret_t
 rcl_remap_name(
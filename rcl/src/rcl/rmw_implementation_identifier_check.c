@@ -25,6 +25,7 @@ extern "C"
 #include "rcl/error_handling.h"
 #include "rcutils/env.h"
 #include "rcutils/logging_macros.h"
+#include "rcutils/stdatomic_helper.h"
 #include "rcutils/strdup.h"
 #include "rmw/rmw.h"
 
@@ -54,7 +55,16 @@ extern "C"
   static void f(void)
 #endif
 
-rcl_ret_t rcl_rmw_implementation_identifier_check(void)
+#ifndef RCL_DISABLE_RMW_ID_CHECK
+// Result of the most recent full check, latched for
+// rcl_rmw_implementation_identifier_check_latched(); RCL_RET_NOT_INIT until
+// the first check, which normally runs from the library constructor below.
+static atomic_int_least64_t __latched_check_result = ATOMIC_VAR_INIT(RCL_RET_NOT_INIT);
+
+// The full check, see rcl_rmw_implementation_identifier_check() for the
+// semantics; split out so the public entry point can latch its result.
+static rcl_ret_t
+__rmw_implementation_identifier_check(void)
 {
   // If the environment variable RMW_IMPLEMENTATION is set, or
   // the environment variable RCL_ASSERT_RMW_ID_MATCHES is set,
@@ -164,7 +174,38 @@ cleanup:
   allocator.deallocate(asserted_rmw_impl, allocator.state);
   return ret;
 }
+#endif  // RCL_DISABLE_RMW_ID_CHECK
+
+rcl_ret_t rcl_rmw_implementation_identifier_check(void)
+{
+#ifdef RCL_DISABLE_RMW_ID_CHECK
+  // The middleware is fixed at build time; there is nothing to check.
+  return RCL_RET_OK;
+#else
+  rcl_ret_t ret = __rmw_implementation_identifier_check();
+  rcutils_atomic_store(&__latched_check_result, (int64_t)ret);
+  return ret;
+#endif
+}
+
+rcl_ret_t rcl_rmw_implementation_identifier_check_latched(void)
+{
+#ifdef RCL_DISABLE_RMW_ID_CHECK
+  // The middleware is fixed at build time; there is nothing to check.
+  return RCL_RET_OK;
+#else
+  int64_t latched_result;
+  rcutils_atomic_load(&__latched_check_result, latched_result);
+  if (RCL_RET_NOT_INIT != (rcl_ret_t)latched_result) {
+    return (rcl_ret_t)latched_result;
+  }
+  // No check has completed yet, e.g. when the library constructor was not
+  // run; fall back to the full check, which latches its result.
+  return rcl_rmw_implementation_identifier_check();
+#endif
+}
 
+#ifndef RCL_DISABLE_RMW_ID_CHECK
 INITIALIZER(initialize) {
   rcl_ret_t ret = rcl_rmw_implementation_identifier_check();
   if (ret != RCL_RET_OK) {
@@ -172,6 +213,7 @@ INITIALIZER(initialize) {
     exit(ret);
   }
 }
+#endif
 
 #ifdef __cplusplus
 }
@@ -15,6 +15,7 @@
 #include "rcl/security.h"
 
 #include <stdbool.h>
+#include <string.h>
 
 #include "rcl/error_handling.h"
 
@@ -25,6 +26,116 @@
 
 #include "rmw/security_options.h"
 
+/// Maximum number of resolved secure roots remembered process-wide.
+#define RCL_SECURE_ROOT_CACHE_SIZE 8
+
+/// One resolved enclave name to secure root mapping.
+typedef struct rcl_secure_root_cache_entry_s
+{
+  /// Enclave name the lookup was performed for; NULL for empty slots.
+  char * name;
+  /// Value of ROS_SECURITY_KEYSTORE at resolution time.
+  char * keystore;
+  /// Value of ROS_SECURITY_ENCLAVE_OVERRIDE at resolution time, NULL if unset.
+  char * enclave_override;
+  /// The resolved directory, validated to exist at resolution time.
+  char * secure_root;
+} rcl_secure_root_cache_entry_t;
+
+/// Process-wide cache of resolved secure roots, so that processes creating
+/// many contexts pay the path construction and directory probing once per
+/// enclave instead of once per context.
+/**
+ * Entries are keyed by the enclave name and the environment variables that
+ * influence the lookup, and are re-validated with a single directory check
+ * on every hit, so a removed keystore directory does not serve stale hits.
+ * Slots are reused round-robin once the cache is full.
+ * Like context init itself, this is not thread-safe.
+ */
+static rcl_secure_root_cache_entry_t g_secure_root_cache[RCL_SECURE_ROOT_CACHE_SIZE];
+static size_t g_secure_root_cache_next_slot = 0;
+
+// NULL-safe string equality; two NULLs are considered equal.
+static bool
+__secure_root_cache_strings_equal(const char * left, const char * right)
+{
+  if ((NULL == left) || (NULL == right)) {
+    return left == right;
+  }
+  return 0 == strcmp(left, right);
+}
+
+// Release every string of an entry and mark the slot empty.
+static void
+__secure_root_cache_entry_clear(rcl_secure_root_cache_entry_t * entry)
+{
+  rcl_allocator_t allocator = rcl_get_default_allocator();
+  allocator.deallocate(entry->name, allocator.state);
+  allocator.deallocate(entry->keystore, allocator.state);
+  allocator.deallocate(entry->enclave_override, allocator.state);
+  allocator.deallocate(entry->secure_root, allocator.state);
+  *entry = (rcl_secure_root_cache_entry_t) {0};
+}
+
+// Return a copy of the cached secure root for the given key, or NULL when
+// there is no valid cached entry. A hit whose directory no longer exists is
+// evicted and reported as a miss, so it gets re-resolved.
+static char *
+__secure_root_cache_lookup(
+  const char * name,
+  const char * keystore,
+  const char * enclave_override,
+  const rcl_allocator_t * allocator)
+{
+  for (size_t i = 0; i < RCL_SECURE_ROOT_CACHE_SIZE; ++i) {
+    rcl_secure_root_cache_entry_t * entry = &g_secure_root_cache[i];
+    if (NULL == entry->name) {
+      continue;
+    }
+    if (!__secure_root_cache_strings_equal(name, entry->name) ||
+      !__secure_root_cache_strings_equal(keystore, entry->keystore) ||
+      !__secure_root_cache_strings_equal(enclave_override, entry->enclave_override))
+    {
+      continue;
+    }
+    if (!rcutils_is_directory(entry->secure_root)) {
+      // the keystore changed underneath the cache; re-resolve
+      __secure_root_cache_entry_clear(entry);
+      return NULL;
+    }
+    return rcutils_strdup(entry->secure_root, *allocator);
+  }
+  return NULL;
+}
+
+// Remember a successfully resolved secure root; failures to cache are
+// silently ignored, the next lookup just resolves again.
+static void
+__secure_root_cache_store(
+  const char * name,
+  const char * keystore,
+  const char * enclave_override,
+  const char * secure_root)
+{
+  rcl_allocator_t allocator = rcl_get_default_allocator();
+  rcl_secure_root_cache_entry_t * entry =
+    &g_secure_root_cache[g_secure_root_cache_next_slot];
+  g_secure_root_cache_next_slot =
+    (g_secure_root_cache_next_slot + 1) % RCL_SECURE_ROOT_CACHE_SIZE;
+  __secure_root_cache_entry_clear(entry);
+  entry->name = rcutils_strdup(name, allocator);
+  entry->keystore = rcutils_strdup(keystore, allocator);
+  if (NULL != enclave_override) {
+    entry->enclave_override = rcutils_strdup(enclave_override, allocator);
+  }
+  entry->secure_root = rcutils_strdup(secure_root, allocator);
+  if (NULL == entry->name || NULL == entry->keystore || NULL == entry->secure_root ||
+    (NULL != enclave_override && NULL == entry->enclave_override))
+  {
+    __secure_root_cache_entry_clear(entry);
+  }
+}
+
 rcl_ret_t
 rcl_get_security_options_from_environment(
   const char * name,
@@ -178,6 +289,13 @@ char * rcl_get_secure_root(
     goto leave_rcl_get_secure_root;
   }
 
+  // check whether this lookup has already been resolved in this process
+  secure_root = __secure_root_cache_lookup(
+    name, ros_secure_keystore_env, ros_secure_enclave_override_env, allocator);
+  if (NULL != secure_root) {
+    goto leave_rcl_get_secure_root;
+  }
+
   // given usable environment variables, overwrite with next lookup
   if (NULL != ros_secure_enclave_override_env) {
     secure_root = exact_match_lookup(
@@ -203,8 +321,13 @@ char * rcl_get_secure_root(
       "SECURITY ERROR: directory '%s' does not exist.", secure_root);
     allocator->deallocate(secure_root, allocator->state);
     secure_root = NULL;
+    goto leave_rcl_get_secure_root;
   }
 
+  // remember the successful resolution; failed lookups are never cached
+  __secure_root_cache_store(
+    name, ros_secure_keystore_env, ros_secure_enclave_override_env, secure_root);
+
 leave_rcl_get_secure_root:
   allocator->deallocate(ros_secure_enclave_override_env, allocator->state);
   allocator->deallocate(ros_secure_keystore_env, allocator->state);
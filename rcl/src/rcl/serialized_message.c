@@ -0,0 +1,135 @@
+// Copyright 2026 Open Source Robotics Foundation, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+#include "rcl/serialized_message.h"
+
+#include <string.h>
+
+#include "rcl/error_handling.h"
+#include "rmw/serialized_message.h"
+
+// The inline-buffer optimization works by giving the serialized message a
+// custom allocator whose state is the rcl_inline_serialized_message_state_t.
+// Consumers like rmw_serialize() grow the buffer exclusively through that
+// allocator, so reallocation of the inline pointer is the single interception
+// point needed for the heap spill.
+
+static void *
+_rcl_inline_serialized_message_allocate(size_t size, void * untyped_state)
+{
+  rcl_inline_serialized_message_state_t * state = untyped_state;
+  return state->heap_allocator.allocate(size, state->heap_allocator.state);
+}
+
+static void
+_rcl_inline_serialized_message_deallocate(void * pointer, void * untyped_state)
+{
+  rcl_inline_serialized_message_state_t * state = untyped_state;
+  if (pointer == state->inline_buffer) {
+    // caller-owned storage, never freed
+    return;
+  }
+  state->heap_allocator.deallocate(pointer, state->heap_allocator.state);
+}
+
+static void *
+_rcl_inline_serialized_message_reallocate(
+  void * pointer, size_t size, void * untyped_state)
+{
+  rcl_inline_serialized_message_state_t * state = untyped_state;
+  if (pointer == state->inline_buffer) {
+    if (size <= state->inline_capacity) {
+      return pointer;
+    }
+    void * heap_pointer =
+      state->heap_allocator.allocate(size, state->heap_allocator.state);
+    if (NULL == heap_pointer) {
+      return NULL;
+    }
+    memcpy(heap_pointer, state->inline_buffer, state->inline_capacity);
+    return heap_pointer;
+  }
+  return state->heap_allocator.reallocate(
+    pointer, size, state->heap_allocator.state);
+}
+
+static void *
+_rcl_inline_serialized_message_zero_allocate(
+  size_t number_of_elements, size_t size_of_element, void * untyped_state)
+{
+  rcl_inline_serialized_message_state_t * state = untyped_state;
+  return state->heap_allocator.zero_allocate(
+    number_of_elements, size_of_element, state->heap_allocator.state);
+}
+
+rcl_ret_t
+rcl_serialized_message_init_inline(
+  rcl_serialized_message_t * serialized_message,
+  rcl_inline_serialized_message_state_t * state,
+  uint8_t * buffer,
+  size_t buffer_capacity,
+  const rcl_allocator_t * heap_allocator)
+{
+  RCL_CHECK_ARGUMENT_FOR_NULL(serialized_message, RCL_RET_INVALID_ARGUMENT);
+  RCL_CHECK_ARGUMENT_FOR_NULL(state, RCL_RET_INVALID_ARGUMENT);
+  RCL_CHECK_ARGUMENT_FOR_NULL(buffer, RCL_RET_INVALID_ARGUMENT);
+  RCL_CHECK_ARGUMENT_FOR_NULL(heap_allocator, RCL_RET_INVALID_ARGUMENT);
+  RCL_CHECK_ALLOCATOR_WITH_MSG(
+    heap_allocator, "heap allocator is invalid", return RCL_RET_INVALID_ARGUMENT);
+  if (0u == buffer_capacity) {
+    RCL_SET_ERROR_MSG("buffer capacity must be greater than zero");
+    return RCL_RET_INVALID_ARGUMENT;
+  }
+
+  state->inline_buffer = buffer;
+  state->inline_capacity = buffer_capacity;
+  state->heap_allocator = *heap_allocator;
+
+  serialized_message->buffer = buffer;
+  serialized_message->buffer_length = 0u;
+  serialized_message->buffer_capacity = buffer_capacity;
+  serialized_message->allocator.allocate = _rcl_inline_serialized_message_allocate;
+  serialized_message->allocator.deallocate = _rcl_inline_serialized_message_deallocate;
+  serialized_message->allocator.reallocate = _rcl_inline_serialized_message_reallocate;
+  serialized_message->allocator.zero_allocate = _rcl_inline_serialized_message_zero_allocate;
+  serialized_message->allocator.state = state;
+  return RCL_RET_OK;
+}
+
+rcl_ret_t
+rcl_serialized_message_fini_inline(
+  rcl_serialized_message_t * serialized_message,
+  rcl_inline_serialized_message_state_t * state)
+{
+  RCL_CHECK_ARGUMENT_FOR_NULL(serialized_message, RCL_RET_INVALID_ARGUMENT);
+  RCL_CHECK_ARGUMENT_FOR_NULL(state, RCL_RET_INVALID_ARGUMENT);
+  if (
+    NULL != serialized_message->buffer &&
+    serialized_message->buffer != state->inline_buffer)
+  {
+    state->heap_allocator.deallocate(
+      serialized_message->buffer, state->heap_allocator.state);
+  }
+  *serialized_message = rmw_get_zero_initialized_serialized_message();
+  return RCL_RET_OK;
+}
+
+#ifdef __cplusplus
+}
+#endif
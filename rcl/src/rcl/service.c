@@ -29,6 +29,7 @@ extern "C"
 #include "rcl/types.h"
 #include "rcutils/logging_macros.h"
 #include "rcutils/macros.h"
+#include "rcutils/strdup.h"
 #include "rmw/error_handling.h"
 #include "rmw/rmw.h"
 #include "service_msgs/msg/service_event_info.h"
@@ -37,6 +38,7 @@ extern "C"
 #include "rosidl_runtime_c/service_type_support_struct.h"
 
 #include "./common.h"
+#include "./entity_cost_impl.h"
 #include "./service_event_publisher.h"
 
 struct rcl_service_impl_s
@@ -47,6 +49,8 @@ struct rcl_service_impl_s
   rmw_service_t * rmw_handle;
   rcl_service_event_publisher_t * service_event_publisher;
   char * remapped_service_name;
+  /// Take-cost accounting counters, see rcl_entity_get_cost_estimate().
+  rcl_entity_cost_record_t cost_record;
 };
 
 rcl_service_t
@@ -79,38 +83,17 @@ unconfigure_service_introspection(
   return ret;
 }
 
-rcl_ret_t
-rcl_service_init(
+/// Shared tail of service initialization; `resolved_service_name` must
+/// already be fully expanded and remapped and stays owned by the caller.
+static rcl_ret_t
+_rcl_service_init_with_resolved_name(
   rcl_service_t * service,
   const rcl_node_t * node,
   const rosidl_service_type_support_t * type_support,
-  const char * service_name,
+  const char * resolved_service_name,
   const rcl_service_options_t * options)
 {
-  RCUTILS_CAN_RETURN_WITH_ERROR_OF(RCL_RET_INVALID_ARGUMENT);
-  RCUTILS_CAN_RETURN_WITH_ERROR_OF(RCL_RET_ALREADY_INIT);
-  RCUTILS_CAN_RETURN_WITH_ERROR_OF(RCL_RET_NODE_INVALID);
-  RCUTILS_CAN_RETURN_WITH_ERROR_OF(RCL_RET_BAD_ALLOC);
-  RCUTILS_CAN_RETURN_WITH_ERROR_OF(RCL_RET_ERROR);
-  RCUTILS_CAN_RETURN_WITH_ERROR_OF(RCL_RET_SERVICE_NAME_INVALID);
-
-  // Check options and allocator first, so the allocator can be used in errors.
-  RCL_CHECK_ARGUMENT_FOR_NULL(options, RCL_RET_INVALID_ARGUMENT);
   rcl_allocator_t * allocator = (rcl_allocator_t *)&options->allocator;
-  RCL_CHECK_ALLOCATOR_WITH_MSG(allocator, "invalid allocator", return RCL_RET_INVALID_ARGUMENT);
-
-  RCL_CHECK_ARGUMENT_FOR_NULL(service, RCL_RET_INVALID_ARGUMENT);
-  if (!rcl_node_is_valid(node)) {
-    return RCL_RET_NODE_INVALID;  // error already set
-  }
-  RCL_CHECK_ARGUMENT_FOR_NULL(type_support, RCL_RET_INVALID_ARGUMENT);
-  RCL_CHECK_ARGUMENT_FOR_NULL(service_name, RCL_RET_INVALID_ARGUMENT);
-  RCUTILS_LOG_DEBUG_NAMED(
-    ROS_PACKAGE_NAME, "Initializing service for service name '%s'", service_name);
-  if (service->impl) {
-    RCL_SET_ERROR_MSG("service already initialized, or memory was unintialized");
-    return RCL_RET_ALREADY_INIT;
-  }
 
   // Allocate space for the implementation struct.
   service->impl = (rcl_service_impl_t *)allocator->zero_allocate(
@@ -119,25 +102,13 @@ rcl_service_init(
     service->impl, "allocating memory failed",
     return RCL_RET_BAD_ALLOC;);
 
-  // Expand and remap the given service name.
-  rcl_ret_t ret = rcl_node_resolve_name(
-    node,
-    service_name,
-    *allocator,
-    true,
-    false,
-    &service->impl->remapped_service_name);
-  if (ret != RCL_RET_OK) {
-    if (ret == RCL_RET_SERVICE_NAME_INVALID || ret == RCL_RET_UNKNOWN_SUBSTITUTION) {
-      ret = RCL_RET_SERVICE_NAME_INVALID;
-    } else if (ret != RCL_RET_BAD_ALLOC) {
-      ret = RCL_RET_ERROR;
-    }
+  rcl_ret_t ret = RCL_RET_OK;
+  service->impl->remapped_service_name = rcutils_strdup(resolved_service_name, *allocator);
+  if (NULL == service->impl->remapped_service_name) {
+    RCL_SET_ERROR_MSG("allocating memory failed");
+    ret = RCL_RET_BAD_ALLOC;
     goto free_service_impl;
   }
-  RCUTILS_LOG_DEBUG_NAMED(
-    ROS_PACKAGE_NAME, "Expanded and remapped service name '%s'",
-    service->impl->remapped_service_name);
 
   if (RMW_QOS_POLICY_DURABILITY_TRANSIENT_LOCAL == options->qos.durability) {
     RCUTILS_LOG_WARN_NAMED(
@@ -214,6 +185,109 @@ free_service_impl:
   return ret;
 }
 
+rcl_ret_t
+rcl_service_init(
+  rcl_service_t * service,
+  const rcl_node_t * node,
+  const rosidl_service_type_support_t * type_support,
+  const char * service_name,
+  const rcl_service_options_t * options)
+{
+  RCUTILS_CAN_RETURN_WITH_ERROR_OF(RCL_RET_INVALID_ARGUMENT);
+  RCUTILS_CAN_RETURN_WITH_ERROR_OF(RCL_RET_ALREADY_INIT);
+  RCUTILS_CAN_RETURN_WITH_ERROR_OF(RCL_RET_NODE_INVALID);
+  RCUTILS_CAN_RETURN_WITH_ERROR_OF(RCL_RET_BAD_ALLOC);
+  RCUTILS_CAN_RETURN_WITH_ERROR_OF(RCL_RET_ERROR);
+  RCUTILS_CAN_RETURN_WITH_ERROR_OF(RCL_RET_SERVICE_NAME_INVALID);
+
+  // Check options and allocator first, so the allocator can be used in errors.
+  RCL_CHECK_ARGUMENT_FOR_NULL(options, RCL_RET_INVALID_ARGUMENT);
+  rcl_allocator_t * allocator = (rcl_allocator_t *)&options->allocator;
+  RCL_CHECK_ALLOCATOR_WITH_MSG(allocator, "invalid allocator", return RCL_RET_INVALID_ARGUMENT);
+
+  RCL_CHECK_ARGUMENT_FOR_NULL(service, RCL_RET_INVALID_ARGUMENT);
+  if (!rcl_node_is_valid(node)) {
+    return RCL_RET_NODE_INVALID;  // error already set
+  }
+  RCL_CHECK_ARGUMENT_FOR_NULL(type_support, RCL_RET_INVALID_ARGUMENT);
+  RCL_CHECK_ARGUMENT_FOR_NULL(service_name, RCL_RET_INVALID_ARGUMENT);
+  RCUTILS_LOG_DEBUG_NAMED(
+    ROS_PACKAGE_NAME, "Initializing service for service name '%s'", service_name);
+  if (service->impl) {
+    RCL_SET_ERROR_MSG("service already initialized, or memory was unintialized");
+    return RCL_RET_ALREADY_INIT;
+  }
+
+  // Expand and remap the given service name.
+  char * remapped_service_name = NULL;
+  rcl_ret_t ret = rcl_node_resolve_name(
+    node,
+    service_name,
+    *allocator,
+    true,
+    false,
+    &remapped_service_name);
+  if (ret != RCL_RET_OK) {
+    if (ret == RCL_RET_SERVICE_NAME_INVALID || ret == RCL_RET_UNKNOWN_SUBSTITUTION) {
+      ret = RCL_RET_SERVICE_NAME_INVALID;
+    } else if (ret != RCL_RET_BAD_ALLOC) {
+      ret = RCL_RET_ERROR;
+    }
+    allocator->deallocate(remapped_service_name, allocator->state);
+    return ret;
+  }
+  RCUTILS_LOG_DEBUG_NAMED(
+    ROS_PACKAGE_NAME, "Expanded and remapped service name '%s'", remapped_service_name);
+
+  ret = _rcl_service_init_with_resolved_name(
+    service, node, type_support, remapped_service_name, options);
+  allocator->deallocate(remapped_service_name, allocator->state);
+  return ret;
+}
+
+rcl_ret_t
+rcl_service_init_with_resolved_name(
+  rcl_service_t * service,
+  const rcl_node_t * node,
+  const rosidl_service_type_support_t * type_support,
+  const char * resolved_service_name,
+  const rcl_service_options_t * options)
+{
+  RCUTILS_CAN_RETURN_WITH_ERROR_OF(RCL_RET_INVALID_ARGUMENT);
+  RCUTILS_CAN_RETURN_WITH_ERROR_OF(RCL_RET_ALREADY_INIT);
+  RCUTILS_CAN_RETURN_WITH_ERROR_OF(RCL_RET_NODE_INVALID);
+  RCUTILS_CAN_RETURN_WITH_ERROR_OF(RCL_RET_BAD_ALLOC);
+  RCUTILS_CAN_RETURN_WITH_ERROR_OF(RCL_RET_ERROR);
+  RCUTILS_CAN_RETURN_WITH_ERROR_OF(RCL_RET_SERVICE_NAME_INVALID);
+
+  RCL_CHECK_ARGUMENT_FOR_NULL(options, RCL_RET_INVALID_ARGUMENT);
+  rcl_allocator_t * allocator = (rcl_allocator_t *)&options->allocator;
+  RCL_CHECK_ALLOCATOR_WITH_MSG(allocator, "invalid allocator", return RCL_RET_INVALID_ARGUMENT);
+
+  RCL_CHECK_ARGUMENT_FOR_NULL(service, RCL_RET_INVALID_ARGUMENT);
+  if (!rcl_node_is_valid(node)) {
+    return RCL_RET_NODE_INVALID;  // error already set
+  }
+  RCL_CHECK_ARGUMENT_FOR_NULL(type_support, RCL_RET_INVALID_ARGUMENT);
+  RCL_CHECK_ARGUMENT_FOR_NULL(resolved_service_name, RCL_RET_INVALID_ARGUMENT);
+  if (service->impl) {
+    RCL_SET_ERROR_MSG("service already initialized, or memory was unintialized");
+    return RCL_RET_ALREADY_INIT;
+  }
+  // The name is trusted to come from a prior resolution; only guard against
+  // names that obviously never went through one.
+  if ('/' != resolved_service_name[0]) {
+    RCL_SET_ERROR_MSG("resolved service name must be fully qualified");
+    return RCL_RET_SERVICE_NAME_INVALID;
+  }
+  RCUTILS_LOG_DEBUG_NAMED(
+    ROS_PACKAGE_NAME, "Initializing service for resolved service name '%s'",
+    resolved_service_name);
+
+  return _rcl_service_init_with_resolved_name(
+    service, node, type_support, resolved_service_name, options);
+}
+
 rcl_ret_t
 rcl_service_fini(rcl_service_t * service, rcl_node_t * node)
 {
@@ -300,6 +374,18 @@ rcl_service_get_rmw_handle(const rcl_service_t * service)
   return service->impl->rmw_handle;
 }
 
+rcl_ret_t
+rcl_service_get_cost_record(
+  const rcl_service_t * service,
+  rcl_entity_cost_record_t ** record)
+{
+  if (!rcl_service_is_valid(service)) {
+    return RCL_RET_SERVICE_INVALID;  // error already set
+  }
+  *record = &service->impl->cost_record;
+  return RCL_RET_OK;
+}
+
 rcl_ret_t
 rcl_take_request_with_info(
   const rcl_service_t * service,
@@ -315,6 +401,10 @@ rcl_take_request_with_info(
   const rcl_service_options_t * options = rcl_service_get_options(service);
   RCL_CHECK_FOR_NULL_WITH_MSG(options, "Failed to get service options", return RCL_RET_ERROR);
 
+  rcutils_time_point_value_t cost_start;
+  const bool cost_active =
+    rcl_entity_cost_record_begin(&service->impl->cost_record, &cost_start);
+
   bool taken = false;
   rmw_ret_t ret = rmw_take_request(
     service->impl->rmw_handle, request_header, ros_request, &taken);
@@ -328,7 +418,7 @@ rcl_take_request_with_info(
   RCUTILS_LOG_DEBUG_NAMED(
     ROS_PACKAGE_NAME, "Service take request succeeded: %s", taken ? "true" : "false");
   if (!taken) {
-    return RCL_RET_SERVICE_TAKE_FAILED;
+    RCL_RETURN_EXPECTED(RCL_RET_SERVICE_TAKE_FAILED);
   }
   if (service->impl->service_event_publisher != NULL) {
     rcl_ret_t rclret = rcl_send_service_event_message(
@@ -342,6 +432,9 @@ rcl_take_request_with_info(
       return rclret;
     }
   }
+  if (cost_active) {
+    rcl_entity_cost_record_commit(&service->impl->cost_record, cost_start);
+  }
   return RCL_RET_OK;
 }
 
@@ -358,6 +451,64 @@ rcl_take_request(
   return ret;
 }
 
+rcl_ret_t
+rcl_take_request_batch(
+  const rcl_service_t * service,
+  rmw_service_info_t * request_headers,
+  void ** ros_requests,
+  size_t max_requests,
+  size_t * taken)
+{
+  RCUTILS_LOG_DEBUG_NAMED(
+    ROS_PACKAGE_NAME, "Service server taking batch of up to %zu requests", max_requests);
+  if (!rcl_service_is_valid(service)) {
+    return RCL_RET_SERVICE_INVALID;  // error already set
+  }
+  RCL_CHECK_ARGUMENT_FOR_NULL(request_headers, RCL_RET_INVALID_ARGUMENT);
+  RCL_CHECK_ARGUMENT_FOR_NULL(ros_requests, RCL_RET_INVALID_ARGUMENT);
+  RCL_CHECK_ARGUMENT_FOR_NULL(taken, RCL_RET_INVALID_ARGUMENT);
+  if (0u == max_requests) {
+    RCL_SET_ERROR_MSG("max_requests must be greater than zero");
+    return RCL_RET_INVALID_ARGUMENT;
+  }
+
+  *taken = 0u;
+  while (*taken < max_requests) {
+    bool one_taken = false;
+    rmw_ret_t ret = rmw_take_request(
+      service->impl->rmw_handle, &request_headers[*taken], ros_requests[*taken], &one_taken);
+    if (RMW_RET_OK != ret) {
+      RCL_SET_ERROR_MSG(rmw_get_error_string().str);
+      if (RMW_RET_BAD_ALLOC == ret) {
+        return RCL_RET_BAD_ALLOC;
+      }
+      return RCL_RET_ERROR;
+    }
+    if (!one_taken) {
+      break;  // queue drained
+    }
+    if (service->impl->service_event_publisher != NULL) {
+      rcl_ret_t rclret = rcl_send_service_event_message(
+        service->impl->service_event_publisher,
+        service_msgs__msg__ServiceEventInfo__REQUEST_RECEIVED,
+        ros_requests[*taken],
+        request_headers[*taken].request_id.sequence_number,
+        request_headers[*taken].request_id.writer_guid);
+      if (RCL_RET_OK != rclret) {
+        RCL_SET_ERROR_MSG(rcl_get_error_string().str);
+        return rclret;
+      }
+    }
+    ++(*taken);
+  }
+  RCUTILS_LOG_DEBUG_NAMED(
+    ROS_PACKAGE_NAME, "Service batch took %zu requests", *taken);
+  if (0u == *taken) {
+    RCL_RETURN_EXPECTED(RCL_RET_SERVICE_TAKE_FAILED);
+  }
+  return RCL_RET_OK;
+}
+
 rcl_ret_t
 rcl_send_response(
   const rcl_service_t * service,
@@ -396,6 +547,51 @@ rcl_send_response(
   return RCL_RET_OK;
 }
 
+rcl_ret_t
+rcl_send_response_batch(
+  const rcl_service_t * service,
+  rmw_request_id_t * request_headers,
+  void ** ros_responses,
+  size_t count,
+  size_t * sent)
+{
+  RCUTILS_LOG_DEBUG_NAMED(ROS_PACKAGE_NAME, "Sending batch of %zu service responses", count);
+  if (!rcl_service_is_valid(service)) {
+    return RCL_RET_SERVICE_INVALID;  // error already set
+  }
+  RCL_CHECK_ARGUMENT_FOR_NULL(request_headers, RCL_RET_INVALID_ARGUMENT);
+  RCL_CHECK_ARGUMENT_FOR_NULL(ros_responses, RCL_RET_INVALID_ARGUMENT);
+  RCL_CHECK_ARGUMENT_FOR_NULL(sent, RCL_RET_INVALID_ARGUMENT);
+  if (0u == count) {
+    RCL_SET_ERROR_MSG("count must be greater than zero");
+    return RCL_RET_INVALID_ARGUMENT;
+  }
+
+  *sent = 0u;
+  while (*sent < count) {
+    if (rmw_send_response(
+        service->impl->rmw_handle, &request_headers[*sent], ros_responses[*sent]) != RMW_RET_OK)
+    {
+      RCL_SET_ERROR_MSG(rmw_get_error_string().str);
+      return RCL_RET_ERROR;
+    }
+    if (service->impl->service_event_publisher != NULL) {
+      rcl_ret_t ret = rcl_send_service_event_message(
+        service->impl->service_event_publisher,
+        service_msgs__msg__ServiceEventInfo__RESPONSE_SENT,
+        ros_responses[*sent],
+        request_headers[*sent].sequence_number,
+        request_headers[*sent].writer_guid);
+      if (RCL_RET_OK != ret) {
+        RCL_SET_ERROR_MSG(rcl_get_error_string().str);
+        return ret;
+      }
+    }
+    ++(*sent);
+  }
+  return RCL_RET_OK;
+}
+
 bool
 rcl_service_is_valid(const rcl_service_t * service)
 {
@@ -488,6 +684,22 @@ rcl_service_configure_service_introspection(
     service->impl->service_event_publisher, introspection_state);
 }
 
+rcl_ret_t
+rcl_service_set_introspection_payload_limit(
+  rcl_service_t * service,
+  size_t max_payload_bytes)
+{
+  if (!rcl_service_is_valid(service)) {
+    return RCL_RET_SERVICE_INVALID;  // error already set
+  }
+  if (NULL == service->impl->service_event_publisher) {
+    RCL_SET_ERROR_MSG("service introspection is not configured on this service");
+    return RCL_RET_ERROR;
+  }
+  return rcl_service_event_publisher_set_payload_limit(
+    service->impl->service_event_publisher, max_payload_bytes);
+}
+
 #ifdef __cplusplus
 }
 #endif
@@ -27,6 +27,7 @@
 #include "rcutils/logging_macros.h"
 #include "rcutils/macros.h"
 #include "rmw/error_handling.h"
+#include "rmw/rmw.h"
 #include "service_msgs/msg/service_event_info.h"
 
 rcl_service_event_publisher_t rcl_get_zero_initialized_service_event_publisher()
@@ -144,11 +145,33 @@ rcl_ret_t rcl_service_event_publisher_init(
     goto free_topic_name;
   }
 
+  // Preallocate the event message used by metadata-only introspection so the
+  // hot path does not create and destroy one per call.
+  {
+    rosidl_service_introspection_info_t empty_info = {0};
+    service_event_publisher->metadata_event_message =
+      service_type_support->event_message_create_handle_function(
+      &empty_info, &allocator, NULL, NULL);
+  }
+  if (NULL == service_event_publisher->metadata_event_message) {
+    RCL_SET_ERROR_MSG("allocating the metadata event message failed");
+    ret = RCL_RET_BAD_ALLOC;
+    goto fini_publisher;
+  }
+
   RCUTILS_LOG_DEBUG_NAMED(
     ROS_PACKAGE_NAME, "Service introspection for service '%s' initialized", service_name);
 
   return RCL_RET_OK;
 
+fini_publisher:
+  if (RCL_RET_OK != rcl_publisher_fini(service_event_publisher->publisher, (rcl_node_t *)node)) {
+    RCUTILS_LOG_ERROR_NAMED(
+      ROS_PACKAGE_NAME, "Failed to fini the introspection publisher: %s",
+      rcl_get_error_string().str);
+  }
+  allocator.deallocate(service_event_publisher->publisher, allocator.state);
+  service_event_publisher->publisher = NULL;
 free_topic_name:
   allocator.deallocate(service_event_publisher->service_event_topic_name, allocator.state);
 
@@ -177,6 +200,21 @@ rcl_ret_t rcl_service_event_publisher_fini(
   rcl_allocator_t allocator = service_event_publisher->publisher_options.allocator;
   RCL_CHECK_ALLOCATOR_WITH_MSG(&allocator, "allocator is invalid", return RCL_RET_ERROR);
 
+  if (service_event_publisher->metadata_event_message) {
+    service_event_publisher->service_type_support->event_message_destroy_handle_function(
+      service_event_publisher->metadata_event_message, &allocator);
+    service_event_publisher->metadata_event_message = NULL;
+  }
+
+  if (service_event_publisher->size_check_buffer.buffer) {
+    rmw_ret_t rmw_ret =
+      rmw_serialized_message_fini(&service_event_publisher->size_check_buffer);
+    if (RMW_RET_OK != rmw_ret) {
+      RCL_SET_ERROR_MSG(rmw_get_error_string().str);
+      return RCL_RET_ERROR;
+    }
+  }
+
   if (service_event_publisher->publisher) {
     rcl_ret_t ret = rcl_publisher_fini(service_event_publisher->publisher, node);
     allocator.deallocate(service_event_publisher->publisher, allocator.state);
@@ -241,6 +279,42 @@ rcl_ret_t rcl_send_service_event_message(
 
   memcpy(info.client_gid, guid, 16);
 
+  switch (event_type) {
+    case service_msgs__msg__ServiceEventInfo__REQUEST_RECEIVED:
+    case service_msgs__msg__ServiceEventInfo__REQUEST_SENT:
+    case service_msgs__msg__ServiceEventInfo__RESPONSE_RECEIVED:
+    case service_msgs__msg__ServiceEventInfo__RESPONSE_SENT:
+      break;
+    default:
+      rcutils_reset_error();
+      RCL_SET_ERROR_MSG("unsupported event type");
+      return RCL_RET_ERROR;
+  }
+
+  if (service_event_publisher->introspection_state == RCL_SERVICE_INTROSPECTION_METADATA &&
+    NULL != service_event_publisher->metadata_event_message)
+  {
+    // Metadata-only events carry no payload, so the preallocated event
+    // message can be reused; only its info block changes per call.  Event
+    // messages place the info member first (see REP 2012), which is what
+    // makes this in-place refresh possible without the typed struct.
+    service_msgs__msg__ServiceEventInfo * event_info =
+      (service_msgs__msg__ServiceEventInfo *)service_event_publisher->metadata_event_message;
+    event_info->event_type = info.event_type;
+    event_info->stamp.sec = info.stamp_sec;
+    event_info->stamp.nanosec = info.stamp_nanosec;
+    event_info->sequence_number = info.sequence_number;
+    memcpy(event_info->client_gid, info.client_gid, 16);
+
+    ret = rcl_publish(
+      service_event_publisher->publisher, service_event_publisher->metadata_event_message, NULL);
+    if (RCL_RET_OK != ret) {
+      rcutils_reset_error();
+      RCL_SET_ERROR_MSG(rmw_get_error_string().str);
+    }
+    return ret;
+  }
+
   void * service_introspection_message;
   if (service_event_publisher->introspection_state == RCL_SERVICE_INTROSPECTION_METADATA) {
     ros_response_request = NULL;
@@ -252,20 +326,74 @@ rcl_ret_t rcl_send_service_event_message(
         service_event_publisher->service_type_support->event_message_create_handle_function(
         &info, &allocator, ros_response_request, NULL);
       break;
-    case service_msgs__msg__ServiceEventInfo__RESPONSE_RECEIVED:
-    case service_msgs__msg__ServiceEventInfo__RESPONSE_SENT:
+    default:
       service_introspection_message =
         service_event_publisher->service_type_support->event_message_create_handle_function(
         &info, &allocator, NULL, ros_response_request);
       break;
-    default:
-      rcutils_reset_error();
-      RCL_SET_ERROR_MSG("unsupported event type");
-      return RCL_RET_ERROR;
   }
   RCL_CHECK_FOR_NULL_WITH_MSG(
     service_introspection_message, "service_introspection_message is NULL", return RCL_RET_ERROR);
 
+  if (0u != service_event_publisher->payload_size_limit) {
+    // The cap is enforced on the serialized form; events that fit are
+    // published from these bytes so nothing is serialized twice, oversized
+    // ones are degraded to the payload-free metadata message.
+    rcl_service_event_publisher_t * mutable_publisher =
+      (rcl_service_event_publisher_t *)service_event_publisher;
+    if (NULL == mutable_publisher->size_check_buffer.allocator.allocate) {
+      rmw_ret_t init_ret = rmw_serialized_message_init(
+        &mutable_publisher->size_check_buffer, 0u, &allocator);
+      if (RMW_RET_OK != init_ret) {
+        service_event_publisher->service_type_support->event_message_destroy_handle_function(
+          service_introspection_message, &allocator);
+        RCL_SET_ERROR_MSG(rmw_get_error_string().str);
+        return RCL_RET_ERROR;
+      }
+    }
+    rmw_ret_t serialize_ret = rmw_serialize(
+      service_introspection_message,
+      service_event_publisher->service_type_support->event_typesupport,
+      &mutable_publisher->size_check_buffer);
+    service_event_publisher->service_type_support->event_message_destroy_handle_function(
+      service_introspection_message, &allocator);
+    if (RMW_RET_OK != serialize_ret) {
+      RCL_SET_ERROR_MSG(rmw_get_error_string().str);
+      return RCL_RET_ERROR;
+    }
+    if (mutable_publisher->size_check_buffer.buffer_length <=
+      service_event_publisher->payload_size_limit)
+    {
+      ret = rcl_publish_serialized_message(
+        service_event_publisher->publisher, &mutable_publisher->size_check_buffer, NULL);
+      if (RCL_RET_OK != ret) {
+        rcutils_reset_error();
+        RCL_SET_ERROR_MSG(rmw_get_error_string().str);
+      }
+      return ret;
+    }
+    // over the cap: fall back to the payload-free metadata message
+    if (NULL != service_event_publisher->metadata_event_message) {
+      service_msgs__msg__ServiceEventInfo * event_info =
+        (service_msgs__msg__ServiceEventInfo *)service_event_publisher->metadata_event_message;
+      event_info->event_type = info.event_type;
+      event_info->stamp.sec = info.stamp_sec;
+      event_info->stamp.nanosec = info.stamp_nanosec;
+      event_info->sequence_number = info.sequence_number;
+      memcpy(event_info->client_gid, info.client_gid, 16);
+      ret = rcl_publish(
+        service_event_publisher->publisher,
+        service_event_publisher->metadata_event_message, NULL);
+      if (RCL_RET_OK != ret) {
+        rcutils_reset_error();
+        RCL_SET_ERROR_MSG(rmw_get_error_string().str);
+      }
+      return ret;
+    }
+    RCL_SET_ERROR_MSG("event exceeds the payload cap and no metadata message is available");
+    return RCL_RET_ERROR;
+  }
+
   // and publish it out!
   ret = rcl_publish(service_event_publisher->publisher, service_introspection_message, NULL);
   // clean up before error checking
@@ -279,6 +407,18 @@ rcl_ret_t rcl_send_service_event_message(
   return ret;
 }
 
+rcl_ret_t
+rcl_service_event_publisher_set_payload_limit(
+  rcl_service_event_publisher_t * service_event_publisher,
+  size_t max_payload_bytes)
+{
+  if (!rcl_service_event_publisher_is_valid(service_event_publisher)) {
+    return RCL_RET_ERROR;
+  }
+  service_event_publisher->payload_size_limit = max_payload_bytes;
+  return RCL_RET_OK;
+}
+
 rcl_ret_t
 rcl_service_event_publisher_change_state(
   rcl_service_event_publisher_t * service_event_publisher,
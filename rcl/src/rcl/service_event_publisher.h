@@ -44,6 +44,13 @@ typedef struct rcl_service_event_publisher_s
   rcl_publisher_options_t publisher_options;
   /// Handle to service typesupport
   const rosidl_service_type_support_t * service_type_support;
+  /// Preallocated payload-free event message reused by metadata-only
+  /// introspection; only its info block is refreshed per call.
+  void * metadata_event_message;
+  /// Byte cap applied to full-contents events, 0 for unlimited.
+  size_t payload_size_limit;
+  /// Retained buffer events are serialized into when a payload cap is set.
+  rcl_serialized_message_t size_check_buffer;
 } rcl_service_event_publisher_t;
 
 /// Return a rcl_service_event_publisher_t struct with members set to `NULL`.
@@ -195,6 +202,30 @@ rcl_send_service_event_message(
   int64_t sequence_number,
   const uint8_t guid[16]);
 
+/// Cap the size of full-contents introspection events.
+/**
+ * When a non-zero cap is set, each full-contents event is serialized and its
+ * size checked before publication: events at or under the cap are published
+ * as-is (from the already serialized form, so nothing is serialized twice),
+ * while oversized events are degraded to the payload-free metadata form.
+ * A degraded event is recognizable in a contents-mode stream by its empty
+ * request and response sequences.
+ * This bounds the introspection cost of services carrying large payloads,
+ * e.g. point clouds, so contents introspection can stay enabled in
+ * production.
+ *
+ * \param[in] service_event_publisher pointer to the service event publisher
+ * \param[in] max_payload_bytes serialized event size cap, 0 for unlimited
+ * \return #RCL_RET_OK if the cap was set, or
+ * \return #RCL_RET_ERROR if the service event publisher is invalid.
+ */
+RCL_PUBLIC
+RCL_WARN_UNUSED
+rcl_ret_t
+rcl_service_event_publisher_set_payload_limit(
+  rcl_service_event_publisher_t * service_event_publisher,
+  size_t max_payload_bytes);
+
 /// Change the operating state of this service event publisher.
 /**
  * \param[in] service_event_publisher pointer to the service event publisher
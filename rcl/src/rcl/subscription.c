@@ -19,12 +19,17 @@ extern "C"
 
 #include "rcl/subscription.h"
 
+#include <stdint.h>
 #include <stdio.h>
+#include <string.h>
 
 #include "rcl/error_handling.h"
 #include "rcl/node.h"
+#include "rcl/trace.h"
 #include "rcutils/logging_macros.h"
+#include "rcutils/stdatomic_helper.h"
 #include "rcutils/strdup.h"
+#include "rcutils/time.h"
 #include "rcutils/types/string_array.h"
 #include "rmw/error_handling.h"
 #include "rmw/dynamic_message_type_support.h"
@@ -122,6 +127,8 @@ rcl_subscription_init(
     options->qos.avoid_ros_namespace_conventions;
   // options
   subscription->impl->options = *options;
+  // kept so the fallback content filter can deserialize matched samples
+  subscription->impl->type_support = type_support;
   RCUTILS_LOG_DEBUG_NAMED(ROS_PACKAGE_NAME, "Subscription initialized");
   ret = RCL_RET_OK;
   TRACETOOLS_TRACEPOINT(
@@ -179,6 +186,47 @@ rcl_subscription_fini(rcl_subscription_t * subscription, rcl_node_t * node)
     if (!rmw_node) {
       return RCL_RET_INVALID_ARGUMENT;
     }
+    if (subscription->impl->loan_pool.storage) {
+      allocator.deallocate(subscription->impl->loan_pool.storage, allocator.state);
+      allocator.deallocate(subscription->impl->loan_pool.free_blocks, allocator.state);
+    }
+    if (subscription->impl->lent_buffers.buffers) {
+      // outstanding loans are invalidated by fini, release everything
+      for (size_t i = 0u; i < subscription->impl->lent_buffers.capacity; ++i) {
+        rmw_ret_t lent_ret =
+          rmw_serialized_message_fini(&subscription->impl->lent_buffers.buffers[i]);
+        if (RMW_RET_OK != lent_ret) {
+          RCUTILS_SAFE_FWRITE_TO_STDERR(rmw_get_error_string().str);
+          RCUTILS_SAFE_FWRITE_TO_STDERR("\n");
+          result = RCL_RET_ERROR;
+        }
+      }
+      allocator.deallocate(subscription->impl->lent_buffers.buffers, allocator.state);
+      allocator.deallocate(subscription->impl->lent_buffers.in_use, allocator.state);
+    }
+    if (subscription->impl->gap_tracker.gids) {
+      allocator.deallocate(subscription->impl->gap_tracker.gids, allocator.state);
+      allocator.deallocate(subscription->impl->gap_tracker.occupied, allocator.state);
+      allocator.deallocate(subscription->impl->gap_tracker.last_sequence, allocator.state);
+    }
+    if (subscription->impl->network_flow_cache_valid) {
+      rmw_ret_t flow_fini_ret =
+        rmw_network_flow_endpoint_array_fini(&subscription->impl->network_flow_cache);
+      if (RMW_RET_OK != flow_fini_ret) {
+        RCUTILS_SAFE_FWRITE_TO_STDERR(rmw_get_error_string().str);
+        RCUTILS_SAFE_FWRITE_TO_STDERR("\n");
+        result = RCL_RET_ERROR;
+      }
+    }
+    if (subscription->impl->cdr_filter.scratch.buffer) {
+      rmw_ret_t scratch_ret =
+        rmw_serialized_message_fini(&subscription->impl->cdr_filter.scratch);
+      if (RMW_RET_OK != scratch_ret) {
+        RCUTILS_SAFE_FWRITE_TO_STDERR(rmw_get_error_string().str);
+        RCUTILS_SAFE_FWRITE_TO_STDERR("\n");
+        result = RCL_RET_ERROR;
+      }
+    }
     rmw_ret_t ret =
       rmw_destroy_subscription(rmw_node, subscription->impl->rmw_handle);
     if (ret != RMW_RET_OK) {
@@ -199,6 +247,83 @@ rcl_subscription_fini(rcl_subscription_t * subscription, rcl_node_t * node)
   return result;
 }
 
+/// Trampoline installed at the rmw layer for coalesced callbacks.
+static void
+_rcl_subscription_coalesced_new_message_callback(
+  const void * user_data, size_t number_of_events);
+
+rcl_ret_t
+rcl_subscription_set_qos_depth(
+  rcl_subscription_t * subscription,
+  rcl_node_t * node,
+  size_t depth)
+{
+  if (!rcl_subscription_is_valid(subscription)) {
+    return RCL_RET_SUBSCRIPTION_INVALID;  // error already set
+  }
+  if (!rcl_node_is_valid(node)) {
+    return RCL_RET_NODE_INVALID;  // error already set
+  }
+  if (0u == depth) {
+    RCL_SET_ERROR_MSG("depth must be greater than zero");
+    return RCL_RET_INVALID_ARGUMENT;
+  }
+  rcl_subscription_impl_t * impl = subscription->impl;
+  if (depth == impl->options.qos.depth) {
+    return RCL_RET_OK;
+  }
+  // The rmw layer has no in-place QoS mutation, so swap make-before-break:
+  // the replacement exists and can match publishers before the old rmw
+  // subscription is destroyed, and the already-resolved topic name is reused
+  // so nothing goes back through name expansion and remapping.
+  rmw_qos_profile_t qos = impl->options.qos;
+  qos.depth = depth;
+  rmw_subscription_t * replacement = rmw_create_subscription(
+    rcl_node_get_rmw_handle(node),
+    impl->type_support,
+    impl->rmw_handle->topic_name,
+    &qos,
+    &impl->options.rmw_subscription_options);
+  if (!replacement) {
+    RCL_SET_ERROR_MSG(rmw_get_error_string().str);
+    return RCL_RET_ERROR;
+  }
+  rmw_ret_t rmw_ret = rmw_subscription_get_actual_qos(replacement, &impl->actual_qos);
+  if (RMW_RET_OK != rmw_ret) {
+    RCL_SET_ERROR_MSG(rmw_get_error_string().str);
+    rmw_ret_t destroy_ret = rmw_destroy_subscription(
+      rcl_node_get_rmw_handle(node), replacement);
+    if (RMW_RET_OK != destroy_ret) {
+      RCUTILS_SAFE_FWRITE_TO_STDERR(rmw_get_error_string().str);
+      RCUTILS_SAFE_FWRITE_TO_STDERR("\n");
+    }
+    return rcl_convert_rmw_ret_to_rcl_ret(rmw_ret);
+  }
+  impl->actual_qos.avoid_ros_namespace_conventions =
+    impl->options.qos.avoid_ros_namespace_conventions;
+  rmw_subscription_t * old_handle = impl->rmw_handle;
+  impl->rmw_handle = replacement;
+  impl->options.qos.depth = depth;
+  if (impl->coalescing.active) {
+    // the trampoline follows the subscription, not the rmw object
+    rmw_ret = rmw_subscription_set_on_new_message_callback(
+      impl->rmw_handle, _rcl_subscription_coalesced_new_message_callback, impl);
+    if (RMW_RET_OK != rmw_ret) {
+      RCUTILS_SAFE_FWRITE_TO_STDERR(rmw_get_error_string().str);
+      RCUTILS_SAFE_FWRITE_TO_STDERR("\n");
+      impl->coalescing.active = false;
+    }
+  }
+  rmw_ret = rmw_destroy_subscription(rcl_node_get_rmw_handle(node), old_handle);
+  if (RMW_RET_OK != rmw_ret) {
+    RCL_SET_ERROR_MSG(rmw_get_error_string().str);
+    return RCL_RET_ERROR;
+  }
+  RCUTILS_LOG_DEBUG_NAMED(
+    ROS_PACKAGE_NAME, "Subscription depth changed to %zu in place", depth);
+  return RCL_RET_OK;
+}
+
 rcl_subscription_options_t
 rcl_subscription_get_default_options()
 {
@@ -441,13 +566,124 @@ rcl_subscription_content_filter_options_fini(
   return rcl_convert_rmw_ret_to_rcl_ret(ret);
 }
 
+// Comparison codes for the compiled fallback content filter.
+#define _RCL_CDR_FILTER_OP_EQ 0u
+#define _RCL_CDR_FILTER_OP_NE 1u
+#define _RCL_CDR_FILTER_OP_LT 2u
+#define _RCL_CDR_FILTER_OP_LE 3u
+#define _RCL_CDR_FILTER_OP_GT 4u
+#define _RCL_CDR_FILTER_OP_GE 5u
+
+/// Compile a filter expression into an offset-addressed CDR predicate.
+/**
+ * The fallback engine accepts the restricted grammar
+ *   `@<offset>,<width> <op> <constant>`
+ * where offset addresses an integer field within the CDR body, width is 1,
+ * 2, 4 or 8 bytes and op is one of ==, !=, <, <=, > or >=,
+ * e.g. "@4,4 >= 100".
+ * An empty expression clears the filter.
+ * Returns false when the expression does not fit the grammar, leaving the
+ * filter inactive.
+ */
+static bool
+_rcl_subscription_compile_cdr_filter(
+  const char * expression, rcl_subscription_cdr_filter_t * filter)
+{
+  filter->active = false;
+  if (NULL == expression || '\0' == expression[0]) {
+    return true;
+  }
+  size_t offset = 0u;
+  unsigned int width = 0u;
+  char op_token[3] = {0};
+  long long operand = 0;
+  if (4 != sscanf(expression, " @%zu,%u %2[=!<>] %lld", &offset, &width, op_token, &operand)) {
+    return false;
+  }
+  if (1u != width && 2u != width && 4u != width && 8u != width) {
+    return false;
+  }
+  uint8_t op;
+  if (0 == strcmp(op_token, "==")) {
+    op = _RCL_CDR_FILTER_OP_EQ;
+  } else if (0 == strcmp(op_token, "!=")) {
+    op = _RCL_CDR_FILTER_OP_NE;
+  } else if (0 == strcmp(op_token, "<")) {
+    op = _RCL_CDR_FILTER_OP_LT;
+  } else if (0 == strcmp(op_token, "<=")) {
+    op = _RCL_CDR_FILTER_OP_LE;
+  } else if (0 == strcmp(op_token, ">")) {
+    op = _RCL_CDR_FILTER_OP_GT;
+  } else if (0 == strcmp(op_token, ">=")) {
+    op = _RCL_CDR_FILTER_OP_GE;
+  } else {
+    return false;
+  }
+  filter->offset = offset;
+  filter->width = width;
+  filter->op = op;
+  filter->operand = (int64_t)operand;
+  filter->active = true;
+  return true;
+}
+
+/// Evaluate the compiled filter against a serialized sample.
+/**
+ * Fails open: samples the predicate cannot address (too short, or big-endian
+ * encapsulation) are delivered rather than dropped.
+ */
+static bool
+_rcl_subscription_cdr_filter_matches(
+  const rcl_subscription_cdr_filter_t * filter,
+  const rcl_serialized_message_t * sample)
+{
+  // a 4-byte CDR encapsulation header precedes the body
+  if (sample->buffer_length < 4u + filter->offset + filter->width) {
+    return true;
+  }
+  if (0x01u != (sample->buffer[1] & 0x01u)) {
+    return true;  // big-endian sample, deliver rather than misread
+  }
+  const uint8_t * field = sample->buffer + 4u + filter->offset;
+  uint64_t raw = 0u;
+  for (size_t i = 0u; i < filter->width; ++i) {
+    raw |= (uint64_t)field[i] << (8u * i);
+  }
+  if (filter->width < 8u) {
+    // sign-extend from the field width
+    uint64_t sign_bit = (uint64_t)1u << (8u * filter->width - 1u);
+    if (raw & sign_bit) {
+      raw |= ~((sign_bit << 1u) - 1u);
+    }
+  }
+  int64_t value;
+  memcpy(&value, &raw, sizeof(value));
+  switch (filter->op) {
+    case _RCL_CDR_FILTER_OP_EQ:
+      return value == filter->operand;
+    case _RCL_CDR_FILTER_OP_NE:
+      return value != filter->operand;
+    case _RCL_CDR_FILTER_OP_LT:
+      return value < filter->operand;
+    case _RCL_CDR_FILTER_OP_LE:
+      return value <= filter->operand;
+    case _RCL_CDR_FILTER_OP_GT:
+      return value > filter->operand;
+    case _RCL_CDR_FILTER_OP_GE:
+      return value >= filter->operand;
+    default:
+      return true;
+  }
+}
+
 bool
 rcl_subscription_is_cft_enabled(const rcl_subscription_t * subscription)
 {
   if (!rcl_subscription_is_valid(subscription)) {
     return false;
   }
-  return subscription->impl->rmw_handle->is_cft_enabled;
+  return subscription->impl->rmw_handle->is_cft_enabled ||
+         subscription->impl->cdr_filter.active;
 }
 
 rcl_ret_t
@@ -468,9 +704,23 @@ rcl_subscription_set_content_filter(
     subscription->impl->rmw_handle,
     &options->rmw_subscription_content_filter_options);
 
-  if (ret != RMW_RET_OK) {
+  if (RMW_RET_UNSUPPORTED == ret) {
+    // Fall back to the rcl-level engine when the expression fits its grammar,
+    // so non-matching samples are still dropped before deserialization.
+    if (!_rcl_subscription_compile_cdr_filter(
+        options->rmw_subscription_content_filter_options.filter_expression,
+        &subscription->impl->cdr_filter))
+    {
+      RCL_SET_ERROR_MSG(rmw_get_error_string().str);
+      return rcl_convert_rmw_ret_to_rcl_ret(ret);
+    }
+    rmw_reset_error();
+  } else if (ret != RMW_RET_OK) {
     RCL_SET_ERROR_MSG(rmw_get_error_string().str);
     return rcl_convert_rmw_ret_to_rcl_ret(ret);
+  } else {
+    // the middleware filters natively, the fallback engine stays out of the way
+    subscription->impl->cdr_filter.active = false;
   }
 
   // copy options into subscription_options
@@ -508,6 +758,195 @@ rcl_subscription_get_content_filter(
   return rcl_convert_rmw_ret_to_rcl_ret(rmw_ret);
 }
 
+/// Update the take-side receive-queue accounting.
+/**
+ * Each successful take extends the current drain burst; a take that finds
+ * the queue empty ends it.
+ * The longest burst seen approximates how full the queue has been, since the
+ * middleware exposes no direct occupancy query.
+ */
+static RCL_ALWAYS_INLINE void
+_rcl_subscription_account_take(rcl_subscription_impl_t * impl, size_t taken)
+{
+#ifdef RCL_PROFILE_STATIC
+  // fixed-function builds keep the take path free of bookkeeping stores
+  (void)impl;
+  (void)taken;
+  return;
+#endif
+  if (0u == taken) {
+    impl->queue_stats.current_queued_estimate = 0u;
+    return;
+  }
+  impl->queue_stats.messages_taken += taken;
+  impl->queue_stats.current_queued_estimate += taken;
+  if (impl->queue_stats.current_queued_estimate > impl->queue_stats.high_water_mark) {
+    impl->queue_stats.high_water_mark = impl->queue_stats.current_queued_estimate;
+  }
+}
+
+rcl_ret_t
+rcl_subscription_get_queue_stats(
+  const rcl_subscription_t * subscription,
+  rcl_subscription_queue_stats_t * stats)
+{
+  if (!rcl_subscription_is_valid(subscription)) {
+    return RCL_RET_SUBSCRIPTION_INVALID;  // error already set
+  }
+  RCL_CHECK_ARGUMENT_FOR_NULL(stats, RCL_RET_INVALID_ARGUMENT);
+  *stats = subscription->impl->queue_stats;
+  return RCL_RET_OK;
+}
+
+/// Hash a publisher GID with FNV-1a, as the remap index does for names.
+static RCL_ALWAYS_INLINE uint64_t
+_rcl_subscription_gid_hash(const rmw_gid_t * gid)
+{
+  uint64_t hash = 0xcbf29ce484222325ULL;
+  for (size_t i = 0; i < RMW_GID_STORAGE_SIZE; ++i) {
+    hash ^= (uint64_t)gid->data[i];
+    hash *= 0x100000001b3ULL;
+  }
+  return hash;
+}
+
+/// Fold a taken sample's publication sequence number into the gap tracker.
+static
+void
+_rcl_subscription_track_sequence(
+  rcl_subscription_impl_t * impl,
+  const rmw_message_info_t * message_info)
+{
+  rcl_subscription_gap_tracker_t * tracker = &impl->gap_tracker;
+  if (NULL == tracker->gids) {
+    return;
+  }
+  const uint64_t sequence = message_info->publication_sequence_number;
+  if (RMW_MESSAGE_INFO_SEQUENCE_NUMBER_UNSUPPORTED == sequence) {
+    return;
+  }
+  size_t slot = (size_t)(
+    _rcl_subscription_gid_hash(&message_info->publisher_gid) % tracker->capacity);
+  for (size_t probed = 0u; probed < tracker->capacity; ++probed) {
+    if (!tracker->occupied[slot]) {
+      // first sample from this publisher establishes the baseline
+      tracker->occupied[slot] = true;
+      tracker->gids[slot] = message_info->publisher_gid;
+      tracker->last_sequence[slot] = sequence;
+      return;
+    }
+    if (0 == memcmp(
+        tracker->gids[slot].data, message_info->publisher_gid.data, RMW_GID_STORAGE_SIZE))
+    {
+      if (sequence > tracker->last_sequence[slot] + 1u) {
+        const uint64_t missed = sequence - tracker->last_sequence[slot] - 1u;
+        tracker->detected_gaps += missed;
+        if (NULL != tracker->callback) {
+          tracker->callback(tracker->user_data, missed);
+        }
+      }
+      if (sequence > tracker->last_sequence[slot]) {
+        tracker->last_sequence[slot] = sequence;
+      }
+      return;
+    }
+    slot = (slot + 1u) % tracker->capacity;
+  }
+  // table already holds max_publishers other GIDs, this one goes untracked
+}
+
+rcl_ret_t
+rcl_subscription_init_gap_tracking(
+  rcl_subscription_t * subscription,
+  size_t max_publishers,
+  rcl_subscription_gap_callback_t callback,
+  const void * user_data)
+{
+  if (!rcl_subscription_is_valid(subscription)) {
+    return RCL_RET_SUBSCRIPTION_INVALID;  // error already set
+  }
+  if (0u == max_publishers) {
+    RCL_SET_ERROR_MSG("max_publishers must be greater than zero");
+    return RCL_RET_INVALID_ARGUMENT;
+  }
+  rcl_subscription_gap_tracker_t * tracker = &subscription->impl->gap_tracker;
+  if (NULL != tracker->gids) {
+    RCL_SET_ERROR_MSG("gap tracking is already initialized");
+    return RCL_RET_ALREADY_INIT;
+  }
+  rcl_allocator_t * allocator = &subscription->impl->options.allocator;
+  tracker->gids = (rmw_gid_t *)allocator->zero_allocate(
+    max_publishers, sizeof(rmw_gid_t), allocator->state);
+  RCL_CHECK_FOR_NULL_WITH_MSG(
+    tracker->gids, "allocating gap tracker keys failed", return RCL_RET_BAD_ALLOC);
+  tracker->occupied = (bool *)allocator->zero_allocate(
+    max_publishers, sizeof(bool), allocator->state);
+  if (NULL == tracker->occupied) {
+    allocator->deallocate(tracker->gids, allocator->state);
+    tracker->gids = NULL;
+    RCL_SET_ERROR_MSG("allocating gap tracker occupancy failed");
+    return RCL_RET_BAD_ALLOC;
+  }
+  tracker->last_sequence = (uint64_t *)allocator->zero_allocate(
+    max_publishers, sizeof(uint64_t), allocator->state);
+  if (NULL == tracker->last_sequence) {
+    allocator->deallocate(tracker->gids, allocator->state);
+    allocator->deallocate(tracker->occupied, allocator->state);
+    tracker->gids = NULL;
+    tracker->occupied = NULL;
+    RCL_SET_ERROR_MSG("allocating gap tracker sequence numbers failed");
+    return RCL_RET_BAD_ALLOC;
+  }
+  tracker->capacity = max_publishers;
+  tracker->detected_gaps = 0u;
+  tracker->callback = callback;
+  tracker->user_data = user_data;
+  return RCL_RET_OK;
+}
+
+rcl_ret_t
+rcl_subscription_fini_gap_tracking(rcl_subscription_t * subscription)
+{
+  if (!rcl_subscription_is_valid(subscription)) {
+    return RCL_RET_SUBSCRIPTION_INVALID;  // error already set
+  }
+  rcl_subscription_gap_tracker_t * tracker = &subscription->impl->gap_tracker;
+  if (NULL == tracker->gids) {
+    return RCL_RET_OK;
+  }
+  rcl_allocator_t * allocator = &subscription->impl->options.allocator;
+  allocator->deallocate(tracker->gids, allocator->state);
+  allocator->deallocate(tracker->occupied, allocator->state);
+  allocator->deallocate(tracker->last_sequence, allocator->state);
+  *tracker = (rcl_subscription_gap_tracker_t) {0};
+  return RCL_RET_OK;
+}
+
+rcl_ret_t
+rcl_subscription_get_detected_gaps(
+  const rcl_subscription_t * subscription,
+  uint64_t * missed_count)
+{
+  if (!rcl_subscription_is_valid(subscription)) {
+    return RCL_RET_SUBSCRIPTION_INVALID;  // error already set
+  }
+  RCL_CHECK_ARGUMENT_FOR_NULL(missed_count, RCL_RET_INVALID_ARGUMENT);
+  *missed_count = subscription->impl->gap_tracker.detected_gaps;
+  return RCL_RET_OK;
+}
+
+rcl_ret_t
+rcl_subscription_get_cost_record(
+  const rcl_subscription_t * subscription,
+  rcl_entity_cost_record_t ** record)
+{
+  if (!rcl_subscription_is_valid(subscription)) {
+    return RCL_RET_SUBSCRIPTION_INVALID;  // error already set
+  }
+  *record = &subscription->impl->cost_record;
+  return RCL_RET_OK;
+}
+
 rcl_ret_t
 rcl_take(
   const rcl_subscription_t * subscription,
@@ -522,10 +961,61 @@ rcl_take(
   }
   RCL_CHECK_ARGUMENT_FOR_NULL(ros_message, RCL_RET_INVALID_ARGUMENT);
 
+  rcutils_time_point_value_t cost_start;
+  const bool cost_active =
+    rcl_entity_cost_record_begin(&subscription->impl->cost_record, &cost_start);
+
   // If message_info is NULL, use a place holder which can be discarded.
   rmw_message_info_t dummy_message_info;
   rmw_message_info_t * message_info_local = message_info ? message_info : &dummy_message_info;
   *message_info_local = rmw_get_zero_initialized_message_info();
+  rcl_subscription_cdr_filter_t * filter = &subscription->impl->cdr_filter;
+  if (filter->active) {
+    // Fallback content filter: take serialized samples, evaluate the compiled
+    // predicate against the raw CDR buffer and deserialize only matches.
+    if (NULL == filter->scratch.allocator.allocate) {
+      rmw_ret_t init_ret = rmw_serialized_message_init(
+        &filter->scratch, 0u, &subscription->impl->options.allocator);
+      if (RMW_RET_OK != init_ret) {
+        RCL_SET_ERROR_MSG(rmw_get_error_string().str);
+        return rcl_convert_rmw_ret_to_rcl_ret(init_ret);
+      }
+    }
+    for (;;) {
+      bool taken = false;
+      rmw_ret_t take_ret = rmw_take_serialized_message_with_info(
+        subscription->impl->rmw_handle, &filter->scratch, &taken, message_info_local,
+        allocation);
+      if (RMW_RET_OK != take_ret) {
+        RCL_SET_ERROR_MSG(rmw_get_error_string().str);
+        return rcl_convert_rmw_ret_to_rcl_ret(take_ret);
+      }
+      if (!taken) {
+        _rcl_subscription_account_take(subscription->impl, 0u);
+        RCL_RETURN_EXPECTED(RCL_RET_SUBSCRIPTION_TAKE_FAILED);
+      }
+      _rcl_subscription_track_sequence(subscription->impl, message_info_local);
+      if (_rcl_subscription_cdr_filter_matches(filter, &filter->scratch)) {
+        break;
+      }
+      // non-matching sample dropped without deserializing it
+    }
+    rmw_ret_t deserialize_ret = rmw_deserialize(
+      &filter->scratch, subscription->impl->type_support, ros_message);
+    if (RMW_RET_OK != deserialize_ret) {
+      RCL_SET_ERROR_MSG(rmw_get_error_string().str);
+      return rcl_convert_rmw_ret_to_rcl_ret(deserialize_ret);
+    }
+    _rcl_subscription_account_take(subscription->impl, 1u);
+    if (cost_active) {
+      rcl_entity_cost_record_commit(&subscription->impl->cost_record, cost_start);
+    }
+    TRACETOOLS_TRACEPOINT(rcl_take, (const void *)ros_message);
+    RCL_TRACEPOINT(
+      RCL_TRACE_EVENT_TAKE, subscription,
+      (int64_t)filter->scratch.buffer_length, 0);
+    return RCL_RET_OK;
+  }
   // Call rmw_take_with_info.
   bool taken = false;
   rmw_ret_t ret = rmw_take_with_info(
@@ -537,8 +1027,15 @@ rcl_take(
   RCUTILS_LOG_DEBUG_NAMED(
     ROS_PACKAGE_NAME, "Subscription take succeeded: %s", taken ? "true" : "false");
   TRACETOOLS_TRACEPOINT(rcl_take, (const void *)ros_message);
+  _rcl_subscription_account_take(subscription->impl, taken ? 1u : 0u);
   if (!taken) {
-    return RCL_RET_SUBSCRIPTION_TAKE_FAILED;
+    RCL_RETURN_EXPECTED(RCL_RET_SUBSCRIPTION_TAKE_FAILED);
+  }
+  // Size 0: typed messages are deserialized below rcl, so the size is unknown here.
+  RCL_TRACEPOINT(RCL_TRACE_EVENT_TAKE, subscription, 0, 0);
+  _rcl_subscription_track_sequence(subscription->impl, message_info_local);
+  if (cost_active) {
+    rcl_entity_cost_record_commit(&subscription->impl->cost_record, cost_start);
   }
   return RCL_RET_OK;
 }
@@ -583,8 +1080,67 @@ rcl_take_sequence(
   }
   RCUTILS_LOG_DEBUG_NAMED(
     ROS_PACKAGE_NAME, "Subscription took %zu messages", taken);
+  _rcl_subscription_account_take(subscription->impl, taken);
+  for (size_t i = 0u; i < taken; ++i) {
+    _rcl_subscription_track_sequence(subscription->impl, &message_info_sequence->data[i]);
+  }
   if (0u == taken) {
-    return RCL_RET_SUBSCRIPTION_TAKE_FAILED;
+    RCL_RETURN_EXPECTED(RCL_RET_SUBSCRIPTION_TAKE_FAILED);
+  }
+  return RCL_RET_OK;
+}
+
+rcl_ret_t
+rcl_take_batch(
+  const rcl_subscription_t * subscription,
+  void ** ros_messages,
+  rmw_message_info_t * message_infos,
+  size_t max_messages,
+  size_t * taken
+)
+{
+  RCUTILS_LOG_DEBUG_NAMED(
+    ROS_PACKAGE_NAME, "Subscription taking batch of up to %zu messages", max_messages);
+  if (!rcl_subscription_is_valid(subscription)) {
+    return RCL_RET_SUBSCRIPTION_INVALID;  // error message already set
+  }
+  RCL_CHECK_ARGUMENT_FOR_NULL(ros_messages, RCL_RET_INVALID_ARGUMENT);
+  RCL_CHECK_ARGUMENT_FOR_NULL(message_infos, RCL_RET_INVALID_ARGUMENT);
+  RCL_CHECK_ARGUMENT_FOR_NULL(taken, RCL_RET_INVALID_ARGUMENT);
+  if (0u == max_messages) {
+    RCL_SET_ERROR_MSG("max_messages must be greater than zero");
+    return RCL_RET_INVALID_ARGUMENT;
+  }
+
+  // Wrap the caller arrays in sequence views so a single rmw_take_sequence
+  // call drains the queue; nothing here allocates or needs finalizing.
+  rmw_message_sequence_t message_sequence;
+  message_sequence.data = ros_messages;
+  message_sequence.size = 0u;
+  message_sequence.capacity = max_messages;
+  message_sequence.allocator = NULL;
+  rmw_message_info_sequence_t message_info_sequence;
+  message_info_sequence.data = message_infos;
+  message_info_sequence.size = 0u;
+  message_info_sequence.capacity = max_messages;
+  message_info_sequence.allocator = NULL;
+
+  *taken = 0u;
+  rmw_ret_t ret = rmw_take_sequence(
+    subscription->impl->rmw_handle, max_messages, &message_sequence, &message_info_sequence,
+    taken, NULL);
+  if (ret != RMW_RET_OK) {
+    RCL_SET_ERROR_MSG(rmw_get_error_string().str);
+    return rcl_convert_rmw_ret_to_rcl_ret(ret);
+  }
+  RCUTILS_LOG_DEBUG_NAMED(
+    ROS_PACKAGE_NAME, "Subscription batch took %zu messages", *taken);
+  _rcl_subscription_account_take(subscription->impl, *taken);
+  for (size_t i = 0u; i < *taken; ++i) {
+    _rcl_subscription_track_sequence(subscription->impl, &message_infos[i]);
+  }
+  if (0u == *taken) {
+    RCL_RETURN_EXPECTED(RCL_RET_SUBSCRIPTION_TAKE_FAILED);
   }
   return RCL_RET_OK;
 }
@@ -616,12 +1172,220 @@ rcl_take_serialized_message(
   }
   RCUTILS_LOG_DEBUG_NAMED(
     ROS_PACKAGE_NAME, "Subscription serialized take succeeded: %s", taken ? "true" : "false");
+  _rcl_subscription_account_take(subscription->impl, taken ? 1u : 0u);
+  if (!taken) {
+    RCL_RETURN_EXPECTED(RCL_RET_SUBSCRIPTION_TAKE_FAILED);
+  }
+  RCL_TRACEPOINT(
+    RCL_TRACE_EVENT_TAKE, subscription,
+    (int64_t)serialized_message->buffer_length, 0);
+  _rcl_subscription_track_sequence(subscription->impl, message_info_local);
+  return RCL_RET_OK;
+}
+
+rcl_ret_t
+rcl_take_arena(
+  const rcl_subscription_t * subscription,
+  rcl_arena_t * arena,
+  void * ros_message,
+  rmw_message_info_t * message_info)
+{
+  RCUTILS_LOG_DEBUG_NAMED(ROS_PACKAGE_NAME, "Subscription taking message into arena");
+  if (!rcl_subscription_is_valid(subscription)) {
+    return RCL_RET_SUBSCRIPTION_INVALID;  // error already set
+  }
+  RCL_CHECK_ARGUMENT_FOR_NULL(arena, RCL_RET_INVALID_ARGUMENT);
+  RCL_CHECK_ARGUMENT_FOR_NULL(ros_message, RCL_RET_INVALID_ARGUMENT);
+  // Stage the serialized sample in arena memory: buffer growth is a pointer
+  // bump and the storage is reclaimed wholesale when the arena is reset, so
+  // no per-take fini is needed (deallocation through the facade is a no-op).
+  rcl_allocator_t arena_allocator = rcl_arena_get_allocator(arena);
+  rcl_serialized_message_t staging = rmw_get_zero_initialized_serialized_message();
+  rmw_ret_t ret = rmw_serialized_message_init(&staging, 0u, &arena_allocator);
+  if (RMW_RET_OK != ret) {
+    RCL_SET_ERROR_MSG(rmw_get_error_string().str);
+    return rcl_convert_rmw_ret_to_rcl_ret(ret);
+  }
+  // If message_info is NULL, use a place holder which can be discarded.
+  rmw_message_info_t dummy_message_info;
+  rmw_message_info_t * message_info_local = message_info ? message_info : &dummy_message_info;
+  *message_info_local = rmw_get_zero_initialized_message_info();
+  bool taken = false;
+  ret = rmw_take_serialized_message_with_info(
+    subscription->impl->rmw_handle, &staging, &taken, message_info_local, NULL);
+  if (RMW_RET_OK != ret) {
+    RCL_SET_ERROR_MSG(rmw_get_error_string().str);
+    return rcl_convert_rmw_ret_to_rcl_ret(ret);
+  }
+  _rcl_subscription_account_take(subscription->impl, taken ? 1u : 0u);
+  if (!taken) {
+    RCL_RETURN_EXPECTED(RCL_RET_SUBSCRIPTION_TAKE_FAILED);
+  }
+  _rcl_subscription_track_sequence(subscription->impl, message_info_local);
+  ret = rmw_deserialize(&staging, subscription->impl->type_support, ros_message);
+  if (RMW_RET_OK != ret) {
+    RCL_SET_ERROR_MSG(rmw_get_error_string().str);
+    return rcl_convert_rmw_ret_to_rcl_ret(ret);
+  }
+  RCUTILS_LOG_DEBUG_NAMED(ROS_PACKAGE_NAME, "Subscription arena take succeeded");
+  return RCL_RET_OK;
+}
+
+rcl_ret_t
+rcl_subscription_init_serialized_lending(
+  rcl_subscription_t * subscription,
+  size_t depth)
+{
+  if (!rcl_subscription_is_valid(subscription)) {
+    return RCL_RET_SUBSCRIPTION_INVALID;  // error already set
+  }
+  if (0u == depth) {
+    RCL_SET_ERROR_MSG("depth must be greater than zero");
+    return RCL_RET_INVALID_ARGUMENT;
+  }
+  rcl_subscription_lent_buffer_pool_t * pool = &subscription->impl->lent_buffers;
+  if (NULL != pool->buffers) {
+    RCL_SET_ERROR_MSG("serialized lending already initialized");
+    return RCL_RET_ALREADY_INIT;
+  }
+  rcl_allocator_t * allocator = &subscription->impl->options.allocator;
+  pool->buffers = (rcl_serialized_message_t *)allocator->zero_allocate(
+    depth, sizeof(rcl_serialized_message_t), allocator->state);
+  RCL_CHECK_FOR_NULL_WITH_MSG(
+    pool->buffers, "allocating lent buffer slots failed", return RCL_RET_BAD_ALLOC);
+  pool->in_use = (bool *)allocator->zero_allocate(
+    depth, sizeof(bool), allocator->state);
+  if (NULL == pool->in_use) {
+    allocator->deallocate(pool->buffers, allocator->state);
+    pool->buffers = NULL;
+    RCL_SET_ERROR_MSG("allocating lent buffer flags failed");
+    return RCL_RET_BAD_ALLOC;
+  }
+  for (size_t i = 0u; i < depth; ++i) {
+    rmw_ret_t rmw_ret = rmw_serialized_message_init(&pool->buffers[i], 0u, allocator);
+    if (RMW_RET_OK != rmw_ret) {
+      while (i > 0u) {
+        rmw_ret_t fini_ret = rmw_serialized_message_fini(&pool->buffers[--i]);
+        (void)fini_ret;
+      }
+      allocator->deallocate(pool->buffers, allocator->state);
+      allocator->deallocate(pool->in_use, allocator->state);
+      pool->buffers = NULL;
+      pool->in_use = NULL;
+      RCL_SET_ERROR_MSG(rmw_get_error_string().str);
+      return rcl_convert_rmw_ret_to_rcl_ret(rmw_ret);
+    }
+  }
+  pool->capacity = depth;
+  return RCL_RET_OK;
+}
+
+rcl_ret_t
+rcl_subscription_fini_serialized_lending(rcl_subscription_t * subscription)
+{
+  RCL_CHECK_ARGUMENT_FOR_NULL(subscription, RCL_RET_SUBSCRIPTION_INVALID);
+  RCL_CHECK_FOR_NULL_WITH_MSG(
+    subscription->impl, "subscription implementation is invalid",
+    return RCL_RET_SUBSCRIPTION_INVALID);
+  rcl_subscription_lent_buffer_pool_t * pool = &subscription->impl->lent_buffers;
+  if (NULL == pool->buffers) {
+    return RCL_RET_OK;
+  }
+  for (size_t i = 0u; i < pool->capacity; ++i) {
+    if (pool->in_use[i]) {
+      RCL_SET_ERROR_MSG("lent serialized buffers are still outstanding");
+      return RCL_RET_ERROR;
+    }
+  }
+  rcl_ret_t result = RCL_RET_OK;
+  for (size_t i = 0u; i < pool->capacity; ++i) {
+    rmw_ret_t rmw_ret = rmw_serialized_message_fini(&pool->buffers[i]);
+    if (RMW_RET_OK != rmw_ret) {
+      RCL_SET_ERROR_MSG(rmw_get_error_string().str);
+      result = RCL_RET_ERROR;
+    }
+  }
+  rcl_allocator_t * allocator = &subscription->impl->options.allocator;
+  allocator->deallocate(pool->buffers, allocator->state);
+  allocator->deallocate(pool->in_use, allocator->state);
+  memset(pool, 0, sizeof(*pool));
+  return result;
+}
+
+rcl_ret_t
+rcl_take_lent_serialized_message(
+  const rcl_subscription_t * subscription,
+  const rcl_serialized_message_t ** serialized_message,
+  rmw_message_info_t * message_info)
+{
+  RCUTILS_LOG_DEBUG_NAMED(ROS_PACKAGE_NAME, "Subscription taking lent serialized message");
+  if (!rcl_subscription_is_valid(subscription)) {
+    return RCL_RET_SUBSCRIPTION_INVALID;  // error already set
+  }
+  RCL_CHECK_ARGUMENT_FOR_NULL(serialized_message, RCL_RET_INVALID_ARGUMENT);
+  rcl_subscription_lent_buffer_pool_t * pool = &subscription->impl->lent_buffers;
+  RCL_CHECK_FOR_NULL_WITH_MSG(
+    pool->buffers, "serialized lending is not initialized, "
+    "call rcl_subscription_init_serialized_lending() first",
+    return RCL_RET_INVALID_ARGUMENT);
+  size_t slot = pool->capacity;
+  for (size_t i = 0u; i < pool->capacity; ++i) {
+    if (!pool->in_use[i]) {
+      slot = i;
+      break;
+    }
+  }
+  if (slot == pool->capacity) {
+    RCL_SET_ERROR_MSG("all lent serialized buffers are outstanding");
+    return RCL_RET_BAD_ALLOC;
+  }
+  // If message_info is NULL, use a place holder which can be discarded.
+  rmw_message_info_t dummy_message_info;
+  rmw_message_info_t * message_info_local = message_info ? message_info : &dummy_message_info;
+  *message_info_local = rmw_get_zero_initialized_message_info();
+  bool taken = false;
+  rmw_ret_t ret = rmw_take_serialized_message_with_info(
+    subscription->impl->rmw_handle, &pool->buffers[slot], &taken, message_info_local, NULL);
+  if (ret != RMW_RET_OK) {
+    RCL_SET_ERROR_MSG(rmw_get_error_string().str);
+    return rcl_convert_rmw_ret_to_rcl_ret(ret);
+  }
+  _rcl_subscription_account_take(subscription->impl, taken ? 1u : 0u);
   if (!taken) {
-    return RCL_RET_SUBSCRIPTION_TAKE_FAILED;
+    RCL_RETURN_EXPECTED(RCL_RET_SUBSCRIPTION_TAKE_FAILED);
   }
+  pool->in_use[slot] = true;
+  *serialized_message = &pool->buffers[slot];
   return RCL_RET_OK;
 }
 
+rcl_ret_t
+rcl_return_lent_serialized_message(
+  const rcl_subscription_t * subscription,
+  const rcl_serialized_message_t * serialized_message)
+{
+  if (!rcl_subscription_is_valid(subscription)) {
+    return RCL_RET_SUBSCRIPTION_INVALID;  // error already set
+  }
+  RCL_CHECK_ARGUMENT_FOR_NULL(serialized_message, RCL_RET_INVALID_ARGUMENT);
+  rcl_subscription_lent_buffer_pool_t * pool = &subscription->impl->lent_buffers;
+  if (NULL != pool->buffers &&
+    serialized_message >= pool->buffers &&
+    serialized_message < pool->buffers + pool->capacity)
+  {
+    size_t slot = (size_t)(serialized_message - pool->buffers);
+    if (!pool->in_use[slot]) {
+      RCL_SET_ERROR_MSG("serialized message was not lent out");
+      return RCL_RET_INVALID_ARGUMENT;
+    }
+    // the slot keeps its grown storage for the next loan
+    pool->in_use[slot] = false;
+    return RCL_RET_OK;
+  }
+  RCL_SET_ERROR_MSG("serialized message does not belong to this subscription");
+  return RCL_RET_INVALID_ARGUMENT;
+}
+
 rcl_ret_t
 rcl_take_dynamic_message(
   const rcl_subscription_t * subscription,
@@ -649,11 +1413,86 @@ rcl_take_dynamic_message(
   RCUTILS_LOG_DEBUG_NAMED(
     ROS_PACKAGE_NAME, "Subscription dynamic take succeeded: %s", taken ? "true" : "false");
   if (!taken) {
-    return RCL_RET_SUBSCRIPTION_TAKE_FAILED;
+    RCL_RETURN_EXPECTED(RCL_RET_SUBSCRIPTION_TAKE_FAILED);
   }
   return RCL_RET_OK;
 }
 
+/// Return true if the message points into the subscription's fallback loan pool.
+static bool
+_rcl_subscription_loan_pool_owns(
+  const rcl_subscription_impl_t * impl, const void * ros_message)
+{
+  const uint8_t * block = (const uint8_t *)ros_message;
+  return NULL != impl->loan_pool.storage &&
+         block >= impl->loan_pool.storage &&
+         block < impl->loan_pool.storage + impl->loan_pool.capacity * impl->loan_pool.block_size;
+}
+
+rcl_ret_t
+rcl_subscription_init_loan_pool(
+  rcl_subscription_t * subscription,
+  size_t message_size,
+  size_t capacity)
+{
+  if (!rcl_subscription_is_valid(subscription)) {
+    return RCL_RET_SUBSCRIPTION_INVALID;  // error already set
+  }
+  if (0u == message_size || 0u == capacity) {
+    RCL_SET_ERROR_MSG("message_size and capacity must be greater than zero");
+    return RCL_RET_INVALID_ARGUMENT;
+  }
+  rcl_subscription_loan_pool_t * pool = &subscription->impl->loan_pool;
+  if (NULL != pool->storage) {
+    RCL_SET_ERROR_MSG("loan pool already initialized");
+    return RCL_RET_ALREADY_INIT;
+  }
+  rcl_allocator_t * allocator = &subscription->impl->options.allocator;
+  // Round each block up so every block starts suitably aligned for any type.
+  size_t block_size = (message_size + 15u) & ~(size_t)15u;
+  pool->free_blocks = (void **)allocator->allocate(
+    capacity * sizeof(void *), allocator->state);
+  RCL_CHECK_FOR_NULL_WITH_MSG(
+    pool->free_blocks, "allocating loan pool free list failed", return RCL_RET_BAD_ALLOC);
+  pool->storage = (uint8_t *)allocator->zero_allocate(
+    capacity, block_size, allocator->state);
+  if (NULL == pool->storage) {
+    allocator->deallocate(pool->free_blocks, allocator->state);
+    pool->free_blocks = NULL;
+    RCL_SET_ERROR_MSG("allocating loan pool storage failed");
+    return RCL_RET_BAD_ALLOC;
+  }
+  pool->block_size = block_size;
+  pool->capacity = capacity;
+  pool->num_free = capacity;
+  for (size_t i = 0; i < capacity; ++i) {
+    pool->free_blocks[i] = pool->storage + i * block_size;
+  }
+  return RCL_RET_OK;
+}
+
+rcl_ret_t
+rcl_subscription_fini_loan_pool(rcl_subscription_t * subscription)
+{
+  RCL_CHECK_ARGUMENT_FOR_NULL(subscription, RCL_RET_SUBSCRIPTION_INVALID);
+  RCL_CHECK_FOR_NULL_WITH_MSG(
+    subscription->impl, "subscription implementation is invalid",
+    return RCL_RET_SUBSCRIPTION_INVALID);
+  rcl_subscription_loan_pool_t * pool = &subscription->impl->loan_pool;
+  if (NULL == pool->storage) {
+    return RCL_RET_OK;
+  }
+  if (pool->num_free != pool->capacity) {
+    RCL_SET_ERROR_MSG("loaned messages from the pool are still outstanding");
+    return RCL_RET_ERROR;
+  }
+  rcl_allocator_t * allocator = &subscription->impl->options.allocator;
+  allocator->deallocate(pool->storage, allocator->state);
+  allocator->deallocate(pool->free_blocks, allocator->state);
+  memset(pool, 0, sizeof(*pool));
+  return RCL_RET_OK;
+}
+
 rcl_ret_t
 rcl_take_loaned_message(
   const rcl_subscription_t * subscription,
@@ -674,6 +1513,34 @@ rcl_take_loaned_message(
   rmw_message_info_t dummy_message_info;
   rmw_message_info_t * message_info_local = message_info ? message_info : &dummy_message_info;
   *message_info_local = rmw_get_zero_initialized_message_info();
+  rcl_subscription_loan_pool_t * pool = &subscription->impl->loan_pool;
+  if (NULL != pool->storage && !subscription->impl->rmw_handle->can_loan_messages) {
+    // Fallback path: take into a pool block so the app keeps loan semantics
+    // even though the middleware cannot lend its own memory.
+    if (0u == pool->num_free) {
+      RCL_SET_ERROR_MSG("subscription loan pool is exhausted");
+      return RCL_RET_BAD_ALLOC;
+    }
+    void * block = pool->free_blocks[--pool->num_free];
+    // Blocks are handed out zeroed; the pool only supports self-contained
+    // (plain-old-data) message types, see rcl_subscription_init_loan_pool().
+    memset(block, 0, pool->block_size);
+    bool taken = false;
+    rmw_ret_t ret = rmw_take_with_info(
+      subscription->impl->rmw_handle, block, &taken, message_info_local, allocation);
+    if (ret != RMW_RET_OK || !taken) {
+      pool->free_blocks[pool->num_free++] = block;
+      if (ret != RMW_RET_OK) {
+        RCL_SET_ERROR_MSG(rmw_get_error_string().str);
+        return rcl_convert_rmw_ret_to_rcl_ret(ret);
+      }
+      _rcl_subscription_account_take(subscription->impl, 0u);
+      RCL_RETURN_EXPECTED(RCL_RET_SUBSCRIPTION_TAKE_FAILED);
+    }
+    _rcl_subscription_account_take(subscription->impl, 1u);
+    *loaned_message = block;
+    return RCL_RET_OK;
+  }
   // Call rmw_take_with_info.
   bool taken = false;
   rmw_ret_t ret = rmw_take_loaned_message_with_info(
@@ -684,8 +1551,9 @@ rcl_take_loaned_message(
   }
   RCUTILS_LOG_DEBUG_NAMED(
     ROS_PACKAGE_NAME, "Subscription loaned take succeeded: %s", taken ? "true" : "false");
+  _rcl_subscription_account_take(subscription->impl, taken ? 1u : 0u);
   if (!taken) {
-    return RCL_RET_SUBSCRIPTION_TAKE_FAILED;
+    RCL_RETURN_EXPECTED(RCL_RET_SUBSCRIPTION_TAKE_FAILED);
   }
   return RCL_RET_OK;
 }
@@ -700,9 +1568,17 @@ rcl_return_loaned_message_from_subscription(
     return RCL_RET_SUBSCRIPTION_INVALID;  // error already set
   }
   RCL_CHECK_ARGUMENT_FOR_NULL(loaned_message, RCL_RET_INVALID_ARGUMENT);
-  return rcl_convert_rmw_ret_to_rcl_ret(
-    rmw_return_loaned_message_from_subscription(
-      subscription->impl->rmw_handle, loaned_message));
+  if (_rcl_subscription_loan_pool_owns(subscription->impl, loaned_message)) {
+    rcl_subscription_loan_pool_t * pool = &subscription->impl->loan_pool;
+    pool->free_blocks[pool->num_free++] = loaned_message;
+    return RCL_RET_OK;
+  }
+  rmw_ret_t rmw_ret = rmw_return_loaned_message_from_subscription(
+    subscription->impl->rmw_handle, loaned_message);
+  if (RCL_LIKELY(RMW_RET_OK == rmw_ret)) {
+    return RCL_RET_OK;
+  }
+  return rcl_convert_rmw_ret_to_rcl_ret(rmw_ret);
 }
 
 const char *
@@ -757,6 +1633,12 @@ rcl_subscription_get_publisher_count(
     return RCL_RET_SUBSCRIPTION_INVALID;
   }
   RCL_CHECK_ARGUMENT_FOR_NULL(publisher_count, RCL_RET_INVALID_ARGUMENT);
+  if (subscription->impl->matched_count_cached) {
+    // a matched QoS event keeps the cache current, no need to ask the rmw layer
+    *publisher_count = (size_t)rcutils_atomic_load_uint64_t(
+      &subscription->impl->matched_publisher_count);
+    return RCL_RET_OK;
+  }
   rmw_ret_t ret = rmw_subscription_count_matched_publishers(
     subscription->impl->rmw_handle, publisher_count);
 
@@ -787,6 +1669,11 @@ rcl_subscription_can_loan_messages(const rcl_subscription_t * subscription)
     return false;
   }
 
+  if (NULL != subscription->impl->loan_pool.storage) {
+    // the fallback pool provides loan semantics regardless of the rmw layer
+    return true;
+  }
+
   return subscription->impl->rmw_handle->can_loan_messages;
 }
 
@@ -801,12 +1688,98 @@ rcl_subscription_set_on_new_message_callback(
     return RCL_RET_INVALID_ARGUMENT;
   }
 
+  // a plain callback replaces any coalesced one
+  subscription->impl->coalescing.active = false;
+
   return rmw_subscription_set_on_new_message_callback(
     subscription->impl->rmw_handle,
     callback,
     user_data);
 }
 
+/// Deliver the accumulated count to the user callback, if any is pending.
+static void
+_rcl_subscription_deliver_coalesced(rcl_subscription_impl_t * impl)
+{
+  uint64_t pending = 0u;
+  rcutils_atomic_exchange(&impl->coalescing.pending_count, pending, 0u);
+  if (0u == pending) {
+    return;
+  }
+  impl->coalescing.user_callback(impl->coalescing.user_data, (size_t)pending);
+}
+
+/// Trampoline installed at the rmw layer for coalesced callbacks.
+static void
+_rcl_subscription_coalesced_new_message_callback(
+  const void * user_data, size_t number_of_events)
+{
+  rcl_subscription_impl_t * impl = (rcl_subscription_impl_t *)(uintptr_t)user_data;
+  rcutils_atomic_fetch_add_uint64_t(
+    &impl->coalescing.pending_count, (uint64_t)number_of_events);
+  rcutils_time_point_value_t now;
+  if (RCUTILS_RET_OK != rcutils_steady_time_now(&now)) {
+    return;  // count stays pending for a later arrival or an explicit flush
+  }
+  uint64_t last = rcutils_atomic_load_uint64_t(&impl->coalescing.last_fire_ns);
+  if ((uint64_t)now - last < impl->coalescing.interval_ns) {
+    return;  // rate limited, the count keeps accumulating
+  }
+  bool exchanged = false;
+  uint64_t expected = last;
+  rcutils_atomic_compare_exchange_strong(
+    &impl->coalescing.last_fire_ns, exchanged, &expected, (uint64_t)now);
+  if (!exchanged) {
+    return;  // a concurrent arrival won the slot and delivers the count
+  }
+  _rcl_subscription_deliver_coalesced(impl);
+}
+
+rcl_ret_t
+rcl_subscription_set_on_new_message_callback_coalesced(
+  const rcl_subscription_t * subscription,
+  rcl_event_callback_t callback,
+  const void * user_data,
+  uint64_t interval_ns)
+{
+  if (!rcl_subscription_is_valid(subscription)) {
+    // error state already set
+    return RCL_RET_INVALID_ARGUMENT;
+  }
+  rcl_subscription_impl_t * impl = subscription->impl;
+  if (NULL == callback) {
+    impl->coalescing.active = false;
+    return rmw_subscription_set_on_new_message_callback(impl->rmw_handle, NULL, NULL);
+  }
+  impl->coalescing.user_callback = callback;
+  impl->coalescing.user_data = user_data;
+  impl->coalescing.interval_ns = interval_ns;
+  rcutils_atomic_store(&impl->coalescing.pending_count, (uint64_t)0);
+  rcutils_atomic_store(&impl->coalescing.last_fire_ns, (uint64_t)0);
+  impl->coalescing.active = true;
+  rcl_ret_t ret = rmw_subscription_set_on_new_message_callback(
+    impl->rmw_handle, _rcl_subscription_coalesced_new_message_callback, impl);
+  if (RCL_RET_OK != ret) {
+    impl->coalescing.active = false;
+  }
+  return ret;
+}
+
+rcl_ret_t
+rcl_subscription_flush_coalesced_callback(const rcl_subscription_t * subscription)
+{
+  if (!rcl_subscription_is_valid(subscription)) {
+    // error state already set
+    return RCL_RET_INVALID_ARGUMENT;
+  }
+  if (!subscription->impl->coalescing.active) {
+    RCL_SET_ERROR_MSG("no coalesced callback is installed");
+    return RCL_RET_INVALID_ARGUMENT;
+  }
+  _rcl_subscription_deliver_coalesced(subscription->impl);
+  return RCL_RET_OK;
+}
+
 #ifdef __cplusplus
 }
 #endif
@@ -15,15 +15,136 @@
 #ifndef RCL__SUBSCRIPTION_IMPL_H_
 #define RCL__SUBSCRIPTION_IMPL_H_
 
+#include <stdint.h>
+
+#include "rcutils/stdatomic_helper.h"
+#include "rmw/network_flow_endpoint_array.h"
 #include "rmw/rmw.h"
 
 #include "rcl/subscription.h"
 
+#include "./entity_cost_impl.h"
+
+struct rcl_intra_process_sub_entry_s;
+
+/// Compiled fallback content filter, evaluated against serialized samples.
+/**
+ * Used when the rmw layer has no content filtering of its own: the filter
+ * expression is compiled once into an offset-addressed predicate and each
+ * incoming sample is checked against the raw CDR buffer before the message
+ * is deserialized.
+ */
+typedef struct rcl_subscription_cdr_filter_s
+{
+  /// True while the fallback engine is engaged.
+  bool active;
+  /// Byte offset of the field within the CDR body (after the encapsulation header).
+  size_t offset;
+  /// Field width in bytes, one of 1, 2, 4 or 8.
+  size_t width;
+  /// One of the _RCL_CDR_FILTER_OP_* comparison codes.
+  uint8_t op;
+  /// Constant the field is compared against, sign-extended.
+  int64_t operand;
+  /// Scratch buffer the filtered take path deserializes from.
+  rcl_serialized_message_t scratch;
+} rcl_subscription_cdr_filter_t;
+
+/// State for the coalescing new-message callback trampoline.
+/**
+ * Arrival counts accumulate in pending_count and the user callback fires at
+ * most once per interval_ns of steady time, carrying the accumulated total.
+ */
+typedef struct rcl_subscription_callback_coalescing_s
+{
+  /// True while a coalesced callback is installed.
+  bool active;
+  rcl_event_callback_t user_callback;
+  const void * user_data;
+  /// Minimum steady-time gap between callback invocations.
+  uint64_t interval_ns;
+  /// Events accumulated since the callback last fired.
+  atomic_uint_least64_t pending_count;
+  /// Steady timestamp of the last delivery, used as the rate-limit gate.
+  atomic_uint_least64_t last_fire_ns;
+} rcl_subscription_callback_coalescing_t;
+
+/// Pool of retained serialized buffers handed out by the lending take path.
+/**
+ * Each slot is a serialized message whose backing storage is kept across
+ * loans, so once the pool has warmed up to the topic's sample size the
+ * lending take path performs no allocations.
+ */
+typedef struct rcl_subscription_lent_buffer_pool_s
+{
+  /// Slot storage, NULL while the pool is not initialized.
+  rcl_serialized_message_t * buffers;
+  /// Marks slots currently lent to the application.
+  bool * in_use;
+  size_t capacity;
+} rcl_subscription_lent_buffer_pool_t;
+
+/// Open-addressing table of last-seen publication sequence numbers.
+/**
+ * Keyed by publisher GID with linear probing; lets the take path detect
+ * skipped sequence numbers without an application-level counter field.
+ */
+typedef struct rcl_subscription_gap_tracker_s
+{
+  /// Slot keys, NULL while gap tracking is not enabled.
+  rmw_gid_t * gids;
+  /// Marks slots holding a tracked publisher.
+  bool * occupied;
+  /// Last publication sequence number seen per slot.
+  uint64_t * last_sequence;
+  size_t capacity;
+  /// Total samples skipped across all tracked publishers.
+  uint64_t detected_gaps;
+  /// Invoked on each detected gap, NULL for counting only.
+  rcl_subscription_gap_callback_t callback;
+  const void * user_data;
+} rcl_subscription_gap_tracker_t;
+
+/// Fixed-size message pool backing loaned takes when the rmw layer cannot.
+typedef struct rcl_subscription_loan_pool_s
+{
+  /// Contiguous storage for all blocks, NULL while the pool is not initialized.
+  uint8_t * storage;
+  /// Stack of currently available blocks.
+  void ** free_blocks;
+  /// Size of one block, rounded up for alignment.
+  size_t block_size;
+  size_t capacity;
+  size_t num_free;
+} rcl_subscription_loan_pool_t;
+
 struct rcl_subscription_impl_s
 {
   rcl_subscription_options_t options;
   rmw_qos_profile_t actual_qos;
   rmw_subscription_t * rmw_handle;
+  rcl_subscription_loan_pool_t loan_pool;
+  const rosidl_message_type_support_t * type_support;
+  rcl_subscription_cdr_filter_t cdr_filter;
+  rcl_subscription_lent_buffer_pool_t lent_buffers;
+  rcl_subscription_queue_stats_t queue_stats;
+  rcl_subscription_callback_coalescing_t coalescing;
+  rcl_subscription_gap_tracker_t gap_tracker;
+  /// Take-cost accounting counters, see rcl_entity_get_cost_estimate().
+  rcl_entity_cost_record_t cost_record;
+  /// Intra-process delivery endpoint, NULL unless
+  /// rcl_subscription_enable_intra_process() was called.
+  struct rcl_intra_process_sub_entry_s * intra_process;
+  /// Cached network flow endpoint view, see
+  /// rcl_subscription_get_cached_network_flow_endpoints().
+  rmw_network_flow_endpoint_array_t network_flow_cache;
+  bool network_flow_cache_valid;
+  /// True when a matched QoS event signaled the cached flows may be outdated.
+  bool network_flow_cache_stale;
+  /// True while a matched QoS event keeps matched_publisher_count current.
+  bool matched_count_cached;
+  /// Cached matched-publisher count, refreshed by taken matched events.
+  atomic_uint_least64_t matched_publisher_count;
 };
 
 #endif  // RCL__SUBSCRIPTION_IMPL_H_
@@ -0,0 +1,436 @@
+// Copyright 2026 Open Source Robotics Foundation, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+#include "rcl/take_pipeline.h"
+
+#include "rcl/error_handling.h"
+#include "rcutils/stdatomic_helper.h"
+#include "rmw/rmw.h"
+
+#include "./common.h"
+#include "./subscription_impl.h"
+
+/// One cell of a bounded index ring; the sequence field drives the
+/// lock-free claim protocol, matching the other bounded rings in rcl.
+typedef struct rcl_take_pipeline_cell_s
+{
+  atomic_uint_least64_t sequence;
+  size_t slot_index;
+} rcl_take_pipeline_cell_t;
+
+/// Bounded MPMC ring of slot indices.
+/**
+ * Each slot index lives in exactly one of the three rings (or is lent to
+ * the consumer), so a push can never find the ring full.
+ */
+typedef struct rcl_take_pipeline_ring_s
+{
+  rcl_take_pipeline_cell_t * cells;
+  /// Capacity minus one; the capacity is a power of two.
+  uint64_t mask;
+  atomic_uint_least64_t head;
+  atomic_uint_least64_t tail;
+} rcl_take_pipeline_ring_t;
+
+/// One pipeline slot, cycling free -> staged -> ready -> lent -> free.
+typedef struct rcl_take_pipeline_slot_s
+{
+  /// Staging buffer the pump takes into; retained across laps so the
+  /// middleware stops reallocating once it fits the topic's sample size.
+  rcl_serialized_message_t serialized_message;
+  rmw_message_info_t message_info;
+  /// Caller-owned deserialized message storage for this slot.
+  void * ros_message;
+} rcl_take_pipeline_slot_t;
+
+struct rcl_take_pipeline_impl_s
+{
+  rcl_allocator_t allocator;
+  const rcl_subscription_t * subscription;
+  rcl_take_pipeline_slot_t * slots;
+  size_t depth;
+  /// Indices of slots available to the pump.
+  rcl_take_pipeline_ring_t free_ring;
+  /// Indices of slots holding a serialized sample awaiting decode.
+  rcl_take_pipeline_ring_t staged_ring;
+  /// Indices of slots holding a deserialized message awaiting dispatch.
+  rcl_take_pipeline_ring_t ready_ring;
+  /// Triggered once per decoded message so the consuming wait set wakes.
+  rcl_guard_condition_t guard_condition;
+};
+
+static rcl_ret_t
+_rcl_take_pipeline_ring_init(
+  rcl_take_pipeline_ring_t * ring,
+  size_t capacity,
+  const rcl_allocator_t * allocator)
+{
+  // round the capacity up to a power of two for mask addressing
+  uint64_t rounded = 1;
+  while (rounded < (uint64_t)capacity) {
+    rounded <<= 1;
+  }
+  ring->cells = allocator->zero_allocate(
+    (size_t)rounded, sizeof(rcl_take_pipeline_cell_t), allocator->state);
+  if (NULL == ring->cells) {
+    RCL_SET_ERROR_MSG("allocating memory failed");
+    return RCL_RET_BAD_ALLOC;
+  }
+  for (uint64_t i = 0; i < rounded; ++i) {
+    atomic_init(&ring->cells[i].sequence, i);
+  }
+  ring->mask = rounded - 1;
+  atomic_init(&ring->head, 0);
+  atomic_init(&ring->tail, 0);
+  return RCL_RET_OK;
+}
+
+static void
+_rcl_take_pipeline_ring_fini(
+  rcl_take_pipeline_ring_t * ring,
+  const rcl_allocator_t * allocator)
+{
+  if (NULL != ring->cells) {
+    allocator->deallocate(ring->cells, allocator->state);
+    ring->cells = NULL;
+  }
+}
+
+/// Push a slot index; cannot fail because every index is in one ring at most.
+static void
+_rcl_take_pipeline_ring_push(rcl_take_pipeline_ring_t * ring, size_t slot_index)
+{
+  rcl_take_pipeline_cell_t * cell = NULL;
+  uint64_t pos = rcutils_atomic_load_uint64_t(&ring->head);
+  for (;;) {
+    cell = &ring->cells[pos & ring->mask];
+    uint64_t seq = rcutils_atomic_load_uint64_t(&cell->sequence);
+    int64_t dif = (int64_t)seq - (int64_t)pos;
+    if (0 == dif) {
+      bool exchanged = false;
+      uint64_t expected = pos;
+      rcutils_atomic_compare_exchange_strong(&ring->head, exchanged, &expected, pos + 1);
+      if (exchanged) {
+        break;
+      }
+      pos = expected;
+    } else {
+      pos = rcutils_atomic_load_uint64_t(&ring->head);
+    }
+  }
+  cell->slot_index = slot_index;
+  // Mark the cell ready for the consumers.
+  rcutils_atomic_store(&cell->sequence, pos + 1);
+}
+
+/// Pop a slot index, returning false when the ring is empty.
+static bool
+_rcl_take_pipeline_ring_pop(rcl_take_pipeline_ring_t * ring, size_t * slot_index)
+{
+  rcl_take_pipeline_cell_t * cell = NULL;
+  uint64_t pos = rcutils_atomic_load_uint64_t(&ring->tail);
+  for (;;) {
+    cell = &ring->cells[pos & ring->mask];
+    uint64_t seq = rcutils_atomic_load_uint64_t(&cell->sequence);
+    int64_t dif = (int64_t)seq - (int64_t)(pos + 1);
+    if (0 == dif) {
+      bool exchanged = false;
+      uint64_t expected = pos;
+      rcutils_atomic_compare_exchange_strong(&ring->tail, exchanged, &expected, pos + 1);
+      if (exchanged) {
+        break;
+      }
+      pos = expected;
+    } else if (dif < 0) {
+      return false;
+    } else {
+      pos = rcutils_atomic_load_uint64_t(&ring->tail);
+    }
+  }
+  *slot_index = cell->slot_index;
+  // Recycle the cell for the producers one lap ahead.
+  rcutils_atomic_store(&cell->sequence, pos + ring->mask + 1);
+  return true;
+}
+
+rcl_take_pipeline_t
+rcl_get_zero_initialized_take_pipeline(void)
+{
+  static rcl_take_pipeline_t null_take_pipeline = {0};
+  return null_take_pipeline;
+}
+
+rcl_ret_t
+rcl_take_pipeline_init(
+  rcl_take_pipeline_t * pipeline,
+  const rcl_subscription_t * subscription,
+  rcl_context_t * context,
+  void ** ros_messages,
+  size_t depth,
+  rcl_allocator_t allocator)
+{
+  RCL_CHECK_ARGUMENT_FOR_NULL(pipeline, RCL_RET_INVALID_ARGUMENT);
+  if (!rcl_subscription_is_valid(subscription)) {
+    return RCL_RET_SUBSCRIPTION_INVALID;  // error already set
+  }
+  RCL_CHECK_ARGUMENT_FOR_NULL(context, RCL_RET_INVALID_ARGUMENT);
+  RCL_CHECK_ARGUMENT_FOR_NULL(ros_messages, RCL_RET_INVALID_ARGUMENT);
+  RCL_CHECK_ALLOCATOR_WITH_MSG(&allocator, "invalid allocator", return RCL_RET_INVALID_ARGUMENT);
+  if (0 == depth) {
+    RCL_SET_ERROR_MSG("depth must be non-zero");
+    return RCL_RET_INVALID_ARGUMENT;
+  }
+  for (size_t i = 0; i < depth; ++i) {
+    if (NULL == ros_messages[i]) {
+      RCL_SET_ERROR_MSG("ros_messages contains a null message");
+      return RCL_RET_INVALID_ARGUMENT;
+    }
+  }
+  if (NULL != pipeline->impl) {
+    RCL_SET_ERROR_MSG("take pipeline already initialized, or memory was uninitialized");
+    return RCL_RET_ALREADY_INIT;
+  }
+  rcl_take_pipeline_impl_t * impl = allocator.zero_allocate(
+    1, sizeof(rcl_take_pipeline_impl_t), allocator.state);
+  if (NULL == impl) {
+    RCL_SET_ERROR_MSG("allocating memory failed");
+    return RCL_RET_BAD_ALLOC;
+  }
+  impl->allocator = allocator;
+  impl->subscription = subscription;
+  impl->depth = depth;
+
+  rcl_ret_t ret = RCL_RET_OK;
+  size_t serialized_initialized = 0;
+
+  impl->slots = allocator.zero_allocate(
+    depth, sizeof(rcl_take_pipeline_slot_t), allocator.state);
+  if (NULL == impl->slots) {
+    RCL_SET_ERROR_MSG("allocating memory failed");
+    ret = RCL_RET_BAD_ALLOC;
+    goto fail;
+  }
+  for (size_t i = 0; i < depth; ++i) {
+    rmw_ret_t rmw_ret = rmw_serialized_message_init(
+      &impl->slots[i].serialized_message, 0u, &allocator);
+    if (RMW_RET_OK != rmw_ret) {
+      RCL_SET_ERROR_MSG(rmw_get_error_string().str);
+      ret = rcl_convert_rmw_ret_to_rcl_ret(rmw_ret);
+      goto fail;
+    }
+    ++serialized_initialized;
+    impl->slots[i].ros_message = ros_messages[i];
+  }
+
+  ret = _rcl_take_pipeline_ring_init(&impl->free_ring, depth, &allocator);
+  if (RCL_RET_OK != ret) {
+    goto fail;  // error already set
+  }
+  ret = _rcl_take_pipeline_ring_init(&impl->staged_ring, depth, &allocator);
+  if (RCL_RET_OK != ret) {
+    goto fail;  // error already set
+  }
+  ret = _rcl_take_pipeline_ring_init(&impl->ready_ring, depth, &allocator);
+  if (RCL_RET_OK != ret) {
+    goto fail;  // error already set
+  }
+
+  impl->guard_condition = rcl_get_zero_initialized_guard_condition();
+  rcl_guard_condition_options_t guard_condition_options =
+    rcl_guard_condition_get_default_options();
+  guard_condition_options.allocator = allocator;
+  ret = rcl_guard_condition_init(&impl->guard_condition, context, guard_condition_options);
+  if (RCL_RET_OK != ret) {
+    goto fail;  // error already set
+  }
+
+  // every slot starts out available to the pump
+  for (size_t i = 0; i < depth; ++i) {
+    _rcl_take_pipeline_ring_push(&impl->free_ring, i);
+  }
+
+  pipeline->impl = impl;
+  return RCL_RET_OK;
+
+fail:
+  _rcl_take_pipeline_ring_fini(&impl->ready_ring, &allocator);
+  _rcl_take_pipeline_ring_fini(&impl->staged_ring, &allocator);
+  _rcl_take_pipeline_ring_fini(&impl->free_ring, &allocator);
+  if (NULL != impl->slots) {
+    for (size_t i = 0; i < serialized_initialized; ++i) {
+      rmw_ret_t rmw_ret = rmw_serialized_message_fini(&impl->slots[i].serialized_message);
+      if (RMW_RET_OK != rmw_ret) {
+        RCUTILS_SAFE_FWRITE_TO_STDERR(
+          "failed to fini serialized message while handling init failure\n");
+      }
+    }
+    allocator.deallocate(impl->slots, allocator.state);
+  }
+  allocator.deallocate(impl, allocator.state);
+  return ret;
+}
+
+rcl_ret_t
+rcl_take_pipeline_fini(rcl_take_pipeline_t * pipeline)
+{
+  RCL_CHECK_ARGUMENT_FOR_NULL(pipeline, RCL_RET_INVALID_ARGUMENT);
+  if (NULL == pipeline->impl) {
+    return RCL_RET_OK;
+  }
+  rcl_take_pipeline_impl_t * impl = pipeline->impl;
+  rcl_allocator_t allocator = impl->allocator;
+  rcl_ret_t ret = rcl_guard_condition_fini(&impl->guard_condition);
+  for (size_t i = 0; i < impl->depth; ++i) {
+    rmw_ret_t rmw_ret = rmw_serialized_message_fini(&impl->slots[i].serialized_message);
+    if (RMW_RET_OK != rmw_ret && RCL_RET_OK == ret) {
+      RCL_SET_ERROR_MSG(rmw_get_error_string().str);
+      ret = RCL_RET_ERROR;
+    }
+  }
+  _rcl_take_pipeline_ring_fini(&impl->ready_ring, &allocator);
+  _rcl_take_pipeline_ring_fini(&impl->staged_ring, &allocator);
+  _rcl_take_pipeline_ring_fini(&impl->free_ring, &allocator);
+  allocator.deallocate(impl->slots, allocator.state);
+  allocator.deallocate(impl, allocator.state);
+  pipeline->impl = NULL;
+  return ret;
+}
+
+rcl_ret_t
+rcl_take_pipeline_pump(rcl_take_pipeline_t * pipeline, size_t * taken)
+{
+  RCL_CHECK_ARGUMENT_FOR_NULL(pipeline, RCL_RET_INVALID_ARGUMENT);
+  RCL_CHECK_ARGUMENT_FOR_NULL(taken, RCL_RET_INVALID_ARGUMENT);
+  RCL_CHECK_FOR_NULL_WITH_MSG(
+    pipeline->impl, "take pipeline is not initialized", return RCL_RET_NOT_INIT);
+  rcl_take_pipeline_impl_t * impl = pipeline->impl;
+  *taken = 0;
+  size_t slot_index = 0;
+  while (_rcl_take_pipeline_ring_pop(&impl->free_ring, &slot_index)) {
+    rcl_take_pipeline_slot_t * slot = &impl->slots[slot_index];
+    rcl_ret_t ret = rcl_take_serialized_message(
+      impl->subscription, &slot->serialized_message, &slot->message_info, NULL);
+    if (RCL_RET_OK != ret) {
+      // hand the slot back before reporting; the buffer stays warm
+      _rcl_take_pipeline_ring_push(&impl->free_ring, slot_index);
+      if (RCL_RET_SUBSCRIPTION_TAKE_FAILED == ret) {
+        break;  // middleware queue drained
+      }
+      return ret;  // error already set
+    }
+    _rcl_take_pipeline_ring_push(&impl->staged_ring, slot_index);
+    ++(*taken);
+  }
+  if (0 == *taken) {
+    RCL_RETURN_EXPECTED(RCL_RET_SUBSCRIPTION_TAKE_FAILED);
+  }
+  return RCL_RET_OK;
+}
+
+rcl_ret_t
+rcl_take_pipeline_decode(rcl_take_pipeline_t * pipeline, size_t * decoded)
+{
+  RCL_CHECK_ARGUMENT_FOR_NULL(pipeline, RCL_RET_INVALID_ARGUMENT);
+  RCL_CHECK_ARGUMENT_FOR_NULL(decoded, RCL_RET_INVALID_ARGUMENT);
+  RCL_CHECK_FOR_NULL_WITH_MSG(
+    pipeline->impl, "take pipeline is not initialized", return RCL_RET_NOT_INIT);
+  rcl_take_pipeline_impl_t * impl = pipeline->impl;
+  *decoded = 0;
+  size_t slot_index = 0;
+  while (_rcl_take_pipeline_ring_pop(&impl->staged_ring, &slot_index)) {
+    rcl_take_pipeline_slot_t * slot = &impl->slots[slot_index];
+    rmw_ret_t rmw_ret = rmw_deserialize(
+      &slot->serialized_message,
+      impl->subscription->impl->type_support,
+      slot->ros_message);
+    if (RMW_RET_OK != rmw_ret) {
+      // drop the sample but keep the slot in rotation
+      _rcl_take_pipeline_ring_push(&impl->free_ring, slot_index);
+      RCL_SET_ERROR_MSG(rmw_get_error_string().str);
+      return RCL_RET_ERROR;
+    }
+    _rcl_take_pipeline_ring_push(&impl->ready_ring, slot_index);
+    ++(*decoded);
+    rcl_ret_t ret = rcl_trigger_guard_condition(&impl->guard_condition);
+    if (RCL_RET_OK != ret) {
+      return ret;  // error already set
+    }
+  }
+  if (0 == *decoded) {
+    RCL_RETURN_EXPECTED(RCL_RET_SUBSCRIPTION_TAKE_FAILED);
+  }
+  return RCL_RET_OK;
+}
+
+rcl_ret_t
+rcl_take_pipeline_take_message(
+  rcl_take_pipeline_t * pipeline,
+  void ** ros_message,
+  rmw_message_info_t * message_info)
+{
+  RCL_CHECK_ARGUMENT_FOR_NULL(pipeline, RCL_RET_INVALID_ARGUMENT);
+  RCL_CHECK_ARGUMENT_FOR_NULL(ros_message, RCL_RET_INVALID_ARGUMENT);
+  RCL_CHECK_FOR_NULL_WITH_MSG(
+    pipeline->impl, "take pipeline is not initialized", return RCL_RET_NOT_INIT);
+  rcl_take_pipeline_impl_t * impl = pipeline->impl;
+  size_t slot_index = 0;
+  if (!_rcl_take_pipeline_ring_pop(&impl->ready_ring, &slot_index)) {
+    RCL_RETURN_EXPECTED(RCL_RET_SUBSCRIPTION_TAKE_FAILED);
+  }
+  rcl_take_pipeline_slot_t * slot = &impl->slots[slot_index];
+  *ros_message = slot->ros_message;
+  if (NULL != message_info) {
+    *message_info = slot->message_info;
+  }
+  return RCL_RET_OK;
+}
+
+rcl_ret_t
+rcl_take_pipeline_return_message(
+  rcl_take_pipeline_t * pipeline,
+  const void * ros_message)
+{
+  RCL_CHECK_ARGUMENT_FOR_NULL(pipeline, RCL_RET_INVALID_ARGUMENT);
+  RCL_CHECK_ARGUMENT_FOR_NULL(ros_message, RCL_RET_INVALID_ARGUMENT);
+  RCL_CHECK_FOR_NULL_WITH_MSG(
+    pipeline->impl, "take pipeline is not initialized", return RCL_RET_NOT_INIT);
+  rcl_take_pipeline_impl_t * impl = pipeline->impl;
+  // the depth is small, so a linear scan beats carrying a handle around
+  for (size_t i = 0; i < impl->depth; ++i) {
+    if (impl->slots[i].ros_message == ros_message) {
+      _rcl_take_pipeline_ring_push(&impl->free_ring, i);
+      return RCL_RET_OK;
+    }
+  }
+  RCL_SET_ERROR_MSG("ros_message was not taken from this take pipeline");
+  return RCL_RET_INVALID_ARGUMENT;
+}
+
+const rcl_guard_condition_t *
+rcl_take_pipeline_get_guard_condition(const rcl_take_pipeline_t * pipeline)
+{
+  if (NULL == pipeline || NULL == pipeline->impl) {
+    return NULL;
+  }
+  return &pipeline->impl->guard_condition;
+}
+
+#ifdef __cplusplus
+}
+#endif
@@ -15,6 +15,7 @@
 #include "rcl/time.h"
 
 #include <stdbool.h>
+#include <stdint.h>
 #include <stdlib.h>
 
 #include "./common.h"
@@ -29,8 +30,37 @@ typedef struct rcl_ros_clock_storage_s
 {
   atomic_uint_least64_t current_time;
   bool active;
+  // Seqlock sequence counter guarding the consistency of `active` and
+  // `current_time`: odd while a writer is mid-update, even otherwise.
+  // Writers (the /clock update and override enable/disable paths) are
+  // expected to be serialized by the caller, as they always have been;
+  // readers are lock-free and retry on a torn read.
+  atomic_uint_least64_t sequence;
 } rcl_ros_clock_storage_t;
 
+// Internal storage for RCL_COARSE_TIME implementation
+typedef struct rcl_coarse_clock_storage_s
+{
+  // The cached time point, published by rcl_coarse_clock_update().
+  atomic_uint_least64_t current_time;
+  // The time source sampled by each update.
+  rcl_ret_t (* sample_now)(void * data, rcl_time_point_value_t * current_time);
+} rcl_coarse_clock_storage_t;
+
+// Mark the beginning of an update to the ros clock storage.
+static void
+rcl_ros_clock_begin_write(rcl_ros_clock_storage_t * storage)
+{
+  rcutils_atomic_fetch_add_uint64_t(&(storage->sequence), 1);
+}
+
+// Mark the end of an update to the ros clock storage.
+static void
+rcl_ros_clock_end_write(rcl_ros_clock_storage_t * storage)
+{
+  rcutils_atomic_fetch_add_uint64_t(&(storage->sequence), 1);
+}
+
 // Implementation only
 static rcl_ret_t
 rcl_get_steady_time(void * data, rcl_time_point_value_t * current_time)
@@ -47,6 +77,16 @@ rcl_get_system_time(void * data, rcl_time_point_value_t * current_time)
   return rcutils_system_time_now(current_time);
 }
 
+// Implementation only
+static rcl_ret_t
+rcl_get_coarse_time(void * data, rcl_time_point_value_t * current_time)
+{
+  rcl_coarse_clock_storage_t * storage = (rcl_coarse_clock_storage_t *)data;
+  *current_time = (rcl_time_point_value_t)rcutils_atomic_load_uint64_t(
+    &(storage->current_time));
+  return RCL_RET_OK;
+}
+
 // Internal method for zeroing values on init, assumes clock is valid
 static void
 rcl_init_generic_clock(rcl_clock_t * clock, rcl_allocator_t * allocator)
@@ -54,6 +94,11 @@ rcl_init_generic_clock(rcl_clock_t * clock, rcl_allocator_t * allocator)
   clock->type = RCL_CLOCK_UNINITIALIZED;
   clock->jump_callbacks = NULL;
   clock->num_jump_callbacks = 0u;
+  clock->jump_callbacks_capacity = 0u;
+  clock->jump_callback_index = NULL;
+  clock->num_forward_jump_callbacks = 0u;
+  clock->num_backward_jump_callbacks = 0u;
+  clock->num_clock_change_jump_callbacks = 0u;
   clock->get_now = NULL;
   clock->data = NULL;
   clock->allocator = *allocator;
@@ -65,11 +110,26 @@ static rcl_ret_t
 rcl_get_ros_time(void * data, rcl_time_point_value_t * current_time)
 {
   rcl_ros_clock_storage_t * t = (rcl_ros_clock_storage_t *)data;
-  if (!t->active) {
-    return rcl_get_system_time(data, current_time);
+  // Lock-free double read: sample the sequence counter around the reads and
+  // retry if a writer was active in between, so `active` and `current_time`
+  // always come from the same update.
+  while (true) {
+    const uint64_t seq_begin = rcutils_atomic_load_uint64_t(&(t->sequence));
+    if (seq_begin % 2 != 0) {
+      continue;  // A writer is mid-update.
+    }
+    const bool active = t->active;
+    const uint64_t time_value = rcutils_atomic_load_uint64_t(&(t->current_time));
+    const uint64_t seq_end = rcutils_atomic_load_uint64_t(&(t->sequence));
+    if (seq_begin != seq_end) {
+      continue;  // Torn read; a writer slipped in.
+    }
+    if (!active) {
+      return rcl_get_system_time(data, current_time);
+    }
+    *current_time = (rcl_time_point_value_t)time_value;
+    return RCL_RET_OK;
   }
-  *current_time = rcutils_atomic_load_uint64_t(&(t->current_time));
-  return RCL_RET_OK;
 }
 
 bool
@@ -111,6 +171,10 @@ rcl_clock_init(
       return rcl_system_clock_init(clock, allocator);
     case RCL_STEADY_TIME:
       return rcl_steady_clock_init(clock, allocator);
+    case RCL_COARSE_TIME:
+      // System time is the default source, matching the message stamping use
+      // case; use rcl_coarse_clock_init() directly for a steady source.
+      return rcl_coarse_clock_init(clock, RCL_SYSTEM_TIME, allocator);
     default:
       return RCL_RET_INVALID_ARGUMENT;
   }
@@ -121,11 +185,19 @@ rcl_clock_generic_fini(
   rcl_clock_t * clock)
 {
   // Internal function; assume caller has already checked that clock is valid.
-  if (clock->num_jump_callbacks > 0) {
-    clock->num_jump_callbacks = 0;
+  if (clock->jump_callbacks) {
     clock->allocator.deallocate(clock->jump_callbacks, clock->allocator.state);
     clock->jump_callbacks = NULL;
   }
+  if (clock->jump_callback_index) {
+    clock->allocator.deallocate(clock->jump_callback_index, clock->allocator.state);
+    clock->jump_callback_index = NULL;
+  }
+  clock->num_jump_callbacks = 0;
+  clock->jump_callbacks_capacity = 0;
+  clock->num_forward_jump_callbacks = 0;
+  clock->num_backward_jump_callbacks = 0;
+  clock->num_clock_change_jump_callbacks = 0;
 }
 
 rcl_ret_t
@@ -142,6 +214,8 @@ rcl_clock_fini(
       return rcl_system_clock_fini(clock);
     case RCL_STEADY_TIME:
       return rcl_steady_clock_fini(clock);
+    case RCL_COARSE_TIME:
+      return rcl_coarse_clock_fini(clock);
     case RCL_CLOCK_UNINITIALIZED:
     // fall through
     default:
@@ -166,6 +240,7 @@ rcl_ros_clock_init(
   rcl_ros_clock_storage_t * storage = (rcl_ros_clock_storage_t *)clock->data;
   // 0 is a special value meaning time has not been set
   atomic_init(&(storage->current_time), 0);
+  atomic_init(&(storage->sequence), 0);
   storage->active = false;
   clock->get_now = rcl_get_ros_time;
   clock->type = RCL_ROS_TIME;
@@ -239,6 +314,84 @@ rcl_system_clock_fini(
   return RCL_RET_OK;
 }
 
+rcl_ret_t
+rcl_coarse_clock_init(
+  rcl_clock_t * clock,
+  rcl_clock_type_t source_type,
+  rcl_allocator_t * allocator)
+{
+  RCL_CHECK_ARGUMENT_FOR_NULL(clock, RCL_RET_INVALID_ARGUMENT);
+  RCL_CHECK_ARGUMENT_FOR_NULL(allocator, RCL_RET_INVALID_ARGUMENT);
+  rcl_ret_t (* sample_now)(void *, rcl_time_point_value_t *) = NULL;
+  switch (source_type) {
+    case RCL_SYSTEM_TIME:
+      sample_now = rcl_get_system_time;
+      break;
+    case RCL_STEADY_TIME:
+      sample_now = rcl_get_steady_time;
+      break;
+    default:
+      RCL_SET_ERROR_MSG(
+        "coarse clock source must be RCL_SYSTEM_TIME or RCL_STEADY_TIME");
+      return RCL_RET_INVALID_ARGUMENT;
+  }
+  // Seed the cache before the clock becomes visible, so readers never
+  // observe the "time has not been set" value 0.
+  rcl_time_point_value_t now = 0;
+  rcl_ret_t ret = sample_now(NULL, &now);
+  if (RCL_RET_OK != ret) {
+    return ret;  // rcl error state should already be set.
+  }
+  rcl_init_generic_clock(clock, allocator);
+  clock->data = allocator->allocate(sizeof(rcl_coarse_clock_storage_t), allocator->state);
+  if (NULL == clock->data) {
+    RCL_SET_ERROR_MSG("allocating memory failed");
+    return RCL_RET_BAD_ALLOC;
+  }
+  rcl_coarse_clock_storage_t * storage = (rcl_coarse_clock_storage_t *)clock->data;
+  atomic_init(&(storage->current_time), (uint64_t)now);
+  storage->sample_now = sample_now;
+  clock->get_now = rcl_get_coarse_time;
+  clock->type = RCL_COARSE_TIME;
+  return RCL_RET_OK;
+}
+
+rcl_ret_t
+rcl_coarse_clock_fini(
+  rcl_clock_t * clock)
+{
+  RCL_CHECK_ARGUMENT_FOR_NULL(clock, RCL_RET_INVALID_ARGUMENT);
+  if (clock->type != RCL_COARSE_TIME) {
+    RCL_SET_ERROR_MSG("clock not of type RCL_COARSE_TIME");
+    return RCL_RET_ERROR;
+  }
+  rcl_clock_generic_fini(clock);
+  clock->allocator.deallocate(clock->data, clock->allocator.state);
+  clock->data = NULL;
+  return RCL_RET_OK;
+}
+
+rcl_ret_t
+rcl_coarse_clock_update(
+  rcl_clock_t * clock)
+{
+  RCL_CHECK_ARGUMENT_FOR_NULL(clock, RCL_RET_INVALID_ARGUMENT);
+  if (clock->type != RCL_COARSE_TIME) {
+    RCL_SET_ERROR_MSG("clock not of type RCL_COARSE_TIME");
+    return RCL_RET_ERROR;
+  }
+  RCL_CHECK_FOR_NULL_WITH_MSG(
+    clock->data, "clock is invalid", return RCL_RET_ERROR);
+  rcl_coarse_clock_storage_t * storage = (rcl_coarse_clock_storage_t *)clock->data;
+  rcl_time_point_value_t now = 0;
+  rcl_ret_t ret = storage->sample_now(NULL, &now);
+  if (RCL_RET_OK != ret) {
+    return ret;  // rcl error state should already be set.
+  }
+  rcutils_atomic_store(&(storage->current_time), (uint64_t)now);
+  return RCL_RET_OK;
+}
+
 rcl_ret_t
 rcl_difference_times(
   const rcl_time_point_t * start, const rcl_time_point_t * finish, rcl_duration_t * delta)
@@ -274,6 +427,76 @@ rcl_clock_get_now(rcl_clock_t * clock, rcl_time_point_value_t * time_point_value
   return RCL_RET_ERROR;
 }
 
+// Rebuild the threshold-sorted index over the jump callbacks; called on
+// registration and removal, which are cold next to the jump paths.
+static rcl_ret_t
+rcl_clock_rebuild_jump_callback_index(rcl_clock_t * clock)
+{
+  // Internal function; assume the clock is valid.
+  if (0 == clock->num_jump_callbacks) {
+    clock->num_forward_jump_callbacks = 0;
+    clock->num_backward_jump_callbacks = 0;
+    clock->num_clock_change_jump_callbacks = 0;
+    return RCL_RET_OK;
+  }
+  // A callback can appear in all three regions, so size for the worst case.
+  size_t * index = clock->allocator.reallocate(
+    clock->jump_callback_index, sizeof(size_t) * 3 * clock->jump_callbacks_capacity,
+    clock->allocator.state);
+  if (NULL == index) {
+    RCL_SET_ERROR_MSG("Failed to realloc jump callback index");
+    return RCL_RET_BAD_ALLOC;
+  }
+  clock->jump_callback_index = index;
+  size_t count = 0;
+  // Forward-threshold entries, insertion-sorted by ascending threshold so a
+  // forward jump walks exactly the prefix of thresholds it crosses.
+  for (size_t cb_idx = 0; cb_idx < clock->num_jump_callbacks; ++cb_idx) {
+    if (clock->jump_callbacks[cb_idx].threshold.min_forward.nanoseconds <= 0) {
+      continue;
+    }
+    size_t pos = count;
+    while (pos > 0 &&
+      clock->jump_callbacks[index[pos - 1]].threshold.min_forward.nanoseconds >
+      clock->jump_callbacks[cb_idx].threshold.min_forward.nanoseconds)
+    {
+      index[pos] = index[pos - 1];
+      --pos;
+    }
+    index[pos] = cb_idx;
+    ++count;
+  }
+  clock->num_forward_jump_callbacks = count;
+  // Backward-threshold entries, insertion-sorted by descending threshold
+  // (ascending magnitude) for the same prefix property on backward jumps.
+  const size_t backward_offset = count;
+  for (size_t cb_idx = 0; cb_idx < clock->num_jump_callbacks; ++cb_idx) {
+    if (clock->jump_callbacks[cb_idx].threshold.min_backward.nanoseconds >= 0) {
+      continue;
+    }
+    size_t pos = count;
+    while (pos > backward_offset &&
+      clock->jump_callbacks[index[pos - 1]].threshold.min_backward.nanoseconds <
+      clock->jump_callbacks[cb_idx].threshold.min_backward.nanoseconds)
+    {
+      index[pos] = index[pos - 1];
+      --pos;
+    }
+    index[pos] = cb_idx;
+    ++count;
+  }
+  clock->num_backward_jump_callbacks = count - backward_offset;
+  // Clock-change entries, in registration order.
+  const size_t clock_change_offset = count;
+  for (size_t cb_idx = 0; cb_idx < clock->num_jump_callbacks; ++cb_idx) {
+    if (clock->jump_callbacks[cb_idx].threshold.on_clock_change) {
+      index[count++] = cb_idx;
+    }
+  }
+  clock->num_clock_change_jump_callbacks = count - clock_change_offset;
+  return RCL_RET_OK;
+}
+
 static void
 rcl_clock_call_callbacks(
   rcl_clock_t * clock, const rcl_time_jump_t * time_jump, bool before_jump)
@@ -281,15 +504,39 @@ rcl_clock_call_callbacks(
   // Internal function; assume parameters are valid.
   bool is_clock_change = time_jump->clock_change == RCL_ROS_TIME_ACTIVATED ||
     time_jump->clock_change == RCL_ROS_TIME_DEACTIVATED;
-  for (size_t cb_idx = 0; cb_idx < clock->num_jump_callbacks; ++cb_idx) {
-    rcl_jump_callback_info_t * info = &(clock->jump_callbacks[cb_idx]);
-    if (
-      (is_clock_change && info->threshold.on_clock_change) ||
-      (info->threshold.min_backward.nanoseconds < 0 &&
-      time_jump->delta.nanoseconds <= info->threshold.min_backward.nanoseconds) ||
-      (info->threshold.min_forward.nanoseconds > 0 &&
-      time_jump->delta.nanoseconds >= info->threshold.min_forward.nanoseconds))
-    {
+  const size_t * index = clock->jump_callback_index;
+  const int64_t delta = time_jump->delta.nanoseconds;
+  if (delta > 0) {
+    // The forward entries are sorted ascending, so stop at the first
+    // threshold this jump does not reach.
+    for (size_t i = 0; i < clock->num_forward_jump_callbacks; ++i) {
+      rcl_jump_callback_info_t * info = &(clock->jump_callbacks[index[i]]);
+      if (delta < info->threshold.min_forward.nanoseconds) {
+        break;
+      }
+      if (is_clock_change && info->threshold.on_clock_change) {
+        continue;  // Fires once below via the clock-change region.
+      }
+      info->callback(time_jump, before_jump, info->user_data);
+    }
+  } else if (delta < 0) {
+    const size_t offset = clock->num_forward_jump_callbacks;
+    for (size_t i = 0; i < clock->num_backward_jump_callbacks; ++i) {
+      rcl_jump_callback_info_t * info = &(clock->jump_callbacks[index[offset + i]]);
+      if (delta > info->threshold.min_backward.nanoseconds) {
+        break;
+      }
+      if (is_clock_change && info->threshold.on_clock_change) {
+        continue;  // Fires once below via the clock-change region.
+      }
+      info->callback(time_jump, before_jump, info->user_data);
+    }
+  }
+  if (is_clock_change) {
+    const size_t offset =
+      clock->num_forward_jump_callbacks + clock->num_backward_jump_callbacks;
+    for (size_t i = 0; i < clock->num_clock_change_jump_callbacks; ++i) {
+      rcl_jump_callback_info_t * info = &(clock->jump_callbacks[index[offset + i]]);
       info->callback(time_jump, before_jump, info->user_data);
     }
   }
@@ -311,7 +558,9 @@ rcl_enable_ros_time_override(rcl_clock_t * clock)
     time_jump.delta.nanoseconds = 0;
     time_jump.clock_change = RCL_ROS_TIME_ACTIVATED;
     rcl_clock_call_callbacks(clock, &time_jump, true);
+    rcl_ros_clock_begin_write(storage);
     storage->active = true;
+    rcl_ros_clock_end_write(storage);
     rcl_clock_call_callbacks(clock, &time_jump, false);
   }
   return RCL_RET_OK;
@@ -333,7 +582,9 @@ rcl_disable_ros_time_override(rcl_clock_t * clock)
     time_jump.delta.nanoseconds = 0;
     time_jump.clock_change = RCL_ROS_TIME_DEACTIVATED;
     rcl_clock_call_callbacks(clock, &time_jump, true);
+    rcl_ros_clock_begin_write(storage);
     storage->active = false;
+    rcl_ros_clock_end_write(storage);
     rcl_clock_call_callbacks(clock, &time_jump, false);
   }
   return RCL_RET_OK;
@@ -380,10 +631,14 @@ rcl_set_ros_time_override(
     }
     time_jump.delta.nanoseconds = time_value - current_time;
     rcl_clock_call_callbacks(clock, &time_jump, true);
+    rcl_ros_clock_begin_write(storage);
     rcutils_atomic_store(&(storage->current_time), time_value);
+    rcl_ros_clock_end_write(storage);
     rcl_clock_call_callbacks(clock, &time_jump, false);
   } else {
+    rcl_ros_clock_begin_write(storage);
     rcutils_atomic_store(&(storage->current_time), time_value);
+    rcl_ros_clock_end_write(storage);
   }
   return RCL_RET_OK;
 }
@@ -416,19 +671,30 @@ rcl_clock_add_jump_callback(
     }
   }
 
-  // Add the new callback, increasing the size of the callback list
-  rcl_jump_callback_info_t * callbacks = clock->allocator.reallocate(
-    clock->jump_callbacks, sizeof(rcl_jump_callback_info_t) * (clock->num_jump_callbacks + 1),
-    clock->allocator.state);
-  if (NULL == callbacks) {
-    RCL_SET_ERROR_MSG("Failed to realloc jump callbacks");
-    return RCL_RET_BAD_ALLOC;
+  // Add the new callback, growing the callback list geometrically so
+  // registering n callbacks costs O(log n) reallocations instead of n.
+  if (clock->num_jump_callbacks == clock->jump_callbacks_capacity) {
+    size_t new_capacity =
+      clock->jump_callbacks_capacity ? 2 * clock->jump_callbacks_capacity : 4;
+    rcl_jump_callback_info_t * callbacks = clock->allocator.reallocate(
+      clock->jump_callbacks, sizeof(rcl_jump_callback_info_t) * new_capacity,
+      clock->allocator.state);
+    if (NULL == callbacks) {
+      RCL_SET_ERROR_MSG("Failed to realloc jump callbacks");
+      return RCL_RET_BAD_ALLOC;
+    }
+    clock->jump_callbacks = callbacks;
+    clock->jump_callbacks_capacity = new_capacity;
   }
-  clock->jump_callbacks = callbacks;
   clock->jump_callbacks[clock->num_jump_callbacks].callback = callback;
   clock->jump_callbacks[clock->num_jump_callbacks].threshold = threshold;
   clock->jump_callbacks[clock->num_jump_callbacks].user_data = user_data;
   ++(clock->num_jump_callbacks);
+  rcl_ret_t ret = rcl_clock_rebuild_jump_callback_index(clock);
+  if (RCL_RET_OK != ret) {
+    --(clock->num_jump_callbacks);
+    return ret;
+  }
   return RCL_RET_OK;
 }
 
@@ -457,19 +723,15 @@ rcl_clock_remove_jump_callback(
     return RCL_RET_ERROR;
   }
 
-  // Shrink size of the callback array
+  // The capacity is kept; removals do not shrink the storage.
   if (--(clock->num_jump_callbacks) == 0) {
     clock->allocator.deallocate(clock->jump_callbacks, clock->allocator.state);
     clock->jump_callbacks = NULL;
-  } else {
-    rcl_jump_callback_info_t * callbacks = clock->allocator.reallocate(
-      clock->jump_callbacks, sizeof(rcl_jump_callback_info_t) * clock->num_jump_callbacks,
-      clock->allocator.state);
-    if (NULL == callbacks) {
-      RCL_SET_ERROR_MSG("Failed to shrink jump callbacks");
-      return RCL_RET_BAD_ALLOC;
+    clock->jump_callbacks_capacity = 0;
+    if (clock->jump_callback_index) {
+      clock->allocator.deallocate(clock->jump_callback_index, clock->allocator.state);
+      clock->jump_callback_index = NULL;
     }
-    clock->jump_callbacks = callbacks;
   }
-  return RCL_RET_OK;
+  return rcl_clock_rebuild_jump_callback_index(clock);
 }
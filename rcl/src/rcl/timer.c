@@ -19,25 +19,99 @@ extern "C"
 
 #include "rcl/timer.h"
 
+#include <assert.h>
 #include <inttypes.h>
+#include <stddef.h>
 
 #include "rcl/error_handling.h"
+#include "rcl/trace.h"
 #include "rcutils/logging_macros.h"
 #include "rcutils/stdatomic_helper.h"
 #include "rcutils/time.h"
 #include "tracetools/tracetools.h"
 
+#include "./entity_cost_impl.h"
+
+/* Memory ordering tiers for the timer impl atomics.
+ *
+ * The rcutils atomic helpers are sequentially consistent, which inserts full
+ * barriers on weakly ordered architectures in the rcl_timer_call() hot path.
+ * When RCL_TIMER_RELAXED_ATOMICS is defined (and C11 atomics are available)
+ * explicit orderings are used instead: relaxed for monitoring reads that
+ * tolerate a slightly stale value, acquire for loads that consume the
+ * call/cancel/reset handoff and acq_rel/release for the operations that
+ * publish it. The cold mutation paths (cancel, reset, period and callback
+ * exchange) keep the sequentially consistent helpers, which are at least as
+ * strong as the release side of each pairing. Without the flag the defaults
+ * are kept, so behavior on strongly ordered platforms is unchanged.
+ */
+#if defined(RCL_TIMER_RELAXED_ATOMICS) && !defined(__STDC_NO_ATOMICS__) && !defined(_MSC_VER)
+#define TIMER_ATOMIC_LOAD_INT64_RELAXED(object) \
+  atomic_load_explicit(object, memory_order_relaxed)
+#define TIMER_ATOMIC_LOAD_BOOL_RELAXED(object) \
+  atomic_load_explicit(object, memory_order_relaxed)
+#define TIMER_ATOMIC_LOAD_BOOL_ACQUIRE(object) \
+  atomic_load_explicit(object, memory_order_acquire)
+#define TIMER_ATOMIC_LOAD_UINTPTR_RELAXED(object) \
+  atomic_load_explicit(object, memory_order_relaxed)
+#define TIMER_ATOMIC_STORE_RELEASE(object, value) \
+  atomic_store_explicit(object, value, memory_order_release)
+#define TIMER_ATOMIC_EXCHANGE_INT64_ACQ_REL(object, value) \
+  atomic_exchange_explicit(object, value, memory_order_acq_rel)
+#define TIMER_ATOMIC_FETCH_ADD_UINT64_RELAXED(object, value) \
+  atomic_fetch_add_explicit(object, value, memory_order_relaxed)
+#else
+#define TIMER_ATOMIC_LOAD_INT64_RELAXED(object) rcutils_atomic_load_int64_t(object)
+#define TIMER_ATOMIC_LOAD_BOOL_RELAXED(object) rcutils_atomic_load_bool(object)
+#define TIMER_ATOMIC_LOAD_BOOL_ACQUIRE(object) rcutils_atomic_load_bool(object)
+#define TIMER_ATOMIC_LOAD_UINTPTR_RELAXED(object) rcutils_atomic_load_uintptr_t(object)
+#define TIMER_ATOMIC_STORE_RELEASE(object, value) rcutils_atomic_store(object, value)
+#define TIMER_ATOMIC_EXCHANGE_INT64_ACQ_REL(object, value) \
+  rcutils_atomic_exchange_int64_t(object, value)
+#define TIMER_ATOMIC_FETCH_ADD_UINT64_RELAXED(object, value) \
+  rcutils_atomic_fetch_add_uint64_t(object, value)
+#endif
+
+/// Statically dispatched clock flavor, resolved once at init time.
+typedef enum rcl_timer_clock_flavor_e
+{
+  /// Time is read through the clock's get_now function pointer.
+  RCL_TIMER_CLOCK_GENERIC = 0,
+  /// Time is read from the monotonic clock directly, skipping the clock's
+  /// get_now indirection; only valid for RCL_STEADY_TIME clocks, which have
+  /// no jump callbacks or overrides to consult.
+  RCL_TIMER_CLOCK_STEADY = 1,
+} rcl_timer_clock_flavor_t;
+
+// Field order is deliberate: the cold configuration written at init time
+// comes first and the mutable atomics polled and exchanged on every
+// rcl_timer_call() / rcl_timer_is_ready() live on their own cache line, so
+// a thread spinning on one timer's readiness does not bounce the line
+// holding the configuration another thread is reading.
 struct rcl_timer_impl_s
 {
   // The clock providing time.
   rcl_clock_t * clock;
+  // How to sample the clock, see rcl_timer_clock_flavor_t.
+  rcl_timer_clock_flavor_t clock_flavor;
   // The associated context.
   rcl_context_t * context;
   // A guard condition used to wake the associated wait set, either when
   // ROSTime causes the timer to expire or when the timer is reset.
   rcl_guard_condition_t guard_condition;
+  // The user supplied allocator.
+  rcl_allocator_t allocator;
+  // The user supplied on reset callback data.
+  rcl_timer_on_reset_callback_data_t callback_data;
+  // Timing instrumentation ring buffer, NULL while instrumentation is
+  // disabled; see rcl_timer_enable_timing_stats().
+  rcl_timer_timing_sample_t * timing_samples;
+  // The number of slots in timing_samples.
+  size_t timing_capacity;
+
+  // --- hot mutable state, cache-line separated from the fields above ---
   // The user supplied callback.
-  atomic_uintptr_t callback;
+  RCL_ALIGNAS(RCL_CACHE_LINE_SIZE) atomic_uintptr_t callback;
   // This is a duration in nanoseconds, which is initialized as int64_t
   // to be used for internal time calculation.
   atomic_int_least64_t period;
@@ -47,14 +121,23 @@ struct rcl_timer_impl_s
   atomic_int_least64_t next_call_time;
   // Credit for time elapsed before ROS time is activated or deactivated.
   atomic_int_least64_t time_credit;
+  // Total calls recorded since instrumentation was enabled.
+  atomic_uint_least64_t timing_fire_count;
   // A flag which indicates if the timer is canceled.
   atomic_bool canceled;
-  // The user supplied allocator.
-  rcl_allocator_t allocator;
-  // The user supplied on reset callback data.
-  rcl_timer_on_reset_callback_data_t callback_data;
+  // Call-cost accounting counters, see rcl_entity_get_cost_estimate().
+  rcl_entity_cost_record_t cost_record;
 };
 
+// Pin the layout so a refactor cannot silently reintroduce false sharing.
+static_assert(
+  offsetof(struct rcl_timer_impl_s, callback) % RCL_CACHE_LINE_SIZE == 0,
+  "timer hot atomics must start on a cache line boundary");
+static_assert(
+  offsetof(struct rcl_timer_impl_s, callback) >=
+  offsetof(struct rcl_timer_impl_s, timing_capacity) + sizeof(size_t),
+  "timer cold configuration must precede the hot atomics");
+
 rcl_timer_t
 rcl_get_zero_initialized_timer()
 {
@@ -62,6 +145,17 @@ rcl_get_zero_initialized_timer()
   return null_timer;
 }
 
+// Sample the timer's clock, bypassing the get_now function pointer for
+// steady clock timers.
+static rcl_ret_t
+_rcl_timer_get_now(const rcl_timer_impl_t * impl, rcl_time_point_value_t * now)
+{
+  if (RCL_TIMER_CLOCK_STEADY == impl->clock_flavor) {
+    return rcutils_steady_time_now(now);
+  }
+  return rcl_clock_get_now(impl->clock, now);
+}
+
 void _rcl_timer_time_jump(
   const rcl_time_jump_t * time_jump,
   bool before_jump,
@@ -155,6 +249,8 @@ rcl_timer_init(
   }
   rcl_timer_impl_t impl;
   impl.clock = clock;
+  impl.clock_flavor =
+    RCL_STEADY_TIME == clock->type ? RCL_TIMER_CLOCK_STEADY : RCL_TIMER_CLOCK_GENERIC;
   impl.context = context;
   impl.guard_condition = rcl_get_zero_initialized_guard_condition();
   rcl_guard_condition_options_t options = rcl_guard_condition_get_default_options();
@@ -190,6 +286,18 @@ rcl_timer_init(
   impl.callback_data.user_data = NULL;
   impl.callback_data.reset_counter = 0;
 
+  // Timing instrumentation starts disabled.
+  impl.timing_samples = NULL;
+  impl.timing_capacity = 0;
+  atomic_init(&impl.timing_fire_count, 0);
+
+  // Cost accounting starts disabled.
+  atomic_init(&impl.cost_record.enabled, false);
+  atomic_init(&impl.cost_record.sample_count, 0);
+  atomic_init(&impl.cost_record.last_cost_ns, 0);
+  atomic_init(&impl.cost_record.ewma_cost_ns, 0);
+  atomic_init(&impl.cost_record.total_cost_ns, 0);
+
   timer->impl = (rcl_timer_impl_t *)allocator.allocate(sizeof(rcl_timer_impl_t), allocator.state);
   if (NULL == timer->impl) {
     if (RCL_RET_OK != rcl_guard_condition_fini(&(impl.guard_condition))) {
@@ -231,6 +339,9 @@ rcl_timer_fini(rcl_timer_t * timer)
   if (RCL_RET_OK != fail_ret) {
     RCL_SET_ERROR_MSG("Failure to fini guard condition");
   }
+  if (NULL != timer->impl->timing_samples) {
+    allocator.deallocate(timer->impl->timing_samples, allocator.state);
+  }
   allocator.deallocate(timer->impl, allocator.state);
   timer->impl = NULL;
   return result;
@@ -248,32 +359,23 @@ rcl_timer_clock(rcl_timer_t * timer, rcl_clock_t ** clock)
   return RCL_RET_OK;
 }
 
-rcl_ret_t
-rcl_timer_call(rcl_timer_t * timer)
+// Fire a timer with an already sampled current time; the validity and
+// canceled checks are expected to have been done by the caller.
+static rcl_ret_t
+_rcl_timer_call_with_now(rcl_timer_t * timer, rcl_time_point_value_t now)
 {
-  RCUTILS_LOG_DEBUG_NAMED(ROS_PACKAGE_NAME, "Calling timer");
-  RCL_CHECK_ARGUMENT_FOR_NULL(timer, RCL_RET_INVALID_ARGUMENT);
-  RCL_CHECK_ARGUMENT_FOR_NULL(timer->impl, RCL_RET_TIMER_INVALID);
-  if (rcutils_atomic_load_bool(&timer->impl->canceled)) {
-    RCL_SET_ERROR_MSG("timer is canceled");
-    return RCL_RET_TIMER_CANCELED;
-  }
-  rcl_time_point_value_t now;
-  rcl_ret_t now_ret = rcl_clock_get_now(timer->impl->clock, &now);
-  if (now_ret != RCL_RET_OK) {
-    return now_ret;  // rcl error state should already be set.
-  }
-  if (now < 0) {
-    RCL_SET_ERROR_MSG("clock now returned negative time point value");
-    return RCL_RET_ERROR;
-  }
+  rcutils_time_point_value_t cost_start;
+  const bool cost_active =
+    rcl_entity_cost_record_begin(&timer->impl->cost_record, &cost_start);
   rcl_time_point_value_t previous_ns =
-    rcutils_atomic_exchange_int64_t(&timer->impl->last_call_time, now);
+    TIMER_ATOMIC_EXCHANGE_INT64_ACQ_REL(&timer->impl->last_call_time, now);
   rcl_timer_callback_t typed_callback =
-    (rcl_timer_callback_t)rcutils_atomic_load_uintptr_t(&timer->impl->callback);
+    (rcl_timer_callback_t)TIMER_ATOMIC_LOAD_UINTPTR_RELAXED(&timer->impl->callback);
 
-  int64_t next_call_time = rcutils_atomic_load_int64_t(&timer->impl->next_call_time);
-  int64_t period = rcutils_atomic_load_int64_t(&timer->impl->period);
+  int64_t next_call_time = TIMER_ATOMIC_LOAD_INT64_RELAXED(&timer->impl->next_call_time);
+  int64_t period = TIMER_ATOMIC_LOAD_INT64_RELAXED(&timer->impl->period);
+  const int64_t scheduled_call_time = next_call_time;
+  RCL_TRACEPOINT(RCL_TRACE_EVENT_TIMER_CALL, timer, scheduled_call_time, now);
   // always move the next call time by exactly period forward
   // don't use now as the base to avoid extending each cycle by the time
   // between the timer being ready and the callback being triggered
@@ -291,12 +393,104 @@ rcl_timer_call(rcl_timer_t * timer)
       next_call_time += periods_ahead * period;
     }
   }
-  rcutils_atomic_store(&timer->impl->next_call_time, next_call_time);
+  TIMER_ATOMIC_STORE_RELEASE(&timer->impl->next_call_time, next_call_time);
+
+  rcl_timer_timing_sample_t * const timing_samples = timer->impl->timing_samples;
+  rcutils_time_point_value_t callback_start = 0;
+  rcutils_time_point_value_t callback_end = 0;
+  bool have_duration = false;
+  if (NULL != timing_samples && NULL != typed_callback) {
+    have_duration = RCUTILS_RET_OK == rcutils_steady_time_now(&callback_start);
+  }
 
   if (typed_callback != NULL) {
     int64_t since_last_call = now - previous_ns;
     typed_callback(timer, since_last_call);
   }
+
+  if (NULL != timing_samples) {
+    if (have_duration) {
+      have_duration = RCUTILS_RET_OK == rcutils_steady_time_now(&callback_end);
+    }
+    const uint64_t fired =
+      TIMER_ATOMIC_FETCH_ADD_UINT64_RELAXED(&timer->impl->timing_fire_count, 1);
+    rcl_timer_timing_sample_t * sample =
+      &timing_samples[fired % timer->impl->timing_capacity];
+    sample->latency = now - scheduled_call_time;
+    if (NULL == typed_callback) {
+      sample->callback_duration = 0;
+    } else {
+      sample->callback_duration = have_duration ? callback_end - callback_start : -1;
+    }
+  }
+  if (cost_active) {
+    rcl_entity_cost_record_commit(&timer->impl->cost_record, cost_start);
+  }
+  return RCL_RET_OK;
+}
+
+rcl_ret_t
+rcl_timer_call(rcl_timer_t * timer)
+{
+  RCUTILS_LOG_DEBUG_NAMED(ROS_PACKAGE_NAME, "Calling timer");
+  RCL_CHECK_ARGUMENT_FOR_NULL(timer, RCL_RET_INVALID_ARGUMENT);
+  RCL_CHECK_ARGUMENT_FOR_NULL(timer->impl, RCL_RET_TIMER_INVALID);
+  if (TIMER_ATOMIC_LOAD_BOOL_ACQUIRE(&timer->impl->canceled)) {
+    RCL_RETURN_EXPECTED(RCL_RET_TIMER_CANCELED);
+  }
+  rcl_time_point_value_t now;
+  rcl_ret_t now_ret = _rcl_timer_get_now(timer->impl, &now);
+  if (now_ret != RCL_RET_OK) {
+    return now_ret;  // rcl error state should already be set.
+  }
+  if (now < 0) {
+    RCL_SET_ERROR_MSG("clock now returned negative time point value");
+    return RCL_RET_ERROR;
+  }
+  return _rcl_timer_call_with_now(timer, now);
+}
+
+rcl_ret_t
+rcl_timers_call_ready(rcl_timer_t ** timers, size_t number_of_timers, size_t * number_called)
+{
+  RCL_CHECK_ARGUMENT_FOR_NULL(timers, RCL_RET_INVALID_ARGUMENT);
+  size_t called = 0;
+  // Each distinct clock is sampled once per run of timers sharing it, so a
+  // homogeneous batch costs a single clock query instead of one per timer.
+  rcl_clock_t * sampled_clock = NULL;
+  rcl_time_point_value_t now = 0;
+  for (size_t i = 0; i < number_of_timers; ++i) {
+    rcl_timer_t * timer = timers[i];
+    if (!timer) {
+      continue;  // Skip NULL timers, as wait set arrays contain them.
+    }
+    RCL_CHECK_ARGUMENT_FOR_NULL(timer->impl, RCL_RET_TIMER_INVALID);
+    if (TIMER_ATOMIC_LOAD_BOOL_ACQUIRE(&timer->impl->canceled)) {
+      continue;
+    }
+    if (timer->impl->clock != sampled_clock) {
+      rcl_ret_t now_ret = _rcl_timer_get_now(timer->impl, &now);
+      if (now_ret != RCL_RET_OK) {
+        return now_ret;  // rcl error state should already be set.
+      }
+      if (now < 0) {
+        RCL_SET_ERROR_MSG("clock now returned negative time point value");
+        return RCL_RET_ERROR;
+      }
+      sampled_clock = timer->impl->clock;
+    }
+    if (TIMER_ATOMIC_LOAD_INT64_RELAXED(&timer->impl->next_call_time) - now > 0) {
+      continue;  // Not ready yet.
+    }
+    rcl_ret_t call_ret = _rcl_timer_call_with_now(timer, now);
+    if (call_ret != RCL_RET_OK) {
+      return call_ret;  // rcl error state should already be set.
+    }
+    ++called;
+  }
+  if (number_called) {
+    *number_called = called;
+  }
   return RCL_RET_OK;
 }
 
@@ -324,16 +518,16 @@ rcl_timer_get_time_until_next_call(const rcl_timer_t * timer, int64_t * time_unt
   RCL_CHECK_ARGUMENT_FOR_NULL(timer, RCL_RET_INVALID_ARGUMENT);
   RCL_CHECK_ARGUMENT_FOR_NULL(timer->impl, RCL_RET_TIMER_INVALID);
   RCL_CHECK_ARGUMENT_FOR_NULL(time_until_next_call, RCL_RET_INVALID_ARGUMENT);
-  if (rcutils_atomic_load_bool(&timer->impl->canceled)) {
-    return RCL_RET_TIMER_CANCELED;
+  if (TIMER_ATOMIC_LOAD_BOOL_RELAXED(&timer->impl->canceled)) {
+    RCL_RETURN_EXPECTED(RCL_RET_TIMER_CANCELED);
   }
   rcl_time_point_value_t now;
-  rcl_ret_t ret = rcl_clock_get_now(timer->impl->clock, &now);
+  rcl_ret_t ret = _rcl_timer_get_now(timer->impl, &now);
   if (ret != RCL_RET_OK) {
     return ret;  // rcl error state should already be set.
   }
   *time_until_next_call =
-    rcutils_atomic_load_int64_t(&timer->impl->next_call_time) - now;
+    TIMER_ATOMIC_LOAD_INT64_RELAXED(&timer->impl->next_call_time) - now;
   return RCL_RET_OK;
 }
 
@@ -346,12 +540,12 @@ rcl_timer_get_time_since_last_call(
   RCL_CHECK_ARGUMENT_FOR_NULL(timer->impl, RCL_RET_TIMER_INVALID);
   RCL_CHECK_ARGUMENT_FOR_NULL(time_since_last_call, RCL_RET_INVALID_ARGUMENT);
   rcl_time_point_value_t now;
-  rcl_ret_t ret = rcl_clock_get_now(timer->impl->clock, &now);
+  rcl_ret_t ret = _rcl_timer_get_now(timer->impl, &now);
   if (ret != RCL_RET_OK) {
     return ret;  // rcl error state should already be set.
   }
   *time_since_last_call =
-    now - rcutils_atomic_load_int64_t(&timer->impl->last_call_time);
+    now - TIMER_ATOMIC_LOAD_INT64_RELAXED(&timer->impl->last_call_time);
   return RCL_RET_OK;
 }
 
@@ -361,7 +555,7 @@ rcl_timer_get_period(const rcl_timer_t * timer, int64_t * period)
   RCL_CHECK_ARGUMENT_FOR_NULL(timer, RCL_RET_INVALID_ARGUMENT);
   RCL_CHECK_ARGUMENT_FOR_NULL(timer->impl, RCL_RET_TIMER_INVALID);
   RCL_CHECK_ARGUMENT_FOR_NULL(period, RCL_RET_INVALID_ARGUMENT);
-  *period = rcutils_atomic_load_int64_t(&timer->impl->period);
+  *period = TIMER_ATOMIC_LOAD_INT64_RELAXED(&timer->impl->period);
   return RCL_RET_OK;
 }
 
@@ -385,7 +579,7 @@ rcl_timer_get_callback(const rcl_timer_t * timer)
 {
   RCL_CHECK_ARGUMENT_FOR_NULL(timer, NULL);
   RCL_CHECK_FOR_NULL_WITH_MSG(timer->impl, "timer is invalid", return NULL);
-  return (rcl_timer_callback_t)rcutils_atomic_load_uintptr_t(&timer->impl->callback);
+  return (rcl_timer_callback_t)TIMER_ATOMIC_LOAD_UINTPTR_RELAXED(&timer->impl->callback);
 }
 
 rcl_timer_callback_t
@@ -417,7 +611,7 @@ rcl_timer_is_canceled(const rcl_timer_t * timer, bool * is_canceled)
   RCL_CHECK_ARGUMENT_FOR_NULL(timer, RCL_RET_INVALID_ARGUMENT);
   RCL_CHECK_ARGUMENT_FOR_NULL(timer->impl, RCL_RET_TIMER_INVALID);
   RCL_CHECK_ARGUMENT_FOR_NULL(is_canceled, RCL_RET_INVALID_ARGUMENT);
-  *is_canceled = rcutils_atomic_load_bool(&timer->impl->canceled);
+  *is_canceled = TIMER_ATOMIC_LOAD_BOOL_RELAXED(&timer->impl->canceled);
   return RCL_RET_OK;
 }
 
@@ -453,6 +647,143 @@ rcl_timer_reset(rcl_timer_t * timer)
   return RCL_RET_OK;
 }
 
+rcl_ret_t
+rcl_timers_reset_staggered(
+  rcl_timer_t ** timers, size_t number_of_timers, const int64_t * phase_offsets)
+{
+  RCUTILS_CAN_RETURN_WITH_ERROR_OF(RCL_RET_INVALID_ARGUMENT);
+
+  RCL_CHECK_ARGUMENT_FOR_NULL(timers, RCL_RET_INVALID_ARGUMENT);
+  rcl_clock_t * sampled_clock = NULL;
+  rcl_time_point_value_t now = 0;
+  for (size_t i = 0; i < number_of_timers; ++i) {
+    rcl_timer_t * timer = timers[i];
+    RCL_CHECK_ARGUMENT_FOR_NULL(timer, RCL_RET_INVALID_ARGUMENT);
+    RCL_CHECK_FOR_NULL_WITH_MSG(timer->impl, "timer is invalid", return RCL_RET_TIMER_INVALID);
+    if (timer->impl->clock != sampled_clock) {
+      rcl_ret_t now_ret = _rcl_timer_get_now(timer->impl, &now);
+      if (now_ret != RCL_RET_OK) {
+        return now_ret;  // rcl error state should already be set.
+      }
+      sampled_clock = timer->impl->clock;
+    }
+    const int64_t period = rcutils_atomic_load_int64_t(&timer->impl->period);
+    int64_t phase = 0;
+    if (phase_offsets) {
+      phase = phase_offsets[i];
+    } else if (number_of_timers > 1) {
+      // Spread first wakeups evenly across each timer's own period; dividing
+      // before multiplying keeps the intermediate within the period.
+      phase = (period / (int64_t)number_of_timers) * (int64_t)i;
+    }
+    rcutils_atomic_store(&timer->impl->next_call_time, now + period + phase);
+    rcutils_atomic_store(&timer->impl->canceled, false);
+    rcl_ret_t ret = rcl_trigger_guard_condition(&timer->impl->guard_condition);
+    if (ret != RCL_RET_OK) {
+      RCUTILS_LOG_ERROR_NAMED(ROS_PACKAGE_NAME, "Failed to trigger timer guard condition");
+    }
+
+    rcl_timer_on_reset_callback_data_t * cb_data = &timer->impl->callback_data;
+    if (cb_data->on_reset_callback) {
+      cb_data->on_reset_callback(cb_data->user_data, 1);
+    } else {
+      cb_data->reset_counter++;
+    }
+  }
+  RCUTILS_LOG_DEBUG_NAMED(
+    ROS_PACKAGE_NAME, "%zu timers successfully reset with staggered phases", number_of_timers);
+  return RCL_RET_OK;
+}
+
+rcl_ret_t
+rcl_timer_enable_timing_stats(rcl_timer_t * timer, size_t buffer_capacity)
+{
+  RCL_CHECK_ARGUMENT_FOR_NULL(timer, RCL_RET_INVALID_ARGUMENT);
+  RCL_CHECK_FOR_NULL_WITH_MSG(timer->impl, "timer is invalid", return RCL_RET_TIMER_INVALID);
+  if (0 == buffer_capacity) {
+    RCL_SET_ERROR_MSG("buffer_capacity must be non-zero");
+    return RCL_RET_INVALID_ARGUMENT;
+  }
+  if (NULL != timer->impl->timing_samples) {
+    RCL_SET_ERROR_MSG("timer timing stats already enabled");
+    return RCL_RET_ALREADY_INIT;
+  }
+  rcl_allocator_t * allocator = &timer->impl->allocator;
+  rcl_timer_timing_sample_t * samples = allocator->allocate(
+    buffer_capacity * sizeof(rcl_timer_timing_sample_t), allocator->state);
+  if (NULL == samples) {
+    RCL_SET_ERROR_MSG("allocating memory failed");
+    return RCL_RET_BAD_ALLOC;
+  }
+  timer->impl->timing_capacity = buffer_capacity;
+  rcutils_atomic_store(&timer->impl->timing_fire_count, (uint64_t)0);
+  // Publishing the buffer pointer last is what arms the recording path.
+  timer->impl->timing_samples = samples;
+  return RCL_RET_OK;
+}
+
+rcl_ret_t
+rcl_timer_disable_timing_stats(rcl_timer_t * timer)
+{
+  RCL_CHECK_ARGUMENT_FOR_NULL(timer, RCL_RET_INVALID_ARGUMENT);
+  RCL_CHECK_FOR_NULL_WITH_MSG(timer->impl, "timer is invalid", return RCL_RET_TIMER_INVALID);
+  if (NULL == timer->impl->timing_samples) {
+    return RCL_RET_OK;
+  }
+  rcl_allocator_t * allocator = &timer->impl->allocator;
+  allocator->deallocate(timer->impl->timing_samples, allocator->state);
+  timer->impl->timing_samples = NULL;
+  timer->impl->timing_capacity = 0;
+  return RCL_RET_OK;
+}
+
+rcl_ret_t
+rcl_timer_get_cost_record(
+  const rcl_timer_t * timer,
+  rcl_entity_cost_record_t ** record)
+{
+  RCL_CHECK_ARGUMENT_FOR_NULL(timer, RCL_RET_INVALID_ARGUMENT);
+  RCL_CHECK_FOR_NULL_WITH_MSG(timer->impl, "timer is invalid", return RCL_RET_TIMER_INVALID);
+  *record = &timer->impl->cost_record;
+  return RCL_RET_OK;
+}
+
+rcl_ret_t
+rcl_timer_get_timing_stats(
+  const rcl_timer_t * timer,
+  rcl_timer_timing_sample_t * samples,
+  size_t capacity,
+  size_t * number_of_samples,
+  uint64_t * fire_count)
+{
+  RCL_CHECK_ARGUMENT_FOR_NULL(timer, RCL_RET_INVALID_ARGUMENT);
+  RCL_CHECK_FOR_NULL_WITH_MSG(timer->impl, "timer is invalid", return RCL_RET_TIMER_INVALID);
+  RCL_CHECK_ARGUMENT_FOR_NULL(samples, RCL_RET_INVALID_ARGUMENT);
+  RCL_CHECK_ARGUMENT_FOR_NULL(number_of_samples, RCL_RET_INVALID_ARGUMENT);
+  const rcl_timer_timing_sample_t * recorded = timer->impl->timing_samples;
+  if (NULL == recorded) {
+    RCL_SET_ERROR_MSG("timer timing stats are not enabled");
+    return RCL_RET_INVALID_ARGUMENT;
+  }
+  const size_t ring_capacity = timer->impl->timing_capacity;
+  const uint64_t fired =
+    rcutils_atomic_load_uint64_t(&timer->impl->timing_fire_count);
+  if (NULL != fire_count) {
+    *fire_count = fired;
+  }
+  size_t available = fired < (uint64_t)ring_capacity ? (size_t)fired : ring_capacity;
+  if (available > capacity) {
+    available = capacity;
+  }
+  // Copy the most recent `available` samples, oldest first.
+  for (size_t i = 0; i < available; ++i) {
+    const uint64_t index = fired - available + i;
+    samples[i] = recorded[index % ring_capacity];
+  }
+  *number_of_samples = available;
+  return RCL_RET_OK;
+}
+
 const rcl_allocator_t *
 rcl_timer_get_allocator(const rcl_timer_t * timer)
 {
@@ -0,0 +1,414 @@
+// Copyright 2026 Open Source Robotics Foundation, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+#include "rcl/timer_wheel.h"
+
+#include <stdint.h>
+#include <string.h>
+
+#include "rcl/error_handling.h"
+#include "rcutils/logging_macros.h"
+
+struct rcl_timer_wheel_impl_s
+{
+  // clock shared by every registered timer
+  rcl_clock_t * clock;
+  // allocator used for the internal storage
+  rcl_allocator_t allocator;
+  // parallel arrays forming a binary min-heap over the registered timers,
+  // keyed on absolute deadline snapshots; canceled timers sink to the
+  // bottom with a deadline of INT64_MAX
+  rcl_timer_t ** timers;
+  int64_t * deadlines;
+  size_t count;
+  size_t capacity;
+};
+
+// Compute the absolute deadline of a timer given the current time, saturating
+// at INT64_MAX; canceled timers get INT64_MAX so they sink in the heap.
+static rcl_ret_t
+__timer_wheel_deadline(rcl_timer_t * timer, int64_t now, int64_t * deadline)
+{
+  int64_t time_until = 0;
+  rcl_ret_t ret = rcl_timer_get_time_until_next_call(timer, &time_until);
+  if (RCL_RET_TIMER_CANCELED == ret) {
+    *deadline = INT64_MAX;
+    return RCL_RET_OK;
+  }
+  if (RCL_RET_OK != ret) {
+    return ret;  // The rcl error state should already be set.
+  }
+  if (time_until > INT64_MAX - now) {
+    *deadline = INT64_MAX;
+  } else {
+    *deadline = now + time_until;
+  }
+  return RCL_RET_OK;
+}
+
+static void
+__timer_wheel_swap(rcl_timer_wheel_impl_t * impl, size_t a, size_t b)
+{
+  rcl_timer_t * timer = impl->timers[a];
+  impl->timers[a] = impl->timers[b];
+  impl->timers[b] = timer;
+  int64_t deadline = impl->deadlines[a];
+  impl->deadlines[a] = impl->deadlines[b];
+  impl->deadlines[b] = deadline;
+}
+
+static void
+__timer_wheel_sift_up(rcl_timer_wheel_impl_t * impl, size_t pos)
+{
+  while (pos > 0) {
+    size_t parent = (pos - 1) / 2;
+    if (impl->deadlines[parent] <= impl->deadlines[pos]) {
+      break;
+    }
+    __timer_wheel_swap(impl, parent, pos);
+    pos = parent;
+  }
+}
+
+static void
+__timer_wheel_sift_down(rcl_timer_wheel_impl_t * impl, size_t pos)
+{
+  while (true) {
+    size_t smallest = pos;
+    size_t left = 2 * pos + 1;
+    size_t right = 2 * pos + 2;
+    if (left < impl->count && impl->deadlines[left] < impl->deadlines[smallest]) {
+      smallest = left;
+    }
+    if (right < impl->count && impl->deadlines[right] < impl->deadlines[smallest]) {
+      smallest = right;
+    }
+    if (smallest == pos) {
+      break;
+    }
+    __timer_wheel_swap(impl, pos, smallest);
+    pos = smallest;
+  }
+}
+
+// Grow the heap storage geometrically to hold at least capacity entries.
+static rcl_ret_t
+__timer_wheel_reserve(rcl_timer_wheel_impl_t * impl, size_t capacity)
+{
+  if (capacity <= impl->capacity) {
+    return RCL_RET_OK;
+  }
+  size_t new_capacity = impl->capacity ? 2 * impl->capacity : 4;
+  if (new_capacity < capacity) {
+    new_capacity = capacity;
+  }
+  rcl_timer_t ** timers = (rcl_timer_t **)impl->allocator.reallocate(
+    impl->timers, sizeof(rcl_timer_t *) * new_capacity, impl->allocator.state);
+  RCL_CHECK_FOR_NULL_WITH_MSG(
+    timers, "allocating memory failed", return RCL_RET_BAD_ALLOC);
+  impl->timers = timers;
+  int64_t * deadlines = (int64_t *)impl->allocator.reallocate(
+    impl->deadlines, sizeof(int64_t) * new_capacity, impl->allocator.state);
+  RCL_CHECK_FOR_NULL_WITH_MSG(
+    deadlines, "allocating memory failed", return RCL_RET_BAD_ALLOC);
+  impl->deadlines = deadlines;
+  impl->capacity = new_capacity;
+  return RCL_RET_OK;
+}
+
+// Pop every heap entry whose deadline has passed; the popped entries end up
+// in [impl->count, returned old count) of the parallel arrays.
+static size_t
+__timer_wheel_pop_due(rcl_timer_wheel_impl_t * impl, int64_t now)
+{
+  const size_t old_count = impl->count;
+  while (impl->count > 0 && impl->deadlines[0] <= now) {
+    __timer_wheel_swap(impl, 0, impl->count - 1);
+    --impl->count;
+    __timer_wheel_sift_down(impl, 0);
+  }
+  return old_count;
+}
+
+// Re-insert the popped entries in [impl->count, old_count), refreshing their
+// deadline snapshots against now.
+static rcl_ret_t
+__timer_wheel_reinsert_due(
+  rcl_timer_wheel_impl_t * impl, size_t old_count, int64_t now)
+{
+  while (impl->count < old_count) {
+    const size_t pos = impl->count;
+    rcl_ret_t ret = __timer_wheel_deadline(
+      impl->timers[pos], now, &impl->deadlines[pos]);
+    if (RCL_RET_OK != ret) {
+      return ret;
+    }
+    ++impl->count;
+    __timer_wheel_sift_up(impl, pos);
+  }
+  return RCL_RET_OK;
+}
+
+rcl_timer_wheel_t
+rcl_get_zero_initialized_timer_wheel(void)
+{
+  static rcl_timer_wheel_t null_timer_wheel = {0};
+  return null_timer_wheel;
+}
+
+rcl_ret_t
+rcl_timer_wheel_init(
+  rcl_timer_wheel_t * timer_wheel,
+  rcl_clock_t * clock,
+  size_t initial_capacity,
+  rcl_allocator_t allocator)
+{
+  RCL_CHECK_ARGUMENT_FOR_NULL(timer_wheel, RCL_RET_INVALID_ARGUMENT);
+  RCL_CHECK_ARGUMENT_FOR_NULL(clock, RCL_RET_INVALID_ARGUMENT);
+  RCL_CHECK_ALLOCATOR_WITH_MSG(&allocator, "invalid allocator", return RCL_RET_INVALID_ARGUMENT);
+  if (timer_wheel->impl) {
+    RCL_SET_ERROR_MSG("timer wheel already initialized, or memory was uninitialized");
+    return RCL_RET_ALREADY_INIT;
+  }
+  RCUTILS_LOG_DEBUG_NAMED(
+    ROS_PACKAGE_NAME, "Initializing timer wheel with capacity for '%zu' timers",
+    initial_capacity);
+  rcl_timer_wheel_impl_t * impl = (rcl_timer_wheel_impl_t *)allocator.allocate(
+    sizeof(rcl_timer_wheel_impl_t), allocator.state);
+  RCL_CHECK_FOR_NULL_WITH_MSG(
+    impl, "allocating memory failed", return RCL_RET_BAD_ALLOC);
+  memset(impl, 0, sizeof(rcl_timer_wheel_impl_t));
+  impl->clock = clock;
+  impl->allocator = allocator;
+  if (initial_capacity) {
+    rcl_ret_t ret = __timer_wheel_reserve(impl, initial_capacity);
+    if (RCL_RET_OK != ret) {
+      allocator.deallocate(impl, allocator.state);
+      return ret;
+    }
+  }
+  timer_wheel->impl = impl;
+  return RCL_RET_OK;
+}
+
+rcl_ret_t
+rcl_timer_wheel_fini(rcl_timer_wheel_t * timer_wheel)
+{
+  RCL_CHECK_ARGUMENT_FOR_NULL(timer_wheel, RCL_RET_INVALID_ARGUMENT);
+  if (!timer_wheel->impl) {
+    return RCL_RET_OK;
+  }
+  rcl_allocator_t allocator = timer_wheel->impl->allocator;
+  if (timer_wheel->impl->timers) {
+    allocator.deallocate(timer_wheel->impl->timers, allocator.state);
+  }
+  if (timer_wheel->impl->deadlines) {
+    allocator.deallocate(timer_wheel->impl->deadlines, allocator.state);
+  }
+  allocator.deallocate(timer_wheel->impl, allocator.state);
+  timer_wheel->impl = NULL;
+  return RCL_RET_OK;
+}
+
+rcl_ret_t
+rcl_timer_wheel_add_timer(rcl_timer_wheel_t * timer_wheel, rcl_timer_t * timer)
+{
+  RCL_CHECK_ARGUMENT_FOR_NULL(timer_wheel, RCL_RET_INVALID_ARGUMENT);
+  RCL_CHECK_FOR_NULL_WITH_MSG(
+    timer_wheel->impl, "timer wheel is invalid", return RCL_RET_INVALID_ARGUMENT);
+  RCL_CHECK_ARGUMENT_FOR_NULL(timer, RCL_RET_INVALID_ARGUMENT);
+  RCL_CHECK_FOR_NULL_WITH_MSG(
+    timer->impl, "timer is invalid", return RCL_RET_TIMER_INVALID);
+  rcl_timer_wheel_impl_t * impl = timer_wheel->impl;
+  rcl_clock_t * timer_clock = NULL;
+  rcl_ret_t ret = rcl_timer_clock(timer, &timer_clock);
+  if (RCL_RET_OK != ret) {
+    return ret;  // The rcl error state should already be set.
+  }
+  if (timer_clock != impl->clock) {
+    RCL_SET_ERROR_MSG("timer clock does not match the timer wheel clock");
+    return RCL_RET_INVALID_ARGUMENT;
+  }
+  for (size_t i = 0; i < impl->count; ++i) {
+    if (impl->timers[i] == timer) {
+      RCL_SET_ERROR_MSG("timer is already registered with the timer wheel");
+      return RCL_RET_INVALID_ARGUMENT;
+    }
+  }
+  ret = __timer_wheel_reserve(impl, impl->count + 1);
+  if (RCL_RET_OK != ret) {
+    return ret;
+  }
+  rcl_time_point_value_t now = 0;
+  ret = rcl_clock_get_now(impl->clock, &now);
+  if (RCL_RET_OK != ret) {
+    return ret;
+  }
+  int64_t deadline = INT64_MAX;
+  ret = __timer_wheel_deadline(timer, now, &deadline);
+  if (RCL_RET_OK != ret) {
+    return ret;
+  }
+  const size_t pos = impl->count;
+  impl->timers[pos] = timer;
+  impl->deadlines[pos] = deadline;
+  ++impl->count;
+  __timer_wheel_sift_up(impl, pos);
+  return RCL_RET_OK;
+}
+
+rcl_ret_t
+rcl_timer_wheel_remove_timer(
+  rcl_timer_wheel_t * timer_wheel, const rcl_timer_t * timer)
+{
+  RCL_CHECK_ARGUMENT_FOR_NULL(timer_wheel, RCL_RET_INVALID_ARGUMENT);
+  RCL_CHECK_FOR_NULL_WITH_MSG(
+    timer_wheel->impl, "timer wheel is invalid", return RCL_RET_INVALID_ARGUMENT);
+  RCL_CHECK_ARGUMENT_FOR_NULL(timer, RCL_RET_INVALID_ARGUMENT);
+  rcl_timer_wheel_impl_t * impl = timer_wheel->impl;
+  for (size_t i = 0; i < impl->count; ++i) {
+    if (impl->timers[i] != timer) {
+      continue;
+    }
+    __timer_wheel_swap(impl, i, impl->count - 1);
+    --impl->count;
+    if (i < impl->count) {
+      // The displaced entry can violate the heap property in either direction.
+      __timer_wheel_sift_down(impl, i);
+      __timer_wheel_sift_up(impl, i);
+    }
+    return RCL_RET_OK;
+  }
+  RCL_SET_ERROR_MSG("timer is not registered with the timer wheel");
+  return RCL_RET_INVALID_ARGUMENT;
+}
+
+rcl_ret_t
+rcl_timer_wheel_get_time_until_next_call(
+  rcl_timer_wheel_t * timer_wheel, int64_t * time_until_next_call)
+{
+  RCL_CHECK_ARGUMENT_FOR_NULL(timer_wheel, RCL_RET_INVALID_ARGUMENT);
+  RCL_CHECK_FOR_NULL_WITH_MSG(
+    timer_wheel->impl, "timer wheel is invalid", return RCL_RET_INVALID_ARGUMENT);
+  RCL_CHECK_ARGUMENT_FOR_NULL(time_until_next_call, RCL_RET_INVALID_ARGUMENT);
+  rcl_timer_wheel_impl_t * impl = timer_wheel->impl;
+  // Only the heap root is queried through the timer API, which recomputes
+  // the remaining time precisely; timers canceled behind the wheel's back
+  // are re-keyed to the bottom of the heap as they surface.
+  while (impl->count > 0 && INT64_MAX != impl->deadlines[0]) {
+    rcl_ret_t ret = rcl_timer_get_time_until_next_call(
+      impl->timers[0], time_until_next_call);
+    if (RCL_RET_TIMER_CANCELED == ret) {
+      impl->deadlines[0] = INT64_MAX;
+      __timer_wheel_sift_down(impl, 0);
+      continue;
+    }
+    return ret;
+  }
+  *time_until_next_call = INT64_MAX;
+  return RCL_RET_OK;
+}
+
+rcl_ret_t
+rcl_timer_wheel_take_ready(
+  rcl_timer_wheel_t * timer_wheel,
+  rcl_timer_t ** ready_timers,
+  size_t capacity,
+  size_t * number_ready)
+{
+  RCL_CHECK_ARGUMENT_FOR_NULL(timer_wheel, RCL_RET_INVALID_ARGUMENT);
+  RCL_CHECK_FOR_NULL_WITH_MSG(
+    timer_wheel->impl, "timer wheel is invalid", return RCL_RET_INVALID_ARGUMENT);
+  RCL_CHECK_ARGUMENT_FOR_NULL(ready_timers, RCL_RET_INVALID_ARGUMENT);
+  RCL_CHECK_ARGUMENT_FOR_NULL(number_ready, RCL_RET_INVALID_ARGUMENT);
+  rcl_timer_wheel_impl_t * impl = timer_wheel->impl;
+  *number_ready = 0;
+  rcl_time_point_value_t now = 0;
+  rcl_ret_t ret = rcl_clock_get_now(impl->clock, &now);
+  if (RCL_RET_OK != ret) {
+    return ret;
+  }
+  const size_t old_count = __timer_wheel_pop_due(impl, now);
+  for (size_t i = impl->count; i < old_count; ++i) {
+    bool is_ready = false;
+    ret = rcl_timer_is_ready(impl->timers[i], &is_ready);
+    if (RCL_RET_OK != ret) {
+      // Put the popped entries back before surfacing the error.
+      rcl_ret_t reinsert_ret = __timer_wheel_reinsert_due(impl, old_count, now);
+      (void)reinsert_ret;
+      return ret;
+    }
+    if (is_ready && *number_ready < capacity) {
+      ready_timers[(*number_ready)++] = impl->timers[i];
+    }
+  }
+  return __timer_wheel_reinsert_due(impl, old_count, now);
+}
+
+rcl_ret_t
+rcl_timer_wheel_call_ready(rcl_timer_wheel_t * timer_wheel, size_t * number_called)
+{
+  RCL_CHECK_ARGUMENT_FOR_NULL(timer_wheel, RCL_RET_INVALID_ARGUMENT);
+  RCL_CHECK_FOR_NULL_WITH_MSG(
+    timer_wheel->impl, "timer wheel is invalid", return RCL_RET_INVALID_ARGUMENT);
+  rcl_timer_wheel_impl_t * impl = timer_wheel->impl;
+  size_t called = 0;
+  rcl_time_point_value_t now = 0;
+  rcl_ret_t ret = rcl_clock_get_now(impl->clock, &now);
+  if (RCL_RET_OK != ret) {
+    return ret;
+  }
+  const size_t old_count = __timer_wheel_pop_due(impl, now);
+  for (size_t i = impl->count; i < old_count; ++i) {
+    bool is_ready = false;
+    ret = rcl_timer_is_ready(impl->timers[i], &is_ready);
+    if (RCL_RET_OK == ret && is_ready) {
+      ret = rcl_timer_call(impl->timers[i]);
+      if (RCL_RET_OK == ret) {
+        ++called;
+      } else if (RCL_RET_TIMER_CANCELED == ret) {
+        // Canceled between the readiness check and the call; not an error.
+        rcl_reset_error();
+        ret = RCL_RET_OK;
+      }
+    }
+    if (RCL_RET_OK != ret) {
+      rcl_ret_t reinsert_ret = __timer_wheel_reinsert_due(impl, old_count, now);
+      (void)reinsert_ret;
+      return ret;
+    }
+  }
+  if (number_called) {
+    *number_called = called;
+  }
+  return __timer_wheel_reinsert_due(impl, old_count, now);
+}
+
+size_t
+rcl_timer_wheel_get_size(const rcl_timer_wheel_t * timer_wheel)
+{
+  if (!timer_wheel || !timer_wheel->impl) {
+    return 0;
+  }
+  return timer_wheel->impl->count;
+}
+
+#ifdef __cplusplus
+}
+#endif
@@ -0,0 +1,50 @@
+// Copyright 2022 Open Source Robotics Foundation, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+#include "rcl/trace.h"
+
+#include <stddef.h>
+
+// The handler and its user data are process-wide, like the tracing session
+// they feed; see the thread-safety note on rcl_trace_set_handler().
+static rcl_trace_handler_t __trace_handler = NULL;
+static void * __trace_user_data = NULL;
+
+void
+rcl_trace_set_handler(rcl_trace_handler_t handler, void * user_data)
+{
+  __trace_handler = handler;
+  __trace_user_data = user_data;
+}
+
+void
+rcl_trace_emit(
+  rcl_trace_event_t event,
+  const void * entity,
+  int64_t arg0,
+  int64_t arg1)
+{
+  if (NULL != __trace_handler) {
+    __trace_handler(event, entity, arg0, arg1, __trace_user_data);
+  }
+}
+
+#ifdef __cplusplus
+}
+#endif
@@ -19,10 +19,150 @@
 #include "rcl/allocator.h"
 #include "rcl/error_handling.h"
 #include "rcl/type_hash.h"
+#include "rcutils/stdatomic_helper.h"
+#include "rcutils/strdup.h"
 #include "rcutils/types/char_array.h"
 #include "rcutils/sha256.h"
 #include "type_description_interfaces/msg/type_description.h"
 
+// Process-wide memoization of calculated type hashes.  Entity init paths
+// recompute the hash of the same handful of types over and over; each
+// distinct type only needs the JSON serialization and SHA-256 once per
+// process.  Entries are keyed by a cheap FNV-1a fingerprint over the full
+// type description content, with the type name and field count compared on
+// hit to guard against fingerprint collisions.  The table never evicts; once
+// full, further types are simply recomputed on every call.
+#define RCL_TYPE_HASH_CACHE_CAPACITY 128
+
+typedef struct rcl_type_hash_cache_entry_s
+{
+  bool occupied;
+  uint64_t fingerprint;
+  char * type_name;
+  size_t field_count;
+  rosidl_type_hash_t hash;
+} rcl_type_hash_cache_entry_t;
+
+static rcl_type_hash_cache_entry_t g_type_hash_cache[RCL_TYPE_HASH_CACHE_CAPACITY];
+static size_t g_type_hash_cache_size = 0;
+static atomic_uint_least64_t g_type_hash_cache_lock;
+
+static void
+type_hash_cache_lock(void)
+{
+  uint64_t previous = 1;
+  do {
+    rcutils_atomic_exchange(&g_type_hash_cache_lock, previous, 1);
+  } while (0 != previous);
+}
+
+static void
+type_hash_cache_unlock(void)
+{
+  rcutils_atomic_store(&g_type_hash_cache_lock, 0);
+}
+
+static uint64_t
+fingerprint_update(uint64_t fingerprint, const uint8_t * data, size_t size)
+{
+  for (size_t i = 0; i < size; ++i) {
+    fingerprint = (fingerprint ^ data[i]) * 0x100000001b3ULL;
+  }
+  return fingerprint;
+}
+
+static uint64_t
+fingerprint_update_string(uint64_t fingerprint, const rosidl_runtime_c__String * str)
+{
+  fingerprint = fingerprint_update(fingerprint, (const uint8_t *)&str->size, sizeof(str->size));
+  return fingerprint_update(fingerprint, (const uint8_t *)str->data, str->size);
+}
+
+static uint64_t
+fingerprint_update_individual_type_description(
+  uint64_t fingerprint,
+  const type_description_interfaces__msg__IndividualTypeDescription * individual_type_description)
+{
+  fingerprint = fingerprint_update_string(fingerprint, &individual_type_description->type_name);
+  for (size_t i = 0; i < individual_type_description->fields.size; ++i) {
+    const type_description_interfaces__msg__Field * field =
+      &individual_type_description->fields.data[i];
+    fingerprint = fingerprint_update_string(fingerprint, &field->name);
+    fingerprint = fingerprint_update(
+      fingerprint, (const uint8_t *)&field->type.type_id, sizeof(field->type.type_id));
+    fingerprint = fingerprint_update(
+      fingerprint, (const uint8_t *)&field->type.capacity, sizeof(field->type.capacity));
+    fingerprint = fingerprint_update(
+      fingerprint, (const uint8_t *)&field->type.string_capacity,
+      sizeof(field->type.string_capacity));
+    fingerprint = fingerprint_update_string(fingerprint, &field->type.nested_type_name);
+  }
+  return fingerprint;
+}
+
+static uint64_t
+type_description_fingerprint(
+  const type_description_interfaces__msg__TypeDescription * type_description)
+{
+  uint64_t fingerprint = 0xcbf29ce484222325ULL;
+  fingerprint = fingerprint_update_individual_type_description(
+    fingerprint, &type_description->type_description);
+  for (size_t i = 0; i < type_description->referenced_type_descriptions.size; ++i) {
+    fingerprint = fingerprint_update_individual_type_description(
+      fingerprint, &type_description->referenced_type_descriptions.data[i]);
+  }
+  return fingerprint;
+}
+
+// Returns true and fills output_hash on a cache hit.  Must be called with the
+// cache lock held.
+static bool
+type_hash_cache_lookup(
+  uint64_t fingerprint,
+  const type_description_interfaces__msg__TypeDescription * type_description,
+  rosidl_type_hash_t * output_hash)
+{
+  for (size_t i = 0; i < g_type_hash_cache_size; ++i) {
+    const rcl_type_hash_cache_entry_t * entry = &g_type_hash_cache[i];
+    if (entry->fingerprint == fingerprint &&
+      entry->field_count == type_description->type_description.fields.size &&
+      NULL != type_description->type_description.type_name.data &&
+      0 == strcmp(entry->type_name, type_description->type_description.type_name.data))
+    {
+      *output_hash = entry->hash;
+      return true;
+    }
+  }
+  return false;
+}
+
+// Must be called with the cache lock held.  Insertion failures (table full,
+// allocation failure) are silently ignored; the cache is an optimization.
+static void
+type_hash_cache_insert(
+  uint64_t fingerprint,
+  const type_description_interfaces__msg__TypeDescription * type_description,
+  const rosidl_type_hash_t * hash)
+{
+  if (g_type_hash_cache_size >= RCL_TYPE_HASH_CACHE_CAPACITY ||
+    NULL == type_description->type_description.type_name.data)
+  {
+    return;
+  }
+  rcl_allocator_t allocator = rcl_get_default_allocator();
+  char * name_copy =
+    rcutils_strdup(type_description->type_description.type_name.data, allocator);
+  if (NULL == name_copy) {
+    return;
+  }
+  rcl_type_hash_cache_entry_t * entry = &g_type_hash_cache[g_type_hash_cache_size++];
+  entry->occupied = true;
+  entry->fingerprint = fingerprint;
+  entry->type_name = name_copy;
+  entry->field_count = type_description->type_description.fields.size;
+  entry->hash = *hash;
+}
+
 static int yaml_write_handler(void * ext, uint8_t * buffer, size_t size)
 {
   rcutils_char_array_t * repr = (rcutils_char_array_t *)ext;
@@ -30,6 +170,12 @@ static int yaml_write_handler(void * ext, uint8_t * buffer, size_t size)
   return res == RCL_RET_OK ? 1 : 0;
 }
 
+static int yaml_sha256_write_handler(void * ext, uint8_t * buffer, size_t size)
+{
+  rcutils_sha256_update((rcutils_sha256_ctx_t *)ext, buffer, size);
+  return 1;
+}
+
 static inline int start_sequence(yaml_emitter_t * emitter)
 {
   yaml_event_t event;
@@ -192,14 +338,15 @@ static int emit_type_description(
   return end_sequence(emitter) && end_mapping(emitter);
 }
 
-rcl_ret_t
-rcl_type_description_to_hashable_json(
+// Emit the canonical hashable representation of the type description through
+// the given libyaml write handler, so callers can choose between
+// materializing the bytes and streaming them straight into a hash.
+static rcl_ret_t
+emit_hashable_json(
   const type_description_interfaces__msg__TypeDescription * type_description,
-  rcutils_char_array_t * output_repr)
+  yaml_write_handler_t * write_handler,
+  void * write_handler_ext)
 {
-  RCL_CHECK_ARGUMENT_FOR_NULL(type_description, RCL_RET_INVALID_ARGUMENT);
-  RCL_CHECK_ARGUMENT_FOR_NULL(output_repr, RCL_RET_INVALID_ARGUMENT);
-
   yaml_emitter_t emitter;
   yaml_event_t event;
 
@@ -211,7 +358,7 @@ rcl_type_description_to_hashable_json(
   yaml_emitter_set_width(&emitter, -1);
   // Circumvent EOF line break by providing invalid break style
   yaml_emitter_set_break(&emitter, -1);
-  yaml_emitter_set_output(&emitter, yaml_write_handler, output_repr);
+  yaml_emitter_set_output(&emitter, write_handler, write_handler_ext);
 
   if (!(
       yaml_stream_start_event_initialize(&event, YAML_UTF8_ENCODING) &&
@@ -240,6 +387,16 @@ error:
   return RCL_RET_ERROR;
 }
 
+rcl_ret_t
+rcl_type_description_to_hashable_json(
+  const type_description_interfaces__msg__TypeDescription * type_description,
+  rcutils_char_array_t * output_repr)
+{
+  RCL_CHECK_ARGUMENT_FOR_NULL(type_description, RCL_RET_INVALID_ARGUMENT);
+  RCL_CHECK_ARGUMENT_FOR_NULL(output_repr, RCL_RET_INVALID_ARGUMENT);
+  return emit_hashable_json(type_description, yaml_write_handler, output_repr);
+}
+
 rcl_ret_t
 rcl_calculate_type_hash(
   const type_description_interfaces__msg__TypeDescription * type_description,
@@ -248,19 +405,35 @@ rcl_calculate_type_hash(
   RCL_CHECK_ARGUMENT_FOR_NULL(type_description, RCL_RET_INVALID_ARGUMENT);
   RCL_CHECK_ARGUMENT_FOR_NULL(output_hash, RCL_RET_INVALID_ARGUMENT);
 
-  rcl_ret_t result = RCL_RET_OK;
-  rcutils_char_array_t msg_repr = rcutils_get_zero_initialized_char_array();
-  msg_repr.allocator = rcl_get_default_allocator();
+  uint64_t fingerprint = type_description_fingerprint(type_description);
+  type_hash_cache_lock();
+  bool hit = type_hash_cache_lookup(fingerprint, type_description, output_hash);
+  type_hash_cache_unlock();
+  if (hit) {
+    return RCL_RET_OK;
+  }
 
+  // Stream the canonical representation straight into the hash; the
+  // serialized bytes are never materialized, which for large types avoids a
+  // transient allocation the size of the full JSON rendering.  The emitter
+  // produces exactly the bytes rcl_type_description_to_hashable_json()
+  // accumulates, minus the char array's trailing null terminator, which was
+  // never hashed anyway.
   output_hash->version = 1;
-  result = rcl_type_description_to_hashable_json(type_description, &msg_repr);
+  rcutils_sha256_ctx_t sha_ctx;
+  rcutils_sha256_init(&sha_ctx);
+  rcl_ret_t result = emit_hashable_json(type_description, yaml_sha256_write_handler, &sha_ctx);
   if (result == RCL_RET_OK) {
-    rcutils_sha256_ctx_t sha_ctx;
-    rcutils_sha256_init(&sha_ctx);
-    // Last item in char_array is null terminator, which should not be hashed.
-    rcutils_sha256_update(&sha_ctx, (const uint8_t *)msg_repr.buffer, msg_repr.buffer_length - 1);
     rcutils_sha256_final(&sha_ctx, output_hash->value);
   }
-  result = rcutils_char_array_fini(&msg_repr);
+  if (result == RCL_RET_OK) {
+    type_hash_cache_lock();
+    // re-check in case another thread inserted the same type meanwhile
+    rosidl_type_hash_t existing;
+    if (!type_hash_cache_lookup(fingerprint, type_description, &existing)) {
+      type_hash_cache_insert(fingerprint, type_description, output_hash);
+    }
+    type_hash_cache_unlock();
+  }
   return result;
 }
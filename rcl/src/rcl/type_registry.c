@@ -0,0 +1,235 @@
+// Copyright 2026 Open Source Robotics Foundation, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+#include "rcl/type_registry.h"
+
+#include <stdint.h>
+
+#include "rosidl_runtime_c/type_description/type_description__struct.h"
+
+#include "rcl/error_handling.h"
+#include "rcl/type_hash.h"
+
+// Initial number of hash table slots; always a power of two so the probe
+// sequence can mask instead of dividing.
+#define TYPE_REGISTRY_INITIAL_CAPACITY 32
+
+typedef struct rcl_type_registry_entry_s
+{
+  // The type support the data was derived from.
+  // Type supports are static rosidl generated data, so the pointer is the
+  // identity of the type and is never dangling.
+  const rosidl_message_type_support_t * type_support;
+  // Type version hash calculated from the type support's type description.
+  rosidl_type_hash_t type_hash;
+} rcl_type_registry_entry_t;
+
+struct rcl_type_registry_impl_s
+{
+  rcl_allocator_t allocator;
+  // Open addressing hash table with linear probing, keyed by pointer.
+  // Entries are allocated individually, so the pointers handed out into them
+  // survive the table growing; NULL for empty slots.
+  rcl_type_registry_entry_t ** entries;
+  // Number of slots, always a power of two.
+  size_t capacity;
+  // Number of occupied slots.
+  size_t count;
+};
+
+// Mix the pointer bits so that allocation-aligned pointers spread over the
+// table; this is the finalizer of splitmix64.
+static uint64_t
+__type_registry_hash(const rosidl_message_type_support_t * type_support)
+{
+  uint64_t hash = (uint64_t)(uintptr_t)type_support;
+  hash ^= hash >> 30;
+  hash *= 0xbf58476d1ce4e5b9ULL;
+  hash ^= hash >> 27;
+  hash *= 0x94d049bb133111ebULL;
+  hash ^= hash >> 31;
+  return hash;
+}
+
+// Insert an entry into the table; the caller guarantees the type support is
+// not present and that a free slot exists.
+static void
+__type_registry_insert(
+  rcl_type_registry_impl_t * impl, rcl_type_registry_entry_t * entry)
+{
+  size_t index = (size_t)__type_registry_hash(entry->type_support) & (impl->capacity - 1);
+  while (NULL != impl->entries[index]) {
+    index = (index + 1) & (impl->capacity - 1);
+  }
+  impl->entries[index] = entry;
+  ++impl->count;
+}
+
+// Double the table capacity, re-seating the existing entries.
+static rcl_ret_t
+__type_registry_grow(rcl_type_registry_impl_t * impl)
+{
+  rcl_type_registry_entry_t ** old_entries = impl->entries;
+  const size_t old_capacity = impl->capacity;
+  rcl_type_registry_entry_t ** new_entries = impl->allocator.zero_allocate(
+    2 * old_capacity, sizeof(rcl_type_registry_entry_t *), impl->allocator.state);
+  if (NULL == new_entries) {
+    RCL_SET_ERROR_MSG("allocating memory failed");
+    return RCL_RET_BAD_ALLOC;
+  }
+  impl->entries = new_entries;
+  impl->capacity = 2 * old_capacity;
+  impl->count = 0;
+  for (size_t i = 0; i < old_capacity; ++i) {
+    if (NULL != old_entries[i]) {
+      __type_registry_insert(impl, old_entries[i]);
+    }
+  }
+  impl->allocator.deallocate(old_entries, impl->allocator.state);
+  return RCL_RET_OK;
+}
+
+rcl_type_registry_t
+rcl_get_zero_initialized_type_registry(void)
+{
+  static rcl_type_registry_t null_registry = {0};
+  return null_registry;
+}
+
+rcl_ret_t
+rcl_type_registry_init(rcl_type_registry_t * registry, rcl_allocator_t * allocator)
+{
+  RCL_CHECK_ARGUMENT_FOR_NULL(registry, RCL_RET_INVALID_ARGUMENT);
+  RCL_CHECK_ALLOCATOR_WITH_MSG(allocator, "invalid allocator", return RCL_RET_INVALID_ARGUMENT);
+  if (NULL != registry->impl) {
+    RCL_SET_ERROR_MSG("type registry already initialized, or memory was uninitialized");
+    return RCL_RET_ALREADY_INIT;
+  }
+  rcl_type_registry_impl_t * impl =
+    allocator->allocate(sizeof(rcl_type_registry_impl_t), allocator->state);
+  if (NULL == impl) {
+    RCL_SET_ERROR_MSG("allocating memory failed");
+    return RCL_RET_BAD_ALLOC;
+  }
+  impl->allocator = *allocator;
+  impl->entries = allocator->zero_allocate(
+    TYPE_REGISTRY_INITIAL_CAPACITY, sizeof(rcl_type_registry_entry_t *), allocator->state);
+  if (NULL == impl->entries) {
+    allocator->deallocate(impl, allocator->state);
+    RCL_SET_ERROR_MSG("allocating memory failed");
+    return RCL_RET_BAD_ALLOC;
+  }
+  impl->capacity = TYPE_REGISTRY_INITIAL_CAPACITY;
+  impl->count = 0;
+  registry->impl = impl;
+  return RCL_RET_OK;
+}
+
+rcl_ret_t
+rcl_type_registry_fini(rcl_type_registry_t * registry)
+{
+  RCL_CHECK_ARGUMENT_FOR_NULL(registry, RCL_RET_INVALID_ARGUMENT);
+  if (NULL == registry->impl) {
+    return RCL_RET_OK;
+  }
+  rcl_type_registry_impl_t * impl = registry->impl;
+  rcl_allocator_t allocator = impl->allocator;
+  for (size_t i = 0; i < impl->capacity; ++i) {
+    if (NULL != impl->entries[i]) {
+      allocator.deallocate(impl->entries[i], allocator.state);
+    }
+  }
+  allocator.deallocate(impl->entries, allocator.state);
+  allocator.deallocate(impl, allocator.state);
+  registry->impl = NULL;
+  return RCL_RET_OK;
+}
+
+rcl_ret_t
+rcl_type_registry_get_type_hash(
+  rcl_type_registry_t * registry,
+  const rosidl_message_type_support_t * type_support,
+  const rosidl_type_hash_t ** type_hash)
+{
+  RCL_CHECK_ARGUMENT_FOR_NULL(registry, RCL_RET_INVALID_ARGUMENT);
+  RCL_CHECK_FOR_NULL_WITH_MSG(
+    registry->impl, "type registry is invalid", return RCL_RET_INVALID_ARGUMENT);
+  RCL_CHECK_ARGUMENT_FOR_NULL(type_support, RCL_RET_INVALID_ARGUMENT);
+  RCL_CHECK_ARGUMENT_FOR_NULL(type_hash, RCL_RET_INVALID_ARGUMENT);
+  rcl_type_registry_impl_t * impl = registry->impl;
+  size_t index = (size_t)__type_registry_hash(type_support) & (impl->capacity - 1);
+  while (NULL != impl->entries[index]) {
+    if (type_support == impl->entries[index]->type_support) {
+      *type_hash = &impl->entries[index]->type_hash;
+      return RCL_RET_OK;
+    }
+    index = (index + 1) & (impl->capacity - 1);
+  }
+  // Not present; derive the data before touching the table, so a failure
+  // leaves the registry unchanged.
+  RCL_CHECK_FOR_NULL_WITH_MSG(
+    type_support->get_type_description_func,
+    "type support does not provide a type description", return RCL_RET_ERROR);
+  const rosidl_runtime_c__type_description__TypeDescription * description =
+    type_support->get_type_description_func(type_support);
+  RCL_CHECK_FOR_NULL_WITH_MSG(
+    description, "type support returned a NULL type description", return RCL_RET_ERROR);
+  rcl_type_registry_entry_t * new_entry =
+    impl->allocator.allocate(sizeof(rcl_type_registry_entry_t), impl->allocator.state);
+  if (NULL == new_entry) {
+    RCL_SET_ERROR_MSG("allocating memory failed");
+    return RCL_RET_BAD_ALLOC;
+  }
+  new_entry->type_support = type_support;
+  rcl_ret_t ret = rcl_calculate_type_hash(
+    // TODO(methylDragon): Replace this cast with the conversion function when it is ready
+    //  Either a custom function, or from https://github.com/ros2/rcl/pull/1052
+    (const type_description_interfaces__msg__TypeDescription *) description,
+    &new_entry->type_hash);
+  if (RCL_RET_OK != ret) {
+    impl->allocator.deallocate(new_entry, impl->allocator.state);
+    return ret;  // error already set
+  }
+  // Grow at 3/4 load before inserting the entry.
+  if (4 * (impl->count + 1) > 3 * impl->capacity) {
+    ret = __type_registry_grow(impl);
+    if (RCL_RET_OK != ret) {
+      impl->allocator.deallocate(new_entry, impl->allocator.state);
+      return ret;  // error already set
+    }
+  }
+  __type_registry_insert(impl, new_entry);
+  *type_hash = &new_entry->type_hash;
+  return RCL_RET_OK;
+}
+
+rcl_ret_t
+rcl_type_registry_get_count(const rcl_type_registry_t * registry, size_t * count)
+{
+  RCL_CHECK_ARGUMENT_FOR_NULL(registry, RCL_RET_INVALID_ARGUMENT);
+  RCL_CHECK_FOR_NULL_WITH_MSG(
+    registry->impl, "type registry is invalid", return RCL_RET_INVALID_ARGUMENT);
+  RCL_CHECK_ARGUMENT_FOR_NULL(count, RCL_RET_INVALID_ARGUMENT);
+  *count = registry->impl->count;
+  return RCL_RET_OK;
+}
+
+#ifdef __cplusplus
+}
+#endif
@@ -14,18 +14,42 @@
 
 #include "rcl/validate_enclave_name.h"
 
-#include <ctype.h>
-#include <stdio.h>
+#include <stdbool.h>
+#include <stdint.h>
 #include <string.h>
 
 #include <rcutils/macros.h>
-#include <rcutils/snprintf.h>
-
-#include "rmw/validate_namespace.h"
 
 #include "rcl/error_handling.h"
 
-#include "./common.h"
+/// Character class bits for the single-pass validator.
+#define ENCLAVE_CHAR_ALNUM 1u
+#define ENCLAVE_CHAR_DIGIT 2u
+#define ENCLAVE_CHAR_UNDERSCORE 4u
+#define ENCLAVE_CHAR_SLASH 8u
+#define ENCLAVE_CHAR_ALLOWED \
+  (ENCLAVE_CHAR_ALNUM | ENCLAVE_CHAR_UNDERSCORE | ENCLAVE_CHAR_SLASH)
+
+/// Classifies every byte with one table lookup instead of branching per
+/// character class; bytes outside [A-Za-z0-9_/] are 0.
+static const uint8_t g_enclave_name_char_class[256] = {
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,  // 0x00 - 0x0f
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,  // 0x10 - 0x1f
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 8,  // 0x20 - 0x2f
+  3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 0, 0, 0, 0, 0, 0,  // 0x30 - 0x3f
+  0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,  // 0x40 - 0x4f
+  1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 0, 0, 0, 4,  // 0x50 - 0x5f
+  0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,  // 0x60 - 0x6f
+  1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 0, 0, 0, 0,  // 0x70 - 0x7f
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,  // 0x80 - 0x8f
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,  // 0x90 - 0x9f
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,  // 0xa0 - 0xaf
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,  // 0xb0 - 0xbf
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,  // 0xc0 - 0xcf
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,  // 0xd0 - 0xdf
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,  // 0xe0 - 0xef
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,  // 0xf0 - 0xff
+};
 
 rcl_ret_t
 rcl_validate_enclave_name(
@@ -46,80 +70,79 @@ rcl_validate_enclave_name_with_size(
   size_t * invalid_index)
 {
   RCUTILS_CAN_SET_MSG_AND_RETURN_WITH_ERROR_OF(RCL_RET_INVALID_ARGUMENT);
-  RCUTILS_CAN_SET_MSG_AND_RETURN_WITH_ERROR_OF(RCL_RET_ERROR);
 
   RCL_CHECK_ARGUMENT_FOR_NULL(enclave, RCL_RET_INVALID_ARGUMENT);
   RCL_CHECK_ARGUMENT_FOR_NULL(validation_result, RCL_RET_INVALID_ARGUMENT);
 
-  int tmp_validation_result;
-  size_t tmp_invalid_index;
-  rmw_ret_t ret = rmw_validate_namespace_with_size(
-    enclave, enclave_length, &tmp_validation_result, &tmp_invalid_index);
-  if (ret != RMW_RET_OK) {
-    return rcl_convert_rmw_ret_to_rcl_ret(ret);
+  // Single pass over the name with one character class lookup per byte,
+  // instead of delegating to rmw namespace validation; enclaves are validated
+  // on every secure context init.
+  if (0 == enclave_length) {
+    *validation_result = RCL_ENCLAVE_NAME_INVALID_IS_EMPTY_STRING;
+    if (invalid_index) {
+      *invalid_index = 0;
+    }
+    return RCL_RET_OK;
   }
 
-  if (tmp_validation_result != RMW_NAMESPACE_VALID &&
-    tmp_validation_result != RMW_NAMESPACE_INVALID_TOO_LONG)
-  {
-    switch (tmp_validation_result) {
-      case RMW_NAMESPACE_INVALID_IS_EMPTY_STRING:
-        *validation_result = RCL_ENCLAVE_NAME_INVALID_IS_EMPTY_STRING;
-        break;
-      case RMW_NAMESPACE_INVALID_NOT_ABSOLUTE:
-        *validation_result = RCL_ENCLAVE_NAME_INVALID_NOT_ABSOLUTE;
-        break;
-      case RMW_NAMESPACE_INVALID_ENDS_WITH_FORWARD_SLASH:
-        *validation_result = RCL_ENCLAVE_NAME_INVALID_ENDS_WITH_FORWARD_SLASH;
-        break;
-      case RMW_NAMESPACE_INVALID_CONTAINS_UNALLOWED_CHARACTERS:
-        *validation_result = RCL_ENCLAVE_NAME_INVALID_CONTAINS_UNALLOWED_CHARACTERS;
-        break;
-      case RMW_NAMESPACE_INVALID_CONTAINS_REPEATED_FORWARD_SLASH:
-        *validation_result = RCL_ENCLAVE_NAME_INVALID_CONTAINS_REPEATED_FORWARD_SLASH;
-        break;
-      case RMW_NAMESPACE_INVALID_NAME_TOKEN_STARTS_WITH_NUMBER:
-        *validation_result = RCL_ENCLAVE_NAME_INVALID_NAME_TOKEN_STARTS_WITH_NUMBER;
-        break;
-      default:
-        {
-          char default_err_msg[256];
-          // explicitly not taking return value which is number of bytes written
-          int ret = rcutils_snprintf(
-            default_err_msg, sizeof(default_err_msg),
-            "rcl_validate_enclave_name_with_size(): "
-            "unknown rmw_validate_namespace_with_size() result '%d'",
-            tmp_validation_result);
-          if (ret < 0) {
-            RCL_SET_ERROR_MSG(
-              "rcl_validate_enclave_name_with_size(): "
-              "rcutils_snprintf() failed while reporting an unknown validation result");
-          } else {
-            RCL_SET_ERROR_MSG(default_err_msg);
-          }
-        }
-        return RCL_RET_ERROR;
+  if ('/' != enclave[0]) {
+    *validation_result = RCL_ENCLAVE_NAME_INVALID_NOT_ABSOLUTE;
+    if (invalid_index) {
+      *invalid_index = 0;
     }
+    return RCL_RET_OK;
+  }
+
+  // catches "/foo/" but not "/", which is a valid enclave name
+  if (enclave_length > 1 && '/' == enclave[enclave_length - 1]) {
+    *validation_result = RCL_ENCLAVE_NAME_INVALID_ENDS_WITH_FORWARD_SLASH;
     if (invalid_index) {
-      *invalid_index = tmp_invalid_index;
+      *invalid_index = enclave_length - 1;
     }
     return RCL_RET_OK;
   }
 
-  // enclave might be longer that namespace length, check false positives and correct
-  if (RMW_NAMESPACE_INVALID_TOO_LONG == tmp_validation_result) {
-    if (RCL_ENCLAVE_NAME_MAX_LENGTH >= enclave_length) {
-      *validation_result = RCL_ENCLAVE_NAME_VALID;
-    } else {
-      *validation_result = RCL_ENCLAVE_NAME_INVALID_TOO_LONG;
+  bool previous_was_slash = true;  // enclave[0] is '/'
+  for (size_t i = 1; i < enclave_length; ++i) {
+    uint8_t char_class = g_enclave_name_char_class[(unsigned char)enclave[i]];
+    if (0u == (char_class & ENCLAVE_CHAR_ALLOWED)) {
+      *validation_result = RCL_ENCLAVE_NAME_INVALID_CONTAINS_UNALLOWED_CHARACTERS;
       if (invalid_index) {
-        *invalid_index = RCL_ENCLAVE_NAME_MAX_LENGTH - 1;
+        *invalid_index = i;
       }
+      return RCL_RET_OK;
+    }
+    if (0u != (char_class & ENCLAVE_CHAR_SLASH)) {
+      if (previous_was_slash) {
+        *validation_result = RCL_ENCLAVE_NAME_INVALID_CONTAINS_REPEATED_FORWARD_SLASH;
+        if (invalid_index) {
+          *invalid_index = i;
+        }
+        return RCL_RET_OK;
+      }
+      previous_was_slash = true;
+      continue;
+    }
+    if (previous_was_slash && 0u != (char_class & ENCLAVE_CHAR_DIGIT)) {
+      *validation_result = RCL_ENCLAVE_NAME_INVALID_NAME_TOKEN_STARTS_WITH_NUMBER;
+      if (invalid_index) {
+        *invalid_index = i;
+      }
+      return RCL_RET_OK;
+    }
+    previous_was_slash = false;
+  }
+
+  // check length last, like the other structural checks above take precedence
+  if (enclave_length > RCL_ENCLAVE_NAME_MAX_LENGTH) {
+    *validation_result = RCL_ENCLAVE_NAME_INVALID_TOO_LONG;
+    if (invalid_index) {
+      *invalid_index = RCL_ENCLAVE_NAME_MAX_LENGTH - 1;
     }
     return RCL_RET_OK;
   }
 
-  // everything was ok, set result to valid namespace, avoid setting invalid_index, and return
+  // everything was ok, set result to valid enclave name, avoid setting invalid_index, and return
   *validation_result = RCL_ENCLAVE_NAME_VALID;
   return RCL_RET_OK;
 }
@@ -22,17 +22,35 @@ extern "C"
 #include <assert.h>
 #include <inttypes.h>
 #include <stdbool.h>
+#include <stddef.h>
 #include <string.h>
 
+#if defined(_MSC_VER)
+#include <intrin.h>  // for _BitScanForward64
+#endif
+
 #include "rcl/error_handling.h"
+#include "rcl/publisher.h"
+#include "rcl/ready_queue.h"
 #include "rcl/time.h"
+#include "rcl/trace.h"
 #include "rcutils/logging_macros.h"
+#include "rcutils/stdatomic_helper.h"
+#include "rcutils/time.h"
 #include "rmw/error_handling.h"
 #include "rmw/rmw.h"
 #include "rmw/event.h"
 
 #include "./context_impl.h"
 
+/// One registered publisher ack watch; see rcl_wait_set_add_ack_watch().
+typedef struct rcl_wait_set_ack_watch_s
+{
+  const rcl_publisher_t * publisher;
+  rcl_guard_condition_t * guard_condition;
+  int64_t poll_period;
+} rcl_wait_set_ack_watch_t;
+
 struct rcl_wait_set_impl_s
 {
   // number of subscriptions that have been added to the wait set
@@ -58,8 +76,262 @@ struct rcl_wait_set_impl_s
   rcl_context_t * context;
   // allocator used in the wait set
   rcl_allocator_t allocator;
+
+  // single contiguous block out of which all of the user facing and rmw
+  // pointer arrays are carved, so that a resize is one reallocation and the
+  // arrays are cache-adjacent for the scan loops in rcl_wait()
+  void * storage_arena;
+  size_t storage_arena_size;
+
+  // allocated capacity of each entity class; always at least the
+  // corresponding size_of_* on the wait set and only ever grown, so that
+  // repeated resizes within capacity reuse the arena instead of
+  // reallocating it (see rcl_wait_set_reserve())
+  size_t subscriptions_capacity;
+  size_t guard_conditions_capacity;
+  size_t timers_capacity;
+  size_t clients_capacity;
+  size_t services_capacity;
+  size_t events_capacity;
+
+  // true if entity registrations persist across calls to rcl_wait()
+  bool persistent;
+  // true if the shadow arrays below reflect the registered entities
+  bool shadow_valid;
+
+  // coalesced notification facility: a single shared rmw guard condition
+  // wakes the wait set for up to 64 trigger sources, with one lock-free
+  // pending flag per source, so rmw wakeup fan-in scales with wait sets
+  // instead of with trigger sources
+  rmw_guard_condition_t * coalesced_guard_condition;
+  size_t coalesced_source_count;
+  atomic_int_least64_t * coalesced_pending;
+
+  // optional work-queue handoff: when attached, rcl_wait() pushes one entry
+  // per ready entity so worker threads pop work without re-scanning the
+  // wait set; see rcl_wait_set_attach_ready_queue()
+  rcl_ready_queue_t * ready_queue;
+
+  // one-shot publisher ack watches, probed without blocking at the start of
+  // each rcl_wait(); a watch triggers its guard condition and removes
+  // itself once the publisher's acks drain, see rcl_wait_set_add_ack_watch()
+  rcl_wait_set_ack_watch_t * ack_watches;
+  size_t ack_watch_count;
+  size_t ack_watch_capacity;
+
+  // optional instrumentation counters, accumulated with relaxed atomics by
+  // the thread calling rcl_wait() so that another thread can sample them
+  // through rcl_wait_set_get_statistics() without synchronization; they get
+  // their own cache line so the sampling thread does not bounce the lines
+  // holding the read-mostly configuration around them
+  bool statistics_enabled;
+  RCL_ALIGNAS(RCL_CACHE_LINE_SIZE) atomic_uint_least64_t stat_wait_count;
+  atomic_uint_least64_t stat_spurious_wake_count;
+  atomic_uint_least64_t stat_timer_wake_count;
+  atomic_uint_least64_t stat_rmw_wait_time_ns;
+  atomic_uint_least64_t stat_max_ready_batch_size;
+
+  // readiness bitmaps, one bit per entity slot, populated by rcl_wait() so
+  // callers can find ready entities with ctz scans instead of walking the
+  // entity arrays looking for non-NULL pointers
+  uint64_t * ready_bitmap_storage;
+  size_t ready_bitmap_words;
+  uint64_t * ready_subscriptions;
+  uint64_t * ready_guard_conditions;
+  uint64_t * ready_timers;
+  uint64_t * ready_clients;
+  uint64_t * ready_services;
+  uint64_t * ready_events;
+
+  // backing storage for the timer heap arrays below, kept separate from the
+  // pointer arena because the deadline keys are not pointer sized everywhere
+  void * timer_aux;
+  // binary min-heap over the added timers, keyed on absolute deadline
+  // snapshots, so the next wake deadline is found without scanning every
+  // timer; maintained across waits while in persistent mode
+  size_t * timer_heap;
+  size_t timer_heap_count;
+  bool timer_heap_valid;
+  // deadline snapshot per timer index, INT64_MAX for canceled timers
+  int64_t * timer_deadlines;
+  // timer indices reported ready by the previous wait, re-keyed lazily at
+  // the start of the next wait (their next call time changes when called)
+  size_t * timer_rekey;
+  size_t timer_rekey_count;
+  // clock used by all of the added timers; deadlines are only comparable
+  // when every timer uses the same clock type
+  rcl_clock_type_t timer_heap_clock_type;
+  rcl_clock_t * timer_heap_clock;
+  // true if the added timers mix clock types, which disables the heap
+  bool timer_heap_mixed_clocks;
+  // shadow copies of the user facing and rmw arrays, used to restore the
+  // wait set contents at the start of each wait while in persistent mode
+  const rcl_subscription_t ** shadow_subscriptions;
+  const rcl_guard_condition_t ** shadow_guard_conditions;
+  const rcl_timer_t ** shadow_timers;
+  const rcl_client_t ** shadow_clients;
+  const rcl_service_t ** shadow_services;
+  const rcl_event_t ** shadow_events;
+  void ** shadow_rmw_subscriptions;
+  void ** shadow_rmw_guard_conditions;
+  void ** shadow_rmw_clients;
+  void ** shadow_rmw_services;
+  void ** shadow_rmw_events;
+  size_t shadow_subscription_index;
+  size_t shadow_guard_condition_index;
+  size_t shadow_timer_index;
+  size_t shadow_client_index;
+  size_t shadow_service_index;
+  size_t shadow_event_index;
+  size_t shadow_rmw_subscription_count;
+  size_t shadow_rmw_guard_condition_count;
+  size_t shadow_rmw_client_count;
+  size_t shadow_rmw_service_count;
+  size_t shadow_rmw_event_count;
 };
 
+// Pin the layout so a refactor cannot silently reintroduce false sharing
+// between the sampled statistics and the surrounding configuration.
+static_assert(
+  offsetof(struct rcl_wait_set_impl_s, stat_wait_count) % RCL_CACHE_LINE_SIZE == 0,
+  "wait set statistics counters must start on a cache line boundary");
+
+static void
+__coalescing_fini(rcl_wait_set_t * wait_set);
+
+// Reallocate a shadow array to hold count entries and copy src into it.
+static rcl_ret_t
+__shadow_array_sync(
+  const rcl_allocator_t * allocator,
+  void *** shadow,
+  void * const * src,
+  size_t count)
+{
+  if (0 == count) {
+    if (*shadow) {
+      allocator->deallocate((void *)*shadow, allocator->state);
+      *shadow = NULL;
+    }
+    return RCL_RET_OK;
+  }
+  *shadow = (void **)allocator->reallocate(
+    (void *)*shadow, sizeof(void *) * count, allocator->state);
+  RCL_CHECK_FOR_NULL_WITH_MSG(
+    *shadow, "allocating memory failed", return RCL_RET_BAD_ALLOC);
+  memcpy((void *)*shadow, (const void *)src, sizeof(void *) * count);
+  return RCL_RET_OK;
+}
+
+static void
+__shadow_storage_fini(rcl_wait_set_t * wait_set)
+{
+  rcl_allocator_t * allocator = &wait_set->impl->allocator;
+#define SHADOW_FREE(Member) \
+  if (wait_set->impl->Member) { \
+    allocator->deallocate((void *)wait_set->impl->Member, allocator->state); \
+    wait_set->impl->Member = NULL; \
+  }
+  SHADOW_FREE(shadow_subscriptions)
+  SHADOW_FREE(shadow_guard_conditions)
+  SHADOW_FREE(shadow_timers)
+  SHADOW_FREE(shadow_clients)
+  SHADOW_FREE(shadow_services)
+  SHADOW_FREE(shadow_events)
+  SHADOW_FREE(shadow_rmw_subscriptions)
+  SHADOW_FREE(shadow_rmw_guard_conditions)
+  SHADOW_FREE(shadow_rmw_clients)
+  SHADOW_FREE(shadow_rmw_services)
+  SHADOW_FREE(shadow_rmw_events)
+#undef SHADOW_FREE
+  wait_set->impl->shadow_valid = false;
+}
+
+// Snapshot the current wait set contents into the shadow arrays.
+static rcl_ret_t
+__shadow_storage_snapshot(rcl_wait_set_t * wait_set)
+{
+  rcl_wait_set_impl_t * impl = wait_set->impl;
+  const rcl_allocator_t * allocator = &impl->allocator;
+  rcl_ret_t ret;
+#define SHADOW_SYNC(Shadow, Src, Count) \
+  ret = __shadow_array_sync( \
+    allocator, (void ***)&impl->Shadow, (void * const *)Src, Count); \
+  if (RCL_RET_OK != ret) { \
+    __shadow_storage_fini(wait_set); \
+    return ret; \
+  }
+  SHADOW_SYNC(shadow_subscriptions, wait_set->subscriptions, wait_set->size_of_subscriptions)
+  SHADOW_SYNC(
+    shadow_guard_conditions, wait_set->guard_conditions, wait_set->size_of_guard_conditions)
+  SHADOW_SYNC(shadow_timers, wait_set->timers, wait_set->size_of_timers)
+  SHADOW_SYNC(shadow_clients, wait_set->clients, wait_set->size_of_clients)
+  SHADOW_SYNC(shadow_services, wait_set->services, wait_set->size_of_services)
+  SHADOW_SYNC(shadow_events, wait_set->events, wait_set->size_of_events)
+  SHADOW_SYNC(
+    shadow_rmw_subscriptions, impl->rmw_subscriptions.subscribers,
+    wait_set->size_of_subscriptions)
+  SHADOW_SYNC(
+    shadow_rmw_guard_conditions, impl->rmw_guard_conditions.guard_conditions,
+    wait_set->size_of_guard_conditions + wait_set->size_of_timers)
+  SHADOW_SYNC(shadow_rmw_clients, impl->rmw_clients.clients, wait_set->size_of_clients)
+  SHADOW_SYNC(shadow_rmw_services, impl->rmw_services.services, wait_set->size_of_services)
+  SHADOW_SYNC(shadow_rmw_events, impl->rmw_events.events, wait_set->size_of_events)
+#undef SHADOW_SYNC
+  impl->shadow_subscription_index = impl->subscription_index;
+  impl->shadow_guard_condition_index = impl->guard_condition_index;
+  impl->shadow_timer_index = impl->timer_index;
+  impl->shadow_client_index = impl->client_index;
+  impl->shadow_service_index = impl->service_index;
+  impl->shadow_event_index = impl->event_index;
+  impl->shadow_rmw_subscription_count = impl->rmw_subscriptions.subscriber_count;
+  impl->shadow_rmw_guard_condition_count = impl->rmw_guard_conditions.guard_condition_count;
+  impl->shadow_rmw_client_count = impl->rmw_clients.client_count;
+  impl->shadow_rmw_service_count = impl->rmw_services.service_count;
+  impl->shadow_rmw_event_count = impl->rmw_events.event_count;
+  impl->shadow_valid = true;
+  return RCL_RET_OK;
+}
+
+// Restore the wait set contents from the shadow arrays, undoing the result
+// pruning done by the previous rcl_wait().
+static void
+__shadow_storage_restore(rcl_wait_set_t * wait_set)
+{
+  rcl_wait_set_impl_t * impl = wait_set->impl;
+#define SHADOW_RESTORE(Dst, Shadow, Count) \
+  if (Count != 0) { \
+    memcpy((void *)Dst, (const void *)impl->Shadow, sizeof(void *) * Count); \
+  }
+  SHADOW_RESTORE(wait_set->subscriptions, shadow_subscriptions, wait_set->size_of_subscriptions)
+  SHADOW_RESTORE(
+    wait_set->guard_conditions, shadow_guard_conditions, wait_set->size_of_guard_conditions)
+  SHADOW_RESTORE(wait_set->timers, shadow_timers, wait_set->size_of_timers)
+  SHADOW_RESTORE(wait_set->clients, shadow_clients, wait_set->size_of_clients)
+  SHADOW_RESTORE(wait_set->services, shadow_services, wait_set->size_of_services)
+  SHADOW_RESTORE(wait_set->events, shadow_events, wait_set->size_of_events)
+  SHADOW_RESTORE(
+    impl->rmw_subscriptions.subscribers, shadow_rmw_subscriptions,
+    wait_set->size_of_subscriptions)
+  SHADOW_RESTORE(
+    impl->rmw_guard_conditions.guard_conditions, shadow_rmw_guard_conditions,
+    wait_set->size_of_guard_conditions + wait_set->size_of_timers)
+  SHADOW_RESTORE(impl->rmw_clients.clients, shadow_rmw_clients, wait_set->size_of_clients)
+  SHADOW_RESTORE(impl->rmw_services.services, shadow_rmw_services, wait_set->size_of_services)
+  SHADOW_RESTORE(impl->rmw_events.events, shadow_rmw_events, wait_set->size_of_events)
+#undef SHADOW_RESTORE
+  impl->subscription_index = impl->shadow_subscription_index;
+  impl->guard_condition_index = impl->shadow_guard_condition_index;
+  impl->timer_index = impl->shadow_timer_index;
+  impl->client_index = impl->shadow_client_index;
+  impl->service_index = impl->shadow_service_index;
+  impl->event_index = impl->shadow_event_index;
+  impl->rmw_subscriptions.subscriber_count = impl->shadow_rmw_subscription_count;
+  impl->rmw_guard_conditions.guard_condition_count = impl->shadow_rmw_guard_condition_count;
+  impl->rmw_clients.client_count = impl->shadow_rmw_client_count;
+  impl->rmw_services.service_count = impl->shadow_rmw_service_count;
+  impl->rmw_events.event_count = impl->shadow_rmw_event_count;
+}
+
 rcl_wait_set_t
 rcl_get_zero_initialized_wait_set()
 {
@@ -94,6 +366,12 @@ __wait_set_clean_up(rcl_wait_set_t * wait_set)
   (void)ret;  // NO LINT
   assert(RCL_RET_OK == ret);  // Defensive, shouldn't fail with size 0.
   if (wait_set->impl) {
+    __shadow_storage_fini(wait_set);
+    if (wait_set->impl->ack_watches) {
+      wait_set->impl->allocator.deallocate(
+        wait_set->impl->ack_watches, wait_set->impl->allocator.state);
+      wait_set->impl->ack_watches = NULL;
+    }
     wait_set->impl->allocator.deallocate(wait_set->impl, wait_set->impl->allocator.state);
     wait_set->impl = NULL;
   }
@@ -160,6 +438,15 @@ rcl_wait_set_init(
     number_of_services +
     number_of_events;
 
+  // create the rmw context now if its creation was deferred during init
+  {
+    rcl_ret_t ensure_ret = rcl_context_ensure_rmw_context(context);
+    if (RCL_RET_OK != ensure_ret) {
+      fail_ret = ensure_ret;
+      goto fail;
+    }
+  }
+
   wait_set->impl->rmw_wait_set = rmw_create_wait_set(&(context->impl->rmw_context), num_conditions);
   if (!wait_set->impl->rmw_wait_set) {
     goto fail;
@@ -192,6 +479,7 @@ rcl_wait_set_fini(rcl_wait_set_t * wait_set)
   RCL_CHECK_ARGUMENT_FOR_NULL(wait_set, RCL_RET_INVALID_ARGUMENT);
 
   if (rcl_wait_set_is_valid(wait_set)) {
+    __coalescing_fini(wait_set);
     rmw_ret_t ret = rmw_destroy_wait_set(wait_set->impl->rmw_wait_set);
     if (ret != RMW_RET_OK) {
       RCL_SET_ERROR_MSG(rmw_get_error_string().str);
@@ -228,6 +516,7 @@ rcl_wait_set_get_allocator(const rcl_wait_set_t * wait_set, rcl_allocator_t * al
   } \
   size_t current_index = wait_set->impl->Type ## _index++; \
   wait_set->Type ## s[current_index] = Type; \
+  wait_set->impl->shadow_valid = false; \
   /* Set optional output argument */ \
   if (NULL != index) { \
     *index = current_index; \
@@ -241,6 +530,9 @@ rcl_wait_set_get_allocator(const rcl_wait_set_t * wait_set, rcl_allocator_t * al
   wait_set->impl->RMWStorage[current_index] = rmw_handle->data; \
   wait_set->impl->RMWCount++;
 
+#define SET_READY_BIT(Bitmap, Index) \
+  (wait_set->impl->Bitmap[(Index) / 64] |= UINT64_C(1) << ((Index) % 64))
+
 #define SET_CLEAR(Type) \
   do { \
     if (NULL != wait_set->Type ## s) { \
@@ -264,50 +556,251 @@ rcl_wait_set_get_allocator(const rcl_wait_set_t * wait_set, rcl_allocator_t * al
     } \
   } while (false)
 
-#define SET_RESIZE(Type, ExtraDealloc, ExtraRealloc) \
-  do { \
-    rcl_allocator_t allocator = wait_set->impl->allocator; \
-    wait_set->size_of_ ## Type ## s = 0; \
-    wait_set->impl->Type ## _index = 0; \
-    if (0 == Type ## s_size) { \
-      if (wait_set->Type ## s) { \
-        allocator.deallocate((void *)wait_set->Type ## s, allocator.state); \
-        wait_set->Type ## s = NULL; \
-      } \
-      ExtraDealloc \
-    } else { \
-      wait_set->Type ## s = (const rcl_ ## Type ## _t **)allocator.reallocate( \
-        (void *)wait_set->Type ## s, sizeof(rcl_ ## Type ## _t *) * Type ## s_size, \
-        allocator.state); \
-      RCL_CHECK_FOR_NULL_WITH_MSG( \
-        wait_set->Type ## s, "allocating memory failed", return RCL_RET_BAD_ALLOC); \
-      memset((void *)wait_set->Type ## s, 0, sizeof(rcl_ ## Type ## _t *) * Type ## s_size); \
-      wait_set->size_of_ ## Type ## s = Type ## s_size; \
-      ExtraRealloc \
-    } \
-  } while (false)
+static void
+__timer_heap_sift_up(rcl_wait_set_impl_t * impl, size_t pos)
+{
+  while (pos > 0) {
+    size_t parent = (pos - 1) / 2;
+    if (impl->timer_deadlines[impl->timer_heap[pos]] >=
+      impl->timer_deadlines[impl->timer_heap[parent]])
+    {
+      break;
+    }
+    size_t tmp = impl->timer_heap[pos];
+    impl->timer_heap[pos] = impl->timer_heap[parent];
+    impl->timer_heap[parent] = tmp;
+    pos = parent;
+  }
+}
 
-#define SET_RESIZE_RMW_DEALLOC(RMWStorage, RMWCount) \
-  /* Also deallocate the rmw storage. */ \
-  if (wait_set->impl->RMWStorage) { \
-    allocator.deallocate((void *)wait_set->impl->RMWStorage, allocator.state); \
-    wait_set->impl->RMWStorage = NULL; \
-    wait_set->impl->RMWCount = 0; \
-  }
-
-#define SET_RESIZE_RMW_REALLOC(Type, RMWStorage, RMWCount) \
-  /* Also resize the rmw storage. */ \
-  wait_set->impl->RMWCount = 0; \
-  wait_set->impl->RMWStorage = (void **)allocator.reallocate( \
-    wait_set->impl->RMWStorage, sizeof(void *) * Type ## s_size, allocator.state); \
-  if (!wait_set->impl->RMWStorage) { \
-    allocator.deallocate((void *)wait_set->Type ## s, allocator.state); \
-    wait_set->Type ## s = NULL; \
-    wait_set->size_of_ ## Type ## s = 0; \
-    RCL_SET_ERROR_MSG("allocating memory failed"); \
-    return RCL_RET_BAD_ALLOC; \
-  } \
-  memset(wait_set->impl->RMWStorage, 0, sizeof(void *) * Type ## s_size);
+static void
+__timer_heap_sift_down(rcl_wait_set_impl_t * impl, size_t pos)
+{
+  while (true) {
+    size_t smallest = pos;
+    size_t left = 2 * pos + 1;
+    size_t right = 2 * pos + 2;
+    if (left < impl->timer_heap_count &&
+      impl->timer_deadlines[impl->timer_heap[left]] <
+      impl->timer_deadlines[impl->timer_heap[smallest]])
+    {
+      smallest = left;
+    }
+    if (right < impl->timer_heap_count &&
+      impl->timer_deadlines[impl->timer_heap[right]] <
+      impl->timer_deadlines[impl->timer_heap[smallest]])
+    {
+      smallest = right;
+    }
+    if (smallest == pos) {
+      break;
+    }
+    size_t tmp = impl->timer_heap[pos];
+    impl->timer_heap[pos] = impl->timer_heap[smallest];
+    impl->timer_heap[smallest] = tmp;
+    pos = smallest;
+  }
+}
+
+// Compute the absolute deadline snapshot of a timer on its own clock.
+// Canceled timers get a deadline of INT64_MAX.
+static rcl_ret_t
+__timer_deadline(const rcl_timer_t * timer, rcl_clock_t * clock, int64_t * deadline)
+{
+  int64_t time_until = 0;
+  rcl_ret_t ret = rcl_timer_get_time_until_next_call(timer, &time_until);
+  if (RCL_RET_TIMER_CANCELED == ret) {
+    *deadline = INT64_MAX;
+    return RCL_RET_OK;
+  }
+  if (RCL_RET_OK != ret) {
+    return ret;
+  }
+  rcl_time_point_value_t now = 0;
+  ret = rcl_clock_get_now(clock, &now);
+  if (RCL_RET_OK != ret) {
+    return ret;
+  }
+  if (time_until > INT64_MAX - now) {
+    *deadline = INT64_MAX;  // avoid overflow for far-future deadlines
+  } else {
+    *deadline = now + time_until;
+  }
+  return RCL_RET_OK;
+}
+
+// (Re)build the timer heap from the currently added timers.
+// Sets timer_heap_mixed_clocks and leaves the heap invalid if the timers do
+// not share a clock type, in which case the linear scan is used instead.
+static rcl_ret_t
+__timer_heap_rebuild(rcl_wait_set_t * wait_set)
+{
+  rcl_wait_set_impl_t * impl = wait_set->impl;
+  impl->timer_heap_count = 0;
+  impl->timer_rekey_count = 0;
+  impl->timer_heap_valid = false;
+  impl->timer_heap_mixed_clocks = false;
+  impl->timer_heap_clock = NULL;
+  for (size_t i = 0; i < impl->timer_index; ++i) {
+    if (!wait_set->timers[i]) {
+      continue;
+    }
+    rcl_clock_t * clock = NULL;
+    rcl_ret_t ret = rcl_timer_clock((rcl_timer_t *)wait_set->timers[i], &clock);
+    if (RCL_RET_OK != ret) {
+      return ret;
+    }
+    if (NULL == impl->timer_heap_clock) {
+      impl->timer_heap_clock = clock;
+      impl->timer_heap_clock_type = clock->type;
+    } else if (clock->type != impl->timer_heap_clock_type) {
+      // Deadlines on different clock types are not comparable.
+      impl->timer_heap_mixed_clocks = true;
+      impl->timer_heap_count = 0;
+      return RCL_RET_OK;
+    }
+    ret = __timer_deadline(wait_set->timers[i], clock, &impl->timer_deadlines[i]);
+    if (RCL_RET_OK != ret) {
+      return ret;
+    }
+    impl->timer_heap[impl->timer_heap_count++] = i;
+    __timer_heap_sift_up(impl, impl->timer_heap_count - 1);
+  }
+  impl->timer_heap_valid = true;
+  return RCL_RET_OK;
+}
+
+// Re-key the timers reported ready by the previous wait; they are the only
+// ones whose next call time can have changed since the heap was built.
+static rcl_ret_t
+__timer_heap_rekey(rcl_wait_set_t * wait_set)
+{
+  rcl_wait_set_impl_t * impl = wait_set->impl;
+  for (size_t r = 0; r < impl->timer_rekey_count; ++r) {
+    size_t timer_index = impl->timer_rekey[r];
+    if (!wait_set->timers[timer_index]) {
+      continue;
+    }
+    int64_t deadline = 0;
+    rcl_ret_t ret = __timer_deadline(
+      wait_set->timers[timer_index], impl->timer_heap_clock, &deadline);
+    if (RCL_RET_OK != ret) {
+      return ret;
+    }
+    int64_t old_deadline = impl->timer_deadlines[timer_index];
+    impl->timer_deadlines[timer_index] = deadline;
+    // Find the heap position of the timer and restore the heap property.
+    for (size_t pos = 0; pos < impl->timer_heap_count; ++pos) {
+      if (impl->timer_heap[pos] == timer_index) {
+        if (deadline < old_deadline) {
+          __timer_heap_sift_up(impl, pos);
+        } else {
+          __timer_heap_sift_down(impl, pos);
+        }
+        break;
+      }
+    }
+  }
+  impl->timer_rekey_count = 0;
+  return RCL_RET_OK;
+}
+
+// Visit heap entries whose deadline snapshot is at or before the threshold.
+// By the heap property, children of an unexpired entry are also unexpired,
+// so only expired timers and the frontier below them are touched.
+static void
+__timer_heap_collect_expired(
+  rcl_wait_set_impl_t * impl, int64_t threshold, size_t pos,
+  size_t * expired, size_t * expired_count)
+{
+  if (pos >= impl->timer_heap_count) {
+    return;
+  }
+  size_t timer_index = impl->timer_heap[pos];
+  if (impl->timer_deadlines[timer_index] > threshold) {
+    return;
+  }
+  expired[(*expired_count)++] = timer_index;
+  __timer_heap_collect_expired(impl, threshold, 2 * pos + 1, expired, expired_count);
+  __timer_heap_collect_expired(impl, threshold, 2 * pos + 2, expired, expired_count);
+}
+
+// Set every array pointer, size and count of the wait set to empty.
+static void
+__wait_set_null_arrays(rcl_wait_set_t * wait_set)
+{
+  wait_set->subscriptions = NULL;
+  wait_set->size_of_subscriptions = 0;
+  wait_set->guard_conditions = NULL;
+  wait_set->size_of_guard_conditions = 0;
+  wait_set->timers = NULL;
+  wait_set->size_of_timers = 0;
+  wait_set->clients = NULL;
+  wait_set->size_of_clients = 0;
+  wait_set->services = NULL;
+  wait_set->size_of_services = 0;
+  wait_set->events = NULL;
+  wait_set->size_of_events = 0;
+  wait_set->impl->subscription_index = 0;
+  wait_set->impl->guard_condition_index = 0;
+  wait_set->impl->timer_index = 0;
+  wait_set->impl->client_index = 0;
+  wait_set->impl->service_index = 0;
+  wait_set->impl->event_index = 0;
+  wait_set->impl->rmw_subscriptions.subscribers = NULL;
+  wait_set->impl->rmw_subscriptions.subscriber_count = 0;
+  wait_set->impl->rmw_guard_conditions.guard_conditions = NULL;
+  wait_set->impl->rmw_guard_conditions.guard_condition_count = 0;
+  wait_set->impl->rmw_clients.clients = NULL;
+  wait_set->impl->rmw_clients.client_count = 0;
+  wait_set->impl->rmw_services.services = NULL;
+  wait_set->impl->rmw_services.service_count = 0;
+  wait_set->impl->rmw_events.events = NULL;
+  wait_set->impl->rmw_events.event_count = 0;
+  wait_set->impl->ready_subscriptions = NULL;
+  wait_set->impl->ready_guard_conditions = NULL;
+  wait_set->impl->ready_timers = NULL;
+  wait_set->impl->ready_clients = NULL;
+  wait_set->impl->ready_services = NULL;
+  wait_set->impl->ready_events = NULL;
+  wait_set->impl->ready_bitmap_words = 0;
+  wait_set->impl->timer_heap = NULL;
+  wait_set->impl->timer_rekey = NULL;
+  wait_set->impl->timer_deadlines = NULL;
+  wait_set->impl->timer_heap_count = 0;
+  wait_set->impl->timer_rekey_count = 0;
+  wait_set->impl->timer_heap_valid = false;
+  wait_set->impl->timer_heap_mixed_clocks = false;
+  wait_set->impl->timer_heap_clock = NULL;
+}
+
+// Check whether any coalesced notification source is pending, without
+// consuming the pending flags.
+static bool
+__coalesced_pending_any(rcl_wait_set_impl_t * impl)
+{
+  for (size_t i = 0; i < impl->coalesced_source_count; ++i) {
+    if (0 != rcutils_atomic_load_int64_t(&impl->coalesced_pending[i])) {
+      return true;
+    }
+  }
+  return false;
+}
+
+// Count the set bits across all of the readiness bitmaps of the wait set.
+static uint64_t
+__wait_set_count_ready(const rcl_wait_set_impl_t * impl)
+{
+  uint64_t total = 0;
+  for (size_t i = 0; i < impl->ready_bitmap_words; ++i) {
+    uint64_t word = impl->ready_bitmap_storage[i];
+    while (word) {
+      word &= word - 1;
+      ++total;
+    }
+  }
+  return total;
+}
 
 /* Implementation-specific notes:
  *
@@ -364,14 +857,219 @@ rcl_wait_set_clear(rcl_wait_set_t * wait_set)
     rmw_events.events,
     rmw_events.event_count);
 
+  wait_set->impl->shadow_valid = false;
+  wait_set->impl->timer_heap_valid = false;
+  wait_set->impl->timer_heap_mixed_clocks = false;
+
   return RCL_RET_OK;
 }
 
 /* Implementation-specific notes:
  *
- * Similarly, the underlying rmw representation is reallocated and reset:
- * all entries are set to null and the count is set to zero.
+ * All of the user facing and rmw pointer arrays are carved out of a single
+ * contiguous arena, so a resize is a single reallocation and the arrays end
+ * up cache-adjacent for the scan loops in rcl_wait().
+ * The arena is allocated at the capacities stored on the impl, which are
+ * at least the requested sizes, so a resize within capacity only re-carves
+ * the existing storage without touching the allocator.
+ * The underlying rmw representation is reset along with the rcl arrays:
+ * all entries are set to null and the counts are set to zero.
  */
+static rcl_ret_t
+__wait_set_storage_resize(
+  rcl_wait_set_t * wait_set,
+  size_t subscriptions_size,
+  size_t guard_conditions_size,
+  size_t timers_size,
+  size_t clients_size,
+  size_t services_size,
+  size_t events_size)
+{
+  rcl_wait_set_impl_t * impl = wait_set->impl;
+  impl->shadow_valid = false;
+  rcl_allocator_t allocator = impl->allocator;
+
+  // The rmw guard condition array also holds the guard conditions of timers
+  // plus one slot for the coalesced notification guard condition.
+  const size_t num_rmw_gc = impl->guard_conditions_capacity + impl->timers_capacity + 1;
+  const size_t total_pointers =
+    (2 * impl->subscriptions_capacity) +
+    impl->guard_conditions_capacity + num_rmw_gc +
+    impl->timers_capacity +
+    (2 * impl->clients_capacity) +
+    (2 * impl->services_capacity) +
+    (2 * impl->events_capacity);
+
+  const size_t arena_size = sizeof(void *) * total_pointers;
+  if (arena_size != impl->storage_arena_size) {
+    void * arena = allocator.reallocate(
+      impl->storage_arena, arena_size, allocator.state);
+    if (!arena) {
+      // The old arena is still valid on reallocation failure; release it so
+      // the wait set is left empty but consistent.
+      if (impl->storage_arena) {
+        allocator.deallocate(impl->storage_arena, allocator.state);
+        impl->storage_arena = NULL;
+        impl->storage_arena_size = 0;
+      }
+      __wait_set_null_arrays(wait_set);
+      RCL_SET_ERROR_MSG("allocating memory failed");
+      return RCL_RET_BAD_ALLOC;
+    }
+    impl->storage_arena = arena;
+    impl->storage_arena_size = arena_size;
+  }
+  memset(impl->storage_arena, 0, arena_size);
+
+  // Auxiliary timer heap storage: deadlines first so they stay 8-byte
+  // aligned, followed by the heap and re-key index arrays.
+  void * timer_aux = impl->timer_aux;
+  const size_t aux_size =
+    impl->timers_capacity * (sizeof(int64_t) + 2 * sizeof(size_t));
+  if (aux_size) {
+    timer_aux = allocator.reallocate(timer_aux, aux_size, allocator.state);
+    if (!timer_aux) {
+      if (impl->timer_aux) {
+        allocator.deallocate(impl->timer_aux, allocator.state);
+      }
+      impl->timer_aux = NULL;
+      allocator.deallocate(impl->storage_arena, allocator.state);
+      impl->storage_arena = NULL;
+      impl->storage_arena_size = 0;
+      __wait_set_null_arrays(wait_set);
+      RCL_SET_ERROR_MSG("allocating memory failed");
+      return RCL_RET_BAD_ALLOC;
+    }
+  } else if (timer_aux) {
+    allocator.deallocate(timer_aux, allocator.state);
+    timer_aux = NULL;
+  }
+  impl->timer_aux = timer_aux;
+
+  // Readiness bitmaps, one word per 64 slots of each entity class.
+#define BITMAP_WORDS(size) (((size) + 63u) / 64u)
+  const size_t subscription_words = BITMAP_WORDS(impl->subscriptions_capacity);
+  const size_t guard_condition_words = BITMAP_WORDS(impl->guard_conditions_capacity);
+  const size_t timer_words = BITMAP_WORDS(impl->timers_capacity);
+  const size_t client_words = BITMAP_WORDS(impl->clients_capacity);
+  const size_t service_words = BITMAP_WORDS(impl->services_capacity);
+  const size_t event_words = BITMAP_WORDS(impl->events_capacity);
+#undef BITMAP_WORDS
+  const size_t total_words =
+    subscription_words + guard_condition_words + timer_words +
+    client_words + service_words + event_words;
+  uint64_t * bitmap_storage = impl->ready_bitmap_storage;
+  if (total_words != impl->ready_bitmap_words) {
+    bitmap_storage = (uint64_t *)allocator.reallocate(
+      impl->ready_bitmap_storage, sizeof(uint64_t) * total_words, allocator.state);
+    if (!bitmap_storage) {
+      allocator.deallocate(impl->storage_arena, allocator.state);
+      impl->storage_arena = NULL;
+      impl->storage_arena_size = 0;
+      if (impl->timer_aux) {
+        allocator.deallocate(impl->timer_aux, allocator.state);
+        impl->timer_aux = NULL;
+      }
+      if (impl->ready_bitmap_storage) {
+        allocator.deallocate(impl->ready_bitmap_storage, allocator.state);
+        impl->ready_bitmap_storage = NULL;
+      }
+      __wait_set_null_arrays(wait_set);
+      RCL_SET_ERROR_MSG("allocating memory failed");
+      return RCL_RET_BAD_ALLOC;
+    }
+    impl->ready_bitmap_storage = bitmap_storage;
+  }
+
+  __wait_set_null_arrays(wait_set);
+  impl->ready_bitmap_words = total_words;
+  memset(bitmap_storage, 0, sizeof(uint64_t) * total_words);
+  uint64_t * bitmap_cursor = bitmap_storage;
+  impl->ready_subscriptions = subscription_words ? bitmap_cursor : NULL;
+  bitmap_cursor += subscription_words;
+  impl->ready_guard_conditions = guard_condition_words ? bitmap_cursor : NULL;
+  bitmap_cursor += guard_condition_words;
+  impl->ready_timers = timer_words ? bitmap_cursor : NULL;
+  bitmap_cursor += timer_words;
+  impl->ready_clients = client_words ? bitmap_cursor : NULL;
+  bitmap_cursor += client_words;
+  impl->ready_services = service_words ? bitmap_cursor : NULL;
+  bitmap_cursor += service_words;
+  impl->ready_events = event_words ? bitmap_cursor : NULL;
+
+  if (impl->timers_capacity) {
+    impl->timer_deadlines = (int64_t *)timer_aux;
+    impl->timer_heap = (size_t *)(impl->timer_deadlines + impl->timers_capacity);
+    impl->timer_rekey = impl->timer_heap + impl->timers_capacity;
+  }
+
+  // Carve the arrays out of the arena, keeping each rcl array adjacent to its
+  // rmw counterpart. The cursor advances by capacity so the layout is stable
+  // across resizes within capacity; the user facing sizes track the request.
+  void ** cursor = (void **)impl->storage_arena;
+  if (impl->subscriptions_capacity) {
+    if (subscriptions_size) {
+      wait_set->subscriptions = (const rcl_subscription_t **)cursor;
+      impl->rmw_subscriptions.subscribers = cursor + impl->subscriptions_capacity;
+      wait_set->size_of_subscriptions = subscriptions_size;
+    }
+    cursor += 2 * impl->subscriptions_capacity;
+  }
+  if (impl->guard_conditions_capacity) {
+    if (guard_conditions_size) {
+      wait_set->guard_conditions = (const rcl_guard_condition_t **)cursor;
+      wait_set->size_of_guard_conditions = guard_conditions_size;
+    }
+    cursor += impl->guard_conditions_capacity;
+  }
+  impl->rmw_guard_conditions.guard_conditions = cursor;
+  cursor += num_rmw_gc;
+  if (impl->timers_capacity) {
+    if (timers_size) {
+      wait_set->timers = (const rcl_timer_t **)cursor;
+      wait_set->size_of_timers = timers_size;
+    }
+    cursor += impl->timers_capacity;
+  }
+  if (impl->clients_capacity) {
+    if (clients_size) {
+      wait_set->clients = (const rcl_client_t **)cursor;
+      impl->rmw_clients.clients = cursor + impl->clients_capacity;
+      wait_set->size_of_clients = clients_size;
+    }
+    cursor += 2 * impl->clients_capacity;
+  }
+  if (impl->services_capacity) {
+    if (services_size) {
+      wait_set->services = (const rcl_service_t **)cursor;
+      impl->rmw_services.services = cursor + impl->services_capacity;
+      wait_set->size_of_services = services_size;
+    }
+    cursor += 2 * impl->services_capacity;
+  }
+  if (impl->events_capacity) {
+    if (events_size) {
+      wait_set->events = (const rcl_event_t **)cursor;
+      impl->rmw_events.events = cursor + impl->events_capacity;
+      wait_set->size_of_events = events_size;
+    }
+    cursor += 2 * impl->events_capacity;
+  }
+
+  return RCL_RET_OK;
+}
+
+// Grow a capacity geometrically to cover size, never shrinking.
+static size_t
+__wait_set_grow_capacity(size_t capacity, size_t size)
+{
+  if (size <= capacity) {
+    return capacity;
+  }
+  const size_t doubled = 2 * capacity;
+  return size > doubled ? size : doubled;
+}
+
 rcl_ret_t
 rcl_wait_set_resize(
   rcl_wait_set_t * wait_set,
@@ -384,70 +1082,99 @@ rcl_wait_set_resize(
 {
   RCL_CHECK_ARGUMENT_FOR_NULL(wait_set, RCL_RET_INVALID_ARGUMENT);
   RCL_CHECK_ARGUMENT_FOR_NULL(wait_set->impl, RCL_RET_WAIT_SET_INVALID);
-  SET_RESIZE(
-    subscription,
-    SET_RESIZE_RMW_DEALLOC(
-      rmw_subscriptions.subscribers, rmw_subscriptions.subscriber_count),
-    SET_RESIZE_RMW_REALLOC(
-      subscription, rmw_subscriptions.subscribers, rmw_subscriptions.subscriber_count)
-  );
-  // Guard condition RCL size is the resize amount given
-  SET_RESIZE(guard_condition,;,;);  // NOLINT
-
-  // Guard condition RMW size needs to be guard conditions + timers
-  rmw_guard_conditions_t * rmw_gcs = &(wait_set->impl->rmw_guard_conditions);
-  const size_t num_rmw_gc = guard_conditions_size + timers_size;
-  // Clear added guard conditions
-  rmw_gcs->guard_condition_count = 0u;
-  if (0u == num_rmw_gc) {
-    if (rmw_gcs->guard_conditions) {
-      wait_set->impl->allocator.deallocate(
-        (void *)rmw_gcs->guard_conditions, wait_set->impl->allocator.state);
-      rmw_gcs->guard_conditions = NULL;
+  rcl_wait_set_impl_t * impl = wait_set->impl;
+  impl->shadow_valid = false;
+
+  const size_t total_sizes =
+    subscriptions_size + guard_conditions_size + timers_size +
+    clients_size + services_size + events_size;
+  if (0 == total_sizes) {
+    // Resizing everything away releases the storage and the reserved
+    // capacities with it; this is also the tear down path used by fini.
+    rcl_allocator_t allocator = impl->allocator;
+    if (impl->storage_arena) {
+      allocator.deallocate(impl->storage_arena, allocator.state);
+      impl->storage_arena = NULL;
+      impl->storage_arena_size = 0;
     }
-  } else {
-    rmw_gcs->guard_conditions = (void **)wait_set->impl->allocator.reallocate(
-      rmw_gcs->guard_conditions, sizeof(void *) * num_rmw_gc, wait_set->impl->allocator.state);
-    if (!rmw_gcs->guard_conditions) {
-      // Deallocate rcl arrays to match unallocated rmw guard conditions
-      wait_set->impl->allocator.deallocate(
-        (void *)wait_set->guard_conditions, wait_set->impl->allocator.state);
-      wait_set->size_of_guard_conditions = 0u;
-      wait_set->guard_conditions = NULL;
-      wait_set->impl->allocator.deallocate(
-        (void *)wait_set->timers, wait_set->impl->allocator.state);
-      wait_set->size_of_timers = 0u;
-      wait_set->timers = NULL;
-      RCL_SET_ERROR_MSG("allocating memory failed");
-      return RCL_RET_BAD_ALLOC;
+    if (impl->timer_aux) {
+      allocator.deallocate(impl->timer_aux, allocator.state);
+      impl->timer_aux = NULL;
     }
-    memset(rmw_gcs->guard_conditions, 0, sizeof(void *) * num_rmw_gc);
+    if (impl->ready_bitmap_storage) {
+      allocator.deallocate(impl->ready_bitmap_storage, allocator.state);
+      impl->ready_bitmap_storage = NULL;
+    }
+    impl->subscriptions_capacity = 0;
+    impl->guard_conditions_capacity = 0;
+    impl->timers_capacity = 0;
+    impl->clients_capacity = 0;
+    impl->services_capacity = 0;
+    impl->events_capacity = 0;
+    __wait_set_null_arrays(wait_set);
+    return RCL_RET_OK;
   }
 
-  SET_RESIZE(timer,;,;);  // NOLINT
-  SET_RESIZE(
-    client,
-    SET_RESIZE_RMW_DEALLOC(
-      rmw_clients.clients, rmw_clients.client_count),
-    SET_RESIZE_RMW_REALLOC(
-      client, rmw_clients.clients, rmw_clients.client_count)
-  );
-  SET_RESIZE(
-    service,
-    SET_RESIZE_RMW_DEALLOC(
-      rmw_services.services, rmw_services.service_count),
-    SET_RESIZE_RMW_REALLOC(
-      service, rmw_services.services, rmw_services.service_count)
-  );
-  SET_RESIZE(
-    event,
-    SET_RESIZE_RMW_DEALLOC(
-      rmw_events.events, rmw_events.event_count),
-    SET_RESIZE_RMW_REALLOC(
-      event, rmw_events.events, rmw_events.event_count)
-  );
+  impl->subscriptions_capacity =
+    __wait_set_grow_capacity(impl->subscriptions_capacity, subscriptions_size);
+  impl->guard_conditions_capacity =
+    __wait_set_grow_capacity(impl->guard_conditions_capacity, guard_conditions_size);
+  impl->timers_capacity =
+    __wait_set_grow_capacity(impl->timers_capacity, timers_size);
+  impl->clients_capacity =
+    __wait_set_grow_capacity(impl->clients_capacity, clients_size);
+  impl->services_capacity =
+    __wait_set_grow_capacity(impl->services_capacity, services_size);
+  impl->events_capacity =
+    __wait_set_grow_capacity(impl->events_capacity, events_size);
 
-  return RCL_RET_OK;
+  return __wait_set_storage_resize(
+    wait_set,
+    subscriptions_size, guard_conditions_size, timers_size,
+    clients_size, services_size, events_size);
+}
+
+rcl_ret_t
+rcl_wait_set_reserve(
+  rcl_wait_set_t * wait_set,
+  size_t subscriptions_capacity,
+  size_t guard_conditions_capacity,
+  size_t timers_capacity,
+  size_t clients_capacity,
+  size_t services_capacity,
+  size_t events_capacity)
+{
+  RCL_CHECK_ARGUMENT_FOR_NULL(wait_set, RCL_RET_INVALID_ARGUMENT);
+  RCL_CHECK_ARGUMENT_FOR_NULL(wait_set->impl, RCL_RET_WAIT_SET_INVALID);
+  rcl_wait_set_impl_t * impl = wait_set->impl;
+
+  // The parameters intentionally share names with the impl members so the
+  // macro can compare each requested capacity against the stored one.
+#define RAISE_CAPACITY(Member) \
+  if (Member > impl->Member) { \
+    impl->Member = Member; \
+  }
+  RAISE_CAPACITY(subscriptions_capacity)
+  RAISE_CAPACITY(guard_conditions_capacity)
+  RAISE_CAPACITY(timers_capacity)
+  RAISE_CAPACITY(clients_capacity)
+  RAISE_CAPACITY(services_capacity)
+  RAISE_CAPACITY(events_capacity)
+#undef RAISE_CAPACITY
+
+  const size_t total_capacity =
+    impl->subscriptions_capacity + impl->guard_conditions_capacity +
+    impl->timers_capacity + impl->clients_capacity +
+    impl->services_capacity + impl->events_capacity;
+  if (0 == total_capacity) {
+    return RCL_RET_OK;
+  }
+
+  return __wait_set_storage_resize(
+    wait_set,
+    wait_set->size_of_subscriptions, wait_set->size_of_guard_conditions,
+    wait_set->size_of_timers, wait_set->size_of_clients,
+    wait_set->size_of_services, wait_set->size_of_events);
 }
 
 rcl_ret_t
@@ -471,6 +1198,8 @@ rcl_wait_set_add_timer(
   size_t * index)
 {
   SET_ADD(timer)
+  wait_set->impl->timer_heap_valid = false;
+  wait_set->impl->timer_heap_mixed_clocks = false;
   // Add timer guard conditions to end of rmw guard condtion set.
   rcl_guard_condition_t * guard_condition = rcl_timer_get_guard_condition(timer);
   if (NULL != guard_condition) {
@@ -518,70 +1247,801 @@ rcl_wait_set_add_event(
   return RCL_RET_OK;
 }
 
+#define SET_REMOVE(Type) \
+  RCL_CHECK_ARGUMENT_FOR_NULL(wait_set, RCL_RET_INVALID_ARGUMENT); \
+  if (!wait_set->impl) { \
+    RCL_SET_ERROR_MSG("wait set is invalid"); \
+    return RCL_RET_WAIT_SET_INVALID; \
+  } \
+  if (!(index < wait_set->impl->Type ## _index)) { \
+    RCL_SET_ERROR_MSG("index is out of range of the added " #Type "s"); \
+    return RCL_RET_INVALID_ARGUMENT; \
+  } \
+  size_t last_index = --wait_set->impl->Type ## _index; \
+  wait_set->Type ## s[index] = wait_set->Type ## s[last_index]; \
+  wait_set->Type ## s[last_index] = NULL; \
+  wait_set->impl->shadow_valid = false;
+
+#define SET_REMOVE_RMW(RMWStorage, RMWCount) \
+  /* Also swap-remove from the rmw storage. */ \
+  wait_set->impl->RMWStorage[index] = wait_set->impl->RMWStorage[last_index]; \
+  wait_set->impl->RMWStorage[last_index] = NULL; \
+  wait_set->impl->RMWCount--;
+
+/* Implementation-specific notes:
+ *
+ * The last added entity is swapped into the vacated slot so removal is O(1)
+ * and the occupied region of the arrays stays dense.
+ */
+rcl_ret_t
+rcl_wait_set_remove_subscription(rcl_wait_set_t * wait_set, size_t index)
+{
+  SET_REMOVE(subscription)
+  SET_REMOVE_RMW(rmw_subscriptions.subscribers, rmw_subscriptions.subscriber_count)
+  return RCL_RET_OK;
+}
+
 rcl_ret_t
-rcl_wait(rcl_wait_set_t * wait_set, int64_t timeout)
+rcl_wait_set_remove_guard_condition(rcl_wait_set_t * wait_set, size_t index)
+{
+  SET_REMOVE(guard_condition)
+  SET_REMOVE_RMW(
+    rmw_guard_conditions.guard_conditions, rmw_guard_conditions.guard_condition_count)
+  return RCL_RET_OK;
+}
+
+rcl_ret_t
+rcl_wait_set_remove_timer(rcl_wait_set_t * wait_set, size_t index)
+{
+  SET_REMOVE(timer)
+  wait_set->impl->timer_heap_valid = false;
+  wait_set->impl->timer_heap_mixed_clocks = false;
+  // Also swap-remove the timer's guard condition slot, which lives past the
+  // guard condition region of the rmw guard condition array.
+  const size_t gc_offset = wait_set->size_of_guard_conditions;
+  wait_set->impl->rmw_guard_conditions.guard_conditions[gc_offset + index] =
+    wait_set->impl->rmw_guard_conditions.guard_conditions[gc_offset + last_index];
+  wait_set->impl->rmw_guard_conditions.guard_conditions[gc_offset + last_index] = NULL;
+  return RCL_RET_OK;
+}
+
+rcl_ret_t
+rcl_wait_set_remove_client(rcl_wait_set_t * wait_set, size_t index)
+{
+  SET_REMOVE(client)
+  SET_REMOVE_RMW(rmw_clients.clients, rmw_clients.client_count)
+  return RCL_RET_OK;
+}
+
+rcl_ret_t
+rcl_wait_set_remove_service(rcl_wait_set_t * wait_set, size_t index)
+{
+  SET_REMOVE(service)
+  SET_REMOVE_RMW(rmw_services.services, rmw_services.service_count)
+  return RCL_RET_OK;
+}
+
+rcl_ret_t
+rcl_wait_set_remove_event(rcl_wait_set_t * wait_set, size_t index)
+{
+  SET_REMOVE(event)
+  SET_REMOVE_RMW(rmw_events.events, rmw_events.event_count)
+  return RCL_RET_OK;
+}
+
+rcl_ret_t
+rcl_wait_set_get_ready_bitmap(
+  const rcl_wait_set_t * wait_set,
+  rcl_wait_set_entity_type_t entity_type,
+  const uint64_t ** bitmap,
+  size_t * number_of_words)
 {
   RCL_CHECK_ARGUMENT_FOR_NULL(wait_set, RCL_RET_INVALID_ARGUMENT);
-  if (!rcl_wait_set_is_valid(wait_set)) {
-    RCL_SET_ERROR_MSG("wait set is invalid");
-    return RCL_RET_WAIT_SET_INVALID;
-  }
-  if (
-    wait_set->size_of_subscriptions == 0 &&
-    wait_set->size_of_guard_conditions == 0 &&
-    wait_set->size_of_timers == 0 &&
-    wait_set->size_of_clients == 0 &&
-    wait_set->size_of_services == 0 &&
-    wait_set->size_of_events == 0)
-  {
-    RCL_SET_ERROR_MSG("wait set is empty");
-    return RCL_RET_WAIT_SET_EMPTY;
+  RCL_CHECK_ARGUMENT_FOR_NULL(wait_set->impl, RCL_RET_WAIT_SET_INVALID);
+  RCL_CHECK_ARGUMENT_FOR_NULL(bitmap, RCL_RET_INVALID_ARGUMENT);
+  RCL_CHECK_ARGUMENT_FOR_NULL(number_of_words, RCL_RET_INVALID_ARGUMENT);
+  size_t number_of_entities = 0;
+  switch (entity_type) {
+    case RCL_WAIT_SET_SUBSCRIPTION:
+      *bitmap = wait_set->impl->ready_subscriptions;
+      number_of_entities = wait_set->size_of_subscriptions;
+      break;
+    case RCL_WAIT_SET_GUARD_CONDITION:
+      *bitmap = wait_set->impl->ready_guard_conditions;
+      number_of_entities = wait_set->size_of_guard_conditions;
+      break;
+    case RCL_WAIT_SET_TIMER:
+      *bitmap = wait_set->impl->ready_timers;
+      number_of_entities = wait_set->size_of_timers;
+      break;
+    case RCL_WAIT_SET_CLIENT:
+      *bitmap = wait_set->impl->ready_clients;
+      number_of_entities = wait_set->size_of_clients;
+      break;
+    case RCL_WAIT_SET_SERVICE:
+      *bitmap = wait_set->impl->ready_services;
+      number_of_entities = wait_set->size_of_services;
+      break;
+    case RCL_WAIT_SET_EVENT:
+      *bitmap = wait_set->impl->ready_events;
+      number_of_entities = wait_set->size_of_events;
+      break;
+    default:
+      RCL_SET_ERROR_MSG("unknown wait set entity type");
+      return RCL_RET_INVALID_ARGUMENT;
   }
-  // Calculate the timeout argument.
+  *number_of_words = (number_of_entities + 63u) / 64u;
+  return RCL_RET_OK;
+}
+
+size_t
+rcl_wait_set_next_ready(
+  const uint64_t * bitmap, size_t number_of_words, size_t start_index)
+{
+  if (NULL == bitmap) {
+    return SIZE_MAX;
+  }
+  size_t word = start_index / 64u;
+  if (word >= number_of_words) {
+    return SIZE_MAX;
+  }
+  uint64_t current = bitmap[word] & (~UINT64_C(0) << (start_index % 64u));
+  while (true) {
+    if (0u != current) {
+#if defined(_MSC_VER)
+      unsigned long bit = 0;
+      _BitScanForward64(&bit, current);
+      return word * 64u + (size_t)bit;
+#else
+      return word * 64u + (size_t)__builtin_ctzll(current);
+#endif
+    }
+    if (++word >= number_of_words) {
+      return SIZE_MAX;
+    }
+    current = bitmap[word];
+  }
+}
+
+static void
+__coalescing_fini(rcl_wait_set_t * wait_set)
+{
+  if (wait_set->impl->coalesced_guard_condition) {
+    rmw_ret_t ret =
+      rmw_destroy_guard_condition(wait_set->impl->coalesced_guard_condition);
+    if (RMW_RET_OK != ret) {
+      RCUTILS_LOG_ERROR_NAMED(
+        ROS_PACKAGE_NAME,
+        "failed to destroy coalesced guard condition: %s",
+        rmw_get_error_string().str);
+    }
+    wait_set->impl->coalesced_guard_condition = NULL;
+  }
+  if (wait_set->impl->coalesced_pending) {
+    wait_set->impl->allocator.deallocate(
+      wait_set->impl->coalesced_pending, wait_set->impl->allocator.state);
+    wait_set->impl->coalesced_pending = NULL;
+  }
+  wait_set->impl->coalesced_source_count = 0;
+}
+
+rcl_ret_t
+rcl_wait_set_enable_notification_coalescing(
+  rcl_wait_set_t * wait_set, size_t number_of_sources)
+{
+  RCL_CHECK_ARGUMENT_FOR_NULL(wait_set, RCL_RET_INVALID_ARGUMENT);
+  RCL_CHECK_ARGUMENT_FOR_NULL(wait_set->impl, RCL_RET_WAIT_SET_INVALID);
+  if (0 == number_of_sources || number_of_sources > 64) {
+    RCL_SET_ERROR_MSG("number of sources must be between 1 and 64");
+    return RCL_RET_INVALID_ARGUMENT;
+  }
+  if (NULL != wait_set->impl->coalesced_guard_condition) {
+    RCL_SET_ERROR_MSG("notification coalescing already enabled");
+    return RCL_RET_ALREADY_INIT;
+  }
+  rcl_allocator_t * allocator = &wait_set->impl->allocator;
+  atomic_int_least64_t * pending = (atomic_int_least64_t *)allocator->allocate(
+    sizeof(atomic_int_least64_t) * number_of_sources, allocator->state);
+  RCL_CHECK_FOR_NULL_WITH_MSG(
+    pending, "allocating memory failed", return RCL_RET_BAD_ALLOC);
+  for (size_t i = 0; i < number_of_sources; ++i) {
+    atomic_init(&pending[i], 0);
+  }
+  wait_set->impl->coalesced_guard_condition =
+    rmw_create_guard_condition(&(wait_set->impl->context->impl->rmw_context));
+  if (NULL == wait_set->impl->coalesced_guard_condition) {
+    allocator->deallocate(pending, allocator->state);
+    RCL_SET_ERROR_MSG(rmw_get_error_string().str);
+    return RCL_RET_ERROR;
+  }
+  wait_set->impl->coalesced_pending = pending;
+  wait_set->impl->coalesced_source_count = number_of_sources;
+  return RCL_RET_OK;
+}
+
+rcl_ret_t
+rcl_wait_set_disable_notification_coalescing(rcl_wait_set_t * wait_set)
+{
+  RCL_CHECK_ARGUMENT_FOR_NULL(wait_set, RCL_RET_INVALID_ARGUMENT);
+  RCL_CHECK_ARGUMENT_FOR_NULL(wait_set->impl, RCL_RET_WAIT_SET_INVALID);
+  __coalescing_fini(wait_set);
+  return RCL_RET_OK;
+}
+
+rcl_ret_t
+rcl_wait_set_notify(const rcl_wait_set_t * wait_set, size_t source_id)
+{
+  RCL_CHECK_ARGUMENT_FOR_NULL(wait_set, RCL_RET_INVALID_ARGUMENT);
+  RCL_CHECK_ARGUMENT_FOR_NULL(wait_set->impl, RCL_RET_WAIT_SET_INVALID);
+  if (NULL == wait_set->impl->coalesced_guard_condition) {
+    RCL_SET_ERROR_MSG("notification coalescing is not enabled");
+    return RCL_RET_INVALID_ARGUMENT;
+  }
+  if (source_id >= wait_set->impl->coalesced_source_count) {
+    RCL_SET_ERROR_MSG("source id is out of range");
+    return RCL_RET_INVALID_ARGUMENT;
+  }
+  rcutils_atomic_store(&wait_set->impl->coalesced_pending[source_id], 1);
+  rmw_ret_t ret =
+    rmw_trigger_guard_condition(wait_set->impl->coalesced_guard_condition);
+  if (RMW_RET_OK != ret) {
+    RCL_SET_ERROR_MSG(rmw_get_error_string().str);
+    return RCL_RET_ERROR;
+  }
+  return RCL_RET_OK;
+}
+
+rcl_ret_t
+rcl_wait_set_take_notifications(
+  const rcl_wait_set_t * wait_set, uint64_t * pending_sources)
+{
+  RCL_CHECK_ARGUMENT_FOR_NULL(wait_set, RCL_RET_INVALID_ARGUMENT);
+  RCL_CHECK_ARGUMENT_FOR_NULL(wait_set->impl, RCL_RET_WAIT_SET_INVALID);
+  RCL_CHECK_ARGUMENT_FOR_NULL(pending_sources, RCL_RET_INVALID_ARGUMENT);
+  if (NULL == wait_set->impl->coalesced_guard_condition) {
+    RCL_SET_ERROR_MSG("notification coalescing is not enabled");
+    return RCL_RET_INVALID_ARGUMENT;
+  }
+  uint64_t mask = 0;
+  for (size_t i = 0; i < wait_set->impl->coalesced_source_count; ++i) {
+    if (0 != rcutils_atomic_exchange_int64_t(&wait_set->impl->coalesced_pending[i], 0)) {
+      mask |= UINT64_C(1) << i;
+    }
+  }
+  *pending_sources = mask;
+  return RCL_RET_OK;
+}
+
+rcl_ret_t
+rcl_wait_set_enable_statistics(rcl_wait_set_t * wait_set)
+{
+  RCL_CHECK_ARGUMENT_FOR_NULL(wait_set, RCL_RET_INVALID_ARGUMENT);
+  RCL_CHECK_ARGUMENT_FOR_NULL(wait_set->impl, RCL_RET_WAIT_SET_INVALID);
+  atomic_init(&wait_set->impl->stat_wait_count, 0);
+  atomic_init(&wait_set->impl->stat_spurious_wake_count, 0);
+  atomic_init(&wait_set->impl->stat_timer_wake_count, 0);
+  atomic_init(&wait_set->impl->stat_rmw_wait_time_ns, 0);
+  atomic_init(&wait_set->impl->stat_max_ready_batch_size, 0);
+  wait_set->impl->statistics_enabled = true;
+  return RCL_RET_OK;
+}
+
+rcl_ret_t
+rcl_wait_set_disable_statistics(rcl_wait_set_t * wait_set)
+{
+  RCL_CHECK_ARGUMENT_FOR_NULL(wait_set, RCL_RET_INVALID_ARGUMENT);
+  RCL_CHECK_ARGUMENT_FOR_NULL(wait_set->impl, RCL_RET_WAIT_SET_INVALID);
+  wait_set->impl->statistics_enabled = false;
+  return RCL_RET_OK;
+}
+
+rcl_ret_t
+rcl_wait_set_get_statistics(
+  const rcl_wait_set_t * wait_set, rcl_wait_set_statistics_t * statistics)
+{
+  RCL_CHECK_ARGUMENT_FOR_NULL(wait_set, RCL_RET_INVALID_ARGUMENT);
+  RCL_CHECK_ARGUMENT_FOR_NULL(wait_set->impl, RCL_RET_WAIT_SET_INVALID);
+  RCL_CHECK_ARGUMENT_FOR_NULL(statistics, RCL_RET_INVALID_ARGUMENT);
+  if (!wait_set->impl->statistics_enabled) {
+    RCL_SET_ERROR_MSG("wait set statistics are not enabled");
+    return RCL_RET_INVALID_ARGUMENT;
+  }
+  statistics->wait_count =
+    rcutils_atomic_load_uint64_t(&wait_set->impl->stat_wait_count);
+  statistics->spurious_wake_count =
+    rcutils_atomic_load_uint64_t(&wait_set->impl->stat_spurious_wake_count);
+  statistics->timer_wake_count =
+    rcutils_atomic_load_uint64_t(&wait_set->impl->stat_timer_wake_count);
+  statistics->rmw_wait_time_ns =
+    rcutils_atomic_load_uint64_t(&wait_set->impl->stat_rmw_wait_time_ns);
+  statistics->max_ready_batch_size =
+    rcutils_atomic_load_uint64_t(&wait_set->impl->stat_max_ready_batch_size);
+  return RCL_RET_OK;
+}
+
+rcl_ret_t
+rcl_wait_set_set_persistent(rcl_wait_set_t * wait_set, bool persistent)
+{
+  RCL_CHECK_ARGUMENT_FOR_NULL(wait_set, RCL_RET_INVALID_ARGUMENT);
+  RCL_CHECK_ARGUMENT_FOR_NULL(wait_set->impl, RCL_RET_WAIT_SET_INVALID);
+  if (wait_set->impl->persistent && !persistent) {
+    __shadow_storage_fini(wait_set);
+  }
+  wait_set->impl->persistent = persistent;
+  return RCL_RET_OK;
+}
+
+bool
+rcl_wait_set_is_persistent(const rcl_wait_set_t * wait_set)
+{
+  return rcl_wait_set_is_valid(wait_set) && wait_set->impl->persistent;
+}
+
+// Compute the contribution of the added timers to the wait timeout with a
+// linear scan, moving timer guard conditions into the waitable region and
+// pruning canceled timers.
+static rcl_ret_t
+__wait_set_prepare_timers_linear(
+  rcl_wait_set_t * wait_set, int64_t * min_timeout, bool * is_timer_timeout)
+{
+  uint64_t i = 0;
+  for (i = 0; i < wait_set->impl->timer_index; ++i) {
+    if (!wait_set->timers[i]) {
+      continue;  // Skip NULL timers.
+    }
+    rmw_guard_conditions_t * rmw_gcs = &(wait_set->impl->rmw_guard_conditions);
+    size_t gc_idx = wait_set->size_of_guard_conditions + i;
+    if (NULL != rmw_gcs->guard_conditions[gc_idx]) {
+      // This timer has a guard condition, so move it to make a legal wait set.
+      rmw_gcs->guard_conditions[rmw_gcs->guard_condition_count] =
+        rmw_gcs->guard_conditions[gc_idx];
+      ++(rmw_gcs->guard_condition_count);
+    }
+    // use timer time to to set the rmw_wait timeout
+    // TODO(sloretz) fix spurious wake-ups on ROS_TIME timers with ROS_TIME enabled
+    int64_t timer_timeout = INT64_MAX;
+    rcl_ret_t ret = rcl_timer_get_time_until_next_call(wait_set->timers[i], &timer_timeout);
+    if (ret == RCL_RET_TIMER_CANCELED) {
+      wait_set->timers[i] = NULL;
+      continue;
+    }
+    if (ret != RCL_RET_OK) {
+      return ret;  // The rcl error state should already be set.
+    }
+    if (timer_timeout < *min_timeout) {
+      *is_timer_timeout = true;
+      *min_timeout = timer_timeout;
+    }
+  }
+  return RCL_RET_OK;
+}
+
+// Set not ready timers (which includes canceled timers) to NULL with a
+// linear scan, recording ready ones in the readiness bitmap.
+static rcl_ret_t
+__wait_set_resolve_timers_linear(rcl_wait_set_t * wait_set)
+{
+  size_t i;
+  for (i = 0; i < wait_set->impl->timer_index; ++i) {
+    if (!wait_set->timers[i]) {
+      continue;
+    }
+    bool is_ready = false;
+    rcl_ret_t ret = rcl_timer_is_ready(wait_set->timers[i], &is_ready);
+    if (ret != RCL_RET_OK) {
+      return ret;  // The rcl error state should already be set.
+    }
+    if (!is_ready) {
+      wait_set->timers[i] = NULL;
+    } else {
+      SET_READY_BIT(ready_timers, i);
+    }
+  }
+  return RCL_RET_OK;
+}
+
+// Set the rcl handles of entities left NULL in the rmw arrays by rmw_wait
+// to NULL, recording ready ones in the readiness bitmaps.
+static void
+__wait_set_resolve_entities(rcl_wait_set_t * wait_set)
+{
+  size_t i;
+  // Set corresponding rcl subscription handles NULL.
+  for (i = 0; i < wait_set->size_of_subscriptions; ++i) {
+    bool is_ready = wait_set->impl->rmw_subscriptions.subscribers[i] != NULL;
+    if (!is_ready) {
+      wait_set->subscriptions[i] = NULL;
+    } else {
+      SET_READY_BIT(ready_subscriptions, i);
+    }
+  }
+  // Set corresponding rcl guard_condition handles NULL.
+  for (i = 0; i < wait_set->size_of_guard_conditions; ++i) {
+    bool is_ready = wait_set->impl->rmw_guard_conditions.guard_conditions[i] != NULL;
+    if (!is_ready) {
+      wait_set->guard_conditions[i] = NULL;
+    } else {
+      SET_READY_BIT(ready_guard_conditions, i);
+    }
+  }
+  // Set corresponding rcl client handles NULL.
+  for (i = 0; i < wait_set->size_of_clients; ++i) {
+    bool is_ready = wait_set->impl->rmw_clients.clients[i] != NULL;
+    if (!is_ready) {
+      wait_set->clients[i] = NULL;
+    } else {
+      SET_READY_BIT(ready_clients, i);
+    }
+  }
+  // Set corresponding rcl service handles NULL.
+  for (i = 0; i < wait_set->size_of_services; ++i) {
+    bool is_ready = wait_set->impl->rmw_services.services[i] != NULL;
+    if (!is_ready) {
+      wait_set->services[i] = NULL;
+    } else {
+      SET_READY_BIT(ready_services, i);
+    }
+  }
+  // Set corresponding rcl event handles NULL.
+  for (i = 0; i < wait_set->size_of_events; ++i) {
+    bool is_ready = wait_set->impl->rmw_events.events[i] != NULL;
+    if (!is_ready) {
+      wait_set->events[i] = NULL;
+    } else {
+      SET_READY_BIT(ready_events, i);
+    }
+  }
+}
+
+// Push one entry per ready entity onto the attached ready queue, in entity
+// array order, while the readiness data written by the resolve pass is
+// still hot in cache. Drops on a full queue are counted by the queue; the
+// entity stays visible in the wait set arrays for rescanning.
+static void
+__wait_set_populate_ready_queue(rcl_wait_set_t * wait_set)
+{
+  rcl_ready_queue_t * queue = wait_set->impl->ready_queue;
+  rcl_ready_queue_entry_t entry;
+  size_t i;
+  for (i = 0; i < wait_set->size_of_subscriptions; ++i) {
+    if (NULL != wait_set->subscriptions[i]) {
+      entry = (rcl_ready_queue_entry_t) {
+        wait_set->subscriptions[i], RCL_WAIT_SET_SUBSCRIPTION, i};
+      if (RCL_RET_OK != rcl_ready_queue_push(queue, &entry)) {
+        return;
+      }
+    }
+  }
+  for (i = 0; i < wait_set->size_of_guard_conditions; ++i) {
+    if (NULL != wait_set->guard_conditions[i]) {
+      entry = (rcl_ready_queue_entry_t) {
+        wait_set->guard_conditions[i], RCL_WAIT_SET_GUARD_CONDITION, i};
+      if (RCL_RET_OK != rcl_ready_queue_push(queue, &entry)) {
+        return;
+      }
+    }
+  }
+  for (i = 0; i < wait_set->size_of_timers; ++i) {
+    if (NULL != wait_set->timers[i]) {
+      entry = (rcl_ready_queue_entry_t) {wait_set->timers[i], RCL_WAIT_SET_TIMER, i};
+      if (RCL_RET_OK != rcl_ready_queue_push(queue, &entry)) {
+        return;
+      }
+    }
+  }
+  for (i = 0; i < wait_set->size_of_clients; ++i) {
+    if (NULL != wait_set->clients[i]) {
+      entry = (rcl_ready_queue_entry_t) {wait_set->clients[i], RCL_WAIT_SET_CLIENT, i};
+      if (RCL_RET_OK != rcl_ready_queue_push(queue, &entry)) {
+        return;
+      }
+    }
+  }
+  for (i = 0; i < wait_set->size_of_services; ++i) {
+    if (NULL != wait_set->services[i]) {
+      entry = (rcl_ready_queue_entry_t) {wait_set->services[i], RCL_WAIT_SET_SERVICE, i};
+      if (RCL_RET_OK != rcl_ready_queue_push(queue, &entry)) {
+        return;
+      }
+    }
+  }
+  for (i = 0; i < wait_set->size_of_events; ++i) {
+    if (NULL != wait_set->events[i]) {
+      entry = (rcl_ready_queue_entry_t) {wait_set->events[i], RCL_WAIT_SET_EVENT, i};
+      if (RCL_RET_OK != rcl_ready_queue_push(queue, &entry)) {
+        return;
+      }
+    }
+  }
+}
+
+rcl_ret_t
+rcl_wait_set_attach_ready_queue(
+  rcl_wait_set_t * wait_set,
+  rcl_ready_queue_t * ready_queue)
+{
+  RCL_CHECK_ARGUMENT_FOR_NULL(wait_set, RCL_RET_INVALID_ARGUMENT);
+  RCL_CHECK_ARGUMENT_FOR_NULL(wait_set->impl, RCL_RET_WAIT_SET_INVALID);
+  RCL_CHECK_ARGUMENT_FOR_NULL(ready_queue, RCL_RET_INVALID_ARGUMENT);
+  if (NULL == ready_queue->impl) {
+    RCL_SET_ERROR_MSG("ready queue is not initialized");
+    return RCL_RET_INVALID_ARGUMENT;
+  }
+  wait_set->impl->ready_queue = ready_queue;
+  return RCL_RET_OK;
+}
+
+rcl_ret_t
+rcl_wait_set_detach_ready_queue(rcl_wait_set_t * wait_set)
+{
+  RCL_CHECK_ARGUMENT_FOR_NULL(wait_set, RCL_RET_INVALID_ARGUMENT);
+  RCL_CHECK_ARGUMENT_FOR_NULL(wait_set->impl, RCL_RET_WAIT_SET_INVALID);
+  wait_set->impl->ready_queue = NULL;
+  return RCL_RET_OK;
+}
+
+rcl_ret_t
+rcl_wait_set_add_ack_watch(
+  rcl_wait_set_t * wait_set,
+  const rcl_publisher_t * publisher,
+  rcl_guard_condition_t * guard_condition,
+  int64_t poll_period)
+{
+  RCL_CHECK_ARGUMENT_FOR_NULL(wait_set, RCL_RET_INVALID_ARGUMENT);
+  RCL_CHECK_ARGUMENT_FOR_NULL(wait_set->impl, RCL_RET_WAIT_SET_INVALID);
+  RCL_CHECK_ARGUMENT_FOR_NULL(guard_condition, RCL_RET_INVALID_ARGUMENT);
+  if (poll_period <= 0) {
+    RCL_SET_ERROR_MSG("poll_period must be greater than zero");
+    return RCL_RET_INVALID_ARGUMENT;
+  }
+  // Probe once up front; this validates the publisher, surfaces middleware
+  // support problems at registration time, and completes immediately when
+  // nothing is waiting for acknowledgment.
+  rcl_ret_t ret = rcl_publisher_wait_for_all_acked(publisher, 0);
+  if (RCL_RET_OK == ret) {
+    return rcl_trigger_guard_condition(guard_condition);
+  }
+  if (RCL_RET_TIMEOUT != ret) {
+    return ret;  // error already set
+  }
+  rcl_wait_set_impl_t * impl = wait_set->impl;
+  if (impl->ack_watch_count == impl->ack_watch_capacity) {
+    size_t new_capacity = impl->ack_watch_capacity ? 2 * impl->ack_watch_capacity : 4;
+    rcl_wait_set_ack_watch_t * new_watches =
+      (rcl_wait_set_ack_watch_t *)impl->allocator.reallocate(
+      impl->ack_watches, new_capacity * sizeof(rcl_wait_set_ack_watch_t),
+      impl->allocator.state);
+    RCL_CHECK_FOR_NULL_WITH_MSG(
+      new_watches, "allocating memory failed", return RCL_RET_BAD_ALLOC);
+    impl->ack_watches = new_watches;
+    impl->ack_watch_capacity = new_capacity;
+  }
+  impl->ack_watches[impl->ack_watch_count] = (rcl_wait_set_ack_watch_t) {
+    publisher, guard_condition, poll_period
+  };
+  ++(impl->ack_watch_count);
+  return RCL_RET_OK;
+}
+
+rcl_ret_t
+rcl_wait_set_remove_ack_watch(
+  rcl_wait_set_t * wait_set,
+  const rcl_publisher_t * publisher)
+{
+  RCL_CHECK_ARGUMENT_FOR_NULL(wait_set, RCL_RET_INVALID_ARGUMENT);
+  RCL_CHECK_ARGUMENT_FOR_NULL(wait_set->impl, RCL_RET_WAIT_SET_INVALID);
+  RCL_CHECK_ARGUMENT_FOR_NULL(publisher, RCL_RET_INVALID_ARGUMENT);
+  rcl_wait_set_impl_t * impl = wait_set->impl;
+  for (size_t i = 0; i < impl->ack_watch_count; ++i) {
+    if (publisher == impl->ack_watches[i].publisher) {
+      impl->ack_watches[i] = impl->ack_watches[impl->ack_watch_count - 1];
+      --(impl->ack_watch_count);
+      break;
+    }
+  }
+  return RCL_RET_OK;
+}
+
+/// Probe the registered ack watches without blocking; completed watches
+/// trigger their guard condition and unregister themselves, pending ones
+/// clamp the wait timeout so the probe reruns within their poll period.
+static rcl_ret_t
+__wait_set_poll_ack_watches(
+  rcl_wait_set_t * wait_set, int64_t * min_timeout, bool * needs_timeout)
+{
+  rcl_wait_set_impl_t * impl = wait_set->impl;
+  size_t i = 0;
+  while (i < impl->ack_watch_count) {
+    rcl_wait_set_ack_watch_t * watch = &impl->ack_watches[i];
+    rcl_ret_t ret = rcl_publisher_wait_for_all_acked(watch->publisher, 0);
+    if (RCL_RET_OK == ret) {
+      ret = rcl_trigger_guard_condition(watch->guard_condition);
+      if (RCL_RET_OK != ret) {
+        return ret;  // error already set
+      }
+      // one-shot: swap the last watch into the vacated slot
+      impl->ack_watches[i] = impl->ack_watches[impl->ack_watch_count - 1];
+      --(impl->ack_watch_count);
+      continue;
+    }
+    if (RCL_RET_TIMEOUT != ret) {
+      return ret;  // error already set
+    }
+    if (watch->poll_period < *min_timeout) {
+      *min_timeout = watch->poll_period;
+    }
+    *needs_timeout = true;
+    ++i;
+  }
+  return RCL_RET_OK;
+}
+
+rcl_ret_t
+rcl_wait(rcl_wait_set_t * wait_set, int64_t timeout)
+{
+  RCL_CHECK_ARGUMENT_FOR_NULL(wait_set, RCL_RET_INVALID_ARGUMENT);
+  if (!rcl_wait_set_is_valid(wait_set)) {
+    RCL_SET_ERROR_MSG("wait set is invalid");
+    return RCL_RET_WAIT_SET_INVALID;
+  }
+  if (wait_set->impl->persistent) {
+    // In persistent mode the contents registered by the caller are either
+    // snapshotted (first wait after a change) or restored from the snapshot,
+    // undoing the result pruning of the previous wait without requiring the
+    // caller to clear and re-add every entity.
+    if (wait_set->impl->shadow_valid) {
+      __shadow_storage_restore(wait_set);
+    } else {
+      rcl_ret_t shadow_ret = __shadow_storage_snapshot(wait_set);
+      if (RCL_RET_OK != shadow_ret) {
+        return shadow_ret;
+      }
+    }
+  }
+  if (
+    wait_set->size_of_subscriptions == 0 &&
+    wait_set->size_of_guard_conditions == 0 &&
+    wait_set->size_of_timers == 0 &&
+    wait_set->size_of_clients == 0 &&
+    wait_set->size_of_services == 0 &&
+    wait_set->size_of_events == 0)
+  {
+    RCL_SET_ERROR_MSG("wait set is empty");
+    return RCL_RET_WAIT_SET_EMPTY;
+  }
+  const bool collect_stats = wait_set->impl->statistics_enabled;
+  if (collect_stats) {
+    rcutils_atomic_fetch_add_uint64_t(&wait_set->impl->stat_wait_count, 1);
+  }
+  RCL_TRACEPOINT(
+    RCL_TRACE_EVENT_WAIT_BEGIN, wait_set,
+    (int64_t)(wait_set->size_of_subscriptions + wait_set->size_of_guard_conditions +
+    wait_set->size_of_timers + wait_set->size_of_clients +
+    wait_set->size_of_services + wait_set->size_of_events),
+    timeout);
+  // Calculate the timeout argument.
   // By default, set the timer to block indefinitely if none of the below conditions are met.
   rmw_time_t * timeout_argument = NULL;
   rmw_time_t temporary_timeout_storage;
 
+  // Reset the readiness bitmaps; bits are set in the post-wait passes below.
+  if (wait_set->impl->ready_bitmap_storage) {
+    memset(
+      wait_set->impl->ready_bitmap_storage, 0,
+      sizeof(uint64_t) * wait_set->impl->ready_bitmap_words);
+  }
   bool is_timer_timeout = false;
   int64_t min_timeout = timeout > 0 ? timeout : INT64_MAX;
-  {  // scope to prevent i from colliding below
-    uint64_t i = 0;
-    for (i = 0; i < wait_set->impl->timer_index; ++i) {
+  // The timer heap is only maintained in persistent mode, where the timer
+  // set survives across waits; otherwise a per-wait rebuild would cost more
+  // than the linear scan it replaces.
+  bool use_timer_heap = wait_set->impl->persistent &&
+    wait_set->impl->timer_index > 0 &&
+    !wait_set->impl->timer_heap_mixed_clocks;
+  if (use_timer_heap) {
+    rcl_ret_t heap_ret;
+    if (!wait_set->impl->timer_heap_valid) {
+      heap_ret = __timer_heap_rebuild(wait_set);
+    } else {
+      heap_ret = __timer_heap_rekey(wait_set);
+    }
+    if (RCL_RET_OK != heap_ret) {
+      return heap_ret;
+    }
+    // Mixed clock types disable the heap; fall back to the linear scan.
+    use_timer_heap = wait_set->impl->timer_heap_valid;
+  }
+  if (use_timer_heap) {
+    // Move timer guard conditions into the waitable region; pointer moves
+    // only, no per-timer atomics.
+    rmw_guard_conditions_t * rmw_gcs = &(wait_set->impl->rmw_guard_conditions);
+    for (size_t i = 0; i < wait_set->impl->timer_index; ++i) {
       if (!wait_set->timers[i]) {
-        continue;  // Skip NULL timers.
+        continue;
       }
-      rmw_guard_conditions_t * rmw_gcs = &(wait_set->impl->rmw_guard_conditions);
       size_t gc_idx = wait_set->size_of_guard_conditions + i;
       if (NULL != rmw_gcs->guard_conditions[gc_idx]) {
-        // This timer has a guard condition, so move it to make a legal wait set.
         rmw_gcs->guard_conditions[rmw_gcs->guard_condition_count] =
           rmw_gcs->guard_conditions[gc_idx];
         ++(rmw_gcs->guard_condition_count);
       }
-      // use timer time to to set the rmw_wait timeout
-      // TODO(sloretz) fix spurious wake-ups on ROS_TIME timers with ROS_TIME enabled
+    }
+    // Deadline-aware early-out: when the caller passed a finite timeout and
+    // the earliest deadline snapshot lies beyond it, the caller's timeout
+    // determines the wait and the timer storage is not touched at all; one
+    // clock read replaces the per-timer query.
+    bool query_heap_root = wait_set->impl->timer_heap_count > 0 &&
+      INT64_MAX != wait_set->impl->timer_deadlines[wait_set->impl->timer_heap[0]];
+    if (query_heap_root && timeout >= 0) {
+      rcl_time_point_value_t heap_now = 0;
+      rcl_ret_t now_ret = rcl_clock_get_now(wait_set->impl->timer_heap_clock, &heap_now);
+      if (RCL_RET_OK != now_ret) {
+        return now_ret;  // The rcl error state should already be set.
+      }
+      const int64_t root_deadline =
+        wait_set->impl->timer_deadlines[wait_set->impl->timer_heap[0]];
+      if (root_deadline - heap_now >= timeout) {
+        query_heap_root = false;
+      }
+    }
+    // O(1) next-deadline lookup: only the heap root is queried through the
+    // timer API, which recomputes the timeout precisely on the timer's clock.
+    while (query_heap_root && wait_set->impl->timer_heap_count > 0) {
+      size_t root = wait_set->impl->timer_heap[0];
+      if (INT64_MAX == wait_set->impl->timer_deadlines[root]) {
+        break;  // Only canceled timers remain.
+      }
       int64_t timer_timeout = INT64_MAX;
-      rcl_ret_t ret = rcl_timer_get_time_until_next_call(wait_set->timers[i], &timer_timeout);
-      if (ret == RCL_RET_TIMER_CANCELED) {
-        wait_set->timers[i] = NULL;
+      rcl_ret_t ret = rcl_timer_get_time_until_next_call(
+        wait_set->timers[root], &timer_timeout);
+      if (RCL_RET_TIMER_CANCELED == ret) {
+        wait_set->impl->timer_deadlines[root] = INT64_MAX;
+        __timer_heap_sift_down(wait_set->impl, 0);
         continue;
       }
-      if (ret != RCL_RET_OK) {
+      if (RCL_RET_OK != ret) {
         return ret;  // The rcl error state should already be set.
       }
       if (timer_timeout < min_timeout) {
         is_timer_timeout = true;
         min_timeout = timer_timeout;
       }
+      break;
+    }
+  } else {
+    rcl_ret_t prepare_ret = __wait_set_prepare_timers_linear(
+      wait_set, &min_timeout, &is_timer_timeout);
+    if (RCL_RET_OK != prepare_ret) {
+      return prepare_ret;
+    }
+  }
+
+  // Probe the publisher ack watches; a pending watch clamps the timeout to
+  // its poll period, a completed one has already triggered its guard
+  // condition so the rmw wait below returns immediately.
+  bool is_ack_poll_timeout = false;
+  if (wait_set->impl->ack_watch_count > 0) {
+    rcl_ret_t ack_ret = __wait_set_poll_ack_watches(
+      wait_set, &min_timeout, &is_ack_poll_timeout);
+    if (RCL_RET_OK != ack_ret) {
+      return ack_ret;  // error already set
     }
   }
 
+  // Append the coalesced notification guard condition, if enabled; the rmw
+  // guard condition array reserves a slot for it past the timer region.
+  if (NULL != wait_set->impl->coalesced_guard_condition) {
+    rmw_guard_conditions_t * rmw_gcs = &(wait_set->impl->rmw_guard_conditions);
+    rmw_gcs->guard_conditions[rmw_gcs->guard_condition_count++] =
+      wait_set->impl->coalesced_guard_condition->data;
+  }
+
   if (timeout == 0) {
     // Then it is non-blocking, so set the temporary storage to 0, 0 and pass it.
     temporary_timeout_storage.sec = 0;
     temporary_timeout_storage.nsec = 0;
     timeout_argument = &temporary_timeout_storage;
-  } else if (timeout > 0 || is_timer_timeout) {
+  } else if (timeout > 0 || is_timer_timeout || is_ack_poll_timeout) {
     // If min_timeout was negative, we need to wake up immediately.
     if (min_timeout < 0) {
       min_timeout = 0;
@@ -591,33 +2051,86 @@ rcl_wait(rcl_wait_set_t * wait_set, int64_t timeout)
     timeout_argument = &temporary_timeout_storage;
   }
 
+  // Fast path: when an already expired timer determines the effective
+  // timeout and no non-timer entities have been added, the outcome is known
+  // without consulting rmw, so skip the wait set attach/detach cost of
+  // rmw_wait() entirely and fall through to the timer readiness pass.
+  const bool skip_rmw_wait =
+    is_timer_timeout && min_timeout <= 0 &&
+    0 == wait_set->impl->subscription_index &&
+    0 == wait_set->impl->guard_condition_index &&
+    0 == wait_set->impl->client_index &&
+    0 == wait_set->impl->service_index &&
+    0 == wait_set->impl->event_index;
+
   // Wait.
-  rmw_ret_t ret = rmw_wait(
-    &wait_set->impl->rmw_subscriptions,
-    &wait_set->impl->rmw_guard_conditions,
-    &wait_set->impl->rmw_services,
-    &wait_set->impl->rmw_clients,
-    &wait_set->impl->rmw_events,
-    wait_set->impl->rmw_wait_set,
-    timeout_argument);
+  rmw_ret_t ret;
+  if (skip_rmw_wait) {
+    ret = RMW_RET_TIMEOUT;
+  } else {
+    rcutils_time_point_value_t wait_start = 0;
+    bool have_wait_start = collect_stats &&
+      RCUTILS_RET_OK == rcutils_steady_time_now(&wait_start);
+    ret = rmw_wait(
+      &wait_set->impl->rmw_subscriptions,
+      &wait_set->impl->rmw_guard_conditions,
+      &wait_set->impl->rmw_services,
+      &wait_set->impl->rmw_clients,
+      &wait_set->impl->rmw_events,
+      wait_set->impl->rmw_wait_set,
+      timeout_argument);
+    if (have_wait_start) {
+      rcutils_time_point_value_t wait_end = 0;
+      if (RCUTILS_RET_OK == rcutils_steady_time_now(&wait_end) && wait_end > wait_start) {
+        rcutils_atomic_fetch_add_uint64_t(
+          &wait_set->impl->stat_rmw_wait_time_ns, (uint64_t)(wait_end - wait_start));
+      }
+    }
+  }
 
   // Items that are not ready will have been set to NULL by rmw_wait.
   // We now update our handles accordingly.
 
   // Check for ready timers
   // and set not ready timers (which includes canceled timers) to NULL.
-  size_t i;
-  for (i = 0; i < wait_set->impl->timer_index; ++i) {
-    if (!wait_set->timers[i]) {
-      continue;
+  if (use_timer_heap) {
+    // Only timers whose deadline snapshot has passed are visited; by the
+    // heap property the rest cannot be ready.
+    // The ready indices are kept in the re-key list so the next wait only
+    // recomputes the deadlines of timers that may have been called.
+    size_t * expired = wait_set->impl->timer_rekey;
+    size_t expired_count = 0;
+    if (wait_set->impl->timer_heap_clock) {
+      rcl_time_point_value_t now = 0;
+      rcl_ret_t clock_ret = rcl_clock_get_now(wait_set->impl->timer_heap_clock, &now);
+      if (RCL_RET_OK != clock_ret) {
+        return clock_ret;
+      }
+      __timer_heap_collect_expired(wait_set->impl, now, 0, expired, &expired_count);
     }
-    bool is_ready = false;
-    rcl_ret_t ret = rcl_timer_is_ready(wait_set->timers[i], &is_ready);
-    if (ret != RCL_RET_OK) {
-      return ret;  // The rcl error state should already be set.
+    size_t ready_count = 0;
+    for (size_t e = 0; e < expired_count; ++e) {
+      bool is_ready = false;
+      rcl_ret_t timer_ret = rcl_timer_is_ready(wait_set->timers[expired[e]], &is_ready);
+      if (RCL_RET_OK != timer_ret) {
+        return timer_ret;  // The rcl error state should already be set.
+      }
+      if (is_ready) {
+        expired[ready_count++] = expired[e];
+      }
     }
-    if (!is_ready) {
-      wait_set->timers[i] = NULL;
+    memset(
+      (void *)wait_set->timers, 0,
+      sizeof(rcl_timer_t *) * wait_set->impl->timer_index);
+    for (size_t e = 0; e < ready_count; ++e) {
+      wait_set->timers[expired[e]] = wait_set->impl->shadow_timers[expired[e]];
+      SET_READY_BIT(ready_timers, expired[e]);
+    }
+    wait_set->impl->timer_rekey_count = ready_count;
+  } else {
+    rcl_ret_t resolve_ret = __wait_set_resolve_timers_linear(wait_set);
+    if (RCL_RET_OK != resolve_ret) {
+      return resolve_ret;
     }
   }
   // Check for timeout, return RCL_RET_TIMEOUT only if it wasn't a timer.
@@ -625,44 +2138,265 @@ rcl_wait(rcl_wait_set_t * wait_set, int64_t timeout)
     RCL_SET_ERROR_MSG(rmw_get_error_string().str);
     return RCL_RET_ERROR;
   }
-  // Set corresponding rcl subscription handles NULL.
-  for (i = 0; i < wait_set->size_of_subscriptions; ++i) {
-    bool is_ready = wait_set->impl->rmw_subscriptions.subscribers[i] != NULL;
-    if (!is_ready) {
-      wait_set->subscriptions[i] = NULL;
+  __wait_set_resolve_entities(wait_set);
+
+  if (NULL != wait_set->impl->ready_queue) {
+    __wait_set_populate_ready_queue(wait_set);
+  }
+
+  if (collect_stats) {
+    const uint64_t ready_total = __wait_set_count_ready(wait_set->impl);
+    if (RMW_RET_TIMEOUT == ret) {
+      if (is_timer_timeout) {
+        rcutils_atomic_fetch_add_uint64_t(&wait_set->impl->stat_timer_wake_count, 1);
+      }
+    } else if (0 == ready_total && !__coalesced_pending_any(wait_set->impl)) {
+      rcutils_atomic_fetch_add_uint64_t(&wait_set->impl->stat_spurious_wake_count, 1);
+    }
+    if (
+      ready_total >
+      rcutils_atomic_load_uint64_t(&wait_set->impl->stat_max_ready_batch_size))
+    {
+      rcutils_atomic_store(&wait_set->impl->stat_max_ready_batch_size, ready_total);
     }
   }
-  // Set corresponding rcl guard_condition handles NULL.
-  for (i = 0; i < wait_set->size_of_guard_conditions; ++i) {
-    bool is_ready = wait_set->impl->rmw_guard_conditions.guard_conditions[i] != NULL;
-    if (!is_ready) {
-      wait_set->guard_conditions[i] = NULL;
+
+  // The ready count is only computed here when tracepoints are compiled in;
+  // error returns above do not emit an end event.
+  RCL_TRACEPOINT(
+    RCL_TRACE_EVENT_WAIT_END, wait_set,
+    (int64_t)__wait_set_count_ready(wait_set->impl),
+    is_timer_timeout ? 1 : 0);
+
+  if (RMW_RET_TIMEOUT == ret && !is_timer_timeout) {
+    RCL_RETURN_EXPECTED(RCL_RET_TIMEOUT);
+  }
+  return RCL_RET_OK;
+}
+
+rcl_ret_t
+rcl_wait_multiple(
+  rcl_wait_set_t ** wait_sets, size_t number_of_wait_sets, int64_t timeout)
+{
+  RCL_CHECK_ARGUMENT_FOR_NULL(wait_sets, RCL_RET_INVALID_ARGUMENT);
+  if (0 == number_of_wait_sets) {
+    RCL_SET_ERROR_MSG("number of wait sets is zero");
+    return RCL_RET_INVALID_ARGUMENT;
+  }
+  if (1 == number_of_wait_sets) {
+    return rcl_wait(wait_sets[0], timeout);
+  }
+  for (size_t s = 0; s < number_of_wait_sets; ++s) {
+    if (!rcl_wait_set_is_valid(wait_sets[s])) {
+      RCL_SET_ERROR_MSG("wait set is invalid");
+      return RCL_RET_WAIT_SET_INVALID;
     }
   }
-  // Set corresponding rcl client handles NULL.
-  for (i = 0; i < wait_set->size_of_clients; ++i) {
-    bool is_ready = wait_set->impl->rmw_clients.clients[i] != NULL;
-    if (!is_ready) {
-      wait_set->clients[i] = NULL;
+  rcl_allocator_t allocator = wait_sets[0]->impl->allocator;
+
+  // Calculate the timeout argument.
+  rmw_time_t * timeout_argument = NULL;
+  rmw_time_t temporary_timeout_storage;
+  bool is_timer_timeout = false;
+  int64_t min_timeout = timeout > 0 ? timeout : INT64_MAX;
+
+  size_t total_subscriptions = 0;
+  size_t total_guard_conditions = 0;
+  size_t total_clients = 0;
+  size_t total_services = 0;
+  size_t total_events = 0;
+  bool any_entities = false;
+  for (size_t s = 0; s < number_of_wait_sets; ++s) {
+    rcl_wait_set_t * wait_set = wait_sets[s];
+    if (wait_set->impl->persistent) {
+      if (wait_set->impl->shadow_valid) {
+        __shadow_storage_restore(wait_set);
+      } else {
+        rcl_ret_t shadow_ret = __shadow_storage_snapshot(wait_set);
+        if (RCL_RET_OK != shadow_ret) {
+          return shadow_ret;
+        }
+      }
+    }
+    if (wait_set->impl->ready_bitmap_storage) {
+      memset(
+        wait_set->impl->ready_bitmap_storage, 0,
+        sizeof(uint64_t) * wait_set->impl->ready_bitmap_words);
+    }
+    rcl_ret_t prepare_ret = __wait_set_prepare_timers_linear(
+      wait_set, &min_timeout, &is_timer_timeout);
+    if (RCL_RET_OK != prepare_ret) {
+      return prepare_ret;
     }
+    // Deadline snapshots can go stale through an aggregated wait, so force
+    // the next single-set wait to rebuild the timer heap.
+    wait_set->impl->timer_heap_valid = false;
+    total_subscriptions += wait_set->impl->rmw_subscriptions.subscriber_count;
+    total_guard_conditions += wait_set->impl->rmw_guard_conditions.guard_condition_count;
+    total_clients += wait_set->impl->rmw_clients.client_count;
+    total_services += wait_set->impl->rmw_services.service_count;
+    total_events += wait_set->impl->rmw_events.event_count;
+    any_entities = any_entities ||
+      wait_set->size_of_subscriptions != 0 ||
+      wait_set->size_of_guard_conditions != 0 ||
+      wait_set->size_of_timers != 0 ||
+      wait_set->size_of_clients != 0 ||
+      wait_set->size_of_services != 0 ||
+      wait_set->size_of_events != 0;
   }
-  // Set corresponding rcl service handles NULL.
-  for (i = 0; i < wait_set->size_of_services; ++i) {
-    bool is_ready = wait_set->impl->rmw_services.services[i] != NULL;
-    if (!is_ready) {
-      wait_set->services[i] = NULL;
+  if (!any_entities) {
+    RCL_SET_ERROR_MSG("every wait set is empty");
+    return RCL_RET_WAIT_SET_EMPTY;
+  }
+
+  // Aggregate the rmw storage of all of the wait sets into one scratch
+  // arena so a single rmw_wait() covers every partition.
+  const size_t total_pointers =
+    total_subscriptions + total_guard_conditions + total_clients +
+    total_services + total_events;
+  void ** arena = NULL;
+  if (0 != total_pointers) {
+    arena = (void **)allocator.allocate(
+      sizeof(void *) * total_pointers, allocator.state);
+    RCL_CHECK_FOR_NULL_WITH_MSG(
+      arena, "allocating memory failed", return RCL_RET_BAD_ALLOC);
+  }
+  void ** cursor = arena;
+  rmw_subscriptions_t aggregated_subscriptions;
+  aggregated_subscriptions.subscribers = cursor;
+  aggregated_subscriptions.subscriber_count = total_subscriptions;
+  cursor += total_subscriptions;
+  rmw_guard_conditions_t aggregated_guard_conditions;
+  aggregated_guard_conditions.guard_conditions = cursor;
+  aggregated_guard_conditions.guard_condition_count = total_guard_conditions;
+  cursor += total_guard_conditions;
+  rmw_clients_t aggregated_clients;
+  aggregated_clients.clients = cursor;
+  aggregated_clients.client_count = total_clients;
+  cursor += total_clients;
+  rmw_services_t aggregated_services;
+  aggregated_services.services = cursor;
+  aggregated_services.service_count = total_services;
+  cursor += total_services;
+  rmw_events_t aggregated_events;
+  aggregated_events.events = cursor;
+  aggregated_events.event_count = total_events;
+
+#define AGGREGATE_COPY(Dst, Member, Count, Offset) \
+  if (0 != wait_set->impl->Count) { \
+    memcpy( \
+      (void *)(Dst + Offset), (const void *)wait_set->impl->Member, \
+      sizeof(void *) * wait_set->impl->Count); \
+    Offset += wait_set->impl->Count; \
+  }
+  {
+    size_t subscription_offset = 0;
+    size_t guard_condition_offset = 0;
+    size_t client_offset = 0;
+    size_t service_offset = 0;
+    size_t event_offset = 0;
+    for (size_t s = 0; s < number_of_wait_sets; ++s) {
+      rcl_wait_set_t * wait_set = wait_sets[s];
+      AGGREGATE_COPY(
+        aggregated_subscriptions.subscribers, rmw_subscriptions.subscribers,
+        rmw_subscriptions.subscriber_count, subscription_offset)
+      AGGREGATE_COPY(
+        aggregated_guard_conditions.guard_conditions,
+        rmw_guard_conditions.guard_conditions,
+        rmw_guard_conditions.guard_condition_count, guard_condition_offset)
+      AGGREGATE_COPY(
+        aggregated_clients.clients, rmw_clients.clients,
+        rmw_clients.client_count, client_offset)
+      AGGREGATE_COPY(
+        aggregated_services.services, rmw_services.services,
+        rmw_services.service_count, service_offset)
+      AGGREGATE_COPY(
+        aggregated_events.events, rmw_events.events,
+        rmw_events.event_count, event_offset)
     }
   }
-  // Set corresponding rcl event handles NULL.
-  for (i = 0; i < wait_set->size_of_events; ++i) {
-    bool is_ready = wait_set->impl->rmw_events.events[i] != NULL;
-    if (!is_ready) {
-      wait_set->events[i] = NULL;
+#undef AGGREGATE_COPY
+
+  if (timeout == 0) {
+    temporary_timeout_storage.sec = 0;
+    temporary_timeout_storage.nsec = 0;
+    timeout_argument = &temporary_timeout_storage;
+  } else if (timeout > 0 || is_timer_timeout) {
+    if (min_timeout < 0) {
+      min_timeout = 0;
     }
+    temporary_timeout_storage.sec = RCL_NS_TO_S(min_timeout);
+    temporary_timeout_storage.nsec = min_timeout % 1000000000;
+    timeout_argument = &temporary_timeout_storage;
+  }
+
+  // One rmw_wait() for all partitions, using the first wait set's rmw wait
+  // set; it should be created with capacity for the combined entities.
+  rmw_ret_t ret = rmw_wait(
+    &aggregated_subscriptions,
+    &aggregated_guard_conditions,
+    &aggregated_services,
+    &aggregated_clients,
+    &aggregated_events,
+    wait_sets[0]->impl->rmw_wait_set,
+    timeout_argument);
+
+  // Demultiplex the (possibly nulled) aggregate results back into each wait
+  // set's rmw storage, then resolve readiness per wait set as usual.
+#define AGGREGATE_COPY_BACK(Src, Member, Count, Offset) \
+  if (0 != wait_set->impl->Count) { \
+    memcpy( \
+      (void *)wait_set->impl->Member, (const void *)(Src + Offset), \
+      sizeof(void *) * wait_set->impl->Count); \
+    Offset += wait_set->impl->Count; \
+  }
+  {
+    size_t subscription_offset = 0;
+    size_t guard_condition_offset = 0;
+    size_t client_offset = 0;
+    size_t service_offset = 0;
+    size_t event_offset = 0;
+    for (size_t s = 0; s < number_of_wait_sets; ++s) {
+      rcl_wait_set_t * wait_set = wait_sets[s];
+      AGGREGATE_COPY_BACK(
+        aggregated_subscriptions.subscribers, rmw_subscriptions.subscribers,
+        rmw_subscriptions.subscriber_count, subscription_offset)
+      AGGREGATE_COPY_BACK(
+        aggregated_guard_conditions.guard_conditions,
+        rmw_guard_conditions.guard_conditions,
+        rmw_guard_conditions.guard_condition_count, guard_condition_offset)
+      AGGREGATE_COPY_BACK(
+        aggregated_clients.clients, rmw_clients.clients,
+        rmw_clients.client_count, client_offset)
+      AGGREGATE_COPY_BACK(
+        aggregated_services.services, rmw_services.services,
+        rmw_services.service_count, service_offset)
+      AGGREGATE_COPY_BACK(
+        aggregated_events.events, rmw_events.events,
+        rmw_events.event_count, event_offset)
+    }
+  }
+#undef AGGREGATE_COPY_BACK
+  if (arena) {
+    allocator.deallocate(arena, allocator.state);
+  }
+
+  for (size_t s = 0; s < number_of_wait_sets; ++s) {
+    rcl_ret_t resolve_ret = __wait_set_resolve_timers_linear(wait_sets[s]);
+    if (RCL_RET_OK != resolve_ret) {
+      return resolve_ret;
+    }
+  }
+  if (ret != RMW_RET_OK && ret != RMW_RET_TIMEOUT) {
+    RCL_SET_ERROR_MSG(rmw_get_error_string().str);
+    return RCL_RET_ERROR;
+  }
+  for (size_t s = 0; s < number_of_wait_sets; ++s) {
+    __wait_set_resolve_entities(wait_sets[s]);
   }
 
   if (RMW_RET_TIMEOUT == ret && !is_timer_timeout) {
-    return RCL_RET_TIMEOUT;
+    RCL_RETURN_EXPECTED(RCL_RET_TIMEOUT);
   }
   return RCL_RET_OK;
 }
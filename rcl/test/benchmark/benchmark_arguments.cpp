@@ -0,0 +1,208 @@
+// Copyright 2022 Open Source Robotics Foundation, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <fstream>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include "performance_test_fixture/performance_test_fixture.hpp"
+
+#include "rcl/arguments.h"
+#include "rcl/error_handling.h"
+#include "rcl_yaml_param_parser/parser.h"
+#include "rcpputils/filesystem_helper.hpp"
+#include "rcutils/macros.h"
+
+using performance_test_fixture::PerformanceTest;
+
+namespace
+{
+
+// Writes one synthetic parameter file per index and returns the paths.
+std::vector<std::string>
+write_param_files(size_t file_count, size_t params_per_file)
+{
+  std::vector<std::string> paths;
+  for (size_t file_idx = 0u; file_idx < file_count; ++file_idx) {
+    std::ostringstream contents;
+    contents << "benchmark_node:\n  ros__parameters:\n";
+    for (size_t i = 0u; i < params_per_file; ++i) {
+      contents << "    param_" << file_idx << "_" << i << ": " << i << "\n";
+    }
+    std::string path = (rcpputils::fs::temp_directory_path() /
+      ("benchmark_arguments_" + std::to_string(file_idx) + ".yaml")).string();
+    std::ofstream out(path, std::ios::trunc);
+    out << contents.str();
+    paths.push_back(path);
+  }
+  return paths;
+}
+
+}  // namespace
+
+// Measures command line parsing as remap rules accumulate, which is the
+// dominant cost of rcl_parse_arguments() in launch-heavy systems.
+BENCHMARK_DEFINE_F(PerformanceTest, parse_arguments_remap_rules)(benchmark::State & st)
+{
+  const size_t rule_count = static_cast<size_t>(st.range(0));
+
+  std::vector<std::string> rules;
+  std::vector<const char *> argv;
+  argv.push_back("process_name");
+  argv.push_back("--ros-args");
+  for (size_t i = 0u; i < rule_count; ++i) {
+    rules.push_back(
+      "/benchmark/from" + std::to_string(i) + ":=/benchmark/to" + std::to_string(i));
+  }
+  for (const std::string & rule : rules) {
+    argv.push_back("-r");
+    argv.push_back(rule.c_str());
+  }
+
+  reset_heap_counters();
+  for (auto _ : st) {
+    RCUTILS_UNUSED(_);
+    rcl_arguments_t parsed_args = rcl_get_zero_initialized_arguments();
+    rcl_ret_t ret = rcl_parse_arguments(
+      static_cast<int>(argv.size()), argv.data(), rcl_get_default_allocator(), &parsed_args);
+    if (RCL_RET_OK != ret) {
+      st.SkipWithError(rcl_get_error_string().str);
+      break;
+    }
+    ret = rcl_arguments_fini(&parsed_args);
+    if (RCL_RET_OK != ret) {
+      st.SkipWithError(rcl_get_error_string().str);
+      break;
+    }
+  }
+}
+BENCHMARK_REGISTER_F(PerformanceTest, parse_arguments_remap_rules)
+->Arg(1)->Arg(10)->Arg(100)->Arg(500);
+
+// Measures the argv scan with many parameter files registered.  Parameter
+// files are parsed lazily, so this isolates the registration phase of
+// rcl_parse_arguments() from the YAML work.
+BENCHMARK_DEFINE_F(PerformanceTest, parse_arguments_param_files)(benchmark::State & st)
+{
+  const size_t file_count = static_cast<size_t>(st.range(0));
+  std::vector<std::string> paths = write_param_files(file_count, 10u);
+
+  std::vector<const char *> argv;
+  argv.push_back("process_name");
+  argv.push_back("--ros-args");
+  for (const std::string & path : paths) {
+    argv.push_back(RCL_PARAM_FILE_FLAG);
+    argv.push_back(path.c_str());
+  }
+
+  reset_heap_counters();
+  for (auto _ : st) {
+    RCUTILS_UNUSED(_);
+    rcl_arguments_t parsed_args = rcl_get_zero_initialized_arguments();
+    rcl_ret_t ret = rcl_parse_arguments(
+      static_cast<int>(argv.size()), argv.data(), rcl_get_default_allocator(), &parsed_args);
+    if (RCL_RET_OK != ret) {
+      st.SkipWithError(rcl_get_error_string().str);
+      break;
+    }
+    ret = rcl_arguments_fini(&parsed_args);
+    if (RCL_RET_OK != ret) {
+      st.SkipWithError(rcl_get_error_string().str);
+      break;
+    }
+  }
+}
+BENCHMARK_REGISTER_F(PerformanceTest, parse_arguments_param_files)->Arg(1)->Arg(8)->Arg(32);
+
+// Same argv shape, but the parameter overrides are materialized each
+// iteration; the delta against parse_arguments_param_files is the YAML
+// parsing phase, so the two reports decompose the parse cost per phase.
+BENCHMARK_DEFINE_F(PerformanceTest, parse_arguments_materialize_param_files)(benchmark::State & st)
+{
+  const size_t file_count = static_cast<size_t>(st.range(0));
+  std::vector<std::string> paths = write_param_files(file_count, 10u);
+
+  std::vector<const char *> argv;
+  argv.push_back("process_name");
+  argv.push_back("--ros-args");
+  for (const std::string & path : paths) {
+    argv.push_back(RCL_PARAM_FILE_FLAG);
+    argv.push_back(path.c_str());
+  }
+
+  reset_heap_counters();
+  for (auto _ : st) {
+    RCUTILS_UNUSED(_);
+    rcl_arguments_t parsed_args = rcl_get_zero_initialized_arguments();
+    rcl_ret_t ret = rcl_parse_arguments(
+      static_cast<int>(argv.size()), argv.data(), rcl_get_default_allocator(), &parsed_args);
+    if (RCL_RET_OK != ret) {
+      st.SkipWithError(rcl_get_error_string().str);
+      break;
+    }
+    rcl_params_t * param_overrides = NULL;
+    ret = rcl_arguments_get_param_overrides(&parsed_args, &param_overrides);
+    if (RCL_RET_OK != ret) {
+      st.SkipWithError(rcl_get_error_string().str);
+      break;
+    }
+    if (NULL != param_overrides) {
+      rcl_yaml_node_struct_fini(param_overrides);
+    }
+    ret = rcl_arguments_fini(&parsed_args);
+    if (RCL_RET_OK != ret) {
+      st.SkipWithError(rcl_get_error_string().str);
+      break;
+    }
+  }
+}
+BENCHMARK_REGISTER_F(PerformanceTest, parse_arguments_materialize_param_files)
+->Arg(1)->Arg(8)->Arg(32);
+
+// Measures the log-level rule phase on its own.
+BENCHMARK_DEFINE_F(PerformanceTest, parse_arguments_log_levels)(benchmark::State & st)
+{
+  const size_t rule_count = static_cast<size_t>(st.range(0));
+
+  std::vector<std::string> rules;
+  std::vector<const char *> argv;
+  argv.push_back("process_name");
+  argv.push_back("--ros-args");
+  for (size_t i = 0u; i < rule_count; ++i) {
+    rules.push_back("benchmark.logger" + std::to_string(i) + ":=debug");
+  }
+  for (const std::string & rule : rules) {
+    argv.push_back(RCL_LOG_LEVEL_FLAG);
+    argv.push_back(rule.c_str());
+  }
+
+  reset_heap_counters();
+  for (auto _ : st) {
+    RCUTILS_UNUSED(_);
+    rcl_arguments_t parsed_args = rcl_get_zero_initialized_arguments();
+    rcl_ret_t ret = rcl_parse_arguments(
+      static_cast<int>(argv.size()), argv.data(), rcl_get_default_allocator(), &parsed_args);
+    if (RCL_RET_OK != ret) {
+      st.SkipWithError(rcl_get_error_string().str);
+      break;
+    }
+    ret = rcl_arguments_fini(&parsed_args);
+    if (RCL_RET_OK != ret) {
+      st.SkipWithError(rcl_get_error_string().str);
+      break;
+    }
+  }
+}
+BENCHMARK_REGISTER_F(PerformanceTest, parse_arguments_log_levels)->Arg(10)->Arg(100);
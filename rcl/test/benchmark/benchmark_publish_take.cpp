@@ -0,0 +1,189 @@
+// Copyright 2022 Open Source Robotics Foundation, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "performance_test_fixture/performance_test_fixture.hpp"
+
+#include "rcl/error_handling.h"
+#include "rcl/publisher.h"
+#include "rcl/rcl.h"
+#include "rcl/subscription.h"
+#include "rcutils/macros.h"
+
+#include "rosidl_runtime_c/message_type_support_struct.h"
+#include "test_msgs/msg/basic_types.h"
+
+#include "../rcl/wait_for_entity_helpers.hpp"
+
+using performance_test_fixture::PerformanceTest;
+
+namespace
+{
+
+// Everything needed for a publisher/subscription pair on one topic; setup and
+// teardown stay outside the measured loops.
+struct PubSubBenchmark
+{
+  bool ok = false;
+  rcl_context_t context = rcl_get_zero_initialized_context();
+  rcl_node_t node = rcl_get_zero_initialized_node();
+  rcl_publisher_t publisher = rcl_get_zero_initialized_publisher();
+  rcl_subscription_t subscription = rcl_get_zero_initialized_subscription();
+  bool subscription_initialized = false;
+
+  explicit PubSubBenchmark(benchmark::State & st, bool with_subscription)
+  {
+    const rosidl_message_type_support_t * ts =
+      ROSIDL_GET_MSG_TYPE_SUPPORT(test_msgs, msg, BasicTypes);
+
+    rcl_init_options_t init_options = rcl_get_zero_initialized_init_options();
+    if (RCL_RET_OK != rcl_init_options_init(&init_options, rcl_get_default_allocator())) {
+      st.SkipWithError(rcl_get_error_string().str);
+      return;
+    }
+    if (RCL_RET_OK != rcl_init(0, nullptr, &init_options, &context)) {
+      st.SkipWithError(rcl_get_error_string().str);
+      return;
+    }
+    if (RCL_RET_OK != rcl_init_options_fini(&init_options)) {
+      st.SkipWithError(rcl_get_error_string().str);
+      return;
+    }
+
+    rcl_node_options_t node_options = rcl_node_get_default_options();
+    if (RCL_RET_OK != rcl_node_init(&node, "benchmark_node", "", &context, &node_options)) {
+      st.SkipWithError(rcl_get_error_string().str);
+      return;
+    }
+
+    rcl_publisher_options_t publisher_options = rcl_publisher_get_default_options();
+    if (
+      RCL_RET_OK != rcl_publisher_init(
+        &publisher, &node, ts, "benchmark_basic_types", &publisher_options))
+    {
+      st.SkipWithError(rcl_get_error_string().str);
+      return;
+    }
+
+    if (with_subscription) {
+      rcl_subscription_options_t subscription_options = rcl_subscription_get_default_options();
+      if (
+        RCL_RET_OK != rcl_subscription_init(
+          &subscription, &node, ts, "benchmark_basic_types", &subscription_options))
+      {
+        st.SkipWithError(rcl_get_error_string().str);
+        return;
+      }
+      subscription_initialized = true;
+      if (!wait_for_established_subscription(&publisher, 100, 100)) {
+        st.SkipWithError("publisher and subscription never matched");
+        return;
+      }
+    }
+    ok = true;
+  }
+
+  void fini(benchmark::State & st)
+  {
+    if (subscription_initialized &&
+      RCL_RET_OK != rcl_subscription_fini(&subscription, &node))
+    {
+      st.SkipWithError(rcl_get_error_string().str);
+    }
+    if (rcl_publisher_is_valid(&publisher) &&
+      RCL_RET_OK != rcl_publisher_fini(&publisher, &node))
+    {
+      st.SkipWithError(rcl_get_error_string().str);
+    }
+    rcl_reset_error();
+    if (rcl_node_is_valid(&node) && RCL_RET_OK != rcl_node_fini(&node)) {
+      st.SkipWithError(rcl_get_error_string().str);
+    }
+    rcl_reset_error();
+    if (rcl_context_is_valid(&context)) {
+      if (RCL_RET_OK != rcl_shutdown(&context)) {
+        st.SkipWithError(rcl_get_error_string().str);
+      }
+      if (RCL_RET_OK != rcl_context_fini(&context)) {
+        st.SkipWithError(rcl_get_error_string().str);
+      }
+    }
+  }
+};
+
+}  // namespace
+
+// Measures rcl_publish() of a small fixed-size message with no subscribers,
+// which isolates the rcl and rmw send path.
+BENCHMARK_F(PerformanceTest, publish_basic_types)(benchmark::State & st)
+{
+  PubSubBenchmark fixture(st, false);
+  if (!fixture.ok) {
+    fixture.fini(st);
+    return;
+  }
+
+  test_msgs__msg__BasicTypes message;
+  test_msgs__msg__BasicTypes__init(&message);
+  message.int64_value = 42;
+
+  reset_heap_counters();
+  for (auto _ : st) {
+    RCUTILS_UNUSED(_);
+    if (RCL_RET_OK != rcl_publish(&fixture.publisher, &message, nullptr)) {
+      st.SkipWithError(rcl_get_error_string().str);
+      break;
+    }
+  }
+
+  test_msgs__msg__BasicTypes__fini(&message);
+  fixture.fini(st);
+}
+
+// Measures a publish followed by a successful rcl_take() on a matched
+// intra-process pair, covering both sides of the data plane.
+BENCHMARK_F(PerformanceTest, publish_take_basic_types)(benchmark::State & st)
+{
+  PubSubBenchmark fixture(st, true);
+  if (!fixture.ok) {
+    fixture.fini(st);
+    return;
+  }
+
+  test_msgs__msg__BasicTypes message;
+  test_msgs__msg__BasicTypes__init(&message);
+  message.int64_value = 42;
+  test_msgs__msg__BasicTypes taken_message;
+  test_msgs__msg__BasicTypes__init(&taken_message);
+
+  reset_heap_counters();
+  for (auto _ : st) {
+    RCUTILS_UNUSED(_);
+    if (RCL_RET_OK != rcl_publish(&fixture.publisher, &message, nullptr)) {
+      st.SkipWithError(rcl_get_error_string().str);
+      break;
+    }
+    rcl_ret_t take_ret = RCL_RET_SUBSCRIPTION_TAKE_FAILED;
+    while (RCL_RET_SUBSCRIPTION_TAKE_FAILED == take_ret) {
+      take_ret = rcl_take(&fixture.subscription, &taken_message, nullptr, nullptr);
+    }
+    if (RCL_RET_OK != take_ret) {
+      st.SkipWithError(rcl_get_error_string().str);
+      break;
+    }
+  }
+
+  test_msgs__msg__BasicTypes__fini(&taken_message);
+  test_msgs__msg__BasicTypes__fini(&message);
+  fixture.fini(st);
+}
@@ -0,0 +1,174 @@
+// Copyright 2022 Open Source Robotics Foundation, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <vector>
+
+#include "performance_test_fixture/performance_test_fixture.hpp"
+
+#include "rcl/error_handling.h"
+#include "rcl/guard_condition.h"
+#include "rcl/rcl.h"
+#include "rcl/time.h"
+#include "rcl/timer.h"
+#include "rcl/wait.h"
+#include "rcutils/macros.h"
+
+using performance_test_fixture::PerformanceTest;
+
+namespace
+{
+
+rcl_context_t
+init_benchmark_context(benchmark::State & st)
+{
+  rcl_context_t context = rcl_get_zero_initialized_context();
+  rcl_init_options_t init_options = rcl_get_zero_initialized_init_options();
+  if (RCL_RET_OK != rcl_init_options_init(&init_options, rcl_get_default_allocator())) {
+    st.SkipWithError(rcl_get_error_string().str);
+    return context;
+  }
+  if (RCL_RET_OK != rcl_init(0, nullptr, &init_options, &context)) {
+    st.SkipWithError(rcl_get_error_string().str);
+  }
+  if (RCL_RET_OK != rcl_init_options_fini(&init_options)) {
+    st.SkipWithError(rcl_get_error_string().str);
+  }
+  return context;
+}
+
+void
+fini_benchmark_context(rcl_context_t * context, benchmark::State & st)
+{
+  if (RCL_RET_OK != rcl_shutdown(context)) {
+    st.SkipWithError(rcl_get_error_string().str);
+  }
+  if (RCL_RET_OK != rcl_context_fini(context)) {
+    st.SkipWithError(rcl_get_error_string().str);
+  }
+}
+
+}  // namespace
+
+// Measures a rcl_wait() round trip as the wait set widens; every iteration
+// re-adds the guard conditions and polls with a zero timeout.
+BENCHMARK_DEFINE_F(PerformanceTest, wait_set_guard_conditions)(benchmark::State & st)
+{
+  const size_t width = static_cast<size_t>(st.range(0));
+  rcl_context_t context = init_benchmark_context(st);
+  if (!rcl_context_is_valid(&context)) {
+    return;
+  }
+
+  std::vector<rcl_guard_condition_t> guard_conditions(
+    width, rcl_get_zero_initialized_guard_condition());
+  for (rcl_guard_condition_t & guard_condition : guard_conditions) {
+    if (
+      RCL_RET_OK != rcl_guard_condition_init(
+        &guard_condition, &context, rcl_guard_condition_get_default_options()))
+    {
+      st.SkipWithError(rcl_get_error_string().str);
+      return;
+    }
+  }
+
+  rcl_wait_set_t wait_set = rcl_get_zero_initialized_wait_set();
+  if (
+    RCL_RET_OK != rcl_wait_set_init(
+      &wait_set, 0, width, 0, 0, 0, 0, &context, rcl_get_default_allocator()))
+  {
+    st.SkipWithError(rcl_get_error_string().str);
+    return;
+  }
+
+  reset_heap_counters();
+  for (auto _ : st) {
+    RCUTILS_UNUSED(_);
+    if (RCL_RET_OK != rcl_wait_set_clear(&wait_set)) {
+      st.SkipWithError(rcl_get_error_string().str);
+      break;
+    }
+    for (rcl_guard_condition_t & guard_condition : guard_conditions) {
+      if (RCL_RET_OK != rcl_wait_set_add_guard_condition(&wait_set, &guard_condition, nullptr)) {
+        st.SkipWithError(rcl_get_error_string().str);
+        break;
+      }
+    }
+    rcl_ret_t ret = rcl_wait(&wait_set, 0);
+    if (RCL_RET_OK != ret && RCL_RET_TIMEOUT != ret) {
+      st.SkipWithError(rcl_get_error_string().str);
+      break;
+    }
+  }
+
+  if (RCL_RET_OK != rcl_wait_set_fini(&wait_set)) {
+    st.SkipWithError(rcl_get_error_string().str);
+  }
+  for (rcl_guard_condition_t & guard_condition : guard_conditions) {
+    if (RCL_RET_OK != rcl_guard_condition_fini(&guard_condition)) {
+      st.SkipWithError(rcl_get_error_string().str);
+    }
+  }
+  fini_benchmark_context(&context, st);
+}
+BENCHMARK_REGISTER_F(PerformanceTest, wait_set_guard_conditions)
+->Arg(1)->Arg(4)->Arg(16)->Arg(64);
+
+// Measures polling a population of always-ready timers, which is the
+// executor's per-cycle timer cost.
+BENCHMARK_DEFINE_F(PerformanceTest, timer_call)(benchmark::State & st)
+{
+  const size_t timer_count = static_cast<size_t>(st.range(0));
+  rcl_context_t context = init_benchmark_context(st);
+  if (!rcl_context_is_valid(&context)) {
+    return;
+  }
+
+  rcl_clock_t clock;
+  rcl_allocator_t allocator = rcl_get_default_allocator();
+  if (RCL_RET_OK != rcl_steady_clock_init(&clock, &allocator)) {
+    st.SkipWithError(rcl_get_error_string().str);
+    return;
+  }
+
+  std::vector<rcl_timer_t> timers(timer_count, rcl_get_zero_initialized_timer());
+  for (rcl_timer_t & timer : timers) {
+    // period 0 keeps every timer ready on each call
+    if (RCL_RET_OK != rcl_timer_init(&timer, &clock, &context, 0, nullptr, allocator)) {
+      st.SkipWithError(rcl_get_error_string().str);
+      return;
+    }
+  }
+
+  reset_heap_counters();
+  for (auto _ : st) {
+    RCUTILS_UNUSED(_);
+    for (rcl_timer_t & timer : timers) {
+      if (RCL_RET_OK != rcl_timer_call(&timer)) {
+        st.SkipWithError(rcl_get_error_string().str);
+        break;
+      }
+    }
+  }
+
+  for (rcl_timer_t & timer : timers) {
+    if (RCL_RET_OK != rcl_timer_fini(&timer)) {
+      st.SkipWithError(rcl_get_error_string().str);
+    }
+  }
+  if (RCL_RET_OK != rcl_clock_fini(&clock)) {
+    st.SkipWithError(rcl_get_error_string().str);
+  }
+  fini_benchmark_context(&context, st);
+}
+BENCHMARK_REGISTER_F(PerformanceTest, timer_call)->Arg(1)->Arg(10)->Arg(100);
@@ -0,0 +1,153 @@
+// Copyright 2022 Open Source Robotics Foundation, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <vector>
+
+#include "performance_test_fixture/performance_test_fixture.hpp"
+
+#include "rcl/error_handling.h"
+#include "rcl/guard_condition.h"
+#include "rcl/rcl.h"
+#include "rcl/time.h"
+#include "rcl/timer.h"
+#include "rcl/wait.h"
+#include "rcutils/macros.h"
+
+#include "rmw/rmw.h"
+
+#include "../mocking_utils/patch.hpp"
+
+using performance_test_fixture::PerformanceTest;
+
+// Measures the rcl-side wait set bookkeeping — clear, add, the timer timeout
+// calculation, and readiness decoding — with rmw_wait stubbed out, so the
+// numbers isolate rcl from the middleware.  The population is half guard
+// conditions and half never-ready timers, matching a typical executor mix of
+// rmw-backed and rcl-evaluated entities.
+BENCHMARK_DEFINE_F(PerformanceTest, wait_set_scaling_mocked_rmw)(benchmark::State & st)
+{
+  const size_t entity_count = static_cast<size_t>(st.range(0));
+  const size_t guard_condition_count = entity_count / 2;
+  const size_t timer_count = entity_count - guard_condition_count;
+  rcl_allocator_t allocator = rcl_get_default_allocator();
+
+  rcl_context_t context = rcl_get_zero_initialized_context();
+  rcl_init_options_t init_options = rcl_get_zero_initialized_init_options();
+  if (RCL_RET_OK != rcl_init_options_init(&init_options, allocator)) {
+    st.SkipWithError(rcl_get_error_string().str);
+    return;
+  }
+  if (RCL_RET_OK != rcl_init(0, nullptr, &init_options, &context)) {
+    st.SkipWithError(rcl_get_error_string().str);
+    return;
+  }
+  if (RCL_RET_OK != rcl_init_options_fini(&init_options)) {
+    st.SkipWithError(rcl_get_error_string().str);
+    return;
+  }
+
+  std::vector<rcl_guard_condition_t> guard_conditions(
+    guard_condition_count, rcl_get_zero_initialized_guard_condition());
+  for (rcl_guard_condition_t & guard_condition : guard_conditions) {
+    if (
+      RCL_RET_OK != rcl_guard_condition_init(
+        &guard_condition, &context, rcl_guard_condition_get_default_options()))
+    {
+      st.SkipWithError(rcl_get_error_string().str);
+      return;
+    }
+  }
+
+  rcl_clock_t clock;
+  if (RCL_RET_OK != rcl_steady_clock_init(&clock, &allocator)) {
+    st.SkipWithError(rcl_get_error_string().str);
+    return;
+  }
+  std::vector<rcl_timer_t> timers(timer_count, rcl_get_zero_initialized_timer());
+  for (rcl_timer_t & timer : timers) {
+    // an hour-long period keeps the timers pending, so every iteration walks
+    // the timeout calculation without any timer becoming ready
+    if (
+      RCL_RET_OK != rcl_timer_init(
+        &timer, &clock, &context, RCL_S_TO_NS(3600), nullptr, allocator))
+    {
+      st.SkipWithError(rcl_get_error_string().str);
+      return;
+    }
+  }
+
+  rcl_wait_set_t wait_set = rcl_get_zero_initialized_wait_set();
+  if (
+    RCL_RET_OK != rcl_wait_set_init(
+      &wait_set, 0, guard_condition_count, timer_count, 0, 0, 0, &context, allocator))
+  {
+    st.SkipWithError(rcl_get_error_string().str);
+    return;
+  }
+
+  {
+    auto mock = mocking_utils::patch_and_return("lib:rcl", rmw_wait, RMW_RET_TIMEOUT);
+
+    reset_heap_counters();
+    for (auto _ : st) {
+      RCUTILS_UNUSED(_);
+      if (RCL_RET_OK != rcl_wait_set_clear(&wait_set)) {
+        st.SkipWithError(rcl_get_error_string().str);
+        break;
+      }
+      for (rcl_guard_condition_t & guard_condition : guard_conditions) {
+        if (RCL_RET_OK != rcl_wait_set_add_guard_condition(&wait_set, &guard_condition, nullptr)) {
+          st.SkipWithError(rcl_get_error_string().str);
+          break;
+        }
+      }
+      for (rcl_timer_t & timer : timers) {
+        if (RCL_RET_OK != rcl_wait_set_add_timer(&wait_set, &timer, nullptr)) {
+          st.SkipWithError(rcl_get_error_string().str);
+          break;
+        }
+      }
+      // expected-miss returns never touch the error state, so nothing to reset
+      if (RCL_RET_TIMEOUT != rcl_wait(&wait_set, 0)) {
+        st.SkipWithError(rcl_get_error_string().str);
+        break;
+      }
+    }
+  }
+
+  if (RCL_RET_OK != rcl_wait_set_fini(&wait_set)) {
+    st.SkipWithError(rcl_get_error_string().str);
+  }
+  for (rcl_timer_t & timer : timers) {
+    if (RCL_RET_OK != rcl_timer_fini(&timer)) {
+      st.SkipWithError(rcl_get_error_string().str);
+    }
+  }
+  if (RCL_RET_OK != rcl_clock_fini(&clock)) {
+    st.SkipWithError(rcl_get_error_string().str);
+  }
+  for (rcl_guard_condition_t & guard_condition : guard_conditions) {
+    if (RCL_RET_OK != rcl_guard_condition_fini(&guard_condition)) {
+      st.SkipWithError(rcl_get_error_string().str);
+    }
+  }
+  if (RCL_RET_OK != rcl_shutdown(&context)) {
+    st.SkipWithError(rcl_get_error_string().str);
+  }
+  if (RCL_RET_OK != rcl_context_fini(&context)) {
+    st.SkipWithError(rcl_get_error_string().str);
+  }
+}
+BENCHMARK_REGISTER_F(PerformanceTest, wait_set_scaling_mocked_rmw)
+->Arg(10)->Arg(100)->Arg(1000);
@@ -0,0 +1,203 @@
+// Copyright 2022 Open Source Robotics Foundation, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef MOCKING_UTILS__LATENCY_SHIM_HPP_
+#define MOCKING_UTILS__LATENCY_SHIM_HPP_
+
+#include <chrono>
+#include <cstdint>
+#include <cstdlib>
+#include <string>
+#include <thread>
+#include <utility>
+
+#include "rcutils/env.h"
+
+#include "./patch.hpp"
+
+namespace mocking_utils
+{
+
+/// Deterministic latency model for rmw call interposition.
+/**
+ * Produces `latency + uniform(0, jitter)` delays from a seeded xorshift
+ * generator, so two runs with the same seed see the same delay sequence and
+ * executor strategies can be A/B compared without a DDS vendor in the loop.
+ */
+class LatencyProfile
+{
+public:
+  LatencyProfile(
+    std::chrono::nanoseconds latency,
+    std::chrono::nanoseconds jitter = std::chrono::nanoseconds(0),
+    uint64_t seed = 1u)
+  : latency_(latency), jitter_(jitter), state_(seed != 0u ? seed : 1u)
+  {
+  }
+
+  /// Build a profile from environment variables, for runtime selection.
+  /**
+   * Reads `<prefix>_LATENCY_NS`, `<prefix>_JITTER_NS` and `<prefix>_SEED`;
+   * unset variables default to zero delay and seed 1.
+   */
+  static LatencyProfile from_env(const std::string & prefix)
+  {
+    auto read = [](const std::string & name, int64_t fallback) -> int64_t {
+        const char * value = NULL;
+        const char * error = rcutils_get_env(name.c_str(), &value);
+        if (NULL != error || NULL == value || '\0' == value[0]) {
+          return fallback;
+        }
+        return strtoll(value, NULL, 10);
+      };
+    return LatencyProfile(
+      std::chrono::nanoseconds(read(prefix + "_LATENCY_NS", 0)),
+      std::chrono::nanoseconds(read(prefix + "_JITTER_NS", 0)),
+      static_cast<uint64_t>(read(prefix + "_SEED", 1)));
+  }
+
+  std::chrono::nanoseconds next_delay()
+  {
+    std::chrono::nanoseconds delay = latency_;
+    if (jitter_.count() > 0) {
+      // xorshift64; cheap, deterministic and good enough for jitter.
+      state_ ^= state_ << 13;
+      state_ ^= state_ >> 7;
+      state_ ^= state_ << 17;
+      delay += std::chrono::nanoseconds(
+        static_cast<int64_t>(state_ % static_cast<uint64_t>(jitter_.count() + 1)));
+    }
+    return delay;
+  }
+
+private:
+  std::chrono::nanoseconds latency_;
+  std::chrono::nanoseconds jitter_;
+  uint64_t state_;
+};
+
+/// Records the distribution of observed call durations.
+/**
+ * Log-bucketed (32 linear sub-buckets per power of two) so memory stays
+ * bounded over long experiments while percentiles keep roughly 3% value
+ * precision.
+ */
+class CallDistribution
+{
+public:
+  void record(std::chrono::nanoseconds duration)
+  {
+    int64_t value_ns = duration.count();
+    if (value_ns < 0) {
+      value_ns = 0;
+    }
+    uint64_t value = static_cast<uint64_t>(value_ns) | 1u;
+    int msb = 63;
+    while (0 == (value & (1ull << msb))) {
+      --msb;
+    }
+    int shift = msb > 5 ? msb - 5 : 0;
+    size_t index = static_cast<size_t>(msb) * kSubBuckets +
+      ((static_cast<uint64_t>(value_ns) >> shift) & (kSubBuckets - 1));
+    ++counts_[index];
+    ++total_;
+    if (value_ns > max_ns_) {
+      max_ns_ = value_ns;
+    }
+    if (1 == total_ || value_ns < min_ns_) {
+      min_ns_ = value_ns;
+    }
+  }
+
+  uint64_t count() const {return total_;}
+  int64_t min_ns() const {return total_ ? min_ns_ : 0;}
+  int64_t max_ns() const {return max_ns_;}
+
+  /// Lower bound of the bucket holding the given percentile.
+  int64_t percentile_ns(double p) const
+  {
+    if (0 == total_) {
+      return 0;
+    }
+    uint64_t target = static_cast<uint64_t>(p / 100.0 * static_cast<double>(total_));
+    if (target >= total_) {
+      return max_ns_;
+    }
+    uint64_t cumulative = 0;
+    for (size_t index = 0; index < kBucketCount; ++index) {
+      cumulative += counts_[index];
+      if (cumulative > target) {
+        size_t msb = index / kSubBuckets;
+        uint64_t sub = index % kSubBuckets;
+        if (msb < 5) {
+          return static_cast<int64_t>(sub);
+        }
+        // Re-apply the implicit high bit dropped by the sub-bucket mask.
+        return static_cast<int64_t>((32u + sub) << (msb - 5));
+      }
+    }
+    return max_ns_;
+  }
+
+private:
+  static constexpr size_t kSubBuckets = 32;
+  static constexpr size_t kBucketCount = 64 * kSubBuckets;
+  uint64_t counts_[kBucketCount] = {0};
+  uint64_t total_ = 0;
+  int64_t min_ns_ = 0;
+  int64_t max_ns_ = 0;
+};
+
+}  // namespace mocking_utils
+
+/// Patch `function` to sleep for a profile-driven delay, forward to the
+/// original implementation, and record the total observed duration.
+/**
+ * The recorded duration includes the injected delay, i.e. it is the latency
+ * the rcl caller experiences.  Meant for rmw_wait, rmw_publish and the
+ * rmw_take family, e.g.:
+ *
+ *   mocking_utils::LatencyProfile profile(std::chrono::microseconds(500));
+ *   mocking_utils::CallDistribution distribution;
+ *   auto shim = mocking_utils::patch_with_latency(
+ *     "lib:rcl", rmw_wait, profile, distribution);
+ *
+ * \warning Shares the PLT trampoline limitation of inject_on_return(): on
+ *   platforms where function pointers reference their PLT entries the
+ *   original cannot be called, and the call is delayed but not forwarded.
+ */
+#define patch_with_latency(scope, function, profile, distribution) \
+  patch( \
+    scope, function, ([&, base = function](auto && ... __args) { \
+      const auto __delay = (profile).next_delay(); \
+      const auto __start = std::chrono::steady_clock::now(); \
+      if (__delay.count() > 0) { \
+        std::this_thread::sleep_for(__delay); \
+      } \
+      decltype(base(std::forward<decltype(__args)>(__args)...)) __ret{}; \
+      if (base != function) { \
+        __ret = base(std::forward<decltype(__args)>(__args)...); \
+      } else { \
+        RCUTILS_SAFE_FWRITE_TO_STDERR( \
+          "[WARNING] mocking_utils::patch_with_latency() cannot forward call to " \
+          "original '" RCUTILS_STRINGIFY(function) "' function\n" \
+          "    at " __FILE__ ":" RCUTILS_STRINGIFY(__LINE__) "\n"); \
+      } \
+      (distribution).record( \
+        std::chrono::duration_cast<std::chrono::nanoseconds>( \
+          std::chrono::steady_clock::now() - __start)); \
+      return __ret; \
+    }))
+
+#endif  // MOCKING_UTILS__LATENCY_SHIM_HPP_
@@ -0,0 +1,312 @@
+// Copyright 2022 Open Source Robotics Foundation, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// Throughput/latency soak tool for the rcl data plane.
+//
+// Drives a matched publisher/subscription pair through the full rcl
+// publish/take path at a configurable message size and rate, and prints a
+// per-percentile latency breakdown from an HDR-style log-bucketed histogram
+// at the end of the run.  Usage:
+//
+//   soak_pub_sub [--size BYTES] [--rate HZ] [--duration SECONDS] [ros args...]
+//
+// Unrecognized arguments are handed to rcl_init(), so remapping and QoS
+// profile overrides work the usual way.
+
+#include <chrono>
+#include <cinttypes>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+#include <thread>
+
+#include "osrf_testing_tools_cpp/scope_exit.hpp"
+
+#include "rcl/error_handling.h"
+#include "rcl/publisher.h"
+#include "rcl/rcl.h"
+#include "rcl/subscription.h"
+#include "rcutils/logging_macros.h"
+
+#include "rosidl_runtime_c/string_functions.h"
+#include "test_msgs/msg/strings.h"
+
+#include "wait_for_entity_helpers.hpp"
+
+namespace
+{
+
+// HDR-style histogram: one power-of-two major bucket per bit position with
+// 32 linear sub-buckets, which bounds memory for arbitrarily long soaks
+// while keeping roughly 3% value precision at every magnitude.
+class LatencyHistogram
+{
+public:
+  void record(int64_t latency_ns)
+  {
+    if (latency_ns < 0) {
+      latency_ns = 0;
+    }
+    uint64_t value = static_cast<uint64_t>(latency_ns) | 1u;
+    int msb = 63;
+    while (0 == (value & (1ull << msb))) {
+      --msb;
+    }
+    int shift = msb > 5 ? msb - 5 : 0;
+    size_t index = static_cast<size_t>(msb) * kSubBuckets +
+      ((static_cast<uint64_t>(latency_ns) >> shift) & (kSubBuckets - 1));
+    ++counts_[index];
+    ++total_;
+    if (latency_ns > max_) {
+      max_ = latency_ns;
+    }
+  }
+
+  // Lower bound of the bucket holding the given percentile.
+  int64_t percentile(double p) const
+  {
+    if (0 == total_) {
+      return 0;
+    }
+    uint64_t target = static_cast<uint64_t>(p / 100.0 * static_cast<double>(total_));
+    if (target >= total_) {
+      return max_;
+    }
+    uint64_t cumulative = 0;
+    for (size_t index = 0; index < kBucketCount; ++index) {
+      cumulative += counts_[index];
+      if (cumulative > target) {
+        size_t msb = index / kSubBuckets;
+        uint64_t sub = index % kSubBuckets;
+        if (msb < 5) {
+          return static_cast<int64_t>(sub);
+        }
+        // Re-apply the implicit high bit dropped by the sub-bucket mask.
+        return static_cast<int64_t>((32u + sub) << (msb - 5));
+      }
+    }
+    return max_;
+  }
+
+  uint64_t total() const {return total_;}
+  int64_t max() const {return max_;}
+
+private:
+  static constexpr size_t kSubBuckets = 32;
+  static constexpr size_t kBucketCount = 64 * kSubBuckets;
+  uint64_t counts_[kBucketCount] = {0};
+  uint64_t total_ = 0;
+  int64_t max_ = 0;
+};
+
+int64_t
+steady_now_ns()
+{
+  return std::chrono::duration_cast<std::chrono::nanoseconds>(
+    std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+}  // namespace
+
+int main(int argc, char ** argv)
+{
+  size_t message_size = 256;
+  int64_t rate_hz = 100;
+  int64_t duration_sec = 10;
+  for (int i = 1; i < argc - 1; ++i) {
+    if (0 == strcmp("--size", argv[i])) {
+      message_size = static_cast<size_t>(strtoull(argv[i + 1], NULL, 10));
+    } else if (0 == strcmp("--rate", argv[i])) {
+      rate_hz = strtoll(argv[i + 1], NULL, 10);
+    } else if (0 == strcmp("--duration", argv[i])) {
+      duration_sec = strtoll(argv[i + 1], NULL, 10);
+    }
+  }
+  if (rate_hz <= 0 || duration_sec <= 0) {
+    RCUTILS_LOG_ERROR_NAMED(ROS_PACKAGE_NAME, "--rate and --duration must be positive");
+    return -1;
+  }
+
+  int main_ret = 0;
+  {
+    rcl_init_options_t init_options = rcl_get_zero_initialized_init_options();
+    rcl_ret_t ret = rcl_init_options_init(&init_options, rcl_get_default_allocator());
+    if (RCL_RET_OK != ret) {
+      RCUTILS_LOG_ERROR_NAMED(
+        ROS_PACKAGE_NAME, "Error in rcl init options init: %s", rcl_get_error_string().str);
+      return -1;
+    }
+    rcl_context_t context = rcl_get_zero_initialized_context();
+    if (rcl_init(argc, argv, &init_options, &context) != RCL_RET_OK) {
+      RCUTILS_LOG_ERROR_NAMED(
+        ROS_PACKAGE_NAME, "Error in rcl init: %s", rcl_get_error_string().str);
+      return -1;
+    }
+    OSRF_TESTING_TOOLS_CPP_SCOPE_EXIT(
+    {
+      if (rcl_shutdown(&context) != RCL_RET_OK) {
+        RCUTILS_LOG_ERROR_NAMED(
+          ROS_PACKAGE_NAME, "Error shutting down rcl: %s", rcl_get_error_string().str);
+        main_ret = -1;
+      }
+      if (rcl_context_fini(&context) != RCL_RET_OK) {
+        RCUTILS_LOG_ERROR_NAMED(
+          ROS_PACKAGE_NAME, "Error finalizing rcl context: %s", rcl_get_error_string().str);
+        main_ret = -1;
+      }
+    });
+    if (rcl_init_options_fini(&init_options) != RCL_RET_OK) {
+      RCUTILS_LOG_ERROR_NAMED(
+        ROS_PACKAGE_NAME, "Error finalizing init options: %s", rcl_get_error_string().str);
+      return -1;
+    }
+
+    rcl_node_t node = rcl_get_zero_initialized_node();
+    rcl_node_options_t node_options = rcl_node_get_default_options();
+    if (rcl_node_init(&node, "soak_pub_sub", "", &context, &node_options) != RCL_RET_OK) {
+      RCUTILS_LOG_ERROR_NAMED(
+        ROS_PACKAGE_NAME, "Error creating node: %s", rcl_get_error_string().str);
+      return -1;
+    }
+    OSRF_TESTING_TOOLS_CPP_SCOPE_EXIT(
+    {
+      if (rcl_node_fini(&node) != RCL_RET_OK) {
+        RCUTILS_LOG_ERROR_NAMED(
+          ROS_PACKAGE_NAME, "Error finalizing node: %s", rcl_get_error_string().str);
+        main_ret = -1;
+      }
+    });
+
+    const rosidl_message_type_support_t * ts =
+      ROSIDL_GET_MSG_TYPE_SUPPORT(test_msgs, msg, Strings);
+    rcl_publisher_t publisher = rcl_get_zero_initialized_publisher();
+    rcl_publisher_options_t publisher_options = rcl_publisher_get_default_options();
+    if (rcl_publisher_init(&publisher, &node, ts, "soak_pub_sub", &publisher_options) !=
+      RCL_RET_OK)
+    {
+      RCUTILS_LOG_ERROR_NAMED(
+        ROS_PACKAGE_NAME, "Error creating publisher: %s", rcl_get_error_string().str);
+      return -1;
+    }
+    OSRF_TESTING_TOOLS_CPP_SCOPE_EXIT(
+    {
+      if (rcl_publisher_fini(&publisher, &node) != RCL_RET_OK) {
+        RCUTILS_LOG_ERROR_NAMED(
+          ROS_PACKAGE_NAME, "Error finalizing publisher: %s", rcl_get_error_string().str);
+        main_ret = -1;
+      }
+    });
+    rcl_subscription_t subscription = rcl_get_zero_initialized_subscription();
+    rcl_subscription_options_t subscription_options = rcl_subscription_get_default_options();
+    if (rcl_subscription_init(&subscription, &node, ts, "soak_pub_sub", &subscription_options) !=
+      RCL_RET_OK)
+    {
+      RCUTILS_LOG_ERROR_NAMED(
+        ROS_PACKAGE_NAME, "Error creating subscription: %s", rcl_get_error_string().str);
+      return -1;
+    }
+    OSRF_TESTING_TOOLS_CPP_SCOPE_EXIT(
+    {
+      if (rcl_subscription_fini(&subscription, &node) != RCL_RET_OK) {
+        RCUTILS_LOG_ERROR_NAMED(
+          ROS_PACKAGE_NAME, "Error finalizing subscription: %s", rcl_get_error_string().str);
+        main_ret = -1;
+      }
+    });
+    if (!wait_for_established_subscription(&publisher, 100, 100)) {
+      RCUTILS_LOG_ERROR_NAMED(
+        ROS_PACKAGE_NAME, "Publisher and subscription never matched");
+      return -1;
+    }
+
+    test_msgs__msg__Strings outbound;
+    test_msgs__msg__Strings inbound;
+    if (!test_msgs__msg__Strings__init(&outbound) || !test_msgs__msg__Strings__init(&inbound)) {
+      RCUTILS_LOG_ERROR_NAMED(ROS_PACKAGE_NAME, "Error initializing messages");
+      return -1;
+    }
+    OSRF_TESTING_TOOLS_CPP_SCOPE_EXIT(
+    {
+      test_msgs__msg__Strings__fini(&outbound);
+      test_msgs__msg__Strings__fini(&inbound);
+    });
+    std::string payload(message_size, 'x');
+    if (!rosidl_runtime_c__String__assign(&outbound.string_value, payload.c_str())) {
+      RCUTILS_LOG_ERROR_NAMED(ROS_PACKAGE_NAME, "Error assigning payload");
+      return -1;
+    }
+
+    LatencyHistogram histogram;
+    uint64_t published = 0;
+    uint64_t dropped = 0;
+    const int64_t period_ns = 1000000000 / rate_hz;
+    const int64_t take_deadline_ns = 100 * 1000000ll;  // per-message take budget
+    const int64_t soak_start = steady_now_ns();
+    const int64_t soak_end = soak_start + duration_sec * 1000000000ll;
+    int64_t next_publish = soak_start;
+
+    while (steady_now_ns() < soak_end) {
+      const int64_t publish_time = steady_now_ns();
+      ret = rcl_publish(&publisher, &outbound, NULL);
+      if (RCL_RET_OK != ret) {
+        RCUTILS_LOG_ERROR_NAMED(
+          ROS_PACKAGE_NAME, "Error publishing: %s", rcl_get_error_string().str);
+        return -1;
+      }
+      ++published;
+      bool taken = false;
+      while (steady_now_ns() - publish_time < take_deadline_ns) {
+        ret = rcl_take(&subscription, &inbound, NULL, NULL);
+        if (RCL_RET_OK == ret) {
+          taken = true;
+          break;
+        }
+        if (RCL_RET_SUBSCRIPTION_TAKE_FAILED != ret) {
+          RCUTILS_LOG_ERROR_NAMED(
+            ROS_PACKAGE_NAME, "Error taking: %s", rcl_get_error_string().str);
+          return -1;
+        }
+        std::this_thread::yield();
+      }
+      if (taken) {
+        histogram.record(steady_now_ns() - publish_time);
+      } else {
+        ++dropped;
+      }
+      next_publish += period_ns;
+      std::this_thread::sleep_until(
+        std::chrono::steady_clock::time_point(std::chrono::nanoseconds(next_publish)));
+    }
+
+    const double elapsed_sec =
+      static_cast<double>(steady_now_ns() - soak_start) / 1e9;
+    printf("soak_pub_sub results\n");
+    printf("  message size:  %zu bytes\n", message_size);
+    printf("  target rate:   %" PRId64 " Hz\n", rate_hz);
+    printf("  published:     %" PRIu64 " (%.1f msg/s, %.3f MB/s)\n",
+      published, static_cast<double>(published) / elapsed_sec,
+      static_cast<double>(published * message_size) / elapsed_sec / 1e6);
+    printf("  taken:         %" PRIu64 "\n", histogram.total());
+    printf("  dropped:       %" PRIu64 "\n", dropped);
+    printf("  latency percentiles (publish-to-take, nanoseconds):\n");
+    const double percentiles[] = {50.0, 90.0, 99.0, 99.9, 99.99};
+    for (double p : percentiles) {
+      printf("    p%-6g %12" PRId64 "\n", p, histogram.percentile(p));
+    }
+    printf("    max    %12" PRId64 "\n", histogram.max());
+  }
+  return main_ret;
+}
@@ -0,0 +1,278 @@
+// Copyright 2022 Open Source Robotics Foundation, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// Allocation regression harness for the data-plane functions.
+//
+// These tests certify that, after initialization, the rcl side of
+// rcl_publish(), rcl_take(), rcl_timer_call(), rcl_wait() with a
+// preallocated wait set, and rcl_trigger_guard_condition() performs zero
+// allocator calls.  The rmw entry points are stubbed out with mimick so the
+// assertions cover rcl bookkeeping regardless of how the middleware manages
+// its own memory.  They run under the "allocation_regression" ctest label so
+// a hot-path allocation shows up as a loud, isolated CI failure instead of a
+// production surprise.
+
+#include <gtest/gtest.h>
+
+#include "osrf_testing_tools_cpp/memory_tools/memory_tools.hpp"
+#include "osrf_testing_tools_cpp/scope_exit.hpp"
+
+#include "rcl/error_handling.h"
+#include "rcl/rcl.h"
+#include "rcl/time.h"
+#include "rcl/timer.h"
+#include "rcl/wait.h"
+
+#include "rmw/rmw.h"
+
+#include "rosidl_runtime_c/message_type_support_struct.h"
+#include "test_msgs/msg/basic_types.h"
+
+#include "../mocking_utils/patch.hpp"
+
+#ifdef RMW_IMPLEMENTATION
+# define CLASSNAME_(NAME, SUFFIX) NAME ## __ ## SUFFIX
+# define CLASSNAME(NAME, SUFFIX) CLASSNAME_(NAME, SUFFIX)
+#else
+# define CLASSNAME(NAME, SUFFIX) NAME
+#endif
+
+using osrf_testing_tools_cpp::memory_tools::on_unexpected_malloc;
+using osrf_testing_tools_cpp::memory_tools::on_unexpected_realloc;
+using osrf_testing_tools_cpp::memory_tools::on_unexpected_calloc;
+using osrf_testing_tools_cpp::memory_tools::on_unexpected_free;
+
+class CLASSNAME (TestAllocationRegressionFixture, RMW_IMPLEMENTATION)
+  : public ::testing::Test
+{
+public:
+  rcl_context_t context = rcl_get_zero_initialized_context();
+  rcl_node_t node = rcl_get_zero_initialized_node();
+
+  void SetUp()
+  {
+    osrf_testing_tools_cpp::memory_tools::initialize();
+    on_unexpected_malloc([]() {ADD_FAILURE() << "UNEXPECTED MALLOC";});
+    on_unexpected_realloc([]() {ADD_FAILURE() << "UNEXPECTED REALLOC";});
+    on_unexpected_calloc([]() {ADD_FAILURE() << "UNEXPECTED CALLOC";});
+    on_unexpected_free([]() {ADD_FAILURE() << "UNEXPECTED FREE";});
+
+    rcl_ret_t ret;
+    rcl_init_options_t init_options = rcl_get_zero_initialized_init_options();
+    ret = rcl_init_options_init(&init_options, rcl_get_default_allocator());
+    ASSERT_EQ(RCL_RET_OK, ret) << rcl_get_error_string().str;
+    OSRF_TESTING_TOOLS_CPP_SCOPE_EXIT(
+    {
+      EXPECT_EQ(RCL_RET_OK, rcl_init_options_fini(&init_options)) << rcl_get_error_string().str;
+    });
+    ret = rcl_init(0, nullptr, &init_options, &this->context);
+    ASSERT_EQ(RCL_RET_OK, ret) << rcl_get_error_string().str;
+    rcl_node_options_t node_options = rcl_node_get_default_options();
+    ret = rcl_node_init(
+      &this->node, "allocation_regression_node", "", &this->context, &node_options);
+    ASSERT_EQ(RCL_RET_OK, ret) << rcl_get_error_string().str;
+  }
+
+  void TearDown()
+  {
+    EXPECT_EQ(RCL_RET_OK, rcl_node_fini(&this->node)) << rcl_get_error_string().str;
+    EXPECT_EQ(RCL_RET_OK, rcl_shutdown(&this->context)) << rcl_get_error_string().str;
+    EXPECT_EQ(RCL_RET_OK, rcl_context_fini(&this->context)) << rcl_get_error_string().str;
+    osrf_testing_tools_cpp::memory_tools::uninitialize();
+  }
+};
+
+TEST_F(
+  CLASSNAME(TestAllocationRegressionFixture, RMW_IMPLEMENTATION),
+  test_publish_no_allocations)
+{
+  const rosidl_message_type_support_t * ts =
+    ROSIDL_GET_MSG_TYPE_SUPPORT(test_msgs, msg, BasicTypes);
+  rcl_publisher_t publisher = rcl_get_zero_initialized_publisher();
+  rcl_publisher_options_t publisher_options = rcl_publisher_get_default_options();
+  rcl_ret_t ret = rcl_publisher_init(
+    &publisher, &this->node, ts, "allocation_regression", &publisher_options);
+  ASSERT_EQ(RCL_RET_OK, ret) << rcl_get_error_string().str;
+  OSRF_TESTING_TOOLS_CPP_SCOPE_EXIT(
+  {
+    EXPECT_EQ(RCL_RET_OK, rcl_publisher_fini(&publisher, &this->node)) <<
+      rcl_get_error_string().str;
+  });
+
+  test_msgs__msg__BasicTypes message;
+  ASSERT_TRUE(test_msgs__msg__BasicTypes__init(&message));
+  OSRF_TESTING_TOOLS_CPP_SCOPE_EXIT({test_msgs__msg__BasicTypes__fini(&message);});
+
+  auto mock = mocking_utils::patch_and_return("lib:rcl", rmw_publish, RMW_RET_OK);
+  // Warm up once so any lazily initialized state is in place.
+  ASSERT_EQ(RCL_RET_OK, rcl_publish(&publisher, &message, nullptr)) << rcl_get_error_string().str;
+
+  osrf_testing_tools_cpp::memory_tools::enable_monitoring_in_all_threads();
+  EXPECT_NO_MEMORY_OPERATIONS(
+  {
+    ret = rcl_publish(&publisher, &message, nullptr);
+  });
+  osrf_testing_tools_cpp::memory_tools::disable_monitoring_in_all_threads();
+  EXPECT_EQ(RCL_RET_OK, ret) << rcl_get_error_string().str;
+}
+
+TEST_F(
+  CLASSNAME(TestAllocationRegressionFixture, RMW_IMPLEMENTATION),
+  test_take_no_allocations)
+{
+  const rosidl_message_type_support_t * ts =
+    ROSIDL_GET_MSG_TYPE_SUPPORT(test_msgs, msg, BasicTypes);
+  rcl_subscription_t subscription = rcl_get_zero_initialized_subscription();
+  rcl_subscription_options_t subscription_options = rcl_subscription_get_default_options();
+  rcl_ret_t ret = rcl_subscription_init(
+    &subscription, &this->node, ts, "allocation_regression", &subscription_options);
+  ASSERT_EQ(RCL_RET_OK, ret) << rcl_get_error_string().str;
+  OSRF_TESTING_TOOLS_CPP_SCOPE_EXIT(
+  {
+    EXPECT_EQ(RCL_RET_OK, rcl_subscription_fini(&subscription, &this->node)) <<
+      rcl_get_error_string().str;
+  });
+
+  test_msgs__msg__BasicTypes message;
+  ASSERT_TRUE(test_msgs__msg__BasicTypes__init(&message));
+  OSRF_TESTING_TOOLS_CPP_SCOPE_EXIT({test_msgs__msg__BasicTypes__fini(&message);});
+
+  // The stub leaves the taken flag false, so the call exercises the full rcl
+  // path and returns the expected-miss code, which must not allocate either.
+  auto mock = mocking_utils::patch_and_return("lib:rcl", rmw_take_with_info, RMW_RET_OK);
+  ret = rcl_take(&subscription, &message, nullptr, nullptr);
+  ASSERT_EQ(RCL_RET_SUBSCRIPTION_TAKE_FAILED, ret);
+
+  osrf_testing_tools_cpp::memory_tools::enable_monitoring_in_all_threads();
+  EXPECT_NO_MEMORY_OPERATIONS(
+  {
+    ret = rcl_take(&subscription, &message, nullptr, nullptr);
+  });
+  osrf_testing_tools_cpp::memory_tools::disable_monitoring_in_all_threads();
+  EXPECT_EQ(RCL_RET_SUBSCRIPTION_TAKE_FAILED, ret);
+}
+
+TEST_F(
+  CLASSNAME(TestAllocationRegressionFixture, RMW_IMPLEMENTATION),
+  test_timer_call_no_allocations)
+{
+  rcl_clock_t clock;
+  rcl_allocator_t allocator = rcl_get_default_allocator();
+  ASSERT_EQ(RCL_RET_OK, rcl_steady_clock_init(&clock, &allocator)) << rcl_get_error_string().str;
+  rcl_timer_t timer = rcl_get_zero_initialized_timer();
+  rcl_ret_t ret = rcl_timer_init(
+    &timer, &clock, &this->context, 0, nullptr, allocator);
+  ASSERT_EQ(RCL_RET_OK, ret) << rcl_get_error_string().str;
+  OSRF_TESTING_TOOLS_CPP_SCOPE_EXIT(
+  {
+    EXPECT_EQ(RCL_RET_OK, rcl_timer_fini(&timer)) << rcl_get_error_string().str;
+    EXPECT_EQ(RCL_RET_OK, rcl_clock_fini(&clock)) << rcl_get_error_string().str;
+  });
+
+  ASSERT_EQ(RCL_RET_OK, rcl_timer_call(&timer)) << rcl_get_error_string().str;
+
+  osrf_testing_tools_cpp::memory_tools::enable_monitoring_in_all_threads();
+  EXPECT_NO_MEMORY_OPERATIONS(
+  {
+    ret = rcl_timer_call(&timer);
+  });
+  osrf_testing_tools_cpp::memory_tools::disable_monitoring_in_all_threads();
+  EXPECT_EQ(RCL_RET_OK, ret) << rcl_get_error_string().str;
+}
+
+TEST_F(
+  CLASSNAME(TestAllocationRegressionFixture, RMW_IMPLEMENTATION),
+  test_wait_preallocated_no_allocations)
+{
+  rcl_allocator_t allocator = rcl_get_default_allocator();
+  rcl_guard_condition_t guard_condition = rcl_get_zero_initialized_guard_condition();
+  rcl_ret_t ret = rcl_guard_condition_init(
+    &guard_condition, &this->context, rcl_guard_condition_get_default_options());
+  ASSERT_EQ(RCL_RET_OK, ret) << rcl_get_error_string().str;
+  rcl_clock_t clock;
+  ASSERT_EQ(RCL_RET_OK, rcl_steady_clock_init(&clock, &allocator)) << rcl_get_error_string().str;
+  rcl_timer_t timer = rcl_get_zero_initialized_timer();
+  // An hour-long period keeps the timer pending, so the wait always times out.
+  ret = rcl_timer_init(
+    &timer, &clock, &this->context, RCL_S_TO_NS(3600), nullptr, allocator);
+  ASSERT_EQ(RCL_RET_OK, ret) << rcl_get_error_string().str;
+  rcl_wait_set_t wait_set = rcl_get_zero_initialized_wait_set();
+  ret = rcl_wait_set_init(&wait_set, 0, 1, 1, 0, 0, 0, &this->context, allocator);
+  ASSERT_EQ(RCL_RET_OK, ret) << rcl_get_error_string().str;
+  OSRF_TESTING_TOOLS_CPP_SCOPE_EXIT(
+  {
+    EXPECT_EQ(RCL_RET_OK, rcl_wait_set_fini(&wait_set)) << rcl_get_error_string().str;
+    EXPECT_EQ(RCL_RET_OK, rcl_timer_fini(&timer)) << rcl_get_error_string().str;
+    EXPECT_EQ(RCL_RET_OK, rcl_clock_fini(&clock)) << rcl_get_error_string().str;
+    EXPECT_EQ(RCL_RET_OK, rcl_guard_condition_fini(&guard_condition)) <<
+      rcl_get_error_string().str;
+  });
+
+  auto mock = mocking_utils::patch_and_return("lib:rcl", rmw_wait, RMW_RET_TIMEOUT);
+
+  // Warm up one full cycle so the readiness bitmaps and any other lazily
+  // sized storage reach their steady-state size.
+  ASSERT_EQ(RCL_RET_OK, rcl_wait_set_clear(&wait_set)) << rcl_get_error_string().str;
+  ASSERT_EQ(
+    RCL_RET_OK, rcl_wait_set_add_guard_condition(&wait_set, &guard_condition, nullptr)) <<
+    rcl_get_error_string().str;
+  ASSERT_EQ(RCL_RET_OK, rcl_wait_set_add_timer(&wait_set, &timer, nullptr)) <<
+    rcl_get_error_string().str;
+  ASSERT_EQ(RCL_RET_TIMEOUT, rcl_wait(&wait_set, 0));
+
+  osrf_testing_tools_cpp::memory_tools::enable_monitoring_in_all_threads();
+  EXPECT_NO_MEMORY_OPERATIONS(
+  {
+    ret = rcl_wait_set_clear(&wait_set);
+    if (RCL_RET_OK == ret) {
+      ret = rcl_wait_set_add_guard_condition(&wait_set, &guard_condition, nullptr);
+    }
+    if (RCL_RET_OK == ret) {
+      ret = rcl_wait_set_add_timer(&wait_set, &timer, nullptr);
+    }
+    if (RCL_RET_OK == ret) {
+      ret = rcl_wait(&wait_set, 0);
+    }
+  });
+  osrf_testing_tools_cpp::memory_tools::disable_monitoring_in_all_threads();
+  EXPECT_EQ(RCL_RET_TIMEOUT, ret);
+}
+
+TEST_F(
+  CLASSNAME(TestAllocationRegressionFixture, RMW_IMPLEMENTATION),
+  test_trigger_guard_condition_no_allocations)
+{
+  rcl_guard_condition_t guard_condition = rcl_get_zero_initialized_guard_condition();
+  rcl_ret_t ret = rcl_guard_condition_init(
+    &guard_condition, &this->context, rcl_guard_condition_get_default_options());
+  ASSERT_EQ(RCL_RET_OK, ret) << rcl_get_error_string().str;
+  OSRF_TESTING_TOOLS_CPP_SCOPE_EXIT(
+  {
+    EXPECT_EQ(RCL_RET_OK, rcl_guard_condition_fini(&guard_condition)) <<
+      rcl_get_error_string().str;
+  });
+
+  auto mock = mocking_utils::patch_and_return(
+    "lib:rcl", rmw_trigger_guard_condition, RMW_RET_OK);
+  ASSERT_EQ(RCL_RET_OK, rcl_trigger_guard_condition(&guard_condition)) <<
+    rcl_get_error_string().str;
+
+  osrf_testing_tools_cpp::memory_tools::enable_monitoring_in_all_threads();
+  EXPECT_NO_MEMORY_OPERATIONS(
+  {
+    ret = rcl_trigger_guard_condition(&guard_condition);
+  });
+  osrf_testing_tools_cpp::memory_tools::disable_monitoring_in_all_threads();
+  EXPECT_EQ(RCL_RET_OK, ret) << rcl_get_error_string().str;
+}
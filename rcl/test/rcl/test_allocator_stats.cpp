@@ -0,0 +1,146 @@
+// Copyright 2026 Open Source Robotics Foundation, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <gtest/gtest.h>
+
+#include "rcl/error_handling.h"
+
+#include "rcl/allocator_stats.h"
+
+TEST(TestAllocatorStats, init) {
+  rcl_allocator_t allocator = rcl_get_default_allocator();
+  rcl_stats_allocator_t stats_allocator;
+  EXPECT_EQ(RCL_RET_INVALID_ARGUMENT, rcl_stats_allocator_init(nullptr, &allocator));
+  rcl_reset_error();
+  EXPECT_EQ(RCL_RET_INVALID_ARGUMENT, rcl_stats_allocator_init(&stats_allocator, nullptr));
+  rcl_reset_error();
+  ASSERT_EQ(RCL_RET_OK, rcl_stats_allocator_init(&stats_allocator, &allocator)) <<
+    rcl_get_error_string().str;
+
+  rcl_allocator_stats_t stats;
+  EXPECT_EQ(RCL_RET_INVALID_ARGUMENT, rcl_stats_allocator_get_stats(nullptr, &stats));
+  rcl_reset_error();
+  EXPECT_EQ(RCL_RET_INVALID_ARGUMENT, rcl_stats_allocator_get_stats(&stats_allocator, nullptr));
+  rcl_reset_error();
+  ASSERT_EQ(RCL_RET_OK, rcl_stats_allocator_get_stats(&stats_allocator, &stats)) <<
+    rcl_get_error_string().str;
+  EXPECT_EQ(0u, stats.allocation_count);
+  EXPECT_EQ(0u, stats.deallocation_count);
+  EXPECT_EQ(0u, stats.reallocation_count);
+  EXPECT_EQ(0u, stats.failed_allocation_count);
+  EXPECT_EQ(0u, stats.bytes_requested);
+}
+
+TEST(TestAllocatorStats, counting) {
+  rcl_allocator_t allocator = rcl_get_default_allocator();
+  rcl_stats_allocator_t stats_allocator;
+  ASSERT_EQ(RCL_RET_OK, rcl_stats_allocator_init(&stats_allocator, &allocator)) <<
+    rcl_get_error_string().str;
+  rcl_allocator_t facade = rcl_stats_allocator_get_allocator(&stats_allocator);
+
+  void * first = facade.allocate(16, facade.state);
+  ASSERT_NE(nullptr, first);
+  void * second = facade.zero_allocate(4, 8, facade.state);
+  ASSERT_NE(nullptr, second);
+  first = facade.reallocate(first, 64, facade.state);
+  ASSERT_NE(nullptr, first);
+  facade.deallocate(first, facade.state);
+  facade.deallocate(second, facade.state);
+  // Deallocating NULL is not counted.
+  facade.deallocate(nullptr, facade.state);
+
+  rcl_allocator_stats_t stats;
+  ASSERT_EQ(RCL_RET_OK, rcl_stats_allocator_get_stats(&stats_allocator, &stats)) <<
+    rcl_get_error_string().str;
+  EXPECT_EQ(2u, stats.allocation_count);
+  EXPECT_EQ(2u, stats.deallocation_count);
+  EXPECT_EQ(1u, stats.reallocation_count);
+  EXPECT_EQ(0u, stats.failed_allocation_count);
+  EXPECT_EQ(16u + 32u + 64u, stats.bytes_requested);
+}
+
+TEST(TestAllocatorStats, tracking_per_domain) {
+  rcl_allocator_t allocator = rcl_get_default_allocator();
+  rcl_tracking_allocator_t tracking_allocator;
+  EXPECT_EQ(RCL_RET_INVALID_ARGUMENT, rcl_tracking_allocator_init(nullptr, &allocator));
+  rcl_reset_error();
+  ASSERT_EQ(RCL_RET_OK, rcl_tracking_allocator_init(&tracking_allocator, &allocator)) <<
+    rcl_get_error_string().str;
+
+  rcl_allocator_t wait_set = rcl_tracking_allocator_get_allocator(
+    &tracking_allocator, RCL_ALLOC_DOMAIN_WAIT_SET);
+  rcl_allocator_t graph = rcl_tracking_allocator_get_allocator(
+    &tracking_allocator, RCL_ALLOC_DOMAIN_GRAPH);
+  EXPECT_EQ(
+    nullptr, rcl_tracking_allocator_get_allocator(
+      &tracking_allocator, RCL_ALLOC_DOMAIN_COUNT).allocate);
+
+  void * first = wait_set.allocate(100, wait_set.state);
+  ASSERT_NE(nullptr, first);
+  void * second = wait_set.allocate(50, wait_set.state);
+  ASSERT_NE(nullptr, second);
+  void * third = graph.zero_allocate(8, 8, graph.state);
+  ASSERT_NE(nullptr, third);
+
+  rcl_domain_alloc_stats_t stats;
+  ASSERT_EQ(
+    RCL_RET_OK, rcl_tracking_allocator_get_domain_stats(
+      &tracking_allocator, RCL_ALLOC_DOMAIN_WAIT_SET, &stats)) << rcl_get_error_string().str;
+  EXPECT_EQ(2u, stats.live_allocation_count);
+  EXPECT_EQ(150u, stats.live_bytes);
+
+  // Releasing through another domain's facade still balances the allocating
+  // domain's counters, via the per-allocation header.
+  graph.deallocate(second, graph.state);
+  ASSERT_EQ(
+    RCL_RET_OK, rcl_tracking_allocator_get_domain_stats(
+      &tracking_allocator, RCL_ALLOC_DOMAIN_WAIT_SET, &stats)) << rcl_get_error_string().str;
+  EXPECT_EQ(1u, stats.live_allocation_count);
+  EXPECT_EQ(100u, stats.live_bytes);
+  EXPECT_EQ(2u, stats.peak_allocation_count);
+  EXPECT_EQ(150u, stats.peak_bytes);
+  EXPECT_EQ(2u, stats.total_allocation_count);
+  EXPECT_EQ(150u, stats.total_bytes);
+
+  // Growth through reallocate stays attributed to the original domain.
+  first = wait_set.reallocate(first, 200, wait_set.state);
+  ASSERT_NE(nullptr, first);
+  ASSERT_EQ(
+    RCL_RET_OK, rcl_tracking_allocator_get_domain_stats(
+      &tracking_allocator, RCL_ALLOC_DOMAIN_WAIT_SET, &stats)) << rcl_get_error_string().str;
+  EXPECT_EQ(200u, stats.live_bytes);
+  EXPECT_EQ(250u, stats.total_bytes);
+
+  wait_set.deallocate(first, wait_set.state);
+  graph.deallocate(third, graph.state);
+  ASSERT_EQ(
+    RCL_RET_OK, rcl_tracking_allocator_get_domain_stats(
+      &tracking_allocator, RCL_ALLOC_DOMAIN_WAIT_SET, &stats)) << rcl_get_error_string().str;
+  EXPECT_EQ(0u, stats.live_allocation_count);
+  EXPECT_EQ(0u, stats.live_bytes);
+  ASSERT_EQ(
+    RCL_RET_OK, rcl_tracking_allocator_get_domain_stats(
+      &tracking_allocator, RCL_ALLOC_DOMAIN_GRAPH, &stats)) << rcl_get_error_string().str;
+  EXPECT_EQ(0u, stats.live_allocation_count);
+  EXPECT_EQ(1u, stats.peak_allocation_count);
+  EXPECT_EQ(64u, stats.total_bytes);
+
+  EXPECT_EQ(
+    RCL_RET_INVALID_ARGUMENT, rcl_tracking_allocator_get_domain_stats(
+      &tracking_allocator, RCL_ALLOC_DOMAIN_COUNT, &stats));
+  rcl_reset_error();
+
+  EXPECT_STREQ("wait set", rcl_alloc_domain_name(RCL_ALLOC_DOMAIN_WAIT_SET));
+  EXPECT_STREQ("unknown", rcl_alloc_domain_name(RCL_ALLOC_DOMAIN_COUNT));
+}
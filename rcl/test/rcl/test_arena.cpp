@@ -0,0 +1,119 @@
+// Copyright 2026 Open Source Robotics Foundation, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <gtest/gtest.h>
+
+#include <cstring>
+
+#include "rcl/error_handling.h"
+
+#include "rcl/arena.h"
+
+TEST(TestArena, init_fini) {
+  rcl_allocator_t allocator = rcl_get_default_allocator();
+  rcl_arena_t arena = rcl_get_zero_initialized_arena();
+  EXPECT_EQ(RCL_RET_INVALID_ARGUMENT, rcl_arena_init(nullptr, 4096, &allocator));
+  rcl_reset_error();
+  EXPECT_EQ(RCL_RET_INVALID_ARGUMENT, rcl_arena_init(&arena, 0, &allocator));
+  rcl_reset_error();
+  ASSERT_EQ(RCL_RET_OK, rcl_arena_init(&arena, 4096, &allocator)) << rcl_get_error_string().str;
+  // Finalizing before any allocation happened is a no-op.
+  EXPECT_EQ(RCL_RET_OK, rcl_arena_fini(&arena)) << rcl_get_error_string().str;
+  EXPECT_EQ(RCL_RET_INVALID_ARGUMENT, rcl_arena_fini(nullptr));
+  rcl_reset_error();
+}
+
+TEST(TestArena, allocate) {
+  rcl_allocator_t allocator = rcl_get_default_allocator();
+  rcl_arena_t arena = rcl_get_zero_initialized_arena();
+  ASSERT_EQ(RCL_RET_OK, rcl_arena_init(&arena, 256, &allocator)) << rcl_get_error_string().str;
+
+  // Allocating from an uninitialized arena fails instead of crashing.
+  rcl_arena_t zero_arena = rcl_get_zero_initialized_arena();
+  EXPECT_EQ(nullptr, rcl_arena_allocate(&zero_arena, 8));
+
+  // Many small allocations spanning several blocks stay writable and distinct.
+  char * pointers[100];
+  for (size_t i = 0; i < 100; ++i) {
+    pointers[i] = static_cast<char *>(rcl_arena_allocate(&arena, 32));
+    ASSERT_NE(nullptr, pointers[i]);
+    memset(pointers[i], static_cast<int>(i), 32);
+  }
+  for (size_t i = 0; i < 100; ++i) {
+    for (size_t b = 0; b < 32; ++b) {
+      ASSERT_EQ(static_cast<char>(i), pointers[i][b]);
+    }
+  }
+
+  // A request larger than the block size gets its own block.
+  void * big = rcl_arena_allocate(&arena, 4096);
+  ASSERT_NE(nullptr, big);
+  memset(big, 0xab, 4096);
+
+  EXPECT_EQ(RCL_RET_OK, rcl_arena_fini(&arena)) << rcl_get_error_string().str;
+}
+
+TEST(TestArena, allocator_facade) {
+  rcl_allocator_t allocator = rcl_get_default_allocator();
+  rcl_arena_t arena = rcl_get_zero_initialized_arena();
+  ASSERT_EQ(RCL_RET_OK, rcl_arena_init(&arena, 1024, &allocator)) << rcl_get_error_string().str;
+  rcl_allocator_t facade = rcl_arena_get_allocator(&arena);
+
+  char * buffer = static_cast<char *>(facade.allocate(16, facade.state));
+  ASSERT_NE(nullptr, buffer);
+  snprintf(buffer, 16, "%s", "hello arena");
+
+  // Growing preserves the previous contents; shrinking returns the same block.
+  char * grown = static_cast<char *>(facade.reallocate(buffer, 64, facade.state));
+  ASSERT_NE(nullptr, grown);
+  EXPECT_STREQ("hello arena", grown);
+  EXPECT_EQ(grown, facade.reallocate(grown, 8, facade.state));
+
+  char * zeroed = static_cast<char *>(facade.zero_allocate(4, 8, facade.state));
+  ASSERT_NE(nullptr, zeroed);
+  for (size_t i = 0; i < 32; ++i) {
+    ASSERT_EQ('\0', zeroed[i]);
+  }
+
+  // Deallocation through the facade is a no-op; the data stays valid.
+  facade.deallocate(grown, facade.state);
+  EXPECT_STREQ("hello arena", grown);
+
+  EXPECT_EQ(RCL_RET_OK, rcl_arena_fini(&arena)) << rcl_get_error_string().str;
+}
+
+TEST(TestArena, reset) {
+  rcl_allocator_t allocator = rcl_get_default_allocator();
+  rcl_arena_t arena = rcl_get_zero_initialized_arena();
+  EXPECT_EQ(RCL_RET_INVALID_ARGUMENT, rcl_arena_reset(nullptr));
+  rcl_reset_error();
+  ASSERT_EQ(RCL_RET_OK, rcl_arena_init(&arena, 256, &allocator)) << rcl_get_error_string().str;
+
+  // Resetting before any allocation happened is a no-op.
+  EXPECT_EQ(RCL_RET_OK, rcl_arena_reset(&arena)) << rcl_get_error_string().str;
+
+  for (size_t scope = 0; scope < 3; ++scope) {
+    // Fill several blocks, then rewind to reuse the memory for the next scope.
+    for (size_t i = 0; i < 50; ++i) {
+      void * pointer = rcl_arena_allocate(&arena, 32);
+      ASSERT_NE(nullptr, pointer);
+      memset(pointer, static_cast<int>(i), 32);
+    }
+    EXPECT_EQ(RCL_RET_OK, rcl_arena_reset(&arena)) << rcl_get_error_string().str;
+  }
+
+  // Only the retained warm block is left to release.
+  EXPECT_NE(nullptr, arena.blocks);
+  EXPECT_EQ(RCL_RET_OK, rcl_arena_fini(&arena)) << rcl_get_error_string().str;
+}
@@ -23,9 +23,12 @@
 #include "rcl/rcl.h"
 #include "rcl/arguments.h"
 #include "rcl/error_handling.h"
+#include "rcl/remap.h"
 
 #include "rcl_yaml_param_parser/parser.h"
 
+#include "rcutils/logging.h"
+
 #include "rcutils/testing/fault_injection.h"
 
 #include "./allocator_testing_utils.h"
@@ -510,6 +513,8 @@ TEST_F(CLASSNAME(TestArgumentsFixture, RMW_IMPLEMENTATION), test_copy) {
   rcl_arguments_t copied_args = rcl_get_zero_initialized_arguments();
   ret = rcl_arguments_copy(&parsed_args, &copied_args);
   EXPECT_EQ(RCL_RET_OK, ret) << rcl_get_error_string().str;
+  // Copies share the reference counted impl
+  EXPECT_EQ(parsed_args.impl, copied_args.impl);
 
   // Can't copy to non empty
   ret = rcl_arguments_copy(&parsed_args, &copied_args);
@@ -525,6 +530,72 @@ TEST_F(CLASSNAME(TestArgumentsFixture, RMW_IMPLEMENTATION), test_copy) {
   EXPECT_EQ(RCL_RET_OK, rcl_arguments_fini(&copied_args));
 }
 
+TEST_F(CLASSNAME(TestArgumentsFixture, RMW_IMPLEMENTATION), test_serialize_roundtrip) {
+  const char * const argv[] = {
+    "process_name", "--ros-args",
+    "-r", "__node:=new_name",
+    "-r", "/foo/bar:=/fiz/buz",
+    "--log-level", "rcl:=debug",
+    "--enclave", "/enclave"
+  };
+  const int argc = sizeof(argv) / sizeof(const char *);
+  rcl_allocator_t alloc = rcl_get_default_allocator();
+  rcl_arguments_t parsed_args = rcl_get_zero_initialized_arguments();
+  rcl_ret_t ret;
+
+  ret = rcl_parse_arguments(argc, argv, alloc, &parsed_args);
+  ASSERT_EQ(RCL_RET_OK, ret) << rcl_get_error_string().str;
+
+  uint8_t * blob = NULL;
+  size_t blob_length = 0;
+  ret = rcl_arguments_serialize(&parsed_args, alloc, &blob, &blob_length);
+  ASSERT_EQ(RCL_RET_OK, ret) << rcl_get_error_string().str;
+  ASSERT_NE(nullptr, blob);
+  ASSERT_GT(blob_length, 0u);
+
+  rcl_arguments_t restored_args = rcl_get_zero_initialized_arguments();
+  ret = rcl_arguments_deserialize(blob, blob_length, alloc, &restored_args);
+  ASSERT_EQ(RCL_RET_OK, ret) << rcl_get_error_string().str;
+
+  EXPECT_EQ(parsed_args.impl->num_remap_rules, restored_args.impl->num_remap_rules);
+  ASSERT_NE(nullptr, restored_args.impl->enclave);
+  EXPECT_STREQ("/enclave", restored_args.impl->enclave);
+
+  rcl_log_levels_t log_levels = rcl_get_zero_initialized_log_levels();
+  ret = rcl_arguments_get_log_levels(&restored_args, &log_levels);
+  ASSERT_EQ(RCL_RET_OK, ret) << rcl_get_error_string().str;
+  ASSERT_EQ(1u, log_levels.num_logger_settings);
+  EXPECT_STREQ("rcl", log_levels.logger_settings[0].name);
+  EXPECT_EQ(RCUTILS_LOG_SEVERITY_DEBUG, log_levels.logger_settings[0].level);
+  EXPECT_EQ(RCL_RET_OK, rcl_log_levels_fini(&log_levels));
+
+  // Restored remap rules are usable, including the compiled lookup index
+  char * remapped = NULL;
+  ret = rcl_remap_topic_name(
+    &restored_args, NULL, "/foo/bar", "node_name", "/", alloc, &remapped);
+  ASSERT_EQ(RCL_RET_OK, ret) << rcl_get_error_string().str;
+  ASSERT_NE(nullptr, remapped);
+  EXPECT_STREQ("/fiz/buz", remapped);
+  alloc.deallocate(remapped, alloc.state);
+
+  EXPECT_EQ(RCL_RET_OK, rcl_arguments_fini(&restored_args));
+
+  // Truncated and corrupted blobs are rejected
+  rcl_arguments_t bad_args = rcl_get_zero_initialized_arguments();
+  EXPECT_EQ(
+    RCL_RET_INVALID_ARGUMENT,
+    rcl_arguments_deserialize(blob, blob_length / 2, alloc, &bad_args));
+  rcl_reset_error();
+  blob[0] ^= 0xff;
+  EXPECT_EQ(
+    RCL_RET_INVALID_ARGUMENT,
+    rcl_arguments_deserialize(blob, blob_length, alloc, &bad_args));
+  rcl_reset_error();
+
+  alloc.deallocate(blob, alloc.state);
+  EXPECT_EQ(RCL_RET_OK, rcl_arguments_fini(&parsed_args));
+}
+
 TEST_F(CLASSNAME(TestArgumentsFixture, RMW_IMPLEMENTATION), test_copy_bad_alloc) {
   const char * const argv[] = {"process_name", "--ros-args", "/foo/bar:="};
   const int argc = sizeof(argv) / sizeof(const char *);
@@ -538,11 +609,12 @@ TEST_F(CLASSNAME(TestArgumentsFixture, RMW_IMPLEMENTATION), test_copy_bad_alloc)
   rcl_allocator_t bad_alloc = get_failing_allocator();
   rcl_allocator_t saved_alloc = parsed_args.impl->allocator;
   parsed_args.impl->allocator = bad_alloc;
+  // Copies share the impl and allocate nothing, so a failing allocator is fine.
   ret = rcl_arguments_copy(&parsed_args, &copied_args);
-  EXPECT_EQ(RCL_RET_BAD_ALLOC, ret) << rcl_get_error_string().str;
-  rcl_reset_error();
+  EXPECT_EQ(RCL_RET_OK, ret) << rcl_get_error_string().str;
   parsed_args.impl->allocator = saved_alloc;
 
+  EXPECT_EQ(RCL_RET_OK, rcl_arguments_fini(&copied_args)) << rcl_get_error_string().str;
   EXPECT_EQ(RCL_RET_OK, rcl_arguments_fini(&parsed_args)) << rcl_get_error_string().str;
 }
 
@@ -931,7 +1003,12 @@ TEST_F(CLASSNAME(TestArgumentsFixture, RMW_IMPLEMENTATION), test_param_argument_
   }
   alloc.deallocate(parameter_files, alloc.state);
 
-  // Test bad alloc
+  // Expected usage; the first call materializes the overrides from the file
+  rcl_params_t * params = NULL;
+  ret = rcl_arguments_get_param_overrides(&parsed_args, &params);
+  EXPECT_EQ(RCL_RET_OK, ret) << rcl_get_error_string().str;
+
+  // Test bad alloc on the copy of the materialized overrides
   rcl_allocator_t bad_alloc = get_failing_allocator();
   rcl_params_t * params_test = NULL;
   rcl_allocator_t saved_alloc = parsed_args.impl->allocator;
@@ -940,11 +1017,6 @@ TEST_F(CLASSNAME(TestArgumentsFixture, RMW_IMPLEMENTATION), test_param_argument_
   EXPECT_EQ(RCL_RET_BAD_ALLOC, ret) << rcl_get_error_string().str;
   EXPECT_EQ(NULL, params_test);
   parsed_args.impl->parameter_overrides->allocator = saved_alloc;
-
-  // Expected usage
-  rcl_params_t * params = NULL;
-  ret = rcl_arguments_get_param_overrides(&parsed_args, &params);
-  EXPECT_EQ(RCL_RET_OK, ret) << rcl_get_error_string().str;
   OSRF_TESTING_TOOLS_CPP_SCOPE_EXIT(
   {
     rcl_yaml_node_struct_fini(params);
@@ -136,6 +136,83 @@ TEST_F(TestClientFixture, test_client_nominal) {
 }
 
 
+/* Basic test of the pipelined request mode. Response completion is exercised
+ * together with a service at test_service.cpp
+ */
+TEST_F(TestClientFixture, test_client_pipeline) {
+  rcl_ret_t ret;
+  rcl_client_t client = rcl_get_zero_initialized_client();
+  const char * topic_name = "add_two_ints";
+  rcl_client_options_t client_options = rcl_client_get_default_options();
+  const rosidl_service_type_support_t * ts = ROSIDL_GET_SRV_TYPE_SUPPORT(
+    test_msgs, srv, BasicTypes);
+  ret = rcl_client_init(&client, this->node_ptr, ts, topic_name, &client_options);
+  ASSERT_EQ(RCL_RET_OK, ret) << rcl_get_error_string().str;
+  OSRF_TESTING_TOOLS_CPP_SCOPE_EXIT(
+  {
+    rcl_ret_t ret = rcl_client_fini(&client, this->node_ptr);
+    EXPECT_EQ(RCL_RET_OK, ret) << rcl_get_error_string().str;
+  });
+
+  const auto callback = [](const void *, int64_t, void *) {};
+  test_msgs__srv__BasicTypes_Request req;
+  test_msgs__srv__BasicTypes_Request__init(&req);
+  test_msgs__srv__BasicTypes_Response res;
+  test_msgs__srv__BasicTypes_Response__init(&res);
+  OSRF_TESTING_TOOLS_CPP_SCOPE_EXIT(
+  {
+    test_msgs__srv__BasicTypes_Request__fini(&req);
+    test_msgs__srv__BasicTypes_Response__fini(&res);
+  });
+
+  int64_t sequence_number = 0;
+  size_t completed = 0u;
+  EXPECT_EQ(RCL_RET_CLIENT_INVALID, rcl_client_init_pipeline(nullptr, 4));
+  rcl_reset_error();
+  EXPECT_EQ(RCL_RET_INVALID_ARGUMENT, rcl_client_init_pipeline(&client, 0));
+  rcl_reset_error();
+  // sending and draining require pipelining to be initialized
+  EXPECT_EQ(
+    RCL_RET_INVALID_ARGUMENT,
+    rcl_send_request_pipelined(&client, &req, callback, nullptr, &sequence_number));
+  rcl_reset_error();
+  EXPECT_EQ(RCL_RET_INVALID_ARGUMENT, rcl_client_drain_responses(&client, &res, &completed));
+  rcl_reset_error();
+
+  ASSERT_EQ(RCL_RET_OK, rcl_client_init_pipeline(&client, 2)) << rcl_get_error_string().str;
+  EXPECT_EQ(RCL_RET_ALREADY_INIT, rcl_client_init_pipeline(&client, 2));
+  rcl_reset_error();
+
+  EXPECT_EQ(
+    RCL_RET_INVALID_ARGUMENT,
+    rcl_send_request_pipelined(&client, nullptr, callback, nullptr, &sequence_number));
+  rcl_reset_error();
+  // a NULL callback is fine, the context is handed back by the demuxed take
+  ASSERT_EQ(
+    RCL_RET_OK,
+    rcl_send_request_pipelined(&client, &req, nullptr, nullptr, &sequence_number)) <<
+    rcl_get_error_string().str;
+  EXPECT_EQ(1, sequence_number);
+  ASSERT_EQ(
+    RCL_RET_OK,
+    rcl_send_request_pipelined(&client, &req, callback, nullptr, &sequence_number)) <<
+    rcl_get_error_string().str;
+  EXPECT_EQ(2, sequence_number);
+  // the window is full now
+  EXPECT_EQ(
+    RCL_RET_ERROR,
+    rcl_send_request_pipelined(&client, &req, callback, nullptr, &sequence_number));
+  rcl_reset_error();
+
+  // no service is running, so there is nothing to drain
+  EXPECT_EQ(RCL_RET_CLIENT_TAKE_FAILED, rcl_client_drain_responses(&client, &res, &completed));
+  EXPECT_EQ(0u, completed);
+
+  ASSERT_EQ(RCL_RET_OK, rcl_client_fini_pipeline(&client)) << rcl_get_error_string().str;
+  // fini is idempotent
+  EXPECT_EQ(RCL_RET_OK, rcl_client_fini_pipeline(&client)) << rcl_get_error_string().str;
+}
+
 /* Testing the client init and fini functions.
  */
 TEST_F(TestClientFixture, test_client_init_fini) {
@@ -130,6 +130,23 @@ TEST_F(CLASSNAME(TestContextFixture, RMW_IMPLEMENTATION), nominal) {
   EXPECT_TRUE(is_valid) << rcl_get_error_string().str;
   rcl_reset_error();
 
+  // test rcl_context_get_init_timings
+  rcl_init_timings_t init_timings;
+
+  EXPECT_EQ(RCL_RET_INVALID_ARGUMENT, rcl_context_get_init_timings(nullptr, &init_timings));
+  rcl_reset_error();
+
+  EXPECT_EQ(RCL_RET_INVALID_ARGUMENT, rcl_context_get_init_timings(&context, nullptr));
+  rcl_reset_error();
+
+  EXPECT_EQ(RCL_RET_OK, rcl_context_get_init_timings(&context, &init_timings));
+  EXPECT_GT(init_timings.total_ns, 0);
+  EXPECT_GE(init_timings.argument_parsing_ns, 0);
+  EXPECT_GE(init_timings.discovery_ns, 0);
+  EXPECT_GE(init_timings.security_ns, 0);
+  // the rmw context was created eagerly, so its phase was recorded
+  EXPECT_GT(init_timings.rmw_init_ns, 0);
+
   // test rcl_context_get_rmw_context
   rmw_context_t * rmw_context_ptr;
   EXPECT_NO_MEMORY_OPERATIONS(
@@ -17,6 +17,7 @@
 #include "osrf_testing_tools_cpp/scope_exit.hpp"
 
 #include "rcl/discovery_options.h"
+#include "rcl/env_snapshot.h"
 #include "rcl/rcl.h"
 
 #include "rcutils/allocator.h"
@@ -59,6 +60,7 @@ TEST(TestDiscoveryInfo, test_get_peers) {
 
   // Retrieve peers if peer list is empty
   ASSERT_TRUE(rcutils_set_env("ROS_STATIC_PEERS", ""));
+  ASSERT_EQ(RCL_RET_OK, rcl_env_snapshot_refresh());
   EXPECT_EQ(RCL_RET_OK, rcl_get_discovery_static_peers(&discovery_options_var, &allocator));
   EXPECT_EQ(0u, discovery_options_var.static_peers_count);
   EXPECT_EQ(RCL_RET_OK, rmw_discovery_options_fini(&discovery_options_var));
@@ -66,6 +68,7 @@ TEST(TestDiscoveryInfo, test_get_peers) {
   // Retrieve peers if peer list has one IPv4 peer
   discovery_options_var = rmw_get_zero_initialized_discovery_options();
   ASSERT_TRUE(rcutils_set_env("ROS_STATIC_PEERS", "192.168.0.1"));
+  ASSERT_EQ(RCL_RET_OK, rcl_env_snapshot_refresh());
   EXPECT_EQ(RCL_RET_OK, rcl_get_discovery_static_peers(&discovery_options_var, &allocator));
   EXPECT_EQ(1u, discovery_options_var.static_peers_count);
   EXPECT_STREQ("192.168.0.1", discovery_options_var.static_peers[0].peer_address);
@@ -74,6 +77,7 @@ TEST(TestDiscoveryInfo, test_get_peers) {
   // Retrieve peers if peer list has one IPv6 peer
   discovery_options_var = rmw_get_zero_initialized_discovery_options();
   ASSERT_TRUE(rcutils_set_env("ROS_STATIC_PEERS", "ceab:78ee:b73a:ec05:0898:0b2c:5ce5:8ed3"));
+  ASSERT_EQ(RCL_RET_OK, rcl_env_snapshot_refresh());
   EXPECT_EQ(RCL_RET_OK, rcl_get_discovery_static_peers(&discovery_options_var, &allocator));
   EXPECT_EQ(1u, discovery_options_var.static_peers_count);
   EXPECT_STREQ(
@@ -84,6 +88,7 @@ TEST(TestDiscoveryInfo, test_get_peers) {
   // Retrieve peers if peer list has two IPv4 peers
   discovery_options_var = rmw_get_zero_initialized_discovery_options();
   ASSERT_TRUE(rcutils_set_env("ROS_STATIC_PEERS", "192.168.0.1;10.0.0.2"));
+  ASSERT_EQ(RCL_RET_OK, rcl_env_snapshot_refresh());
   EXPECT_EQ(RCL_RET_OK, rcl_get_discovery_static_peers(&discovery_options_var, &allocator));
   EXPECT_EQ(2u, discovery_options_var.static_peers_count);
   EXPECT_STREQ("192.168.0.1", discovery_options_var.static_peers[0].peer_address);
@@ -94,6 +99,7 @@ TEST(TestDiscoveryInfo, test_get_peers) {
   discovery_options_var = rmw_get_zero_initialized_discovery_options();
   ASSERT_TRUE(
     rcutils_set_env("ROS_STATIC_PEERS", "192.168.0.1;ceab:78ee:b73a:ec05:0898:0b2c:5ce5:8ed3"));
+  ASSERT_EQ(RCL_RET_OK, rcl_env_snapshot_refresh());
   EXPECT_EQ(RCL_RET_OK, rcl_get_discovery_static_peers(&discovery_options_var, &allocator));
   EXPECT_EQ(2u, discovery_options_var.static_peers_count);
   EXPECT_STREQ("192.168.0.1", discovery_options_var.static_peers[0].peer_address);
@@ -106,6 +112,7 @@ TEST(TestDiscoveryInfo, test_get_peers) {
   discovery_options_var = rmw_get_zero_initialized_discovery_options();
   ASSERT_TRUE(
     rcutils_set_env("ROS_STATIC_PEERS", "ceab:78ee:b73a:ec05:0898:0b2c:5ce5:8ed3;192.168.0.1"));
+  ASSERT_EQ(RCL_RET_OK, rcl_env_snapshot_refresh());
   EXPECT_EQ(RCL_RET_OK, rcl_get_discovery_static_peers(&discovery_options_var, &allocator));
   EXPECT_EQ(2u, discovery_options_var.static_peers_count);
   EXPECT_STREQ(
@@ -117,6 +124,7 @@ TEST(TestDiscoveryInfo, test_get_peers) {
   // Retrieve peers if peer list has one two IPv4 peers with subnet mask
   discovery_options_var = rmw_get_zero_initialized_discovery_options();
   ASSERT_TRUE(rcutils_set_env("ROS_STATIC_PEERS", "10.1.2.3;192.168.0.0/24"));
+  ASSERT_EQ(RCL_RET_OK, rcl_env_snapshot_refresh());
   EXPECT_EQ(RCL_RET_OK, rcl_get_discovery_static_peers(&discovery_options_var, &allocator));
   EXPECT_EQ(2u, discovery_options_var.static_peers_count);
   EXPECT_STREQ("10.1.2.3", discovery_options_var.static_peers[0].peer_address);
@@ -126,6 +134,7 @@ TEST(TestDiscoveryInfo, test_get_peers) {
   // Retrieve peers if peer list is empty
   discovery_options_var = rmw_get_zero_initialized_discovery_options();
   ASSERT_TRUE(rcutils_set_env("ROS_STATIC_PEERS", ";"));
+  ASSERT_EQ(RCL_RET_OK, rcl_env_snapshot_refresh());
   EXPECT_EQ(RCL_RET_OK, rcl_get_discovery_static_peers(&discovery_options_var, &allocator));
   EXPECT_EQ(0u, discovery_options_var.static_peers_count);
   EXPECT_EQ(RCL_RET_OK, rmw_discovery_options_fini(&discovery_options_var));
@@ -133,6 +142,7 @@ TEST(TestDiscoveryInfo, test_get_peers) {
   // Retrieve peer with trailing ;
   discovery_options_var = rmw_get_zero_initialized_discovery_options();
   ASSERT_TRUE(rcutils_set_env("ROS_STATIC_PEERS", "192.168.0.1;"));
+  ASSERT_EQ(RCL_RET_OK, rcl_env_snapshot_refresh());
   EXPECT_EQ(RCL_RET_OK, rcl_get_discovery_static_peers(&discovery_options_var, &allocator));
   EXPECT_EQ(1u, discovery_options_var.static_peers_count);
   EXPECT_STREQ("192.168.0.1", discovery_options_var.static_peers[0].peer_address);
@@ -141,6 +151,7 @@ TEST(TestDiscoveryInfo, test_get_peers) {
   // Retrieve peer with starting ;
   discovery_options_var = rmw_get_zero_initialized_discovery_options();
   ASSERT_TRUE(rcutils_set_env("ROS_STATIC_PEERS", ";192.168.0.1"));
+  ASSERT_EQ(RCL_RET_OK, rcl_env_snapshot_refresh());
   EXPECT_EQ(RCL_RET_OK, rcl_get_discovery_static_peers(&discovery_options_var, &allocator));
   EXPECT_EQ(1u, discovery_options_var.static_peers_count);
   EXPECT_STREQ("192.168.0.1", discovery_options_var.static_peers[0].peer_address);
@@ -149,6 +160,7 @@ TEST(TestDiscoveryInfo, test_get_peers) {
   // Retrieve peer with FQDN
   discovery_options_var = rmw_get_zero_initialized_discovery_options();
   ASSERT_TRUE(rcutils_set_env("ROS_STATIC_PEERS", "example.com"));
+  ASSERT_EQ(RCL_RET_OK, rcl_env_snapshot_refresh());
   EXPECT_EQ(RCL_RET_OK, rcl_get_discovery_static_peers(&discovery_options_var, &allocator));
   EXPECT_EQ(1u, discovery_options_var.static_peers_count);
   EXPECT_STREQ("example.com", discovery_options_var.static_peers[0].peer_address);
@@ -157,6 +169,7 @@ TEST(TestDiscoveryInfo, test_get_peers) {
   // Retrieve peer with FQDN and IPv4
   discovery_options_var = rmw_get_zero_initialized_discovery_options();
   ASSERT_TRUE(rcutils_set_env("ROS_STATIC_PEERS", "example.com;192.168.0.1"));
+  ASSERT_EQ(RCL_RET_OK, rcl_env_snapshot_refresh());
   EXPECT_EQ(RCL_RET_OK, rcl_get_discovery_static_peers(&discovery_options_var, &allocator));
   EXPECT_EQ(2u, discovery_options_var.static_peers_count);
   EXPECT_STREQ("example.com", discovery_options_var.static_peers[0].peer_address);
@@ -166,11 +179,13 @@ TEST(TestDiscoveryInfo, test_get_peers) {
 
 TEST(TestDiscoveryInfo, test_get_automatic_discovery_range) {
   ASSERT_TRUE(rcutils_set_env("ROS_STATIC_PEERS", ""));
+  ASSERT_EQ(RCL_RET_OK, rcl_env_snapshot_refresh());
   rmw_discovery_options_t discovery_options_var = rmw_get_zero_initialized_discovery_options();
 
   // Set unexpected discovery range. Should default to LOCALHOST
   discovery_options_var = rmw_get_zero_initialized_discovery_options();
   ASSERT_TRUE(rcutils_set_env("ROS_AUTOMATIC_DISCOVERY_RANGE", "0"));
+  ASSERT_EQ(RCL_RET_OK, rcl_env_snapshot_refresh());
   EXPECT_EQ(RCL_RET_OK, rcl_get_automatic_discovery_range(&discovery_options_var));
   EXPECT_EQ(
     RMW_AUTOMATIC_DISCOVERY_RANGE_LOCALHOST,
@@ -179,12 +194,14 @@ TEST(TestDiscoveryInfo, test_get_automatic_discovery_range) {
   // Set discovery range to OFF
   discovery_options_var = rmw_get_zero_initialized_discovery_options();
   ASSERT_TRUE(rcutils_set_env("ROS_AUTOMATIC_DISCOVERY_RANGE", "OFF"));
+  ASSERT_EQ(RCL_RET_OK, rcl_env_snapshot_refresh());
   EXPECT_EQ(RCL_RET_OK, rcl_get_automatic_discovery_range(&discovery_options_var));
   EXPECT_EQ(RMW_AUTOMATIC_DISCOVERY_RANGE_OFF, discovery_options_var.automatic_discovery_range);
 
   // Set discovery range to LOCALHOST
   discovery_options_var = rmw_get_zero_initialized_discovery_options();
   ASSERT_TRUE(rcutils_set_env("ROS_AUTOMATIC_DISCOVERY_RANGE", "LOCALHOST"));
+  ASSERT_EQ(RCL_RET_OK, rcl_env_snapshot_refresh());
   EXPECT_EQ(RCL_RET_OK, rcl_get_automatic_discovery_range(&discovery_options_var));
   EXPECT_EQ(
     RMW_AUTOMATIC_DISCOVERY_RANGE_LOCALHOST,
@@ -193,12 +210,14 @@ TEST(TestDiscoveryInfo, test_get_automatic_discovery_range) {
   // Set discovery range to SUBNET
   discovery_options_var = rmw_get_zero_initialized_discovery_options();
   ASSERT_TRUE(rcutils_set_env("ROS_AUTOMATIC_DISCOVERY_RANGE", "SUBNET"));
+  ASSERT_EQ(RCL_RET_OK, rcl_env_snapshot_refresh());
   EXPECT_EQ(RCL_RET_OK, rcl_get_automatic_discovery_range(&discovery_options_var));
   EXPECT_EQ(RMW_AUTOMATIC_DISCOVERY_RANGE_SUBNET, discovery_options_var.automatic_discovery_range);
 
   // Set unexpected discovery range. Should default to LOCALHOST
   discovery_options_var = rmw_get_zero_initialized_discovery_options();
   ASSERT_TRUE(rcutils_set_env("ROS_AUTOMATIC_DISCOVERY_RANGE", "Unexpected"));
+  ASSERT_EQ(RCL_RET_OK, rcl_env_snapshot_refresh());
   EXPECT_EQ(RCL_RET_OK, rcl_get_automatic_discovery_range(&discovery_options_var));
   EXPECT_EQ(
     RMW_AUTOMATIC_DISCOVERY_RANGE_LOCALHOST,
@@ -224,7 +243,9 @@ TEST(TestDiscoveryInfo, test_get_both) {
   rmw_discovery_options_t discovery_options_var = rmw_get_zero_initialized_discovery_options();
 
   ASSERT_TRUE(rcutils_set_env("ROS_STATIC_PEERS", ""));
+  ASSERT_EQ(RCL_RET_OK, rcl_env_snapshot_refresh());
   ASSERT_TRUE(rcutils_set_env("ROS_AUTOMATIC_DISCOVERY_RANGE", "0"));
+  ASSERT_EQ(RCL_RET_OK, rcl_env_snapshot_refresh());
   EXPECT_EQ(RCL_RET_OK, rcl_get_automatic_discovery_range(&discovery_options_var));
   EXPECT_EQ(RCL_RET_OK, rcl_get_discovery_static_peers(&discovery_options_var, &allocator));
   EXPECT_EQ(
@@ -236,7 +257,9 @@ TEST(TestDiscoveryInfo, test_get_both) {
   discovery_options_var = rmw_get_zero_initialized_discovery_options();
   ASSERT_TRUE(
     rcutils_set_env("ROS_STATIC_PEERS", "192.168.0.1;ceab:78ee:b73a:ec05:0898:0b2c:5ce5:8ed3"));
+  ASSERT_EQ(RCL_RET_OK, rcl_env_snapshot_refresh());
   ASSERT_TRUE(rcutils_set_env("ROS_AUTOMATIC_DISCOVERY_RANGE", "LOCALHOST"));
+  ASSERT_EQ(RCL_RET_OK, rcl_env_snapshot_refresh());
   EXPECT_EQ(RCL_RET_OK, rcl_get_automatic_discovery_range(&discovery_options_var));
   EXPECT_EQ(RCL_RET_OK, rcl_get_discovery_static_peers(&discovery_options_var, &allocator));
   EXPECT_EQ(
@@ -252,7 +275,9 @@ TEST(TestDiscoveryInfo, test_get_both) {
   discovery_options_var = rmw_get_zero_initialized_discovery_options();
   ASSERT_TRUE(
     rcutils_set_env("ROS_STATIC_PEERS", "192.168.0.1;ceab:78ee:b73a:ec05:0898:0b2c:5ce5:8ed3"));
+  ASSERT_EQ(RCL_RET_OK, rcl_env_snapshot_refresh());
   ASSERT_TRUE(rcutils_set_env("ROS_AUTOMATIC_DISCOVERY_RANGE", "SUBNET"));
+  ASSERT_EQ(RCL_RET_OK, rcl_env_snapshot_refresh());
   EXPECT_EQ(RCL_RET_OK, rcl_get_automatic_discovery_range(&discovery_options_var));
   EXPECT_EQ(RCL_RET_OK, rcl_get_discovery_static_peers(&discovery_options_var, &allocator));
   EXPECT_EQ(RMW_AUTOMATIC_DISCOVERY_RANGE_SUBNET, discovery_options_var.automatic_discovery_range);
@@ -265,7 +290,9 @@ TEST(TestDiscoveryInfo, test_get_both) {
 
   discovery_options_var = rmw_get_zero_initialized_discovery_options();
   ASSERT_TRUE(rcutils_set_env("ROS_STATIC_PEERS", ""));
+  ASSERT_EQ(RCL_RET_OK, rcl_env_snapshot_refresh());
   ASSERT_TRUE(rcutils_set_env("ROS_AUTOMATIC_DISCOVERY_RANGE", "SUBNET"));
+  ASSERT_EQ(RCL_RET_OK, rcl_env_snapshot_refresh());
   EXPECT_EQ(RCL_RET_OK, rcl_get_automatic_discovery_range(&discovery_options_var));
   EXPECT_EQ(RCL_RET_OK, rcl_get_discovery_static_peers(&discovery_options_var, &allocator));
   EXPECT_EQ(RMW_AUTOMATIC_DISCOVERY_RANGE_SUBNET, discovery_options_var.automatic_discovery_range);
@@ -285,36 +312,86 @@ TEST(TestDiscoveryInfo, test_with_localhost_only) {
   {
     // only ROS_AUTOMATIC_DISCOVERY_RANGE and ROS_STATIC_PEERS set
     ASSERT_TRUE(rcutils_set_env("ROS_AUTOMATIC_DISCOVERY_RANGE", "LOCALHOST"));
+    ASSERT_EQ(RCL_RET_OK, rcl_env_snapshot_refresh());
     ASSERT_TRUE(rcutils_set_env("ROS_STATIC_PEERS", "127.0.0.1;localhost.com"));
+    ASSERT_EQ(RCL_RET_OK, rcl_env_snapshot_refresh());
     check_discovery(RMW_AUTOMATIC_DISCOVERY_RANGE_LOCALHOST, 2);
   }
 
   {
     // Only ROS_LOCALHOST_ONLY is enabled
     ASSERT_TRUE(rcutils_set_env("ROS_LOCALHOST_ONLY", "1"));
+    ASSERT_EQ(RCL_RET_OK, rcl_env_snapshot_refresh());
     check_discovery(RMW_AUTOMATIC_DISCOVERY_RANGE_LOCALHOST, 0);
   }
 
   {
     // ROS_LOCALHOST_ONLY is enabled and prevails over SUBNET.
     ASSERT_TRUE(rcutils_set_env("ROS_LOCALHOST_ONLY", "1"));
+    ASSERT_EQ(RCL_RET_OK, rcl_env_snapshot_refresh());
     ASSERT_TRUE(rcutils_set_env("ROS_AUTOMATIC_DISCOVERY_RANGE", "SUBNET"));
+    ASSERT_EQ(RCL_RET_OK, rcl_env_snapshot_refresh());
     ASSERT_TRUE(rcutils_set_env("ROS_STATIC_PEERS", "192.168.0.1;remote.com"));
+    ASSERT_EQ(RCL_RET_OK, rcl_env_snapshot_refresh());
     check_discovery(RMW_AUTOMATIC_DISCOVERY_RANGE_LOCALHOST, 0);
   }
 
   {
     // ROS_LOCALHOST_ONLY is enabled and prevails over OFF.
     ASSERT_TRUE(rcutils_set_env("ROS_LOCALHOST_ONLY", "1"));
+    ASSERT_EQ(RCL_RET_OK, rcl_env_snapshot_refresh());
     ASSERT_TRUE(rcutils_set_env("ROS_AUTOMATIC_DISCOVERY_RANGE", "OFF"));
+    ASSERT_EQ(RCL_RET_OK, rcl_env_snapshot_refresh());
     check_discovery(RMW_AUTOMATIC_DISCOVERY_RANGE_LOCALHOST, 0);
   }
 
   {
     // ROS_LOCALHOST_ONLY is disabled, falls down to use discovery option.
     ASSERT_TRUE(rcutils_set_env("ROS_LOCALHOST_ONLY", "0"));
+    ASSERT_EQ(RCL_RET_OK, rcl_env_snapshot_refresh());
     ASSERT_TRUE(rcutils_set_env("ROS_AUTOMATIC_DISCOVERY_RANGE", "SUBNET"));
+    ASSERT_EQ(RCL_RET_OK, rcl_env_snapshot_refresh());
     ASSERT_TRUE(rcutils_set_env("ROS_STATIC_PEERS", "192.168.0.1;remote.com"));
+    ASSERT_EQ(RCL_RET_OK, rcl_env_snapshot_refresh());
     check_discovery(RMW_AUTOMATIC_DISCOVERY_RANGE_SUBNET, 2);
   }
 }
+
+// Repeated lookups with an unchanged environment are served from the
+// process-wide parse cache; make sure the clone matches a fresh parse.
+TEST(TestDiscoveryInfo, test_parse_cache_reuse) {
+  rcutils_allocator_t allocator = rcutils_get_default_allocator();
+
+  ASSERT_TRUE(rcutils_set_env("ROS_STATIC_PEERS", "10.2.3.4;cached.example.com"));
+  ASSERT_EQ(RCL_RET_OK, rcl_env_snapshot_refresh());
+  ASSERT_TRUE(rcutils_set_env("ROS_AUTOMATIC_DISCOVERY_RANGE", "SUBNET"));
+  ASSERT_EQ(RCL_RET_OK, rcl_env_snapshot_refresh());
+
+  rmw_discovery_options_t first = rmw_get_zero_initialized_discovery_options();
+  EXPECT_EQ(RCL_RET_OK, rcl_get_automatic_discovery_range(&first));
+  EXPECT_EQ(RCL_RET_OK, rcl_get_discovery_static_peers(&first, &allocator));
+
+  rmw_discovery_options_t second = rmw_get_zero_initialized_discovery_options();
+  EXPECT_EQ(RCL_RET_OK, rcl_get_automatic_discovery_range(&second));
+  EXPECT_EQ(RCL_RET_OK, rcl_get_discovery_static_peers(&second, &allocator));
+
+  EXPECT_EQ(first.automatic_discovery_range, second.automatic_discovery_range);
+  bool equal = false;
+  EXPECT_EQ(RMW_RET_OK, rmw_discovery_options_equal(&first, &second, &equal));
+  EXPECT_TRUE(equal);
+  EXPECT_EQ(RCL_RET_OK, rmw_discovery_options_fini(&first));
+  EXPECT_EQ(RCL_RET_OK, rmw_discovery_options_fini(&second));
+
+  // changing the environment invalidates the cached values
+  ASSERT_TRUE(rcutils_set_env("ROS_STATIC_PEERS", "10.2.3.4"));
+  ASSERT_EQ(RCL_RET_OK, rcl_env_snapshot_refresh());
+  ASSERT_TRUE(rcutils_set_env("ROS_AUTOMATIC_DISCOVERY_RANGE", "LOCALHOST"));
+  ASSERT_EQ(RCL_RET_OK, rcl_env_snapshot_refresh());
+  rmw_discovery_options_t third = rmw_get_zero_initialized_discovery_options();
+  EXPECT_EQ(RCL_RET_OK, rcl_get_automatic_discovery_range(&third));
+  EXPECT_EQ(RCL_RET_OK, rcl_get_discovery_static_peers(&third, &allocator));
+  EXPECT_EQ(RMW_AUTOMATIC_DISCOVERY_RANGE_LOCALHOST, third.automatic_discovery_range);
+  EXPECT_EQ(1u, third.static_peers_count);
+  EXPECT_STREQ("10.2.3.4", third.static_peers[0].peer_address);
+  EXPECT_EQ(RCL_RET_OK, rmw_discovery_options_fini(&third));
+}
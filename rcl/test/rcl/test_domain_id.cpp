@@ -17,6 +17,7 @@
 #include "rcl/rcl.h"
 
 #include "rcl/domain_id.h"
+#include "rcl/env_snapshot.h"
 #include "rcl/error_handling.h"
 #include "rcutils/env.h"
 
@@ -24,27 +25,32 @@
 
 TEST(TestGetDomainId, test_nominal) {
   ASSERT_TRUE(rcutils_set_env("ROS_DOMAIN_ID", "42"));
+  ASSERT_EQ(RCL_RET_OK, rcl_env_snapshot_refresh());
   size_t domain_id = RCL_DEFAULT_DOMAIN_ID;
   EXPECT_EQ(RCL_RET_OK, rcl_get_default_domain_id(&domain_id));
   EXPECT_EQ(42u, domain_id);
 
   ASSERT_TRUE(rcutils_set_env("ROS_DOMAIN_ID", ""));
+  ASSERT_EQ(RCL_RET_OK, rcl_env_snapshot_refresh());
   domain_id = RCL_DEFAULT_DOMAIN_ID;
   EXPECT_EQ(RCL_RET_OK, rcl_get_default_domain_id(&domain_id));
   EXPECT_EQ(RCL_DEFAULT_DOMAIN_ID, domain_id);
 
   ASSERT_TRUE(rcutils_set_env("ROS_DOMAIN_ID", "0000"));
+  ASSERT_EQ(RCL_RET_OK, rcl_env_snapshot_refresh());
   domain_id = RCL_DEFAULT_DOMAIN_ID;
   EXPECT_EQ(RCL_RET_OK, rcl_get_default_domain_id(&domain_id));
   EXPECT_EQ(0u, domain_id);
 
   ASSERT_TRUE(rcutils_set_env("ROS_DOMAIN_ID", "0   not really"));
+  ASSERT_EQ(RCL_RET_OK, rcl_env_snapshot_refresh());
   domain_id = RCL_DEFAULT_DOMAIN_ID;
   EXPECT_EQ(RCL_RET_ERROR, rcl_get_default_domain_id(&domain_id));
   rcl_reset_error();
   EXPECT_EQ(RCL_DEFAULT_DOMAIN_ID, domain_id);
 
   ASSERT_TRUE(rcutils_set_env("ROS_DOMAIN_ID", "998446744073709551615"));
+  ASSERT_EQ(RCL_RET_OK, rcl_env_snapshot_refresh());
   domain_id = RCL_DEFAULT_DOMAIN_ID;
   EXPECT_EQ(RCL_RET_ERROR, rcl_get_default_domain_id(&domain_id));
   rcl_reset_error();
@@ -55,11 +61,10 @@ TEST(TestGetDomainId, test_nominal) {
 }
 
 TEST(TestGetDomainId, test_mock_get_default_domain_id) {
+  // The environment is only read when the snapshot is (re)captured
   auto mock = mocking_utils::patch_and_return(
     "lib:rcl", rcutils_get_env, "argument env_name is null");
-  size_t domain_id = RCL_DEFAULT_DOMAIN_ID;
-  EXPECT_EQ(RCL_RET_ERROR, rcl_get_default_domain_id(&domain_id));
-  EXPECT_EQ(RCL_DEFAULT_DOMAIN_ID, domain_id);
+  EXPECT_EQ(RCL_RET_ERROR, rcl_env_snapshot_refresh());
   EXPECT_TRUE(rcl_error_is_set());
   rcl_reset_error();
 }
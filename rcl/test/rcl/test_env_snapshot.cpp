@@ -0,0 +1,61 @@
+// Copyright 2022 Open Source Robotics Foundation, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <gtest/gtest.h>
+
+#include "rcl/env_snapshot.h"
+#include "rcl/error_handling.h"
+#include "rcutils/env.h"
+
+TEST(TestEnvSnapshot, test_capture_and_refresh) {
+  ASSERT_TRUE(rcutils_set_env("ROS_DOMAIN_ID", "17"));
+  ASSERT_EQ(RCL_RET_OK, rcl_env_snapshot_refresh()) << rcl_get_error_string().str;
+
+  const char * value = nullptr;
+  EXPECT_EQ(RCL_RET_OK, rcl_env_snapshot_get_value("ROS_DOMAIN_ID", &value));
+  EXPECT_STREQ("17", value);
+
+  // Changes to the environment are not observed until an explicit refresh
+  ASSERT_TRUE(rcutils_set_env("ROS_DOMAIN_ID", "23"));
+  value = nullptr;
+  EXPECT_EQ(RCL_RET_OK, rcl_env_snapshot_get_value("ROS_DOMAIN_ID", &value));
+  EXPECT_STREQ("17", value);
+
+  ASSERT_EQ(RCL_RET_OK, rcl_env_snapshot_refresh()) << rcl_get_error_string().str;
+  value = nullptr;
+  EXPECT_EQ(RCL_RET_OK, rcl_env_snapshot_get_value("ROS_DOMAIN_ID", &value));
+  EXPECT_STREQ("23", value);
+}
+
+TEST(TestEnvSnapshot, test_unset_yields_empty_string) {
+  ASSERT_TRUE(rcutils_set_env("ROS_LOCALHOST_ONLY", nullptr));
+  ASSERT_EQ(RCL_RET_OK, rcl_env_snapshot_refresh()) << rcl_get_error_string().str;
+
+  const char * value = nullptr;
+  EXPECT_EQ(RCL_RET_OK, rcl_env_snapshot_get_value("ROS_LOCALHOST_ONLY", &value));
+  ASSERT_NE(nullptr, value);
+  EXPECT_STREQ("", value);
+}
+
+TEST(TestEnvSnapshot, test_bad_arguments) {
+  const char * value = nullptr;
+  EXPECT_EQ(RCL_RET_INVALID_ARGUMENT, rcl_env_snapshot_get_value(nullptr, &value));
+  rcl_reset_error();
+  EXPECT_EQ(RCL_RET_INVALID_ARGUMENT, rcl_env_snapshot_get_value("ROS_DOMAIN_ID", nullptr));
+  rcl_reset_error();
+
+  // Only the context setup variables are snapshotted
+  EXPECT_EQ(RCL_RET_INVALID_ARGUMENT, rcl_env_snapshot_get_value("NOT_A_ROS_VARIABLE", &value));
+  rcl_reset_error();
+}
@@ -793,6 +793,75 @@ TEST_F(TestEventFixture, test_sub_message_lost_event)
   EXPECT_EQ(message_lost_status.total_count_change, 0u);
 }
 
+/*
+ * Test the batched and coalesced event takes
+ */
+TEST_F(TestEventFixture, test_take_events_batched_and_coalesced)
+{
+  setup_publisher_subscriber(default_qos_profile, default_qos_profile);
+  rcl_ret_t ret = rcl_subscription_event_init(
+    &subscription_event, &subscription, RCL_SUBSCRIPTION_LIVELINESS_CHANGED);
+  ASSERT_EQ(ret, RCL_RET_OK) << rcl_get_error_string().str;
+  OSRF_TESTING_TOOLS_CPP_SCOPE_EXIT(
+  {
+    ret = rcl_event_fini(&subscription_event);
+    EXPECT_EQ(ret, RCL_RET_OK) << rcl_get_error_string().str;
+    tear_down_publisher_subscriber();
+  });
+
+  rmw_liveliness_changed_status_t statuses[2];
+  void * status_buffer[2] = {&statuses[0], &statuses[1]};
+  size_t taken = 0u;
+
+  // Bad arguments.
+  EXPECT_EQ(RCL_RET_EVENT_INVALID, rcl_take_events(nullptr, status_buffer, 2, &taken));
+  rcl_reset_error();
+  EXPECT_EQ(
+    RCL_RET_INVALID_ARGUMENT, rcl_take_events(&subscription_event, nullptr, 2, &taken));
+  rcl_reset_error();
+  EXPECT_EQ(
+    RCL_RET_INVALID_ARGUMENT, rcl_take_events(&subscription_event, status_buffer, 0, &taken));
+  rcl_reset_error();
+  EXPECT_EQ(
+    RCL_RET_INVALID_ARGUMENT, rcl_take_events(&subscription_event, status_buffer, 2, nullptr));
+  rcl_reset_error();
+
+  size_t coalesced_count = 0u;
+  EXPECT_EQ(
+    RCL_RET_EVENT_INVALID, rcl_take_event_coalesced(nullptr, &statuses[0], &coalesced_count));
+  rcl_reset_error();
+  EXPECT_EQ(
+    RCL_RET_INVALID_ARGUMENT,
+    rcl_take_event_coalesced(&subscription_event, nullptr, &coalesced_count));
+  rcl_reset_error();
+  EXPECT_EQ(
+    RCL_RET_INVALID_ARGUMENT,
+    rcl_take_event_coalesced(&subscription_event, &statuses[0], nullptr));
+  rcl_reset_error();
+
+  // The publisher is alive, so a liveliness change should be observable; the
+  // batched take stops as soon as nothing further is pending.
+  ret = rcl_take_events(&subscription_event, status_buffer, 2, &taken);
+  if (RCL_RET_OK == ret) {
+    EXPECT_GE(taken, 1u);
+    EXPECT_LE(taken, 2u);
+  } else {
+    EXPECT_EQ(RCL_RET_EVENT_TAKE_FAILED, ret);
+    EXPECT_EQ(0u, taken);
+    rcl_reset_error();
+  }
+
+  // The coalesced take collapses whatever is still queued into one record.
+  ret = rcl_take_event_coalesced(&subscription_event, &statuses[0], &coalesced_count);
+  if (RCL_RET_OK == ret) {
+    EXPECT_GE(coalesced_count, 1u);
+  } else {
+    EXPECT_EQ(RCL_RET_EVENT_TAKE_FAILED, ret);
+    EXPECT_EQ(0u, coalesced_count);
+    rcl_reset_error();
+  }
+}
+
 static
 std::array<TestIncompatibleQosEventParams, 5>
 get_test_pubsub_incompatible_qos_inputs()
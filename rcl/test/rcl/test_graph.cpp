@@ -32,7 +32,9 @@
 #include "rcl/graph.h"
 #include "rcl/logging.h"
 #include "rcl/rcl.h"
+#include "rcl/time.h"
 
+#include "rcutils/strdup.h"
 #include "rcutils/logging_macros.h"
 #include "rcutils/logging.h"
 
@@ -1703,3 +1705,750 @@ TEST_F(CLASSNAME(TestGraphFixture, RMW_IMPLEMENTATION), test_bad_get_node_names)
     this->node_ptr, allocator, &node_names_2, &node_namespaces_2, &node_enclaves);
   EXPECT_EQ(RCL_RET_OK, ret);
 }
+
+/* Test the graph cache: repeated queries on a quiescent graph serve the same
+ * snapshot, and a graph change is eventually reflected with a new version.
+ */
+TEST_F(
+  CLASSNAME(TestGraphFixture, RMW_IMPLEMENTATION),
+  test_rcl_graph_cache
+) {
+  rcl_ret_t ret;
+  rcl_allocator_t allocator = rcl_get_default_allocator();
+  rcl_graph_cache_t cache = rcl_get_zero_initialized_graph_cache();
+
+  EXPECT_EQ(RCL_RET_INVALID_ARGUMENT, rcl_graph_cache_init(nullptr, this->node_ptr, false,
+    &allocator));
+  rcl_reset_error();
+  EXPECT_EQ(RCL_RET_NODE_INVALID, rcl_graph_cache_init(&cache, nullptr, false, &allocator));
+  rcl_reset_error();
+
+  ret = rcl_graph_cache_init(&cache, this->node_ptr, false, &allocator);
+  ASSERT_EQ(RCL_RET_OK, ret) << rcl_get_error_string().str;
+  EXPECT_EQ(RCL_RET_ALREADY_INIT, rcl_graph_cache_init(&cache, this->node_ptr, false, &allocator));
+  rcl_reset_error();
+
+  const rcl_names_and_types_t * first_view = nullptr;
+  uint64_t first_version = 0;
+  ret = rcl_graph_cache_get_topic_names_and_types(&cache, &first_view, &first_version);
+  ASSERT_EQ(RCL_RET_OK, ret) << rcl_get_error_string().str;
+  ASSERT_NE(nullptr, first_view);
+  EXPECT_EQ(1u, first_version);
+
+  // A second query on a quiescent graph serves the same snapshot.
+  const rcl_names_and_types_t * second_view = nullptr;
+  uint64_t second_version = 0;
+  ret = rcl_graph_cache_get_topic_names_and_types(&cache, &second_view, &second_version);
+  ASSERT_EQ(RCL_RET_OK, ret) << rcl_get_error_string().str;
+  EXPECT_EQ(first_view, second_view);
+  EXPECT_EQ(first_version, second_version);
+  EXPECT_EQ(RCL_RET_OK, rcl_graph_cache_release(&second_view));
+  EXPECT_EQ(nullptr, second_view);
+
+  // Change the graph; the cache must eventually serve the new topic.
+  const rosidl_message_type_support_t * ts =
+    ROSIDL_GET_MSG_TYPE_SUPPORT(test_msgs, msg, BasicTypes);
+  rcl_publisher_t publisher = rcl_get_zero_initialized_publisher();
+  rcl_publisher_options_t publisher_options = rcl_publisher_get_default_options();
+  ret = rcl_publisher_init(
+    &publisher, this->node_ptr, ts, "/graph_cache_test_topic", &publisher_options);
+  ASSERT_EQ(RCL_RET_OK, ret) << rcl_get_error_string().str;
+  OSRF_TESTING_TOOLS_CPP_SCOPE_EXIT(
+  {
+    EXPECT_EQ(RCL_RET_OK, rcl_publisher_fini(&publisher, this->node_ptr)) <<
+      rcl_get_error_string().str;
+  });
+
+  bool found_topic = false;
+  uint64_t refreshed_version = 0;
+  for (size_t attempt = 0; attempt < 500 && !found_topic; ++attempt) {
+    const rcl_names_and_types_t * view = nullptr;
+    ret = rcl_graph_cache_get_topic_names_and_types(&cache, &view, &refreshed_version);
+    ASSERT_EQ(RCL_RET_OK, ret) << rcl_get_error_string().str;
+    for (size_t i = 0; i < view->names.size; ++i) {
+      if (0 == strcmp(view->names.data[i], "/graph_cache_test_topic")) {
+        found_topic = true;
+        break;
+      }
+    }
+    EXPECT_EQ(RCL_RET_OK, rcl_graph_cache_release(&view));
+    if (!found_topic) {
+      std::this_thread::sleep_for(std::chrono::milliseconds(10));
+    }
+  }
+  EXPECT_TRUE(found_topic);
+  EXPECT_GT(refreshed_version, first_version);
+
+  // A view held across refreshes and fini stays valid until released.
+  ret = rcl_graph_cache_fini(&cache);
+  EXPECT_EQ(RCL_RET_OK, ret) << rcl_get_error_string().str;
+  EXPECT_EQ(nullptr, cache.impl);
+  EXPECT_LT(first_view->names.size, SIZE_MAX);
+  EXPECT_EQ(RCL_RET_OK, rcl_graph_cache_release(&first_view));
+  EXPECT_EQ(nullptr, first_view);
+}
+
+/* Test the string-interned variant of the topic graph query.
+ */
+TEST_F(
+  CLASSNAME(TestGraphFixture, RMW_IMPLEMENTATION),
+  test_rcl_get_topic_names_and_types_interned
+) {
+  rcl_ret_t ret;
+  rcl_allocator_t allocator = rcl_get_default_allocator();
+
+  rcl_intern_pool_t * pool = rcl_context_get_intern_pool(this->context_ptr);
+  ASSERT_NE(nullptr, pool);
+  // The accessor hands back the same lazily initialized pool every time.
+  EXPECT_EQ(pool, rcl_context_get_intern_pool(this->context_ptr));
+
+  // Create a publisher so at least one topic with a type is in the graph.
+  const rosidl_message_type_support_t * ts =
+    ROSIDL_GET_MSG_TYPE_SUPPORT(test_msgs, msg, BasicTypes);
+  rcl_publisher_t publisher = rcl_get_zero_initialized_publisher();
+  rcl_publisher_options_t publisher_options = rcl_publisher_get_default_options();
+  ret = rcl_publisher_init(
+    &publisher, this->node_ptr, ts, "/interned_query_test_topic", &publisher_options);
+  ASSERT_EQ(RCL_RET_OK, ret) << rcl_get_error_string().str;
+  OSRF_TESTING_TOOLS_CPP_SCOPE_EXIT(
+  {
+    EXPECT_EQ(RCL_RET_OK, rcl_publisher_fini(&publisher, this->node_ptr)) <<
+      rcl_get_error_string().str;
+  });
+
+  // Poll until the publisher's topic shows up in the interned view.
+  bool found_topic = false;
+  const char * interned_name = nullptr;
+  for (size_t attempt = 0; attempt < 500 && !found_topic; ++attempt) {
+    rcl_interned_names_and_types_t tnat = rcl_get_zero_initialized_interned_names_and_types();
+    ret = rcl_get_topic_names_and_types_interned(
+      this->node_ptr, pool, &allocator, false, &tnat);
+    ASSERT_EQ(RCL_RET_OK, ret) << rcl_get_error_string().str;
+    for (size_t i = 0; i < tnat.size; ++i) {
+      if (0 == strcmp(tnat.names[i], "/interned_query_test_topic")) {
+        found_topic = true;
+        interned_name = tnat.names[i];
+        EXPECT_GT(tnat.types_sizes[i], 0u);
+        break;
+      }
+    }
+    EXPECT_EQ(RCL_RET_OK, rcl_interned_names_and_types_fini(&tnat));
+    if (!found_topic) {
+      std::this_thread::sleep_for(std::chrono::milliseconds(10));
+    }
+  }
+  ASSERT_TRUE(found_topic);
+  // The canonical pointer outlives the finalized view, so a repeated query
+  // must return a pointer-equal name, not just an equal string.
+  rcl_interned_names_and_types_t tnat = rcl_get_zero_initialized_interned_names_and_types();
+  ret = rcl_get_topic_names_and_types_interned(
+    this->node_ptr, pool, &allocator, false, &tnat);
+  ASSERT_EQ(RCL_RET_OK, ret) << rcl_get_error_string().str;
+  bool found_same_pointer = false;
+  for (size_t i = 0; i < tnat.size; ++i) {
+    if (tnat.names[i] == interned_name) {
+      found_same_pointer = true;
+      break;
+    }
+  }
+  EXPECT_TRUE(found_same_pointer);
+  EXPECT_EQ(RCL_RET_OK, rcl_interned_names_and_types_fini(&tnat));
+
+  // A non zero initialized output struct is rejected.
+  rcl_interned_names_and_types_t dirty = rcl_get_zero_initialized_interned_names_and_types();
+  dirty.size = 1;
+  dirty.names = &interned_name;
+  ret = rcl_get_topic_names_and_types_interned(this->node_ptr, pool, &allocator, false, &dirty);
+  EXPECT_EQ(RCL_RET_INVALID_ARGUMENT, ret);
+  rcl_reset_error();
+}
+
+/* Test the incremental graph delta API built on the graph cache.
+ */
+TEST_F(
+  CLASSNAME(TestGraphFixture, RMW_IMPLEMENTATION),
+  test_rcl_graph_cache_get_changes
+) {
+  rcl_ret_t ret;
+  rcl_allocator_t allocator = rcl_get_default_allocator();
+
+  rcl_graph_cache_t cache = rcl_get_zero_initialized_graph_cache();
+  ret = rcl_graph_cache_init(&cache, this->node_ptr, false, &allocator);
+  ASSERT_EQ(RCL_RET_OK, ret) << rcl_get_error_string().str;
+
+  // since_version 0 resynchronizes: everything currently in the graph
+  // appears, nothing disappears.
+  rcl_graph_changes_t changes = rcl_get_zero_initialized_graph_changes();
+  ret = rcl_graph_cache_get_changes(&cache, 0, &changes);
+  ASSERT_EQ(RCL_RET_OK, ret) << rcl_get_error_string().str;
+  uint64_t version = changes.version;
+  EXPECT_GT(version, 0u);
+  EXPECT_EQ(0u, changes.disappeared.names.size);
+  EXPECT_EQ(RCL_RET_OK, rcl_graph_changes_fini(&changes));
+
+  // A non zero initialized output struct is rejected.
+  ret = rcl_graph_cache_get_changes(&cache, version, &changes);
+  ASSERT_EQ(RCL_RET_OK, ret) << rcl_get_error_string().str;
+  rcl_graph_changes_t dirty = changes;
+  if (0 == dirty.appeared.names.size && 0 == dirty.disappeared.names.size) {
+    EXPECT_EQ(RCL_RET_OK, rcl_graph_changes_fini(&changes));
+  } else {
+    dirty = rcl_get_zero_initialized_graph_changes();
+    dirty.appeared.names.size = 1;
+    EXPECT_EQ(RCL_RET_OK, rcl_graph_changes_fini(&changes));
+    ret = rcl_graph_cache_get_changes(&cache, version, &dirty);
+    EXPECT_NE(RCL_RET_OK, ret);
+    rcl_reset_error();
+  }
+
+  // A version token the cache never produced is rejected.
+  changes = rcl_get_zero_initialized_graph_changes();
+  ret = rcl_graph_cache_get_changes(&cache, version + 1000, &changes);
+  EXPECT_EQ(RCL_RET_INVALID_ARGUMENT, ret);
+  rcl_reset_error();
+
+  // Creating a publisher must eventually surface as an appeared topic.
+  const rosidl_message_type_support_t * ts =
+    ROSIDL_GET_MSG_TYPE_SUPPORT(test_msgs, msg, BasicTypes);
+  rcl_publisher_t publisher = rcl_get_zero_initialized_publisher();
+  rcl_publisher_options_t publisher_options = rcl_publisher_get_default_options();
+  ret = rcl_publisher_init(
+    &publisher, this->node_ptr, ts, "/graph_delta_test_topic", &publisher_options);
+  ASSERT_EQ(RCL_RET_OK, ret) << rcl_get_error_string().str;
+
+  bool found_appeared = false;
+  for (size_t attempt = 0; attempt < 500 && !found_appeared; ++attempt) {
+    changes = rcl_get_zero_initialized_graph_changes();
+    ret = rcl_graph_cache_get_changes(&cache, version, &changes);
+    ASSERT_EQ(RCL_RET_OK, ret) << rcl_get_error_string().str;
+    version = changes.version;
+    for (size_t i = 0; i < changes.appeared.names.size; ++i) {
+      if (0 == strcmp(changes.appeared.names.data[i], "/graph_delta_test_topic")) {
+        found_appeared = true;
+        EXPECT_GT(changes.appeared.types[i].size, 0u);
+        break;
+      }
+    }
+    EXPECT_EQ(RCL_RET_OK, rcl_graph_changes_fini(&changes));
+    if (!found_appeared) {
+      std::this_thread::sleep_for(std::chrono::milliseconds(10));
+    }
+  }
+  EXPECT_TRUE(found_appeared);
+
+  // Destroying the publisher must eventually surface as a disappearance.
+  EXPECT_EQ(RCL_RET_OK, rcl_publisher_fini(&publisher, this->node_ptr)) <<
+    rcl_get_error_string().str;
+  bool found_disappeared = false;
+  for (size_t attempt = 0; attempt < 500 && !found_disappeared; ++attempt) {
+    changes = rcl_get_zero_initialized_graph_changes();
+    ret = rcl_graph_cache_get_changes(&cache, version, &changes);
+    ASSERT_EQ(RCL_RET_OK, ret) << rcl_get_error_string().str;
+    version = changes.version;
+    for (size_t i = 0; i < changes.disappeared.names.size; ++i) {
+      if (0 == strcmp(changes.disappeared.names.data[i], "/graph_delta_test_topic")) {
+        found_disappeared = true;
+        break;
+      }
+    }
+    EXPECT_EQ(RCL_RET_OK, rcl_graph_changes_fini(&changes));
+    if (!found_disappeared) {
+      std::this_thread::sleep_for(std::chrono::milliseconds(10));
+    }
+  }
+  EXPECT_TRUE(found_disappeared);
+
+  ret = rcl_graph_cache_fini(&cache);
+  EXPECT_EQ(RCL_RET_OK, ret) << rcl_get_error_string().str;
+}
+
+/* Test the debounced, batched graph-change notifications.
+ */
+TEST_F(
+  CLASSNAME(TestGraphFixture, RMW_IMPLEMENTATION),
+  test_rcl_graph_debounce
+) {
+  rcl_ret_t ret;
+  rcl_allocator_t allocator = rcl_get_default_allocator();
+  const uint64_t window_ns = RCL_MS_TO_NS(50);
+
+  rcl_graph_cache_t cache = rcl_get_zero_initialized_graph_cache();
+  ret = rcl_graph_cache_init(&cache, this->node_ptr, false, &allocator);
+  ASSERT_EQ(RCL_RET_OK, ret) << rcl_get_error_string().str;
+
+  rcl_graph_debounce_t debounce = rcl_get_zero_initialized_graph_debounce();
+  EXPECT_EQ(
+    RCL_RET_INVALID_ARGUMENT,
+    rcl_graph_debounce_init(nullptr, this->node_ptr, &cache, window_ns, &allocator));
+  rcl_reset_error();
+  EXPECT_EQ(
+    RCL_RET_NODE_INVALID,
+    rcl_graph_debounce_init(&debounce, nullptr, &cache, window_ns, &allocator));
+  rcl_reset_error();
+  rcl_graph_cache_t invalid_cache = rcl_get_zero_initialized_graph_cache();
+  EXPECT_EQ(
+    RCL_RET_INVALID_ARGUMENT,
+    rcl_graph_debounce_init(&debounce, this->node_ptr, &invalid_cache, window_ns, &allocator));
+  rcl_reset_error();
+  EXPECT_EQ(nullptr, rcl_graph_debounce_get_guard_condition(&debounce));
+
+  ret = rcl_graph_debounce_init(&debounce, this->node_ptr, &cache, window_ns, &allocator);
+  ASSERT_EQ(RCL_RET_OK, ret) << rcl_get_error_string().str;
+  EXPECT_EQ(
+    RCL_RET_ALREADY_INIT,
+    rcl_graph_debounce_init(&debounce, this->node_ptr, &cache, window_ns, &allocator));
+  rcl_reset_error();
+  EXPECT_NE(nullptr, rcl_graph_debounce_get_guard_condition(&debounce));
+
+  // Drain whatever discovery activity is still settling from fixture setup,
+  // then a quiescent graph must not deliver.
+  rcl_graph_changes_t changes = rcl_get_zero_initialized_graph_changes();
+  bool delivered = false;
+  for (size_t attempt = 0; attempt < 500; ++attempt) {
+    ret = rcl_graph_debounce_poll(&debounce, &changes, &delivered);
+    ASSERT_EQ(RCL_RET_OK, ret) << rcl_get_error_string().str;
+    if (delivered) {
+      EXPECT_EQ(RCL_RET_OK, rcl_graph_changes_fini(&changes));
+      attempt = 0;
+    }
+    std::this_thread::sleep_for(std::chrono::milliseconds(1));
+  }
+  EXPECT_FALSE(delivered);
+
+  // A discovery event must produce exactly one batched delivery containing
+  // the new topic, however many raw firings the window absorbed.
+  const rosidl_message_type_support_t * ts =
+    ROSIDL_GET_MSG_TYPE_SUPPORT(test_msgs, msg, BasicTypes);
+  rcl_publisher_t publisher = rcl_get_zero_initialized_publisher();
+  rcl_publisher_options_t publisher_options = rcl_publisher_get_default_options();
+  ret = rcl_publisher_init(
+    &publisher, this->node_ptr, ts, "/graph_debounce_test_topic", &publisher_options);
+  ASSERT_EQ(RCL_RET_OK, ret) << rcl_get_error_string().str;
+  OSRF_TESTING_TOOLS_CPP_SCOPE_EXIT(
+  {
+    EXPECT_EQ(RCL_RET_OK, rcl_publisher_fini(&publisher, this->node_ptr)) <<
+      rcl_get_error_string().str;
+  });
+
+  bool found_appeared = false;
+  for (size_t attempt = 0; attempt < 500 && !found_appeared; ++attempt) {
+    ret = rcl_graph_debounce_poll(&debounce, &changes, &delivered);
+    ASSERT_EQ(RCL_RET_OK, ret) << rcl_get_error_string().str;
+    if (delivered) {
+      for (size_t i = 0; i < changes.appeared.names.size; ++i) {
+        if (0 == strcmp(changes.appeared.names.data[i], "/graph_debounce_test_topic")) {
+          found_appeared = true;
+          break;
+        }
+      }
+      EXPECT_EQ(RCL_RET_OK, rcl_graph_changes_fini(&changes));
+    }
+    if (!found_appeared) {
+      std::this_thread::sleep_for(std::chrono::milliseconds(10));
+    }
+  }
+  EXPECT_TRUE(found_appeared);
+
+  ret = rcl_graph_debounce_fini(&debounce);
+  EXPECT_EQ(RCL_RET_OK, ret) << rcl_get_error_string().str;
+  EXPECT_EQ(RCL_RET_INVALID_ARGUMENT, rcl_graph_debounce_fini(&debounce));
+  rcl_reset_error();
+
+  ret = rcl_graph_cache_fini(&cache);
+  EXPECT_EQ(RCL_RET_OK, ret) << rcl_get_error_string().str;
+}
+
+/* Test the batched multi-node topic queries.
+ */
+TEST_F(
+  CLASSNAME(TestGraphFixture, RMW_IMPLEMENTATION),
+  test_rcl_get_names_and_types_for_nodes
+) {
+  rcl_ret_t ret;
+  rcl_allocator_t allocator = rcl_get_default_allocator();
+
+  const rosidl_message_type_support_t * ts =
+    ROSIDL_GET_MSG_TYPE_SUPPORT(test_msgs, msg, BasicTypes);
+  rcl_publisher_t publisher = rcl_get_zero_initialized_publisher();
+  rcl_publisher_options_t publisher_options = rcl_publisher_get_default_options();
+  ret = rcl_publisher_init(
+    &publisher, this->node_ptr, ts, "/multi_node_query_test_topic", &publisher_options);
+  ASSERT_EQ(RCL_RET_OK, ret) << rcl_get_error_string().str;
+  OSRF_TESTING_TOOLS_CPP_SCOPE_EXIT(
+  {
+    EXPECT_EQ(RCL_RET_OK, rcl_publisher_fini(&publisher, this->node_ptr)) <<
+      rcl_get_error_string().str;
+  });
+
+  // The same node listed twice must not yield duplicate entries.
+  const char * node_names[] = {this->test_graph_node_name, this->test_graph_node_name};
+  const char * node_namespaces[] = {"", ""};
+  bool found_topic = false;
+  for (size_t attempt = 0; attempt < 500 && !found_topic; ++attempt) {
+    rcl_names_and_types_t tnat = rcl_get_zero_initialized_names_and_types();
+    ret = rcl_get_publisher_names_and_types_for_nodes(
+      this->node_ptr, &allocator, false, node_names, node_namespaces, 2, &tnat);
+    ASSERT_EQ(RCL_RET_OK, ret) << rcl_get_error_string().str;
+    size_t occurrences = 0;
+    for (size_t i = 0; i < tnat.names.size; ++i) {
+      if (0 == strcmp(tnat.names.data[i], "/multi_node_query_test_topic")) {
+        ++occurrences;
+        EXPECT_GT(tnat.types[i].size, 0u);
+      }
+    }
+    EXPECT_LE(occurrences, 1u);
+    found_topic = occurrences > 0;
+    EXPECT_EQ(RCL_RET_OK, rcl_names_and_types_fini(&tnat));
+    if (!found_topic) {
+      std::this_thread::sleep_for(std::chrono::milliseconds(10));
+    }
+  }
+  EXPECT_TRUE(found_topic);
+
+  // An empty node list yields an empty, fini-able result.
+  rcl_names_and_types_t empty = rcl_get_zero_initialized_names_and_types();
+  ret = rcl_get_subscriber_names_and_types_for_nodes(
+    this->node_ptr, &allocator, false, nullptr, nullptr, 0, &empty);
+  EXPECT_EQ(RCL_RET_OK, ret) << rcl_get_error_string().str;
+  EXPECT_EQ(0u, empty.names.size);
+  EXPECT_EQ(RCL_RET_OK, rcl_names_and_types_fini(&empty));
+
+  // A nonexistent node fails the whole batch.
+  rcl_names_and_types_t tnat = rcl_get_zero_initialized_names_and_types();
+  const char * bad_names[] = {this->test_graph_node_name, "this_node_does_not_exist"};
+  ret = rcl_get_publisher_names_and_types_for_nodes(
+    this->node_ptr, &allocator, false, bad_names, node_namespaces, 2, &tnat);
+  EXPECT_NE(RCL_RET_OK, ret);
+  rcl_reset_error();
+
+  // Null arrays with a nonzero count are rejected.
+  ret = rcl_get_publisher_names_and_types_for_nodes(
+    this->node_ptr, &allocator, false, nullptr, node_namespaces, 2, &tnat);
+  EXPECT_EQ(RCL_RET_INVALID_ARGUMENT, ret);
+  rcl_reset_error();
+  ret = rcl_get_publisher_names_and_types_for_nodes(
+    this->node_ptr, &allocator, false, node_names, nullptr, 2, &tnat);
+  EXPECT_EQ(RCL_RET_INVALID_ARGUMENT, ret);
+  rcl_reset_error();
+}
+
+/* Test the packed (single-buffer) names and types representation.
+ */
+TEST_F(
+  CLASSNAME(TestGraphFixture, RMW_IMPLEMENTATION),
+  test_rcl_packed_names_and_types
+) {
+  rcl_ret_t ret;
+  rcl_allocator_t allocator = rcl_get_default_allocator();
+
+  // Pack a handcrafted set and verify the accessors reproduce it.
+  rcl_names_and_types_t source = rcl_get_zero_initialized_names_and_types();
+  ret = rcl_names_and_types_init(&source, 2, &allocator);
+  ASSERT_EQ(RCL_RET_OK, ret) << rcl_get_error_string().str;
+  source.names.data[0] = rcutils_strdup("/topic_a", allocator);
+  source.names.data[1] = rcutils_strdup("/topic_b", allocator);
+  ASSERT_EQ(RCUTILS_RET_OK, rcutils_string_array_init(&source.types[0], 2, &allocator));
+  source.types[0].data[0] = rcutils_strdup("pkg/msg/TypeOne", allocator);
+  source.types[0].data[1] = rcutils_strdup("pkg/msg/TypeTwo", allocator);
+  ASSERT_EQ(RCUTILS_RET_OK, rcutils_string_array_init(&source.types[1], 1, &allocator));
+  source.types[1].data[0] = rcutils_strdup("pkg/msg/TypeOne", allocator);
+
+  rcl_packed_names_and_types_t packed = rcl_get_zero_initialized_packed_names_and_types();
+  ret = rcl_pack_names_and_types(&source, &allocator, &packed);
+  ASSERT_EQ(RCL_RET_OK, ret) << rcl_get_error_string().str;
+  // The source is independent of the packed copy and can go away first.
+  EXPECT_EQ(RCL_RET_OK, rcl_names_and_types_fini(&source));
+
+  EXPECT_EQ(2u, packed.size);
+  EXPECT_STREQ("/topic_a", rcl_packed_names_and_types_get_name(&packed, 0));
+  EXPECT_STREQ("/topic_b", rcl_packed_names_and_types_get_name(&packed, 1));
+  EXPECT_EQ(2u, rcl_packed_names_and_types_get_type_count(&packed, 0));
+  EXPECT_EQ(1u, rcl_packed_names_and_types_get_type_count(&packed, 1));
+  EXPECT_STREQ("pkg/msg/TypeOne", rcl_packed_names_and_types_get_type(&packed, 0, 0));
+  EXPECT_STREQ("pkg/msg/TypeTwo", rcl_packed_names_and_types_get_type(&packed, 0, 1));
+  EXPECT_STREQ("pkg/msg/TypeOne", rcl_packed_names_and_types_get_type(&packed, 1, 0));
+  // Out of range accesses return NULL or 0 instead of reading past the end.
+  EXPECT_EQ(nullptr, rcl_packed_names_and_types_get_name(&packed, 2));
+  EXPECT_EQ(nullptr, rcl_packed_names_and_types_get_type(&packed, 0, 2));
+  EXPECT_EQ(0u, rcl_packed_names_and_types_get_type_count(&packed, 2));
+  EXPECT_EQ(nullptr, rcl_packed_names_and_types_get_name(nullptr, 0));
+  // Every string must live inside the single buffer.
+  const char * name = rcl_packed_names_and_types_get_name(&packed, 0);
+  EXPECT_GE(name, packed.buffer);
+  EXPECT_LT(name, packed.buffer + packed.buffer_length);
+
+  // A second pack into the same struct is rejected until it is finalized.
+  ret = rcl_pack_names_and_types(&source, &allocator, &packed);
+  EXPECT_EQ(RCL_RET_INVALID_ARGUMENT, ret);
+  rcl_reset_error();
+  EXPECT_EQ(RCL_RET_OK, rcl_packed_names_and_types_fini(&packed));
+  EXPECT_EQ(nullptr, packed.buffer);
+
+  // The packed query path returns the graph through the same representation.
+  const rosidl_message_type_support_t * ts =
+    ROSIDL_GET_MSG_TYPE_SUPPORT(test_msgs, msg, BasicTypes);
+  rcl_publisher_t publisher = rcl_get_zero_initialized_publisher();
+  rcl_publisher_options_t publisher_options = rcl_publisher_get_default_options();
+  ret = rcl_publisher_init(
+    &publisher, this->node_ptr, ts, "/packed_query_test_topic", &publisher_options);
+  ASSERT_EQ(RCL_RET_OK, ret) << rcl_get_error_string().str;
+  OSRF_TESTING_TOOLS_CPP_SCOPE_EXIT(
+  {
+    EXPECT_EQ(RCL_RET_OK, rcl_publisher_fini(&publisher, this->node_ptr)) <<
+      rcl_get_error_string().str;
+  });
+  bool found_topic = false;
+  for (size_t attempt = 0; attempt < 500 && !found_topic; ++attempt) {
+    rcl_packed_names_and_types_t tnat = rcl_get_zero_initialized_packed_names_and_types();
+    ret = rcl_get_topic_names_and_types_packed(this->node_ptr, &allocator, false, &tnat);
+    ASSERT_EQ(RCL_RET_OK, ret) << rcl_get_error_string().str;
+    for (size_t i = 0; i < tnat.size; ++i) {
+      if (0 == strcmp(rcl_packed_names_and_types_get_name(&tnat, i), "/packed_query_test_topic")) {
+        found_topic = true;
+        EXPECT_GT(rcl_packed_names_and_types_get_type_count(&tnat, i), 0u);
+        break;
+      }
+    }
+    EXPECT_EQ(RCL_RET_OK, rcl_packed_names_and_types_fini(&tnat));
+    if (!found_topic) {
+      std::this_thread::sleep_for(std::chrono::milliseconds(10));
+    }
+  }
+  EXPECT_TRUE(found_topic);
+}
+
+/* Test the generation tagged count cache.
+ */
+TEST_F(
+  CLASSNAME(TestGraphFixture, RMW_IMPLEMENTATION),
+  test_rcl_count_cache
+) {
+  rcl_ret_t ret;
+  rcl_allocator_t allocator = rcl_get_default_allocator();
+
+  rcl_count_cache_t cache = rcl_get_zero_initialized_count_cache();
+  ret = rcl_count_cache_init(nullptr, this->node_ptr, &allocator);
+  EXPECT_EQ(RCL_RET_INVALID_ARGUMENT, ret);
+  rcl_reset_error();
+  ret = rcl_count_cache_init(&cache, nullptr, &allocator);
+  EXPECT_EQ(RCL_RET_NODE_INVALID, ret);
+  rcl_reset_error();
+  ret = rcl_count_cache_init(&cache, this->node_ptr, &allocator);
+  ASSERT_EQ(RCL_RET_OK, ret) << rcl_get_error_string().str;
+  ret = rcl_count_cache_init(&cache, this->node_ptr, &allocator);
+  EXPECT_EQ(RCL_RET_ALREADY_INIT, ret);
+  rcl_reset_error();
+
+  const char * topic_name = "/count_cache_test_topic";
+  size_t count = 77;
+  ret = rcl_count_cache_count_publishers(&cache, topic_name, &count);
+  ASSERT_EQ(RCL_RET_OK, ret) << rcl_get_error_string().str;
+  EXPECT_EQ(0u, count);
+  ret = rcl_count_cache_count_subscribers(&cache, topic_name, &count);
+  ASSERT_EQ(RCL_RET_OK, ret) << rcl_get_error_string().str;
+  EXPECT_EQ(0u, count);
+
+  // Creating a publisher fires the graph guard condition, which must
+  // invalidate the cached zero.
+  const rosidl_message_type_support_t * ts =
+    ROSIDL_GET_MSG_TYPE_SUPPORT(test_msgs, msg, BasicTypes);
+  rcl_publisher_t publisher = rcl_get_zero_initialized_publisher();
+  rcl_publisher_options_t publisher_options = rcl_publisher_get_default_options();
+  ret = rcl_publisher_init(&publisher, this->node_ptr, ts, topic_name, &publisher_options);
+  ASSERT_EQ(RCL_RET_OK, ret) << rcl_get_error_string().str;
+  count = 0;
+  for (size_t attempt = 0; attempt < 500 && 0 == count; ++attempt) {
+    ret = rcl_count_cache_count_publishers(&cache, topic_name, &count);
+    ASSERT_EQ(RCL_RET_OK, ret) << rcl_get_error_string().str;
+    if (0 == count) {
+      std::this_thread::sleep_for(std::chrono::milliseconds(10));
+    }
+  }
+  EXPECT_EQ(1u, count);
+  // Repeated counts in a quiescent graph are served from the cache and must
+  // agree with each other.
+  for (size_t i = 0; i < 10; ++i) {
+    size_t repeat_count = 0;
+    ret = rcl_count_cache_count_publishers(&cache, topic_name, &repeat_count);
+    ASSERT_EQ(RCL_RET_OK, ret) << rcl_get_error_string().str;
+    EXPECT_EQ(count, repeat_count);
+  }
+
+  // Tearing the publisher down must be observed too.
+  EXPECT_EQ(RCL_RET_OK, rcl_publisher_fini(&publisher, this->node_ptr)) <<
+    rcl_get_error_string().str;
+  count = 1;
+  for (size_t attempt = 0; attempt < 500 && 0 != count; ++attempt) {
+    ret = rcl_count_cache_count_publishers(&cache, topic_name, &count);
+    ASSERT_EQ(RCL_RET_OK, ret) << rcl_get_error_string().str;
+    if (0 != count) {
+      std::this_thread::sleep_for(std::chrono::milliseconds(10));
+    }
+  }
+  EXPECT_EQ(0u, count);
+
+  ret = rcl_count_cache_count_publishers(&cache, nullptr, &count);
+  EXPECT_EQ(RCL_RET_INVALID_ARGUMENT, ret);
+  rcl_reset_error();
+  ret = rcl_count_cache_count_subscribers(&cache, topic_name, nullptr);
+  EXPECT_EQ(RCL_RET_INVALID_ARGUMENT, ret);
+  rcl_reset_error();
+
+  ret = rcl_count_cache_fini(&cache);
+  EXPECT_EQ(RCL_RET_OK, ret) << rcl_get_error_string().str;
+  EXPECT_EQ(nullptr, cache.impl);
+  ret = rcl_count_cache_fini(&cache);
+  EXPECT_EQ(RCL_RET_INVALID_ARGUMENT, ret);
+  rcl_reset_error();
+}
+
+/* Test the reusable node names query result.
+ */
+TEST_F(
+  CLASSNAME(TestGraphFixture, RMW_IMPLEMENTATION),
+  test_rcl_get_node_names_reuse
+) {
+  rcl_ret_t ret;
+  rcl_allocator_t allocator = rcl_get_default_allocator();
+  rcl_intern_pool_t * pool = rcl_context_get_intern_pool(this->context_ptr);
+  ASSERT_NE(nullptr, pool);
+
+  rcl_node_names_result_t result = rcl_get_zero_initialized_node_names_result();
+  ret = rcl_get_node_names_reuse(this->node_ptr, pool, &allocator, &result);
+  ASSERT_EQ(RCL_RET_OK, ret) << rcl_get_error_string().str;
+  ASSERT_GE(result.size, 1u);
+  EXPECT_GE(result.capacity, result.size);
+  const char * own_name = nullptr;
+  for (size_t i = 0; i < result.size; ++i) {
+    if (0 == strcmp(result.names[i], this->test_graph_node_name)) {
+      own_name = result.names[i];
+      EXPECT_STREQ("/", result.namespaces[i]);
+    }
+  }
+  ASSERT_NE(nullptr, own_name);
+
+  // A second query reuses the retained arrays and, through the pool, hands
+  // back pointer-equal strings.
+  const size_t capacity_before = result.capacity;
+  const char ** names_before = result.names;
+  ret = rcl_get_node_names_reuse(this->node_ptr, pool, &allocator, &result);
+  ASSERT_EQ(RCL_RET_OK, ret) << rcl_get_error_string().str;
+  EXPECT_EQ(capacity_before, result.capacity);
+  EXPECT_EQ(names_before, result.names);
+  bool found_same_pointer = false;
+  for (size_t i = 0; i < result.size; ++i) {
+    if (result.names[i] == own_name) {
+      found_same_pointer = true;
+      break;
+    }
+  }
+  EXPECT_TRUE(found_same_pointer);
+
+  ret = rcl_get_node_names_reuse(nullptr, pool, &allocator, &result);
+  EXPECT_EQ(RCL_RET_NODE_INVALID, ret);
+  rcl_reset_error();
+  ret = rcl_get_node_names_reuse(this->node_ptr, nullptr, &allocator, &result);
+  EXPECT_EQ(RCL_RET_INVALID_ARGUMENT, ret);
+  rcl_reset_error();
+  ret = rcl_get_node_names_reuse(this->node_ptr, pool, &allocator, nullptr);
+  EXPECT_EQ(RCL_RET_INVALID_ARGUMENT, ret);
+  rcl_reset_error();
+
+  EXPECT_EQ(RCL_RET_OK, rcl_node_names_result_fini(&result));
+  EXPECT_EQ(nullptr, result.names);
+  EXPECT_EQ(0u, result.capacity);
+  // The interned name outlives the result object.
+  EXPECT_STREQ(this->test_graph_node_name, own_name);
+  // Finalizing a zero initialized result is a no-op.
+  EXPECT_EQ(RCL_RET_OK, rcl_node_names_result_fini(&result));
+}
+
+/* Test the client availability cache.
+ */
+TEST_F(
+  CLASSNAME(TestGraphFixture, RMW_IMPLEMENTATION),
+  test_rcl_client_availability_cache
+) {
+  rcl_ret_t ret;
+  rcl_allocator_t allocator = rcl_get_default_allocator();
+  const rosidl_service_type_support_t * ts =
+    ROSIDL_GET_SRV_TYPE_SUPPORT(test_msgs, srv, BasicTypes);
+  const char * service_name = "/availability_cache_test_service";
+
+  rcl_client_t client = rcl_get_zero_initialized_client();
+  rcl_client_options_t client_options = rcl_client_get_default_options();
+  ret = rcl_client_init(&client, this->node_ptr, ts, service_name, &client_options);
+  ASSERT_EQ(RCL_RET_OK, ret) << rcl_get_error_string().str;
+  OSRF_TESTING_TOOLS_CPP_SCOPE_EXIT(
+  {
+    EXPECT_EQ(RCL_RET_OK, rcl_client_fini(&client, this->node_ptr)) <<
+      rcl_get_error_string().str;
+  });
+
+  rcl_client_availability_cache_t cache =
+    rcl_get_zero_initialized_client_availability_cache();
+  ret = rcl_client_availability_cache_init(&cache, this->node_ptr, nullptr, &allocator);
+  EXPECT_EQ(RCL_RET_INVALID_ARGUMENT, ret);
+  rcl_reset_error();
+  ret = rcl_client_availability_cache_init(&cache, this->node_ptr, &client, &allocator);
+  ASSERT_EQ(RCL_RET_OK, ret) << rcl_get_error_string().str;
+  ret = rcl_client_availability_cache_init(&cache, this->node_ptr, &client, &allocator);
+  EXPECT_EQ(RCL_RET_ALREADY_INIT, ret);
+  rcl_reset_error();
+
+  bool is_available = true;
+  ret = rcl_client_availability_cache_is_available(&cache, &is_available);
+  ASSERT_EQ(RCL_RET_OK, ret) << rcl_get_error_string().str;
+  EXPECT_FALSE(is_available);
+
+  // Bringing a server up must flip the cached answer after the graph event.
+  rcl_service_t service = rcl_get_zero_initialized_service();
+  rcl_service_options_t service_options = rcl_service_get_default_options();
+  ret = rcl_service_init(&service, this->node_ptr, ts, service_name, &service_options);
+  ASSERT_EQ(RCL_RET_OK, ret) << rcl_get_error_string().str;
+  for (size_t attempt = 0; attempt < 500 && !is_available; ++attempt) {
+    ret = rcl_client_availability_cache_is_available(&cache, &is_available);
+    ASSERT_EQ(RCL_RET_OK, ret) << rcl_get_error_string().str;
+    if (!is_available) {
+      std::this_thread::sleep_for(std::chrono::milliseconds(10));
+    }
+  }
+  EXPECT_TRUE(is_available);
+  // Once available, repeated checks are served from the cached flag.
+  for (size_t i = 0; i < 10; ++i) {
+    bool repeat = false;
+    ret = rcl_client_availability_cache_is_available(&cache, &repeat);
+    ASSERT_EQ(RCL_RET_OK, ret) << rcl_get_error_string().str;
+    EXPECT_TRUE(repeat);
+  }
+  // Invalidation forces a fresh rmw query, which still sees the server.
+  EXPECT_EQ(RCL_RET_OK, rcl_client_availability_cache_invalidate(&cache));
+  ret = rcl_client_availability_cache_is_available(&cache, &is_available);
+  ASSERT_EQ(RCL_RET_OK, ret) << rcl_get_error_string().str;
+  EXPECT_TRUE(is_available);
+
+  // After the server goes away, an invalidated cache must observe it.
+  EXPECT_EQ(RCL_RET_OK, rcl_service_fini(&service, this->node_ptr)) <<
+    rcl_get_error_string().str;
+  EXPECT_EQ(RCL_RET_OK, rcl_client_availability_cache_invalidate(&cache));
+  for (size_t attempt = 0; attempt < 500 && is_available; ++attempt) {
+    ret = rcl_client_availability_cache_is_available(&cache, &is_available);
+    ASSERT_EQ(RCL_RET_OK, ret) << rcl_get_error_string().str;
+    if (is_available) {
+      EXPECT_EQ(RCL_RET_OK, rcl_client_availability_cache_invalidate(&cache));
+      std::this_thread::sleep_for(std::chrono::milliseconds(10));
+    }
+  }
+  EXPECT_FALSE(is_available);
+
+  ret = rcl_client_availability_cache_is_available(&cache, nullptr);
+  EXPECT_EQ(RCL_RET_INVALID_ARGUMENT, ret);
+  rcl_reset_error();
+
+  ret = rcl_client_availability_cache_fini(&cache);
+  EXPECT_EQ(RCL_RET_OK, ret) << rcl_get_error_string().str;
+  EXPECT_EQ(nullptr, cache.impl);
+  ret = rcl_client_availability_cache_fini(&cache);
+  EXPECT_EQ(RCL_RET_INVALID_ARGUMENT, ret);
+  rcl_reset_error();
+}
@@ -251,3 +251,72 @@ TEST_F(
   EXPECT_EQ(RCL_RET_INVALID_ARGUMENT, rcl_trigger_guard_condition(&zero_guard_condition));
   rcl_reset_error();
 }
+
+/* Tests the coalesced trigger and pending count draining
+ */
+TEST_F(
+  CLASSNAME(TestGuardConditionFixture, RMW_IMPLEMENTATION),
+  test_rcl_guard_condition_coalesced_trigger) {
+  rcl_ret_t ret;
+  uint64_t pending_count = 0;
+
+  // Bad arguments.
+  EXPECT_EQ(RCL_RET_INVALID_ARGUMENT, rcl_trigger_guard_condition_coalesced(nullptr));
+  rcl_reset_error();
+  EXPECT_EQ(RCL_RET_INVALID_ARGUMENT, rcl_guard_condition_take_pending(nullptr, &pending_count));
+  rcl_reset_error();
+
+  rcl_context_t context = rcl_get_zero_initialized_context();
+  rcl_init_options_t init_options = rcl_get_zero_initialized_init_options();
+  ret = rcl_init_options_init(&init_options, rcl_get_default_allocator());
+  ASSERT_EQ(RCL_RET_OK, ret) << rcl_get_error_string().str;
+  OSRF_TESTING_TOOLS_CPP_SCOPE_EXIT(
+  {
+    EXPECT_EQ(RCL_RET_OK, rcl_init_options_fini(&init_options)) << rcl_get_error_string().str;
+  });
+  ret = rcl_init(0, nullptr, &init_options, &context);
+  ASSERT_EQ(RCL_RET_OK, ret) << rcl_get_error_string().str;
+  OSRF_TESTING_TOOLS_CPP_SCOPE_EXIT(
+  {
+    ASSERT_EQ(RCL_RET_OK, rcl_shutdown(&context));
+    ASSERT_EQ(RCL_RET_OK, rcl_context_fini(&context));
+  });
+
+  rcl_guard_condition_t guard_condition = rcl_get_zero_initialized_guard_condition();
+  ret = rcl_guard_condition_init(
+    &guard_condition, &context, rcl_guard_condition_get_default_options());
+  ASSERT_EQ(RCL_RET_OK, ret) << rcl_get_error_string().str;
+  OSRF_TESTING_TOOLS_CPP_SCOPE_EXIT(
+  {
+    EXPECT_EQ(RCL_RET_OK, rcl_guard_condition_fini(&guard_condition));
+  });
+
+  EXPECT_EQ(
+    RCL_RET_INVALID_ARGUMENT, rcl_guard_condition_take_pending(&guard_condition, nullptr));
+  rcl_reset_error();
+
+  // Nothing pending before any trigger.
+  ret = rcl_guard_condition_take_pending(&guard_condition, &pending_count);
+  EXPECT_EQ(RCL_RET_OK, ret) << rcl_get_error_string().str;
+  EXPECT_EQ(0u, pending_count);
+
+  // A burst of triggers is recorded in full and drained in one call.
+  for (size_t i = 0; i < 5; ++i) {
+    ret = rcl_trigger_guard_condition_coalesced(&guard_condition);
+    EXPECT_EQ(RCL_RET_OK, ret) << rcl_get_error_string().str;
+  }
+  ret = rcl_guard_condition_take_pending(&guard_condition, &pending_count);
+  EXPECT_EQ(RCL_RET_OK, ret) << rcl_get_error_string().str;
+  EXPECT_EQ(5u, pending_count);
+
+  // The drain resets the count, so the next wakeup starts from zero.
+  ret = rcl_guard_condition_take_pending(&guard_condition, &pending_count);
+  EXPECT_EQ(RCL_RET_OK, ret) << rcl_get_error_string().str;
+  EXPECT_EQ(0u, pending_count);
+
+  ret = rcl_trigger_guard_condition_coalesced(&guard_condition);
+  EXPECT_EQ(RCL_RET_OK, ret) << rcl_get_error_string().str;
+  ret = rcl_guard_condition_take_pending(&guard_condition, &pending_count);
+  EXPECT_EQ(RCL_RET_OK, ret) << rcl_get_error_string().str;
+  EXPECT_EQ(1u, pending_count);
+}
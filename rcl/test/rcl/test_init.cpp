@@ -18,6 +18,7 @@
 #include "osrf_testing_tools_cpp/scope_exit.hpp"
 #include "rcl/arguments.h"
 #include "rcl/error_handling.h"
+#include "rcl/numa_pool.h"
 #include "rcl/rcl.h"
 #include "rcl/security.h"
 #include "rcutils/env.h"
@@ -319,6 +320,150 @@ TEST_F(CLASSNAME(TestRCLFixture, RMW_IMPLEMENTATION), test_rcl_init_and_shutdown
   context = rcl_get_zero_initialized_context();
 }
 
+/* Tests rcl_init() with deferred rmw context creation.
+ */
+TEST_F(CLASSNAME(TestRCLFixture, RMW_IMPLEMENTATION), test_rcl_init_defer_rmw) {
+  rcl_init_options_t init_options = rcl_get_zero_initialized_init_options();
+  rcl_ret_t ret = rcl_init_options_init(&init_options, rcl_get_default_allocator());
+  ASSERT_EQ(RCL_RET_OK, ret) << rcl_get_error_string().str;
+  OSRF_TESTING_TOOLS_CPP_SCOPE_EXIT(
+  {
+    EXPECT_EQ(RCL_RET_OK, rcl_init_options_fini(&init_options)) << rcl_get_error_string().str;
+  });
+
+  // the flag defaults to false and round-trips through set/get and copy
+  bool defer_rmw_init = true;
+  EXPECT_EQ(RCL_RET_INVALID_ARGUMENT, rcl_init_options_get_defer_rmw_init(nullptr, &defer_rmw_init));
+  rcl_reset_error();
+  EXPECT_EQ(RCL_RET_INVALID_ARGUMENT, rcl_init_options_get_defer_rmw_init(&init_options, nullptr));
+  rcl_reset_error();
+  EXPECT_EQ(RCL_RET_INVALID_ARGUMENT, rcl_init_options_set_defer_rmw_init(nullptr, true));
+  rcl_reset_error();
+  EXPECT_EQ(RCL_RET_OK, rcl_init_options_get_defer_rmw_init(&init_options, &defer_rmw_init));
+  EXPECT_FALSE(defer_rmw_init);
+  EXPECT_EQ(RCL_RET_OK, rcl_init_options_set_defer_rmw_init(&init_options, true));
+  EXPECT_EQ(RCL_RET_OK, rcl_init_options_get_defer_rmw_init(&init_options, &defer_rmw_init));
+  EXPECT_TRUE(defer_rmw_init);
+  {
+    rcl_init_options_t init_options_copy = rcl_get_zero_initialized_init_options();
+    EXPECT_EQ(RCL_RET_OK, rcl_init_options_copy(&init_options, &init_options_copy));
+    defer_rmw_init = false;
+    EXPECT_EQ(RCL_RET_OK, rcl_init_options_get_defer_rmw_init(&init_options_copy, &defer_rmw_init));
+    EXPECT_TRUE(defer_rmw_init);
+    EXPECT_EQ(RCL_RET_OK, rcl_init_options_fini(&init_options_copy));
+  }
+
+  // ensure on an invalid context fails
+  rcl_context_t context = rcl_get_zero_initialized_context();
+  EXPECT_EQ(RCL_RET_INVALID_ARGUMENT, rcl_context_ensure_rmw_context(nullptr));
+  rcl_reset_error();
+  EXPECT_EQ(RCL_RET_NOT_INIT, rcl_context_ensure_rmw_context(&context));
+  rcl_reset_error();
+
+  // init with the flag set leaves the rmw context uncreated but the context valid
+  ret = rcl_init(0, nullptr, &init_options, &context);
+  ASSERT_EQ(RCL_RET_OK, ret) << rcl_get_error_string().str;
+  ASSERT_TRUE(rcl_context_is_valid(&context));
+  rmw_context_t * rmw_context = rcl_context_get_rmw_context(&context);
+  ASSERT_NE(nullptr, rmw_context);
+  EXPECT_EQ(nullptr, rmw_context->implementation_identifier);
+
+  // shutdown without ever touching the middleware works
+  EXPECT_EQ(RCL_RET_OK, rcl_shutdown(&context));
+  EXPECT_EQ(RCL_RET_OK, rcl_context_fini(&context));
+
+  // this time materialize the rmw context before shutting down
+  context = rcl_get_zero_initialized_context();
+  ret = rcl_init(0, nullptr, &init_options, &context);
+  ASSERT_EQ(RCL_RET_OK, ret) << rcl_get_error_string().str;
+  EXPECT_EQ(RCL_RET_OK, rcl_context_ensure_rmw_context(&context));
+  rmw_context = rcl_context_get_rmw_context(&context);
+  ASSERT_NE(nullptr, rmw_context);
+  EXPECT_NE(nullptr, rmw_context->implementation_identifier);
+  // a second call is a no-op
+  EXPECT_EQ(RCL_RET_OK, rcl_context_ensure_rmw_context(&context));
+  EXPECT_EQ(RCL_RET_OK, rcl_shutdown(&context));
+  EXPECT_EQ(RCL_RET_OK, rcl_context_fini(&context));
+}
+
+/* Tests rcl_init() with a shared rmw context.
+ */
+TEST_F(CLASSNAME(TestRCLFixture, RMW_IMPLEMENTATION), test_rcl_init_share_rmw_context) {
+  rcl_init_options_t init_options = rcl_get_zero_initialized_init_options();
+  rcl_ret_t ret = rcl_init_options_init(&init_options, rcl_get_default_allocator());
+  ASSERT_EQ(RCL_RET_OK, ret) << rcl_get_error_string().str;
+  OSRF_TESTING_TOOLS_CPP_SCOPE_EXIT(
+  {
+    EXPECT_EQ(RCL_RET_OK, rcl_init_options_fini(&init_options)) << rcl_get_error_string().str;
+  });
+
+  // the flag defaults to false and round-trips through set/get and copy
+  bool share_rmw_context = true;
+  EXPECT_EQ(
+    RCL_RET_INVALID_ARGUMENT, rcl_init_options_get_share_rmw_context(nullptr, &share_rmw_context));
+  rcl_reset_error();
+  EXPECT_EQ(
+    RCL_RET_INVALID_ARGUMENT, rcl_init_options_get_share_rmw_context(&init_options, nullptr));
+  rcl_reset_error();
+  EXPECT_EQ(RCL_RET_INVALID_ARGUMENT, rcl_init_options_set_share_rmw_context(nullptr, true));
+  rcl_reset_error();
+  EXPECT_EQ(RCL_RET_OK, rcl_init_options_get_share_rmw_context(&init_options, &share_rmw_context));
+  EXPECT_FALSE(share_rmw_context);
+  EXPECT_EQ(RCL_RET_OK, rcl_init_options_set_share_rmw_context(&init_options, true));
+  {
+    rcl_init_options_t init_options_copy = rcl_get_zero_initialized_init_options();
+    EXPECT_EQ(RCL_RET_OK, rcl_init_options_copy(&init_options, &init_options_copy));
+    share_rmw_context = false;
+    EXPECT_EQ(
+      RCL_RET_OK,
+      rcl_init_options_get_share_rmw_context(&init_options_copy, &share_rmw_context));
+    EXPECT_TRUE(share_rmw_context);
+    EXPECT_EQ(RCL_RET_OK, rcl_init_options_fini(&init_options_copy));
+  }
+
+  // two contexts with matching options share one rmw context
+  rcl_context_t context_a = rcl_get_zero_initialized_context();
+  rcl_context_t context_b = rcl_get_zero_initialized_context();
+  ret = rcl_init(0, nullptr, &init_options, &context_a);
+  ASSERT_EQ(RCL_RET_OK, ret) << rcl_get_error_string().str;
+  ret = rcl_init(0, nullptr, &init_options, &context_b);
+  ASSERT_EQ(RCL_RET_OK, ret) << rcl_get_error_string().str;
+  rmw_context_t * rmw_context_a = rcl_context_get_rmw_context(&context_a);
+  rmw_context_t * rmw_context_b = rcl_context_get_rmw_context(&context_b);
+  ASSERT_NE(nullptr, rmw_context_a);
+  ASSERT_NE(nullptr, rmw_context_b);
+  EXPECT_EQ(rmw_context_a->impl, rmw_context_b->impl);
+
+  // shutting one down leaves the other usable
+  EXPECT_EQ(RCL_RET_OK, rcl_shutdown(&context_a));
+  EXPECT_EQ(RCL_RET_OK, rcl_context_fini(&context_a));
+  EXPECT_TRUE(rcl_context_is_valid(&context_b));
+  EXPECT_NE(nullptr, rcl_context_get_rmw_context(&context_b)->impl);
+  EXPECT_EQ(RCL_RET_OK, rcl_shutdown(&context_b));
+  EXPECT_EQ(RCL_RET_OK, rcl_context_fini(&context_b));
+
+  // a context with a different domain id does not join the shared rmw context
+  rcl_context_t context_c = rcl_get_zero_initialized_context();
+  rcl_context_t context_d = rcl_get_zero_initialized_context();
+  ret = rcl_init(0, nullptr, &init_options, &context_c);
+  ASSERT_EQ(RCL_RET_OK, ret) << rcl_get_error_string().str;
+  size_t domain_id = 0u;
+  ASSERT_EQ(RCL_RET_OK, rcl_context_get_domain_id(&context_c, &domain_id));
+  rcl_init_options_t other_domain_options = rcl_get_zero_initialized_init_options();
+  ASSERT_EQ(RCL_RET_OK, rcl_init_options_copy(&init_options, &other_domain_options));
+  ASSERT_EQ(RCL_RET_OK, rcl_init_options_set_domain_id(&other_domain_options, domain_id + 1u));
+  ret = rcl_init(0, nullptr, &other_domain_options, &context_d);
+  ASSERT_EQ(RCL_RET_OK, ret) << rcl_get_error_string().str;
+  EXPECT_NE(
+    rcl_context_get_rmw_context(&context_c)->impl,
+    rcl_context_get_rmw_context(&context_d)->impl);
+  EXPECT_EQ(RCL_RET_OK, rcl_init_options_fini(&other_domain_options));
+  EXPECT_EQ(RCL_RET_OK, rcl_shutdown(&context_c));
+  EXPECT_EQ(RCL_RET_OK, rcl_context_fini(&context_c));
+  EXPECT_EQ(RCL_RET_OK, rcl_shutdown(&context_d));
+  EXPECT_EQ(RCL_RET_OK, rcl_context_fini(&context_d));
+}
+
 /* Tests rcl_init() deals with internal errors correctly.
  */
 TEST_F(CLASSNAME(TestRCLFixture, RMW_IMPLEMENTATION), test_rcl_init_internal_error) {
@@ -524,6 +669,102 @@ TEST_F(CLASSNAME(TestRCLFixture, RMW_IMPLEMENTATION), test_rcl_init_options_acce
   EXPECT_EQ(RCL_RET_OK, rcl_init_options_fini(&init_options_dst));
 }
 
+TEST_F(CLASSNAME(TestRCLFixture, RMW_IMPLEMENTATION), test_rcl_init_options_domain_allocators) {
+  rcl_init_options_t init_options = rcl_get_zero_initialized_init_options();
+  rcl_init_options_t not_ini_init_options = rcl_get_zero_initialized_init_options();
+  rcl_ret_t ret = rcl_init_options_init(&init_options, rcl_get_default_allocator());
+  ASSERT_EQ(RCL_RET_OK, ret) << rcl_get_error_string().str;
+  OSRF_TESTING_TOOLS_CPP_SCOPE_EXIT(
+  {
+    EXPECT_EQ(RCL_RET_OK, rcl_init_options_fini(&init_options)) << rcl_get_error_string().str;
+  });
+
+  // a node-bound pool provides the data-plane allocator
+  rcl_numa_pool_t pool = rcl_get_zero_initialized_numa_pool();
+  size_t used = 0;
+  size_t capacity = 0;
+  EXPECT_EQ(RCL_RET_NOT_INIT, rcl_numa_pool_get_usage(&pool, &used, &capacity));
+  rcl_reset_error();
+  EXPECT_EQ(
+    RCL_RET_INVALID_ARGUMENT, rcl_numa_pool_init(&pool, 0, rcl_get_default_allocator()));
+  rcl_reset_error();
+  ASSERT_EQ(RCL_RET_OK, rcl_numa_pool_init(&pool, 4096, rcl_get_default_allocator())) <<
+    rcl_get_error_string().str;
+  OSRF_TESTING_TOOLS_CPP_SCOPE_EXIT(
+  {
+    EXPECT_EQ(RCL_RET_OK, rcl_numa_pool_fini(&pool)) << rcl_get_error_string().str;
+  });
+  EXPECT_EQ(
+    RCL_RET_ALREADY_INIT, rcl_numa_pool_init(&pool, 4096, rcl_get_default_allocator()));
+  rcl_reset_error();
+  rcl_allocator_t pool_allocator = rcl_numa_pool_get_allocator(&pool);
+  ASSERT_TRUE(rcutils_allocator_is_valid(&pool_allocator));
+
+  // allocations come out of the arena and usage tracks them
+  void * first = pool_allocator.allocate(64, pool_allocator.state);
+  ASSERT_NE(nullptr, first);
+  void * second = pool_allocator.zero_allocate(8, 16, pool_allocator.state);
+  ASSERT_NE(nullptr, second);
+  for (size_t i = 0; i < 128; ++i) {
+    EXPECT_EQ(0u, static_cast<uint8_t *>(second)[i]);
+  }
+  ASSERT_EQ(RCL_RET_OK, rcl_numa_pool_get_usage(&pool, &used, &capacity));
+  EXPECT_GT(used, 0u);
+  EXPECT_LE(used, capacity);
+  second = pool_allocator.reallocate(second, 256, pool_allocator.state);
+  ASSERT_NE(nullptr, second);
+  pool_allocator.deallocate(second, pool_allocator.state);
+  pool_allocator.deallocate(first, pool_allocator.state);
+  ASSERT_EQ(RCL_RET_OK, rcl_numa_pool_get_usage(&pool, &used, &capacity));
+  EXPECT_EQ(0u, used);
+  // the pool never grows: an oversized request fails
+  EXPECT_EQ(nullptr, pool_allocator.allocate(2 * capacity, pool_allocator.state));
+
+  // unset domains fall back to the init options' own allocator
+  const rcl_allocator_t * domain_allocator =
+    rcl_init_options_get_domain_allocator(&init_options, RCL_ALLOCATION_DOMAIN_DATA_PLANE);
+  ASSERT_NE(nullptr, domain_allocator);
+  EXPECT_EQ(rcl_init_options_get_allocator(&init_options), domain_allocator);
+  EXPECT_EQ(
+    NULL, rcl_init_options_get_domain_allocator(nullptr, RCL_ALLOCATION_DOMAIN_DATA_PLANE));
+  EXPECT_EQ(
+    NULL,
+    rcl_init_options_get_domain_allocator(&not_ini_init_options, RCL_ALLOCATION_DOMAIN_DATA_PLANE));
+  rcl_reset_error();
+  EXPECT_EQ(
+    NULL, rcl_init_options_get_domain_allocator(&init_options, RCL_ALLOCATION_DOMAIN_COUNT));
+  rcl_reset_error();
+  EXPECT_EQ(
+    RCL_RET_INVALID_ARGUMENT,
+    rcl_init_options_set_domain_allocator(
+      &init_options, RCL_ALLOCATION_DOMAIN_COUNT, pool_allocator));
+  rcl_reset_error();
+
+  ASSERT_EQ(
+    RCL_RET_OK,
+    rcl_init_options_set_domain_allocator(
+      &init_options, RCL_ALLOCATION_DOMAIN_DATA_PLANE, pool_allocator)) <<
+    rcl_get_error_string().str;
+  domain_allocator =
+    rcl_init_options_get_domain_allocator(&init_options, RCL_ALLOCATION_DOMAIN_DATA_PLANE);
+  ASSERT_NE(nullptr, domain_allocator);
+  EXPECT_EQ(pool_allocator.state, domain_allocator->state);
+  // other domains are unaffected
+  domain_allocator =
+    rcl_init_options_get_domain_allocator(&init_options, RCL_ALLOCATION_DOMAIN_LOGGING);
+  ASSERT_NE(nullptr, domain_allocator);
+  EXPECT_EQ(rcl_init_options_get_allocator(&init_options), domain_allocator);
+
+  // assignments survive a copy
+  rcl_init_options_t init_options_dst = rcl_get_zero_initialized_init_options();
+  ASSERT_EQ(RCL_RET_OK, rcl_init_options_copy(&init_options, &init_options_dst));
+  domain_allocator =
+    rcl_init_options_get_domain_allocator(&init_options_dst, RCL_ALLOCATION_DOMAIN_DATA_PLANE);
+  ASSERT_NE(nullptr, domain_allocator);
+  EXPECT_EQ(pool_allocator.state, domain_allocator->state);
+  EXPECT_EQ(RCL_RET_OK, rcl_init_options_fini(&init_options_dst));
+}
+
 // Define dummy comparison operators for rcutils_allocator_t type for use with the Mimick Library
 MOCKING_UTILS_BOOL_OPERATOR_RETURNS_FALSE(rcutils_allocator_t, ==)
 MOCKING_UTILS_BOOL_OPERATOR_RETURNS_FALSE(rcutils_allocator_t, <)
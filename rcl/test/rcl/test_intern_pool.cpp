@@ -0,0 +1,141 @@
+// Copyright 2026 Open Source Robotics Foundation, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <gtest/gtest.h>
+
+#include <string>
+
+#include "rcl/intern_pool.h"
+
+#include "rcl/error_handling.h"
+
+class TestInternPoolFixture : public ::testing::Test
+{
+public:
+  rcl_intern_pool_t pool;
+  void SetUp()
+  {
+    this->pool = rcl_get_zero_initialized_intern_pool();
+    rcl_allocator_t allocator = rcl_get_default_allocator();
+    rcl_ret_t ret = rcl_intern_pool_init(&this->pool, &allocator);
+    ASSERT_EQ(RCL_RET_OK, ret) << rcl_get_error_string().str;
+  }
+
+  void TearDown()
+  {
+    rcl_ret_t ret = rcl_intern_pool_fini(&this->pool);
+    EXPECT_EQ(RCL_RET_OK, ret) << rcl_get_error_string().str;
+  }
+};
+
+TEST_F(TestInternPoolFixture, test_intern_pool_init_fini) {
+  // The fixture pool is already initialized; a second init must fail.
+  rcl_allocator_t allocator = rcl_get_default_allocator();
+  rcl_ret_t ret = rcl_intern_pool_init(&this->pool, &allocator);
+  EXPECT_EQ(RCL_RET_ALREADY_INIT, ret);
+  rcl_reset_error();
+
+  ret = rcl_intern_pool_init(nullptr, &allocator);
+  EXPECT_EQ(RCL_RET_INVALID_ARGUMENT, ret);
+  rcl_reset_error();
+
+  ret = rcl_intern_pool_fini(nullptr);
+  EXPECT_EQ(RCL_RET_INVALID_ARGUMENT, ret);
+  rcl_reset_error();
+
+  // Finalizing a zero initialized pool is a no-op.
+  rcl_intern_pool_t null_pool = rcl_get_zero_initialized_intern_pool();
+  ret = rcl_intern_pool_fini(&null_pool);
+  EXPECT_EQ(RCL_RET_OK, ret) << rcl_get_error_string().str;
+}
+
+TEST_F(TestInternPoolFixture, test_intern_pool_intern) {
+  const char * first = nullptr;
+  rcl_ret_t ret = rcl_intern_pool_intern(&this->pool, "/chatter", &first);
+  ASSERT_EQ(RCL_RET_OK, ret) << rcl_get_error_string().str;
+  ASSERT_NE(nullptr, first);
+  EXPECT_STREQ("/chatter", first);
+  // The canonical copy is owned by the pool, not the caller's buffer.
+  EXPECT_NE("/chatter", first);
+
+  // Interning an equal string from different storage yields the same pointer.
+  std::string same("/chatter");
+  const char * second = nullptr;
+  ret = rcl_intern_pool_intern(&this->pool, same.c_str(), &second);
+  ASSERT_EQ(RCL_RET_OK, ret) << rcl_get_error_string().str;
+  EXPECT_EQ(first, second);
+
+  const char * other = nullptr;
+  ret = rcl_intern_pool_intern(&this->pool, "/chatter2", &other);
+  ASSERT_EQ(RCL_RET_OK, ret) << rcl_get_error_string().str;
+  EXPECT_NE(first, other);
+
+  size_t count = 0;
+  ret = rcl_intern_pool_get_count(&this->pool, &count);
+  ASSERT_EQ(RCL_RET_OK, ret) << rcl_get_error_string().str;
+  EXPECT_EQ(2u, count);
+}
+
+TEST_F(TestInternPoolFixture, test_intern_pool_growth) {
+  // Intern enough distinct strings to force the table past its initial
+  // capacity several times, then verify every pointer stayed stable.
+  constexpr size_t num_strings = 500;
+  const char * pointers[num_strings];
+  for (size_t i = 0; i < num_strings; ++i) {
+    std::string name = "/topic_" + std::to_string(i);
+    rcl_ret_t ret = rcl_intern_pool_intern(&this->pool, name.c_str(), &pointers[i]);
+    ASSERT_EQ(RCL_RET_OK, ret) << rcl_get_error_string().str;
+  }
+  size_t count = 0;
+  rcl_ret_t ret = rcl_intern_pool_get_count(&this->pool, &count);
+  ASSERT_EQ(RCL_RET_OK, ret) << rcl_get_error_string().str;
+  EXPECT_EQ(num_strings, count);
+  for (size_t i = 0; i < num_strings; ++i) {
+    std::string name = "/topic_" + std::to_string(i);
+    const char * interned = nullptr;
+    ret = rcl_intern_pool_intern(&this->pool, name.c_str(), &interned);
+    ASSERT_EQ(RCL_RET_OK, ret) << rcl_get_error_string().str;
+    EXPECT_EQ(pointers[i], interned);
+    EXPECT_STREQ(name.c_str(), interned);
+  }
+}
+
+TEST_F(TestInternPoolFixture, test_intern_pool_bad_arguments) {
+  const char * interned = nullptr;
+  rcl_ret_t ret = rcl_intern_pool_intern(nullptr, "/chatter", &interned);
+  EXPECT_EQ(RCL_RET_INVALID_ARGUMENT, ret);
+  rcl_reset_error();
+
+  ret = rcl_intern_pool_intern(&this->pool, nullptr, &interned);
+  EXPECT_EQ(RCL_RET_INVALID_ARGUMENT, ret);
+  rcl_reset_error();
+
+  ret = rcl_intern_pool_intern(&this->pool, "/chatter", nullptr);
+  EXPECT_EQ(RCL_RET_INVALID_ARGUMENT, ret);
+  rcl_reset_error();
+
+  rcl_intern_pool_t null_pool = rcl_get_zero_initialized_intern_pool();
+  ret = rcl_intern_pool_intern(&null_pool, "/chatter", &interned);
+  EXPECT_EQ(RCL_RET_INVALID_ARGUMENT, ret);
+  rcl_reset_error();
+
+  size_t count = 0;
+  ret = rcl_intern_pool_get_count(nullptr, &count);
+  EXPECT_EQ(RCL_RET_INVALID_ARGUMENT, ret);
+  rcl_reset_error();
+
+  ret = rcl_intern_pool_get_count(&this->pool, nullptr);
+  EXPECT_EQ(RCL_RET_INVALID_ARGUMENT, ret);
+  rcl_reset_error();
+}
@@ -0,0 +1,218 @@
+// Copyright 2026 Open Source Robotics Foundation, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <gtest/gtest.h>
+
+#include "rcl/intra_process.h"
+#include "rcl/rcl.h"
+#include "rcl/error_handling.h"
+
+#include "osrf_testing_tools_cpp/scope_exit.hpp"
+#include "test_msgs/msg/basic_types.h"
+
+#ifdef RMW_IMPLEMENTATION
+# define CLASSNAME_(NAME, SUFFIX) NAME ## __ ## SUFFIX
+# define CLASSNAME(NAME, SUFFIX) CLASSNAME_(NAME, SUFFIX)
+#else
+# define CLASSNAME(NAME, SUFFIX) NAME
+#endif
+
+class CLASSNAME (TestIntraProcessFixture, RMW_IMPLEMENTATION) : public ::testing::Test
+{
+public:
+  rcl_context_t * context_ptr;
+  rcl_node_t * node_ptr;
+  void SetUp()
+  {
+    rcl_ret_t ret;
+    {
+      rcl_init_options_t init_options = rcl_get_zero_initialized_init_options();
+      ret = rcl_init_options_init(&init_options, rcl_get_default_allocator());
+      ASSERT_EQ(RCL_RET_OK, ret) << rcl_get_error_string().str;
+      OSRF_TESTING_TOOLS_CPP_SCOPE_EXIT(
+      {
+        EXPECT_EQ(RCL_RET_OK, rcl_init_options_fini(&init_options)) << rcl_get_error_string().str;
+      });
+      this->context_ptr = new rcl_context_t;
+      *this->context_ptr = rcl_get_zero_initialized_context();
+      ret = rcl_init(0, nullptr, &init_options, this->context_ptr);
+      ASSERT_EQ(RCL_RET_OK, ret) << rcl_get_error_string().str;
+    }
+    this->node_ptr = new rcl_node_t;
+    *this->node_ptr = rcl_get_zero_initialized_node();
+    constexpr char name[] = "test_intra_process_node";
+    rcl_node_options_t node_options = rcl_node_get_default_options();
+    ret = rcl_node_init(this->node_ptr, name, "", this->context_ptr, &node_options);
+    ASSERT_EQ(RCL_RET_OK, ret) << rcl_get_error_string().str;
+  }
+
+  void TearDown()
+  {
+    rcl_ret_t ret = rcl_node_fini(this->node_ptr);
+    delete this->node_ptr;
+    EXPECT_EQ(RCL_RET_OK, ret) << rcl_get_error_string().str;
+    ret = rcl_shutdown(this->context_ptr);
+    EXPECT_EQ(RCL_RET_OK, ret) << rcl_get_error_string().str;
+    ret = rcl_context_fini(this->context_ptr);
+    delete this->context_ptr;
+    EXPECT_EQ(RCL_RET_OK, ret) << rcl_get_error_string().str;
+  }
+};
+
+namespace
+{
+
+struct tracked_message_t
+{
+  test_msgs__msg__BasicTypes msg;
+  int * fini_counter;
+};
+
+void tracked_message_fini(void * ros_message, void * user_data)
+{
+  auto * tracked = static_cast<tracked_message_t *>(ros_message);
+  (void)user_data;
+  ++(*tracked->fini_counter);
+  test_msgs__msg__BasicTypes__fini(&tracked->msg);
+  delete tracked;
+}
+
+tracked_message_t * make_tracked_message(int * fini_counter, uint32_t value)
+{
+  auto * tracked = new tracked_message_t;
+  test_msgs__msg__BasicTypes__init(&tracked->msg);
+  tracked->msg.uint32_value = value;
+  tracked->fini_counter = fini_counter;
+  return tracked;
+}
+
+}  // namespace
+
+/* Pointer delivery between a matched publisher and subscription.
+ */
+TEST_F(
+  CLASSNAME(TestIntraProcessFixture, RMW_IMPLEMENTATION), test_intra_process_publish_take)
+{
+  rcl_ret_t ret;
+  const rosidl_message_type_support_t * ts =
+    ROSIDL_GET_MSG_TYPE_SUPPORT(test_msgs, msg, BasicTypes);
+  constexpr char topic[] = "rcl_test_intra_process_chatter";
+  rcl_publisher_t publisher = rcl_get_zero_initialized_publisher();
+  rcl_publisher_options_t publisher_options = rcl_publisher_get_default_options();
+  ret = rcl_publisher_init(&publisher, this->node_ptr, ts, topic, &publisher_options);
+  ASSERT_EQ(RCL_RET_OK, ret) << rcl_get_error_string().str;
+  OSRF_TESTING_TOOLS_CPP_SCOPE_EXIT(
+  {
+    rcl_ret_t ret = rcl_publisher_fini(&publisher, this->node_ptr);
+    EXPECT_EQ(RCL_RET_OK, ret) << rcl_get_error_string().str;
+  });
+  rcl_subscription_t subscription = rcl_get_zero_initialized_subscription();
+  rcl_subscription_options_t subscription_options = rcl_subscription_get_default_options();
+  ret = rcl_subscription_init(&subscription, this->node_ptr, ts, topic, &subscription_options);
+  ASSERT_EQ(RCL_RET_OK, ret) << rcl_get_error_string().str;
+  OSRF_TESTING_TOOLS_CPP_SCOPE_EXIT(
+  {
+    rcl_ret_t ret = rcl_subscription_fini(&subscription, this->node_ptr);
+    EXPECT_EQ(RCL_RET_OK, ret) << rcl_get_error_string().str;
+  });
+
+  // publishing without enabling is rejected
+  int fini_count = 0;
+  size_t num_delivered = 0;
+  tracked_message_t * loose = make_tracked_message(&fini_count, 0u);
+  EXPECT_EQ(
+    RCL_RET_INVALID_ARGUMENT,
+    rcl_publish_intra_process(&publisher, loose, tracked_message_fini, nullptr, &num_delivered));
+  rcl_reset_error();
+  tracked_message_fini(loose, nullptr);
+  fini_count = 0;
+
+  ASSERT_EQ(RCL_RET_OK, rcl_publisher_enable_intra_process(&publisher)) <<
+    rcl_get_error_string().str;
+  EXPECT_EQ(RCL_RET_ALREADY_INIT, rcl_publisher_enable_intra_process(&publisher));
+  rcl_reset_error();
+
+  // with no subscription attached the message is finalized immediately
+  ASSERT_EQ(
+    RCL_RET_OK,
+    rcl_publish_intra_process(
+      &publisher, make_tracked_message(&fini_count, 1u), tracked_message_fini, nullptr,
+      &num_delivered)) << rcl_get_error_string().str;
+  EXPECT_EQ(0u, num_delivered);
+  EXPECT_EQ(1, fini_count);
+
+  ASSERT_EQ(
+    RCL_RET_OK,
+    rcl_subscription_enable_intra_process(&subscription, this->context_ptr, 4)) <<
+    rcl_get_error_string().str;
+  const rcl_guard_condition_t * guard_condition =
+    rcl_subscription_get_intra_process_guard_condition(&subscription);
+  ASSERT_NE(nullptr, guard_condition);
+
+  // an empty ring reports a take failure, like an empty middleware queue
+  void * taken = nullptr;
+  rcl_intra_process_message_t * handle = nullptr;
+  EXPECT_EQ(
+    RCL_RET_SUBSCRIPTION_TAKE_FAILED, rcl_take_intra_process(&subscription, &taken, &handle));
+
+  fini_count = 0;
+  ASSERT_EQ(
+    RCL_RET_OK,
+    rcl_publish_intra_process(
+      &publisher, make_tracked_message(&fini_count, 42u), tracked_message_fini, nullptr,
+      &num_delivered)) << rcl_get_error_string().str;
+  EXPECT_EQ(1u, num_delivered);
+  EXPECT_EQ(0, fini_count);
+
+  // the delivery triggered the guard condition, so a wait set wakes
+  rcl_wait_set_t wait_set = rcl_get_zero_initialized_wait_set();
+  ASSERT_EQ(
+    RCL_RET_OK,
+    rcl_wait_set_init(
+      &wait_set, 0, 1, 0, 0, 0, 0, this->context_ptr, rcl_get_default_allocator()));
+  OSRF_TESTING_TOOLS_CPP_SCOPE_EXIT(
+  {
+    EXPECT_EQ(RCL_RET_OK, rcl_wait_set_fini(&wait_set)) << rcl_get_error_string().str;
+  });
+  ASSERT_EQ(RCL_RET_OK, rcl_wait_set_add_guard_condition(&wait_set, guard_condition, nullptr));
+  ASSERT_EQ(RCL_RET_OK, rcl_wait(&wait_set, RCL_MS_TO_NS(1000))) << rcl_get_error_string().str;
+  EXPECT_EQ(guard_condition, wait_set.guard_conditions[0]);
+
+  // the taken pointer is the published instance, not a copy
+  ASSERT_EQ(RCL_RET_OK, rcl_take_intra_process(&subscription, &taken, &handle)) <<
+    rcl_get_error_string().str;
+  ASSERT_NE(nullptr, taken);
+  EXPECT_EQ(42u, static_cast<tracked_message_t *>(taken)->msg.uint32_value);
+  EXPECT_EQ(0, fini_count);
+  ASSERT_EQ(RCL_RET_OK, rcl_intra_process_message_release(handle));
+  EXPECT_EQ(1, fini_count);
+
+  // a full ring drops the new message for that subscription
+  fini_count = 0;
+  for (uint32_t i = 0; i < 5; ++i) {
+    ASSERT_EQ(
+      RCL_RET_OK,
+      rcl_publish_intra_process(
+        &publisher, make_tracked_message(&fini_count, i), tracked_message_fini, nullptr,
+        &num_delivered)) << rcl_get_error_string().str;
+  }
+  // the fifth publish found the ring full and was finalized undelivered
+  EXPECT_EQ(1, fini_count);
+
+  // disabling releases everything still queued
+  ASSERT_EQ(RCL_RET_OK, rcl_subscription_disable_intra_process(&subscription));
+  EXPECT_EQ(5, fini_count);
+  EXPECT_EQ(nullptr, rcl_subscription_get_intra_process_guard_condition(&subscription));
+  ASSERT_EQ(RCL_RET_OK, rcl_publisher_disable_intra_process(&publisher));
+}
@@ -0,0 +1,124 @@
+// Copyright 2022 Open Source Robotics Foundation, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <gtest/gtest.h>
+
+#include <chrono>
+
+#include "rcl/error_handling.h"
+#include "rcl/guard_condition.h"
+#include "rcl/rcl.h"
+
+#include "rcutils/env.h"
+
+#include "rmw/rmw.h"
+
+#include "../mocking_utils/latency_shim.hpp"
+
+#ifdef RMW_IMPLEMENTATION
+# define CLASSNAME_(NAME, SUFFIX) NAME ## __ ## SUFFIX
+# define CLASSNAME(NAME, SUFFIX) CLASSNAME_(NAME, SUFFIX)
+#else
+# define CLASSNAME(NAME, SUFFIX) NAME
+#endif
+
+TEST(TestLatencyProfile, test_deterministic_sequence) {
+  mocking_utils::LatencyProfile first(
+    std::chrono::microseconds(100), std::chrono::microseconds(50), 42u);
+  mocking_utils::LatencyProfile second(
+    std::chrono::microseconds(100), std::chrono::microseconds(50), 42u);
+  for (int i = 0; i < 100; ++i) {
+    auto delay = first.next_delay();
+    EXPECT_EQ(delay, second.next_delay());
+    EXPECT_GE(delay, std::chrono::microseconds(100));
+    EXPECT_LE(delay, std::chrono::microseconds(150));
+  }
+}
+
+TEST(TestLatencyProfile, test_from_env) {
+  ASSERT_TRUE(rcutils_set_env("SHIM_TEST_LATENCY_NS", "1000"));
+  ASSERT_TRUE(rcutils_set_env("SHIM_TEST_JITTER_NS", ""));
+  ASSERT_TRUE(rcutils_set_env("SHIM_TEST_SEED", ""));
+  auto profile = mocking_utils::LatencyProfile::from_env("SHIM_TEST");
+  EXPECT_EQ(std::chrono::nanoseconds(1000), profile.next_delay());
+  ASSERT_TRUE(rcutils_set_env("SHIM_TEST_LATENCY_NS", ""));
+}
+
+TEST(TestCallDistribution, test_percentiles) {
+  mocking_utils::CallDistribution distribution;
+  EXPECT_EQ(0u, distribution.count());
+  EXPECT_EQ(0, distribution.percentile_ns(50.0));
+  for (int64_t value = 1; value <= 1000; ++value) {
+    distribution.record(std::chrono::nanoseconds(value));
+  }
+  EXPECT_EQ(1000u, distribution.count());
+  EXPECT_EQ(1, distribution.min_ns());
+  EXPECT_EQ(1000, distribution.max_ns());
+  // Log bucketing trades precision for bounded memory; allow ~6%.
+  EXPECT_NEAR(500.0, static_cast<double>(distribution.percentile_ns(50.0)), 32.0);
+  EXPECT_NEAR(990.0, static_cast<double>(distribution.percentile_ns(99.0)), 32.0);
+}
+
+class CLASSNAME (TestLatencyShimFixture, RMW_IMPLEMENTATION) : public ::testing::Test
+{
+public:
+  rcl_context_t context = rcl_get_zero_initialized_context();
+
+  void SetUp()
+  {
+    rcl_ret_t ret;
+    rcl_init_options_t init_options = rcl_get_zero_initialized_init_options();
+    ret = rcl_init_options_init(&init_options, rcl_get_default_allocator());
+    ASSERT_EQ(RCL_RET_OK, ret) << rcl_get_error_string().str;
+    ret = rcl_init(0, nullptr, &init_options, &this->context);
+    ASSERT_EQ(RCL_RET_OK, ret) << rcl_get_error_string().str;
+    ASSERT_EQ(RCL_RET_OK, rcl_init_options_fini(&init_options)) << rcl_get_error_string().str;
+  }
+
+  void TearDown()
+  {
+    EXPECT_EQ(RCL_RET_OK, rcl_shutdown(&this->context)) << rcl_get_error_string().str;
+    EXPECT_EQ(RCL_RET_OK, rcl_context_fini(&this->context)) << rcl_get_error_string().str;
+  }
+};
+
+TEST_F(
+  CLASSNAME(TestLatencyShimFixture, RMW_IMPLEMENTATION),
+  test_injected_latency_observed)
+{
+  rcl_guard_condition_t guard_condition = rcl_get_zero_initialized_guard_condition();
+  rcl_ret_t ret = rcl_guard_condition_init(
+    &guard_condition, &this->context, rcl_guard_condition_get_default_options());
+  ASSERT_EQ(RCL_RET_OK, ret) << rcl_get_error_string().str;
+
+  constexpr auto injected = std::chrono::milliseconds(2);
+  mocking_utils::LatencyProfile profile(injected);
+  mocking_utils::CallDistribution distribution;
+  {
+    auto shim = mocking_utils::patch_with_latency(
+      "lib:rcl", rmw_trigger_guard_condition, profile, distribution);
+    for (int i = 0; i < 5; ++i) {
+      EXPECT_EQ(RCL_RET_OK, rcl_trigger_guard_condition(&guard_condition)) <<
+        rcl_get_error_string().str;
+    }
+  }
+  EXPECT_EQ(5u, distribution.count());
+  // sleep_for guarantees at least the injected delay.
+  EXPECT_GE(
+    distribution.min_ns(),
+    std::chrono::duration_cast<std::chrono::nanoseconds>(injected).count());
+
+  EXPECT_EQ(RCL_RET_OK, rcl_guard_condition_fini(&guard_condition)) <<
+    rcl_get_error_string().str;
+}
@@ -458,3 +458,65 @@ TEST_F(CLASSNAME(TestLexerLookaheadFixture, RMW_IMPLEMENTATION), test_lex_remap_
     EXPECT_LOOKAHEAD(RCL_LEXEME_EOF, "", buffer);
   }
 }
+
+TEST_F(CLASSNAME(TestLexerLookaheadFixture, RMW_IMPLEMENTATION), test_tokenize)
+{
+  rcl_ret_t ret;
+  rcl_lexer_lookahead2_t buffer;
+  SCOPE_LOOKAHEAD2(buffer, "foo:=bar");
+
+  size_t lexeme_count = 0u;
+  ret = rcl_lexer_lookahead2_tokenize(&buffer, &lexeme_count);
+  EXPECT_EQ(RCL_RET_OK, ret) << rcl_get_error_string().str;
+  // foo, :=, bar, and the EOF lexeme
+  EXPECT_EQ(4u, lexeme_count);
+
+  // Tokenizing again is idempotent
+  lexeme_count = 0u;
+  ret = rcl_lexer_lookahead2_tokenize(&buffer, &lexeme_count);
+  EXPECT_EQ(RCL_RET_OK, ret) << rcl_get_error_string().str;
+  EXPECT_EQ(4u, lexeme_count);
+
+  // The buffer has not advanced; lexemes are served from the memo table
+  EXPECT_LOOKAHEAD(RCL_LEXEME_TOKEN, "foo", buffer);
+  EXPECT_LOOKAHEAD(RCL_LEXEME_SEPARATOR, ":=", buffer);
+  EXPECT_LOOKAHEAD(RCL_LEXEME_TOKEN, "bar", buffer);
+  EXPECT_LOOKAHEAD(RCL_LEXEME_EOF, "", buffer);
+
+  ret = rcl_lexer_lookahead2_tokenize(nullptr, &lexeme_count);
+  EXPECT_EQ(RCL_RET_INVALID_ARGUMENT, ret);
+  rcl_reset_error();
+}
+
+TEST_F(CLASSNAME(TestLexerLookaheadFixture, RMW_IMPLEMENTATION), test_rewind)
+{
+  rcl_ret_t ret;
+  rcl_lexer_lookahead2_t buffer;
+  SCOPE_LOOKAHEAD2(buffer, "foo:=bar");
+
+  EXPECT_LOOKAHEAD(RCL_LEXEME_TOKEN, "foo", buffer);
+  EXPECT_LOOKAHEAD(RCL_LEXEME_SEPARATOR, ":=", buffer);
+
+  // Replay the whole string from the beginning
+  ret = rcl_lexer_lookahead2_rewind(&buffer, 0u);
+  EXPECT_EQ(RCL_RET_OK, ret) << rcl_get_error_string().str;
+  EXPECT_LOOKAHEAD(RCL_LEXEME_TOKEN, "foo", buffer);
+  EXPECT_LOOKAHEAD(RCL_LEXEME_SEPARATOR, ":=", buffer);
+  EXPECT_LOOKAHEAD(RCL_LEXEME_TOKEN, "bar", buffer);
+  EXPECT_LOOKAHEAD(RCL_LEXEME_EOF, "", buffer);
+
+  // Rewind to the start of a lexeme in the middle of the string
+  ret = rcl_lexer_lookahead2_rewind(&buffer, 3u);
+  EXPECT_EQ(RCL_RET_OK, ret) << rcl_get_error_string().str;
+  EXPECT_LOOKAHEAD(RCL_LEXEME_SEPARATOR, ":=", buffer);
+  EXPECT_LOOKAHEAD(RCL_LEXEME_TOKEN, "bar", buffer);
+
+  // Positions that are not lexeme starts are rejected
+  ret = rcl_lexer_lookahead2_rewind(&buffer, 1u);
+  EXPECT_EQ(RCL_RET_INVALID_ARGUMENT, ret);
+  rcl_reset_error();
+
+  ret = rcl_lexer_lookahead2_rewind(nullptr, 0u);
+  EXPECT_EQ(RCL_RET_INVALID_ARGUMENT, ret);
+  rcl_reset_error();
+}
@@ -16,24 +16,29 @@
 
 #include "rcl/rcl.h"
 #include "rcl/localhost.h"
+#include "rcl/env_snapshot.h"
 #include "rmw/localhost.h"
 #include "rcutils/env.h"
 
 TEST(TestLocalhost, test_get_localhost_only) {
   ASSERT_TRUE(rcutils_set_env("ROS_LOCALHOST_ONLY", "0"));
+  ASSERT_EQ(RCL_RET_OK, rcl_env_snapshot_refresh());
   rmw_localhost_only_t localhost_var;
   EXPECT_EQ(RCL_RET_OK, rcl_get_localhost_only(&localhost_var));
   EXPECT_EQ(RMW_LOCALHOST_ONLY_DISABLED, localhost_var);
 
   ASSERT_TRUE(rcutils_set_env("ROS_LOCALHOST_ONLY", "1"));
+  ASSERT_EQ(RCL_RET_OK, rcl_env_snapshot_refresh());
   EXPECT_EQ(RCL_RET_OK, rcl_get_localhost_only(&localhost_var));
   EXPECT_EQ(RMW_LOCALHOST_ONLY_ENABLED, localhost_var);
 
   ASSERT_TRUE(rcutils_set_env("ROS_LOCALHOST_ONLY", "2"));
+  ASSERT_EQ(RCL_RET_OK, rcl_env_snapshot_refresh());
   EXPECT_EQ(RCL_RET_OK, rcl_get_localhost_only(&localhost_var));
   EXPECT_EQ(RMW_LOCALHOST_ONLY_DISABLED, localhost_var);
 
   ASSERT_TRUE(rcutils_set_env("ROS_LOCALHOST_ONLY", "Unexpected"));
+  ASSERT_EQ(RCL_RET_OK, rcl_env_snapshot_refresh());
   EXPECT_EQ(RCL_RET_OK, rcl_get_localhost_only(&localhost_var));
   EXPECT_EQ(RMW_LOCALHOST_ONLY_DISABLED, localhost_var);
 
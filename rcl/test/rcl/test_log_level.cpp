@@ -403,6 +403,60 @@ TEST(TestLogLevel, test_add_logger_setting) {
   EXPECT_EQ(RCUTILS_LOG_SEVERITY_INFO, log_levels.logger_settings[1].level);
 }
 
+TEST(TestLogLevel, resolve_logger_log_level) {
+  rcl_log_levels_t log_levels = rcl_get_zero_initialized_log_levels();
+  GET_LOG_LEVEL_FROM_ARGUMENTS(
+    log_levels, "process_name", "--ros-args",
+    "--log-level", "warn",
+    "--log-level", "rcl:=debug",
+    "--log-level", "rcl.node:=error");
+  OSRF_TESTING_TOOLS_CPP_SCOPE_EXIT(
+  {
+    EXPECT_EQ(RCL_RET_OK, rcl_log_levels_fini(&log_levels));
+  });
+
+  rcl_log_severity_t level = RCUTILS_LOG_SEVERITY_UNSET;
+  EXPECT_EQ(RCL_RET_INVALID_ARGUMENT, rcl_log_levels_resolve(nullptr, "rcl", &level));
+  rcl_reset_error();
+  EXPECT_EQ(RCL_RET_INVALID_ARGUMENT, rcl_log_levels_resolve(&log_levels, nullptr, &level));
+  rcl_reset_error();
+  EXPECT_EQ(RCL_RET_INVALID_ARGUMENT, rcl_log_levels_resolve(&log_levels, "rcl", nullptr));
+  rcl_reset_error();
+
+  EXPECT_EQ(RCL_RET_OK, rcl_log_levels_build_index(&log_levels));
+  ASSERT_NE(nullptr, log_levels.sorted_order);
+
+  // exact matches
+  EXPECT_EQ(RCL_RET_OK, rcl_log_levels_resolve(&log_levels, "rcl", &level));
+  EXPECT_EQ(RCUTILS_LOG_SEVERITY_DEBUG, level);
+  EXPECT_EQ(RCL_RET_OK, rcl_log_levels_resolve(&log_levels, "rcl.node", &level));
+  EXPECT_EQ(RCUTILS_LOG_SEVERITY_ERROR, level);
+
+  // longest dotted ancestor wins
+  EXPECT_EQ(RCL_RET_OK, rcl_log_levels_resolve(&log_levels, "rcl.node.child", &level));
+  EXPECT_EQ(RCUTILS_LOG_SEVERITY_ERROR, level);
+  EXPECT_EQ(RCL_RET_OK, rcl_log_levels_resolve(&log_levels, "rcl.other", &level));
+  EXPECT_EQ(RCUTILS_LOG_SEVERITY_DEBUG, level);
+
+  // no matching setting falls back to the default level
+  EXPECT_EQ(RCL_RET_OK, rcl_log_levels_resolve(&log_levels, "other", &level));
+  EXPECT_EQ(RCUTILS_LOG_SEVERITY_WARN, level);
+  // a name that only shares a prefix with a setting is not a match
+  EXPECT_EQ(RCL_RET_OK, rcl_log_levels_resolve(&log_levels, "rclcpp", &level));
+  EXPECT_EQ(RCUTILS_LOG_SEVERITY_WARN, level);
+
+  // copies drop the index and resolve through the linear fallback
+  rcl_log_levels_t copied_log_levels = rcl_get_zero_initialized_log_levels();
+  EXPECT_EQ(RCL_RET_OK, rcl_log_levels_copy(&log_levels, &copied_log_levels));
+  OSRF_TESTING_TOOLS_CPP_SCOPE_EXIT(
+  {
+    EXPECT_EQ(RCL_RET_OK, rcl_log_levels_fini(&copied_log_levels));
+  });
+  EXPECT_EQ(nullptr, copied_log_levels.sorted_order);
+  EXPECT_EQ(RCL_RET_OK, rcl_log_levels_resolve(&copied_log_levels, "rcl.node.child", &level));
+  EXPECT_EQ(RCUTILS_LOG_SEVERITY_ERROR, level);
+}
+
 int main(int argc, char ** argv)
 {
   ::testing::InitGoogleTest(&argc, argv);
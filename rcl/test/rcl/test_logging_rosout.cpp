@@ -14,6 +14,8 @@
 
 #include <gtest/gtest.h>
 
+#include <stdarg.h>
+
 #include <string>
 #include <vector>
 
@@ -24,6 +26,7 @@
 #include "rcl/subscription.h"
 #include "rcl_interfaces/msg/log.h"
 #include "rcutils/logging_macros.h"
+#include "rcutils/time.h"
 
 #include "rcl/logging_rosout.h"
 
@@ -437,6 +440,154 @@ TEST_F(
   EXPECT_FALSE(expected);
 }
 
+void
+log_via_handle(rcl_logging_rosout_logger_handle_t * logger_handle, const char * format, ...)
+{
+  rcutils_time_point_value_t now = 0;
+  EXPECT_EQ(RCUTILS_RET_OK, rcutils_system_time_now(&now));
+  rcutils_log_location_t location = {"test_function", "test_file", 42u};
+  va_list args;
+  va_start(args, format);
+  rcl_logging_rosout_output_handler_with_handle(
+    logger_handle, &location, RCUTILS_LOG_SEVERITY_INFO, now, format, &args);
+  va_end(args);
+}
+
+/* Testing publishing through a borrowed logger handle
+ */
+TEST_F(
+  CLASSNAME(TestLogRosoutFixtureGeneral, RMW_IMPLEMENTATION), test_logger_handle)
+{
+  const char * logger_name = rcl_node_get_logger_name(this->node_ptr);
+  rcl_logging_rosout_logger_handle_t * logger_handle = nullptr;
+
+  EXPECT_EQ(
+    RCL_RET_INVALID_ARGUMENT, rcl_logging_rosout_borrow_logger_handle(nullptr, &logger_handle));
+  rcl_reset_error();
+  EXPECT_EQ(
+    RCL_RET_INVALID_ARGUMENT, rcl_logging_rosout_borrow_logger_handle(logger_name, nullptr));
+  rcl_reset_error();
+  EXPECT_EQ(RCL_RET_INVALID_ARGUMENT, rcl_logging_rosout_return_logger_handle(nullptr));
+  rcl_reset_error();
+
+  // a handle for a logger without a rosout publisher is valid but publishes nothing
+  rcl_logging_rosout_logger_handle_t * unknown_logger_handle = nullptr;
+  ASSERT_EQ(
+    RCL_RET_OK, rcl_logging_rosout_borrow_logger_handle("no_exist", &unknown_logger_handle)) <<
+    rcl_get_error_string().str;
+  log_via_handle(unknown_logger_handle, "%s", "NOBODY_LISTENS");
+  EXPECT_EQ(RCL_RET_OK, rcl_logging_rosout_return_logger_handle(unknown_logger_handle));
+
+  ASSERT_EQ(
+    RCL_RET_OK, rcl_logging_rosout_borrow_logger_handle(logger_name, &logger_handle)) <<
+    rcl_get_error_string().str;
+
+  // messages published through the handle make it to the rosout subscription
+  rcl_wait_set_t wait_set = rcl_get_zero_initialized_wait_set();
+  rcl_ret_t ret = rcl_wait_set_init(
+    &wait_set, 1, 0, 0, 0, 0, 0, this->context_ptr, rcl_get_default_allocator());
+  ASSERT_EQ(RCL_RET_OK, ret) << rcl_get_error_string().str;
+  OSRF_TESTING_TOOLS_CPP_SCOPE_EXIT(
+  {
+    EXPECT_EQ(RCL_RET_OK, rcl_wait_set_fini(&wait_set)) << rcl_get_error_string().str;
+    EXPECT_EQ(RCL_RET_OK, rcl_logging_rosout_return_logger_handle(logger_handle));
+  });
+  bool success = false;
+  const char * message = "VIA_HANDLE";
+  for (size_t iteration = 0; iteration < 30 && !success; ++iteration) {
+    log_via_handle(logger_handle, "%s", message);
+    ret = rcl_wait_set_clear(&wait_set);
+    ASSERT_EQ(RCL_RET_OK, ret) << rcl_get_error_string().str;
+    ret = rcl_wait_set_add_subscription(&wait_set, this->subscription_ptr, NULL);
+    ASSERT_EQ(RCL_RET_OK, ret) << rcl_get_error_string().str;
+    ret = rcl_wait(&wait_set, RCL_MS_TO_NS(100));
+    if (ret == RCL_RET_TIMEOUT) {
+      continue;
+    }
+    ASSERT_EQ(RCL_RET_OK, ret) << rcl_get_error_string().str;
+    rcl_interfaces__msg__Log * log_message = rcl_interfaces__msg__Log__create();
+    OSRF_TESTING_TOOLS_CPP_SCOPE_EXIT(
+    {
+      rcl_interfaces__msg__Log__destroy(log_message);
+    });
+    ret = rcl_take(this->subscription_ptr, log_message, nullptr, nullptr);
+    if (RCL_RET_OK == ret && strcmp(message, log_message->msg.data) == 0) {
+      success = true;
+    }
+  }
+  EXPECT_TRUE(success);
+}
+
+/* Testing asynchronous rosout publishing with an explicit flush
+ */
+TEST_F(
+  CLASSNAME(TestLogRosoutFixtureGeneral, RMW_IMPLEMENTATION), test_async_publishing)
+{
+  const char * logger_name = rcl_node_get_logger_name(this->node_ptr);
+  size_t num_published = 0;
+
+  EXPECT_EQ(RCL_RET_INVALID_ARGUMENT, rcl_logging_rosout_enable_async_publishing(0));
+  rcl_reset_error();
+  EXPECT_EQ(RCL_RET_OK, rcl_logging_rosout_enable_async_publishing(2));
+  // enabling twice returns RCL_RET_OK
+  EXPECT_EQ(RCL_RET_OK, rcl_logging_rosout_enable_async_publishing(2));
+  EXPECT_EQ(0u, rcl_logging_rosout_get_num_dropped_messages());
+
+  // two records fit in the ring, the other three are dropped and counted
+  for (int i = 0; i < 5; ++i) {
+    RCUTILS_LOG_INFO_NAMED(logger_name, "async message %d", i);
+  }
+  EXPECT_EQ(3u, rcl_logging_rosout_get_num_dropped_messages());
+
+  EXPECT_EQ(RCL_RET_OK, rcl_logging_rosout_flush(1, &num_published));
+  EXPECT_EQ(1u, num_published);
+  EXPECT_EQ(RCL_RET_OK, rcl_logging_rosout_flush(0, &num_published));
+  EXPECT_EQ(1u, num_published);
+  EXPECT_EQ(RCL_RET_OK, rcl_logging_rosout_flush(0, &num_published));
+  EXPECT_EQ(0u, num_published);
+
+  EXPECT_EQ(RCL_RET_OK, rcl_logging_rosout_disable_async_publishing());
+  EXPECT_EQ(0u, rcl_logging_rosout_get_num_dropped_messages());
+  // disabling twice returns RCL_RET_OK
+  EXPECT_EQ(RCL_RET_OK, rcl_logging_rosout_disable_async_publishing());
+
+  // publishing is synchronous again
+  bool success = false;
+  check_if_rosout_subscription_gets_a_message(
+    logger_name, this->subscription_ptr, this->context_ptr, 30, 100, success);
+  EXPECT_TRUE(success);
+}
+
+/* Testing the drop-oldest policy of asynchronous rosout publishing
+ */
+TEST_F(
+  CLASSNAME(TestLogRosoutFixtureGeneral, RMW_IMPLEMENTATION), test_async_drop_oldest)
+{
+  const char * logger_name = rcl_node_get_logger_name(this->node_ptr);
+  size_t num_published = 0;
+
+  EXPECT_EQ(
+    RCL_RET_INVALID_ARGUMENT,
+    rcl_logging_rosout_enable_async_publishing_with_policy(
+      2, static_cast<rcl_logging_rosout_drop_policy_t>(42)));
+  rcl_reset_error();
+  EXPECT_EQ(
+    RCL_RET_OK,
+    rcl_logging_rosout_enable_async_publishing_with_policy(
+      2, RCL_LOGGING_ROSOUT_DROP_OLDEST));
+
+  // the ring always holds the two most recent records; three are discarded
+  for (int i = 0; i < 5; ++i) {
+    RCUTILS_LOG_INFO_NAMED(logger_name, "drop oldest message %d", i);
+  }
+  EXPECT_EQ(3u, rcl_logging_rosout_get_num_dropped_messages());
+
+  EXPECT_EQ(RCL_RET_OK, rcl_logging_rosout_flush(0, &num_published));
+  EXPECT_EQ(2u, num_published);
+
+  EXPECT_EQ(RCL_RET_OK, rcl_logging_rosout_disable_async_publishing());
+}
+
 /* Testing rosout message while adding and removing sublogger multiple times
  */
 TEST_F(
@@ -312,6 +312,43 @@ TEST_F(
   rcl_reset_error();
 }
 
+TEST_F(
+  CLASSNAME(
+    TestPublisherNetworkFlowEndpoints,
+    RMW_IMPLEMENTATION), test_publisher_cached_network_flow_endpoints) {
+  rcl_ret_t ret;
+
+  // Invalid arguments
+  const rcl_network_flow_endpoint_array_t * cached_view = nullptr;
+  ret = rcl_publisher_get_cached_network_flow_endpoints(nullptr, &cached_view);
+  EXPECT_EQ(RCL_RET_INVALID_ARGUMENT, ret);
+  rcl_reset_error();
+  ret = rcl_publisher_get_cached_network_flow_endpoints(&this->publisher_1, nullptr);
+  EXPECT_EQ(RCL_RET_INVALID_ARGUMENT, ret);
+  rcl_reset_error();
+  ret = rcl_publisher_refresh_network_flow_endpoints(nullptr);
+  EXPECT_EQ(RCL_RET_INVALID_ARGUMENT, ret);
+  rcl_reset_error();
+
+  // First read populates the cache, the second returns the same view
+  ret = rcl_publisher_get_cached_network_flow_endpoints(&this->publisher_1, &cached_view);
+  EXPECT_TRUE(ret == RCL_RET_OK || ret == RCL_RET_UNSUPPORTED);
+  if (ret == RCL_RET_OK) {
+    ASSERT_NE(nullptr, cached_view);
+    const rcl_network_flow_endpoint_array_t * cached_view_again = nullptr;
+    ret = rcl_publisher_get_cached_network_flow_endpoints(
+      &this->publisher_1, &cached_view_again);
+    EXPECT_EQ(RCL_RET_OK, ret) << rcl_get_error_string().str;
+    EXPECT_EQ(cached_view, cached_view_again);
+
+    // An explicit refresh re-queries the middleware
+    ret = rcl_publisher_refresh_network_flow_endpoints(&this->publisher_1);
+    EXPECT_EQ(RCL_RET_OK, ret) << rcl_get_error_string().str;
+  } else {
+    rcl_reset_error();
+  }
+}
+
 TEST_F(
   CLASSNAME(
     TestSubscriptionNetworkFlowEndpoints,
@@ -414,3 +451,101 @@ TEST_F(
   rcl_network_flow_endpoint_array_fini(&network_flow_endpoint_array_1);
   rcl_network_flow_endpoint_array_fini(&network_flow_endpoint_array_2);
 }
+
+TEST_F(
+  CLASSNAME(
+    TestSubscriptionNetworkFlowEndpoints,
+    RMW_IMPLEMENTATION), test_subscription_cached_network_flow_endpoints) {
+  rcl_ret_t ret;
+
+  // Invalid arguments
+  const rcl_network_flow_endpoint_array_t * cached_view = nullptr;
+  ret = rcl_subscription_get_cached_network_flow_endpoints(nullptr, &cached_view);
+  EXPECT_EQ(RCL_RET_INVALID_ARGUMENT, ret);
+  rcl_reset_error();
+  ret = rcl_subscription_get_cached_network_flow_endpoints(&this->subscription_1, nullptr);
+  EXPECT_EQ(RCL_RET_INVALID_ARGUMENT, ret);
+  rcl_reset_error();
+  ret = rcl_subscription_refresh_network_flow_endpoints(nullptr);
+  EXPECT_EQ(RCL_RET_INVALID_ARGUMENT, ret);
+  rcl_reset_error();
+
+  // First read populates the cache, the second returns the same view
+  ret = rcl_subscription_get_cached_network_flow_endpoints(&this->subscription_1, &cached_view);
+  EXPECT_TRUE(ret == RCL_RET_OK || ret == RCL_RET_UNSUPPORTED);
+  if (ret == RCL_RET_OK) {
+    ASSERT_NE(nullptr, cached_view);
+    const rcl_network_flow_endpoint_array_t * cached_view_again = nullptr;
+    ret = rcl_subscription_get_cached_network_flow_endpoints(
+      &this->subscription_1, &cached_view_again);
+    EXPECT_EQ(RCL_RET_OK, ret) << rcl_get_error_string().str;
+    EXPECT_EQ(cached_view, cached_view_again);
+
+    // An explicit refresh re-queries the middleware
+    ret = rcl_subscription_refresh_network_flow_endpoints(&this->subscription_1);
+    EXPECT_EQ(RCL_RET_OK, ret) << rcl_get_error_string().str;
+  } else {
+    rcl_reset_error();
+  }
+}
+
+TEST_F(
+  CLASSNAME(
+    TestPublisherNetworkFlowEndpoints,
+    RMW_IMPLEMENTATION), test_network_flow_endpoint_array_diff) {
+  rcl_allocator_t allocator = rcl_get_default_allocator();
+  rcl_network_flow_endpoint_array_t previous =
+    rcl_get_zero_initialized_network_flow_endpoint_array();
+  rcl_network_flow_endpoint_array_t current =
+    rcl_get_zero_initialized_network_flow_endpoint_array();
+  rcl_network_flow_endpoint_array_t added =
+    rcl_get_zero_initialized_network_flow_endpoint_array();
+  rcl_network_flow_endpoint_array_t removed =
+    rcl_get_zero_initialized_network_flow_endpoint_array();
+
+  // Invalid arguments
+  rcl_ret_t ret = rcl_network_flow_endpoint_array_diff(
+    nullptr, &current, &allocator, &added, &removed);
+  EXPECT_EQ(RCL_RET_INVALID_ARGUMENT, ret);
+  rcl_reset_error();
+  ret = rcl_network_flow_endpoint_array_diff(
+    &previous, &current, &allocator, nullptr, &removed);
+  EXPECT_EQ(RCL_RET_INVALID_ARGUMENT, ret);
+  rcl_reset_error();
+
+  // previous holds endpoints on ports 1 and 2, current on ports 2 and 3:
+  // port 3 was added and port 1 removed.
+  ASSERT_EQ(
+    RMW_RET_OK, rmw_network_flow_endpoint_array_init(&previous, 2, &allocator));
+  ASSERT_EQ(
+    RMW_RET_OK, rmw_network_flow_endpoint_array_init(&current, 2, &allocator));
+  previous.network_flow_endpoint[0].transport_port = 1;
+  previous.network_flow_endpoint[1].transport_port = 2;
+  current.network_flow_endpoint[0].transport_port = 2;
+  current.network_flow_endpoint[1].transport_port = 3;
+
+  ret = rcl_network_flow_endpoint_array_diff(
+    &previous, &current, &allocator, &added, &removed);
+  EXPECT_EQ(RCL_RET_OK, ret) << rcl_get_error_string().str;
+  ASSERT_EQ(1u, added.size);
+  EXPECT_EQ(3u, added.network_flow_endpoint[0].transport_port);
+  ASSERT_EQ(1u, removed.size);
+  EXPECT_EQ(1u, removed.network_flow_endpoint[0].transport_port);
+
+  EXPECT_EQ(RMW_RET_OK, rcl_network_flow_endpoint_array_fini(&added));
+  EXPECT_EQ(RMW_RET_OK, rcl_network_flow_endpoint_array_fini(&removed));
+
+  // Identical arrays produce empty, still fini-able outputs
+  added = rcl_get_zero_initialized_network_flow_endpoint_array();
+  removed = rcl_get_zero_initialized_network_flow_endpoint_array();
+  ret = rcl_network_flow_endpoint_array_diff(
+    &previous, &previous, &allocator, &added, &removed);
+  EXPECT_EQ(RCL_RET_OK, ret) << rcl_get_error_string().str;
+  EXPECT_EQ(0u, added.size);
+  EXPECT_EQ(0u, removed.size);
+  EXPECT_EQ(RMW_RET_OK, rcl_network_flow_endpoint_array_fini(&added));
+  EXPECT_EQ(RMW_RET_OK, rcl_network_flow_endpoint_array_fini(&removed));
+
+  EXPECT_EQ(RMW_RET_OK, rcl_network_flow_endpoint_array_fini(&previous));
+  EXPECT_EQ(RMW_RET_OK, rcl_network_flow_endpoint_array_fini(&current));
+}
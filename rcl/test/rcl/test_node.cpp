@@ -342,14 +342,20 @@ TEST_F(CLASSNAME(TestNodeFixture, RMW_IMPLEMENTATION), test_rcl_node_accessors)
   graph_guard_condition = rcl_node_get_graph_guard_condition(&zero_node);
   EXPECT_EQ(nullptr, graph_guard_condition);
   rcl_reset_error();
+  // The guard condition is created on first use, which is not possible anymore
+  // after the node's context has been shut down.
   graph_guard_condition = rcl_node_get_graph_guard_condition(&invalid_node);
-  EXPECT_NE(nullptr, graph_guard_condition);
+  EXPECT_EQ(nullptr, graph_guard_condition);
   rcl_reset_error();
+  // The first call creates the guard condition, further calls just return it.
+  graph_guard_condition = rcl_node_get_graph_guard_condition(&node);
+  EXPECT_NE(nullptr, graph_guard_condition);
+  const rcl_guard_condition_t * second_graph_guard_condition = nullptr;
   EXPECT_NO_MEMORY_OPERATIONS(
   {
-    graph_guard_condition = rcl_node_get_graph_guard_condition(&node);
+    second_graph_guard_condition = rcl_node_get_graph_guard_condition(&node);
   });
-  EXPECT_NE(nullptr, graph_guard_condition);
+  EXPECT_EQ(graph_guard_condition, second_graph_guard_condition);
 }
 
 /* Tests the node life cycle, including rcl_node_init() and rcl_node_fini().
@@ -500,11 +506,15 @@ TEST_F(CLASSNAME(TestNodeFixture, RMW_IMPLEMENTATION), test_rcl_node_init_with_i
   }
 
   {
+    // The graph guard condition is created on first use, so an internal error
+    // getting it surfaces in rcl_node_get_graph_guard_condition(), not init.
     auto mock = mocking_utils::patch_and_return(
       "lib:rcl", rmw_node_get_graph_guard_condition, nullptr);
     ret = rcl_node_init(&node, name, namespace_, &context, &options);
-    EXPECT_EQ(RCL_RET_ERROR, ret);
+    EXPECT_EQ(RCL_RET_OK, ret);
+    EXPECT_EQ(nullptr, rcl_node_get_graph_guard_condition(&node));
     rcl_reset_error();
+    EXPECT_EQ(RCL_RET_OK, rcl_node_fini(&node)) << rcl_get_error_string().str;
   }
 
   {
@@ -1017,6 +1027,56 @@ TEST_F(CLASSNAME(TestNodeFixture, RMW_IMPLEMENTATION), test_rcl_node_resolve_nam
   ASSERT_TRUE(final_name);
   EXPECT_STREQ("/ns/relative_ns/foo", final_name);
   default_allocator.deallocate(final_name, default_allocator.state);
+
+  EXPECT_EQ(
+    RCL_RET_OK,
+    rcl_node_resolve_name(&node, "~/private_topic", default_allocator, false, false, &final_name));
+  ASSERT_TRUE(final_name);
+  EXPECT_STREQ("/ns/node/private_topic", final_name);
+  default_allocator.deallocate(final_name, default_allocator.state);
+
+  // Substitution tokens take the generic expansion path.
+  EXPECT_EQ(
+    RCL_RET_OK,
+    rcl_node_resolve_name(&node, "{ns}/token_topic", default_allocator, false, false, &final_name));
+  ASSERT_TRUE(final_name);
+  EXPECT_STREQ("/ns/token_topic", final_name);
+  default_allocator.deallocate(final_name, default_allocator.state);
+
+  EXPECT_EQ(
+    RCL_RET_TOPIC_NAME_INVALID,
+    rcl_node_resolve_name(&node, "invalid name", default_allocator, false, false, &final_name));
+  rcl_reset_error();
+
+  // Repeat resolutions are served from the node's resolved name cache; the
+  // result must be identical and remain owned by the caller.
+  for (int i = 0; i < 3; ++i) {
+    EXPECT_EQ(
+      RCL_RET_OK,
+      rcl_node_resolve_name(&node, "/bar/foo", default_allocator, false, false, &final_name));
+    ASSERT_TRUE(final_name);
+    EXPECT_STREQ("/foo/local_args", final_name);
+    default_allocator.deallocate(final_name, default_allocator.state);
+  }
+
+  // Resolve more distinct names than the cache retains, then check a name
+  // that was evicted still resolves correctly through the slow path.
+  for (int i = 0; i < 20; ++i) {
+    std::string topic = "churn_topic_" + std::to_string(i);
+    std::string expected = "/ns/" + topic;
+    EXPECT_EQ(
+      RCL_RET_OK,
+      rcl_node_resolve_name(&node, topic.c_str(), default_allocator, false, false, &final_name));
+    ASSERT_TRUE(final_name);
+    EXPECT_STREQ(expected.c_str(), final_name);
+    default_allocator.deallocate(final_name, default_allocator.state);
+  }
+  EXPECT_EQ(
+    RCL_RET_OK,
+    rcl_node_resolve_name(&node, "churn_topic_0", default_allocator, false, false, &final_name));
+  ASSERT_TRUE(final_name);
+  EXPECT_STREQ("/ns/churn_topic_0", final_name);
+  default_allocator.deallocate(final_name, default_allocator.state);
 }
 
 /* Tests special case node_options
@@ -1063,3 +1123,134 @@ TEST_F(CLASSNAME(TestNodeFixture, RMW_IMPLEMENTATION), test_rcl_get_disable_loan
     EXPECT_FALSE(disable_loaned_message);
   }
 }
+
+/* Tests initializing several nodes at once with rcl_node_init_batch().
+ */
+TEST_F(CLASSNAME(TestNodeFixture, RMW_IMPLEMENTATION), test_rcl_node_init_batch) {
+  rcl_ret_t ret;
+  // Initialize rcl with rcl_init().
+  rcl_init_options_t init_options = rcl_get_zero_initialized_init_options();
+  ret = rcl_init_options_init(&init_options, rcl_get_default_allocator());
+  ASSERT_EQ(RCL_RET_OK, ret) << rcl_get_error_string().str;
+  OSRF_TESTING_TOOLS_CPP_SCOPE_EXIT(
+  {
+    EXPECT_EQ(RCL_RET_OK, rcl_init_options_fini(&init_options)) << rcl_get_error_string().str;
+  });
+  rcl_context_t context = rcl_get_zero_initialized_context();
+  ret = rcl_init(0, nullptr, &init_options, &context);
+  ASSERT_EQ(RCL_RET_OK, ret) << rcl_get_error_string().str;
+  OSRF_TESTING_TOOLS_CPP_SCOPE_EXIT(
+  {
+    ASSERT_EQ(RCL_RET_OK, rcl_shutdown(&context));
+    ASSERT_EQ(RCL_RET_OK, rcl_context_fini(&context));
+  });
+  rcl_node_options_t default_options = rcl_node_get_default_options();
+  rcl_node_t first_node = rcl_get_zero_initialized_node();
+  rcl_node_t second_node = rcl_get_zero_initialized_node();
+  rcl_node_t third_node = rcl_get_zero_initialized_node();
+  rcl_node_t * nodes[] = {&first_node, &second_node, &third_node};
+  const char * names[] = {"first_node", "second_node", "third_node"};
+  const char * namespaces[] = {"/ns", "/ns", "/other_ns"};
+  // Invalid arguments.
+  ret = rcl_node_init_batch(nullptr, names, namespaces, 3u, &context, &default_options);
+  EXPECT_EQ(RCL_RET_INVALID_ARGUMENT, ret);
+  rcl_reset_error();
+  ret = rcl_node_init_batch(nodes, nullptr, namespaces, 3u, &context, &default_options);
+  EXPECT_EQ(RCL_RET_INVALID_ARGUMENT, ret);
+  rcl_reset_error();
+  ret = rcl_node_init_batch(nodes, names, nullptr, 3u, &context, &default_options);
+  EXPECT_EQ(RCL_RET_INVALID_ARGUMENT, ret);
+  rcl_reset_error();
+  ret = rcl_node_init_batch(nodes, names, namespaces, 3u, nullptr, &default_options);
+  EXPECT_EQ(RCL_RET_INVALID_ARGUMENT, ret);
+  rcl_reset_error();
+  ret = rcl_node_init_batch(nodes, names, namespaces, 3u, &context, nullptr);
+  EXPECT_EQ(RCL_RET_INVALID_ARGUMENT, ret);
+  rcl_reset_error();
+  // Zero nodes is ok and does nothing.
+  ret = rcl_node_init_batch(nodes, names, namespaces, 0u, &context, &default_options);
+  EXPECT_EQ(RCL_RET_OK, ret) << rcl_get_error_string().str;
+  EXPECT_FALSE(rcl_node_is_valid(&first_node));
+  rcl_reset_error();
+  // A failing node rolls back the nodes initialized before it.
+  const char * bad_names[] = {"first_node", "second node", "third_node"};
+  ret = rcl_node_init_batch(nodes, bad_names, namespaces, 3u, &context, &default_options);
+  EXPECT_EQ(RCL_RET_NODE_INVALID_NAME, ret);
+  rcl_reset_error();
+  EXPECT_FALSE(rcl_node_is_valid(&first_node));
+  rcl_reset_error();
+  EXPECT_FALSE(rcl_node_is_valid(&third_node));
+  rcl_reset_error();
+  // Initialize all three nodes at once.
+  ret = rcl_node_init_batch(nodes, names, namespaces, 3u, &context, &default_options);
+  ASSERT_EQ(RCL_RET_OK, ret) << rcl_get_error_string().str;
+  OSRF_TESTING_TOOLS_CPP_SCOPE_EXIT(
+  {
+    for (rcl_node_t * node : nodes) {
+      EXPECT_EQ(RCL_RET_OK, rcl_node_fini(node)) << rcl_get_error_string().str;
+    }
+  });
+  EXPECT_TRUE(rcl_node_is_valid(&first_node));
+  EXPECT_TRUE(rcl_node_is_valid(&second_node));
+  EXPECT_TRUE(rcl_node_is_valid(&third_node));
+  EXPECT_STREQ("/ns/first_node", rcl_node_get_fully_qualified_name(&first_node));
+  EXPECT_STREQ("/ns/second_node", rcl_node_get_fully_qualified_name(&second_node));
+  EXPECT_STREQ("/other_ns/third_node", rcl_node_get_fully_qualified_name(&third_node));
+  EXPECT_STREQ("ns.first_node", rcl_node_get_logger_name(&first_node));
+  EXPECT_STREQ("other_ns.third_node", rcl_node_get_logger_name(&third_node));
+}
+
+/* Tests finalizing several nodes at once with rcl_node_fini_batch().
+ */
+TEST_F(CLASSNAME(TestNodeFixture, RMW_IMPLEMENTATION), test_rcl_node_fini_batch) {
+  rcl_ret_t ret;
+  // Initialize rcl with rcl_init().
+  rcl_init_options_t init_options = rcl_get_zero_initialized_init_options();
+  ret = rcl_init_options_init(&init_options, rcl_get_default_allocator());
+  ASSERT_EQ(RCL_RET_OK, ret) << rcl_get_error_string().str;
+  OSRF_TESTING_TOOLS_CPP_SCOPE_EXIT(
+  {
+    EXPECT_EQ(RCL_RET_OK, rcl_init_options_fini(&init_options)) << rcl_get_error_string().str;
+  });
+  rcl_context_t context = rcl_get_zero_initialized_context();
+  ret = rcl_init(0, nullptr, &init_options, &context);
+  ASSERT_EQ(RCL_RET_OK, ret) << rcl_get_error_string().str;
+  OSRF_TESTING_TOOLS_CPP_SCOPE_EXIT(
+  {
+    ASSERT_EQ(RCL_RET_OK, rcl_shutdown(&context));
+    ASSERT_EQ(RCL_RET_OK, rcl_context_fini(&context));
+  });
+  rcl_node_options_t default_options = rcl_node_get_default_options();
+  rcl_node_t first_node = rcl_get_zero_initialized_node();
+  rcl_node_t second_node = rcl_get_zero_initialized_node();
+  rcl_node_t third_node = rcl_get_zero_initialized_node();
+  rcl_node_t * nodes[] = {&first_node, &second_node, &third_node};
+  const char * names[] = {"first_node", "second_node", "third_node"};
+  const char * namespaces[] = {"/ns", "/ns", "/other_ns"};
+  // Invalid arguments.
+  ret = rcl_node_fini_batch(nullptr, 3u);
+  EXPECT_EQ(RCL_RET_INVALID_ARGUMENT, ret);
+  rcl_reset_error();
+  // Zero nodes is ok and does nothing.
+  ret = rcl_node_fini_batch(nodes, 0u);
+  EXPECT_EQ(RCL_RET_OK, ret) << rcl_get_error_string().str;
+  // Zero initialized nodes are skipped, like repeated rcl_node_fini() calls.
+  ret = rcl_node_fini_batch(nodes, 3u);
+  EXPECT_EQ(RCL_RET_OK, ret) << rcl_get_error_string().str;
+  // Finalize an initialized batch in one call.
+  ret = rcl_node_init_batch(nodes, names, namespaces, 3u, &context, &default_options);
+  ASSERT_EQ(RCL_RET_OK, ret) << rcl_get_error_string().str;
+  EXPECT_TRUE(rcl_node_is_valid(&first_node));
+  EXPECT_TRUE(rcl_node_is_valid(&third_node));
+  ret = rcl_node_fini_batch(nodes, 3u);
+  EXPECT_EQ(RCL_RET_OK, ret) << rcl_get_error_string().str;
+  EXPECT_FALSE(rcl_node_is_valid(&first_node));
+  rcl_reset_error();
+  EXPECT_FALSE(rcl_node_is_valid(&second_node));
+  rcl_reset_error();
+  EXPECT_FALSE(rcl_node_is_valid(&third_node));
+  rcl_reset_error();
+  // Finalizing again is ok.
+  ret = rcl_node_fini_batch(nodes, 3u);
+  EXPECT_EQ(RCL_RET_OK, ret) << rcl_get_error_string().str;
+}
@@ -0,0 +1,132 @@
+// Copyright 2026 Open Source Robotics Foundation, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <gtest/gtest.h>
+
+#include "rcl/arguments.h"
+#include "rcl/error_handling.h"
+#include "rcl/param_mirror.h"
+
+#include "rcl_yaml_param_parser/parser.h"
+
+#include "osrf_testing_tools_cpp/scope_exit.hpp"
+
+#ifdef RMW_IMPLEMENTATION
+# define CLASSNAME_(NAME, SUFFIX) NAME ## __ ## SUFFIX
+# define CLASSNAME(NAME, SUFFIX) CLASSNAME_(NAME, SUFFIX)
+#else
+# define CLASSNAME(NAME, SUFFIX) NAME
+#endif
+
+class CLASSNAME (TestParamMirrorFixture, RMW_IMPLEMENTATION) : public ::testing::Test {};
+
+#ifndef _WIN32
+
+/* Publish parameters into a mirror segment and read them back.
+ */
+TEST_F(CLASSNAME(TestParamMirrorFixture, RMW_IMPLEMENTATION), test_param_mirror_round_trip) {
+  rcl_allocator_t alloc = rcl_get_default_allocator();
+  const char * argv[] = {
+    "process_name", "--ros-args",
+    "-p", "mirror_node:answer:=42",
+    "-p", "mirror_node:rate:=2.5",
+    "-p", "mirror_node:greeting:=hello",
+    "-p", "mirror_node:flag:=true",
+  };
+  int argc = sizeof(argv) / sizeof(const char *);
+  rcl_arguments_t parsed_args = rcl_get_zero_initialized_arguments();
+  rcl_ret_t ret = rcl_parse_arguments(argc, argv, alloc, &parsed_args);
+  ASSERT_EQ(RCL_RET_OK, ret) << rcl_get_error_string().str;
+  OSRF_TESTING_TOOLS_CPP_SCOPE_EXIT(
+  {
+    EXPECT_EQ(RCL_RET_OK, rcl_arguments_fini(&parsed_args));
+  });
+  rcl_params_t * params = NULL;
+  ret = rcl_arguments_get_param_overrides(&parsed_args, &params);
+  ASSERT_EQ(RCL_RET_OK, ret) << rcl_get_error_string().str;
+  OSRF_TESTING_TOOLS_CPP_SCOPE_EXIT(
+  {
+    rcl_yaml_node_struct_fini(params);
+  });
+  ASSERT_EQ(1u, params->num_nodes);
+
+  constexpr char segment_name[] = "/rcl_test_param_mirror";
+  rcl_param_mirror_t mirror = rcl_get_zero_initialized_param_mirror();
+  rcl_param_mirror_value_t value;
+
+  // invalid arguments
+  EXPECT_EQ(
+    RCL_RET_INVALID_ARGUMENT,
+    rcl_param_mirror_init(&mirror, "missing_slash", params, alloc));
+  rcl_reset_error();
+  EXPECT_EQ(RCL_RET_NOT_INIT, rcl_param_mirror_update(&mirror, params));
+  rcl_reset_error();
+
+  ASSERT_EQ(RCL_RET_OK, rcl_param_mirror_init(&mirror, segment_name, params, alloc)) <<
+    rcl_get_error_string().str;
+  OSRF_TESTING_TOOLS_CPP_SCOPE_EXIT(
+  {
+    EXPECT_EQ(RCL_RET_OK, rcl_param_mirror_fini(&mirror)) << rcl_get_error_string().str;
+  });
+  EXPECT_EQ(
+    RCL_RET_ALREADY_INIT, rcl_param_mirror_init(&mirror, segment_name, params, alloc));
+  rcl_reset_error();
+
+  rcl_param_mirror_reader_t reader = rcl_get_zero_initialized_param_mirror_reader();
+  EXPECT_EQ(
+    RCL_RET_ERROR,
+    rcl_param_mirror_reader_open(&reader, "/rcl_test_param_mirror_absent", alloc));
+  rcl_reset_error();
+  ASSERT_EQ(RCL_RET_OK, rcl_param_mirror_reader_open(&reader, segment_name, alloc)) <<
+    rcl_get_error_string().str;
+  OSRF_TESTING_TOOLS_CPP_SCOPE_EXIT(
+  {
+    EXPECT_EQ(RCL_RET_OK, rcl_param_mirror_reader_close(&reader)) << rcl_get_error_string().str;
+  });
+
+  // every mirrored type reads back consistently
+  ASSERT_EQ(RCL_RET_OK, rcl_param_mirror_reader_read(&reader, "mirror_node", "answer", &value)) <<
+    rcl_get_error_string().str;
+  EXPECT_EQ(RCL_PARAM_MIRROR_TYPE_INTEGER, value.type);
+  EXPECT_EQ(42, value.integer_value);
+  ASSERT_EQ(RCL_RET_OK, rcl_param_mirror_reader_read(&reader, "mirror_node", "rate", &value));
+  EXPECT_EQ(RCL_PARAM_MIRROR_TYPE_DOUBLE, value.type);
+  EXPECT_DOUBLE_EQ(2.5, value.double_value);
+  ASSERT_EQ(RCL_RET_OK, rcl_param_mirror_reader_read(&reader, "mirror_node", "greeting", &value));
+  EXPECT_EQ(RCL_PARAM_MIRROR_TYPE_STRING, value.type);
+  EXPECT_STREQ("hello", value.string_value);
+  ASSERT_EQ(RCL_RET_OK, rcl_param_mirror_reader_read(&reader, "mirror_node", "flag", &value));
+  EXPECT_EQ(RCL_PARAM_MIRROR_TYPE_BOOL, value.type);
+  EXPECT_TRUE(value.bool_value);
+
+  // unknown parameters are reported, not retried forever
+  EXPECT_EQ(
+    RCL_RET_ERROR, rcl_param_mirror_reader_read(&reader, "mirror_node", "no_such", &value));
+  rcl_reset_error();
+  EXPECT_EQ(
+    RCL_RET_ERROR, rcl_param_mirror_reader_read(&reader, "other_node", "answer", &value));
+  rcl_reset_error();
+
+  // a value refresh is visible through the existing mapping
+  rcl_variant_t * answer = rcl_yaml_node_struct_get("mirror_node", "answer", params);
+  ASSERT_NE(nullptr, answer);
+  ASSERT_NE(nullptr, answer->integer_value);
+  *answer->integer_value = 43;
+  ASSERT_EQ(RCL_RET_OK, rcl_param_mirror_update(&mirror, params)) << rcl_get_error_string().str;
+  ASSERT_EQ(RCL_RET_OK, rcl_param_mirror_reader_read(&reader, "mirror_node", "answer", &value));
+  EXPECT_EQ(RCL_PARAM_MIRROR_TYPE_INTEGER, value.type);
+  EXPECT_EQ(43, value.integer_value);
+}
+
+#endif  // _WIN32
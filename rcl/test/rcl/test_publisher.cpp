@@ -24,8 +24,13 @@
 #include "mimick/mimick.h"
 #include "osrf_testing_tools_cpp/scope_exit.hpp"
 #include "rcl/error_handling.h"
+#include "rcl/hop_latency.h"
 #include "rcl/node.h"
+#include "rcl/serialized_message.h"
+#include "rcl/wait.h"
 #include "rcutils/env.h"
+#include "rcutils/time.h"
+#include "rmw/rmw.h"
 #include "rmw/validate_full_topic_name.h"
 #include "rmw/validate_node_name.h"
 
@@ -136,6 +141,96 @@ TEST_F(CLASSNAME(TestPublisherFixture, RMW_IMPLEMENTATION), test_publisher_nomin
   ASSERT_EQ(RCL_RET_OK, ret) << rcl_get_error_string().str;
 }
 
+/* Basic nominal test of batch publishing.
+ */
+TEST_F(CLASSNAME(TestPublisherFixture, RMW_IMPLEMENTATION), test_publisher_batch) {
+  rcl_ret_t ret;
+  rcl_publisher_t publisher = rcl_get_zero_initialized_publisher();
+  const rosidl_message_type_support_t * ts =
+    ROSIDL_GET_MSG_TYPE_SUPPORT(test_msgs, msg, BasicTypes);
+  constexpr char topic_name[] = "chatter";
+  rcl_publisher_options_t publisher_options = rcl_publisher_get_default_options();
+  ret = rcl_publisher_init(&publisher, this->node_ptr, ts, topic_name, &publisher_options);
+  ASSERT_EQ(RCL_RET_OK, ret) << rcl_get_error_string().str;
+  OSRF_TESTING_TOOLS_CPP_SCOPE_EXIT(
+  {
+    rcl_ret_t ret = rcl_publisher_fini(&publisher, this->node_ptr);
+    EXPECT_EQ(RCL_RET_OK, ret) << rcl_get_error_string().str;
+  });
+  test_msgs__msg__BasicTypes msgs[3];
+  const void * msg_ptrs[3];
+  for (size_t i = 0; i < 3; ++i) {
+    test_msgs__msg__BasicTypes__init(&msgs[i]);
+    msgs[i].int64_value = static_cast<int64_t>(i);
+    msg_ptrs[i] = &msgs[i];
+  }
+  size_t num_published = 0;
+  ret = rcl_publish_batch(&publisher, msg_ptrs, 3, nullptr, &num_published);
+  EXPECT_EQ(RCL_RET_OK, ret) << rcl_get_error_string().str;
+  EXPECT_EQ(3u, num_published);
+  // an empty batch is a no-op
+  EXPECT_EQ(RCL_RET_OK, rcl_publish_batch(&publisher, msg_ptrs, 0, nullptr, &num_published));
+  EXPECT_EQ(0u, num_published);
+  // bad arguments
+  EXPECT_EQ(
+    RCL_RET_INVALID_ARGUMENT, rcl_publish_batch(&publisher, nullptr, 3, nullptr, nullptr));
+  rcl_reset_error();
+  msg_ptrs[1] = nullptr;
+  EXPECT_EQ(
+    RCL_RET_INVALID_ARGUMENT,
+    rcl_publish_batch(&publisher, msg_ptrs, 3, nullptr, &num_published));
+  // the first message went out before the null was found
+  EXPECT_EQ(1u, num_published);
+  rcl_reset_error();
+  EXPECT_EQ(
+    RCL_RET_PUBLISHER_INVALID, rcl_publish_batch(nullptr, msg_ptrs, 3, nullptr, nullptr));
+  rcl_reset_error();
+  for (size_t i = 0; i < 3; ++i) {
+    test_msgs__msg__BasicTypes__fini(&msgs[i]);
+  }
+}
+
+/* Test sealing a publisher and publishing through the sealed fast path.
+ */
+TEST_F(CLASSNAME(TestPublisherFixture, RMW_IMPLEMENTATION), test_publisher_seal) {
+  rcl_ret_t ret;
+  rcl_publisher_t publisher = rcl_get_zero_initialized_publisher();
+  const rosidl_message_type_support_t * ts =
+    ROSIDL_GET_MSG_TYPE_SUPPORT(test_msgs, msg, BasicTypes);
+  constexpr char topic_name[] = "chatter";
+  rcl_publisher_options_t publisher_options = rcl_publisher_get_default_options();
+  ret = rcl_publisher_init(&publisher, this->node_ptr, ts, topic_name, &publisher_options);
+  ASSERT_EQ(RCL_RET_OK, ret) << rcl_get_error_string().str;
+  OSRF_TESTING_TOOLS_CPP_SCOPE_EXIT(
+  {
+    rcl_ret_t ret = rcl_publisher_fini(&publisher, this->node_ptr);
+    EXPECT_EQ(RCL_RET_OK, ret) << rcl_get_error_string().str;
+  });
+
+  EXPECT_EQ(RCL_RET_PUBLISHER_INVALID, rcl_publisher_seal(nullptr));
+  rcl_reset_error();
+  EXPECT_FALSE(rcl_publisher_is_sealed(nullptr));
+  EXPECT_FALSE(rcl_publisher_is_sealed(&publisher));
+
+  EXPECT_EQ(RCL_RET_OK, rcl_publisher_seal(&publisher)) << rcl_get_error_string().str;
+  EXPECT_TRUE(rcl_publisher_is_sealed(&publisher));
+
+  test_msgs__msg__BasicTypes msg;
+  test_msgs__msg__BasicTypes__init(&msg);
+  msg.int64_value = 42;
+  ret = rcl_publish(&publisher, &msg, nullptr);
+  test_msgs__msg__BasicTypes__fini(&msg);
+  EXPECT_EQ(RCL_RET_OK, ret) << rcl_get_error_string().str;
+
+  // fini refuses while sealed
+  EXPECT_EQ(RCL_RET_ERROR, rcl_publisher_fini(&publisher, this->node_ptr));
+  rcl_reset_error();
+  EXPECT_EQ(RCL_RET_OK, rcl_publisher_unseal(&publisher)) << rcl_get_error_string().str;
+  EXPECT_FALSE(rcl_publisher_is_sealed(&publisher));
+  // unsealing twice is a no-op
+  EXPECT_EQ(RCL_RET_OK, rcl_publisher_unseal(&publisher)) << rcl_get_error_string().str;
+}
+
 /* Basic nominal test of a publisher with a string.
  */
 TEST_F(CLASSNAME(TestPublisherFixture, RMW_IMPLEMENTATION), test_publisher_nominal_string) {
@@ -372,6 +467,487 @@ TEST_F(CLASSNAME(TestPublisherFixture, RMW_IMPLEMENTATION), test_publisher_loan)
   }
 }
 
+/* Test stamping messages from the publisher's clock on publish.
+ */
+TEST_F(CLASSNAME(TestPublisherFixture, RMW_IMPLEMENTATION), test_publisher_stamp_on_publish) {
+  rcl_publisher_t publisher = rcl_get_zero_initialized_publisher();
+  const rosidl_message_type_support_t * ts =
+    ROSIDL_GET_MSG_TYPE_SUPPORT(test_msgs, msg, BasicTypes);
+  constexpr char topic_name[] = "chatter";
+  rcl_publisher_options_t publisher_options = rcl_publisher_get_default_options();
+  rcl_ret_t ret =
+    rcl_publisher_init(&publisher, this->node_ptr, ts, topic_name, &publisher_options);
+  ASSERT_EQ(RCL_RET_OK, ret) << rcl_get_error_string().str;
+  OSRF_TESTING_TOOLS_CPP_SCOPE_EXIT(
+  {
+    rcl_ret_t ret = rcl_publisher_fini(&publisher, this->node_ptr);
+    EXPECT_EQ(RCL_RET_OK, ret) << rcl_get_error_string().str;
+  });
+
+  rcl_clock_t clock;
+  rcl_allocator_t allocator = rcl_get_default_allocator();
+  ASSERT_EQ(RCL_RET_OK, rcl_steady_clock_init(&clock, &allocator)) << rcl_get_error_string().str;
+  OSRF_TESTING_TOOLS_CPP_SCOPE_EXIT(
+  {
+    EXPECT_EQ(RCL_RET_OK, rcl_steady_clock_fini(&clock)) << rcl_get_error_string().str;
+  });
+
+  EXPECT_EQ(
+    RCL_RET_INVALID_ARGUMENT, rcl_publisher_set_stamp_on_publish(&publisher, nullptr, 0));
+  rcl_reset_error();
+
+  // BasicTypes has no header; int32_value followed by uint32_value matches
+  // the sec/nanosec layout the stamping writes.
+  ASSERT_EQ(
+    RCL_RET_OK,
+    rcl_publisher_set_stamp_on_publish(
+      &publisher, &clock, offsetof(test_msgs__msg__BasicTypes, int32_value))) <<
+    rcl_get_error_string().str;
+
+  test_msgs__msg__BasicTypes msg;
+  test_msgs__msg__BasicTypes__init(&msg);
+  msg.int32_value = 0;
+  msg.uint32_value = 0;
+  EXPECT_EQ(RCL_RET_OK, rcl_publish(&publisher, &msg, nullptr)) << rcl_get_error_string().str;
+  // the steady clock is well past zero seconds
+  EXPECT_GT(msg.int32_value, 0);
+  test_msgs__msg__BasicTypes__fini(&msg);
+
+  EXPECT_EQ(RCL_RET_OK, rcl_publisher_clear_stamp_on_publish(&publisher)) <<
+    rcl_get_error_string().str;
+}
+
+/* Test enabling and publishing through concurrent sessions.
+ */
+TEST_F(CLASSNAME(TestPublisherFixture, RMW_IMPLEMENTATION), test_publisher_concurrent_sessions) {
+  rcl_publisher_t publisher = rcl_get_zero_initialized_publisher();
+  const rosidl_message_type_support_t * ts =
+    ROSIDL_GET_MSG_TYPE_SUPPORT(test_msgs, msg, BasicTypes);
+  constexpr char topic_name[] = "chatter";
+  rcl_publisher_options_t publisher_options = rcl_publisher_get_default_options();
+  rcl_ret_t ret =
+    rcl_publisher_init(&publisher, this->node_ptr, ts, topic_name, &publisher_options);
+  ASSERT_EQ(RCL_RET_OK, ret) << rcl_get_error_string().str;
+  OSRF_TESTING_TOOLS_CPP_SCOPE_EXIT(
+  {
+    rcl_ret_t ret = rcl_publisher_fini(&publisher, this->node_ptr);
+    EXPECT_EQ(RCL_RET_OK, ret) << rcl_get_error_string().str;
+  });
+
+  EXPECT_EQ(
+    RCL_RET_INVALID_ARGUMENT,
+    rcl_publisher_enable_concurrent_publishing(&publisher, this->node_ptr, 1));
+  rcl_reset_error();
+  ASSERT_EQ(
+    RCL_RET_OK,
+    rcl_publisher_enable_concurrent_publishing(&publisher, this->node_ptr, 3)) <<
+    rcl_get_error_string().str;
+  EXPECT_EQ(
+    RCL_RET_ALREADY_INIT,
+    rcl_publisher_enable_concurrent_publishing(&publisher, this->node_ptr, 3));
+  rcl_reset_error();
+
+  test_msgs__msg__BasicTypes msg;
+  test_msgs__msg__BasicTypes__init(&msg);
+  msg.int64_value = 42;
+  // this thread publishes through whichever session it is routed to
+  EXPECT_EQ(RCL_RET_OK, rcl_publish(&publisher, &msg, nullptr)) << rcl_get_error_string().str;
+  EXPECT_EQ(RCL_RET_OK, rcl_publish(&publisher, &msg, nullptr)) << rcl_get_error_string().str;
+  test_msgs__msg__BasicTypes__fini(&msg);
+
+  EXPECT_EQ(
+    RCL_RET_OK,
+    rcl_publisher_disable_concurrent_publishing(&publisher, this->node_ptr)) <<
+    rcl_get_error_string().str;
+  // disabling twice is a no-op
+  EXPECT_EQ(
+    RCL_RET_OK,
+    rcl_publisher_disable_concurrent_publishing(&publisher, this->node_ptr)) <<
+    rcl_get_error_string().str;
+}
+
+/* Test initializing a publisher from an already resolved topic name.
+ */
+TEST_F(CLASSNAME(TestPublisherFixture, RMW_IMPLEMENTATION), test_publisher_init_resolved_name) {
+  rcl_publisher_t publisher = rcl_get_zero_initialized_publisher();
+  const rosidl_message_type_support_t * ts =
+    ROSIDL_GET_MSG_TYPE_SUPPORT(test_msgs, msg, BasicTypes);
+  rcl_publisher_options_t publisher_options = rcl_publisher_get_default_options();
+
+  // a non-fully-qualified name is rejected without touching rmw
+  EXPECT_EQ(
+    RCL_RET_TOPIC_NAME_INVALID,
+    rcl_publisher_init_with_resolved_name(
+      &publisher, this->node_ptr, ts, "chatter", &publisher_options));
+  rcl_reset_error();
+
+  rcl_ret_t ret = rcl_publisher_init_with_resolved_name(
+    &publisher, this->node_ptr, ts, "/chatter", &publisher_options);
+  ASSERT_EQ(RCL_RET_OK, ret) << rcl_get_error_string().str;
+  OSRF_TESTING_TOOLS_CPP_SCOPE_EXIT(
+  {
+    rcl_ret_t ret = rcl_publisher_fini(&publisher, this->node_ptr);
+    EXPECT_EQ(RCL_RET_OK, ret) << rcl_get_error_string().str;
+  });
+  EXPECT_STREQ("/chatter", rcl_publisher_get_topic_name(&publisher));
+
+  test_msgs__msg__BasicTypes msg;
+  test_msgs__msg__BasicTypes__init(&msg);
+  msg.int64_value = 42;
+  ret = rcl_publish(&publisher, &msg, nullptr);
+  test_msgs__msg__BasicTypes__fini(&msg);
+  EXPECT_EQ(RCL_RET_OK, ret) << rcl_get_error_string().str;
+}
+
+/* Test the publisher telemetry counters.
+ */
+TEST_F(CLASSNAME(TestPublisherFixture, RMW_IMPLEMENTATION), test_publisher_statistics) {
+  rcl_publisher_t publisher = rcl_get_zero_initialized_publisher();
+  const rosidl_message_type_support_t * ts =
+    ROSIDL_GET_MSG_TYPE_SUPPORT(test_msgs, msg, BasicTypes);
+  constexpr char topic_name[] = "chatter";
+  rcl_publisher_options_t publisher_options = rcl_publisher_get_default_options();
+  rcl_ret_t ret =
+    rcl_publisher_init(&publisher, this->node_ptr, ts, topic_name, &publisher_options);
+  ASSERT_EQ(RCL_RET_OK, ret) << rcl_get_error_string().str;
+  OSRF_TESTING_TOOLS_CPP_SCOPE_EXIT(
+  {
+    rcl_ret_t ret = rcl_publisher_fini(&publisher, this->node_ptr);
+    EXPECT_EQ(RCL_RET_OK, ret) << rcl_get_error_string().str;
+  });
+
+  EXPECT_EQ(RCL_RET_PUBLISHER_INVALID, rcl_publisher_enable_statistics(nullptr));
+  rcl_reset_error();
+  rcl_publisher_statistics_t statistics;
+  EXPECT_EQ(
+    RCL_RET_INVALID_ARGUMENT, rcl_publisher_get_statistics(&publisher, nullptr));
+  rcl_reset_error();
+
+  test_msgs__msg__BasicTypes msg;
+  test_msgs__msg__BasicTypes__init(&msg);
+  msg.int64_value = 42;
+  // publishes before enabling are not counted
+  EXPECT_EQ(RCL_RET_OK, rcl_publish(&publisher, &msg, nullptr)) << rcl_get_error_string().str;
+  ASSERT_EQ(
+    RCL_RET_OK, rcl_publisher_get_statistics(&publisher, &statistics)) <<
+    rcl_get_error_string().str;
+  EXPECT_EQ(0u, statistics.publish_count);
+
+  ASSERT_EQ(RCL_RET_OK, rcl_publisher_enable_statistics(&publisher)) <<
+    rcl_get_error_string().str;
+  EXPECT_EQ(RCL_RET_OK, rcl_publish(&publisher, &msg, nullptr)) << rcl_get_error_string().str;
+  EXPECT_EQ(RCL_RET_OK, rcl_publish(&publisher, &msg, nullptr)) << rcl_get_error_string().str;
+  test_msgs__msg__BasicTypes__fini(&msg);
+  ASSERT_EQ(
+    RCL_RET_OK, rcl_publisher_get_statistics(&publisher, &statistics)) <<
+    rcl_get_error_string().str;
+  EXPECT_EQ(2u, statistics.publish_count);
+  EXPECT_EQ(0u, statistics.serialized_publish_count);
+  EXPECT_GT(statistics.ewma_rmw_publish_duration_ns, 0u);
+
+  // counters freeze but stay readable after disabling
+  ASSERT_EQ(RCL_RET_OK, rcl_publisher_disable_statistics(&publisher)) <<
+    rcl_get_error_string().str;
+  ASSERT_EQ(
+    RCL_RET_OK, rcl_publisher_get_statistics(&publisher, &statistics)) <<
+    rcl_get_error_string().str;
+  EXPECT_EQ(2u, statistics.publish_count);
+}
+
+/* Test the take-to-publish hop-latency accounting.
+ */
+TEST_F(CLASSNAME(TestPublisherFixture, RMW_IMPLEMENTATION), test_publisher_hop_latency) {
+  rcl_publisher_t publisher = rcl_get_zero_initialized_publisher();
+  const rosidl_message_type_support_t * ts =
+    ROSIDL_GET_MSG_TYPE_SUPPORT(test_msgs, msg, BasicTypes);
+  constexpr char topic_name[] = "hop_chatter";
+  rcl_publisher_options_t publisher_options = rcl_publisher_get_default_options();
+  rcl_ret_t ret =
+    rcl_publisher_init(&publisher, this->node_ptr, ts, topic_name, &publisher_options);
+  ASSERT_EQ(RCL_RET_OK, ret) << rcl_get_error_string().str;
+  OSRF_TESTING_TOOLS_CPP_SCOPE_EXIT(
+  {
+    rcl_ret_t ret = rcl_publisher_fini(&publisher, this->node_ptr);
+    EXPECT_EQ(RCL_RET_OK, ret) << rcl_get_error_string().str;
+  });
+
+  rcl_hop_context_t context = rcl_get_zero_initialized_hop_context();
+  EXPECT_EQ(
+    RCL_RET_INVALID_ARGUMENT, rcl_hop_context_from_message_info(nullptr, &context));
+  rcl_reset_error();
+  EXPECT_EQ(RCL_RET_PUBLISHER_INVALID, rcl_publisher_enable_hop_accounting(nullptr));
+  rcl_reset_error();
+  EXPECT_EQ(
+    RCL_RET_INVALID_ARGUMENT, rcl_publisher_record_hop(&publisher, nullptr));
+  rcl_reset_error();
+
+  // a context derived from an unstamped take falls back to "now"
+  rmw_message_info_t message_info = rmw_get_zero_initialized_message_info();
+  ASSERT_EQ(RCL_RET_OK, rcl_hop_context_from_message_info(&message_info, &context)) <<
+    rcl_get_error_string().str;
+  EXPECT_NE(0, context.received_timestamp);
+
+  // recording and reading before enabling are no-ops
+  EXPECT_EQ(RCL_RET_OK, rcl_publisher_record_hop(&publisher, &context)) <<
+    rcl_get_error_string().str;
+  rcl_hop_histogram_t histogram;
+  ASSERT_EQ(RCL_RET_OK, rcl_publisher_get_hop_histogram(&publisher, &histogram)) <<
+    rcl_get_error_string().str;
+  EXPECT_EQ(0u, histogram.sample_count);
+
+  ASSERT_EQ(RCL_RET_OK, rcl_publisher_enable_hop_accounting(&publisher)) <<
+    rcl_get_error_string().str;
+  // enabling twice is a no-op
+  ASSERT_EQ(RCL_RET_OK, rcl_publisher_enable_hop_accounting(&publisher)) <<
+    rcl_get_error_string().str;
+
+  // a receive stamped 1ms in the past must land at or above the 2^19ns bucket
+  rcutils_time_point_value_t now;
+  ASSERT_EQ(RCUTILS_RET_OK, rcutils_system_time_now(&now));
+  message_info.received_timestamp = now - RCUTILS_MS_TO_NS(1);
+  ASSERT_EQ(RCL_RET_OK, rcl_hop_context_from_message_info(&message_info, &context));
+  EXPECT_EQ(now - RCUTILS_MS_TO_NS(1), context.received_timestamp);
+  ASSERT_EQ(RCL_RET_OK, rcl_publisher_record_hop(&publisher, &context)) <<
+    rcl_get_error_string().str;
+  ASSERT_EQ(RCL_RET_OK, rcl_publisher_record_hop(&publisher, &context)) <<
+    rcl_get_error_string().str;
+
+  ASSERT_EQ(RCL_RET_OK, rcl_publisher_get_hop_histogram(&publisher, &histogram)) <<
+    rcl_get_error_string().str;
+  EXPECT_EQ(2u, histogram.sample_count);
+  EXPECT_GE(histogram.total_latency_ns, 2u * RCUTILS_MS_TO_NS(1));
+  EXPECT_GE(histogram.max_latency_ns, (uint64_t)RCUTILS_MS_TO_NS(1));
+  uint64_t bucket_sum = 0;
+  for (size_t i = 0; i < RCL_HOP_HISTOGRAM_BUCKETS; ++i) {
+    bucket_sum += histogram.bucket_counts[i];
+    if (i < 19) {
+      EXPECT_EQ(0u, histogram.bucket_counts[i]) << "bucket " << i;
+    }
+  }
+  EXPECT_EQ(histogram.sample_count, bucket_sum);
+}
+
+/* Test the non-blocking ack probe and the wait-set ack watch.
+ */
+TEST_F(CLASSNAME(TestPublisherFixture, RMW_IMPLEMENTATION), test_publisher_ack_watch) {
+  rcl_publisher_t publisher = rcl_get_zero_initialized_publisher();
+  const rosidl_message_type_support_t * ts =
+    ROSIDL_GET_MSG_TYPE_SUPPORT(test_msgs, msg, BasicTypes);
+  constexpr char topic_name[] = "ack_watch_chatter";
+  rcl_publisher_options_t publisher_options = rcl_publisher_get_default_options();
+  rcl_ret_t ret =
+    rcl_publisher_init(&publisher, this->node_ptr, ts, topic_name, &publisher_options);
+  ASSERT_EQ(RCL_RET_OK, ret) << rcl_get_error_string().str;
+
+  rcl_wait_set_t wait_set = rcl_get_zero_initialized_wait_set();
+  ret = rcl_wait_set_init(
+    &wait_set, 0, 1, 0, 0, 0, 0, this->context_ptr, rcl_get_default_allocator());
+  ASSERT_EQ(RCL_RET_OK, ret) << rcl_get_error_string().str;
+  rcl_guard_condition_t guard_condition = rcl_get_zero_initialized_guard_condition();
+  ret = rcl_guard_condition_init(
+    &guard_condition, this->context_ptr, rcl_guard_condition_get_default_options());
+  ASSERT_EQ(RCL_RET_OK, ret) << rcl_get_error_string().str;
+  OSRF_TESTING_TOOLS_CPP_SCOPE_EXIT(
+  {
+    EXPECT_EQ(RCL_RET_OK, rcl_guard_condition_fini(&guard_condition)) <<
+      rcl_get_error_string().str;
+    EXPECT_EQ(RCL_RET_OK, rcl_wait_set_fini(&wait_set)) << rcl_get_error_string().str;
+    EXPECT_EQ(RCL_RET_OK, rcl_publisher_fini(&publisher, this->node_ptr)) <<
+      rcl_get_error_string().str;
+  });
+
+  // invalid arguments
+  bool all_acked = false;
+  EXPECT_EQ(RCL_RET_PUBLISHER_INVALID, rcl_publisher_check_all_acked(nullptr, &all_acked));
+  rcl_reset_error();
+  EXPECT_EQ(RCL_RET_INVALID_ARGUMENT, rcl_publisher_check_all_acked(&publisher, nullptr));
+  rcl_reset_error();
+  EXPECT_EQ(
+    RCL_RET_INVALID_ARGUMENT,
+    rcl_wait_set_add_ack_watch(&wait_set, &publisher, nullptr, 1000));
+  rcl_reset_error();
+  EXPECT_EQ(
+    RCL_RET_INVALID_ARGUMENT,
+    rcl_wait_set_add_ack_watch(&wait_set, &publisher, &guard_condition, 0));
+  rcl_reset_error();
+
+  // without subscribers nothing waits for acknowledgment
+  ASSERT_EQ(RCL_RET_OK, rcl_publisher_check_all_acked(&publisher, &all_acked)) <<
+    rcl_get_error_string().str;
+  EXPECT_TRUE(all_acked);
+
+  // an already drained publisher completes the watch immediately
+  ret = rcl_wait_set_add_ack_watch(&wait_set, &publisher, &guard_condition, RCL_MS_TO_NS(1));
+  ASSERT_EQ(RCL_RET_OK, ret) << rcl_get_error_string().str;
+  ASSERT_EQ(RCL_RET_OK, rcl_wait_set_add_guard_condition(&wait_set, &guard_condition, NULL));
+  ret = rcl_wait(&wait_set, RCL_MS_TO_NS(100));
+  ASSERT_EQ(RCL_RET_OK, ret) << rcl_get_error_string().str;
+  EXPECT_EQ(&guard_condition, wait_set.guard_conditions[0]);
+
+  // removing a watch that is not registered is a no-op
+  EXPECT_EQ(RCL_RET_OK, rcl_wait_set_remove_ack_watch(&wait_set, &publisher));
+}
+
+/* Test publishing through the serialized message cache.
+ */
+TEST_F(CLASSNAME(TestPublisherFixture, RMW_IMPLEMENTATION), test_publisher_publish_cached) {
+  rcl_publisher_t publisher = rcl_get_zero_initialized_publisher();
+  const rosidl_message_type_support_t * ts =
+    ROSIDL_GET_MSG_TYPE_SUPPORT(test_msgs, msg, BasicTypes);
+  constexpr char topic_name[] = "chatter";
+  rcl_publisher_options_t publisher_options = rcl_publisher_get_default_options();
+  rcl_ret_t ret =
+    rcl_publisher_init(&publisher, this->node_ptr, ts, topic_name, &publisher_options);
+  ASSERT_EQ(RCL_RET_OK, ret) << rcl_get_error_string().str;
+  OSRF_TESTING_TOOLS_CPP_SCOPE_EXIT(
+  {
+    rcl_ret_t ret = rcl_publisher_fini(&publisher, this->node_ptr);
+    EXPECT_EQ(RCL_RET_OK, ret) << rcl_get_error_string().str;
+  });
+
+  test_msgs__msg__BasicTypes msg;
+  test_msgs__msg__BasicTypes__init(&msg);
+  msg.int64_value = 42;
+  // first call serializes, second republishes the cached serialization
+  EXPECT_EQ(
+    RCL_RET_OK, rcl_publish_cached(&publisher, &msg, false, nullptr)) <<
+    rcl_get_error_string().str;
+  EXPECT_EQ(
+    RCL_RET_OK, rcl_publish_cached(&publisher, &msg, false, nullptr)) <<
+    rcl_get_error_string().str;
+  // a dirty message is re-serialized
+  msg.int64_value = 43;
+  EXPECT_EQ(
+    RCL_RET_OK, rcl_publish_cached(&publisher, &msg, true, nullptr)) <<
+    rcl_get_error_string().str;
+  test_msgs__msg__BasicTypes__fini(&msg);
+
+  EXPECT_EQ(
+    RCL_RET_INVALID_ARGUMENT, rcl_publish_cached(&publisher, nullptr, false, nullptr));
+  rcl_reset_error();
+  EXPECT_EQ(
+    RCL_RET_PUBLISHER_INVALID, rcl_publish_cached(nullptr, &msg, false, nullptr));
+  rcl_reset_error();
+}
+
+/* Test inline-buffered serialized messages, with and without heap spill.
+ */
+TEST_F(CLASSNAME(TestPublisherFixture, RMW_IMPLEMENTATION), test_publisher_serialized_inline) {
+  rcl_publisher_t publisher = rcl_get_zero_initialized_publisher();
+  const rosidl_message_type_support_t * ts =
+    ROSIDL_GET_MSG_TYPE_SUPPORT(test_msgs, msg, BasicTypes);
+  constexpr char topic_name[] = "chatter";
+  rcl_publisher_options_t publisher_options = rcl_publisher_get_default_options();
+  rcl_ret_t ret =
+    rcl_publisher_init(&publisher, this->node_ptr, ts, topic_name, &publisher_options);
+  ASSERT_EQ(RCL_RET_OK, ret) << rcl_get_error_string().str;
+  OSRF_TESTING_TOOLS_CPP_SCOPE_EXIT(
+  {
+    rcl_ret_t ret = rcl_publisher_fini(&publisher, this->node_ptr);
+    EXPECT_EQ(RCL_RET_OK, ret) << rcl_get_error_string().str;
+  });
+  rcl_allocator_t allocator = rcl_get_default_allocator();
+
+  uint8_t storage[256];
+  rcl_inline_serialized_message_state_t state;
+  rcl_serialized_message_t serialized_msg = rmw_get_zero_initialized_serialized_message();
+  EXPECT_EQ(
+    RCL_RET_INVALID_ARGUMENT,
+    rcl_serialized_message_init_inline(&serialized_msg, &state, storage, 0u, &allocator));
+  rcl_reset_error();
+  ASSERT_EQ(
+    RCL_RET_OK,
+    rcl_serialized_message_init_inline(
+      &serialized_msg, &state, storage, sizeof(storage), &allocator)) <<
+    rcl_get_error_string().str;
+
+  test_msgs__msg__BasicTypes msg;
+  test_msgs__msg__BasicTypes__init(&msg);
+  msg.int64_value = 42;
+  ASSERT_EQ(RMW_RET_OK, rmw_serialize(&msg, ts, &serialized_msg));
+  // a BasicTypes serialization fits, so no heap allocation happened
+  EXPECT_EQ(storage, serialized_msg.buffer);
+  EXPECT_EQ(
+    RCL_RET_OK, rcl_publish_serialized_message(&publisher, &serialized_msg, nullptr)) <<
+    rcl_get_error_string().str;
+  ASSERT_EQ(
+    RCL_RET_OK, rcl_serialized_message_fini_inline(&serialized_msg, &state)) <<
+    rcl_get_error_string().str;
+
+  // an undersized inline buffer spills to the heap
+  uint8_t tiny_storage[4];
+  ASSERT_EQ(
+    RCL_RET_OK,
+    rcl_serialized_message_init_inline(
+      &serialized_msg, &state, tiny_storage, sizeof(tiny_storage), &allocator)) <<
+    rcl_get_error_string().str;
+  ASSERT_EQ(RMW_RET_OK, rmw_serialize(&msg, ts, &serialized_msg));
+  test_msgs__msg__BasicTypes__fini(&msg);
+  EXPECT_NE(tiny_storage, serialized_msg.buffer);
+  EXPECT_EQ(
+    RCL_RET_OK, rcl_publish_serialized_message(&publisher, &serialized_msg, nullptr)) <<
+    rcl_get_error_string().str;
+  ASSERT_EQ(
+    RCL_RET_OK, rcl_serialized_message_fini_inline(&serialized_msg, &state)) <<
+    rcl_get_error_string().str;
+}
+
+/* Test borrowing and publishing through the fallback loan pool.
+ */
+TEST_F(CLASSNAME(TestPublisherFixture, RMW_IMPLEMENTATION), test_publisher_loan_pool) {
+  rcl_publisher_t publisher = rcl_get_zero_initialized_publisher();
+  const rosidl_message_type_support_t * ts =
+    ROSIDL_GET_MSG_TYPE_SUPPORT(test_msgs, msg, BasicTypes);
+  constexpr char topic_name[] = "pod_msg";
+  rcl_publisher_options_t publisher_options = rcl_publisher_get_default_options();
+  rcl_ret_t ret =
+    rcl_publisher_init(&publisher, this->node_ptr, ts, topic_name, &publisher_options);
+  ASSERT_EQ(RCL_RET_OK, ret) << rcl_get_error_string().str;
+  OSRF_TESTING_TOOLS_CPP_SCOPE_EXIT(
+  {
+    rcl_ret_t ret = rcl_publisher_fini(&publisher, this->node_ptr);
+    EXPECT_EQ(RCL_RET_OK, ret) << rcl_get_error_string().str;
+  });
+
+  EXPECT_EQ(
+    RCL_RET_INVALID_ARGUMENT,
+    rcl_publisher_init_loan_pool(&publisher, 0, 2));
+  rcl_reset_error();
+  ASSERT_EQ(
+    RCL_RET_OK,
+    rcl_publisher_init_loan_pool(&publisher, sizeof(test_msgs__msg__BasicTypes), 2)) <<
+    rcl_get_error_string().str;
+  EXPECT_EQ(
+    RCL_RET_ALREADY_INIT,
+    rcl_publisher_init_loan_pool(&publisher, sizeof(test_msgs__msg__BasicTypes), 2));
+  rcl_reset_error();
+
+  // with the pool attached borrowing is always available
+  EXPECT_TRUE(rcl_publisher_can_loan_messages(&publisher));
+  test_msgs__msg__BasicTypes * msg_loaned = nullptr;
+  ASSERT_EQ(
+    RCL_RET_OK, rcl_borrow_loaned_message(
+      &publisher, ts, reinterpret_cast<void **>(&msg_loaned))) << rcl_get_error_string().str;
+  msg_loaned->int64_value = 42;
+  EXPECT_EQ(
+    RCL_RET_OK,
+    rcl_publish_loaned_message(&publisher, msg_loaned, nullptr)) << rcl_get_error_string().str;
+
+  // returning an unpublished loan recycles the block as well
+  msg_loaned = nullptr;
+  ASSERT_EQ(
+    RCL_RET_OK, rcl_borrow_loaned_message(
+      &publisher, ts, reinterpret_cast<void **>(&msg_loaned))) << rcl_get_error_string().str;
+  EXPECT_EQ(
+    RCL_RET_OK,
+    rcl_return_loaned_message_from_publisher(&publisher, msg_loaned)) <<
+    rcl_get_error_string().str;
+
+  EXPECT_EQ(RCL_RET_OK, rcl_publisher_fini_loan_pool(&publisher)) << rcl_get_error_string().str;
+  // finalizing again is a no-op
+  EXPECT_EQ(RCL_RET_OK, rcl_publisher_fini_loan_pool(&publisher)) << rcl_get_error_string().str;
+}
+
 TEST_F(CLASSNAME(TestPublisherFixture, RMW_IMPLEMENTATION), test_publisher_option) {
   {
     rcl_publisher_options_t publisher_options = rcl_publisher_get_default_options();
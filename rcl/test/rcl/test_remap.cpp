@@ -14,6 +14,9 @@
 
 #include <gtest/gtest.h>
 
+#include <string>
+#include <vector>
+
 #include "rcl/arguments.h"
 #include "rcl/rcl.h"
 #include "rcl/remap.h"
@@ -647,3 +650,129 @@ TEST_F(CLASSNAME(TestRemapFixture, RMW_IMPLEMENTATION), internal_remap_use) {
   // Bad fini
   EXPECT_EQ(RCL_RET_INVALID_ARGUMENT, rcl_remap_fini(nullptr));
 }
+
+TEST_F(CLASSNAME(TestRemapFixture, RMW_IMPLEMENTATION), expanded_rule_before_exact_rule) {
+  rcl_ret_t ret;
+  rcl_arguments_t global_arguments;
+  // The relative rule comes first and expands to the same name as the
+  // fully qualified rule, so it must win over the exact-match lookup.
+  SCOPE_ARGS(
+    global_arguments,
+    "process_name",
+    "--ros-args",
+    "-r", "foo:=/from_relative_rule",
+    "-r", "/ns/foo:=/from_exact_rule");
+
+  rcl_allocator_t allocator = rcl_get_default_allocator();
+  char * output = NULL;
+  ret = rcl_remap_topic_name(
+    NULL, &global_arguments, "/ns/foo", "NodeName", "/ns", allocator, &output);
+  EXPECT_EQ(RCL_RET_OK, ret);
+  EXPECT_STREQ("/from_relative_rule", output);
+  allocator.deallocate(output, allocator.state);
+}
+
+TEST_F(CLASSNAME(TestRemapFixture, RMW_IMPLEMENTATION), first_exact_rule_wins) {
+  rcl_ret_t ret;
+  rcl_arguments_t global_arguments;
+  SCOPE_ARGS(
+    global_arguments,
+    "process_name",
+    "--ros-args",
+    "-r", "/foo:=/first_rule",
+    "-r", "/foo:=/second_rule");
+
+  rcl_allocator_t allocator = rcl_get_default_allocator();
+  char * output = NULL;
+  ret = rcl_remap_topic_name(
+    NULL, &global_arguments, "/foo", "NodeName", "/", allocator, &output);
+  EXPECT_EQ(RCL_RET_OK, ret);
+  EXPECT_STREQ("/first_rule", output);
+  allocator.deallocate(output, allocator.state);
+}
+
+TEST_F(CLASSNAME(TestRemapFixture, RMW_IMPLEMENTATION), many_exact_rules) {
+  rcl_ret_t ret;
+  rcl_arguments_t global_arguments;
+  // Enough fully qualified rules that the compiled table grows past its
+  // minimum capacity and lookups have to probe past collisions.
+  std::vector<std::string> storage;
+  std::vector<const char *> argv = {"process_name", "--ros-args"};
+  for (int i = 0; i < 20; ++i) {
+    storage.push_back(
+      "/topic_" + std::to_string(i) + ":=/remapped_" + std::to_string(i));
+  }
+  for (const std::string & rule : storage) {
+    argv.push_back("-r");
+    argv.push_back(rule.c_str());
+  }
+  global_arguments = rcl_get_zero_initialized_arguments();
+  ret = rcl_parse_arguments(
+    static_cast<int>(argv.size()), argv.data(), rcl_get_default_allocator(), &global_arguments);
+  ASSERT_EQ(RCL_RET_OK, ret) << rcl_get_error_string().str;
+
+  rcl_allocator_t allocator = rcl_get_default_allocator();
+  for (int i = 0; i < 20; ++i) {
+    std::string topic = "/topic_" + std::to_string(i);
+    std::string expected = "/remapped_" + std::to_string(i);
+    char * output = NULL;
+    ret = rcl_remap_topic_name(
+      NULL, &global_arguments, topic.c_str(), "NodeName", "/", allocator, &output);
+    EXPECT_EQ(RCL_RET_OK, ret);
+    EXPECT_STREQ(expected.c_str(), output);
+    allocator.deallocate(output, allocator.state);
+  }
+  {
+    char * output = NULL;
+    ret = rcl_remap_topic_name(
+      NULL, &global_arguments, "/topic_unmatched", "NodeName", "/", allocator, &output);
+    EXPECT_EQ(RCL_RET_OK, ret);
+    EXPECT_EQ(NULL, output);
+  }
+  EXPECT_EQ(RCL_RET_OK, rcl_arguments_fini(&global_arguments));
+}
+
+TEST_F(CLASSNAME(TestRemapFixture, RMW_IMPLEMENTATION), batch_name_replacement) {
+  rcl_arguments_t global_arguments;
+  SCOPE_ARGS(
+    global_arguments,
+    "process_name",
+    "--ros-args",
+    "-r", "/bar/foo:=/foo/bar",
+    "-r", "/service:=/new_service");
+
+  rcl_allocator_t allocator = rcl_get_default_allocator();
+  const char * names[3] = {"/bar/foo", "/service", "/no/match"};
+  bool is_service[3] = {false, true, false};
+  char * outputs[3];
+  rcl_ret_t ret = rcl_remap_names_batch(
+    NULL, &global_arguments, 3, names, is_service, "NodeName", "/", allocator, outputs);
+  ASSERT_EQ(RCL_RET_OK, ret) << rcl_get_error_string().str;
+  ASSERT_STREQ("/foo/bar", outputs[0]);
+  ASSERT_STREQ("/new_service", outputs[1]);
+  EXPECT_EQ(NULL, outputs[2]);
+  allocator.deallocate(outputs[0], allocator.state);
+  allocator.deallocate(outputs[1], allocator.state);
+
+  // A NULL is_service array treats every name as a topic
+  char * topic_outputs[1];
+  const char * topic_names[1] = {"/service"};
+  ret = rcl_remap_names_batch(
+    NULL, &global_arguments, 1, topic_names, NULL, "NodeName", "/", allocator, topic_outputs);
+  ASSERT_EQ(RCL_RET_OK, ret) << rcl_get_error_string().str;
+  ASSERT_STREQ("/new_service", topic_outputs[0]);
+  allocator.deallocate(topic_outputs[0], allocator.state);
+
+  // An empty batch is fine
+  ret = rcl_remap_names_batch(
+    NULL, &global_arguments, 0, NULL, NULL, "NodeName", "/", allocator, NULL);
+  EXPECT_EQ(RCL_RET_OK, ret) << rcl_get_error_string().str;
+
+  // A NULL name in the batch is rejected
+  const char * bad_names[1] = {NULL};
+  char * bad_outputs[1];
+  ret = rcl_remap_names_batch(
+    NULL, &global_arguments, 1, bad_names, NULL, "NodeName", "/", allocator, bad_outputs);
+  EXPECT_EQ(RCL_RET_INVALID_ARGUMENT, ret);
+  rcl_reset_error();
+}
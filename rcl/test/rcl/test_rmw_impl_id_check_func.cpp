@@ -155,3 +155,28 @@ TEST(TestRmwCheck, test_mock_rmw_impl_check) {
     rcl_reset_error();
   }
 }
+
+TEST(TestRmwCheck, test_rmw_check_id_latched) {
+  const char * expected_rmw_impl_env = NULL;
+  const char * get_env_var_name = rcutils_get_env(
+    RMW_IMPLEMENTATION_ENV_VAR_NAME,
+    &expected_rmw_impl_env);
+  EXPECT_FALSE(get_env_var_name);
+
+  // The library constructor already ran the full check and latched it.
+  EXPECT_EQ(RCL_RET_OK, rcl_rmw_implementation_identifier_check_latched());
+
+  // The latched result does not re-read the environment.
+  EXPECT_TRUE(rcutils_set_env(RMW_IMPLEMENTATION_ENV_VAR_NAME, "some_random_name"));
+  EXPECT_EQ(RCL_RET_OK, rcl_rmw_implementation_identifier_check_latched());
+
+  // A full check picks up the environment change and updates the latch.
+  EXPECT_EQ(RCL_RET_MISMATCHED_RMW_ID, rcl_rmw_implementation_identifier_check());
+  rcl_reset_error();
+  EXPECT_EQ(RCL_RET_MISMATCHED_RMW_ID, rcl_rmw_implementation_identifier_check_latched());
+
+  // Restore the env variable set in the test and re-latch the passing result.
+  EXPECT_TRUE(rcutils_set_env(RMW_IMPLEMENTATION_ENV_VAR_NAME, expected_rmw_impl_env));
+  EXPECT_EQ(RCL_RET_OK, rcl_rmw_implementation_identifier_check());
+  EXPECT_EQ(RCL_RET_OK, rcl_rmw_implementation_identifier_check_latched());
+}
@@ -404,3 +404,33 @@ TEST_F(TestGetSecureRoot, test_rcl_get_secure_root_with_internal_errors) {
   EXPECT_TRUE(rcl_error_is_set());
   rcl_reset_error();
 }
+
+TEST_F(TestGetSecureRoot, test_secure_root_cache) {
+  putenv_wrapper(
+    ROS_SECURITY_KEYSTORE_VAR_NAME "="
+    TEST_RESOURCES_DIRECTORY TEST_SECURITY_DIRECTORY_RESOURCES_DIR_NAME);
+
+  secure_root = rcl_get_secure_root(TEST_ENCLAVE_ABSOLUTE, &allocator);
+  ASSERT_NE(nullptr, secure_root);
+
+  // a repeated lookup is served from the process-wide cache, and the caller
+  // still owns an independent copy of the path
+  char * cached_secure_root = rcl_get_secure_root(TEST_ENCLAVE_ABSOLUTE, &allocator);
+  ASSERT_NE(nullptr, cached_secure_root);
+  OSRF_TESTING_TOOLS_CPP_SCOPE_EXIT(
+  {
+    allocator.deallocate(cached_secure_root, allocator.state);
+  });
+  EXPECT_STREQ(secure_root, cached_secure_root);
+  EXPECT_NE(secure_root, cached_secure_root);
+
+  // changing the override environment variable bypasses the cached entry
+  putenv_wrapper(ROS_SECURITY_ENCLAVE_OVERRIDE "=" TEST_ENCLAVE_MULTIPLE_TOKENS_ABSOLUTE);
+  char * override_secure_root = rcl_get_secure_root(TEST_ENCLAVE_ABSOLUTE, &allocator);
+  ASSERT_NE(nullptr, override_secure_root);
+  OSRF_TESTING_TOOLS_CPP_SCOPE_EXIT(
+  {
+    allocator.deallocate(override_secure_root, allocator.state);
+  });
+  EXPECT_STRNE(secure_root, override_secure_root);
+}
@@ -14,6 +14,8 @@
 
 #include <gtest/gtest.h>
 
+#include <chrono>
+
 #include "rcl/service.h"
 #include "rcl/rcl.h"
 
@@ -238,6 +240,397 @@ TEST_F(CLASSNAME(TestServiceFixture, RMW_IMPLEMENTATION), test_service_nominal)
   test_msgs__srv__BasicTypes_Response__fini(&client_response);
 }
 
+/* Round trip of a request burst through the batch take and scatter calls.
+ */
+TEST_F(CLASSNAME(TestServiceFixture, RMW_IMPLEMENTATION), test_service_request_batch) {
+  rcl_ret_t ret;
+  const rosidl_service_type_support_t * ts = ROSIDL_GET_SRV_TYPE_SUPPORT(
+    test_msgs, srv, BasicTypes);
+  const char * topic = "primitives_batch";
+
+  rcl_service_t service = rcl_get_zero_initialized_service();
+  rcl_service_options_t service_options = rcl_service_get_default_options();
+  ret = rcl_service_init(&service, this->node_ptr, ts, topic, &service_options);
+  ASSERT_EQ(RCL_RET_OK, ret) << rcl_get_error_string().str;
+  OSRF_TESTING_TOOLS_CPP_SCOPE_EXIT(
+  {
+    rcl_ret_t ret = rcl_service_fini(&service, this->node_ptr);
+    EXPECT_EQ(RCL_RET_OK, ret) << rcl_get_error_string().str;
+  });
+
+  rcl_client_t client = rcl_get_zero_initialized_client();
+  rcl_client_options_t client_options = rcl_client_get_default_options();
+  ret = rcl_client_init(&client, this->node_ptr, ts, topic, &client_options);
+  ASSERT_EQ(RCL_RET_OK, ret) << rcl_get_error_string().str;
+  OSRF_TESTING_TOOLS_CPP_SCOPE_EXIT(
+  {
+    rcl_ret_t ret = rcl_client_fini(&client, this->node_ptr);
+    EXPECT_EQ(RCL_RET_OK, ret) << rcl_get_error_string().str;
+  });
+  ASSERT_TRUE(wait_for_server_to_be_available(this->node_ptr, &client, 10, 1000));
+
+  constexpr size_t kBatch = 3;
+  rmw_service_info_t headers[kBatch];
+  test_msgs__srv__BasicTypes_Request requests[kBatch];
+  test_msgs__srv__BasicTypes_Response responses[kBatch];
+  void * request_ptrs[kBatch];
+  void * response_ptrs[kBatch];
+  rmw_request_id_t response_headers[kBatch];
+  for (size_t i = 0; i < kBatch; ++i) {
+    test_msgs__srv__BasicTypes_Request__init(&requests[i]);
+    test_msgs__srv__BasicTypes_Response__init(&responses[i]);
+    request_ptrs[i] = &requests[i];
+    response_ptrs[i] = &responses[i];
+  }
+  OSRF_TESTING_TOOLS_CPP_SCOPE_EXIT(
+  {
+    for (size_t i = 0; i < kBatch; ++i) {
+      test_msgs__srv__BasicTypes_Request__fini(&requests[i]);
+      test_msgs__srv__BasicTypes_Response__fini(&responses[i]);
+    }
+  });
+
+  size_t taken = 0u;
+  size_t sent = 0u;
+  EXPECT_EQ(
+    RCL_RET_SERVICE_INVALID,
+    rcl_take_request_batch(nullptr, headers, request_ptrs, kBatch, &taken));
+  rcl_reset_error();
+  EXPECT_EQ(
+    RCL_RET_INVALID_ARGUMENT,
+    rcl_take_request_batch(&service, headers, request_ptrs, 0, &taken));
+  rcl_reset_error();
+  EXPECT_EQ(
+    RCL_RET_INVALID_ARGUMENT,
+    rcl_send_response_batch(&service, response_headers, response_ptrs, 0, &sent));
+  rcl_reset_error();
+  // nothing queued yet
+  EXPECT_EQ(
+    RCL_RET_SERVICE_TAKE_FAILED,
+    rcl_take_request_batch(&service, headers, request_ptrs, kBatch, &taken));
+  EXPECT_EQ(0u, taken);
+  rcl_reset_error();
+
+  // burst of requests from the client
+  for (size_t i = 0; i < kBatch; ++i) {
+    test_msgs__srv__BasicTypes_Request client_request;
+    test_msgs__srv__BasicTypes_Request__init(&client_request);
+    client_request.bool_value = false;
+    client_request.uint8_value = 1;
+    client_request.uint32_value = static_cast<uint32_t>(i);
+    int64_t sequence_number;
+    ret = rcl_send_request(&client, &client_request, &sequence_number);
+    test_msgs__srv__BasicTypes_Request__fini(&client_request);
+    ASSERT_EQ(RCL_RET_OK, ret) << rcl_get_error_string().str;
+  }
+
+  // drain the burst; reliable services may still deliver it in pieces
+  size_t total_taken = 0u;
+  auto start = std::chrono::steady_clock::now();
+  do {
+    ASSERT_TRUE(wait_for_service_to_be_ready(&service, context_ptr, 10, 100));
+    ret = rcl_take_request_batch(
+      &service, &headers[total_taken], &request_ptrs[total_taken],
+      kBatch - total_taken, &taken);
+    if (RCL_RET_SERVICE_TAKE_FAILED == ret) {
+      rcl_reset_error();
+    } else {
+      ASSERT_EQ(RCL_RET_OK, ret) << rcl_get_error_string().str;
+      total_taken += taken;
+    }
+  } while (total_taken < kBatch &&
+    std::chrono::steady_clock::now() < start + std::chrono::seconds(10));
+  ASSERT_EQ(kBatch, total_taken);
+
+  // answer the whole batch in one scatter call
+  for (size_t i = 0; i < kBatch; ++i) {
+    responses[i].uint64_value = requests[i].uint8_value + requests[i].uint32_value;
+    response_headers[i] = headers[i].request_id;
+  }
+  ASSERT_EQ(
+    RCL_RET_OK,
+    rcl_send_response_batch(&service, response_headers, response_ptrs, kBatch, &sent)) <<
+    rcl_get_error_string().str;
+  EXPECT_EQ(kBatch, sent);
+
+  // the client sees one response per request, with the right sums
+  uint64_t response_sum = 0u;
+  size_t received = 0u;
+  start = std::chrono::steady_clock::now();
+  do {
+    test_msgs__srv__BasicTypes_Response client_response;
+    test_msgs__srv__BasicTypes_Response__init(&client_response);
+    rmw_service_info_t header;
+    ret = rcl_take_response_with_info(&client, &header, &client_response);
+    if (RCL_RET_OK == ret) {
+      response_sum += client_response.uint64_value;
+      ++received;
+    } else {
+      ASSERT_EQ(RCL_RET_CLIENT_TAKE_FAILED, ret);
+      rcl_reset_error();
+    }
+    test_msgs__srv__BasicTypes_Response__fini(&client_response);
+  } while (received < kBatch &&
+    std::chrono::steady_clock::now() < start + std::chrono::seconds(10));
+  EXPECT_EQ(kBatch, received);
+  // (1+0) + (1+1) + (1+2)
+  EXPECT_EQ(6u, response_sum);
+}
+
+/* Round trip of a burst of pipelined requests drained in one pass.
+ */
+TEST_F(CLASSNAME(TestServiceFixture, RMW_IMPLEMENTATION), test_service_pipelined_client) {
+  rcl_ret_t ret;
+  const rosidl_service_type_support_t * ts = ROSIDL_GET_SRV_TYPE_SUPPORT(
+    test_msgs, srv, BasicTypes);
+  const char * topic = "primitives_pipelined";
+
+  rcl_service_t service = rcl_get_zero_initialized_service();
+  rcl_service_options_t service_options = rcl_service_get_default_options();
+  ret = rcl_service_init(&service, this->node_ptr, ts, topic, &service_options);
+  ASSERT_EQ(RCL_RET_OK, ret) << rcl_get_error_string().str;
+  OSRF_TESTING_TOOLS_CPP_SCOPE_EXIT(
+  {
+    rcl_ret_t ret = rcl_service_fini(&service, this->node_ptr);
+    EXPECT_EQ(RCL_RET_OK, ret) << rcl_get_error_string().str;
+  });
+
+  rcl_client_t client = rcl_get_zero_initialized_client();
+  rcl_client_options_t client_options = rcl_client_get_default_options();
+  ret = rcl_client_init(&client, this->node_ptr, ts, topic, &client_options);
+  ASSERT_EQ(RCL_RET_OK, ret) << rcl_get_error_string().str;
+  OSRF_TESTING_TOOLS_CPP_SCOPE_EXIT(
+  {
+    rcl_ret_t ret = rcl_client_fini(&client, this->node_ptr);
+    EXPECT_EQ(RCL_RET_OK, ret) << rcl_get_error_string().str;
+  });
+  ASSERT_EQ(RCL_RET_OK, rcl_client_init_pipeline(&client, 4)) << rcl_get_error_string().str;
+
+  ASSERT_TRUE(wait_for_server_to_be_available(this->node_ptr, &client, 10, 1000));
+
+  // completion callback sums the responses it sees
+  struct Completions
+  {
+    size_t count = 0u;
+    uint64_t sum = 0u;
+  } completions;
+  const auto callback = [](const void * user_data, int64_t, void * ros_response) {
+      auto * c = const_cast<Completions *>(static_cast<const Completions *>(user_data));
+      ++c->count;
+      c->sum += static_cast<test_msgs__srv__BasicTypes_Response *>(ros_response)->uint64_value;
+    };
+
+  // a burst of two requests before any response is drained
+  test_msgs__srv__BasicTypes_Request client_request;
+  test_msgs__srv__BasicTypes_Request__init(&client_request);
+  client_request.bool_value = false;
+  client_request.uint8_value = 1;
+  client_request.uint32_value = 2;
+  int64_t sequence_number;
+  ret = rcl_send_request_pipelined(
+    &client, &client_request, callback, &completions, &sequence_number);
+  ASSERT_EQ(RCL_RET_OK, ret) << rcl_get_error_string().str;
+  EXPECT_EQ(1, sequence_number);
+  client_request.uint32_value = 3;
+  ret = rcl_send_request_pipelined(
+    &client, &client_request, callback, &completions, &sequence_number);
+  ASSERT_EQ(RCL_RET_OK, ret) << rcl_get_error_string().str;
+  EXPECT_EQ(2, sequence_number);
+  test_msgs__srv__BasicTypes_Request__fini(&client_request);
+
+  // the service answers both requests
+  for (int i = 0; i < 2; ++i) {
+    ASSERT_TRUE(wait_for_service_to_be_ready(&service, context_ptr, 10, 100));
+    test_msgs__srv__BasicTypes_Request service_request;
+    test_msgs__srv__BasicTypes_Request__init(&service_request);
+    test_msgs__srv__BasicTypes_Response service_response;
+    test_msgs__srv__BasicTypes_Response__init(&service_response);
+    rmw_service_info_t header;
+    ret = rcl_take_request_with_info(&service, &header, &service_request);
+    ASSERT_EQ(RCL_RET_OK, ret) << rcl_get_error_string().str;
+    service_response.uint64_value = service_request.uint8_value + service_request.uint32_value;
+    ret = rcl_send_response(&service, &header.request_id, &service_response);
+    ASSERT_EQ(RCL_RET_OK, ret) << rcl_get_error_string().str;
+    test_msgs__srv__BasicTypes_Request__fini(&service_request);
+    test_msgs__srv__BasicTypes_Response__fini(&service_response);
+  }
+
+  // one drain pass completes the whole burst
+  test_msgs__srv__BasicTypes_Response client_response;
+  test_msgs__srv__BasicTypes_Response__init(&client_response);
+  size_t completed = 0u;
+  auto start = std::chrono::steady_clock::now();
+  do {
+    size_t drained = 0u;
+    ret = rcl_client_drain_responses(&client, &client_response, &drained);
+    if (RCL_RET_CLIENT_TAKE_FAILED == ret) {
+      rcl_reset_error();
+    } else {
+      ASSERT_EQ(RCL_RET_OK, ret) << rcl_get_error_string().str;
+    }
+    completed += drained;
+  } while (completed < 2 &&
+    std::chrono::steady_clock::now() < start + std::chrono::seconds(10));
+  EXPECT_EQ(2u, completed);
+  EXPECT_EQ(2u, completions.count);
+  // 1+2 and 1+3
+  EXPECT_EQ(7u, completions.sum);
+
+  // a request with no callback is completed through the demuxed take, which
+  // hands the registered context back instead
+  int context_marker = 0;
+  test_msgs__srv__BasicTypes_Request__init(&client_request);
+  client_request.bool_value = false;
+  client_request.uint8_value = 2;
+  client_request.uint32_value = 5;
+  ret = rcl_send_request_pipelined(
+    &client, &client_request, nullptr, &context_marker, &sequence_number);
+  test_msgs__srv__BasicTypes_Request__fini(&client_request);
+  ASSERT_EQ(RCL_RET_OK, ret) << rcl_get_error_string().str;
+  ASSERT_TRUE(wait_for_service_to_be_ready(&service, context_ptr, 10, 100));
+  {
+    test_msgs__srv__BasicTypes_Request service_request;
+    test_msgs__srv__BasicTypes_Request__init(&service_request);
+    test_msgs__srv__BasicTypes_Response service_response;
+    test_msgs__srv__BasicTypes_Response__init(&service_response);
+    rmw_service_info_t header;
+    ret = rcl_take_request_with_info(&service, &header, &service_request);
+    ASSERT_EQ(RCL_RET_OK, ret) << rcl_get_error_string().str;
+    service_response.uint64_value = service_request.uint8_value + service_request.uint32_value;
+    ret = rcl_send_response(&service, &header.request_id, &service_response);
+    ASSERT_EQ(RCL_RET_OK, ret) << rcl_get_error_string().str;
+    test_msgs__srv__BasicTypes_Request__fini(&service_request);
+    test_msgs__srv__BasicTypes_Response__fini(&service_response);
+  }
+  const void * context = nullptr;
+  rmw_service_info_t response_header;
+  start = std::chrono::steady_clock::now();
+  do {
+    ret = rcl_take_response_demuxed(&client, &response_header, &client_response, &context);
+    if (RCL_RET_CLIENT_TAKE_FAILED == ret) {
+      rcl_reset_error();
+    }
+  } while (RCL_RET_OK != ret &&
+    std::chrono::steady_clock::now() < start + std::chrono::seconds(10));
+  ASSERT_EQ(RCL_RET_OK, ret) << rcl_get_error_string().str;
+  EXPECT_EQ(&context_marker, context);
+  EXPECT_EQ(7u, client_response.uint64_value);
+  test_msgs__srv__BasicTypes_Response__fini(&client_response);
+
+  ASSERT_EQ(RCL_RET_OK, rcl_client_fini_pipeline(&client)) << rcl_get_error_string().str;
+}
+
+/* Round trip of a request sent through the completion-context async API.
+ */
+TEST_F(CLASSNAME(TestServiceFixture, RMW_IMPLEMENTATION), test_service_async_completion) {
+  rcl_ret_t ret;
+  const rosidl_service_type_support_t * ts = ROSIDL_GET_SRV_TYPE_SUPPORT(
+    test_msgs, srv, BasicTypes);
+  const char * topic = "primitives_async";
+
+  rcl_service_t service = rcl_get_zero_initialized_service();
+  rcl_service_options_t service_options = rcl_service_get_default_options();
+  ret = rcl_service_init(&service, this->node_ptr, ts, topic, &service_options);
+  ASSERT_EQ(RCL_RET_OK, ret) << rcl_get_error_string().str;
+  OSRF_TESTING_TOOLS_CPP_SCOPE_EXIT(
+  {
+    rcl_ret_t ret = rcl_service_fini(&service, this->node_ptr);
+    EXPECT_EQ(RCL_RET_OK, ret) << rcl_get_error_string().str;
+  });
+
+  rcl_client_t client = rcl_get_zero_initialized_client();
+  rcl_client_options_t client_options = rcl_client_get_default_options();
+  ret = rcl_client_init(&client, this->node_ptr, ts, topic, &client_options);
+  ASSERT_EQ(RCL_RET_OK, ret) << rcl_get_error_string().str;
+  OSRF_TESTING_TOOLS_CPP_SCOPE_EXIT(
+  {
+    rcl_ret_t ret = rcl_client_fini(&client, this->node_ptr);
+    EXPECT_EQ(RCL_RET_OK, ret) << rcl_get_error_string().str;
+  });
+
+  // an awaiter-style state block the completion hook fills in
+  struct Awaiter
+  {
+    bool resumed = false;
+    uint64_t response_value = 0u;
+  } awaiter;
+  rcl_client_completion_context_t completion_context;
+  completion_context.on_complete = [](rcl_client_completion_context_t * context) {
+      auto * a = static_cast<Awaiter *>(context->user_data);
+      a->resumed = true;
+      a->response_value =
+        static_cast<test_msgs__srv__BasicTypes_Response *>(context->ros_response)->uint64_value;
+    };
+  completion_context.user_data = &awaiter;
+
+  test_msgs__srv__BasicTypes_Request client_request;
+  test_msgs__srv__BasicTypes_Request__init(&client_request);
+  client_request.bool_value = false;
+  client_request.uint8_value = 4;
+  client_request.uint32_value = 5;
+  OSRF_TESTING_TOOLS_CPP_SCOPE_EXIT(
+  {
+    test_msgs__srv__BasicTypes_Request__fini(&client_request);
+  });
+
+  // sending requires a completion hook and an initialized pipeline
+  rcl_client_completion_context_t bad_context = completion_context;
+  bad_context.on_complete = nullptr;
+  EXPECT_EQ(
+    RCL_RET_INVALID_ARGUMENT,
+    rcl_client_async_send_request(&client, &client_request, &bad_context));
+  rcl_reset_error();
+  EXPECT_EQ(
+    RCL_RET_INVALID_ARGUMENT,
+    rcl_client_async_send_request(&client, &client_request, &completion_context));
+  rcl_reset_error();
+  ASSERT_EQ(RCL_RET_OK, rcl_client_init_pipeline(&client, 4)) << rcl_get_error_string().str;
+
+  ASSERT_TRUE(wait_for_server_to_be_available(this->node_ptr, &client, 10, 1000));
+  ret = rcl_client_async_send_request(&client, &client_request, &completion_context);
+  ASSERT_EQ(RCL_RET_OK, ret) << rcl_get_error_string().str;
+  EXPECT_EQ(1, completion_context.sequence_number);
+
+  // the service answers the request
+  ASSERT_TRUE(wait_for_service_to_be_ready(&service, context_ptr, 10, 100));
+  {
+    test_msgs__srv__BasicTypes_Request service_request;
+    test_msgs__srv__BasicTypes_Request__init(&service_request);
+    test_msgs__srv__BasicTypes_Response service_response;
+    test_msgs__srv__BasicTypes_Response__init(&service_response);
+    rmw_service_info_t header;
+    ret = rcl_take_request_with_info(&service, &header, &service_request);
+    ASSERT_EQ(RCL_RET_OK, ret) << rcl_get_error_string().str;
+    service_response.uint64_value = service_request.uint8_value + service_request.uint32_value;
+    ret = rcl_send_response(&service, &header.request_id, &service_response);
+    ASSERT_EQ(RCL_RET_OK, ret) << rcl_get_error_string().str;
+    test_msgs__srv__BasicTypes_Request__fini(&service_request);
+    test_msgs__srv__BasicTypes_Response__fini(&service_response);
+  }
+
+  // draining completes the context
+  test_msgs__srv__BasicTypes_Response client_response;
+  test_msgs__srv__BasicTypes_Response__init(&client_response);
+  auto start = std::chrono::steady_clock::now();
+  do {
+    size_t drained = 0u;
+    ret = rcl_client_drain_responses(&client, &client_response, &drained);
+    if (RCL_RET_CLIENT_TAKE_FAILED == ret) {
+      rcl_reset_error();
+    } else {
+      ASSERT_EQ(RCL_RET_OK, ret) << rcl_get_error_string().str;
+    }
+  } while (!awaiter.resumed &&
+    std::chrono::steady_clock::now() < start + std::chrono::seconds(10));
+  test_msgs__srv__BasicTypes_Response__fini(&client_response);
+  ASSERT_TRUE(awaiter.resumed);
+  EXPECT_EQ(9u, awaiter.response_value);
+  // the borrowed response pointer does not outlive the completion
+  EXPECT_EQ(nullptr, completion_context.ros_response);
+
+  ASSERT_EQ(RCL_RET_OK, rcl_client_fini_pipeline(&client)) << rcl_get_error_string().str;
+}
+
 /* Basic nominal test of a service with rcl_take_response
  */
 TEST_F(CLASSNAME(TestServiceFixture, RMW_IMPLEMENTATION), test_service_without_info) {
@@ -469,6 +862,61 @@ TEST_F(CLASSNAME(TestServiceFixture, RMW_IMPLEMENTATION), test_service_fail_name
   rcl_reset_error();
 }
 
+/* Test creating a client/service pair from one up-front name resolution.
+ */
+TEST_F(CLASSNAME(TestServiceFixture, RMW_IMPLEMENTATION), test_service_init_resolved_name) {
+  const rosidl_service_type_support_t * ts = ROSIDL_GET_SRV_TYPE_SUPPORT(
+    test_msgs, srv, BasicTypes);
+  rcl_service_t service = rcl_get_zero_initialized_service();
+  rcl_client_t client = rcl_get_zero_initialized_client();
+  rcl_service_options_t service_options = rcl_service_get_default_options();
+  rcl_client_options_t client_options = rcl_client_get_default_options();
+
+  // non-fully-qualified names are rejected without touching rmw
+  EXPECT_EQ(
+    RCL_RET_SERVICE_NAME_INVALID,
+    rcl_service_init_with_resolved_name(
+      &service, this->node_ptr, ts, "paired", &service_options));
+  rcl_reset_error();
+  EXPECT_EQ(
+    RCL_RET_SERVICE_NAME_INVALID,
+    rcl_client_init_with_resolved_name(
+      &client, this->node_ptr, ts, "paired", &client_options));
+  rcl_reset_error();
+
+  // resolve the base name once, then bring up both ends from the result
+  rcl_allocator_t allocator = rcl_get_default_allocator();
+  char * resolved_name = NULL;
+  rcl_ret_t ret = rcl_node_resolve_name(
+    this->node_ptr, "paired", allocator, true, false, &resolved_name);
+  ASSERT_EQ(RCL_RET_OK, ret) << rcl_get_error_string().str;
+  OSRF_TESTING_TOOLS_CPP_SCOPE_EXIT(
+  {
+    allocator.deallocate(resolved_name, allocator.state);
+  });
+
+  ret = rcl_service_init_with_resolved_name(
+    &service, this->node_ptr, ts, resolved_name, &service_options);
+  ASSERT_EQ(RCL_RET_OK, ret) << rcl_get_error_string().str;
+  OSRF_TESTING_TOOLS_CPP_SCOPE_EXIT(
+  {
+    rcl_ret_t ret = rcl_service_fini(&service, this->node_ptr);
+    EXPECT_EQ(RCL_RET_OK, ret) << rcl_get_error_string().str;
+  });
+  ret = rcl_client_init_with_resolved_name(
+    &client, this->node_ptr, ts, resolved_name, &client_options);
+  ASSERT_EQ(RCL_RET_OK, ret) << rcl_get_error_string().str;
+  OSRF_TESTING_TOOLS_CPP_SCOPE_EXIT(
+  {
+    rcl_ret_t ret = rcl_client_fini(&client, this->node_ptr);
+    EXPECT_EQ(RCL_RET_OK, ret) << rcl_get_error_string().str;
+  });
+
+  EXPECT_STREQ(resolved_name, rcl_service_get_service_name(&service));
+  EXPECT_STREQ(resolved_name, rcl_client_get_service_name(&client));
+  ASSERT_TRUE(wait_for_server_to_be_available(this->node_ptr, &client, 10, 1000));
+}
+
 // Define dummy comparison operators for rcutils_allocator_t type for use with the Mimick Library
 MOCKING_UTILS_BOOL_OPERATOR_RETURNS_FALSE(rcutils_allocator_t, ==)
 MOCKING_UTILS_BOOL_OPERATOR_RETURNS_FALSE(rcutils_allocator_t, <)
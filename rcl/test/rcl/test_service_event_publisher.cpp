@@ -276,6 +276,98 @@ TEST_F(
   ASSERT_EQ(test_req.uint32_value, event_msg.request.data[0].uint32_value);
 }
 
+/* Test that a payload cap degrades oversized contents events to metadata form
+ */
+TEST_F(
+  CLASSNAME(TestServiceEventPublisherFixture, RMW_IMPLEMENTATION),
+  test_service_event_publisher_payload_limit)
+{
+  uint8_t guid[16] = {0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15};
+  auto sub_opts = rcl_subscription_get_default_options();
+  std::string topic = "test_service_event_publisher_payload_limit";
+  std::string service_event_topic = topic + RCL_SERVICE_INTROSPECTION_TOPIC_POSTFIX;
+  rcl_ret_t ret;
+
+  rcl_service_event_publisher_t service_event_publisher =
+    rcl_get_zero_initialized_service_event_publisher();
+
+  ret = rcl_service_event_publisher_init(
+    &service_event_publisher, node_ptr, clock_ptr, rcl_publisher_get_default_options(),
+    topic.c_str(), srv_ts);
+  ASSERT_EQ(RCL_RET_OK, ret) << rcl_get_error_string().str;
+  OSRF_TESTING_TOOLS_CPP_SCOPE_EXIT(
+  {
+    ret = rcl_service_event_publisher_fini(&service_event_publisher, node_ptr);
+    EXPECT_EQ(RCL_RET_OK, ret) << rcl_get_error_string().str;
+  });
+
+  ret = rcl_service_event_publisher_change_state(
+    &service_event_publisher, RCL_SERVICE_INTROSPECTION_CONTENTS);
+  ASSERT_EQ(RCL_RET_OK, ret) << rcl_get_error_string().str;
+
+  ret = rcl_service_event_publisher_set_payload_limit(nullptr, 1u);
+  EXPECT_EQ(RCL_RET_ERROR, ret);
+  rcutils_reset_error();
+
+  rcl_subscription_t subscription = rcl_get_zero_initialized_subscription();
+  ret = rcl_subscription_init(
+    &subscription, node_ptr, srv_ts->event_typesupport, service_event_topic.c_str(), &sub_opts);
+  ASSERT_EQ(RCL_RET_OK, ret) << rcl_get_error_string().str;
+  OSRF_TESTING_TOOLS_CPP_SCOPE_EXIT(
+  {
+    ret = rcl_subscription_fini(&subscription, this->node_ptr);
+    EXPECT_EQ(RCL_RET_OK, ret) << rcl_get_error_string().str;
+  });
+
+  ASSERT_TRUE(wait_for_established_subscription(service_event_publisher.publisher, 10, 100));
+
+  test_msgs__srv__BasicTypes_Request test_req;
+  memset(&test_req, 0, sizeof(test_msgs__srv__BasicTypes_Request));
+  test_msgs__srv__BasicTypes_Request__init(&test_req);
+  test_req.uint32_value = 123;
+  OSRF_TESTING_TOOLS_CPP_SCOPE_EXIT({test_msgs__srv__BasicTypes_Request__fini(&test_req);});
+
+  // a one byte cap cannot fit any serialized event, so the payload is dropped
+  ret = rcl_service_event_publisher_set_payload_limit(&service_event_publisher, 1u);
+  ASSERT_EQ(RCL_RET_OK, ret) << rcl_get_error_string().str;
+
+  ret = rcl_send_service_event_message(
+    &service_event_publisher, service_msgs__msg__ServiceEventInfo__REQUEST_RECEIVED, &test_req, 1,
+    guid);
+  ASSERT_EQ(RCL_RET_OK, ret) << rcl_get_error_string().str;
+
+  ASSERT_TRUE(wait_for_subscription_to_be_ready(&subscription, context_ptr, 10, 100));
+
+  rmw_message_info_t message_info = rmw_get_zero_initialized_message_info();
+  test_msgs__srv__BasicTypes_Event event_msg;
+  test_msgs__srv__BasicTypes_Event__init(&event_msg);
+  OSRF_TESTING_TOOLS_CPP_SCOPE_EXIT({test_msgs__srv__BasicTypes_Event__fini(&event_msg);});
+  ret = rcl_take(&subscription, &event_msg, &message_info, nullptr);
+  ASSERT_EQ(RCL_RET_OK, ret) << rcl_get_error_string().str;
+  ASSERT_EQ(1, event_msg.info.sequence_number);
+  EXPECT_EQ(0U, event_msg.request.size);
+  EXPECT_EQ(0U, event_msg.response.size);
+
+  // a generous cap lets the event through unchanged
+  ret = rcl_service_event_publisher_set_payload_limit(&service_event_publisher, 4096u);
+  ASSERT_EQ(RCL_RET_OK, ret) << rcl_get_error_string().str;
+
+  ret = rcl_send_service_event_message(
+    &service_event_publisher, service_msgs__msg__ServiceEventInfo__REQUEST_RECEIVED, &test_req, 2,
+    guid);
+  ASSERT_EQ(RCL_RET_OK, ret) << rcl_get_error_string().str;
+
+  ASSERT_TRUE(wait_for_subscription_to_be_ready(&subscription, context_ptr, 10, 100));
+
+  test_msgs__srv__BasicTypes_Event__fini(&event_msg);
+  test_msgs__srv__BasicTypes_Event__init(&event_msg);
+  ret = rcl_take(&subscription, &event_msg, &message_info, nullptr);
+  ASSERT_EQ(RCL_RET_OK, ret) << rcl_get_error_string().str;
+  ASSERT_EQ(2, event_msg.info.sequence_number);
+  ASSERT_EQ(1U, event_msg.request.size);
+  EXPECT_EQ(test_req.uint32_value, event_msg.request.data[0].uint32_value);
+}
+
 TEST_F(
   CLASSNAME(TestServiceEventPublisherFixture, RMW_IMPLEMENTATION),
   test_service_event_publisher_send_message_return_codes)
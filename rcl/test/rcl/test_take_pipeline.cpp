@@ -0,0 +1,204 @@
+// Copyright 2026 Open Source Robotics Foundation, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <gtest/gtest.h>
+
+#include "rcl/take_pipeline.h"
+#include "rcl/rcl.h"
+#include "rcl/error_handling.h"
+
+#include "osrf_testing_tools_cpp/scope_exit.hpp"
+#include "test_msgs/msg/basic_types.h"
+
+#include "wait_for_entity_helpers.hpp"
+
+#ifdef RMW_IMPLEMENTATION
+# define CLASSNAME_(NAME, SUFFIX) NAME ## __ ## SUFFIX
+# define CLASSNAME(NAME, SUFFIX) CLASSNAME_(NAME, SUFFIX)
+#else
+# define CLASSNAME(NAME, SUFFIX) NAME
+#endif
+
+class CLASSNAME (TestTakePipelineFixture, RMW_IMPLEMENTATION) : public ::testing::Test
+{
+public:
+  rcl_context_t * context_ptr;
+  rcl_node_t * node_ptr;
+  void SetUp()
+  {
+    rcl_ret_t ret;
+    {
+      rcl_init_options_t init_options = rcl_get_zero_initialized_init_options();
+      ret = rcl_init_options_init(&init_options, rcl_get_default_allocator());
+      ASSERT_EQ(RCL_RET_OK, ret) << rcl_get_error_string().str;
+      OSRF_TESTING_TOOLS_CPP_SCOPE_EXIT(
+      {
+        EXPECT_EQ(RCL_RET_OK, rcl_init_options_fini(&init_options)) << rcl_get_error_string().str;
+      });
+      this->context_ptr = new rcl_context_t;
+      *this->context_ptr = rcl_get_zero_initialized_context();
+      ret = rcl_init(0, nullptr, &init_options, this->context_ptr);
+      ASSERT_EQ(RCL_RET_OK, ret) << rcl_get_error_string().str;
+    }
+    this->node_ptr = new rcl_node_t;
+    *this->node_ptr = rcl_get_zero_initialized_node();
+    constexpr char name[] = "test_take_pipeline_node";
+    rcl_node_options_t node_options = rcl_node_get_default_options();
+    ret = rcl_node_init(this->node_ptr, name, "", this->context_ptr, &node_options);
+    ASSERT_EQ(RCL_RET_OK, ret) << rcl_get_error_string().str;
+  }
+
+  void TearDown()
+  {
+    rcl_ret_t ret = rcl_node_fini(this->node_ptr);
+    delete this->node_ptr;
+    EXPECT_EQ(RCL_RET_OK, ret) << rcl_get_error_string().str;
+    ret = rcl_shutdown(this->context_ptr);
+    EXPECT_EQ(RCL_RET_OK, ret) << rcl_get_error_string().str;
+    ret = rcl_context_fini(this->context_ptr);
+    delete this->context_ptr;
+    EXPECT_EQ(RCL_RET_OK, ret) << rcl_get_error_string().str;
+  }
+};
+
+/* Staged take, decode and dispatch through the pipeline.
+ */
+TEST_F(
+  CLASSNAME(TestTakePipelineFixture, RMW_IMPLEMENTATION), test_take_pipeline_round_trip)
+{
+  rcl_ret_t ret;
+  const rosidl_message_type_support_t * ts =
+    ROSIDL_GET_MSG_TYPE_SUPPORT(test_msgs, msg, BasicTypes);
+  constexpr char topic[] = "rcl_test_take_pipeline_chatter";
+  rcl_publisher_t publisher = rcl_get_zero_initialized_publisher();
+  rcl_publisher_options_t publisher_options = rcl_publisher_get_default_options();
+  ret = rcl_publisher_init(&publisher, this->node_ptr, ts, topic, &publisher_options);
+  ASSERT_EQ(RCL_RET_OK, ret) << rcl_get_error_string().str;
+  OSRF_TESTING_TOOLS_CPP_SCOPE_EXIT(
+  {
+    rcl_ret_t ret = rcl_publisher_fini(&publisher, this->node_ptr);
+    EXPECT_EQ(RCL_RET_OK, ret) << rcl_get_error_string().str;
+  });
+  rcl_subscription_t subscription = rcl_get_zero_initialized_subscription();
+  rcl_subscription_options_t subscription_options = rcl_subscription_get_default_options();
+  ret = rcl_subscription_init(&subscription, this->node_ptr, ts, topic, &subscription_options);
+  ASSERT_EQ(RCL_RET_OK, ret) << rcl_get_error_string().str;
+  OSRF_TESTING_TOOLS_CPP_SCOPE_EXIT(
+  {
+    rcl_ret_t ret = rcl_subscription_fini(&subscription, this->node_ptr);
+    EXPECT_EQ(RCL_RET_OK, ret) << rcl_get_error_string().str;
+  });
+
+  constexpr size_t depth = 4;
+  test_msgs__msg__BasicTypes messages[depth];
+  void * message_ptrs[depth];
+  for (size_t i = 0; i < depth; ++i) {
+    ASSERT_TRUE(test_msgs__msg__BasicTypes__init(&messages[i]));
+    message_ptrs[i] = &messages[i];
+  }
+  OSRF_TESTING_TOOLS_CPP_SCOPE_EXIT(
+  {
+    for (size_t i = 0; i < depth; ++i) {
+      test_msgs__msg__BasicTypes__fini(&messages[i]);
+    }
+  });
+
+  rcl_take_pipeline_t pipeline = rcl_get_zero_initialized_take_pipeline();
+  size_t count = 0;
+
+  // stages and the getter reject a zero initialized pipeline
+  EXPECT_EQ(RCL_RET_NOT_INIT, rcl_take_pipeline_pump(&pipeline, &count));
+  rcl_reset_error();
+  EXPECT_EQ(nullptr, rcl_take_pipeline_get_guard_condition(&pipeline));
+
+  // invalid init arguments
+  EXPECT_EQ(
+    RCL_RET_INVALID_ARGUMENT,
+    rcl_take_pipeline_init(
+      &pipeline, &subscription, this->context_ptr, message_ptrs, 0,
+      rcl_get_default_allocator()));
+  rcl_reset_error();
+  EXPECT_EQ(
+    RCL_RET_INVALID_ARGUMENT,
+    rcl_take_pipeline_init(
+      &pipeline, &subscription, this->context_ptr, nullptr, depth,
+      rcl_get_default_allocator()));
+  rcl_reset_error();
+
+  ASSERT_EQ(
+    RCL_RET_OK,
+    rcl_take_pipeline_init(
+      &pipeline, &subscription, this->context_ptr, message_ptrs, depth,
+      rcl_get_default_allocator())) << rcl_get_error_string().str;
+  OSRF_TESTING_TOOLS_CPP_SCOPE_EXIT(
+  {
+    EXPECT_EQ(RCL_RET_OK, rcl_take_pipeline_fini(&pipeline)) << rcl_get_error_string().str;
+  });
+  EXPECT_EQ(
+    RCL_RET_ALREADY_INIT,
+    rcl_take_pipeline_init(
+      &pipeline, &subscription, this->context_ptr, message_ptrs, depth,
+      rcl_get_default_allocator()));
+  rcl_reset_error();
+  ASSERT_NE(nullptr, rcl_take_pipeline_get_guard_condition(&pipeline));
+
+  // nothing published yet: every stage reports an expected take failure
+  EXPECT_EQ(RCL_RET_SUBSCRIPTION_TAKE_FAILED, rcl_take_pipeline_pump(&pipeline, &count));
+  EXPECT_EQ(0u, count);
+  EXPECT_EQ(RCL_RET_SUBSCRIPTION_TAKE_FAILED, rcl_take_pipeline_decode(&pipeline, &count));
+  void * taken_message = nullptr;
+  EXPECT_EQ(
+    RCL_RET_SUBSCRIPTION_TAKE_FAILED,
+    rcl_take_pipeline_take_message(&pipeline, &taken_message, nullptr));
+
+  ASSERT_TRUE(wait_for_established_subscription(&publisher, 10, 100));
+  test_msgs__msg__BasicTypes sent;
+  ASSERT_TRUE(test_msgs__msg__BasicTypes__init(&sent));
+  OSRF_TESTING_TOOLS_CPP_SCOPE_EXIT(
+  {
+    test_msgs__msg__BasicTypes__fini(&sent);
+  });
+  sent.uint32_value = 20260829u;
+  ret = rcl_publish(&publisher, &sent, nullptr);
+  ASSERT_EQ(RCL_RET_OK, ret) << rcl_get_error_string().str;
+  ASSERT_TRUE(wait_for_subscription_to_be_ready(&subscription, this->context_ptr, 10, 100));
+
+  // pump stages the serialized sample, decode deserializes it
+  ASSERT_EQ(RCL_RET_OK, rcl_take_pipeline_pump(&pipeline, &count)) << rcl_get_error_string().str;
+  EXPECT_EQ(1u, count);
+  ASSERT_EQ(RCL_RET_OK, rcl_take_pipeline_decode(&pipeline, &count)) << rcl_get_error_string().str;
+  EXPECT_EQ(1u, count);
+
+  rmw_message_info_t message_info;
+  ASSERT_EQ(
+    RCL_RET_OK,
+    rcl_take_pipeline_take_message(&pipeline, &taken_message, &message_info)) <<
+    rcl_get_error_string().str;
+  ASSERT_NE(nullptr, taken_message);
+  EXPECT_EQ(20260829u, static_cast<test_msgs__msg__BasicTypes *>(taken_message)->uint32_value);
+  // the message borrows one of the caller-provided slots
+  EXPECT_GE(taken_message, static_cast<void *>(&messages[0]));
+  EXPECT_LE(taken_message, static_cast<void *>(&messages[depth - 1]));
+
+  // a foreign pointer is rejected, the lent slot is recycled cleanly
+  EXPECT_EQ(RCL_RET_INVALID_ARGUMENT, rcl_take_pipeline_return_message(&pipeline, &sent));
+  rcl_reset_error();
+  EXPECT_EQ(RCL_RET_OK, rcl_take_pipeline_return_message(&pipeline, taken_message)) <<
+    rcl_get_error_string().str;
+
+  // drained again after the round trip
+  EXPECT_EQ(
+    RCL_RET_SUBSCRIPTION_TAKE_FAILED,
+    rcl_take_pipeline_take_message(&pipeline, &taken_message, nullptr));
+}
@@ -834,3 +834,124 @@ TEST(CLASSNAME(rcl_time, RMW_IMPLEMENTATION), fail_ros_time_override) {
   EXPECT_EQ(RCL_RET_ERROR, rcl_set_ros_time_override(&ros_clock, set_point));
   rcl_reset_error();
 }
+
+static size_t threshold_calls_small = 0;
+static size_t threshold_calls_large = 0;
+static void small_threshold_callback(
+  const rcl_time_jump_t * time_jump, bool before_jump, void * user_data)
+{
+  (void)time_jump;
+  (void)user_data;
+  if (!before_jump) {
+    threshold_calls_small++;
+  }
+}
+static void large_threshold_callback(
+  const rcl_time_jump_t * time_jump, bool before_jump, void * user_data)
+{
+  (void)time_jump;
+  (void)user_data;
+  if (!before_jump) {
+    threshold_calls_large++;
+  }
+}
+
+// A jump only reaches the callbacks whose thresholds it crosses.
+TEST(CLASSNAME(rcl_time, RMW_IMPLEMENTATION), jump_callback_threshold_index) {
+  rcl_clock_t ros_clock;
+  rcl_allocator_t allocator = rcl_get_default_allocator();
+  ASSERT_EQ(RCL_RET_OK, rcl_clock_init(RCL_ROS_TIME, &ros_clock, &allocator)) <<
+    rcl_get_error_string().str;
+  OSRF_TESTING_TOOLS_CPP_SCOPE_EXIT(
+  {
+    EXPECT_EQ(RCL_RET_OK, rcl_clock_fini(&ros_clock)) << rcl_get_error_string().str;
+  });
+  ASSERT_EQ(RCL_RET_OK, rcl_enable_ros_time_override(&ros_clock));
+  ASSERT_EQ(RCL_RET_OK, rcl_set_ros_time_override(&ros_clock, RCL_S_TO_NS(1)));
+
+  rcl_jump_threshold_t small_threshold;
+  small_threshold.on_clock_change = false;
+  small_threshold.min_forward.nanoseconds = RCL_MS_TO_NS(1);
+  small_threshold.min_backward.nanoseconds = -RCL_MS_TO_NS(1);
+  rcl_jump_threshold_t large_threshold;
+  large_threshold.on_clock_change = false;
+  large_threshold.min_forward.nanoseconds = RCL_S_TO_NS(10);
+  large_threshold.min_backward.nanoseconds = -RCL_S_TO_NS(10);
+  // Registered large-first to make sure selection is by threshold, not order.
+  ASSERT_EQ(
+    RCL_RET_OK,
+    rcl_clock_add_jump_callback(&ros_clock, large_threshold, large_threshold_callback, NULL)) <<
+    rcl_get_error_string().str;
+  ASSERT_EQ(
+    RCL_RET_OK,
+    rcl_clock_add_jump_callback(&ros_clock, small_threshold, small_threshold_callback, NULL)) <<
+    rcl_get_error_string().str;
+
+  // A 1s forward jump crosses only the small threshold.
+  threshold_calls_small = 0;
+  threshold_calls_large = 0;
+  ASSERT_EQ(RCL_RET_OK, rcl_set_ros_time_override(&ros_clock, RCL_S_TO_NS(2)));
+  EXPECT_EQ(1u, threshold_calls_small);
+  EXPECT_EQ(0u, threshold_calls_large);
+
+  // A 20s backward jump crosses both thresholds.
+  ASSERT_EQ(RCL_RET_OK, rcl_set_ros_time_override(&ros_clock, RCL_S_TO_NS(2) - RCL_S_TO_NS(20)));
+  EXPECT_EQ(2u, threshold_calls_small);
+  EXPECT_EQ(1u, threshold_calls_large);
+
+  // Removing a callback keeps the index consistent.
+  ASSERT_EQ(
+    RCL_RET_OK,
+    rcl_clock_remove_jump_callback(&ros_clock, small_threshold_callback, NULL));
+  ASSERT_EQ(RCL_RET_OK, rcl_set_ros_time_override(&ros_clock, RCL_S_TO_NS(100)));
+  EXPECT_EQ(2u, threshold_calls_small);
+  EXPECT_EQ(2u, threshold_calls_large);
+}
+
+// The coarse clock only advances when it is explicitly updated.
+TEST(CLASSNAME(rcl_time, RMW_IMPLEMENTATION), coarse_clock) {
+  rcl_clock_t clock;
+  rcl_allocator_t allocator = rcl_get_default_allocator();
+  EXPECT_EQ(
+    RCL_RET_INVALID_ARGUMENT,
+    rcl_coarse_clock_init(&clock, RCL_ROS_TIME, &allocator));
+  rcl_reset_error();
+  ASSERT_EQ(RCL_RET_OK, rcl_coarse_clock_init(&clock, RCL_STEADY_TIME, &allocator)) <<
+    rcl_get_error_string().str;
+  OSRF_TESTING_TOOLS_CPP_SCOPE_EXIT(
+  {
+    EXPECT_EQ(RCL_RET_OK, rcl_coarse_clock_fini(&clock)) << rcl_get_error_string().str;
+  });
+  EXPECT_EQ(RCL_COARSE_TIME, clock.type);
+
+  // The cache is seeded at init, and is stable between updates.
+  rcl_time_point_value_t first = 0;
+  ASSERT_EQ(RCL_RET_OK, rcl_clock_get_now(&clock, &first)) << rcl_get_error_string().str;
+  EXPECT_NE(0, first);
+  std::this_thread::sleep_for(std::chrono::milliseconds(1));
+  rcl_time_point_value_t second = 0;
+  ASSERT_EQ(RCL_RET_OK, rcl_clock_get_now(&clock, &second));
+  EXPECT_EQ(first, second);
+
+  // An update publishes a fresh sample of the underlying source.
+  std::this_thread::sleep_for(std::chrono::milliseconds(1));
+  ASSERT_EQ(RCL_RET_OK, rcl_coarse_clock_update(&clock)) << rcl_get_error_string().str;
+  rcl_time_point_value_t third = 0;
+  ASSERT_EQ(RCL_RET_OK, rcl_clock_get_now(&clock, &third));
+  EXPECT_GT(third, second);
+
+  // rcl_clock_init dispatches to a system-time-sourced coarse clock.
+  rcl_clock_t default_coarse_clock;
+  ASSERT_EQ(RCL_RET_OK, rcl_clock_init(RCL_COARSE_TIME, &default_coarse_clock, &allocator)) <<
+    rcl_get_error_string().str;
+  EXPECT_EQ(RCL_RET_OK, rcl_clock_fini(&default_coarse_clock)) << rcl_get_error_string().str;
+
+  // Update and fini reject other clock types.
+  rcl_clock_t steady_clock;
+  ASSERT_EQ(RCL_RET_OK, rcl_clock_init(RCL_STEADY_TIME, &steady_clock, &allocator));
+  EXPECT_EQ(RCL_RET_ERROR, rcl_coarse_clock_update(&steady_clock));
+  rcl_reset_error();
+  EXPECT_EQ(RCL_RET_ERROR, rcl_coarse_clock_fini(&steady_clock));
+  rcl_reset_error();
+  EXPECT_EQ(RCL_RET_OK, rcl_clock_fini(&steady_clock));
+}
@@ -21,6 +21,7 @@
 #include "rcl/rcl.h"
 
 #include "osrf_testing_tools_cpp/scope_exit.hpp"
+#include "rcl/entity_cost.h"
 #include "rcl/error_handling.h"
 
 #include "./allocator_testing_utils.h"
@@ -947,3 +948,213 @@ TEST_F(TestPreInitTimer, test_time_since_last_call) {
   ASSERT_EQ(RCL_RET_OK, rcl_timer_get_time_since_last_call(&timer, &time_sice_next_call_end));
   EXPECT_GT(time_sice_next_call_end, time_sice_next_call_start);
 }
+
+TEST_F(TestTimerFixture, test_timers_call_ready) {
+  rcl_ret_t ret;
+  rcl_clock_t clock;
+  rcl_allocator_t allocator = rcl_get_default_allocator();
+  ASSERT_EQ(RCL_RET_OK, rcl_clock_init(RCL_STEADY_TIME, &clock, &allocator));
+  // Two timers due immediately, one far in the future and one canceled.
+  rcl_timer_t timers[4];
+  const int64_t periods[4] = {0, 0, RCL_S_TO_NS(3600), 0};
+  for (size_t i = 0; i < 4; ++i) {
+    timers[i] = rcl_get_zero_initialized_timer();
+    ret = rcl_timer_init(
+      &timers[i], &clock, this->context_ptr, periods[i], callback_function,
+      rcl_get_default_allocator());
+    ASSERT_EQ(RCL_RET_OK, ret) << rcl_get_error_string().str;
+  }
+  OSRF_TESTING_TOOLS_CPP_SCOPE_EXIT(
+  {
+    for (size_t i = 0; i < 4; ++i) {
+      EXPECT_EQ(RCL_RET_OK, rcl_timer_fini(&timers[i])) << rcl_get_error_string().str;
+    }
+    EXPECT_EQ(RCL_RET_OK, rcl_clock_fini(&clock)) << rcl_get_error_string().str;
+  });
+  ASSERT_EQ(RCL_RET_OK, rcl_timer_cancel(&timers[3]));
+
+  times_called = 0;
+  rcl_timer_t * timer_ptrs[5] = {
+    &timers[0], nullptr, &timers[1], &timers[2], &timers[3]};
+  size_t number_called = 0;
+  ret = rcl_timers_call_ready(timer_ptrs, 5, &number_called);
+  ASSERT_EQ(RCL_RET_OK, ret) << rcl_get_error_string().str;
+  EXPECT_EQ(2u, number_called);
+  EXPECT_EQ(2, times_called);
+
+  EXPECT_EQ(RCL_RET_INVALID_ARGUMENT, rcl_timers_call_ready(nullptr, 1, &number_called));
+  rcl_reset_error();
+}
+
+TEST_F(TestTimerFixture, test_timers_reset_staggered) {
+  rcl_ret_t ret;
+  rcl_clock_t clock;
+  rcl_allocator_t allocator = rcl_get_default_allocator();
+  ASSERT_EQ(RCL_RET_OK, rcl_clock_init(RCL_STEADY_TIME, &clock, &allocator));
+  rcl_timer_t timers[4];
+  for (size_t i = 0; i < 4; ++i) {
+    timers[i] = rcl_get_zero_initialized_timer();
+    ret = rcl_timer_init(
+      &timers[i], &clock, this->context_ptr, RCL_S_TO_NS(1), nullptr,
+      rcl_get_default_allocator());
+    ASSERT_EQ(RCL_RET_OK, ret) << rcl_get_error_string().str;
+  }
+  OSRF_TESTING_TOOLS_CPP_SCOPE_EXIT(
+  {
+    for (size_t i = 0; i < 4; ++i) {
+      EXPECT_EQ(RCL_RET_OK, rcl_timer_fini(&timers[i])) << rcl_get_error_string().str;
+    }
+    EXPECT_EQ(RCL_RET_OK, rcl_clock_fini(&clock)) << rcl_get_error_string().str;
+  });
+  rcl_timer_t * timer_ptrs[4] = {&timers[0], &timers[1], &timers[2], &timers[3]};
+
+  // Auto-distribution spreads the due times across one period, in order.
+  ASSERT_EQ(RCL_RET_OK, rcl_timers_reset_staggered(timer_ptrs, 4, nullptr)) <<
+    rcl_get_error_string().str;
+  int64_t time_until[4];
+  for (size_t i = 0; i < 4; ++i) {
+    ASSERT_EQ(RCL_RET_OK, rcl_timer_get_time_until_next_call(&timers[i], &time_until[i]));
+  }
+  for (size_t i = 1; i < 4; ++i) {
+    // Each phase step is a quarter period; clock sampling skew between the
+    // reset and the query only shrinks the observed gap.
+    EXPECT_GT(time_until[i] - time_until[i - 1], RCL_MS_TO_NS(200));
+    EXPECT_LT(time_until[i] - time_until[i - 1], RCL_MS_TO_NS(300));
+  }
+
+  // Explicit offsets are applied verbatim, and a canceled timer is revived.
+  ASSERT_EQ(RCL_RET_OK, rcl_timer_cancel(&timers[0]));
+  const int64_t offsets[4] = {0, RCL_MS_TO_NS(100), RCL_MS_TO_NS(200), RCL_MS_TO_NS(300)};
+  ASSERT_EQ(RCL_RET_OK, rcl_timers_reset_staggered(timer_ptrs, 4, offsets)) <<
+    rcl_get_error_string().str;
+  bool is_canceled = true;
+  ASSERT_EQ(RCL_RET_OK, rcl_timer_is_canceled(&timers[0], &is_canceled));
+  EXPECT_FALSE(is_canceled);
+  for (size_t i = 0; i < 4; ++i) {
+    ASSERT_EQ(RCL_RET_OK, rcl_timer_get_time_until_next_call(&timers[i], &time_until[i]));
+  }
+  for (size_t i = 1; i < 4; ++i) {
+    EXPECT_GT(time_until[i] - time_until[i - 1], RCL_MS_TO_NS(50));
+    EXPECT_LT(time_until[i] - time_until[i - 1], RCL_MS_TO_NS(150));
+  }
+
+  EXPECT_EQ(RCL_RET_INVALID_ARGUMENT, rcl_timers_reset_staggered(nullptr, 1, nullptr));
+  rcl_reset_error();
+  timer_ptrs[1] = nullptr;
+  EXPECT_EQ(RCL_RET_INVALID_ARGUMENT, rcl_timers_reset_staggered(timer_ptrs, 4, nullptr));
+  rcl_reset_error();
+}
+
+TEST_F(TestTimerFixture, test_timer_timing_stats) {
+  rcl_ret_t ret;
+  rcl_clock_t clock;
+  rcl_allocator_t allocator = rcl_get_default_allocator();
+  ASSERT_EQ(RCL_RET_OK, rcl_clock_init(RCL_STEADY_TIME, &clock, &allocator));
+  rcl_timer_t timer = rcl_get_zero_initialized_timer();
+  ret = rcl_timer_init(
+    &timer, &clock, this->context_ptr, 0, callback_function, rcl_get_default_allocator());
+  ASSERT_EQ(RCL_RET_OK, ret) << rcl_get_error_string().str;
+  OSRF_TESTING_TOOLS_CPP_SCOPE_EXIT(
+  {
+    EXPECT_EQ(RCL_RET_OK, rcl_timer_fini(&timer)) << rcl_get_error_string().str;
+    EXPECT_EQ(RCL_RET_OK, rcl_clock_fini(&clock)) << rcl_get_error_string().str;
+  });
+
+  rcl_timer_timing_sample_t samples[4];
+  size_t number_of_samples = 0;
+  uint64_t fire_count = 0;
+
+  // Stats are rejected until instrumentation is enabled.
+  EXPECT_EQ(
+    RCL_RET_INVALID_ARGUMENT,
+    rcl_timer_get_timing_stats(&timer, samples, 4, &number_of_samples, &fire_count));
+  rcl_reset_error();
+  EXPECT_EQ(RCL_RET_INVALID_ARGUMENT, rcl_timer_enable_timing_stats(&timer, 0));
+  rcl_reset_error();
+  ASSERT_EQ(RCL_RET_OK, rcl_timer_enable_timing_stats(&timer, 4)) << rcl_get_error_string().str;
+  EXPECT_EQ(RCL_RET_ALREADY_INIT, rcl_timer_enable_timing_stats(&timer, 4));
+  rcl_reset_error();
+
+  // The ring retains the most recent buffer_capacity samples.
+  for (size_t i = 0; i < 6; ++i) {
+    ASSERT_EQ(RCL_RET_OK, rcl_timer_call(&timer)) << rcl_get_error_string().str;
+  }
+  ASSERT_EQ(
+    RCL_RET_OK, rcl_timer_get_timing_stats(&timer, samples, 4, &number_of_samples, &fire_count)) <<
+    rcl_get_error_string().str;
+  EXPECT_EQ(6u, fire_count);
+  ASSERT_EQ(4u, number_of_samples);
+  for (size_t i = 0; i < number_of_samples; ++i) {
+    // A zero-period timer is called at or after its scheduled time, and the
+    // callback duration comes from the steady clock.
+    EXPECT_GE(samples[i].latency, 0);
+    EXPECT_GE(samples[i].callback_duration, 0);
+  }
+
+  // A smaller output buffer receives only the most recent samples.
+  ASSERT_EQ(
+    RCL_RET_OK, rcl_timer_get_timing_stats(&timer, samples, 2, &number_of_samples, nullptr));
+  EXPECT_EQ(2u, number_of_samples);
+
+  EXPECT_EQ(RCL_RET_OK, rcl_timer_disable_timing_stats(&timer));
+  EXPECT_EQ(
+    RCL_RET_INVALID_ARGUMENT,
+    rcl_timer_get_timing_stats(&timer, samples, 4, &number_of_samples, &fire_count));
+  rcl_reset_error();
+  // Disabling twice is a no-op.
+  EXPECT_EQ(RCL_RET_OK, rcl_timer_disable_timing_stats(&timer));
+}
+
+TEST_F(TestTimerFixture, test_timer_cost_accounting) {
+  rcl_ret_t ret;
+  rcl_clock_t clock;
+  rcl_allocator_t allocator = rcl_get_default_allocator();
+  ASSERT_EQ(RCL_RET_OK, rcl_clock_init(RCL_STEADY_TIME, &clock, &allocator));
+  rcl_timer_t timer = rcl_get_zero_initialized_timer();
+  ret = rcl_timer_init(
+    &timer, &clock, this->context_ptr, 0, callback_function, rcl_get_default_allocator());
+  ASSERT_EQ(RCL_RET_OK, ret) << rcl_get_error_string().str;
+  OSRF_TESTING_TOOLS_CPP_SCOPE_EXIT(
+  {
+    EXPECT_EQ(RCL_RET_OK, rcl_timer_fini(&timer)) << rcl_get_error_string().str;
+    EXPECT_EQ(RCL_RET_OK, rcl_clock_fini(&clock)) << rcl_get_error_string().str;
+  });
+
+  EXPECT_EQ(RCL_RET_INVALID_ARGUMENT, rcl_timer_enable_cost_accounting(nullptr));
+  rcl_reset_error();
+
+  rcl_entity_cost_estimate_t estimate;
+  EXPECT_EQ(
+    RCL_RET_INVALID_ARGUMENT,
+    rcl_entity_get_cost_estimate(RCL_ENTITY_TYPE_TIMER, &timer, nullptr));
+  rcl_reset_error();
+  ASSERT_EQ(
+    RCL_RET_OK, rcl_entity_get_cost_estimate(RCL_ENTITY_TYPE_TIMER, &timer, &estimate)) <<
+    rcl_get_error_string().str;
+  EXPECT_EQ(0u, estimate.sample_count);
+
+  // Calls before accounting is enabled are not recorded.
+  ASSERT_EQ(RCL_RET_OK, rcl_timer_call(&timer)) << rcl_get_error_string().str;
+  ASSERT_EQ(RCL_RET_OK, rcl_entity_get_cost_estimate(RCL_ENTITY_TYPE_TIMER, &timer, &estimate));
+  EXPECT_EQ(0u, estimate.sample_count);
+
+  ASSERT_EQ(RCL_RET_OK, rcl_timer_enable_cost_accounting(&timer)) << rcl_get_error_string().str;
+  ASSERT_EQ(RCL_RET_OK, rcl_timer_call(&timer)) << rcl_get_error_string().str;
+  ASSERT_EQ(RCL_RET_OK, rcl_entity_get_cost_estimate(RCL_ENTITY_TYPE_TIMER, &timer, &estimate));
+  EXPECT_EQ(1u, estimate.sample_count);
+  EXPECT_GE(estimate.last_cost_ns, 0);
+  // The first sample seeds the moving average.
+  EXPECT_EQ(estimate.last_cost_ns, estimate.ewma_cost_ns);
+  EXPECT_EQ(estimate.last_cost_ns, estimate.total_cost_ns);
+
+  ASSERT_EQ(RCL_RET_OK, rcl_timer_call(&timer)) << rcl_get_error_string().str;
+  ASSERT_EQ(RCL_RET_OK, rcl_entity_get_cost_estimate(RCL_ENTITY_TYPE_TIMER, &timer, &estimate));
+  EXPECT_EQ(2u, estimate.sample_count);
+  EXPECT_GE(estimate.total_cost_ns, estimate.last_cost_ns);
+
+  // Disabling stops recording but keeps the counters readable.
+  ASSERT_EQ(RCL_RET_OK, rcl_timer_disable_cost_accounting(&timer));
+  ASSERT_EQ(RCL_RET_OK, rcl_timer_call(&timer)) << rcl_get_error_string().str;
+  ASSERT_EQ(RCL_RET_OK, rcl_entity_get_cost_estimate(RCL_ENTITY_TYPE_TIMER, &timer, &estimate));
+  EXPECT_EQ(2u, estimate.sample_count);
+}
@@ -0,0 +1,145 @@
+// Copyright 2026 Open Source Robotics Foundation, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <gtest/gtest.h>
+
+#include "rcl/timer_wheel.h"
+
+#include "rcl/rcl.h"
+
+#include "osrf_testing_tools_cpp/scope_exit.hpp"
+#include "rcl/error_handling.h"
+
+class TestTimerWheelFixture : public ::testing::Test
+{
+public:
+  rcl_context_t * context_ptr;
+  rcl_clock_t clock;
+  void SetUp()
+  {
+    rcl_ret_t ret;
+    {
+      rcl_init_options_t init_options = rcl_get_zero_initialized_init_options();
+      ret = rcl_init_options_init(&init_options, rcl_get_default_allocator());
+      ASSERT_EQ(RCL_RET_OK, ret) << rcl_get_error_string().str;
+      OSRF_TESTING_TOOLS_CPP_SCOPE_EXIT(
+      {
+        EXPECT_EQ(RCL_RET_OK, rcl_init_options_fini(&init_options)) << rcl_get_error_string().str;
+      });
+      this->context_ptr = new rcl_context_t;
+      *this->context_ptr = rcl_get_zero_initialized_context();
+      ret = rcl_init(0, nullptr, &init_options, this->context_ptr);
+      ASSERT_EQ(RCL_RET_OK, ret) << rcl_get_error_string().str;
+    }
+    rcl_allocator_t allocator = rcl_get_default_allocator();
+    ret = rcl_clock_init(RCL_STEADY_TIME, &this->clock, &allocator);
+    ASSERT_EQ(RCL_RET_OK, ret) << rcl_get_error_string().str;
+  }
+
+  void TearDown()
+  {
+    rcl_ret_t ret = rcl_clock_fini(&this->clock);
+    EXPECT_EQ(RCL_RET_OK, ret) << rcl_get_error_string().str;
+    ret = rcl_shutdown(this->context_ptr);
+    EXPECT_EQ(RCL_RET_OK, ret) << rcl_get_error_string().str;
+    ret = rcl_context_fini(this->context_ptr);
+    delete this->context_ptr;
+    EXPECT_EQ(RCL_RET_OK, ret) << rcl_get_error_string().str;
+  }
+};
+
+static size_t wheel_times_called = 0;
+static void wheel_callback(rcl_timer_t * timer, int64_t last_call)
+{
+  (void) timer;
+  (void) last_call;
+  wheel_times_called++;
+}
+
+TEST_F(TestTimerWheelFixture, test_timer_wheel_init_fini) {
+  rcl_timer_wheel_t timer_wheel = rcl_get_zero_initialized_timer_wheel();
+  rcl_ret_t ret = rcl_timer_wheel_init(
+    &timer_wheel, &this->clock, 8, rcl_get_default_allocator());
+  ASSERT_EQ(RCL_RET_OK, ret) << rcl_get_error_string().str;
+  EXPECT_EQ(
+    RCL_RET_ALREADY_INIT,
+    rcl_timer_wheel_init(&timer_wheel, &this->clock, 8, rcl_get_default_allocator()));
+  rcl_reset_error();
+  EXPECT_EQ(0u, rcl_timer_wheel_get_size(&timer_wheel));
+  int64_t time_until = 0;
+  ASSERT_EQ(RCL_RET_OK, rcl_timer_wheel_get_time_until_next_call(&timer_wheel, &time_until));
+  EXPECT_EQ(INT64_MAX, time_until);
+  EXPECT_EQ(RCL_RET_OK, rcl_timer_wheel_fini(&timer_wheel));
+  // A second fini on the zeroed handle is a no-op.
+  EXPECT_EQ(RCL_RET_OK, rcl_timer_wheel_fini(&timer_wheel));
+}
+
+TEST_F(TestTimerWheelFixture, test_timer_wheel_batch) {
+  rcl_timer_wheel_t timer_wheel = rcl_get_zero_initialized_timer_wheel();
+  rcl_ret_t ret = rcl_timer_wheel_init(
+    &timer_wheel, &this->clock, 0, rcl_get_default_allocator());
+  ASSERT_EQ(RCL_RET_OK, ret) << rcl_get_error_string().str;
+  // Two timers that are due immediately and one that is far in the future.
+  rcl_timer_t timers[3];
+  const int64_t periods[3] = {0, 0, RCL_S_TO_NS(3600)};
+  for (size_t i = 0; i < 3; ++i) {
+    timers[i] = rcl_get_zero_initialized_timer();
+    ret = rcl_timer_init(
+      &timers[i], &this->clock, this->context_ptr, periods[i], wheel_callback,
+      rcl_get_default_allocator());
+    ASSERT_EQ(RCL_RET_OK, ret) << rcl_get_error_string().str;
+    ASSERT_EQ(RCL_RET_OK, rcl_timer_wheel_add_timer(&timer_wheel, &timers[i]));
+  }
+  OSRF_TESTING_TOOLS_CPP_SCOPE_EXIT(
+  {
+    for (size_t i = 0; i < 3; ++i) {
+      EXPECT_EQ(RCL_RET_OK, rcl_timer_fini(&timers[i])) << rcl_get_error_string().str;
+    }
+    EXPECT_EQ(RCL_RET_OK, rcl_timer_wheel_fini(&timer_wheel)) << rcl_get_error_string().str;
+  });
+  EXPECT_EQ(3u, rcl_timer_wheel_get_size(&timer_wheel));
+  EXPECT_EQ(
+    RCL_RET_INVALID_ARGUMENT, rcl_timer_wheel_add_timer(&timer_wheel, &timers[0]));
+  rcl_reset_error();
+
+  int64_t time_until = INT64_MAX;
+  ASSERT_EQ(RCL_RET_OK, rcl_timer_wheel_get_time_until_next_call(&timer_wheel, &time_until));
+  EXPECT_LE(time_until, 0);
+
+  // Only the two zero-period timers are due; the hour timer is untouched.
+  rcl_timer_t * ready[3] = {nullptr, nullptr, nullptr};
+  size_t number_ready = 0;
+  ASSERT_EQ(RCL_RET_OK, rcl_timer_wheel_take_ready(&timer_wheel, ready, 3, &number_ready));
+  EXPECT_EQ(2u, number_ready);
+
+  wheel_times_called = 0;
+  size_t number_called = 0;
+  ASSERT_EQ(RCL_RET_OK, rcl_timer_wheel_call_ready(&timer_wheel, &number_called));
+  EXPECT_EQ(2u, number_called);
+  EXPECT_EQ(2u, wheel_times_called);
+
+  // A canceled timer sinks in the wheel and is no longer reported due.
+  ASSERT_EQ(RCL_RET_OK, rcl_timer_cancel(&timers[0]));
+  ASSERT_EQ(RCL_RET_OK, rcl_timer_wheel_call_ready(&timer_wheel, &number_called));
+  EXPECT_EQ(1u, number_called);
+
+  // Removing timers empties the wheel.
+  for (size_t i = 0; i < 3; ++i) {
+    ASSERT_EQ(RCL_RET_OK, rcl_timer_wheel_remove_timer(&timer_wheel, &timers[i]));
+  }
+  EXPECT_EQ(0u, rcl_timer_wheel_get_size(&timer_wheel));
+  EXPECT_EQ(
+    RCL_RET_INVALID_ARGUMENT, rcl_timer_wheel_remove_timer(&timer_wheel, &timers[0]));
+  rcl_reset_error();
+}
@@ -0,0 +1,65 @@
+// Copyright 2022 Open Source Robotics Foundation, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <gtest/gtest.h>
+
+#include "rcl/trace.h"
+
+struct RecordedEvent
+{
+  rcl_trace_event_t event;
+  const void * entity;
+  int64_t arg0;
+  int64_t arg1;
+};
+
+static RecordedEvent g_last_event;
+static size_t g_event_count = 0;
+
+static void record_event(
+  rcl_trace_event_t event, const void * entity, int64_t arg0, int64_t arg1, void * user_data)
+{
+  g_last_event = {event, entity, arg0, arg1};
+  ++(*static_cast<size_t *>(user_data));
+}
+
+TEST(TestTrace, test_emit_with_handler) {
+  g_event_count = 0;
+  rcl_trace_set_handler(record_event, &g_event_count);
+
+  int dummy_entity = 0;
+  rcl_trace_emit(RCL_TRACE_EVENT_WAIT_END, &dummy_entity, 3, 1);
+  EXPECT_EQ(1u, g_event_count);
+  EXPECT_EQ(RCL_TRACE_EVENT_WAIT_END, g_last_event.event);
+  EXPECT_EQ(&dummy_entity, g_last_event.entity);
+  EXPECT_EQ(3, g_last_event.arg0);
+  EXPECT_EQ(1, g_last_event.arg1);
+
+  rcl_trace_set_handler(nullptr, nullptr);
+}
+
+TEST(TestTrace, test_emit_without_handler) {
+  rcl_trace_set_handler(nullptr, nullptr);
+  // No handler installed; emitting must be a harmless no-op.
+  rcl_trace_emit(RCL_TRACE_EVENT_PUBLISH, nullptr, 0, 0);
+}
+
+TEST(TestTrace, test_handler_removal) {
+  g_event_count = 0;
+  rcl_trace_set_handler(record_event, &g_event_count);
+  rcl_trace_emit(RCL_TRACE_EVENT_TIMER_CALL, nullptr, 10, 12);
+  rcl_trace_set_handler(nullptr, nullptr);
+  rcl_trace_emit(RCL_TRACE_EVENT_TIMER_CALL, nullptr, 20, 22);
+  EXPECT_EQ(1u, g_event_count);
+}
@@ -104,6 +104,24 @@ TEST(TestTypeVersionHash, field_type_from_install) {
   ASSERT_EQ(direct_hash.version, validation_hash->version);
   ASSERT_EQ(0, memcmp(direct_hash.value, hash_from_repr.value, ROSIDL_TYPE_HASH_SIZE));
   ASSERT_EQ(0, memcmp(direct_hash.value, validation_hash->value, ROSIDL_TYPE_HASH_SIZE));
+
+  // A repeated calculation is served from the memoization table and must
+  // return the identical hash.
+  rosidl_type_hash_t memoized_hash;
+  res = rcl_calculate_type_hash(td_msg, &memoized_hash);
+  ASSERT_EQ(res, RCL_RET_OK);
+  ASSERT_EQ(direct_hash.version, memoized_hash.version);
+  ASSERT_EQ(0, memcmp(direct_hash.value, memoized_hash.value, ROSIDL_TYPE_HASH_SIZE));
+
+  // Changing the content without changing the type name must miss the cache
+  // and produce a different hash.
+  td_msg->type_description.fields.data[3].type.string_capacity = 31;
+  rosidl_type_hash_t mutated_hash;
+  res = rcl_calculate_type_hash(td_msg, &mutated_hash);
+  ASSERT_EQ(res, RCL_RET_OK);
+  ASSERT_NE(0, memcmp(direct_hash.value, mutated_hash.value, ROSIDL_TYPE_HASH_SIZE));
+
+  type_description_interfaces__msg__TypeDescription__destroy(td_msg);
 }
 
 
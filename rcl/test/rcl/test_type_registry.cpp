@@ -0,0 +1,144 @@
+// Copyright 2026 Open Source Robotics Foundation, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <gtest/gtest.h>
+
+#include <cstring>
+
+#include "rcl/type_registry.h"
+
+#include "rcl/error_handling.h"
+#include "rosidl_runtime_c/message_type_support_struct.h"
+#include "test_msgs/msg/basic_types.h"
+#include "test_msgs/msg/strings.h"
+
+class TestTypeRegistryFixture : public ::testing::Test
+{
+public:
+  rcl_type_registry_t registry;
+  void SetUp()
+  {
+    this->registry = rcl_get_zero_initialized_type_registry();
+    rcl_allocator_t allocator = rcl_get_default_allocator();
+    rcl_ret_t ret = rcl_type_registry_init(&this->registry, &allocator);
+    ASSERT_EQ(RCL_RET_OK, ret) << rcl_get_error_string().str;
+  }
+
+  void TearDown()
+  {
+    rcl_ret_t ret = rcl_type_registry_fini(&this->registry);
+    EXPECT_EQ(RCL_RET_OK, ret) << rcl_get_error_string().str;
+  }
+};
+
+TEST_F(TestTypeRegistryFixture, test_type_registry_init_fini) {
+  // The fixture registry is already initialized; a second init must fail.
+  rcl_allocator_t allocator = rcl_get_default_allocator();
+  rcl_ret_t ret = rcl_type_registry_init(&this->registry, &allocator);
+  EXPECT_EQ(RCL_RET_ALREADY_INIT, ret);
+  rcl_reset_error();
+
+  ret = rcl_type_registry_init(nullptr, &allocator);
+  EXPECT_EQ(RCL_RET_INVALID_ARGUMENT, ret);
+  rcl_reset_error();
+
+  ret = rcl_type_registry_fini(nullptr);
+  EXPECT_EQ(RCL_RET_INVALID_ARGUMENT, ret);
+  rcl_reset_error();
+
+  // Finalizing a zero initialized registry is a no-op.
+  rcl_type_registry_t null_registry = rcl_get_zero_initialized_type_registry();
+  ret = rcl_type_registry_fini(&null_registry);
+  EXPECT_EQ(RCL_RET_OK, ret) << rcl_get_error_string().str;
+}
+
+TEST_F(TestTypeRegistryFixture, test_type_registry_get_type_hash) {
+  const rosidl_message_type_support_t * basic_types_ts =
+    ROSIDL_GET_MSG_TYPE_SUPPORT(test_msgs, msg, BasicTypes);
+  const rosidl_message_type_support_t * strings_ts =
+    ROSIDL_GET_MSG_TYPE_SUPPORT(test_msgs, msg, Strings);
+
+  // Invalid arguments.
+  const rosidl_type_hash_t * type_hash = nullptr;
+  rcl_ret_t ret = rcl_type_registry_get_type_hash(nullptr, basic_types_ts, &type_hash);
+  EXPECT_EQ(RCL_RET_INVALID_ARGUMENT, ret);
+  rcl_reset_error();
+  ret = rcl_type_registry_get_type_hash(&this->registry, nullptr, &type_hash);
+  EXPECT_EQ(RCL_RET_INVALID_ARGUMENT, ret);
+  rcl_reset_error();
+  ret = rcl_type_registry_get_type_hash(&this->registry, basic_types_ts, nullptr);
+  EXPECT_EQ(RCL_RET_INVALID_ARGUMENT, ret);
+  rcl_reset_error();
+
+  // The first lookup calculates the hash and caches it.
+  ret = rcl_type_registry_get_type_hash(&this->registry, basic_types_ts, &type_hash);
+  ASSERT_EQ(RCL_RET_OK, ret) << rcl_get_error_string().str;
+  ASSERT_NE(nullptr, type_hash);
+  // The calculated hash must match the one the rosidl generator embedded.
+  const rosidl_type_hash_t * generated_hash =
+    basic_types_ts->get_type_hash_func(basic_types_ts);
+  ASSERT_NE(nullptr, generated_hash);
+  EXPECT_EQ(generated_hash->version, type_hash->version);
+  EXPECT_EQ(
+    0, memcmp(generated_hash->value, type_hash->value, ROSIDL_TYPE_HASH_SIZE));
+  size_t count = 0;
+  EXPECT_EQ(RCL_RET_OK, rcl_type_registry_get_count(&this->registry, &count));
+  EXPECT_EQ(1u, count);
+
+  // A repeated lookup returns the same cached entry.
+  const rosidl_type_hash_t * second_type_hash = nullptr;
+  ret = rcl_type_registry_get_type_hash(&this->registry, basic_types_ts, &second_type_hash);
+  ASSERT_EQ(RCL_RET_OK, ret) << rcl_get_error_string().str;
+  EXPECT_EQ(type_hash, second_type_hash);
+  EXPECT_EQ(RCL_RET_OK, rcl_type_registry_get_count(&this->registry, &count));
+  EXPECT_EQ(1u, count);
+
+  // A different type gets its own entry with a different hash.
+  const rosidl_type_hash_t * strings_type_hash = nullptr;
+  ret = rcl_type_registry_get_type_hash(&this->registry, strings_ts, &strings_type_hash);
+  ASSERT_EQ(RCL_RET_OK, ret) << rcl_get_error_string().str;
+  ASSERT_NE(nullptr, strings_type_hash);
+  EXPECT_NE(type_hash, strings_type_hash);
+  EXPECT_NE(
+    0, memcmp(strings_type_hash->value, type_hash->value, ROSIDL_TYPE_HASH_SIZE));
+  EXPECT_EQ(RCL_RET_OK, rcl_type_registry_get_count(&this->registry, &count));
+  EXPECT_EQ(2u, count);
+}
+
+TEST_F(TestTypeRegistryFixture, test_type_registry_growth) {
+  // Insert the same two type supports under many synthetic keys to push the
+  // table through growth, then verify previously returned pointers survived.
+  const rosidl_message_type_support_t * basic_types_ts =
+    ROSIDL_GET_MSG_TYPE_SUPPORT(test_msgs, msg, BasicTypes);
+  constexpr size_t num_copies = 100;
+  // Shallow copies are distinct pointers but describe the same type.
+  rosidl_message_type_support_t copies[num_copies];
+  const rosidl_type_hash_t * hashes[num_copies];
+  for (size_t i = 0; i < num_copies; ++i) {
+    copies[i] = *basic_types_ts;
+    rcl_ret_t ret = rcl_type_registry_get_type_hash(&this->registry, &copies[i], &hashes[i]);
+    ASSERT_EQ(RCL_RET_OK, ret) << rcl_get_error_string().str;
+  }
+  size_t count = 0;
+  EXPECT_EQ(RCL_RET_OK, rcl_type_registry_get_count(&this->registry, &count));
+  EXPECT_EQ(num_copies, count);
+  // Every cached hash is still reachable and stable after growth.
+  for (size_t i = 0; i < num_copies; ++i) {
+    const rosidl_type_hash_t * type_hash = nullptr;
+    rcl_ret_t ret = rcl_type_registry_get_type_hash(&this->registry, &copies[i], &type_hash);
+    ASSERT_EQ(RCL_RET_OK, ret) << rcl_get_error_string().str;
+    EXPECT_EQ(hashes[i], type_hash);
+    EXPECT_EQ(hashes[0]->version, type_hash->version);
+  }
+}
@@ -17,17 +17,11 @@
 #include <string>
 #include <vector>
 
-#include "rcutils/snprintf.h"
-
 #include "rcl/rcl.h"
 #include "rcl/validate_enclave_name.h"
 
 #include "rcl/error_handling.h"
 
-#include "rmw/validate_namespace.h"
-
-#include "../mocking_utils/patch.hpp"
-
 TEST(TestValidateEnclaveName, test_validate) {
   int validation_result;
   size_t invalid_index;
@@ -57,58 +51,18 @@ TEST(TestValidateEnclaveName, test_validate) {
     rcl_validate_enclave_name("/foo/bar", &validation_result, &invalid_index));
   EXPECT_EQ(RCL_ENCLAVE_NAME_VALID, validation_result);
 
-  {
-    auto mock = mocking_utils::patch(
-      "lib:rcl", rmw_validate_namespace_with_size,
-      [&](auto, auto, int * result, size_t * index) {
-        if (index) {
-          *index = 0u;
-        }
-        *result = RMW_NAMESPACE_INVALID_TOO_LONG;
-        return RMW_RET_OK;
-      });
-
-    // When applying RMW namespace validation rules, an enclave name may be too
-    // long for an RMW namespace but not necessarily for an enclave name.
-    EXPECT_EQ(
-      RCL_RET_OK,
-      rcl_validate_enclave_name("/foo/baz", &validation_result, &invalid_index));
-    EXPECT_EQ(RCL_ENCLAVE_NAME_VALID, validation_result);
-  }
-}
-
-TEST(TestValidateEnclaveName, test_validate_on_internal_error) {
-  int validation_result;
-  size_t invalid_index;
-
-  {
-    auto mock = mocking_utils::patch_to_fail(
-      "lib:rcl", rmw_validate_namespace_with_size, "internal error", RMW_RET_ERROR);
-
-    EXPECT_EQ(
-      RCL_RET_ERROR,
-      rcl_validate_enclave_name("/foo", &validation_result, &invalid_index));
-    EXPECT_TRUE(rcl_error_is_set());
-    rcl_reset_error();
-  }
-
-  {
-    auto mock = mocking_utils::patch(
-      "lib:rcl", rmw_validate_namespace_with_size,
-      [&](auto, auto, int * result, size_t * index) {
-        if (index) {
-          *index = 0u;
-        }
-        *result = -1;
-        return RMW_RET_OK;
-      });
+  // "/" is the default enclave and the one name that may end with a slash
+  EXPECT_EQ(
+    RCL_RET_OK,
+    rcl_validate_enclave_name("/", &validation_result, &invalid_index));
+  EXPECT_EQ(RCL_ENCLAVE_NAME_VALID, validation_result);
 
-    EXPECT_EQ(
-      RCL_RET_ERROR,
-      rcl_validate_enclave_name("/foo", &validation_result, &invalid_index));
-    EXPECT_TRUE(rcl_error_is_set());
-    rcl_reset_error();
-  }
+  // A name at exactly the maximum length is still valid
+  std::string max_length_name = "/" + std::string(RCL_ENCLAVE_NAME_MAX_LENGTH - 1, 'o');
+  EXPECT_EQ(
+    RCL_RET_OK,
+    rcl_validate_enclave_name(max_length_name.c_str(), &validation_result, &invalid_index));
+  EXPECT_EQ(RCL_ENCLAVE_NAME_VALID, validation_result);
 }
 
 TEST(TestValidateEnclaveName, test_validation_string) {
@@ -25,6 +25,7 @@
 #include "osrf_testing_tools_cpp/scope_exit.hpp"
 #include "rcl/error_handling.h"
 #include "rcl/rcl.h"
+#include "rcl/ready_queue.h"
 #include "rcl/wait.h"
 
 #include "rcutils/logging_macros.h"
@@ -776,3 +777,511 @@ TEST_F(CLASSNAME(WaitSetTestFixture, RMW_IMPLEMENTATION), wait_set_test_maybe_in
     }
   });
 }
+
+// Test that a persistent wait set keeps its registered entities across waits.
+TEST_F(CLASSNAME(WaitSetTestFixture, RMW_IMPLEMENTATION), persistent_wait_set) {
+  rcl_wait_set_t wait_set = rcl_get_zero_initialized_wait_set();
+  rcl_ret_t ret =
+    rcl_wait_set_init(&wait_set, 0, 1, 0, 0, 0, 0, context_ptr, rcl_get_default_allocator());
+  ASSERT_EQ(RCL_RET_OK, ret) << rcl_get_error_string().str;
+
+  rcl_guard_condition_t guard_condition = rcl_get_zero_initialized_guard_condition();
+  ret = rcl_guard_condition_init(
+    &guard_condition, context_ptr, rcl_guard_condition_get_default_options());
+  ASSERT_EQ(RCL_RET_OK, ret) << rcl_get_error_string().str;
+  OSRF_TESTING_TOOLS_CPP_SCOPE_EXIT(
+  {
+    EXPECT_EQ(RCL_RET_OK, rcl_guard_condition_fini(&guard_condition)) <<
+      rcl_get_error_string().str;
+    EXPECT_EQ(RCL_RET_OK, rcl_wait_set_fini(&wait_set)) << rcl_get_error_string().str;
+  });
+
+  EXPECT_FALSE(rcl_wait_set_is_persistent(&wait_set));
+  ret = rcl_wait_set_set_persistent(&wait_set, true);
+  EXPECT_EQ(RCL_RET_OK, ret) << rcl_get_error_string().str;
+  EXPECT_TRUE(rcl_wait_set_is_persistent(&wait_set));
+
+  ret = rcl_wait_set_add_guard_condition(&wait_set, &guard_condition, NULL);
+  ASSERT_EQ(RCL_RET_OK, ret) << rcl_get_error_string().str;
+
+  // The guard condition should be waitable on every iteration without
+  // clearing and re-adding it.
+  for (int i = 0; i < 3; ++i) {
+    ret = rcl_trigger_guard_condition(&guard_condition);
+    ASSERT_EQ(RCL_RET_OK, ret) << rcl_get_error_string().str;
+    ret = rcl_wait(&wait_set, RCL_MS_TO_NS(100));
+    ASSERT_EQ(RCL_RET_OK, ret) << rcl_get_error_string().str;
+    EXPECT_NE(nullptr, wait_set.guard_conditions[0]);
+  }
+
+  // A wait without a trigger should time out and prune the entry, but the
+  // next wait restores the registration.
+  ret = rcl_wait(&wait_set, RCL_MS_TO_NS(10));
+  EXPECT_EQ(RCL_RET_TIMEOUT, ret);
+  EXPECT_EQ(nullptr, wait_set.guard_conditions[0]);
+  ret = rcl_trigger_guard_condition(&guard_condition);
+  ASSERT_EQ(RCL_RET_OK, ret) << rcl_get_error_string().str;
+  ret = rcl_wait(&wait_set, RCL_MS_TO_NS(100));
+  ASSERT_EQ(RCL_RET_OK, ret) << rcl_get_error_string().str;
+  EXPECT_NE(nullptr, wait_set.guard_conditions[0]);
+
+  ret = rcl_wait_set_set_persistent(&wait_set, false);
+  EXPECT_EQ(RCL_RET_OK, ret) << rcl_get_error_string().str;
+  EXPECT_FALSE(rcl_wait_set_is_persistent(&wait_set));
+}
+
+// Test O(1) swap-removal of entities from the wait set.
+TEST_F(CLASSNAME(WaitSetTestFixture, RMW_IMPLEMENTATION), remove_entities) {
+  rcl_wait_set_t wait_set = rcl_get_zero_initialized_wait_set();
+  rcl_ret_t ret =
+    rcl_wait_set_init(&wait_set, 0, 2, 0, 0, 0, 0, context_ptr, rcl_get_default_allocator());
+  ASSERT_EQ(RCL_RET_OK, ret) << rcl_get_error_string().str;
+
+  rcl_guard_condition_t gc1 = rcl_get_zero_initialized_guard_condition();
+  rcl_guard_condition_t gc2 = rcl_get_zero_initialized_guard_condition();
+  ret = rcl_guard_condition_init(&gc1, context_ptr, rcl_guard_condition_get_default_options());
+  ASSERT_EQ(RCL_RET_OK, ret) << rcl_get_error_string().str;
+  ret = rcl_guard_condition_init(&gc2, context_ptr, rcl_guard_condition_get_default_options());
+  ASSERT_EQ(RCL_RET_OK, ret) << rcl_get_error_string().str;
+  OSRF_TESTING_TOOLS_CPP_SCOPE_EXIT(
+  {
+    EXPECT_EQ(RCL_RET_OK, rcl_guard_condition_fini(&gc1)) << rcl_get_error_string().str;
+    EXPECT_EQ(RCL_RET_OK, rcl_guard_condition_fini(&gc2)) << rcl_get_error_string().str;
+    EXPECT_EQ(RCL_RET_OK, rcl_wait_set_fini(&wait_set)) << rcl_get_error_string().str;
+  });
+
+  size_t first_index = 0u;
+  size_t second_index = 0u;
+  ret = rcl_wait_set_add_guard_condition(&wait_set, &gc1, &first_index);
+  ASSERT_EQ(RCL_RET_OK, ret) << rcl_get_error_string().str;
+  ret = rcl_wait_set_add_guard_condition(&wait_set, &gc2, &second_index);
+  ASSERT_EQ(RCL_RET_OK, ret) << rcl_get_error_string().str;
+  EXPECT_EQ(0u, first_index);
+  EXPECT_EQ(1u, second_index);
+
+  // Removing the first entry swaps the last entry into its slot.
+  ret = rcl_wait_set_remove_guard_condition(&wait_set, first_index);
+  EXPECT_EQ(RCL_RET_OK, ret) << rcl_get_error_string().str;
+  EXPECT_EQ(&gc2, wait_set.guard_conditions[0]);
+  EXPECT_EQ(nullptr, wait_set.guard_conditions[1]);
+
+  // Out of range indices are rejected.
+  ret = rcl_wait_set_remove_guard_condition(&wait_set, 1u);
+  EXPECT_EQ(RCL_RET_INVALID_ARGUMENT, ret);
+  rcl_reset_error();
+
+  // The remaining guard condition is still waitable.
+  ret = rcl_trigger_guard_condition(&gc2);
+  ASSERT_EQ(RCL_RET_OK, ret) << rcl_get_error_string().str;
+  ret = rcl_wait(&wait_set, RCL_MS_TO_NS(100));
+  ASSERT_EQ(RCL_RET_OK, ret) << rcl_get_error_string().str;
+  EXPECT_EQ(&gc2, wait_set.guard_conditions[0]);
+}
+
+// Test that persistent wait sets report ready timers through the timer heap.
+TEST_F(CLASSNAME(WaitSetTestFixture, RMW_IMPLEMENTATION), persistent_wait_set_timers) {
+  rcl_wait_set_t wait_set = rcl_get_zero_initialized_wait_set();
+  rcl_ret_t ret =
+    rcl_wait_set_init(&wait_set, 0, 0, 2, 0, 0, 0, context_ptr, rcl_get_default_allocator());
+  ASSERT_EQ(RCL_RET_OK, ret) << rcl_get_error_string().str;
+  rcl_clock_t clock;
+  rcl_allocator_t allocator = rcl_get_default_allocator();
+  ret = rcl_clock_init(RCL_STEADY_TIME, &clock, &allocator);
+  ASSERT_EQ(RCL_RET_OK, ret) << rcl_get_error_string().str;
+
+  rcl_timer_t short_timer = rcl_get_zero_initialized_timer();
+  ret = rcl_timer_init(
+    &short_timer, &clock, this->context_ptr, RCL_MS_TO_NS(10), nullptr,
+    rcl_get_default_allocator());
+  ASSERT_EQ(RCL_RET_OK, ret) << rcl_get_error_string().str;
+  rcl_timer_t long_timer = rcl_get_zero_initialized_timer();
+  ret = rcl_timer_init(
+    &long_timer, &clock, this->context_ptr, RCL_S_TO_NS(10), nullptr,
+    rcl_get_default_allocator());
+  ASSERT_EQ(RCL_RET_OK, ret) << rcl_get_error_string().str;
+  OSRF_TESTING_TOOLS_CPP_SCOPE_EXIT(
+  {
+    EXPECT_EQ(RCL_RET_OK, rcl_timer_fini(&short_timer)) << rcl_get_error_string().str;
+    EXPECT_EQ(RCL_RET_OK, rcl_timer_fini(&long_timer)) << rcl_get_error_string().str;
+    EXPECT_EQ(RCL_RET_OK, rcl_clock_fini(&clock)) << rcl_get_error_string().str;
+    EXPECT_EQ(RCL_RET_OK, rcl_wait_set_fini(&wait_set)) << rcl_get_error_string().str;
+  });
+
+  ASSERT_EQ(RCL_RET_OK, rcl_wait_set_set_persistent(&wait_set, true));
+  ASSERT_EQ(RCL_RET_OK, rcl_wait_set_add_timer(&wait_set, &short_timer, NULL));
+  ASSERT_EQ(RCL_RET_OK, rcl_wait_set_add_timer(&wait_set, &long_timer, NULL));
+
+  // Repeated waits should report only the short timer as ready, without
+  // clearing and re-adding the timers.
+  for (int i = 0; i < 3; ++i) {
+    ret = rcl_wait(&wait_set, RCL_S_TO_NS(1));
+    ASSERT_EQ(RCL_RET_OK, ret) << rcl_get_error_string().str;
+    EXPECT_EQ(&short_timer, wait_set.timers[0]);
+    EXPECT_EQ(nullptr, wait_set.timers[1]);
+    ASSERT_EQ(RCL_RET_OK, rcl_timer_call(&short_timer));
+  }
+}
+
+// Test the readiness bitmap populated by rcl_wait.
+TEST_F(CLASSNAME(WaitSetTestFixture, RMW_IMPLEMENTATION), ready_bitmap) {
+  rcl_wait_set_t wait_set = rcl_get_zero_initialized_wait_set();
+  rcl_ret_t ret =
+    rcl_wait_set_init(&wait_set, 0, 2, 0, 0, 0, 0, context_ptr, rcl_get_default_allocator());
+  ASSERT_EQ(RCL_RET_OK, ret) << rcl_get_error_string().str;
+
+  rcl_guard_condition_t gc1 = rcl_get_zero_initialized_guard_condition();
+  rcl_guard_condition_t gc2 = rcl_get_zero_initialized_guard_condition();
+  ret = rcl_guard_condition_init(&gc1, context_ptr, rcl_guard_condition_get_default_options());
+  ASSERT_EQ(RCL_RET_OK, ret) << rcl_get_error_string().str;
+  ret = rcl_guard_condition_init(&gc2, context_ptr, rcl_guard_condition_get_default_options());
+  ASSERT_EQ(RCL_RET_OK, ret) << rcl_get_error_string().str;
+  OSRF_TESTING_TOOLS_CPP_SCOPE_EXIT(
+  {
+    EXPECT_EQ(RCL_RET_OK, rcl_guard_condition_fini(&gc1)) << rcl_get_error_string().str;
+    EXPECT_EQ(RCL_RET_OK, rcl_guard_condition_fini(&gc2)) << rcl_get_error_string().str;
+    EXPECT_EQ(RCL_RET_OK, rcl_wait_set_fini(&wait_set)) << rcl_get_error_string().str;
+  });
+
+  ASSERT_EQ(RCL_RET_OK, rcl_wait_set_add_guard_condition(&wait_set, &gc1, NULL));
+  ASSERT_EQ(RCL_RET_OK, rcl_wait_set_add_guard_condition(&wait_set, &gc2, NULL));
+  ASSERT_EQ(RCL_RET_OK, rcl_trigger_guard_condition(&gc2));
+  ret = rcl_wait(&wait_set, RCL_MS_TO_NS(100));
+  ASSERT_EQ(RCL_RET_OK, ret) << rcl_get_error_string().str;
+
+  const uint64_t * bitmap = nullptr;
+  size_t number_of_words = 0;
+  ret = rcl_wait_set_get_ready_bitmap(
+    &wait_set, RCL_WAIT_SET_GUARD_CONDITION, &bitmap, &number_of_words);
+  ASSERT_EQ(RCL_RET_OK, ret) << rcl_get_error_string().str;
+  ASSERT_NE(nullptr, bitmap);
+  ASSERT_EQ(1u, number_of_words);
+  // Only the second guard condition was triggered.
+  EXPECT_EQ(1u, rcl_wait_set_next_ready(bitmap, number_of_words, 0u));
+  EXPECT_EQ(1u, rcl_wait_set_next_ready(bitmap, number_of_words, 1u));
+  EXPECT_EQ(SIZE_MAX, rcl_wait_set_next_ready(bitmap, number_of_words, 2u));
+
+  // Entity classes with zero capacity report a NULL bitmap.
+  ret = rcl_wait_set_get_ready_bitmap(
+    &wait_set, RCL_WAIT_SET_SUBSCRIPTION, &bitmap, &number_of_words);
+  ASSERT_EQ(RCL_RET_OK, ret) << rcl_get_error_string().str;
+  EXPECT_EQ(nullptr, bitmap);
+  EXPECT_EQ(0u, number_of_words);
+}
+
+// Test that an attached ready queue is populated by rcl_wait.
+TEST_F(CLASSNAME(WaitSetTestFixture, RMW_IMPLEMENTATION), ready_queue) {
+  rcl_wait_set_t wait_set = rcl_get_zero_initialized_wait_set();
+  rcl_ret_t ret =
+    rcl_wait_set_init(&wait_set, 0, 2, 0, 0, 0, 0, context_ptr, rcl_get_default_allocator());
+  ASSERT_EQ(RCL_RET_OK, ret) << rcl_get_error_string().str;
+
+  rcl_ready_queue_t ready_queue = rcl_get_zero_initialized_ready_queue();
+  ret = rcl_ready_queue_init(&ready_queue, 8, rcl_get_default_allocator());
+  ASSERT_EQ(RCL_RET_OK, ret) << rcl_get_error_string().str;
+
+  rcl_guard_condition_t gc1 = rcl_get_zero_initialized_guard_condition();
+  rcl_guard_condition_t gc2 = rcl_get_zero_initialized_guard_condition();
+  ret = rcl_guard_condition_init(&gc1, context_ptr, rcl_guard_condition_get_default_options());
+  ASSERT_EQ(RCL_RET_OK, ret) << rcl_get_error_string().str;
+  ret = rcl_guard_condition_init(&gc2, context_ptr, rcl_guard_condition_get_default_options());
+  ASSERT_EQ(RCL_RET_OK, ret) << rcl_get_error_string().str;
+  OSRF_TESTING_TOOLS_CPP_SCOPE_EXIT(
+  {
+    EXPECT_EQ(RCL_RET_OK, rcl_guard_condition_fini(&gc1)) << rcl_get_error_string().str;
+    EXPECT_EQ(RCL_RET_OK, rcl_guard_condition_fini(&gc2)) << rcl_get_error_string().str;
+    EXPECT_EQ(RCL_RET_OK, rcl_wait_set_fini(&wait_set)) << rcl_get_error_string().str;
+    EXPECT_EQ(RCL_RET_OK, rcl_ready_queue_fini(&ready_queue)) << rcl_get_error_string().str;
+  });
+
+  // An empty queue reports empty before anything has been pushed.
+  rcl_ready_queue_entry_t entry;
+  ret = rcl_ready_queue_pop(&ready_queue, &entry);
+  EXPECT_EQ(RCL_RET_WAIT_SET_EMPTY, ret);
+  rcl_reset_error();
+
+  ASSERT_EQ(RCL_RET_OK, rcl_wait_set_attach_ready_queue(&wait_set, &ready_queue));
+
+  ASSERT_EQ(RCL_RET_OK, rcl_wait_set_add_guard_condition(&wait_set, &gc1, NULL));
+  ASSERT_EQ(RCL_RET_OK, rcl_wait_set_add_guard_condition(&wait_set, &gc2, NULL));
+  ASSERT_EQ(RCL_RET_OK, rcl_trigger_guard_condition(&gc2));
+  ret = rcl_wait(&wait_set, RCL_MS_TO_NS(100));
+  ASSERT_EQ(RCL_RET_OK, ret) << rcl_get_error_string().str;
+
+  // Only the second guard condition was triggered, so exactly one entry
+  // should have been queued.
+  ret = rcl_ready_queue_pop(&ready_queue, &entry);
+  ASSERT_EQ(RCL_RET_OK, ret) << rcl_get_error_string().str;
+  EXPECT_EQ(&gc2, entry.entity);
+  EXPECT_EQ(RCL_WAIT_SET_GUARD_CONDITION, entry.entity_type);
+  EXPECT_EQ(1u, entry.wait_set_index);
+  ret = rcl_ready_queue_pop(&ready_queue, &entry);
+  EXPECT_EQ(RCL_RET_WAIT_SET_EMPTY, ret);
+  rcl_reset_error();
+
+  // Fill the queue by hand and verify the drop accounting.
+  rcl_ready_queue_entry_t filler = {&gc1, RCL_WAIT_SET_GUARD_CONDITION, 0u};
+  for (size_t i = 0; i < 8; ++i) {
+    EXPECT_EQ(RCL_RET_OK, rcl_ready_queue_push(&ready_queue, &filler));
+  }
+  EXPECT_EQ(RCL_RET_WAIT_SET_FULL, rcl_ready_queue_push(&ready_queue, &filler));
+  rcl_reset_error();
+  uint64_t dropped_count = 0;
+  ASSERT_EQ(RCL_RET_OK, rcl_ready_queue_get_dropped_count(&ready_queue, &dropped_count));
+  EXPECT_EQ(1u, dropped_count);
+  for (size_t i = 0; i < 8; ++i) {
+    EXPECT_EQ(RCL_RET_OK, rcl_ready_queue_pop(&ready_queue, &entry));
+  }
+
+  // After detaching, rcl_wait leaves the queue alone.
+  ASSERT_EQ(RCL_RET_OK, rcl_wait_set_detach_ready_queue(&wait_set));
+  ASSERT_EQ(RCL_RET_OK, rcl_trigger_guard_condition(&gc2));
+  ret = rcl_wait(&wait_set, RCL_MS_TO_NS(100));
+  ASSERT_EQ(RCL_RET_OK, ret) << rcl_get_error_string().str;
+  ret = rcl_ready_queue_pop(&ready_queue, &entry);
+  EXPECT_EQ(RCL_RET_WAIT_SET_EMPTY, ret);
+  rcl_reset_error();
+}
+
+// Test waiting on several wait sets through one aggregated rmw wait.
+TEST_F(CLASSNAME(WaitSetTestFixture, RMW_IMPLEMENTATION), wait_multiple) {
+  rcl_wait_set_t wait_set_a = rcl_get_zero_initialized_wait_set();
+  rcl_wait_set_t wait_set_b = rcl_get_zero_initialized_wait_set();
+  // Give the first wait set capacity for the combined entities, since its
+  // rmw wait set backs the aggregated wait.
+  rcl_ret_t ret =
+    rcl_wait_set_init(&wait_set_a, 0, 2, 0, 0, 0, 0, context_ptr, rcl_get_default_allocator());
+  ASSERT_EQ(RCL_RET_OK, ret) << rcl_get_error_string().str;
+  ret =
+    rcl_wait_set_init(&wait_set_b, 0, 1, 0, 0, 0, 0, context_ptr, rcl_get_default_allocator());
+  ASSERT_EQ(RCL_RET_OK, ret) << rcl_get_error_string().str;
+
+  rcl_guard_condition_t gc_a = rcl_get_zero_initialized_guard_condition();
+  rcl_guard_condition_t gc_b = rcl_get_zero_initialized_guard_condition();
+  ret = rcl_guard_condition_init(&gc_a, context_ptr, rcl_guard_condition_get_default_options());
+  ASSERT_EQ(RCL_RET_OK, ret) << rcl_get_error_string().str;
+  ret = rcl_guard_condition_init(&gc_b, context_ptr, rcl_guard_condition_get_default_options());
+  ASSERT_EQ(RCL_RET_OK, ret) << rcl_get_error_string().str;
+  OSRF_TESTING_TOOLS_CPP_SCOPE_EXIT(
+  {
+    EXPECT_EQ(RCL_RET_OK, rcl_guard_condition_fini(&gc_a)) << rcl_get_error_string().str;
+    EXPECT_EQ(RCL_RET_OK, rcl_guard_condition_fini(&gc_b)) << rcl_get_error_string().str;
+    EXPECT_EQ(RCL_RET_OK, rcl_wait_set_fini(&wait_set_a)) << rcl_get_error_string().str;
+    EXPECT_EQ(RCL_RET_OK, rcl_wait_set_fini(&wait_set_b)) << rcl_get_error_string().str;
+  });
+
+  ASSERT_EQ(RCL_RET_OK, rcl_wait_set_add_guard_condition(&wait_set_a, &gc_a, NULL));
+  ASSERT_EQ(RCL_RET_OK, rcl_wait_set_add_guard_condition(&wait_set_b, &gc_b, NULL));
+
+  // Triggering the second wait set's guard condition wakes the aggregated
+  // wait and only that wait set reports readiness.
+  ASSERT_EQ(RCL_RET_OK, rcl_trigger_guard_condition(&gc_b));
+  rcl_wait_set_t * wait_sets[] = {&wait_set_a, &wait_set_b};
+  ret = rcl_wait_multiple(wait_sets, 2, RCL_MS_TO_NS(1000));
+  ASSERT_EQ(RCL_RET_OK, ret) << rcl_get_error_string().str;
+  EXPECT_EQ(nullptr, wait_set_a.guard_conditions[0]);
+  EXPECT_EQ(&gc_b, wait_set_b.guard_conditions[0]);
+}
+
+// Test that an expired timer with no other entities skips rmw_wait entirely.
+TEST_F(CLASSNAME(WaitSetTestFixture, RMW_IMPLEMENTATION), expired_timer_skips_rmw_wait) {
+  rcl_wait_set_t wait_set = rcl_get_zero_initialized_wait_set();
+  rcl_ret_t ret =
+    rcl_wait_set_init(&wait_set, 0, 0, 1, 0, 0, 0, context_ptr, rcl_get_default_allocator());
+  ASSERT_EQ(RCL_RET_OK, ret) << rcl_get_error_string().str;
+  rcl_clock_t clock;
+  rcl_allocator_t allocator = rcl_get_default_allocator();
+  ret = rcl_clock_init(RCL_STEADY_TIME, &clock, &allocator);
+  ASSERT_EQ(RCL_RET_OK, ret) << rcl_get_error_string().str;
+  rcl_timer_t timer = rcl_get_zero_initialized_timer();
+  ret = rcl_timer_init(
+    &timer, &clock, this->context_ptr, 0, nullptr, rcl_get_default_allocator());
+  ASSERT_EQ(RCL_RET_OK, ret) << rcl_get_error_string().str;
+  OSRF_TESTING_TOOLS_CPP_SCOPE_EXIT(
+  {
+    EXPECT_EQ(RCL_RET_OK, rcl_timer_fini(&timer)) << rcl_get_error_string().str;
+    EXPECT_EQ(RCL_RET_OK, rcl_clock_fini(&clock)) << rcl_get_error_string().str;
+    EXPECT_EQ(RCL_RET_OK, rcl_wait_set_fini(&wait_set)) << rcl_get_error_string().str;
+  });
+  ASSERT_EQ(RCL_RET_OK, rcl_wait_set_add_timer(&wait_set, &timer, NULL));
+
+  // With rmw_wait mocked to fail, a successful wait proves the fast path
+  // never called into rmw.
+  auto mock = mocking_utils::patch_and_return("lib:rcl", rmw_wait, RMW_RET_ERROR);
+  ret = rcl_wait(&wait_set, RCL_MS_TO_NS(100));
+  ASSERT_EQ(RCL_RET_OK, ret) << rcl_get_error_string().str;
+  EXPECT_EQ(&timer, wait_set.timers[0]);
+}
+
+// Test coalesced notifications: many sources share one guard condition.
+TEST_F(CLASSNAME(WaitSetTestFixture, RMW_IMPLEMENTATION), notification_coalescing) {
+  rcl_wait_set_t wait_set = rcl_get_zero_initialized_wait_set();
+  rcl_ret_t ret =
+    rcl_wait_set_init(&wait_set, 0, 1, 0, 0, 0, 0, context_ptr, rcl_get_default_allocator());
+  ASSERT_EQ(RCL_RET_OK, ret) << rcl_get_error_string().str;
+  OSRF_TESTING_TOOLS_CPP_SCOPE_EXIT(
+  {
+    EXPECT_EQ(RCL_RET_OK, rcl_wait_set_fini(&wait_set)) << rcl_get_error_string().str;
+  });
+  ret = rcl_wait_set_enable_notification_coalescing(&wait_set, 8);
+  ASSERT_EQ(RCL_RET_OK, ret) << rcl_get_error_string().str;
+  EXPECT_EQ(RCL_RET_ALREADY_INIT, rcl_wait_set_enable_notification_coalescing(&wait_set, 8));
+  rcl_reset_error();
+  EXPECT_EQ(RCL_RET_INVALID_ARGUMENT, rcl_wait_set_notify(&wait_set, 8));
+  rcl_reset_error();
+
+  // Notify two sources, wait, and drain: both bits should be reported once.
+  ASSERT_EQ(RCL_RET_OK, rcl_wait_set_notify(&wait_set, 1));
+  ASSERT_EQ(RCL_RET_OK, rcl_wait_set_notify(&wait_set, 5));
+  ret = rcl_wait(&wait_set, RCL_MS_TO_NS(1000));
+  ASSERT_EQ(RCL_RET_OK, ret) << rcl_get_error_string().str;
+  uint64_t pending = 0;
+  ASSERT_EQ(RCL_RET_OK, rcl_wait_set_take_notifications(&wait_set, &pending));
+  EXPECT_EQ((UINT64_C(1) << 1) | (UINT64_C(1) << 5), pending);
+  ASSERT_EQ(RCL_RET_OK, rcl_wait_set_take_notifications(&wait_set, &pending));
+  EXPECT_EQ(UINT64_C(0), pending);
+
+  ASSERT_EQ(RCL_RET_OK, rcl_wait_set_disable_notification_coalescing(&wait_set));
+  EXPECT_EQ(RCL_RET_INVALID_ARGUMENT, rcl_wait_set_take_notifications(&wait_set, &pending));
+  rcl_reset_error();
+}
+
+// Test that reserving capacity up front lets later resizes reuse storage.
+TEST_F(CLASSNAME(WaitSetTestFixture, RMW_IMPLEMENTATION), reserve_capacity) {
+  rcl_wait_set_t wait_set = rcl_get_zero_initialized_wait_set();
+  rcl_ret_t ret =
+    rcl_wait_set_init(&wait_set, 1, 1, 0, 0, 0, 0, context_ptr, rcl_get_default_allocator());
+  ASSERT_EQ(RCL_RET_OK, ret) << rcl_get_error_string().str;
+  OSRF_TESTING_TOOLS_CPP_SCOPE_EXIT(
+  {
+    EXPECT_EQ(RCL_RET_OK, rcl_wait_set_fini(&wait_set)) << rcl_get_error_string().str;
+  });
+  ret = rcl_wait_set_reserve(&wait_set, 16, 16, 16, 0, 0, 0);
+  ASSERT_EQ(RCL_RET_OK, ret) << rcl_get_error_string().str;
+  // Reserving does not change the user facing sizes.
+  EXPECT_EQ(1u, wait_set.size_of_subscriptions);
+  EXPECT_EQ(1u, wait_set.size_of_guard_conditions);
+  EXPECT_EQ(0u, wait_set.size_of_timers);
+
+  // Growth steps within the reserved capacity keep the storage stable.
+  const void * arena_before = wait_set.subscriptions;
+  for (size_t size = 2; size <= 16; ++size) {
+    ret = rcl_wait_set_resize(&wait_set, size, size, size, 0, 0, 0);
+    ASSERT_EQ(RCL_RET_OK, ret) << rcl_get_error_string().str;
+    EXPECT_EQ(size, wait_set.size_of_subscriptions);
+    EXPECT_EQ(arena_before, wait_set.subscriptions);
+  }
+
+  // The resized set is still usable for a wait.
+  rcl_guard_condition_t guard_condition = rcl_get_zero_initialized_guard_condition();
+  ret = rcl_guard_condition_init(
+    &guard_condition, context_ptr, rcl_guard_condition_get_default_options());
+  ASSERT_EQ(RCL_RET_OK, ret) << rcl_get_error_string().str;
+  OSRF_TESTING_TOOLS_CPP_SCOPE_EXIT(
+  {
+    EXPECT_EQ(RCL_RET_OK, rcl_guard_condition_fini(&guard_condition)) <<
+      rcl_get_error_string().str;
+  });
+  ASSERT_EQ(RCL_RET_OK, rcl_wait_set_add_guard_condition(&wait_set, &guard_condition, NULL));
+  ASSERT_EQ(RCL_RET_OK, rcl_trigger_guard_condition(&guard_condition));
+  ret = rcl_wait(&wait_set, RCL_MS_TO_NS(1000));
+  ASSERT_EQ(RCL_RET_OK, ret) << rcl_get_error_string().str;
+  EXPECT_EQ(&guard_condition, wait_set.guard_conditions[0]);
+}
+
+// Test the wait set instrumentation counters.
+TEST_F(CLASSNAME(WaitSetTestFixture, RMW_IMPLEMENTATION), wait_set_statistics) {
+  rcl_wait_set_t wait_set = rcl_get_zero_initialized_wait_set();
+  rcl_ret_t ret =
+    rcl_wait_set_init(&wait_set, 0, 1, 0, 0, 0, 0, context_ptr, rcl_get_default_allocator());
+  ASSERT_EQ(RCL_RET_OK, ret) << rcl_get_error_string().str;
+  rcl_guard_condition_t guard_condition = rcl_get_zero_initialized_guard_condition();
+  ret = rcl_guard_condition_init(
+    &guard_condition, context_ptr, rcl_guard_condition_get_default_options());
+  ASSERT_EQ(RCL_RET_OK, ret) << rcl_get_error_string().str;
+  OSRF_TESTING_TOOLS_CPP_SCOPE_EXIT(
+  {
+    EXPECT_EQ(RCL_RET_OK, rcl_guard_condition_fini(&guard_condition)) <<
+      rcl_get_error_string().str;
+    EXPECT_EQ(RCL_RET_OK, rcl_wait_set_fini(&wait_set)) << rcl_get_error_string().str;
+  });
+  rcl_wait_set_statistics_t statistics;
+  EXPECT_EQ(RCL_RET_INVALID_ARGUMENT, rcl_wait_set_get_statistics(&wait_set, &statistics));
+  rcl_reset_error();
+  ASSERT_EQ(RCL_RET_OK, rcl_wait_set_enable_statistics(&wait_set));
+
+  // A wake caused by a triggered guard condition is not spurious.
+  ASSERT_EQ(RCL_RET_OK, rcl_wait_set_add_guard_condition(&wait_set, &guard_condition, NULL));
+  ASSERT_EQ(RCL_RET_OK, rcl_trigger_guard_condition(&guard_condition));
+  ret = rcl_wait(&wait_set, RCL_MS_TO_NS(1000));
+  ASSERT_EQ(RCL_RET_OK, ret) << rcl_get_error_string().str;
+  ASSERT_EQ(RCL_RET_OK, rcl_wait_set_get_statistics(&wait_set, &statistics));
+  EXPECT_EQ(1u, statistics.wait_count);
+  EXPECT_EQ(0u, statistics.spurious_wake_count);
+  EXPECT_EQ(0u, statistics.timer_wake_count);
+  EXPECT_EQ(1u, statistics.max_ready_batch_size);
+
+  // A wait that runs into the timeout accumulates time spent in rmw_wait.
+  ASSERT_EQ(RCL_RET_OK, rcl_wait_set_clear(&wait_set));
+  ASSERT_EQ(RCL_RET_OK, rcl_wait_set_add_guard_condition(&wait_set, &guard_condition, NULL));
+  ret = rcl_wait(&wait_set, RCL_MS_TO_NS(10));
+  ASSERT_EQ(RCL_RET_TIMEOUT, ret);
+  rcl_reset_error();
+  ASSERT_EQ(RCL_RET_OK, rcl_wait_set_get_statistics(&wait_set, &statistics));
+  EXPECT_EQ(2u, statistics.wait_count);
+  EXPECT_GE(statistics.rmw_wait_time_ns, static_cast<uint64_t>(RCL_MS_TO_NS(10)));
+
+  // Re-enabling resets the counters; disabling makes fetches fail again.
+  ASSERT_EQ(RCL_RET_OK, rcl_wait_set_enable_statistics(&wait_set));
+  ASSERT_EQ(RCL_RET_OK, rcl_wait_set_get_statistics(&wait_set, &statistics));
+  EXPECT_EQ(0u, statistics.wait_count);
+  ASSERT_EQ(RCL_RET_OK, rcl_wait_set_disable_statistics(&wait_set));
+  EXPECT_EQ(RCL_RET_INVALID_ARGUMENT, rcl_wait_set_get_statistics(&wait_set, &statistics));
+  rcl_reset_error();
+}
+
+// Test that a caller timeout shorter than every timer deadline returns a
+// timeout promptly instead of waiting for the earliest timer.
+TEST_F(CLASSNAME(WaitSetTestFixture, RMW_IMPLEMENTATION), timer_deadline_timeout_clamp) {
+  rcl_wait_set_t wait_set = rcl_get_zero_initialized_wait_set();
+  rcl_ret_t ret =
+    rcl_wait_set_init(&wait_set, 0, 0, 2, 0, 0, 0, context_ptr, rcl_get_default_allocator());
+  ASSERT_EQ(RCL_RET_OK, ret) << rcl_get_error_string().str;
+  rcl_clock_t clock;
+  rcl_allocator_t allocator = rcl_get_default_allocator();
+  ret = rcl_clock_init(RCL_STEADY_TIME, &clock, &allocator);
+  ASSERT_EQ(RCL_RET_OK, ret) << rcl_get_error_string().str;
+  rcl_timer_t timers[2];
+  for (size_t i = 0; i < 2; ++i) {
+    timers[i] = rcl_get_zero_initialized_timer();
+    ret = rcl_timer_init(
+      &timers[i], &clock, this->context_ptr, RCL_S_TO_NS(10), nullptr,
+      rcl_get_default_allocator());
+    ASSERT_EQ(RCL_RET_OK, ret) << rcl_get_error_string().str;
+  }
+  OSRF_TESTING_TOOLS_CPP_SCOPE_EXIT(
+  {
+    for (size_t i = 0; i < 2; ++i) {
+      EXPECT_EQ(RCL_RET_OK, rcl_timer_fini(&timers[i])) << rcl_get_error_string().str;
+    }
+    EXPECT_EQ(RCL_RET_OK, rcl_clock_fini(&clock)) << rcl_get_error_string().str;
+    EXPECT_EQ(RCL_RET_OK, rcl_wait_set_fini(&wait_set)) << rcl_get_error_string().str;
+  });
+
+  ASSERT_EQ(RCL_RET_OK, rcl_wait_set_set_persistent(&wait_set, true));
+  ASSERT_EQ(RCL_RET_OK, rcl_wait_set_add_timer(&wait_set, &timers[0], NULL));
+  ASSERT_EQ(RCL_RET_OK, rcl_wait_set_add_timer(&wait_set, &timers[1], NULL));
+
+  // Every timer deadline is 10 seconds away, so the 20 ms caller timeout
+  // determines the wait; the whole loop finishing quickly shows the early
+  // out is not oversleeping until a timer deadline.
+  std::chrono::steady_clock::time_point before_sc = std::chrono::steady_clock::now();
+  for (int i = 0; i < 3; ++i) {
+    ret = rcl_wait(&wait_set, RCL_MS_TO_NS(20));
+    ASSERT_EQ(RCL_RET_TIMEOUT, ret);
+    rcl_reset_error();
+    EXPECT_EQ(nullptr, wait_set.timers[0]);
+    EXPECT_EQ(nullptr, wait_set.timers[1]);
+  }
+  std::chrono::steady_clock::time_point after_sc = std::chrono::steady_clock::now();
+  EXPECT_LT(after_sc - before_sc, std::chrono::seconds(1));
+}
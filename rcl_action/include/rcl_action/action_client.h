@@ -22,6 +22,7 @@ extern "C"
 
 #include "rcl_action/types.h"
 #include "rcl_action/visibility_control.h"
+#include "rcl/client.h"
 #include "rcl/event_callback.h"
 #include "rcl/macros.h"
 #include "rcl/node.h"
@@ -470,6 +471,112 @@ rcl_action_take_status(
   const rcl_action_client_t * action_client,
   void * ros_status_array);
 
+/// Goal status change callback for a rcl_action_client_t.
+/**
+ * Called while a taken status array is being ingested into the client's goal
+ * status table, once per goal whose tracked state changed.
+ * The previous state is `GOAL_STATE_UNKNOWN` for goals seen for the first time.
+ * The goal ID points into the message being taken and is only valid for the
+ * duration of the call.
+ */
+typedef void (* rcl_action_client_goal_status_callback_t)(
+  const uint8_t * goal_id,
+  rcl_action_goal_state_t previous_state,
+  rcl_action_goal_state_t new_state,
+  void * user_data);
+
+/// Enable or disable goal status tracking for a rcl_action_client_t.
+/**
+ * While tracking is enabled, every status array taken with
+ * rcl_action_take_status() also updates a table of goal states keyed by goal
+ * UUID, so the state of any goal can be queried in constant time with
+ * rcl_action_client_get_goal_status() instead of matching status arrays
+ * against application goal lists.
+ * Goals in a terminal state that stop appearing in incoming status arrays are
+ * dropped from the table.
+ *
+ * Disabling tracking frees the table and discards all tracked states.
+ * Enabling tracking when it is already enabled is a no-op.
+ *
+ * <hr>
+ * Attribute          | Adherence
+ * ------------------ | -------------
+ * Allocates Memory   | Yes
+ * Thread-Safe        | No
+ * Uses Atomics       | No
+ * Lock-Free          | Yes
+ *
+ * \param[in] action_client handle to the client to enable or disable tracking for
+ * \param[in] enable `true` to enable goal status tracking, `false` to disable it
+ * \return `RCL_RET_OK` if the call was successful, or
+ * \return `RCL_RET_ACTION_CLIENT_INVALID` if the action client is invalid, or
+ * \return `RCL_RET_BAD_ALLOC` if allocating memory failed.
+ */
+RCL_ACTION_PUBLIC
+RCL_WARN_UNUSED
+rcl_ret_t
+rcl_action_client_enable_goal_status_tracking(
+  const rcl_action_client_t * action_client,
+  bool enable);
+
+/// Get the tracked state of a goal using a rcl_action_client_t.
+/**
+ * The state reflects the most recent status array ingested by
+ * rcl_action_take_status().
+ * If the goal is not in the table, including when goal status tracking is
+ * disabled, the state is `GOAL_STATE_UNKNOWN`.
+ *
+ * <hr>
+ * Attribute          | Adherence
+ * ------------------ | -------------
+ * Allocates Memory   | No
+ * Thread-Safe        | No
+ * Uses Atomics       | No
+ * Lock-Free          | Yes
+ *
+ * \param[in] action_client handle to the client to query
+ * \param[in] goal_info handle to the goal info holding the goal ID to look up
+ * \param[out] status the tracked state of the goal
+ * \return `RCL_RET_OK` if the call was successful, or
+ * \return `RCL_RET_ACTION_CLIENT_INVALID` if the action client is invalid, or
+ * \return `RCL_RET_INVALID_ARGUMENT` if any arguments are invalid.
+ */
+RCL_ACTION_PUBLIC
+RCL_WARN_UNUSED
+rcl_ret_t
+rcl_action_client_get_goal_status(
+  const rcl_action_client_t * action_client,
+  const rcl_action_goal_info_t * goal_info,
+  rcl_action_goal_state_t * status);
+
+/// Set the goal status change callback for a rcl_action_client_t.
+/**
+ * The callback is invoked from rcl_action_take_status() while goal status
+ * tracking is enabled, once per goal whose tracked state changed.
+ * Pass `NULL` to clear the callback.
+ *
+ * <hr>
+ * Attribute          | Adherence
+ * ------------------ | -------------
+ * Allocates Memory   | No
+ * Thread-Safe        | No
+ * Uses Atomics       | No
+ * Lock-Free          | Yes
+ *
+ * \param[in] action_client handle to the client to set the callback for
+ * \param[in] callback the callback to invoke on goal state changes, or `NULL`
+ * \param[in] user_data passed through to the callback
+ * \return `RCL_RET_OK` if the call was successful, or
+ * \return `RCL_RET_ACTION_CLIENT_INVALID` if the action client is invalid.
+ */
+RCL_ACTION_PUBLIC
+RCL_WARN_UNUSED
+rcl_ret_t
+rcl_action_client_set_goal_status_tracking_callback(
+  const rcl_action_client_t * action_client,
+  rcl_action_client_goal_status_callback_t callback,
+  void * user_data);
+
 /// Send a request for the result of a completed goal associated with a rcl_action_client_t.
 /**
  * This is a non-blocking call.
@@ -665,6 +772,198 @@ rcl_action_take_cancel_response(
   rmw_request_id_t * response_header,
   void * ros_cancel_response);
 
+/// Initialize the pipelined request mode on an action client.
+/**
+ * Enables pipelining on the goal, result and cancel service clients of the
+ * action client, each with a window of `window_size` outstanding requests;
+ * see rcl_client_init_pipeline() for the table semantics.
+ * This enables rcl_action_async_send_goal_request(),
+ * rcl_action_async_send_result_request(),
+ * rcl_action_async_send_cancel_request() and the per-service drain
+ * functions.
+ *
+ * The tables are released by rcl_action_client_fini() if still initialized.
+ *
+ * <hr>
+ * Attribute          | Adherence
+ * ------------------ | -------------
+ * Allocates Memory   | Yes
+ * Thread-Safe        | No
+ * Uses Atomics       | No
+ * Lock-Free          | Yes
+ *
+ * \param[in] action_client handle to the action client
+ * \param[in] window_size maximum outstanding requests per service client,
+ *   must be greater than zero
+ * \return `RCL_RET_OK` if pipelining was enabled, or
+ * \return `RCL_RET_ACTION_CLIENT_INVALID` if the action client is invalid, or
+ * \return `RCL_RET_INVALID_ARGUMENT` if window_size is zero, or
+ * \return `RCL_RET_ALREADY_INIT` if pipelining is already enabled, or
+ * \return `RCL_RET_BAD_ALLOC` if allocating a table failed.
+ */
+RCL_ACTION_PUBLIC
+RCL_WARN_UNUSED
+rcl_ret_t
+rcl_action_client_init_pipeline(
+  rcl_action_client_t * action_client,
+  size_t window_size);
+
+/// Finalize an action client's pipelined request mode.
+/**
+ * Completion contexts registered with outstanding requests are dropped
+ * without being invoked.
+ * Does nothing if pipelining was never enabled.
+ *
+ * \param[in] action_client handle to the action client
+ * \return `RCL_RET_OK` if pipelining was disabled or never enabled, or
+ * \return `RCL_RET_ACTION_CLIENT_INVALID` if the action client is invalid.
+ */
+RCL_ACTION_PUBLIC
+RCL_WARN_UNUSED
+rcl_ret_t
+rcl_action_client_fini_pipeline(rcl_action_client_t * action_client);
+
+/// Send a goal request whose response completes a caller-owned context.
+/**
+ * The asynchronous counterpart of rcl_action_send_goal_request(); the goal
+ * response is delivered to `context->on_complete` by
+ * rcl_action_drain_goal_responses(), see rcl_client_async_send_request()
+ * for the completion protocol.
+ *
+ * <hr>
+ * Attribute          | Adherence
+ * ------------------ | -------------
+ * Allocates Memory   | No
+ * Thread-Safe        | Yes
+ * Uses Atomics       | Yes
+ * Lock-Free          | Yes
+ *
+ * \param[in] action_client handle to the client with pipelining enabled
+ *   (see rcl_action_client_init_pipeline())
+ * \param[in] ros_goal_request pointer to the ROS goal request message
+ * \param[inout] context completion context with `on_complete` set; must
+ *   outlive the request
+ * \return `RCL_RET_OK` if the request was sent, or
+ * \return `RCL_RET_ACTION_CLIENT_INVALID` if the action client is invalid, or
+ * \return `RCL_RET_INVALID_ARGUMENT` if any arguments are invalid or
+ *         pipelining is not enabled, or
+ * \return `RCL_RET_ERROR` if the window is full or an unspecified error
+ *         occurs.
+ */
+RCL_ACTION_PUBLIC
+RCL_WARN_UNUSED
+rcl_ret_t
+rcl_action_async_send_goal_request(
+  const rcl_action_client_t * action_client,
+  const void * ros_goal_request,
+  rcl_client_completion_context_t * context);
+
+/// Send a result request whose response completes a caller-owned context.
+/**
+ * The asynchronous counterpart of rcl_action_send_result_request(); see
+ * rcl_action_async_send_goal_request().
+ *
+ * \param[in] action_client handle to the client with pipelining enabled
+ * \param[in] ros_result_request pointer to the ROS result request message
+ * \param[inout] context completion context with `on_complete` set
+ * \return see rcl_action_async_send_goal_request().
+ */
+RCL_ACTION_PUBLIC
+RCL_WARN_UNUSED
+rcl_ret_t
+rcl_action_async_send_result_request(
+  const rcl_action_client_t * action_client,
+  const void * ros_result_request,
+  rcl_client_completion_context_t * context);
+
+/// Send a cancel request whose response completes a caller-owned context.
+/**
+ * The asynchronous counterpart of rcl_action_send_cancel_request(); see
+ * rcl_action_async_send_goal_request().
+ *
+ * \param[in] action_client handle to the client with pipelining enabled
+ * \param[in] ros_cancel_request pointer to the ROS cancel request message
+ * \param[inout] context completion context with `on_complete` set
+ * \return see rcl_action_async_send_goal_request().
+ */
+RCL_ACTION_PUBLIC
+RCL_WARN_UNUSED
+rcl_ret_t
+rcl_action_async_send_cancel_request(
+  const rcl_action_client_t * action_client,
+  const void * ros_cancel_request,
+  rcl_client_completion_context_t * context);
+
+/// Drain queued goal responses, completing the matching pipelined requests.
+/**
+ * Call when the wait set reports the goal service client ready; behaves
+ * like rcl_client_drain_responses() on the goal client, invoking the
+ * completion context registered with each matching request.
+ *
+ * <hr>
+ * Attribute          | Adherence
+ * ------------------ | -------------
+ * Allocates Memory   | Maybe [1]
+ * Thread-Safe        | No
+ * Uses Atomics       | Yes
+ * Lock-Free          | Yes
+ * <i>[1] only if required when filling the response, avoided for fixed sizes</i>
+ *
+ * \param[in] action_client handle to the client with pipelining enabled
+ * \param[inout] ros_goal_response a ROS goal response message, reused for
+ *   every drained response
+ * \param[out] completed set to the number of completions invoked
+ * \return `RCL_RET_OK` if one or more responses completed a request, or
+ * \return `RCL_RET_ACTION_CLIENT_INVALID` if the action client is invalid, or
+ * \return `RCL_RET_INVALID_ARGUMENT` if any arguments are invalid or
+ *         pipelining is not enabled, or
+ * \return `RCL_RET_ACTION_CLIENT_TAKE_FAILED` if no response was available, or
+ * \return `RCL_RET_ERROR` if an unspecified error occurs.
+ */
+RCL_ACTION_PUBLIC
+RCL_WARN_UNUSED
+rcl_ret_t
+rcl_action_drain_goal_responses(
+  const rcl_action_client_t * action_client,
+  void * ros_goal_response,
+  size_t * completed);
+
+/// Drain queued result responses, completing the matching pipelined requests.
+/**
+ * See rcl_action_drain_goal_responses().
+ *
+ * \param[in] action_client handle to the client with pipelining enabled
+ * \param[inout] ros_result_response a ROS result response message, reused
+ *   for every drained response
+ * \param[out] completed set to the number of completions invoked
+ * \return see rcl_action_drain_goal_responses().
+ */
+RCL_ACTION_PUBLIC
+RCL_WARN_UNUSED
+rcl_ret_t
+rcl_action_drain_result_responses(
+  const rcl_action_client_t * action_client,
+  void * ros_result_response,
+  size_t * completed);
+
+/// Drain queued cancel responses, completing the matching pipelined requests.
+/**
+ * See rcl_action_drain_goal_responses().
+ *
+ * \param[in] action_client handle to the client with pipelining enabled
+ * \param[inout] ros_cancel_response a ROS cancel response message, reused
+ *   for every drained response
+ * \param[out] completed set to the number of completions invoked
+ * \return see rcl_action_drain_goal_responses().
+ */
+RCL_ACTION_PUBLIC
+RCL_WARN_UNUSED
+rcl_ret_t
+rcl_action_drain_cancel_responses(
+  const rcl_action_client_t * action_client,
+  void * ros_cancel_response,
+  size_t * completed);
+
 /// Get the name of the action for a rcl_action_client_t.
 /**
  * This function returns the action client's name string.
@@ -393,6 +393,54 @@ rcl_action_accept_new_goal(
   rcl_action_server_t * action_server,
   const rcl_action_goal_info_t * goal_info);
 
+/// Accept a batch of new goals using an action server.
+/**
+ * This is a non-blocking call.
+ *
+ * Behaves like calling rcl_action_accept_new_goal() once per goal info, but
+ * admits the whole batch in a single pass: the goal handle storage is grown
+ * once and the clock is sampled once, so every goal in the batch shares the
+ * same accept stamp.
+ *
+ * Admission is all or nothing.
+ * If any goal ID is already tracked by the action server, is repeated within
+ * the batch, or a failure occurs part way through, no goal is admitted and an
+ * error message is set.
+ *
+ * On success `goal_handles` holds one goal handle per goal info, in order.
+ * As with rcl_action_accept_new_goal(), the caller becomes responsible for
+ * finalizing each goal handle, and the pointers become invalid after
+ * rcl_action_server_fini() is called.
+ *
+ * <hr>
+ * Attribute          | Adherence
+ * ------------------ | -------------
+ * Allocates Memory   | Yes
+ * Thread-Safe        | No
+ * Uses Atomics       | No
+ * Lock-Free          | Yes
+ *
+ * \param[in] action_server handle to the action server that is accepting the goals
+ * \param[in] goal_infos array of messages containing info about the goals being accepted
+ * \param[in] num_goals number of goals in the batch, must be greater than zero
+ * \param[out] goal_handles caller-provided array of `num_goals` pointers populated
+ *   with a goal handle per accepted goal
+ * \return `RCL_RET_OK` if all goals were accepted, or
+ * \return `RCL_RET_ACTION_SERVER_INVALID` if the action server is invalid, or
+ * \return `RCL_RET_INVALID_ARGUMENT` if any arguments are invalid or a goal ID
+ *   is already tracked or repeated, or
+ * \return `RCL_RET_BAD_ALLOC` if allocating memory failed, or
+ * \return `RCL_RET_ERROR` if an unspecified error occurs.
+ */
+RCL_ACTION_PUBLIC
+RCL_WARN_UNUSED
+rcl_ret_t
+rcl_action_accept_new_goals(
+  rcl_action_server_t * action_server,
+  const rcl_action_goal_info_t * goal_infos,
+  size_t num_goals,
+  rcl_action_goal_handle_t ** goal_handles);
+
 /// Publish a ROS feedback message for an active goal using an action server.
 /**
  * The caller is responsible for ensuring that the type of `ros_feedback`
@@ -819,6 +867,38 @@ RCL_WARN_UNUSED
 const rcl_action_server_options_t *
 rcl_action_server_get_options(const rcl_action_server_t * action_server);
 
+/// Return the feedback publisher held by an action server.
+/**
+ * This function returns a borrowed reference to the action server's internal
+ * feedback publisher, validated once at acquisition. High-rate feedback
+ * streams can publish on it directly with rcl_publish(), skipping the
+ * per-call action server validation that rcl_action_publish_feedback()
+ * performs; the message type is the feedback message of the action type
+ * support the server was initialized with.
+ * This function can fail, and therefore return `NULL`, if the:
+ *   - action server is `NULL`
+ *   - action server is invalid (e.g. never called init or called fini)
+ *
+ * The returned publisher is only valid as long as the action server is valid
+ * and must not be finalized by the caller.
+ *
+ * <hr>
+ * Attribute          | Adherence
+ * ------------------ | -------------
+ * Allocates Memory   | No
+ * Thread-Safe        | No
+ * Uses Atomics       | No
+ * Lock-Free          | Yes
+ *
+ * \param[in] action_server handle to the action server
+ * \return pointer to the feedback publisher if successful, or
+ * \return `NULL` otherwise.
+ */
+RCL_ACTION_PUBLIC
+RCL_WARN_UNUSED
+const rcl_publisher_t *
+rcl_action_server_get_feedback_publisher(const rcl_action_server_t * action_server);
+
 /// Get the goal handles for all goals an action server is tracking.
 /**
  * A pointer to the internally held array of pointers to goal handle structs is returned
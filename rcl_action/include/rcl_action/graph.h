@@ -155,6 +155,122 @@ rcl_action_get_names_and_types(
   rcl_allocator_t * allocator,
   rcl_names_and_types_t * action_names_and_types);
 
+typedef struct rcl_action_names_cache_impl_s rcl_action_names_cache_impl_t;
+
+/// A cache of the demangled action names and types in the graph.
+/**
+ * rcl_action_get_names_and_types() re-fetches the whole topic list and
+ * re-runs the string based action filtering and demangling on every call.
+ * This cache sits on rcl's graph cache: the topic snapshot is refreshed only
+ * when the graph guard condition fired, and the action classification and
+ * demangling are done once per refreshed snapshot, so repeated
+ * goal-availability checks between graph events are served as a view over
+ * already demangled storage without allocating or parsing.
+ */
+typedef struct rcl_action_names_cache_s
+{
+  /// Private implementation pointer.
+  rcl_action_names_cache_impl_t * impl;
+} rcl_action_names_cache_t;
+
+/// Return a rcl_action_names_cache_t struct with members initialized to `NULL`.
+RCL_ACTION_PUBLIC
+RCL_WARN_UNUSED
+rcl_action_names_cache_t
+rcl_action_get_zero_initialized_names_cache(void);
+
+/// Initialize an action names cache for a node.
+/**
+ * The node must stay valid for the lifetime of the cache, and the node's
+ * graph guard condition should not be used in other wait sets concurrently.
+ *
+ * <hr>
+ * Attribute          | Adherence
+ * ------------------ | -------------
+ * Allocates Memory   | Yes
+ * Thread-Safe        | No
+ * Uses Atomics       | No
+ * Lock-Free          | Yes
+ *
+ * \param[inout] cache a zero initialized cache to be initialized
+ * \param[in] node a valid node whose graph is cached
+ * \param[in] allocator the allocator for the cached storage
+ * \return `RCL_RET_OK` if the cache was initialized successfully, or
+ * \return `RCL_RET_ALREADY_INIT` if the cache is already initialized, or
+ * \return `RCL_RET_NODE_INVALID` if the node is invalid, or
+ * \return `RCL_RET_INVALID_ARGUMENT` if any arguments are invalid, or
+ * \return `RCL_RET_BAD_ALLOC` if allocating memory failed, or
+ * \return `RCL_RET_ERROR` if an unspecified error occurs.
+ */
+RCL_ACTION_PUBLIC
+RCL_WARN_UNUSED
+rcl_ret_t
+rcl_action_names_cache_init(
+  rcl_action_names_cache_t * cache,
+  const rcl_node_t * node,
+  rcl_allocator_t * allocator);
+
+/// Finalize an action names cache.
+/**
+ * Views previously returned by
+ * rcl_action_names_cache_get_names_and_types() are invalidated.
+ *
+ * <hr>
+ * Attribute          | Adherence
+ * ------------------ | -------------
+ * Allocates Memory   | No
+ * Thread-Safe        | No
+ * Uses Atomics       | Yes
+ * Lock-Free          | Yes
+ *
+ * \param[inout] cache the cache to be finalized
+ * \return `RCL_RET_OK` if the cache was finalized successfully, or
+ * \return `RCL_RET_INVALID_ARGUMENT` if any arguments are invalid, or
+ * \return `RCL_RET_ERROR` if an unspecified error occurs.
+ */
+RCL_ACTION_PUBLIC
+RCL_WARN_UNUSED
+rcl_ret_t
+rcl_action_names_cache_fini(rcl_action_names_cache_t * cache);
+
+/// Get the demangled action names and types as a view over the cache.
+/**
+ * If the graph changed since the previous call, the underlying topic
+ * snapshot is refreshed and the action filtering and demangling are re-run;
+ * otherwise the previously demangled result is returned as-is.
+ *
+ * The returned view is owned by the cache and stays valid until the next
+ * call that observes a graph change, or until the cache is finalized;
+ * callers that need the result beyond that must copy it.
+ * The version is incremented whenever the demangled set is rebuilt, letting
+ * callers skip their own reprocessing between graph events.
+ *
+ * <hr>
+ * Attribute          | Adherence
+ * ------------------ | -------------
+ * Allocates Memory   | Yes [1]
+ * Thread-Safe        | No
+ * Uses Atomics       | Yes
+ * Lock-Free          | Yes
+ * <i>[1] only when the graph changed since the previous call</i>
+ *
+ * \param[inout] cache the cache to be queried
+ * \param[out] action_names_and_types view of the demangled names and types
+ * \param[out] version demangled set version, may be `NULL`
+ * \return `RCL_RET_OK` if the query was successful, or
+ * \return `RCL_RET_NODE_INVALID` if the node is invalid, or
+ * \return `RCL_RET_INVALID_ARGUMENT` if any arguments are invalid, or
+ * \return `RCL_RET_BAD_ALLOC` if allocating memory failed, or
+ * \return `RCL_RET_ERROR` if an unspecified error occurs.
+ */
+RCL_ACTION_PUBLIC
+RCL_WARN_UNUSED
+rcl_ret_t
+rcl_action_names_cache_get_names_and_types(
+  rcl_action_names_cache_t * cache,
+  const rcl_names_and_types_t ** action_names_and_types,
+  uint64_t * version);
+
 #ifdef __cplusplus
 }
 #endif
@@ -20,6 +20,10 @@ extern "C"
 {
 #endif
 
+#include <stdbool.h>
+#include <stdint.h>
+#include <string.h>
+
 #include "rcl_action/visibility_control.h"
 
 #include "action_msgs/msg/goal_info.h"
@@ -55,7 +59,53 @@ extern "C"
 
 // TODO(jacobperron): Move these to a common place for UUIDs
 #define UUID_SIZE 16
-#define uuidcmp(uuid0, uuid1) (0 == memcmp(uuid0, uuid1, UUID_SIZE))
+
+/// Compare two goal UUIDs for equality.
+/**
+ * The UUIDs are compared as two 64-bit words instead of bytewise.
+ * They are loaded with memcpy because message storage only guarantees byte
+ * alignment; compilers turn this into plain word loads.
+ *
+ * \param[in] uuid0 pointer to the first 16 byte goal UUID
+ * \param[in] uuid1 pointer to the second 16 byte goal UUID
+ * \return `true` if the UUIDs are equal, `false` otherwise
+ */
+static inline bool
+rcl_action_goal_uuid_equal(const uint8_t * uuid0, const uint8_t * uuid1)
+{
+  uint64_t lo0, hi0, lo1, hi1;
+  memcpy(&lo0, uuid0, sizeof(lo0));
+  memcpy(&hi0, uuid0 + sizeof(lo0), sizeof(hi0));
+  memcpy(&lo1, uuid1, sizeof(lo1));
+  memcpy(&hi1, uuid1 + sizeof(lo1), sizeof(hi1));
+  return lo0 == lo1 && hi0 == hi1;
+}
+
+/// Hash a goal UUID.
+/**
+ * Mixes the two 64-bit words of the UUID through a splitmix64 style finalizer,
+ * so that all input bits influence the low bits of the result and the hash can
+ * be reduced to a power-of-two table size by masking.
+ *
+ * \param[in] uuid pointer to the 16 byte goal UUID to hash
+ * \return the hash of the UUID
+ */
+static inline size_t
+rcl_action_goal_uuid_hash(const uint8_t * uuid)
+{
+  uint64_t lo, hi;
+  memcpy(&lo, uuid, sizeof(lo));
+  memcpy(&hi, uuid + sizeof(lo), sizeof(hi));
+  uint64_t hash = lo ^ (hi * 0x9E3779B97F4A7C15ULL);
+  hash ^= hash >> 30;
+  hash *= 0xBF58476D1CE4E5B9ULL;
+  hash ^= hash >> 27;
+  hash *= 0x94D049BB133111EBULL;
+  hash ^= hash >> 31;
+  return (size_t)hash;
+}
+
+#define uuidcmp(uuid0, uuid1) rcl_action_goal_uuid_equal(uuid0, uuid1)
 #define zerouuid (uint8_t[UUID_SIZE]) {0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}
 #define uuidcmpzero(uuid) uuidcmp(uuid, (zerouuid))
 
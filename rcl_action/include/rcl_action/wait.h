@@ -244,6 +244,10 @@ rcl_action_client_wait_set_get_entities_ready(
  * to call: rcl_action_take_goal_request(), rcl_action_take_cancel_request(), or
  * rcl_action_take_result_request().
  *
+ * Readiness is decoded from the readiness bitmaps that rcl_wait() populates, so
+ * this function should only be called after rcl_wait() has returned on the
+ * given wait set.
+ *
  * <hr>
  * Attribute          | Adherence
  * ------------------ | -------------
@@ -17,6 +17,8 @@ extern "C"
 {
 #endif
 
+#include <string.h>
+
 #include "rcl_action/action_client.h"
 #include "./action_client_impl.h"
 
@@ -59,6 +61,12 @@ _rcl_action_get_zero_initialized_client_impl(void)
     null_subscription,
     rcl_action_client_get_default_options(),
     NULL,
+    NULL,
+    0,
+    0,
+    0,
+    NULL,
+    NULL,
     0,
     0,
     0,
@@ -92,6 +100,7 @@ _rcl_action_client_fini_impl(
     ret = RCL_RET_ERROR;
   }
   allocator.deallocate(action_client->impl->action_name, allocator.state);
+  allocator.deallocate(action_client->impl->goal_status_entries, allocator.state);
   allocator.deallocate(action_client->impl, allocator.state);
   action_client->impl = NULL;
   RCUTILS_LOG_DEBUG_NAMED(ROS_PACKAGE_NAME, "Action client finalized");
@@ -408,6 +417,153 @@ rcl_action_take_cancel_response(
   TAKE_SERVICE_RESPONSE(cancel, response_header, ros_cancel_response);
 }
 
+rcl_ret_t
+rcl_action_client_init_pipeline(
+  rcl_action_client_t * action_client,
+  size_t window_size)
+{
+  if (!rcl_action_client_is_valid(action_client)) {
+    return RCL_RET_ACTION_CLIENT_INVALID;  // error already set
+  }
+  rcl_ret_t ret = rcl_client_init_pipeline(
+    &action_client->impl->goal_client, window_size);
+  if (RCL_RET_OK != ret) {
+    return ret;  // error already set
+  }
+  ret = rcl_client_init_pipeline(&action_client->impl->result_client, window_size);
+  if (RCL_RET_OK != ret) {
+    goto fini_goal_pipeline;
+  }
+  ret = rcl_client_init_pipeline(&action_client->impl->cancel_client, window_size);
+  if (RCL_RET_OK != ret) {
+    goto fini_result_pipeline;
+  }
+  return RCL_RET_OK;
+
+fini_result_pipeline:
+  if (RCL_RET_OK != rcl_client_fini_pipeline(&action_client->impl->result_client)) {
+    RCUTILS_SAFE_FWRITE_TO_STDERR(rcl_get_error_string().str);
+    RCUTILS_SAFE_FWRITE_TO_STDERR("\n");
+  }
+fini_goal_pipeline:
+  if (RCL_RET_OK != rcl_client_fini_pipeline(&action_client->impl->goal_client)) {
+    RCUTILS_SAFE_FWRITE_TO_STDERR(rcl_get_error_string().str);
+    RCUTILS_SAFE_FWRITE_TO_STDERR("\n");
+  }
+  return ret;
+}
+
+rcl_ret_t
+rcl_action_client_fini_pipeline(rcl_action_client_t * action_client)
+{
+  if (!rcl_action_client_is_valid(action_client)) {
+    return RCL_RET_ACTION_CLIENT_INVALID;  // error already set
+  }
+  rcl_ret_t result = RCL_RET_OK;
+  rcl_ret_t ret = rcl_client_fini_pipeline(&action_client->impl->goal_client);
+  if (RCL_RET_OK != ret) {
+    result = ret;
+  }
+  ret = rcl_client_fini_pipeline(&action_client->impl->result_client);
+  if (RCL_RET_OK != ret) {
+    result = ret;
+  }
+  ret = rcl_client_fini_pipeline(&action_client->impl->cancel_client);
+  if (RCL_RET_OK != ret) {
+    result = ret;
+  }
+  return result;
+}
+
+// \internal Sends an action client specific service request asynchronously.
+#define ASYNC_SEND_SERVICE_REQUEST(Type, request, context) \
+  RCUTILS_LOG_DEBUG_NAMED(ROS_PACKAGE_NAME, "Async sending action " #Type " request"); \
+  if (!rcl_action_client_is_valid(action_client)) { \
+    return RCL_RET_ACTION_CLIENT_INVALID;  /* error already set */ \
+  } \
+  rcl_ret_t ret = rcl_client_async_send_request( \
+    &action_client->impl->Type ## _client, request, context); \
+  if (RCL_RET_OK != ret) { \
+    if (RCL_RET_INVALID_ARGUMENT == ret) { \
+      return RCL_RET_INVALID_ARGUMENT;  /* error already set */ \
+    } \
+    return RCL_RET_ERROR;  /* error already set */ \
+  } \
+  return RCL_RET_OK;
+
+// \internal Drains an action client specific service's responses.
+#define DRAIN_SERVICE_RESPONSES(Type, response, completed) \
+  RCUTILS_LOG_DEBUG_NAMED(ROS_PACKAGE_NAME, "Draining action " #Type " responses"); \
+  if (!rcl_action_client_is_valid(action_client)) { \
+    return RCL_RET_ACTION_CLIENT_INVALID;  /* error already set */ \
+  } \
+  rcl_ret_t ret = rcl_client_drain_responses( \
+    &action_client->impl->Type ## _client, response, completed); \
+  if (RCL_RET_OK != ret) { \
+    if (RCL_RET_CLIENT_TAKE_FAILED == ret) { \
+      return RCL_RET_ACTION_CLIENT_TAKE_FAILED; \
+    } \
+    if (RCL_RET_INVALID_ARGUMENT == ret) { \
+      return RCL_RET_INVALID_ARGUMENT;  /* error already set */ \
+    } \
+    return RCL_RET_ERROR;  /* error already set */ \
+  } \
+  return RCL_RET_OK;
+
+rcl_ret_t
+rcl_action_async_send_goal_request(
+  const rcl_action_client_t * action_client,
+  const void * ros_goal_request,
+  rcl_client_completion_context_t * context)
+{
+  ASYNC_SEND_SERVICE_REQUEST(goal, ros_goal_request, context);
+}
+
+rcl_ret_t
+rcl_action_async_send_result_request(
+  const rcl_action_client_t * action_client,
+  const void * ros_result_request,
+  rcl_client_completion_context_t * context)
+{
+  ASYNC_SEND_SERVICE_REQUEST(result, ros_result_request, context);
+}
+
+rcl_ret_t
+rcl_action_async_send_cancel_request(
+  const rcl_action_client_t * action_client,
+  const void * ros_cancel_request,
+  rcl_client_completion_context_t * context)
+{
+  ASYNC_SEND_SERVICE_REQUEST(cancel, ros_cancel_request, context);
+}
+
+rcl_ret_t
+rcl_action_drain_goal_responses(
+  const rcl_action_client_t * action_client,
+  void * ros_goal_response,
+  size_t * completed)
+{
+  DRAIN_SERVICE_RESPONSES(goal, ros_goal_response, completed);
+}
+
+rcl_ret_t
+rcl_action_drain_result_responses(
+  const rcl_action_client_t * action_client,
+  void * ros_result_response,
+  size_t * completed)
+{
+  DRAIN_SERVICE_RESPONSES(result, ros_result_response, completed);
+}
+
+rcl_ret_t
+rcl_action_drain_cancel_responses(
+  const rcl_action_client_t * action_client,
+  void * ros_cancel_response,
+  size_t * completed)
+{
+  DRAIN_SERVICE_RESPONSES(cancel, ros_cancel_response, completed);
+}
+
 // \internal Takes an action client specific topic message.
 #define TAKE_MESSAGE(Type) \
   RCUTILS_LOG_DEBUG_NAMED(ROS_PACKAGE_NAME, "Taking action " #Type); \
@@ -438,12 +594,232 @@ rcl_action_take_feedback(
   TAKE_MESSAGE(feedback);
 }
 
+// Goal status table slot states
+#define GOAL_STATUS_SLOT_EMPTY 0u
+#define GOAL_STATUS_SLOT_OCCUPIED 1u
+#define GOAL_STATUS_SLOT_DELETED 2u
+// Initial goal status table capacity, must be a power of two
+#define GOAL_STATUS_TABLE_MIN_CAPACITY 32u
+
+// Implementation only
+static rcl_action_client_goal_status_entry_t *
+_find_goal_status_entry(const rcl_action_client_impl_t * impl, const uint8_t * uuid)
+{
+  if (NULL == impl->goal_status_entries) {
+    return NULL;
+  }
+  const size_t mask = impl->goal_status_capacity - 1u;
+  size_t slot = rcl_action_goal_uuid_hash(uuid) & mask;
+  for (size_t probe = 0u; probe < impl->goal_status_capacity; ++probe) {
+    rcl_action_client_goal_status_entry_t * entry = &impl->goal_status_entries[slot];
+    if (GOAL_STATUS_SLOT_EMPTY == entry->slot_state) {
+      return NULL;
+    }
+    if (GOAL_STATUS_SLOT_OCCUPIED == entry->slot_state && uuidcmp(entry->goal_id, uuid)) {
+      return entry;
+    }
+    slot = (slot + 1u) & mask;
+  }
+  return NULL;
+}
+
+// Implementation only
+static rcl_action_client_goal_status_entry_t *
+_goal_status_free_slot(
+  rcl_action_client_goal_status_entry_t * entries, size_t capacity, const uint8_t * uuid)
+{
+  // The table is kept under half full, so a non-occupied slot always exists
+  const size_t mask = capacity - 1u;
+  size_t slot = rcl_action_goal_uuid_hash(uuid) & mask;
+  while (GOAL_STATUS_SLOT_OCCUPIED == entries[slot].slot_state) {
+    slot = (slot + 1u) & mask;
+  }
+  return &entries[slot];
+}
+
+// Implementation only
+static rcl_ret_t
+_goal_status_table_reserve(rcl_action_client_impl_t * impl, size_t num_incoming)
+{
+  rcl_allocator_t allocator = impl->options.allocator;
+  const size_t required = impl->num_goal_statuses + num_incoming;
+  if (NULL != impl->goal_status_entries && impl->goal_status_capacity >= 2u * required) {
+    return RCL_RET_OK;
+  }
+  size_t new_capacity = GOAL_STATUS_TABLE_MIN_CAPACITY;
+  while (new_capacity < 2u * required) {
+    new_capacity *= 2u;
+  }
+  rcl_action_client_goal_status_entry_t * new_entries =
+    (rcl_action_client_goal_status_entry_t *) allocator.zero_allocate(
+    new_capacity, sizeof(rcl_action_client_goal_status_entry_t), allocator.state);
+  if (NULL == new_entries) {
+    RCL_SET_ERROR_MSG("allocating goal status table failed");
+    return RCL_RET_BAD_ALLOC;
+  }
+  // Rehash occupied entries; tombstones are dropped along the way
+  for (size_t i = 0u; i < impl->goal_status_capacity; ++i) {
+    const rcl_action_client_goal_status_entry_t * entry = &impl->goal_status_entries[i];
+    if (GOAL_STATUS_SLOT_OCCUPIED != entry->slot_state) {
+      continue;
+    }
+    *_goal_status_free_slot(new_entries, new_capacity, entry->goal_id) = *entry;
+  }
+  allocator.deallocate(impl->goal_status_entries, allocator.state);
+  impl->goal_status_entries = new_entries;
+  impl->goal_status_capacity = new_capacity;
+  return RCL_RET_OK;
+}
+
+// Implementation only
+static rcl_ret_t
+_ingest_goal_statuses(
+  rcl_action_client_impl_t * impl, const action_msgs__msg__GoalStatusArray * status_array)
+{
+  // Grow up front so the update below cannot fail part way through
+  rcl_ret_t ret = _goal_status_table_reserve(impl, status_array->status_list.size);
+  if (RCL_RET_OK != ret) {
+    return ret;  // error already set
+  }
+  ++impl->goal_status_generation;
+  for (size_t i = 0u; i < status_array->status_list.size; ++i) {
+    const action_msgs__msg__GoalStatus * status = &status_array->status_list.data[i];
+    const uint8_t * uuid = status->goal_info.goal_id.uuid;
+    rcl_action_client_goal_status_entry_t * entry = _find_goal_status_entry(impl, uuid);
+    if (NULL == entry) {
+      entry = _goal_status_free_slot(
+        impl->goal_status_entries, impl->goal_status_capacity, uuid);
+      memcpy(entry->goal_id, uuid, UUID_SIZE);
+      entry->status = GOAL_STATE_UNKNOWN;
+      entry->slot_state = GOAL_STATUS_SLOT_OCCUPIED;
+      ++impl->num_goal_statuses;
+    }
+    entry->last_seen = impl->goal_status_generation;
+    if (status->status == entry->status) {
+      continue;
+    }
+    const rcl_action_goal_state_t previous_state = entry->status;
+    entry->status = status->status;
+    if (NULL != impl->goal_status_callback) {
+      impl->goal_status_callback(
+        uuid, previous_state, entry->status, impl->goal_status_user_data);
+    }
+  }
+  // Drop terminal goals the action server stopped publishing status for
+  for (size_t i = 0u; i < impl->goal_status_capacity; ++i) {
+    rcl_action_client_goal_status_entry_t * entry = &impl->goal_status_entries[i];
+    if (GOAL_STATUS_SLOT_OCCUPIED != entry->slot_state ||
+      impl->goal_status_generation == entry->last_seen)
+    {
+      continue;
+    }
+    if (GOAL_STATE_SUCCEEDED == entry->status ||
+      GOAL_STATE_CANCELED == entry->status ||
+      GOAL_STATE_ABORTED == entry->status)
+    {
+      entry->slot_state = GOAL_STATUS_SLOT_DELETED;
+      --impl->num_goal_statuses;
+    }
+  }
+  return RCL_RET_OK;
+}
+
 rcl_ret_t
 rcl_action_take_status(
   const rcl_action_client_t * action_client,
   void * ros_status)
 {
-  TAKE_MESSAGE(status);
+  RCUTILS_LOG_DEBUG_NAMED(ROS_PACKAGE_NAME, "Taking action status");
+  if (!rcl_action_client_is_valid(action_client)) {
+    return RCL_RET_ACTION_CLIENT_INVALID;  // error already set
+  }
+  RCL_CHECK_ARGUMENT_FOR_NULL(ros_status, RCL_RET_INVALID_ARGUMENT);
+  rmw_message_info_t message_info;  // ignored
+  rcl_ret_t ret = rcl_take(
+    &action_client->impl->status_subscription, ros_status, &message_info, NULL);
+  if (RCL_RET_OK != ret) {
+    if (RCL_RET_SUBSCRIPTION_TAKE_FAILED == ret) {
+      return RCL_RET_ACTION_CLIENT_TAKE_FAILED;
+    }
+    if (RCL_RET_BAD_ALLOC == ret) {
+      return RCL_RET_BAD_ALLOC;
+    }
+    return RCL_RET_ERROR;
+  }
+  if (NULL != action_client->impl->goal_status_entries) {
+    // The status topic type is action_msgs/GoalStatusArray for every action type
+    ret = _ingest_goal_statuses(
+      action_client->impl, (const action_msgs__msg__GoalStatusArray *)ros_status);
+    if (RCL_RET_OK != ret) {
+      return ret;  // error already set; the message was still taken
+    }
+  }
+  RCUTILS_LOG_DEBUG_NAMED(ROS_PACKAGE_NAME, "Action status taken");
+  return RCL_RET_OK;
+}
+
+rcl_ret_t
+rcl_action_client_enable_goal_status_tracking(
+  const rcl_action_client_t * action_client,
+  bool enable)
+{
+  if (!rcl_action_client_is_valid(action_client)) {
+    return RCL_RET_ACTION_CLIENT_INVALID;  // error already set
+  }
+  rcl_action_client_impl_t * impl = action_client->impl;
+  rcl_allocator_t allocator = impl->options.allocator;
+  if (!enable) {
+    allocator.deallocate(impl->goal_status_entries, allocator.state);
+    impl->goal_status_entries = NULL;
+    impl->goal_status_capacity = 0u;
+    impl->num_goal_statuses = 0u;
+    impl->goal_status_generation = 0u;
+    return RCL_RET_OK;
+  }
+  if (NULL != impl->goal_status_entries) {
+    return RCL_RET_OK;
+  }
+  impl->goal_status_entries =
+    (rcl_action_client_goal_status_entry_t *) allocator.zero_allocate(
+    GOAL_STATUS_TABLE_MIN_CAPACITY, sizeof(rcl_action_client_goal_status_entry_t),
+    allocator.state);
+  if (NULL == impl->goal_status_entries) {
+    RCL_SET_ERROR_MSG("allocating goal status table failed");
+    return RCL_RET_BAD_ALLOC;
+  }
+  impl->goal_status_capacity = GOAL_STATUS_TABLE_MIN_CAPACITY;
+  return RCL_RET_OK;
+}
+
+rcl_ret_t
+rcl_action_client_get_goal_status(
+  const rcl_action_client_t * action_client,
+  const rcl_action_goal_info_t * goal_info,
+  rcl_action_goal_state_t * status)
+{
+  if (!rcl_action_client_is_valid(action_client)) {
+    return RCL_RET_ACTION_CLIENT_INVALID;  // error already set
+  }
+  RCL_CHECK_ARGUMENT_FOR_NULL(goal_info, RCL_RET_INVALID_ARGUMENT);
+  RCL_CHECK_ARGUMENT_FOR_NULL(status, RCL_RET_INVALID_ARGUMENT);
+  const rcl_action_client_goal_status_entry_t * entry =
+    _find_goal_status_entry(action_client->impl, goal_info->goal_id.uuid);
+  *status = (NULL != entry) ? entry->status : GOAL_STATE_UNKNOWN;
+  return RCL_RET_OK;
+}
+
+rcl_ret_t
+rcl_action_client_set_goal_status_tracking_callback(
+  const rcl_action_client_t * action_client,
+  rcl_action_client_goal_status_callback_t callback,
+  void * user_data)
+{
+  if (!rcl_action_client_is_valid(action_client)) {
+    return RCL_RET_ACTION_CLIENT_INVALID;  // error already set
+  }
+  action_client->impl->goal_status_callback = callback;
+  action_client->impl->goal_status_user_data = user_data;
+  return RCL_RET_OK;
 }
 
 const char *
@@ -15,9 +15,23 @@
 #ifndef RCL_ACTION__ACTION_CLIENT_IMPL_H_
 #define RCL_ACTION__ACTION_CLIENT_IMPL_H_
 
+#include "rcl_action/action_client.h"
 #include "rcl_action/types.h"
 #include "rcl/rcl.h"
 
+/// Tracked status of a single goal, stored in the client's open addressing
+/// goal status table. Slot state is zero for an empty slot, one for an
+/// occupied slot and two for a deleted slot (tombstone).
+typedef struct rcl_action_client_goal_status_entry_s
+{
+  uint8_t goal_id[UUID_SIZE];
+  rcl_action_goal_state_t status;
+  uint8_t slot_state;
+  // Ingestion sweep that last reported this goal, used to drop goals the
+  // action server no longer publishes status for
+  size_t last_seen;
+} rcl_action_client_goal_status_entry_t;
+
 typedef struct rcl_action_client_impl_s
 {
   rcl_client_t goal_client;
@@ -27,6 +41,15 @@ typedef struct rcl_action_client_impl_s
   rcl_subscription_t status_subscription;
   rcl_action_client_options_t options;
   char * action_name;
+  // Open addressing goal status table keyed by goal UUID, updated from status
+  // arrays taken with rcl_action_take_status(). Power-of-two capacity, kept
+  // under half full. NULL while goal status tracking is disabled.
+  rcl_action_client_goal_status_entry_t * goal_status_entries;
+  size_t goal_status_capacity;
+  size_t num_goal_statuses;
+  size_t goal_status_generation;
+  rcl_action_client_goal_status_callback_t goal_status_callback;
+  void * goal_status_user_data;
   // Wait set records
   size_t wait_set_goal_client_index;
   size_t wait_set_cancel_client_index;
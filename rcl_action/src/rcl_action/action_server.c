@@ -17,6 +17,8 @@ extern "C"
 {
 #endif
 
+#include <stdint.h>
+
 #include "rcl_action/action_server.h"
 #include "./action_server_impl.h"
 
@@ -158,6 +160,11 @@ rcl_action_server_init(
   action_server->impl->options = *options;  // copy options
   action_server->impl->goal_handles = NULL;
   action_server->impl->num_goal_handles = 0u;
+  action_server->impl->capacity_goal_handles = 0u;
+  action_server->impl->goal_index_slots = NULL;
+  action_server->impl->goal_index_capacity = 0u;
+  action_server->impl->goal_stamps_ordered = true;
+  action_server->impl->last_goal_stamp = INT64_MIN;
   action_server->impl->clock = NULL;
 
   rcl_ret_t ret = RCL_RET_OK;
@@ -249,6 +256,10 @@ rcl_action_server_fini(rcl_action_server_t * action_server, rcl_node_t * node)
     }
     allocator.deallocate(action_server->impl->goal_handles, allocator.state);
     action_server->impl->goal_handles = NULL;
+    if (action_server->impl->goal_index_slots) {
+      allocator.deallocate(action_server->impl->goal_index_slots, allocator.state);
+      action_server->impl->goal_index_slots = NULL;
+    }
     // Deallocate struct
     allocator.deallocate(action_server->impl, allocator.state);
     action_server->impl = NULL;
@@ -339,6 +350,102 @@ _nanosec_to_goal_info_stamp(const int64_t * nanosec, rcl_action_goal_info_t * go
   goal_info->stamp.nanosec = *nanosec % RCUTILS_S_TO_NS(1);
 }
 
+// Number of held goals at which lookups switch from scanning to the hash index
+#define GOAL_INDEX_MIN_GOALS 16u
+
+// Minimum number of slots allocated for the goal handle pointer array
+#define GOAL_HANDLES_MIN_CAPACITY 8u
+
+// Implementation only
+static void
+_goal_index_free(rcl_action_server_impl_t * impl)
+{
+  if (NULL != impl->goal_index_slots) {
+    rcl_allocator_t allocator = impl->options.allocator;
+    allocator.deallocate(impl->goal_index_slots, allocator.state);
+    impl->goal_index_slots = NULL;
+    impl->goal_index_capacity = 0u;
+  }
+}
+
+// Implementation only; the caller guarantees a free slot exists
+static bool
+_goal_index_insert(rcl_action_server_impl_t * impl, size_t goal_handle_idx)
+{
+  rcl_action_goal_info_t goal_info = rcl_action_get_zero_initialized_goal_info();
+  rcl_ret_t ret = rcl_action_goal_handle_get_info(
+    impl->goal_handles[goal_handle_idx], &goal_info);
+  if (RCL_RET_OK != ret) {
+    return false;
+  }
+  const size_t mask = impl->goal_index_capacity - 1u;
+  size_t slot = rcl_action_goal_uuid_hash(goal_info.goal_id.uuid) & mask;
+  while (0u != impl->goal_index_slots[slot]) {
+    slot = (slot + 1u) & mask;
+  }
+  impl->goal_index_slots[slot] = goal_handle_idx + 1u;
+  return true;
+}
+
+// Implementation only; (re)build the index with room for every held goal
+static bool
+_goal_index_build(rcl_action_server_impl_t * impl)
+{
+  _goal_index_free(impl);
+  // Power of two capacity kept under half full so probe chains stay short
+  size_t capacity = 2u * GOAL_INDEX_MIN_GOALS;
+  while (capacity < 4u * impl->num_goal_handles) {
+    capacity *= 2u;
+  }
+  rcl_allocator_t allocator = impl->options.allocator;
+  impl->goal_index_slots = (size_t *)allocator.zero_allocate(
+    capacity, sizeof(size_t), allocator.state);
+  if (NULL == impl->goal_index_slots) {
+    // Not an error; lookups fall back to linear scans
+    return false;
+  }
+  impl->goal_index_capacity = capacity;
+  for (size_t i = 0u; i < impl->num_goal_handles; ++i) {
+    if (!_goal_index_insert(impl, i)) {
+      _goal_index_free(impl);
+      return false;
+    }
+  }
+  return true;
+}
+
+// Implementation only; return the array index of the goal with this UUID,
+// or SIZE_MAX if it is not held
+static size_t
+_find_goal_handle(rcl_action_server_impl_t * impl, const uint8_t * uuid)
+{
+  rcl_action_goal_info_t goal_info = rcl_action_get_zero_initialized_goal_info();
+  if (NULL == impl->goal_index_slots && impl->num_goal_handles >= GOAL_INDEX_MIN_GOALS) {
+    (void)_goal_index_build(impl);
+  }
+  if (NULL != impl->goal_index_slots) {
+    const size_t mask = impl->goal_index_capacity - 1u;
+    size_t slot = rcl_action_goal_uuid_hash(uuid) & mask;
+    while (0u != impl->goal_index_slots[slot]) {
+      const size_t goal_handle_idx = impl->goal_index_slots[slot] - 1u;
+      rcl_ret_t ret = rcl_action_goal_handle_get_info(
+        impl->goal_handles[goal_handle_idx], &goal_info);
+      if (RCL_RET_OK == ret && uuidcmp(uuid, goal_info.goal_id.uuid)) {
+        return goal_handle_idx;
+      }
+      slot = (slot + 1u) & mask;
+    }
+    return SIZE_MAX;
+  }
+  for (size_t i = 0u; i < impl->num_goal_handles; ++i) {
+    rcl_ret_t ret = rcl_action_goal_handle_get_info(impl->goal_handles[i], &goal_info);
+    if (RCL_RET_OK == ret && uuidcmp(uuid, goal_info.goal_id.uuid)) {
+      return i;
+    }
+  }
+  return SIZE_MAX;
+}
+
 rcl_action_goal_handle_t *
 rcl_action_accept_new_goal(
   rcl_action_server_t * action_server,
@@ -355,28 +462,37 @@ rcl_action_accept_new_goal(
     return NULL;
   }
 
-  // Allocate space in the goal handle pointer array
+  // Allocate space for a new goal handle
   rcl_allocator_t allocator = action_server->impl->options.allocator;
-  rcl_action_goal_handle_t ** goal_handles = action_server->impl->goal_handles;
   const size_t num_goal_handles = action_server->impl->num_goal_handles;
-  // TODO(jacobperron): Don't allocate for every accepted goal handle,
-  //                    instead double the memory allocated if needed.
   const size_t new_num_goal_handles = num_goal_handles + 1u;
-  void * tmp_ptr = allocator.reallocate(
-    goal_handles, new_num_goal_handles * sizeof(rcl_action_goal_handle_t *), allocator.state);
+  void * tmp_ptr = allocator.allocate(sizeof(rcl_action_goal_handle_t), allocator.state);
   if (!tmp_ptr) {
-    RCL_SET_ERROR_MSG("memory allocation failed for goal handle pointer");
+    RCL_SET_ERROR_MSG("memory allocation failed for new goal handle");
     return NULL;
   }
-  goal_handles = (rcl_action_goal_handle_t **)tmp_ptr;
+  rcl_action_goal_handle_t * new_goal_handle = (rcl_action_goal_handle_t *)tmp_ptr;
 
-  // Allocate space for a new goal handle
-  tmp_ptr = allocator.allocate(sizeof(rcl_action_goal_handle_t), allocator.state);
-  if (!tmp_ptr) {
-    RCL_SET_ERROR_MSG("memory allocation failed for new goal handle");
-    return NULL;
+  // Ensure the goal handle pointer array has room, doubling its capacity when
+  // it runs out so admission cost stays amortized constant
+  if (new_num_goal_handles > action_server->impl->capacity_goal_handles) {
+    size_t new_capacity = 2u * action_server->impl->capacity_goal_handles;
+    if (new_capacity < GOAL_HANDLES_MIN_CAPACITY) {
+      new_capacity = GOAL_HANDLES_MIN_CAPACITY;
+    }
+    void * grown_ptr = allocator.reallocate(
+      action_server->impl->goal_handles,
+      new_capacity * sizeof(rcl_action_goal_handle_t *),
+      allocator.state);
+    if (!grown_ptr) {
+      allocator.deallocate(new_goal_handle, allocator.state);
+      RCL_SET_ERROR_MSG("memory allocation failed for goal handle pointer");
+      return NULL;
+    }
+    action_server->impl->goal_handles = (rcl_action_goal_handle_t **)grown_ptr;
+    action_server->impl->capacity_goal_handles = new_capacity;
   }
-  goal_handles[num_goal_handles] = (rcl_action_goal_handle_t *) tmp_ptr;
+  rcl_action_goal_handle_t ** goal_handles = action_server->impl->goal_handles;
 
   // Re-stamp goal info with current time
   rcl_action_goal_info_t goal_info_stamp_now = rcl_action_get_zero_initialized_goal_info();
@@ -384,24 +500,165 @@ rcl_action_accept_new_goal(
   rcl_time_point_value_t now_time_point;
   rcl_ret_t ret = rcl_clock_get_now(action_server->impl->clock, &now_time_point);
   if (RCL_RET_OK != ret) {
+    allocator.deallocate(new_goal_handle, allocator.state);
     return NULL;  // Error already set
   }
   _nanosec_to_goal_info_stamp(&now_time_point, &goal_info_stamp_now);
 
   // Create a new goal handle
-  *goal_handles[num_goal_handles] = rcl_action_get_zero_initialized_goal_handle();
+  *new_goal_handle = rcl_action_get_zero_initialized_goal_handle();
   ret = rcl_action_goal_handle_init(
-    goal_handles[num_goal_handles], &goal_info_stamp_now, allocator);
+    new_goal_handle, &goal_info_stamp_now, allocator);
   if (RCL_RET_OK != ret) {
+    allocator.deallocate(new_goal_handle, allocator.state);
     RCL_SET_ERROR_MSG("failed to initialize goal handle");
     return NULL;
   }
 
-  action_server->impl->goal_handles = goal_handles;
+  goal_handles[num_goal_handles] = new_goal_handle;
   action_server->impl->num_goal_handles = new_num_goal_handles;
+  // Track whether accept stamps remain in order; expiration sweeps rely on it
+  if (now_time_point < action_server->impl->last_goal_stamp) {
+    action_server->impl->goal_stamps_ordered = false;
+  } else {
+    action_server->impl->last_goal_stamp = now_time_point;
+  }
+  if (NULL != action_server->impl->goal_index_slots) {
+    if (2u * new_num_goal_handles >= action_server->impl->goal_index_capacity) {
+      // Keep the table under half full; rebuild at the next size up
+      (void)_goal_index_build(action_server->impl);
+    } else if (!_goal_index_insert(action_server->impl, num_goal_handles)) {
+      _goal_index_free(action_server->impl);
+    }
+  }
   return goal_handles[num_goal_handles];
 }
 
+rcl_ret_t
+rcl_action_accept_new_goals(
+  rcl_action_server_t * action_server,
+  const rcl_action_goal_info_t * goal_infos,
+  size_t num_goals,
+  rcl_action_goal_handle_t ** goal_handles)
+{
+  if (!rcl_action_server_is_valid(action_server)) {
+    return RCL_RET_ACTION_SERVER_INVALID;  // error already set
+  }
+  RCL_CHECK_ARGUMENT_FOR_NULL(goal_infos, RCL_RET_INVALID_ARGUMENT);
+  RCL_CHECK_ARGUMENT_FOR_NULL(goal_handles, RCL_RET_INVALID_ARGUMENT);
+  if (0u == num_goals) {
+    RCL_SET_ERROR_MSG("num_goals must be greater than zero");
+    return RCL_RET_INVALID_ARGUMENT;
+  }
+  rcl_action_server_impl_t * impl = action_server->impl;
+
+  // Reject the whole batch up front if any goal ID is already held or repeated
+  for (size_t i = 0u; i < num_goals; ++i) {
+    if (SIZE_MAX != _find_goal_handle(impl, goal_infos[i].goal_id.uuid)) {
+      RCL_SET_ERROR_MSG("goal ID already exists");
+      return RCL_RET_INVALID_ARGUMENT;
+    }
+    for (size_t j = 0u; j < i; ++j) {
+      if (uuidcmp(goal_infos[i].goal_id.uuid, goal_infos[j].goal_id.uuid)) {
+        RCL_SET_ERROR_MSG("goal ID repeated within the batch");
+        return RCL_RET_INVALID_ARGUMENT;
+      }
+    }
+  }
+
+  rcl_allocator_t allocator = impl->options.allocator;
+  const size_t num_goal_handles = impl->num_goal_handles;
+  const size_t new_num_goal_handles = num_goal_handles + num_goals;
+
+  // Grow the goal handle pointer array once for the whole batch
+  if (new_num_goal_handles > impl->capacity_goal_handles) {
+    size_t new_capacity = impl->capacity_goal_handles;
+    if (new_capacity < GOAL_HANDLES_MIN_CAPACITY) {
+      new_capacity = GOAL_HANDLES_MIN_CAPACITY;
+    }
+    while (new_capacity < new_num_goal_handles) {
+      new_capacity *= 2u;
+    }
+    void * grown_ptr = allocator.reallocate(
+      impl->goal_handles,
+      new_capacity * sizeof(rcl_action_goal_handle_t *),
+      allocator.state);
+    if (!grown_ptr) {
+      RCL_SET_ERROR_MSG("memory allocation failed for goal handle pointers");
+      return RCL_RET_BAD_ALLOC;
+    }
+    impl->goal_handles = (rcl_action_goal_handle_t **)grown_ptr;
+    impl->capacity_goal_handles = new_capacity;
+  }
+
+  // Sample the clock once; every goal in the batch shares the accept stamp
+  rcl_time_point_value_t now_time_point;
+  rcl_ret_t ret = rcl_clock_get_now(impl->clock, &now_time_point);
+  if (RCL_RET_OK != ret) {
+    return RCL_RET_ERROR;  // error already set
+  }
+
+  size_t num_admitted = 0u;
+  ret = RCL_RET_OK;
+  for (size_t i = 0u; i < num_goals; ++i) {
+    void * tmp_ptr = allocator.allocate(sizeof(rcl_action_goal_handle_t), allocator.state);
+    if (!tmp_ptr) {
+      RCL_SET_ERROR_MSG("memory allocation failed for new goal handle");
+      ret = RCL_RET_BAD_ALLOC;
+      break;
+    }
+    rcl_action_goal_handle_t * new_goal_handle = (rcl_action_goal_handle_t *)tmp_ptr;
+    rcl_action_goal_info_t goal_info_stamp_now = goal_infos[i];
+    _nanosec_to_goal_info_stamp(&now_time_point, &goal_info_stamp_now);
+    *new_goal_handle = rcl_action_get_zero_initialized_goal_handle();
+    rcl_ret_t init_ret = rcl_action_goal_handle_init(
+      new_goal_handle, &goal_info_stamp_now, allocator);
+    if (RCL_RET_OK != init_ret) {
+      allocator.deallocate(new_goal_handle, allocator.state);
+      RCL_SET_ERROR_MSG("failed to initialize goal handle");
+      ret = RCL_RET_ERROR;
+      break;
+    }
+    impl->goal_handles[num_goal_handles + i] = new_goal_handle;
+    goal_handles[i] = new_goal_handle;
+    ++num_admitted;
+  }
+  if (RCL_RET_OK != ret) {
+    // All or nothing: unwind the part of the batch admitted so far
+    for (size_t i = 0u; i < num_admitted; ++i) {
+      if (RCL_RET_OK != rcl_action_goal_handle_fini(goal_handles[i])) {
+        RCUTILS_SAFE_FWRITE_TO_STDERR(
+          "Failed to fini goal handle while handling a previous error. Leaking memory!\n");
+      }
+      allocator.deallocate(goal_handles[i], allocator.state);
+      goal_handles[i] = NULL;
+    }
+    return ret;
+  }
+
+  impl->num_goal_handles = new_num_goal_handles;
+  // Track whether accept stamps remain in order; expiration sweeps rely on it
+  if (now_time_point < impl->last_goal_stamp) {
+    impl->goal_stamps_ordered = false;
+  } else {
+    impl->last_goal_stamp = now_time_point;
+  }
+  if (NULL != impl->goal_index_slots) {
+    if (2u * new_num_goal_handles >= impl->goal_index_capacity) {
+      // Keep the table under half full; rebuild at the next size up
+      (void)_goal_index_build(impl);
+    } else {
+      for (size_t i = 0u; i < num_goals; ++i) {
+        if (!_goal_index_insert(impl, num_goal_handles + i)) {
+          _goal_index_free(impl);
+          break;
+        }
+      }
+    }
+  }
+  return RCL_RET_OK;
+}
+
 // Implementation only
 static rcl_ret_t
 _recalculate_expire_timer(
@@ -409,6 +666,7 @@ _recalculate_expire_timer(
   const int64_t timeout,
   rcl_action_goal_handle_t ** goal_handles,
   size_t num_goal_handles,
+  bool goal_stamps_ordered,
   rcl_clock_t * clock)
 {
   size_t num_inactive_goals = 0u;
@@ -436,6 +694,11 @@ _recalculate_expire_timer(
       if (delta < minimum_period) {
         minimum_period = delta;
       }
+      if (goal_stamps_ordered) {
+        // Stamps ascend in accept order, so the first inactive goal owns the
+        // earliest deadline
+        break;
+      }
     }
   }
 
@@ -496,15 +759,32 @@ rcl_action_get_goal_status_array(
     return RCL_RET_OK;
   }
 
-  // Allocate status array
-  rcl_allocator_t allocator = action_server->impl->options.allocator;
-  rcl_ret_t ret = rcl_action_goal_status_array_init(status_message, num_goals, allocator);
-  if (RCL_RET_OK != ret) {
-    if (RCL_RET_BAD_ALLOC == ret) {
-      return RCL_RET_BAD_ALLOC;
+  // A message retained across calls is rewritten in place while its capacity
+  // lasts; it only (re)allocates when the goal count outgrows it
+  rcl_ret_t ret;
+  if (NULL == status_message->msg.status_list.data ||
+    status_message->msg.status_list.capacity < num_goals)
+  {
+    rcl_allocator_t allocator = action_server->impl->options.allocator;
+    // Grow geometrically so a server accepting goals between status ticks
+    // doesn't reallocate on every tick
+    size_t new_capacity = 2u * status_message->msg.status_list.capacity;
+    if (new_capacity < num_goals) {
+      new_capacity = num_goals;
+    }
+    ret = rcl_action_goal_status_array_fini(status_message);
+    if (RCL_RET_OK != ret) {
+      return RCL_RET_ERROR;
+    }
+    ret = rcl_action_goal_status_array_init(status_message, new_capacity, allocator);
+    if (RCL_RET_OK != ret) {
+      if (RCL_RET_BAD_ALLOC == ret) {
+        return RCL_RET_BAD_ALLOC;
+      }
+      return RCL_RET_ERROR;
     }
-    return RCL_RET_ERROR;
   }
+  status_message->msg.status_list.size = num_goals;
 
   // Populate status array
   for (size_t i = 0u; i < num_goals; ++i) {
@@ -609,6 +889,14 @@ rcl_action_expire_goals(
     goal_handle = action_server->impl->goal_handles[i];
     // Expiration only applys to terminated goals
     if (rcl_action_goal_handle_is_active(goal_handle)) {
+      if (action_server->impl->goal_stamps_ordered &&
+        RCL_RET_OK == rcl_action_goal_handle_get_info(goal_handle, &goal_info) &&
+        (current_time - _goal_info_stamp_to_nanosec(&goal_info)) <= timeout)
+      {
+        // Stamps ascend in accept order, so no later goal can be expired;
+        // stop the sweep here instead of touching every held goal
+        break;
+      }
       continue;
     }
     rcl_action_goal_info_t * info_ptr = &goal_info;
@@ -621,6 +909,12 @@ rcl_action_expire_goals(
       continue;
     }
     goal_time = _goal_info_stamp_to_nanosec(info_ptr);
+    if ((current_time - goal_time) <= timeout &&
+      action_server->impl->goal_stamps_ordered)
+    {
+      // Same early exit for an inactive goal whose deadline is still ahead
+      break;
+    }
     if ((current_time - goal_time) > timeout) {
       // Deallocate space used to store pointer to goal handle
       allocator.deallocate(action_server->impl->goal_handles[i], allocator.state);
@@ -637,11 +931,15 @@ rcl_action_expire_goals(
   }
 
   if (num_goals_expired > 0u) {
+    // Compaction shifted the surviving array indices, so the index over them
+    // is stale; it is rebuilt on the next lookup
+    _goal_index_free(action_server->impl);
     // Shrink goal handle array if some goals expired
     if (0u == num_goal_handles) {
       allocator.deallocate(action_server->impl->goal_handles, allocator.state);
       action_server->impl->goal_handles = NULL;
       action_server->impl->num_goal_handles = num_goal_handles;
+      action_server->impl->capacity_goal_handles = 0u;
     } else {
       void * tmp_ptr = allocator.reallocate(
         action_server->impl->goal_handles,
@@ -653,6 +951,7 @@ rcl_action_expire_goals(
       } else {
         action_server->impl->goal_handles = (rcl_action_goal_handle_t **)tmp_ptr;
         action_server->impl->num_goal_handles = num_goal_handles;
+        action_server->impl->capacity_goal_handles = num_goal_handles;
       }
     }
   }
@@ -661,6 +960,7 @@ rcl_action_expire_goals(
     action_server->impl->options.result_timeout.nanoseconds,
     action_server->impl->goal_handles,
     action_server->impl->num_goal_handles,
+    action_server->impl->goal_stamps_ordered,
     action_server->impl->clock);
 
   if (RCL_RET_OK != expire_timer_ret) {
@@ -686,6 +986,7 @@ rcl_action_notify_goal_done(
     action_server->impl->options.result_timeout.nanoseconds,
     action_server->impl->goal_handles,
     action_server->impl->num_goal_handles,
+    action_server->impl->goal_stamps_ordered,
     action_server->impl->clock);
 }
 
@@ -733,28 +1034,18 @@ rcl_action_process_cancel_request(
   // Determine how many goals should transition to canceling
   if (!uuidcmpzero(request_uuid) && (0u == request_nanosec)) {
     // UUID is not zero and timestamp is zero; cancel exactly one goal (if it exists)
-    rcl_action_goal_info_t goal_info = rcl_action_get_zero_initialized_goal_info();
     // Assume the goal ID is invalid until we find it
     cancel_response->msg.return_code = action_msgs__srv__CancelGoal_Response__ERROR_UNKNOWN_GOAL_ID;
-    rcl_action_goal_handle_t * goal_handle;
-    for (size_t i = 0u; i < total_num_goals; ++i) {
-      goal_handle = action_server->impl->goal_handles[i];
-      rcl_ret_t ret = rcl_action_goal_handle_get_info(goal_handle, &goal_info);
-      if (RCL_RET_OK != ret) {
-        ret_final = RCL_RET_ERROR;
-        continue;
-      }
-
-      if (uuidcmp(request_uuid, goal_info.goal_id.uuid)) {
-        if (rcl_action_goal_handle_is_cancelable(goal_handle)) {
-          goal_handles_to_cancel[num_goals_to_cancel++] = goal_handle;
-          cancel_response->msg.return_code = action_msgs__srv__CancelGoal_Response__ERROR_NONE;
-        } else {
-          // If the goal is not cancelable, it must be because it is in a terminal state
-          cancel_response->msg.return_code =
-            action_msgs__srv__CancelGoal_Response__ERROR_GOAL_TERMINATED;
-        }
-        break;
+    const size_t goal_handle_idx = _find_goal_handle(action_server->impl, request_uuid);
+    if (SIZE_MAX != goal_handle_idx) {
+      rcl_action_goal_handle_t * goal_handle = action_server->impl->goal_handles[goal_handle_idx];
+      if (rcl_action_goal_handle_is_cancelable(goal_handle)) {
+        goal_handles_to_cancel[num_goals_to_cancel++] = goal_handle;
+        cancel_response->msg.return_code = action_msgs__srv__CancelGoal_Response__ERROR_NONE;
+      } else {
+        // If the goal is not cancelable, it must be because it is in a terminal state
+        cancel_response->msg.return_code =
+          action_msgs__srv__CancelGoal_Response__ERROR_GOAL_TERMINATED;
       }
     }
   } else {
@@ -847,6 +1138,15 @@ rcl_action_server_get_options(const rcl_action_server_t * action_server)
   return &action_server->impl->options;
 }
 
+const rcl_publisher_t *
+rcl_action_server_get_feedback_publisher(const rcl_action_server_t * action_server)
+{
+  if (!rcl_action_server_is_valid(action_server)) {
+    return NULL;  // error already set
+  }
+  return &action_server->impl->feedback_publisher;
+}
+
 rcl_ret_t
 rcl_action_server_get_goal_handles(
   const rcl_action_server_t * action_server,
@@ -873,20 +1173,7 @@ rcl_action_server_goal_exists(
   }
   RCL_CHECK_ARGUMENT_FOR_NULL(goal_info, false);
 
-  rcl_action_goal_info_t gh_goal_info = rcl_action_get_zero_initialized_goal_info();
-  rcl_ret_t ret;
-  for (size_t i = 0u; i < action_server->impl->num_goal_handles; ++i) {
-    ret = rcl_action_goal_handle_get_info(action_server->impl->goal_handles[i], &gh_goal_info);
-    if (RCL_RET_OK != ret) {
-      RCL_SET_ERROR_MSG("failed to get info for goal handle");
-      return false;
-    }
-    // Compare UUIDs
-    if (uuidcmp(gh_goal_info.goal_id.uuid, goal_info->goal_id.uuid)) {
-      return true;
-    }
-  }
-  return false;
+  return SIZE_MAX != _find_goal_handle(action_server->impl, goal_info->goal_id.uuid);
 }
 
 bool
@@ -952,6 +1239,16 @@ rcl_action_server_is_valid_except_context(const rcl_action_server_t * action_ser
   return true;
 }
 
+// Implementation only
+static bool
+_bitmap_bit_is_set(const uint64_t * bitmap, size_t number_of_words, size_t index)
+{
+  if (NULL == bitmap || (index / 64u) >= number_of_words) {
+    return false;
+  }
+  return 0u != (bitmap[index / 64u] & ((uint64_t)1u << (index % 64u)));
+}
+
 rcl_ret_t
 rcl_action_wait_set_add_action_server(
   rcl_wait_set_t * wait_set,
@@ -1043,14 +1340,38 @@ rcl_action_server_wait_set_get_entities_ready(
   RCL_CHECK_ARGUMENT_FOR_NULL(is_goal_expired, RCL_RET_INVALID_ARGUMENT);
 
   const rcl_action_server_impl_t * impl = action_server->impl;
-  const rcl_service_t * goal_service = wait_set->services[impl->wait_set_goal_service_index];
-  const rcl_service_t * cancel_service = wait_set->services[impl->wait_set_cancel_service_index];
-  const rcl_service_t * result_service = wait_set->services[impl->wait_set_result_service_index];
-  const rcl_timer_t * expire_timer = wait_set->timers[impl->wait_set_expire_timer_index];
-  *is_goal_request_ready = (&impl->goal_service == goal_service);
-  *is_cancel_request_ready = (&impl->cancel_service == cancel_service);
-  *is_result_request_ready = (&impl->result_service == result_service);
-  *is_goal_expired = (&impl->expire_timer == expire_timer);
+
+  // Decode from the wait set's readiness bitmaps: one word covers 64 entity
+  // slots, so a process full of action servers reads a few shared cache lines
+  // instead of four entity array entries per server. The pointer comparison
+  // only happens for bits that are actually set, and still guards against a
+  // stale index pointing at some other entity.
+  const uint64_t * service_bitmap = NULL;
+  size_t service_words = 0u;
+  rcl_ret_t ret = rcl_wait_set_get_ready_bitmap(
+    wait_set, RCL_WAIT_SET_SERVICE, &service_bitmap, &service_words);
+  if (RCL_RET_OK != ret) {
+    return ret;  // error already set
+  }
+  const uint64_t * timer_bitmap = NULL;
+  size_t timer_words = 0u;
+  ret = rcl_wait_set_get_ready_bitmap(
+    wait_set, RCL_WAIT_SET_TIMER, &timer_bitmap, &timer_words);
+  if (RCL_RET_OK != ret) {
+    return ret;  // error already set
+  }
+  *is_goal_request_ready =
+    _bitmap_bit_is_set(service_bitmap, service_words, impl->wait_set_goal_service_index) &&
+    &impl->goal_service == wait_set->services[impl->wait_set_goal_service_index];
+  *is_cancel_request_ready =
+    _bitmap_bit_is_set(service_bitmap, service_words, impl->wait_set_cancel_service_index) &&
+    &impl->cancel_service == wait_set->services[impl->wait_set_cancel_service_index];
+  *is_result_request_ready =
+    _bitmap_bit_is_set(service_bitmap, service_words, impl->wait_set_result_service_index) &&
+    &impl->result_service == wait_set->services[impl->wait_set_result_service_index];
+  *is_goal_expired =
+    _bitmap_bit_is_set(timer_bitmap, timer_words, impl->wait_set_expire_timer_index) &&
+    &impl->expire_timer == wait_set->timers[impl->wait_set_expire_timer_index];
   return RCL_RET_OK;
 }
 
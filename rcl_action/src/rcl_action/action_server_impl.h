@@ -29,9 +29,21 @@ typedef struct rcl_action_server_impl_s
   rcl_timer_t expire_timer;
   char * action_name;
   rcl_action_server_options_t options;
-  // Array of goal handles
+  // Array of goal handles, grown geometrically
   rcl_action_goal_handle_t ** goal_handles;
   size_t num_goal_handles;
+  size_t capacity_goal_handles;
+  // Open addressing hash index over goal_handles, keyed by goal UUID.
+  // Slots hold the goal handle's array index plus one; zero marks an empty
+  // slot. Built lazily once enough goals are held, invalidated when the
+  // array is compacted, NULL when absent (lookups fall back to scanning).
+  size_t * goal_index_slots;
+  size_t goal_index_capacity;
+  // True while goal handles sit in non-decreasing accept-stamp order, which
+  // lets expiration sweeps and timer recalculation stop at the first goal
+  // whose deadline has not passed yet
+  bool goal_stamps_ordered;
+  int64_t last_goal_stamp;
   // Clock
   rcl_clock_t * clock;
   // Wait set records
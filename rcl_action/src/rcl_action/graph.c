@@ -46,12 +46,18 @@ _filter_action_names(
   rcl_ret_t ret;
   const size_t num_names = topic_names_and_types->names.size;
   char ** names = topic_names_and_types->names.data;
+  const size_t suffix_len = strlen(action_name_identifier);
+  const size_t type_suffix_len = strlen(action_type_identifier);
 
-  // Count number of actions to determine how much memory to allocate
+  // Count number of actions to determine how much memory to allocate.
+  // A name classifies as an action when it ends with the suffix, checked by
+  // comparing its tail instead of scanning the whole name.
   size_t num_actions = 0u;
   for (size_t i = 0u; i < num_names; ++i) {
-    const char * identifier_index = strstr(names[i], action_name_identifier);
-    if (identifier_index && strlen(identifier_index) == strlen(action_name_identifier)) {
+    const size_t name_len = strlen(names[i]);
+    if (name_len >= suffix_len &&
+      0 == memcmp(names[i] + (name_len - suffix_len), action_name_identifier, suffix_len))
+    {
       ++num_actions;
     }
   }
@@ -67,13 +73,14 @@ _filter_action_names(
 
   ret = RCL_RET_OK;
 
-  // Prune names/types that are not actions (ie. do not contain the suffix)
-  const size_t suffix_len = strlen(action_name_identifier);
+  // Prune names/types that are not actions (ie. do not end with the suffix)
   size_t j = 0u;
   for (size_t i = 0u; i < num_names; ++i) {
-    const char * identifier_index = strstr(names[i], action_name_identifier);
-    if (identifier_index && strlen(identifier_index) == strlen(action_name_identifier)) {
-      const size_t action_name_len = strlen(names[i]) - suffix_len;
+    const size_t name_len = strlen(names[i]);
+    if (name_len >= suffix_len &&
+      0 == memcmp(names[i] + (name_len - suffix_len), action_name_identifier, suffix_len))
+    {
+      const size_t action_name_len = name_len - suffix_len;
       char * action_name = rcutils_strndup(names[i], action_name_len, *allocator);
       if (!action_name) {
         RCL_SET_ERROR_MSG("Failed to allocate memory for action name");
@@ -99,12 +106,12 @@ _filter_action_names(
         char * type_name = topic_names_and_types->types[i].data[k];
         size_t action_type_len = strlen(type_name);
         // Trim type name suffix
-        const size_t type_suffix_len = strlen(action_type_identifier);
-        const char * type_identifier_index = strstr(type_name, action_type_identifier);
-        if (type_identifier_index &&
-          strlen(type_identifier_index) == strlen(action_type_identifier))
+        if (action_type_len >= type_suffix_len &&
+          0 == memcmp(
+            type_name + (action_type_len - type_suffix_len),
+            action_type_identifier, type_suffix_len))
         {
-          action_type_len = strlen(type_name) - type_suffix_len;
+          action_type_len -= type_suffix_len;
         }
         // Copy name to output struct
         char * action_type_name = rcutils_strndup(type_name, action_type_len, *allocator);
@@ -232,6 +239,139 @@ rcl_action_get_names_and_types(
   return ret;
 }
 
+
+struct rcl_action_names_cache_impl_s
+{
+  rcl_allocator_t allocator;
+  // Refreshes the raw topic snapshot only when the graph guard condition
+  // fired.
+  rcl_graph_cache_t graph_cache;
+  // Version of the raw snapshot the demangled set was built from; 0 means
+  // nothing has been built yet.
+  uint64_t raw_version;
+  // Incremented whenever the demangled set is rebuilt.
+  uint64_t demangled_version;
+  // The demangled action names and types, rebuilt once per raw refresh.
+  rcl_names_and_types_t demangled;
+};
+
+rcl_action_names_cache_t
+rcl_action_get_zero_initialized_names_cache(void)
+{
+  static rcl_action_names_cache_t null_cache = {0};
+  return null_cache;
+}
+
+rcl_ret_t
+rcl_action_names_cache_init(
+  rcl_action_names_cache_t * cache,
+  const rcl_node_t * node,
+  rcl_allocator_t * allocator)
+{
+  RCL_CHECK_ARGUMENT_FOR_NULL(cache, RCL_RET_INVALID_ARGUMENT);
+  RCL_CHECK_ALLOCATOR_WITH_MSG(allocator, "invalid allocator", return RCL_RET_INVALID_ARGUMENT);
+  if (NULL != cache->impl) {
+    RCL_SET_ERROR_MSG("action names cache already initialized, or memory was uninitialized");
+    return RCL_RET_ALREADY_INIT;
+  }
+  rcl_action_names_cache_impl_t * impl =
+    allocator->allocate(sizeof(rcl_action_names_cache_impl_t), allocator->state);
+  if (NULL == impl) {
+    RCL_SET_ERROR_MSG("allocating memory failed");
+    return RCL_RET_BAD_ALLOC;
+  }
+  impl->allocator = *allocator;
+  impl->raw_version = 0;
+  impl->demangled_version = 0;
+  impl->demangled = rcl_get_zero_initialized_names_and_types();
+  impl->graph_cache = rcl_get_zero_initialized_graph_cache();
+  rcl_ret_t ret = rcl_graph_cache_init(&impl->graph_cache, node, false, allocator);
+  if (RCL_RET_OK != ret) {
+    allocator->deallocate(impl, allocator->state);
+    return ret;  // error already set
+  }
+  cache->impl = impl;
+  return RCL_RET_OK;
+}
+
+rcl_ret_t
+rcl_action_names_cache_fini(rcl_action_names_cache_t * cache)
+{
+  RCL_CHECK_ARGUMENT_FOR_NULL(cache, RCL_RET_INVALID_ARGUMENT);
+  RCL_CHECK_FOR_NULL_WITH_MSG(
+    cache->impl, "action names cache is invalid", return RCL_RET_INVALID_ARGUMENT);
+  rcl_action_names_cache_impl_t * impl = cache->impl;
+  rcl_ret_t ret = rcl_graph_cache_fini(&impl->graph_cache);
+  if (0 != impl->raw_version) {
+    rcl_ret_t fini_ret = rcl_names_and_types_fini(&impl->demangled);
+    if (RCL_RET_OK != fini_ret) {
+      RCUTILS_SAFE_FWRITE_TO_STDERR(
+        "Freeing cached action names and types failed. Leaking memory!\n");
+      if (RCL_RET_OK == ret) {
+        ret = fini_ret;
+      }
+    }
+  }
+  rcl_allocator_t allocator = impl->allocator;
+  allocator.deallocate(impl, allocator.state);
+  cache->impl = NULL;
+  return ret;
+}
+
+rcl_ret_t
+rcl_action_names_cache_get_names_and_types(
+  rcl_action_names_cache_t * cache,
+  const rcl_names_and_types_t ** action_names_and_types,
+  uint64_t * version)
+{
+  RCL_CHECK_ARGUMENT_FOR_NULL(cache, RCL_RET_INVALID_ARGUMENT);
+  RCL_CHECK_FOR_NULL_WITH_MSG(
+    cache->impl, "action names cache is invalid", return RCL_RET_INVALID_ARGUMENT);
+  RCL_CHECK_ARGUMENT_FOR_NULL(action_names_and_types, RCL_RET_INVALID_ARGUMENT);
+  rcl_action_names_cache_impl_t * impl = cache->impl;
+  const rcl_names_and_types_t * raw = NULL;
+  uint64_t raw_version = 0;
+  rcl_ret_t ret = rcl_graph_cache_get_topic_names_and_types(
+    &impl->graph_cache, &raw, &raw_version);
+  if (RCL_RET_OK != ret) {
+    return ret;  // error already set
+  }
+  if (raw_version != impl->raw_version) {
+    // The graph changed; demangle the new snapshot once so every query
+    // until the next change is a plain view.
+    rcl_names_and_types_t demangled = rcl_get_zero_initialized_names_and_types();
+    // The filter only reads its input; the cast unconstifies the view.
+    ret = _filter_action_names(
+      (rcl_names_and_types_t *)raw, &impl->allocator, &demangled);
+    if (RCL_RET_OK != ret) {
+      if (RCL_RET_OK != rcl_graph_cache_release(&raw)) {
+        RCUTILS_SAFE_FWRITE_TO_STDERR(
+          "Releasing graph snapshot failed while handling a previous error. Leaking memory!\n");
+      }
+      return ret;  // error already set
+    }
+    if (0 != impl->raw_version) {
+      rcl_ret_t fini_ret = rcl_names_and_types_fini(&impl->demangled);
+      if (RCL_RET_OK != fini_ret) {
+        RCUTILS_SAFE_FWRITE_TO_STDERR(
+          "Freeing outdated action names and types failed. Leaking memory!\n");
+      }
+    }
+    impl->demangled = demangled;
+    impl->raw_version = raw_version;
+    ++impl->demangled_version;
+  }
+  ret = rcl_graph_cache_release(&raw);
+  if (RCL_RET_OK != ret) {
+    return ret;  // error already set
+  }
+  *action_names_and_types = &impl->demangled;
+  if (NULL != version) {
+    *version = impl->demangled_version;
+  }
+  return RCL_RET_OK;
+}
+
 #ifdef __cplusplus
 }
 #endif
@@ -74,6 +74,7 @@ rcl_action_goal_status_array_init(
     return RCL_RET_BAD_ALLOC;
   }
   status_array->msg.status_list.size = num_status;
+  status_array->msg.status_list.capacity = num_status;
   status_array->allocator = allocator;
   return RCL_RET_OK;
 }
@@ -87,6 +88,7 @@ rcl_action_goal_status_array_fini(rcl_action_goal_status_array_t * status_array)
       status_array->msg.status_list.data, status_array->allocator.state);
     status_array->msg.status_list.data = NULL;
     status_array->msg.status_list.size = 0u;
+    status_array->msg.status_list.capacity = 0u;
   }
   return RCL_RET_OK;
 }
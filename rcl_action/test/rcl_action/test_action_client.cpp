@@ -351,6 +351,108 @@ TEST_F(TestActionClientFixture, test_action_client_get_options) {
   ASSERT_NE(options, nullptr) << rcl_get_error_string().str;
 }
 
+TEST_F(TestActionClientFixture, test_action_client_goal_status_tracking) {
+  rcl_ret_t ret = rcl_action_client_enable_goal_status_tracking(nullptr, true);
+  EXPECT_EQ(ret, RCL_RET_ACTION_CLIENT_INVALID);
+  rcl_reset_error();
+
+  ret = rcl_action_client_enable_goal_status_tracking(&this->invalid_action_client, true);
+  EXPECT_EQ(ret, RCL_RET_ACTION_CLIENT_INVALID);
+  rcl_reset_error();
+
+  rcl_action_goal_info_t goal_info = rcl_action_get_zero_initialized_goal_info();
+  rcl_action_goal_state_t status = GOAL_STATE_UNKNOWN;
+  ret = rcl_action_client_get_goal_status(nullptr, &goal_info, &status);
+  EXPECT_EQ(ret, RCL_RET_ACTION_CLIENT_INVALID);
+  rcl_reset_error();
+
+  ret = rcl_action_client_get_goal_status(&this->action_client, nullptr, &status);
+  EXPECT_EQ(ret, RCL_RET_INVALID_ARGUMENT);
+  rcl_reset_error();
+
+  ret = rcl_action_client_get_goal_status(&this->action_client, &goal_info, nullptr);
+  EXPECT_EQ(ret, RCL_RET_INVALID_ARGUMENT);
+  rcl_reset_error();
+
+  ret = rcl_action_client_set_goal_status_tracking_callback(nullptr, nullptr, nullptr);
+  EXPECT_EQ(ret, RCL_RET_ACTION_CLIENT_INVALID);
+  rcl_reset_error();
+
+  // A goal is unknown while tracking is disabled
+  ret = rcl_action_client_get_goal_status(&this->action_client, &goal_info, &status);
+  EXPECT_EQ(ret, RCL_RET_OK) << rcl_get_error_string().str;
+  EXPECT_EQ(status, GOAL_STATE_UNKNOWN);
+
+  // Enabling twice is a no-op, and untracked goals remain unknown
+  ret = rcl_action_client_enable_goal_status_tracking(&this->action_client, true);
+  EXPECT_EQ(ret, RCL_RET_OK) << rcl_get_error_string().str;
+  ret = rcl_action_client_enable_goal_status_tracking(&this->action_client, true);
+  EXPECT_EQ(ret, RCL_RET_OK) << rcl_get_error_string().str;
+  ret = rcl_action_client_get_goal_status(&this->action_client, &goal_info, &status);
+  EXPECT_EQ(ret, RCL_RET_OK) << rcl_get_error_string().str;
+  EXPECT_EQ(status, GOAL_STATE_UNKNOWN);
+
+  ret = rcl_action_client_enable_goal_status_tracking(&this->action_client, false);
+  EXPECT_EQ(ret, RCL_RET_OK) << rcl_get_error_string().str;
+}
+
+TEST_F(TestActionClientFixture, test_action_client_pipeline) {
+  rcl_ret_t ret = rcl_action_client_init_pipeline(nullptr, 4);
+  EXPECT_EQ(ret, RCL_RET_ACTION_CLIENT_INVALID);
+  rcl_reset_error();
+
+  ret = rcl_action_client_init_pipeline(&this->invalid_action_client, 4);
+  EXPECT_EQ(ret, RCL_RET_ACTION_CLIENT_INVALID);
+  rcl_reset_error();
+
+  ret = rcl_action_client_init_pipeline(&this->action_client, 0);
+  EXPECT_EQ(ret, RCL_RET_INVALID_ARGUMENT);
+  rcl_reset_error();
+
+  // async sends and drains require pipelining to be initialized
+  rcl_client_completion_context_t context;
+  context.on_complete = [](rcl_client_completion_context_t *) {};
+  context.user_data = nullptr;
+  test_msgs__action__Fibonacci_SendGoal_Request goal_request;
+  test_msgs__action__Fibonacci_SendGoal_Request__init(&goal_request);
+  test_msgs__action__Fibonacci_SendGoal_Response goal_response;
+  test_msgs__action__Fibonacci_SendGoal_Response__init(&goal_response);
+  OSRF_TESTING_TOOLS_CPP_SCOPE_EXIT(
+  {
+    test_msgs__action__Fibonacci_SendGoal_Request__fini(&goal_request);
+    test_msgs__action__Fibonacci_SendGoal_Response__fini(&goal_response);
+  });
+  ret = rcl_action_async_send_goal_request(&this->action_client, &goal_request, &context);
+  EXPECT_EQ(ret, RCL_RET_INVALID_ARGUMENT);
+  rcl_reset_error();
+  size_t completed = 0u;
+  ret = rcl_action_drain_goal_responses(&this->action_client, &goal_response, &completed);
+  EXPECT_EQ(ret, RCL_RET_INVALID_ARGUMENT);
+  rcl_reset_error();
+
+  ret = rcl_action_client_init_pipeline(&this->action_client, 4);
+  EXPECT_EQ(ret, RCL_RET_OK) << rcl_get_error_string().str;
+  ret = rcl_action_client_init_pipeline(&this->action_client, 4);
+  EXPECT_EQ(ret, RCL_RET_ALREADY_INIT);
+  rcl_reset_error();
+
+  ret = rcl_action_async_send_goal_request(&this->action_client, &goal_request, &context);
+  EXPECT_EQ(ret, RCL_RET_OK) << rcl_get_error_string().str;
+  EXPECT_EQ(1, context.sequence_number);
+
+  // no action server is running, so there is nothing to drain
+  ret = rcl_action_drain_goal_responses(&this->action_client, &goal_response, &completed);
+  EXPECT_EQ(ret, RCL_RET_ACTION_CLIENT_TAKE_FAILED);
+  rcl_reset_error();
+  EXPECT_EQ(0u, completed);
+
+  ret = rcl_action_client_fini_pipeline(&this->action_client);
+  EXPECT_EQ(ret, RCL_RET_OK) << rcl_get_error_string().str;
+  // fini is idempotent
+  ret = rcl_action_client_fini_pipeline(&this->action_client);
+  EXPECT_EQ(ret, RCL_RET_OK) << rcl_get_error_string().str;
+}
+
 TEST_F(TestActionClientBaseFixture, test_action_client_init_fini_maybe_fail)
 {
   rcl_node_t node = rcl_get_zero_initialized_node();
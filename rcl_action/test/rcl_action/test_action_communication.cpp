@@ -582,10 +582,40 @@ TEST_F(CLASSNAME(TestActionCommunication, RMW_IMPLEMENTATION), test_valid_status
   EXPECT_FALSE(this->is_feedback_ready);
   EXPECT_FALSE(this->is_goal_response_ready);
 
+  // Track goal statuses and record state changes as they are ingested
+  ret = rcl_action_client_enable_goal_status_tracking(&this->action_client, true);
+  ASSERT_EQ(ret, RCL_RET_OK) << rcl_get_error_string().str;
+  struct StatusChange
+  {
+    size_t count = 0u;
+    rcl_action_goal_state_t previous_state = GOAL_STATE_UNKNOWN;
+    rcl_action_goal_state_t new_state = GOAL_STATE_UNKNOWN;
+  } status_change;
+  ret = rcl_action_client_set_goal_status_tracking_callback(
+    &this->action_client,
+    [](const uint8_t *, rcl_action_goal_state_t previous_state,
+    rcl_action_goal_state_t new_state, void * user_data) {
+      StatusChange * change = static_cast<StatusChange *>(user_data);
+      ++change->count;
+      change->previous_state = previous_state;
+      change->new_state = new_state;
+    },
+    &status_change);
+  ASSERT_EQ(ret, RCL_RET_OK) << rcl_get_error_string().str;
+
   // Take status with valid arguments (one goal in array)
   ret = rcl_action_take_status(&this->action_client, &incoming_status_array);
   EXPECT_EQ(ret, RCL_RET_OK) << rcl_get_error_string().str;
 
+  // The taken status array was ingested into the goal status table
+  rcl_action_goal_state_t tracked_status = GOAL_STATE_UNKNOWN;
+  ret = rcl_action_client_get_goal_status(&this->action_client, &goal_info, &tracked_status);
+  EXPECT_EQ(ret, RCL_RET_OK) << rcl_get_error_string().str;
+  EXPECT_EQ(tracked_status, GOAL_STATE_ACCEPTED);
+  EXPECT_EQ(status_change.count, 1u);
+  EXPECT_EQ(status_change.previous_state, GOAL_STATE_UNKNOWN);
+  EXPECT_EQ(status_change.new_state, GOAL_STATE_ACCEPTED);
+
   // Check that status was received correctly
   ASSERT_EQ(status_array.msg.status_list.size, incoming_status_array.status_list.size);
   for (size_t i = 0; i < status_array.msg.status_list.size; ++i) {
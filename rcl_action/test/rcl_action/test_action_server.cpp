@@ -501,6 +501,109 @@ TEST_F(TestActionServer, test_action_server_goal_exists) {
   this->action_server.impl->num_goal_handles--;
 }
 
+TEST_F(TestActionServer, test_action_server_goal_exists_many_goals) {
+  // Enough goals that lookups move from scanning onto the UUID hash index
+  const size_t num_goals = 64u;
+  std::vector<rcl_action_goal_handle_t> handles;
+  rcl_action_goal_info_t goal_info_in = rcl_action_get_zero_initialized_goal_info();
+  for (size_t i = 0u; i < num_goals; ++i) {
+    init_test_uuid0(goal_info_in.goal_id.uuid);
+    goal_info_in.goal_id.uuid[0] = static_cast<uint8_t>(i);
+    rcl_action_goal_handle_t * goal_handle =
+      rcl_action_accept_new_goal(&this->action_server, &goal_info_in);
+    ASSERT_NE(goal_handle, nullptr) << rcl_get_error_string().str;
+    handles.push_back(*goal_handle);
+    // Re-accepting the same goal ID must still be rejected
+    EXPECT_EQ(nullptr, rcl_action_accept_new_goal(&this->action_server, &goal_info_in));
+    rcl_reset_error();
+  }
+
+  for (size_t i = 0u; i < num_goals; ++i) {
+    init_test_uuid0(goal_info_in.goal_id.uuid);
+    goal_info_in.goal_id.uuid[0] = static_cast<uint8_t>(i);
+    EXPECT_TRUE(rcl_action_server_goal_exists(&this->action_server, &goal_info_in));
+  }
+
+  rcl_action_goal_info_t different_goal = rcl_action_get_zero_initialized_goal_info();
+  init_test_uuid1(different_goal.goal_id.uuid);
+  EXPECT_FALSE(rcl_action_server_goal_exists(&this->action_server, &different_goal));
+  EXPECT_FALSE(rcl_error_is_set()) << rcl_get_error_string().str;
+
+  for (auto & handle : handles) {
+    EXPECT_EQ(RCL_RET_OK, rcl_action_goal_handle_fini(&handle));
+  }
+}
+
+TEST_F(TestActionServer, test_action_accept_new_goals) {
+  const size_t num_goals = 100u;
+  std::vector<rcl_action_goal_info_t> goal_infos(
+    num_goals, rcl_action_get_zero_initialized_goal_info());
+  for (size_t i = 0u; i < num_goals; ++i) {
+    init_test_uuid0(goal_infos[i].goal_id.uuid);
+    goal_infos[i].goal_id.uuid[0] = static_cast<uint8_t>(i);
+  }
+  std::vector<rcl_action_goal_handle_t *> goal_handles(num_goals, nullptr);
+
+  // Invalid arguments
+  rcl_ret_t ret = rcl_action_accept_new_goals(
+    nullptr, goal_infos.data(), num_goals, goal_handles.data());
+  EXPECT_EQ(ret, RCL_RET_ACTION_SERVER_INVALID);
+  rcl_reset_error();
+
+  ret = rcl_action_accept_new_goals(
+    &this->action_server, nullptr, num_goals, goal_handles.data());
+  EXPECT_EQ(ret, RCL_RET_INVALID_ARGUMENT);
+  rcl_reset_error();
+
+  ret = rcl_action_accept_new_goals(
+    &this->action_server, goal_infos.data(), 0u, goal_handles.data());
+  EXPECT_EQ(ret, RCL_RET_INVALID_ARGUMENT);
+  rcl_reset_error();
+
+  ret = rcl_action_accept_new_goals(
+    &this->action_server, goal_infos.data(), num_goals, nullptr);
+  EXPECT_EQ(ret, RCL_RET_INVALID_ARGUMENT);
+  rcl_reset_error();
+
+  // A goal ID repeated within the batch rejects the whole batch
+  {
+    std::vector<rcl_action_goal_info_t> repeated_infos(
+      2u, rcl_action_get_zero_initialized_goal_info());
+    init_test_uuid1(repeated_infos[0].goal_id.uuid);
+    init_test_uuid1(repeated_infos[1].goal_id.uuid);
+    std::vector<rcl_action_goal_handle_t *> repeated_handles(2u, nullptr);
+    ret = rcl_action_accept_new_goals(
+      &this->action_server, repeated_infos.data(), 2u, repeated_handles.data());
+    EXPECT_EQ(ret, RCL_RET_INVALID_ARGUMENT);
+    rcl_reset_error();
+    init_test_uuid1(repeated_infos[0].goal_id.uuid);
+    EXPECT_FALSE(rcl_action_server_goal_exists(&this->action_server, &repeated_infos[0]));
+  }
+
+  // Accept the whole batch
+  ret = rcl_action_accept_new_goals(
+    &this->action_server, goal_infos.data(), num_goals, goal_handles.data());
+  ASSERT_EQ(ret, RCL_RET_OK) << rcl_get_error_string().str;
+  for (size_t i = 0u; i < num_goals; ++i) {
+    ASSERT_NE(goal_handles[i], nullptr);
+    EXPECT_TRUE(rcl_action_server_goal_exists(&this->action_server, &goal_infos[i]));
+    rcl_action_goal_info_t goal_info_out = rcl_action_get_zero_initialized_goal_info();
+    EXPECT_EQ(RCL_RET_OK, rcl_action_goal_handle_get_info(goal_handles[i], &goal_info_out));
+    EXPECT_TRUE(uuidcmp(goal_info_out.goal_id.uuid, goal_infos[i].goal_id.uuid));
+  }
+
+  // A goal ID already tracked by the server rejects a subsequent batch
+  rcl_action_goal_handle_t * duplicate_handle = nullptr;
+  ret = rcl_action_accept_new_goals(
+    &this->action_server, goal_infos.data(), 1u, &duplicate_handle);
+  EXPECT_EQ(ret, RCL_RET_INVALID_ARGUMENT);
+  rcl_reset_error();
+
+  for (size_t i = 0u; i < num_goals; ++i) {
+    EXPECT_EQ(RCL_RET_OK, rcl_action_goal_handle_fini(goal_handles[i]));
+  }
+}
+
 TEST_F(TestActionServer, test_action_server_notify_goal_done) {
   // Invalid action server
   EXPECT_EQ(RCL_RET_ACTION_SERVER_INVALID, rcl_action_notify_goal_done(nullptr));
@@ -798,6 +901,33 @@ TEST_F(TestActionServer, test_action_server_get_options)
   EXPECT_NE(options, nullptr) << rcl_get_error_string().str;
 }
 
+TEST_F(TestActionServer, test_action_server_get_feedback_publisher)
+{
+  // Get feedback publisher for a null action server
+  const rcl_publisher_t * publisher = rcl_action_server_get_feedback_publisher(nullptr);
+  EXPECT_EQ(publisher, nullptr);
+  rcl_reset_error();
+
+  // Get feedback publisher for an invalid action server
+  rcl_action_server_t invalid_action_server = rcl_action_get_zero_initialized_server();
+  publisher = rcl_action_server_get_feedback_publisher(&invalid_action_server);
+  EXPECT_EQ(publisher, nullptr);
+  rcl_reset_error();
+
+  // Get feedback publisher for a valid action server
+  publisher = rcl_action_server_get_feedback_publisher(&this->action_server);
+  ASSERT_NE(publisher, nullptr) << rcl_get_error_string().str;
+  EXPECT_TRUE(rcl_publisher_is_valid(publisher));
+
+  // Publishing on the borrowed publisher directly must behave like
+  // rcl_action_publish_feedback()
+  test_msgs__action__Fibonacci_FeedbackMessage feedback;
+  test_msgs__action__Fibonacci_FeedbackMessage__init(&feedback);
+  EXPECT_EQ(RCL_RET_OK, rcl_publish(publisher, &feedback, nullptr)) <<
+    rcl_get_error_string().str;
+  test_msgs__action__Fibonacci_FeedbackMessage__fini(&feedback);
+}
+
 class TestActionServerCancelPolicy : public TestActionServer
 {
 protected:
@@ -682,3 +682,80 @@ TEST_F(TestActionGraphMultiNodeFixture, rcl_get_server_names_and_types_by_node_m
     }
   });
 }
+
+TEST_F(TestActionGraphMultiNodeFixture, test_action_names_cache) {
+  rcl_ret_t ret;
+
+  rcl_action_names_cache_t cache = rcl_action_get_zero_initialized_names_cache();
+  ret = rcl_action_names_cache_init(nullptr, &this->node, &this->allocator);
+  EXPECT_EQ(RCL_RET_INVALID_ARGUMENT, ret);
+  rcl_reset_error();
+  ret = rcl_action_names_cache_init(&cache, &this->node, &this->allocator);
+  ASSERT_EQ(RCL_RET_OK, ret) << rcl_get_error_string().str;
+  ret = rcl_action_names_cache_init(&cache, &this->node, &this->allocator);
+  EXPECT_EQ(RCL_RET_ALREADY_INIT, ret);
+  rcl_reset_error();
+
+  // Create an action client on the remote node.
+  rcl_action_client_t action_client = rcl_action_get_zero_initialized_client();
+  const rosidl_action_type_support_t * action_typesupport =
+    ROSIDL_GET_ACTION_TYPE_SUPPORT(test_msgs, Fibonacci);
+  const char * cached_action_name = "/test_action_names_cache_action_name";
+  rcl_action_client_options_t action_client_options = rcl_action_client_get_default_options();
+  ret = rcl_action_client_init(
+    &action_client,
+    &this->remote_node,
+    action_typesupport,
+    cached_action_name,
+    &action_client_options);
+  ASSERT_EQ(ret, RCL_RET_OK) << rcl_get_error_string().str;
+  OSRF_TESTING_TOOLS_CPP_SCOPE_EXIT(
+  {
+    EXPECT_EQ(RCL_RET_OK, rcl_action_client_fini(&action_client, &this->remote_node)) <<
+      rcl_get_error_string().str;
+  });
+
+  // Poll the cache until the demangled action shows up.
+  const rcl_names_and_types_t * view = nullptr;
+  uint64_t version = 0;
+  bool found_action = false;
+  auto start_time = std::chrono::system_clock::now();
+  while (std::chrono::system_clock::now() - start_time < std::chrono::seconds(1) &&
+    !found_action)
+  {
+    ret = rcl_action_names_cache_get_names_and_types(&cache, &view, &version);
+    ASSERT_EQ(RCL_RET_OK, ret) << rcl_get_error_string().str;
+    for (size_t i = 0; i < view->names.size; ++i) {
+      if (0 == strcmp(view->names.data[i], cached_action_name)) {
+        found_action = true;
+        ASSERT_EQ(1u, view->types[i].size);
+        EXPECT_STREQ("test_msgs/action/Fibonacci", view->types[i].data[0]);
+        break;
+      }
+    }
+    if (!found_action) {
+      std::this_thread::sleep_for(std::chrono::milliseconds(10));
+    }
+  }
+  EXPECT_TRUE(found_action);
+
+  // With a quiescent graph, repeated queries hand back the same demangled
+  // storage and version.
+  const rcl_names_and_types_t * second_view = nullptr;
+  uint64_t second_version = 0;
+  ret = rcl_action_names_cache_get_names_and_types(&cache, &second_view, &second_version);
+  ASSERT_EQ(RCL_RET_OK, ret) << rcl_get_error_string().str;
+  EXPECT_EQ(view, second_view);
+  EXPECT_EQ(version, second_version);
+
+  ret = rcl_action_names_cache_get_names_and_types(&cache, nullptr, &version);
+  EXPECT_EQ(RCL_RET_INVALID_ARGUMENT, ret);
+  rcl_reset_error();
+
+  ret = rcl_action_names_cache_fini(&cache);
+  EXPECT_EQ(RCL_RET_OK, ret) << rcl_get_error_string().str;
+  EXPECT_EQ(nullptr, cache.impl);
+  ret = rcl_action_names_cache_fini(&cache);
+  EXPECT_EQ(RCL_RET_INVALID_ARGUMENT, ret);
+  rcl_reset_error();
+}
@@ -797,14 +797,33 @@ TEST_F(TestActionServerWait, test_server_wait_set_get_entities_ready) {
 
   ret = rcl_wait_set_init(&wait_set, 0, 0, 1, 0, 3, 0, &this->context, rcl_get_default_allocator());
   ASSERT_EQ(ret, RCL_RET_OK) << rcl_get_error_string().str;
-  wait_set.services[0] = &this->action_server.impl->goal_service;
-  this->action_server.impl->wait_set_goal_service_index = 0;
-  wait_set.services[1] = &this->action_server.impl->cancel_service;
-  this->action_server.impl->wait_set_cancel_service_index = 1;
-  wait_set.services[2] = &this->action_server.impl->result_service;
-  this->action_server.impl->wait_set_result_service_index = 2;
-  wait_set.timers[0] = &this->action_server.impl->expire_timer;
-  this->action_server.impl->wait_set_expire_timer_index = 0;
+  ret = rcl_action_wait_set_add_action_server(&wait_set, &this->action_server, nullptr);
+  ASSERT_EQ(ret, RCL_RET_OK) << rcl_get_error_string().str;
+
+  // Nothing has been waited on yet, so the readiness bitmaps report no entity
+  // as ready even though the wait set holds the server's entities
+  ret = rcl_action_server_wait_set_get_entities_ready(
+    &wait_set,
+    &this->action_server,
+    &is_goal_request_ready,
+    &is_cancel_request_ready,
+    &is_result_request_ready,
+    &is_goal_expired);
+  EXPECT_EQ(ret, RCL_RET_OK) << rcl_get_error_string().str;
+  EXPECT_FALSE(is_goal_request_ready);
+  EXPECT_FALSE(is_cancel_request_ready);
+  EXPECT_FALSE(is_result_request_ready);
+  EXPECT_FALSE(is_goal_expired);
+
+  // Make the goal expiration timer due so that rcl_wait() marks it ready
+  int64_t old_period;
+  ret = rcl_timer_exchange_period(&this->action_server.impl->expire_timer, 0, &old_period);
+  ASSERT_EQ(ret, RCL_RET_OK) << rcl_get_error_string().str;
+  ret = rcl_timer_reset(&this->action_server.impl->expire_timer);
+  ASSERT_EQ(ret, RCL_RET_OK) << rcl_get_error_string().str;
+  ret = rcl_wait(&wait_set, RCL_S_TO_NS(1));
+  ASSERT_EQ(ret, RCL_RET_OK) << rcl_get_error_string().str;
+
   ret = rcl_action_server_wait_set_get_entities_ready(
     &wait_set,
     &this->action_server,
@@ -813,8 +832,8 @@ TEST_F(TestActionServerWait, test_server_wait_set_get_entities_ready) {
     &is_result_request_ready,
     &is_goal_expired);
   EXPECT_EQ(ret, RCL_RET_OK) << rcl_get_error_string().str;
-  EXPECT_TRUE(is_goal_request_ready);
-  EXPECT_TRUE(is_cancel_request_ready);
-  EXPECT_TRUE(is_result_request_ready);
+  EXPECT_FALSE(is_goal_request_ready);
+  EXPECT_FALSE(is_cancel_request_ready);
+  EXPECT_FALSE(is_result_request_ready);
   EXPECT_TRUE(is_goal_expired);
 }
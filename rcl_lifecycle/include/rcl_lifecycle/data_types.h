@@ -20,6 +20,8 @@
 #include "rcl_lifecycle/visibility_control.h"
 
 #include "lifecycle_msgs/msg/transition_event.h"
+#include "lifecycle_msgs/srv/get_available_states.h"
+#include "lifecycle_msgs/srv/get_available_transitions.h"
 
 #ifdef __cplusplus
 extern "C"
@@ -28,6 +30,9 @@ extern "C"
 
 typedef struct rcl_lifecycle_transition_s rcl_lifecycle_transition_t;
 
+/// Number of distinct transition key ids a state can look up directly
+#define RCL_LIFECYCLE_MAX_TRANSITION_KEYS 256u
+
 /// It contains the state of the lifecycle state machine
 typedef struct rcl_lifecycle_state_s
 {
@@ -40,6 +45,17 @@ typedef struct rcl_lifecycle_state_s
   rcl_lifecycle_transition_t * valid_transitions;
   /// Number of valid transitions
   unsigned int valid_transition_size;
+  /// Number of valid transitions the allocated storage can hold
+  unsigned int valid_transition_capacity;
+  /// Bitmask over transition key ids; bit `id` is set when a transition with
+  /// that id is valid from this state
+  uint64_t valid_transition_mask[RCL_LIFECYCLE_MAX_TRANSITION_KEYS / 64u];
+  /// Direct map from transition key id to its position in valid_transitions
+  /// plus one, with zero meaning the id is not valid from this state
+  uint8_t valid_transition_position[RCL_LIFECYCLE_MAX_TRANSITION_KEYS];
+  /// True while the mask and position arrays cover every valid transition;
+  /// when false, id lookups fall back to scanning valid_transitions
+  bool valid_transition_direct;
 } rcl_lifecycle_state_t;
 
 /// It contains the transitions of the lifecycle state machine
@@ -67,6 +83,30 @@ typedef struct rcl_lifecycle_transition_map_s
   rcl_lifecycle_transition_t * transitions;
   /// Number of transitions
   unsigned int transitions_size;
+  /// Direct index from state id to its position in states plus one, with zero
+  /// meaning unregistered. When NULL, id lookups fall back to scanning states.
+  size_t * state_index;
+  /// Number of entries in state_index
+  unsigned int state_index_size;
+  /// Direct index from transition id to its position in transitions plus one,
+  /// with zero meaning unregistered. When NULL, id lookups fall back to
+  /// scanning transitions.
+  size_t * transition_index;
+  /// Number of entries in transition_index
+  unsigned int transition_index_size;
+  /// Number of states the allocated storage can hold
+  unsigned int states_capacity;
+  /// Number of transitions the allocated storage can hold
+  unsigned int transitions_capacity;
+  /// True when the arrays are borrowed from the process-wide shared default
+  /// state machine. Shared storage is copied before the first mutation and is
+  /// not freed by rcl_lifecycle_transition_map_fini().
+  bool shared;
+  /// True when this map has been detached from the shared default state
+  /// machine into a private copy. The enclosing state machine may still point
+  /// into the shared storage, so the reference to it is only released when
+  /// this map is finalized.
+  bool detached_from_shared;
 } rcl_lifecycle_transition_map_t;
 
 /// It contains the communication interfac with the ROS world
@@ -86,10 +126,56 @@ typedef struct rcl_lifecycle_com_interface_s
   rcl_service_t srv_get_available_transitions;
   /// Service that allows to get transitions from the graph
   rcl_service_t srv_get_transition_graph;
-  /// Cached transition event message.
+  /// Cached transition event message. The state labels borrow the state
+  /// machine's interned labels, so publishing a notification does not
+  /// allocate.
   lifecycle_msgs__msg__TransitionEvent msg;
+  /// Wait set index of the change_state service, recorded by
+  /// rcl_lifecycle_wait_set_add_state_machine()
+  size_t wait_set_change_state_service_index;
+  /// Wait set index of the get_state service
+  size_t wait_set_get_state_service_index;
+  /// Wait set index of the get_available_states service
+  size_t wait_set_get_available_states_service_index;
+  /// Wait set index of the get_available_transitions service
+  size_t wait_set_get_available_transitions_service_index;
+  /// Wait set index of the get_transition_graph service
+  size_t wait_set_get_transition_graph_service_index;
+  /// Cached get_available_states response, built from the transition map on
+  /// the first request and reused until the map changes
+  lifecycle_msgs__srv__GetAvailableStates_Response available_states_response;
+  /// True while available_states_response is populated
+  bool available_states_response_valid;
+  /// Number of states available_states_response was built from
+  unsigned int available_states_response_size;
+  /// Cached response holding the full transition graph, built from the
+  /// transition map on the first request and reused until the map changes
+  lifecycle_msgs__srv__GetAvailableTransitions_Response available_transitions_response;
+  /// True while available_transitions_response is populated
+  bool available_transitions_response_valid;
+  /// Number of transitions available_transitions_response was built from
+  unsigned int available_transitions_response_size;
 } rcl_lifecycle_com_interface_t;
 
+/// Number of transition ids a state machine keeps latency statistics for
+#define RCL_LIFECYCLE_MAX_TRANSITION_STATS 32u
+
+/// Latency statistics for one transition id
+typedef struct rcl_lifecycle_transition_stats_s
+{
+  /// Identifier of the transition the samples belong to
+  unsigned int transition_id;
+  /// Number of recorded triggers; zero marks an unused slot
+  uint64_t count;
+  /// Duration of the most recent trigger in nanoseconds
+  uint64_t last_duration_ns;
+  /// Longest recorded trigger duration in nanoseconds
+  uint64_t max_duration_ns;
+  /// Exponentially weighted moving average of the trigger duration in
+  /// nanoseconds, weighting new samples with 1/8
+  uint64_t avg_duration_ns;
+} rcl_lifecycle_transition_stats_t;
+
 /// It contains various options to configure the rcl_lifecycle_state_machine_t instance
 typedef struct rcl_lifecycle_state_machine_options_s
 {
@@ -97,6 +183,8 @@ typedef struct rcl_lifecycle_state_machine_options_s
   bool initialize_default_states;
   /// Flag indicating whether the com interface shall be used or not
   bool enable_com_interface;
+  /// Flag indicating whether trigger latency statistics shall be recorded
+  bool enable_transition_stats;
   /// Allocator used for allocating states and transitions
   rcl_allocator_t allocator;
 } rcl_lifecycle_state_machine_options_t;
@@ -104,7 +192,9 @@ typedef struct rcl_lifecycle_state_machine_options_s
 /// It contains the state machine data
 typedef struct rcl_lifecycle_state_machine_s
 {
-  /// Current state of the state machine
+  /// Current state of the state machine. Transitions publish it with atomic
+  /// stores; use rcl_lifecycle_state_machine_get_current_state() to read it
+  /// from another thread without locking.
   const rcl_lifecycle_state_t * current_state;
   /// Map/Associated array of registered states and transitions
   rcl_lifecycle_transition_map_t transition_map;
@@ -112,8 +202,27 @@ typedef struct rcl_lifecycle_state_machine_s
   rcl_lifecycle_com_interface_t com_interface;
   /// Options struct with which the state machine was initialized
   rcl_lifecycle_state_machine_options_t options;
+  /// Latency statistics per transition id, recorded while the options enable
+  /// them and queryable with rcl_lifecycle_state_machine_get_transition_stats()
+  rcl_lifecycle_transition_stats_t transition_stats[RCL_LIFECYCLE_MAX_TRANSITION_STATS];
 } rcl_lifecycle_state_machine_t;
 
+/// A group of state machines that are transitioned together
+typedef struct rcl_lifecycle_group_s
+{
+  /// Registered state machines; the group borrows them, it does not own them
+  rcl_lifecycle_state_machine_t ** state_machines;
+  /// Number of registered state machines
+  size_t size;
+  /// Number of state machines the allocated storage can hold
+  size_t capacity;
+  /// Scratch array holding the resolved transition per state machine while a
+  /// group transition is triggered; sized to capacity
+  const rcl_lifecycle_transition_t ** pending_transitions;
+  /// Allocator used for the group storage
+  rcl_allocator_t allocator;
+} rcl_lifecycle_group_t;
+
 #ifdef __cplusplus
 }
 #endif
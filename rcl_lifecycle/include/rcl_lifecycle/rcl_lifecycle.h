@@ -327,6 +327,34 @@ rcl_lifecycle_get_transition_by_id(
   const rcl_lifecycle_state_t * state,
   uint8_t id);
 
+/// Check whether a transition id is valid from a state.
+/**
+ * For states built through rcl_lifecycle_register_transition() this is a
+ * single bit test against the precomputed transition mask; otherwise the
+ * valid transitions are scanned. Unlike rcl_lifecycle_get_transition_by_id()
+ * no warning is logged for an invalid id, so supervisors can poll
+ * can-transition queries cheaply.
+ *
+ * <hr>
+ * Attribute          | Adherence
+ * ------------------ | -------------
+ * Allocates Memory   | No
+ * Thread-Safe        | No
+ * Uses Atomics       | No
+ * Lock-Free          | Yes
+ *
+ * \param[in] state pointer to the state struct
+ * \param[in] id identifier of the transition to check
+ * \return `true` if the transition is valid from the given state, or
+ * \return `false` otherwise.
+ */
+RCL_LIFECYCLE_PUBLIC
+RCL_WARN_UNUSED
+bool
+rcl_lifecycle_state_transition_is_valid(
+  const rcl_lifecycle_state_t * state,
+  uint8_t id);
+
 /// Get a state by id.
 /**
  * A pointer to the internally transition struct is returned
@@ -411,6 +439,376 @@ rcl_lifecycle_trigger_transition_by_label(
   const char * label,
   bool publish_notification);
 
+/// Return the current state of the state machine.
+/**
+ * The current state pointer is published with an atomic store whenever a
+ * transition is triggered, so this function can be called from another thread
+ * without locking while transitions remain serialized by the caller. The
+ * returned state is valid as long as the state machine is.
+ *
+ * <hr>
+ * Attribute          | Adherence
+ * ------------------ | -------------
+ * Allocates Memory   | No
+ * Thread-Safe        | Yes
+ * Uses Atomics       | Yes
+ * Lock-Free          | Yes
+ *
+ * \param[in] state_machine pointer to the state machine struct
+ * \return pointer to the current state, or `NULL` if the state machine
+ *    pointer is null.
+ */
+RCL_LIFECYCLE_PUBLIC
+RCL_WARN_UNUSED
+const rcl_lifecycle_state_t *
+rcl_lifecycle_state_machine_get_current_state(
+  const rcl_lifecycle_state_machine_t * state_machine);
+
+/// Get the recorded latency statistics for a transition id.
+/**
+ * Statistics are recorded when the state machine was initialized with the
+ * enable_transition_stats option and cover the duration of each trigger,
+ * including the notification publish. The struct is copied out, so the
+ * returned numbers stay consistent while triggers continue.
+ *
+ * <hr>
+ * Attribute          | Adherence
+ * ------------------ | -------------
+ * Allocates Memory   | No
+ * Thread-Safe        | No
+ * Uses Atomics       | No
+ * Lock-Free          | Yes
+ *
+ * \param[in] state_machine pointer to the state machine struct
+ * \param[in] transition_id identifier of the transition to query
+ * \param[out] stats set to a copy of the recorded statistics
+ * \return `RCL_RET_OK` if statistics were copied, or
+ * \return `RCL_RET_INVALID_ARGUMENT` if any arguments are invalid, or
+ * \return `RCL_RET_ERROR` if no trigger was recorded for the transition id.
+ */
+RCL_LIFECYCLE_PUBLIC
+RCL_WARN_UNUSED
+rcl_ret_t
+rcl_lifecycle_state_machine_get_transition_stats(
+  const rcl_lifecycle_state_machine_t * state_machine,
+  unsigned int transition_id,
+  rcl_lifecycle_transition_stats_t * stats);
+
+/// Return a rcl_lifecycle_group_t struct with members set to `NULL` or 0.
+/**
+ * Should be called to get a null rcl_lifecycle_group_t before passing to
+ * rcl_lifecycle_group_init().
+ *
+ * \return rcl_lifecycle_group_t a zero initialized group struct
+ */
+RCL_LIFECYCLE_PUBLIC
+RCL_WARN_UNUSED
+rcl_lifecycle_group_t
+rcl_lifecycle_get_zero_initialized_group();
+
+/// Initialize a group of state machines.
+/**
+ * Storage for `capacity` state machines is preallocated so that registering
+ * up to that many machines and triggering group transitions does not
+ * allocate. The group grows on demand if more machines are added.
+ *
+ * <hr>
+ * Attribute          | Adherence
+ * ------------------ | -------------
+ * Allocates Memory   | Yes
+ * Thread-Safe        | No
+ * Uses Atomics       | No
+ * Lock-Free          | Yes
+ *
+ * \param[inout] group pointer to the group struct to be initialized
+ * \param[in] capacity number of state machines to preallocate storage for
+ * \param[in] allocator a valid allocator used to initialize the group
+ * \return `RCL_RET_OK` if the group was initialized successfully, or
+ * \return `RCL_RET_INVALID_ARGUMENT` if any arguments are invalid, or
+ * \return `RCL_RET_BAD_ALLOC` if allocating memory failed.
+ */
+RCL_LIFECYCLE_PUBLIC
+RCL_WARN_UNUSED
+rcl_ret_t
+rcl_lifecycle_group_init(
+  rcl_lifecycle_group_t * group,
+  size_t capacity,
+  const rcl_allocator_t * allocator);
+
+/// Finalize a rcl_lifecycle_group_t.
+/**
+ * The registered state machines are only borrowed by the group and are left
+ * untouched; only the group's own storage is freed.
+ *
+ * <hr>
+ * Attribute          | Adherence
+ * ------------------ | -------------
+ * Allocates Memory   | No
+ * Thread-Safe        | No
+ * Uses Atomics       | No
+ * Lock-Free          | Yes
+ *
+ * \param[inout] group pointer to the group struct to be finalized
+ * \return `RCL_RET_OK` if the group was finalized successfully, or
+ * \return `RCL_RET_INVALID_ARGUMENT` if any arguments are invalid.
+ */
+RCL_LIFECYCLE_PUBLIC
+RCL_WARN_UNUSED
+rcl_ret_t
+rcl_lifecycle_group_fini(
+  rcl_lifecycle_group_t * group);
+
+/// Add a state machine to a group.
+/**
+ * The state machine has to be initialized before it is added and must outlive
+ * the group. A state machine can only be registered once per group.
+ *
+ * <hr>
+ * Attribute          | Adherence
+ * ------------------ | -------------
+ * Allocates Memory   | Yes
+ * Thread-Safe        | No
+ * Uses Atomics       | No
+ * Lock-Free          | Yes
+ *
+ * \param[inout] group pointer to the group struct
+ * \param[in] state_machine pointer to the state machine to register
+ * \return `RCL_RET_OK` if the state machine was added successfully, or
+ * \return `RCL_RET_INVALID_ARGUMENT` if any arguments are invalid, or
+ * \return `RCL_RET_BAD_ALLOC` if growing the group storage failed.
+ */
+RCL_LIFECYCLE_PUBLIC
+RCL_WARN_UNUSED
+rcl_ret_t
+rcl_lifecycle_group_add(
+  rcl_lifecycle_group_t * group,
+  rcl_lifecycle_state_machine_t * state_machine);
+
+/// Trigger a transition by id on every state machine in a group.
+/**
+ * The transition is first resolved for every registered state machine; if any
+ * machine cannot take it from its current state, no machine is transitioned.
+ * Once resolved, all state changes are applied and the notifications are
+ * published in one batch afterwards.
+ *
+ * <hr>
+ * Attribute          | Adherence
+ * ------------------ | -------------
+ * Allocates Memory   | No
+ * Thread-Safe        | No
+ * Uses Atomics       | No
+ * Lock-Free          | Yes
+ *
+ * \param[in] group pointer to the group struct
+ * \param[in] id identifier of the transition to be triggered
+ * \param[in] publish_notification if the value is `true` a message will be published
+ *    notifying the transition, otherwise no message will be published
+ * \return `RCL_RET_OK` if the transition was triggered on every machine, or
+ * \return `RCL_RET_INVALID_ARGUMENT` if any arguments are invalid, or
+ * \return `RCL_RET_ERROR` if a machine cannot take the transition or
+ *    publishing a notification fails.
+ */
+RCL_LIFECYCLE_PUBLIC
+RCL_WARN_UNUSED
+rcl_ret_t
+rcl_lifecycle_trigger_group_transition_by_id(
+  rcl_lifecycle_group_t * group,
+  uint8_t id,
+  bool publish_notification);
+
+/// Trigger a transition by label on every state machine in a group.
+/**
+ * The transition is first resolved for every registered state machine; if any
+ * machine cannot take it from its current state, no machine is transitioned.
+ * Once resolved, all state changes are applied and the notifications are
+ * published in one batch afterwards.
+ *
+ * <hr>
+ * Attribute          | Adherence
+ * ------------------ | -------------
+ * Allocates Memory   | No
+ * Thread-Safe        | No
+ * Uses Atomics       | No
+ * Lock-Free          | Yes
+ *
+ * \param[in] group pointer to the group struct
+ * \param[in] label of the transition to be triggered
+ * \param[in] publish_notification if the value is `true` a message will be published
+ *    notifying the transition, otherwise no message will be published
+ * \return `RCL_RET_OK` if the transition was triggered on every machine, or
+ * \return `RCL_RET_INVALID_ARGUMENT` if any arguments are invalid, or
+ * \return `RCL_RET_ERROR` if a machine cannot take the transition or
+ *    publishing a notification fails.
+ */
+RCL_LIFECYCLE_PUBLIC
+RCL_WARN_UNUSED
+rcl_ret_t
+rcl_lifecycle_trigger_group_transition_by_label(
+  rcl_lifecycle_group_t * group,
+  const char * label,
+  bool publish_notification);
+
+/// Get the cached response for the get_available_states service.
+/**
+ * The response is fully determined by the transition map, so it is built once
+ * on the first call and reused afterwards; serving the service is then just a
+ * call to rcl_send_response() with the returned message. The cache is rebuilt
+ * if states were registered since it was built and is owned by the state
+ * machine; callers must not modify or finalize it and the pointer is only
+ * valid until the state machine is finalized.
+ *
+ * <hr>
+ * Attribute          | Adherence
+ * ------------------ | -------------
+ * Allocates Memory   | Yes (first call only)
+ * Thread-Safe        | No
+ * Uses Atomics       | No
+ * Lock-Free          | Yes
+ *
+ * \param[in] state_machine pointer to the state machine struct
+ * \param[out] response set to the cached response message
+ * \return `RCL_RET_OK` if the call was successful, or
+ * \return `RCL_RET_INVALID_ARGUMENT` if any arguments are invalid or the
+ *    state machine was initialized without a com interface, or
+ * \return `RCL_RET_BAD_ALLOC` if building the cached response failed.
+ */
+RCL_LIFECYCLE_PUBLIC
+RCL_WARN_UNUSED
+rcl_ret_t
+rcl_lifecycle_state_machine_get_available_states_response(
+  rcl_lifecycle_state_machine_t * state_machine,
+  const lifecycle_msgs__srv__GetAvailableStates_Response ** response);
+
+/// Get the cached response holding the full transition graph.
+/**
+ * The response lists every registered transition and is suitable for serving
+ * the get_transition_graph service, or get_available_transitions when the
+ * caller filters by the current state. It is built once on the first call
+ * and reused afterwards, rebuilt if transitions were registered since it was
+ * built, and owned by the state machine; callers must not modify or finalize
+ * it and the pointer is only valid until the state machine is finalized.
+ *
+ * <hr>
+ * Attribute          | Adherence
+ * ------------------ | -------------
+ * Allocates Memory   | Yes (first call only)
+ * Thread-Safe        | No
+ * Uses Atomics       | No
+ * Lock-Free          | Yes
+ *
+ * \param[in] state_machine pointer to the state machine struct
+ * \param[out] response set to the cached response message
+ * \return `RCL_RET_OK` if the call was successful, or
+ * \return `RCL_RET_INVALID_ARGUMENT` if any arguments are invalid or the
+ *    state machine was initialized without a com interface, or
+ * \return `RCL_RET_BAD_ALLOC` if building the cached response failed.
+ */
+RCL_LIFECYCLE_PUBLIC
+RCL_WARN_UNUSED
+rcl_ret_t
+rcl_lifecycle_state_machine_get_available_transitions_response(
+  rcl_lifecycle_state_machine_t * state_machine,
+  const lifecycle_msgs__srv__GetAvailableTransitions_Response ** response);
+
+/// Get the number of wait set entities used by a state machine.
+/**
+ * The com interface exposes its lifecycle servers as plain services; this
+ * function returns how many service slots
+ * rcl_lifecycle_wait_set_add_state_machine() will occupy so the wait set can
+ * be sized in one place.
+ *
+ * <hr>
+ * Attribute          | Adherence
+ * ------------------ | -------------
+ * Allocates Memory   | No
+ * Thread-Safe        | No
+ * Uses Atomics       | No
+ * Lock-Free          | Yes
+ *
+ * \param[in] state_machine pointer to the state machine struct
+ * \param[out] num_services number of services the state machine registers
+ * \return `RCL_RET_OK` if the call was successful, or
+ * \return `RCL_RET_INVALID_ARGUMENT` if any arguments are invalid or the
+ *    state machine was initialized without a com interface.
+ */
+RCL_LIFECYCLE_PUBLIC
+RCL_WARN_UNUSED
+rcl_ret_t
+rcl_lifecycle_state_machine_wait_set_get_num_entities(
+  const rcl_lifecycle_state_machine_t * state_machine,
+  size_t * num_services);
+
+/// Add all services of a state machine's com interface to a wait set.
+/**
+ * This registers the change_state, get_state, get_available_states,
+ * get_available_transitions and get_transition_graph services in one call and
+ * records their wait set indices in the com interface, so callers do not need
+ * to track the five services individually.
+ *
+ * <hr>
+ * Attribute          | Adherence
+ * ------------------ | -------------
+ * Allocates Memory   | No
+ * Thread-Safe        | No
+ * Uses Atomics       | No
+ * Lock-Free          | Yes
+ *
+ * \param[in] state_machine pointer to the state machine struct
+ * \param[in, out] wait_set pointer to the wait set to add the services to
+ * \return `RCL_RET_OK` if all services were added successfully, or
+ * \return `RCL_RET_INVALID_ARGUMENT` if any arguments are invalid or the
+ *    state machine was initialized without a com interface, or
+ * \return `RCL_RET_WAIT_SET_FULL` if the wait set has no room left, or
+ * \return `RCL_RET_ERROR` if an unspecified error occurs.
+ */
+RCL_LIFECYCLE_PUBLIC
+RCL_WARN_UNUSED
+rcl_ret_t
+rcl_lifecycle_wait_set_add_state_machine(
+  rcl_wait_set_t * wait_set,
+  rcl_lifecycle_state_machine_t * state_machine);
+
+/// Check which of a state machine's services are ready in a wait set.
+/**
+ * This must be called on a wait set that the state machine was added to with
+ * rcl_lifecycle_wait_set_add_state_machine() and on which rcl_wait() has
+ * completed, and demultiplexes the readiness of the five lifecycle services
+ * in one call.
+ *
+ * <hr>
+ * Attribute          | Adherence
+ * ------------------ | -------------
+ * Allocates Memory   | No
+ * Thread-Safe        | No
+ * Uses Atomics       | No
+ * Lock-Free          | Yes
+ *
+ * \param[in] wait_set pointer to the wait set rcl_wait() was called on
+ * \param[in] state_machine pointer to the state machine struct
+ * \param[out] change_state_ready `true` if the change_state service has a request
+ * \param[out] get_state_ready `true` if the get_state service has a request
+ * \param[out] get_available_states_ready `true` if the get_available_states
+ *    service has a request
+ * \param[out] get_available_transitions_ready `true` if the
+ *    get_available_transitions service has a request
+ * \param[out] get_transition_graph_ready `true` if the get_transition_graph
+ *    service has a request
+ * \return `RCL_RET_OK` if the call was successful, or
+ * \return `RCL_RET_INVALID_ARGUMENT` if any arguments are invalid or the
+ *    state machine was initialized without a com interface.
+ */
+RCL_LIFECYCLE_PUBLIC
+RCL_WARN_UNUSED
+rcl_ret_t
+rcl_lifecycle_state_machine_wait_set_get_entities_ready(
+  const rcl_wait_set_t * wait_set,
+  const rcl_lifecycle_state_machine_t * state_machine,
+  bool * change_state_ready,
+  bool * get_state_ready,
+  bool * get_available_states_ready,
+  bool * get_available_transitions_ready,
+  bool * get_transition_graph_ready);
+
 /// Print the state machine data
 /**
  * This function will print in the standard output the data in the
@@ -37,6 +37,39 @@ RCL_WARN_UNUSED
 rcl_lifecycle_transition_map_t
 rcl_lifecycle_get_zero_initialized_transition_map();
 
+/// Reserve storage for states and transitions in a transition map.
+/*
+ * This function grows the state and transition arrays of the transition map
+ * to the given capacities in a single allocation each, so that subsequent
+ * calls to rcl_lifecycle_register_state() or rcl_lifecycle_register_transition()
+ * up to those capacities do not reallocate. Capacities smaller than the
+ * current ones are ignored; registered entries are never discarded.
+ *
+ * <hr>
+ * Attribute          | Adherence
+ * ------------------ | -------------
+ * Allocates Memory   | Yes
+ * Thread-Safe        | No
+ * Uses Atomics       | No
+ * Lock-Free          | Yes
+ *
+ * \param[in] transition_map to be modified
+ * \param[in] states_capacity number of states to reserve storage for
+ * \param[in] transitions_capacity number of transitions to reserve storage for
+ * \param[in] allocator a valid allocator used to grow the transition map
+ * \return `RCL_RET_OK` if the storage was reserved successfully, or
+ * \return `RCL_RET_BAD_ALLOC` if allocating memory failed, or
+ * \return `RCL_RET_INVALID_ARGUMENT` if any arguments are invalid.
+ */
+RCL_LIFECYCLE_PUBLIC
+RCL_WARN_UNUSED
+rcl_ret_t
+rcl_lifecycle_transition_map_reserve(
+  rcl_lifecycle_transition_map_t * transition_map,
+  unsigned int states_capacity,
+  unsigned int transitions_capacity,
+  const rcl_allocator_t * allocator);
+
 /// Check if a transition map is active using a rcl_lifecycle_state_machine_t.
 /*
  * The function checks if the transition map is initialized. It returns `RCL_RET_OK`
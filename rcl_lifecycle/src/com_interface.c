@@ -23,6 +23,9 @@ extern "C"
 #include <string.h>
 #include <stddef.h>
 
+#include "lifecycle_msgs/msg/state.h"
+#include "lifecycle_msgs/msg/transition.h"
+#include "lifecycle_msgs/msg/transition_description.h"
 #include "lifecycle_msgs/msg/transition_event.h"
 
 #include "rcl/error_handling.h"
@@ -44,6 +47,26 @@ static const char * srv_get_available_states_service = "~/get_available_states";
 static const char * srv_get_available_transitions_service = "~/get_available_transitions";
 static const char * srv_get_transition_graph = "~/get_transition_graph";
 
+// Points a message string at an interned state machine label without copying.
+// The borrowed label must outlive the message and has to be detached with
+// _detach_label_string() before the message is finalized.
+static void
+_borrow_label_string(rosidl_runtime_c__String * str, const char * label)
+{
+  str->data = (char *)label;
+  str->size = strlen(label);
+  str->capacity = str->size + 1;
+}
+
+// Detaches a borrowed label so message finalization does not free it
+static void
+_detach_label_string(rosidl_runtime_c__String * str)
+{
+  str->data = NULL;
+  str->size = 0;
+  str->capacity = 0;
+}
+
 rcl_lifecycle_com_interface_t
 rcl_lifecycle_get_zero_initialized_com_interface()
 {
@@ -57,6 +80,19 @@ rcl_lifecycle_get_zero_initialized_com_interface()
   com_interface.srv_get_transition_graph = rcl_get_zero_initialized_service();
   lifecycle_msgs__msg__TransitionEvent msg = {0};
   com_interface.msg = msg;
+  com_interface.wait_set_change_state_service_index = 0;
+  com_interface.wait_set_get_state_service_index = 0;
+  com_interface.wait_set_get_available_states_service_index = 0;
+  com_interface.wait_set_get_available_transitions_service_index = 0;
+  com_interface.wait_set_get_transition_graph_service_index = 0;
+  lifecycle_msgs__srv__GetAvailableStates_Response available_states_response = {0};
+  com_interface.available_states_response = available_states_response;
+  com_interface.available_states_response_valid = false;
+  com_interface.available_states_response_size = 0;
+  lifecycle_msgs__srv__GetAvailableTransitions_Response available_transitions_response = {0};
+  com_interface.available_transitions_response = available_transitions_response;
+  com_interface.available_transitions_response_valid = false;
+  com_interface.available_transitions_response_size = 0;
   return com_interface;
 }
 
@@ -116,8 +152,12 @@ rcl_lifecycle_com_interface_publisher_init(
     goto fail;
   }
 
-  // initialize static message for notification
+  // initialize static message for notification; the state labels borrow the
+  // state machine's interned labels at publish time, so the empty strings
+  // allocated by init are released right away
   lifecycle_msgs__msg__TransitionEvent__init(&com_interface->msg);
+  rosidl_runtime_c__String__fini(&com_interface->msg.start_state.label);
+  rosidl_runtime_c__String__fini(&com_interface->msg.goal_state.label);
 
   return RCL_RET_OK;
 
@@ -133,6 +173,10 @@ rcl_lifecycle_com_interface_publisher_fini(
   rcl_lifecycle_com_interface_t * com_interface,
   rcl_node_t * node_handle)
 {
+  // the state labels borrow the state machine's interned labels; detach them
+  // so finalizing the message does not free them
+  _detach_label_string(&com_interface->msg.start_state.label);
+  _detach_label_string(&com_interface->msg.goal_state.label);
   lifecycle_msgs__msg__TransitionEvent__fini(&com_interface->msg);
 
   rcl_ret_t ret = rcl_publisher_fini(
@@ -301,6 +345,18 @@ rcl_lifecycle_com_interface_fini(
 {
   rcl_ret_t fcn_ret = RCL_RET_OK;
 
+  // release the cached introspection responses
+  if (com_interface->available_states_response_valid) {
+    lifecycle_msgs__srv__GetAvailableStates_Response__fini(
+      &com_interface->available_states_response);
+    com_interface->available_states_response_valid = false;
+  }
+  if (com_interface->available_transitions_response_valid) {
+    lifecycle_msgs__srv__GetAvailableTransitions_Response__fini(
+      &com_interface->available_transitions_response);
+    com_interface->available_transitions_response_valid = false;
+  }
+
   // destroy the services
   {
     rcl_ret_t ret = rcl_lifecycle_com_interface_services_fini(
@@ -327,14 +383,155 @@ rcl_lifecycle_com_interface_publish_notification(
   rcl_lifecycle_com_interface_t * com_interface,
   const rcl_lifecycle_state_t * start, const rcl_lifecycle_state_t * goal)
 {
+  // publishing is just field stores: the preallocated message borrows the
+  // interned state labels instead of copying them, so transition storms do
+  // not allocate per event
   com_interface->msg.start_state.id = start->id;
-  rosidl_runtime_c__String__assign(&com_interface->msg.start_state.label, start->label);
+  _borrow_label_string(&com_interface->msg.start_state.label, start->label);
   com_interface->msg.goal_state.id = goal->id;
-  rosidl_runtime_c__String__assign(&com_interface->msg.goal_state.label, goal->label);
+  _borrow_label_string(&com_interface->msg.goal_state.label, goal->label);
 
   return rcl_publish(&com_interface->pub_transition_event, &com_interface->msg, NULL);
 }
 
+// Rebuilds the cached get_available_states response from the transition map
+static rcl_ret_t
+_rebuild_available_states_response(
+  rcl_lifecycle_com_interface_t * com_interface,
+  const rcl_lifecycle_transition_map_t * transition_map)
+{
+  if (com_interface->available_states_response_valid) {
+    lifecycle_msgs__srv__GetAvailableStates_Response__fini(
+      &com_interface->available_states_response);
+    com_interface->available_states_response_valid = false;
+  }
+
+  lifecycle_msgs__srv__GetAvailableStates_Response * response =
+    &com_interface->available_states_response;
+  if (!lifecycle_msgs__srv__GetAvailableStates_Response__init(response)) {
+    RCL_SET_ERROR_MSG("failed to initialize cached get_available_states response");
+    return RCL_RET_BAD_ALLOC;
+  }
+  lifecycle_msgs__msg__State__Sequence__fini(&response->available_states);
+  if (!lifecycle_msgs__msg__State__Sequence__init(
+      &response->available_states, transition_map->states_size))
+  {
+    lifecycle_msgs__srv__GetAvailableStates_Response__fini(response);
+    RCL_SET_ERROR_MSG("failed to allocate cached get_available_states response");
+    return RCL_RET_BAD_ALLOC;
+  }
+
+  for (unsigned int i = 0; i < transition_map->states_size; ++i) {
+    lifecycle_msgs__msg__State * state = &response->available_states.data[i];
+    state->id = transition_map->states[i].id;
+    if (!rosidl_runtime_c__String__assign(&state->label, transition_map->states[i].label)) {
+      lifecycle_msgs__srv__GetAvailableStates_Response__fini(response);
+      RCL_SET_ERROR_MSG("failed to copy state label into cached response");
+      return RCL_RET_BAD_ALLOC;
+    }
+  }
+
+  com_interface->available_states_response_size = transition_map->states_size;
+  com_interface->available_states_response_valid = true;
+  return RCL_RET_OK;
+}
+
+// Rebuilds the cached transition graph response from the transition map
+static rcl_ret_t
+_rebuild_available_transitions_response(
+  rcl_lifecycle_com_interface_t * com_interface,
+  const rcl_lifecycle_transition_map_t * transition_map)
+{
+  if (com_interface->available_transitions_response_valid) {
+    lifecycle_msgs__srv__GetAvailableTransitions_Response__fini(
+      &com_interface->available_transitions_response);
+    com_interface->available_transitions_response_valid = false;
+  }
+
+  lifecycle_msgs__srv__GetAvailableTransitions_Response * response =
+    &com_interface->available_transitions_response;
+  if (!lifecycle_msgs__srv__GetAvailableTransitions_Response__init(response)) {
+    RCL_SET_ERROR_MSG("failed to initialize cached transition graph response");
+    return RCL_RET_BAD_ALLOC;
+  }
+  lifecycle_msgs__msg__TransitionDescription__Sequence__fini(&response->available_transitions);
+  if (!lifecycle_msgs__msg__TransitionDescription__Sequence__init(
+      &response->available_transitions, transition_map->transitions_size))
+  {
+    lifecycle_msgs__srv__GetAvailableTransitions_Response__fini(response);
+    RCL_SET_ERROR_MSG("failed to allocate cached transition graph response");
+    return RCL_RET_BAD_ALLOC;
+  }
+
+  for (unsigned int i = 0; i < transition_map->transitions_size; ++i) {
+    const rcl_lifecycle_transition_t * transition = &transition_map->transitions[i];
+    lifecycle_msgs__msg__TransitionDescription * description =
+      &response->available_transitions.data[i];
+    description->transition.id = (uint8_t)transition->id;
+    description->start_state.id = transition->start->id;
+    description->goal_state.id = transition->goal->id;
+    bool assigned =
+      rosidl_runtime_c__String__assign(&description->transition.label, transition->label) &&
+      rosidl_runtime_c__String__assign(&description->start_state.label, transition->start->label) &&
+      rosidl_runtime_c__String__assign(&description->goal_state.label, transition->goal->label);
+    if (!assigned) {
+      lifecycle_msgs__srv__GetAvailableTransitions_Response__fini(response);
+      RCL_SET_ERROR_MSG("failed to copy transition labels into cached response");
+      return RCL_RET_BAD_ALLOC;
+    }
+  }
+
+  com_interface->available_transitions_response_size = transition_map->transitions_size;
+  com_interface->available_transitions_response_valid = true;
+  return RCL_RET_OK;
+}
+
+rcl_ret_t
+rcl_lifecycle_com_interface_get_available_states_response(
+  rcl_lifecycle_com_interface_t * com_interface,
+  const rcl_lifecycle_transition_map_t * transition_map,
+  const lifecycle_msgs__srv__GetAvailableStates_Response ** response)
+{
+  RCL_CHECK_ARGUMENT_FOR_NULL(com_interface, RCL_RET_INVALID_ARGUMENT);
+  RCL_CHECK_ARGUMENT_FOR_NULL(transition_map, RCL_RET_INVALID_ARGUMENT);
+  RCL_CHECK_ARGUMENT_FOR_NULL(response, RCL_RET_INVALID_ARGUMENT);
+
+  if (!com_interface->available_states_response_valid ||
+    com_interface->available_states_response_size != transition_map->states_size)
+  {
+    rcl_ret_t ret = _rebuild_available_states_response(com_interface, transition_map);
+    if (ret != RCL_RET_OK) {
+      return ret;
+    }
+  }
+
+  *response = &com_interface->available_states_response;
+  return RCL_RET_OK;
+}
+
+rcl_ret_t
+rcl_lifecycle_com_interface_get_available_transitions_response(
+  rcl_lifecycle_com_interface_t * com_interface,
+  const rcl_lifecycle_transition_map_t * transition_map,
+  const lifecycle_msgs__srv__GetAvailableTransitions_Response ** response)
+{
+  RCL_CHECK_ARGUMENT_FOR_NULL(com_interface, RCL_RET_INVALID_ARGUMENT);
+  RCL_CHECK_ARGUMENT_FOR_NULL(transition_map, RCL_RET_INVALID_ARGUMENT);
+  RCL_CHECK_ARGUMENT_FOR_NULL(response, RCL_RET_INVALID_ARGUMENT);
+
+  if (!com_interface->available_transitions_response_valid ||
+    com_interface->available_transitions_response_size != transition_map->transitions_size)
+  {
+    rcl_ret_t ret = _rebuild_available_transitions_response(com_interface, transition_map);
+    if (ret != RCL_RET_OK) {
+      return ret;
+    }
+  }
+
+  *response = &com_interface->available_transitions_response;
+  return RCL_RET_OK;
+}
+
 #ifdef __cplusplus
 }
 #endif
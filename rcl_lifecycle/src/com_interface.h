@@ -81,6 +81,20 @@ rcl_lifecycle_com_interface_publish_notification(
   rcl_lifecycle_com_interface_t * com_interface,
   const rcl_lifecycle_state_t * start, const rcl_lifecycle_state_t * goal);
 
+rcl_ret_t
+RCL_WARN_UNUSED
+rcl_lifecycle_com_interface_get_available_states_response(
+  rcl_lifecycle_com_interface_t * com_interface,
+  const rcl_lifecycle_transition_map_t * transition_map,
+  const lifecycle_msgs__srv__GetAvailableStates_Response ** response);
+
+rcl_ret_t
+RCL_WARN_UNUSED
+rcl_lifecycle_com_interface_get_available_transitions_response(
+  rcl_lifecycle_com_interface_t * com_interface,
+  const rcl_lifecycle_transition_map_t * transition_map,
+  const lifecycle_msgs__srv__GetAvailableTransitions_Response ** response);
+
 #ifdef __cplusplus
 }
 #endif
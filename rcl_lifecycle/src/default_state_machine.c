@@ -23,10 +23,13 @@
 
 #include "rcl/error_handling.h"
 #include "rcl/rcl.h"
+#include "rcutils/stdatomic_helper.h"
 #include "rcutils/strdup.h"
 
 #include "rcl_lifecycle/transition_map.h"
 
+#include "./default_state_machine_internal.h"
+
 #ifdef __cplusplus
 extern "C"
 {
@@ -42,6 +45,45 @@ const char * rcl_lifecycle_transition_success_label = "transition_success";
 const char * rcl_lifecycle_transition_failure_label = "transition_failure";
 const char * rcl_lifecycle_transition_error_label = "transition_error";
 
+// Process-wide copy of the default machine, shared by every state machine
+// initialized with the default allocator. The reference count is atomic to
+// match the usual refcount handling in rcl, but first construction and final
+// teardown are not thread-safe, like the rest of this library.
+static rcl_lifecycle_transition_map_t g_shared_default_map;
+static atomic_uint_least64_t g_shared_default_map_refs;
+static bool g_shared_default_map_valid = false;
+
+static bool
+_is_default_allocator(const rcutils_allocator_t * allocator)
+{
+  rcutils_allocator_t default_allocator = rcutils_get_default_allocator();
+  return allocator->allocate == default_allocator.allocate &&
+         allocator->deallocate == default_allocator.deallocate &&
+         allocator->reallocate == default_allocator.reallocate &&
+         allocator->state == default_allocator.state;
+}
+
+void
+rcl_lifecycle_shared_default_map_release(void)
+{
+  if (!g_shared_default_map_valid) {
+    return;
+  }
+  uint64_t previous_count = rcutils_atomic_fetch_add_uint64_t(
+    &g_shared_default_map_refs, (uint64_t)-1);
+  if (1u != previous_count) {
+    return;
+  }
+  g_shared_default_map_valid = false;
+  rcutils_allocator_t default_allocator = rcl_get_default_allocator();
+  if (rcl_lifecycle_transition_map_fini(&g_shared_default_map, &default_allocator) != RCL_RET_OK) {
+    RCUTILS_SAFE_FWRITE_TO_STDERR(
+      "Failed to free the shared default state machine. Leaking memory!\n");
+    rcl_reset_error();
+    g_shared_default_map = rcl_lifecycle_get_zero_initialized_transition_map();
+  }
+}
+
 rcl_ret_t
 _register_primary_states(
   rcl_lifecycle_transition_map_t * transition_map, const rcutils_allocator_t * allocator)
@@ -651,6 +693,47 @@ _register_transitions(
   return ret;
 }
 
+// Hands out a reference to the process-wide default machine, building it on
+// first use. The caller's map borrows the shared storage; it is copied on the
+// first mutation and released again by rcl_lifecycle_transition_map_fini().
+static rcl_ret_t
+_shared_default_map_acquire(rcl_lifecycle_transition_map_t * transition_map)
+{
+  rcutils_allocator_t default_allocator = rcl_get_default_allocator();
+
+  if (!g_shared_default_map_valid) {
+    rcl_ret_t ret = rcl_lifecycle_transition_map_reserve(
+      &g_shared_default_map, 11u, 25u, &default_allocator);
+    if (ret == RCL_RET_OK) {
+      ret = _register_primary_states(&g_shared_default_map, &default_allocator);
+    }
+    if (ret == RCL_RET_OK) {
+      ret = _register_transition_states(&g_shared_default_map, &default_allocator);
+    }
+    if (ret == RCL_RET_OK) {
+      ret = _register_transitions(&g_shared_default_map, &default_allocator);
+    }
+    if (ret != RCL_RET_OK) {
+      // leave a clean slate for the next attempt
+      rcl_ret_t fini_ret = rcl_lifecycle_transition_map_fini(
+        &g_shared_default_map, &default_allocator);
+      if (fini_ret != RCL_RET_OK) {
+        RCUTILS_SAFE_FWRITE_TO_STDERR(
+          "Failed to free the shared default state machine. Leaking memory!\n");
+        g_shared_default_map = rcl_lifecycle_get_zero_initialized_transition_map();
+      }
+      return ret;
+    }
+    g_shared_default_map_valid = true;
+    atomic_init(&g_shared_default_map_refs, 0);
+  }
+
+  rcutils_atomic_fetch_add_uint64_t(&g_shared_default_map_refs, 1);
+  *transition_map = g_shared_default_map;
+  transition_map->shared = true;
+  return RCL_RET_OK;
+}
+
 // default implementation as depicted on
 // design.ros2.org
 rcl_ret_t
@@ -665,6 +748,35 @@ rcl_lifecycle_init_default_state_machine(
   char * fini_error_message = NULL;
   rcl_allocator_t default_allocator;
 
+  // ******************************************************
+  // share the process-wide machine for default allocations
+  // ******************************************************
+  // state machines built with the default allocator share one immutable copy
+  // of the default machine; a private copy is only made if custom states or
+  // transitions are registered on it later (copy-on-write)
+  if (NULL != allocator && rcutils_allocator_is_valid(allocator) &&
+    _is_default_allocator(allocator))
+  {
+    fcn_ret = _shared_default_map_acquire(&state_machine->transition_map);
+    if (fcn_ret != RCL_RET_OK) {
+      goto fail;
+    }
+    state_machine->current_state = rcl_lifecycle_get_state(
+      &state_machine->transition_map, lifecycle_msgs__msg__State__PRIMARY_STATE_UNCONFIGURED);
+    return fcn_ret;
+  }
+
+  // **********************************************
+  // reserve storage for the whole machine up front
+  // **********************************************
+  // the default machine registers 11 states and 25 transitions; reserving
+  // once avoids growing the arrays one element per registration
+  fcn_ret = rcl_lifecycle_transition_map_reserve(
+    &state_machine->transition_map, 11u, 25u, allocator);
+  if (fcn_ret != RCL_RET_OK) {
+    goto fail;
+  }
+
   // ***************************
   // register all primary states
   // ***************************
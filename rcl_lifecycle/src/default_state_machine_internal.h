@@ -0,0 +1,37 @@
+// Copyright 2026 Open Source Robotics Foundation, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef DEFAULT_STATE_MACHINE_INTERNAL_H_
+#define DEFAULT_STATE_MACHINE_INTERNAL_H_
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+/// Release one reference to the process-wide shared default transition map.
+/**
+ * Called for every transition map whose storage is borrowed from the shared
+ * default state machine, either when the map is finalized or when it is
+ * detached into a private copy. When the last reference is released the
+ * shared storage is freed.
+ */
+void
+rcl_lifecycle_shared_default_map_release(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif  // DEFAULT_STATE_MACHINE_INTERNAL_H_
@@ -28,7 +28,9 @@ extern "C"
 
 #include "rcutils/logging_macros.h"
 #include "rcutils/macros.h"
+#include "rcutils/stdatomic_helper.h"
 #include "rcutils/strdup.h"
+#include "rcutils/time.h"
 #include "tracetools/tracetools.h"
 
 #include "rcl_lifecycle/default_state_machine.h"
@@ -44,6 +46,10 @@ rcl_lifecycle_get_zero_initialized_state()
   state.label = NULL;
   state.valid_transitions = NULL;
   state.valid_transition_size = 0;
+  state.valid_transition_capacity = 0;
+  memset(state.valid_transition_mask, 0, sizeof(state.valid_transition_mask));
+  memset(state.valid_transition_position, 0, sizeof(state.valid_transition_position));
+  state.valid_transition_direct = false;
   return state;
 }
 
@@ -173,6 +179,7 @@ rcl_lifecycle_get_default_state_machine_options()
   rcl_lifecycle_state_machine_options_t options;
   options.enable_com_interface = true;
   options.initialize_default_states = true;
+  options.enable_transition_stats = false;
   options.allocator = rcl_get_default_allocator();
 
   return options;
@@ -187,6 +194,7 @@ rcl_lifecycle_get_zero_initialized_state_machine()
   state_machine.transition_map = rcl_lifecycle_get_zero_initialized_transition_map();
   state_machine.com_interface = rcl_lifecycle_get_zero_initialized_com_interface();
   state_machine.options = rcl_lifecycle_get_default_state_machine_options();
+  memset(state_machine.transition_stats, 0, sizeof(state_machine.transition_stats));
   return state_machine;
 }
 
@@ -310,9 +318,17 @@ rcl_lifecycle_get_transition_by_id(
 {
   RCL_CHECK_FOR_NULL_WITH_MSG(state, "state pointer is null", return NULL);
 
-  for (unsigned int i = 0; i < state->valid_transition_size; ++i) {
-    if (state->valid_transitions[i].id == id) {
-      return &state->valid_transitions[i];
+  // the direct lookup covers every valid transition while it is in effect
+  if (state->valid_transition_direct) {
+    const uint8_t position = state->valid_transition_position[id];
+    if (0 != position) {
+      return &state->valid_transitions[position - 1u];
+    }
+  } else {
+    for (unsigned int i = 0; i < state->valid_transition_size; ++i) {
+      if (state->valid_transitions[i].id == id) {
+        return &state->valid_transitions[i];
+      }
     }
   }
 
@@ -324,6 +340,24 @@ rcl_lifecycle_get_transition_by_id(
   return NULL;
 }
 
+bool
+rcl_lifecycle_state_transition_is_valid(
+  const rcl_lifecycle_state_t * state,
+  uint8_t id)
+{
+  RCL_CHECK_FOR_NULL_WITH_MSG(state, "state pointer is null", return false);
+
+  if (state->valid_transition_direct) {
+    return 0u != (state->valid_transition_mask[id / 64u] & (1ull << (id % 64u)));
+  }
+  for (unsigned int i = 0; i < state->valid_transition_size; ++i) {
+    if (state->valid_transitions[i].id == id) {
+      return true;
+    }
+  }
+  return false;
+}
+
 const rcl_lifecycle_transition_t *
 rcl_lifecycle_get_transition_by_label(
   const rcl_lifecycle_state_t * state,
@@ -345,6 +379,101 @@ rcl_lifecycle_get_transition_by_label(
   return NULL;
 }
 
+// Publishes the new current state with an atomic store, so observers using
+// rcl_lifecycle_state_machine_get_current_state() can read it without locking
+// while transitions stay serialized by the caller
+static void
+_set_current_state(
+  rcl_lifecycle_state_machine_t * state_machine,
+  const rcl_lifecycle_state_t * state)
+{
+  rcutils_atomic_store(
+    (atomic_uintptr_t *)(&state_machine->current_state), (uintptr_t)state);
+}
+
+const rcl_lifecycle_state_t *
+rcl_lifecycle_state_machine_get_current_state(
+  const rcl_lifecycle_state_machine_t * state_machine)
+{
+  RCL_CHECK_FOR_NULL_WITH_MSG(
+    state_machine, "state machine pointer is null.", return NULL);
+
+  uintptr_t current_state;
+  rcutils_atomic_load(
+    (atomic_uintptr_t *)(&state_machine->current_state), current_state);
+  return (const rcl_lifecycle_state_t *)current_state;
+}
+
+rcl_ret_t
+rcl_lifecycle_state_machine_get_transition_stats(
+  const rcl_lifecycle_state_machine_t * state_machine,
+  unsigned int transition_id,
+  rcl_lifecycle_transition_stats_t * stats)
+{
+  RCL_CHECK_FOR_NULL_WITH_MSG(
+    state_machine, "state machine pointer is null.", return RCL_RET_INVALID_ARGUMENT);
+  RCL_CHECK_ARGUMENT_FOR_NULL(stats, RCL_RET_INVALID_ARGUMENT);
+
+  for (size_t i = 0; i < RCL_LIFECYCLE_MAX_TRANSITION_STATS; ++i) {
+    const rcl_lifecycle_transition_stats_t * slot = &state_machine->transition_stats[i];
+    if (0 == slot->count) {
+      break;
+    }
+    if (slot->transition_id == transition_id) {
+      *stats = *slot;
+      return RCL_RET_OK;
+    }
+  }
+
+  RCL_SET_ERROR_MSG_WITH_FORMAT_STRING(
+    "no statistics recorded for transition id %u", transition_id);
+  return RCL_RET_ERROR;
+}
+
+// Records a trigger duration sample for the transition id. Statistics are
+// best effort: a failed clock read or a full table just drops the sample.
+static void
+_record_transition_stats(
+  rcl_lifecycle_state_machine_t * state_machine,
+  unsigned int transition_id,
+  rcutils_time_point_value_t start_time)
+{
+  rcutils_time_point_value_t end_time;
+  if (RCUTILS_RET_OK != rcutils_steady_time_now(&end_time)) {
+    rcutils_reset_error();
+    return;
+  }
+  uint64_t duration_ns = (uint64_t)(end_time - start_time);
+
+  // slots are filled front to back, so a matching slot always comes before
+  // the first unused one
+  rcl_lifecycle_transition_stats_t * stats = NULL;
+  for (size_t i = 0; i < RCL_LIFECYCLE_MAX_TRANSITION_STATS; ++i) {
+    rcl_lifecycle_transition_stats_t * slot = &state_machine->transition_stats[i];
+    if (0 == slot->count || slot->transition_id == transition_id) {
+      stats = slot;
+      break;
+    }
+  }
+  if (NULL == stats) {
+    return;
+  }
+
+  stats->transition_id = transition_id;
+  ++stats->count;
+  stats->last_duration_ns = duration_ns;
+  if (duration_ns > stats->max_duration_ns) {
+    stats->max_duration_ns = duration_ns;
+  }
+  // exponentially weighted moving average seeded with the first sample
+  if (1u == stats->count) {
+    stats->avg_duration_ns = duration_ns;
+  } else {
+    stats->avg_duration_ns =
+      stats->avg_duration_ns - stats->avg_duration_ns / 8u + duration_ns / 8u;
+  }
+}
+
 rcl_ret_t
 _trigger_transition(
   rcl_lifecycle_state_machine_t * state_machine,
@@ -357,7 +486,16 @@ _trigger_transition(
 
   RCL_CHECK_FOR_NULL_WITH_MSG(
     transition->goal, "No valid goal is set.", return RCL_RET_INVALID_ARGUMENT);
-  state_machine->current_state = transition->goal;
+
+  // one clock read at entry, one when the sample is recorded
+  rcutils_time_point_value_t start_time = 0;
+  bool record_stats = state_machine->options.enable_transition_stats;
+  if (record_stats && RCUTILS_RET_OK != rcutils_steady_time_now(&start_time)) {
+    rcutils_reset_error();
+    record_stats = false;
+  }
+
+  _set_current_state(state_machine, transition->goal);
 
   if (publish_notification) {
     rcl_ret_t fcn_ret = rcl_lifecycle_com_interface_publish_notification(
@@ -375,6 +513,10 @@ _trigger_transition(
     (const void *)state_machine,
     transition->start->label,
     state_machine->current_state->label);
+
+  if (record_stats) {
+    _record_transition_stats(state_machine, transition->id, start_time);
+  }
   return RCL_RET_OK;
 }
 
@@ -408,6 +550,362 @@ rcl_lifecycle_trigger_transition_by_label(
   return _trigger_transition(state_machine, transition, publish_notification);
 }
 
+rcl_lifecycle_group_t
+rcl_lifecycle_get_zero_initialized_group()
+{
+  rcl_lifecycle_group_t group;
+  group.state_machines = NULL;
+  group.size = 0;
+  group.capacity = 0;
+  group.pending_transitions = NULL;
+  group.allocator = rcl_get_default_allocator();
+  return group;
+}
+
+rcl_ret_t
+rcl_lifecycle_group_init(
+  rcl_lifecycle_group_t * group,
+  size_t capacity,
+  const rcl_allocator_t * allocator)
+{
+  RCL_CHECK_FOR_NULL_WITH_MSG(
+    group, "group pointer is null\n", return RCL_RET_INVALID_ARGUMENT);
+  RCL_CHECK_ALLOCATOR_WITH_MSG(
+    allocator, "can't initialize group, no allocator given\n", return RCL_RET_INVALID_ARGUMENT);
+
+  group->allocator = *allocator;
+  group->size = 0;
+  group->capacity = 0;
+  group->state_machines = NULL;
+  group->pending_transitions = NULL;
+
+  if (capacity > 0) {
+    group->state_machines = allocator->allocate(
+      capacity * sizeof(rcl_lifecycle_state_machine_t *), allocator->state);
+    RCL_CHECK_FOR_NULL_WITH_MSG(
+      group->state_machines, "failed to allocate memory for group state machines\n",
+      return RCL_RET_BAD_ALLOC);
+    group->pending_transitions = allocator->allocate(
+      capacity * sizeof(const rcl_lifecycle_transition_t *), allocator->state);
+    if (NULL == group->pending_transitions) {
+      allocator->deallocate(group->state_machines, allocator->state);
+      group->state_machines = NULL;
+      RCL_SET_ERROR_MSG("failed to allocate memory for group pending transitions");
+      return RCL_RET_BAD_ALLOC;
+    }
+    group->capacity = capacity;
+  }
+
+  return RCL_RET_OK;
+}
+
+rcl_ret_t
+rcl_lifecycle_group_fini(
+  rcl_lifecycle_group_t * group)
+{
+  RCL_CHECK_FOR_NULL_WITH_MSG(
+    group, "group pointer is null\n", return RCL_RET_INVALID_ARGUMENT);
+
+  // the registered state machines are only borrowed; free the group storage
+  if (group->state_machines != NULL) {
+    group->allocator.deallocate(group->state_machines, group->allocator.state);
+    group->state_machines = NULL;
+  }
+  if (group->pending_transitions != NULL) {
+    group->allocator.deallocate(group->pending_transitions, group->allocator.state);
+    group->pending_transitions = NULL;
+  }
+  group->size = 0;
+  group->capacity = 0;
+
+  return RCL_RET_OK;
+}
+
+rcl_ret_t
+rcl_lifecycle_group_add(
+  rcl_lifecycle_group_t * group,
+  rcl_lifecycle_state_machine_t * state_machine)
+{
+  RCL_CHECK_FOR_NULL_WITH_MSG(
+    group, "group pointer is null\n", return RCL_RET_INVALID_ARGUMENT);
+  RCL_CHECK_FOR_NULL_WITH_MSG(
+    state_machine, "state machine pointer is null\n", return RCL_RET_INVALID_ARGUMENT);
+
+  for (size_t i = 0; i < group->size; ++i) {
+    if (group->state_machines[i] == state_machine) {
+      RCL_SET_ERROR_MSG("state machine is already registered with this group");
+      return RCL_RET_INVALID_ARGUMENT;
+    }
+  }
+
+  if (group->size == group->capacity) {
+    size_t new_capacity = (0 == group->capacity) ? 8u : 2u * group->capacity;
+    rcl_lifecycle_state_machine_t ** new_state_machines = group->allocator.reallocate(
+      group->state_machines,
+      new_capacity * sizeof(rcl_lifecycle_state_machine_t *),
+      group->allocator.state);
+    RCL_CHECK_FOR_NULL_WITH_MSG(
+      new_state_machines, "failed to reallocate memory for group state machines\n",
+      return RCL_RET_BAD_ALLOC);
+    group->state_machines = new_state_machines;
+    const rcl_lifecycle_transition_t ** new_pending_transitions = group->allocator.reallocate(
+      group->pending_transitions,
+      new_capacity * sizeof(const rcl_lifecycle_transition_t *),
+      group->allocator.state);
+    RCL_CHECK_FOR_NULL_WITH_MSG(
+      new_pending_transitions, "failed to reallocate memory for group pending transitions\n",
+      return RCL_RET_BAD_ALLOC);
+    group->pending_transitions = new_pending_transitions;
+    group->capacity = new_capacity;
+  }
+
+  group->state_machines[group->size] = state_machine;
+  ++group->size;
+
+  return RCL_RET_OK;
+}
+
+// Applies the transitions resolved in group->pending_transitions to every
+// state machine and then publishes all notifications in one batch. If a
+// notification cannot be published the remaining ones are still sent and an
+// error is reported at the end.
+static rcl_ret_t
+_trigger_group_transition(
+  rcl_lifecycle_group_t * group,
+  bool publish_notification)
+{
+  // apply all state changes first
+  for (size_t i = 0; i < group->size; ++i) {
+    rcl_lifecycle_state_machine_t * state_machine = group->state_machines[i];
+    const rcl_lifecycle_transition_t * transition = group->pending_transitions[i];
+    _set_current_state(state_machine, transition->goal);
+    TRACETOOLS_TRACEPOINT(
+      rcl_lifecycle_transition,
+      (const void *)state_machine,
+      transition->start->label,
+      state_machine->current_state->label);
+  }
+
+  if (!publish_notification) {
+    return RCL_RET_OK;
+  }
+
+  // publish the notifications in one batch after all machines have moved
+  rcl_ret_t fcn_ret = RCL_RET_OK;
+  for (size_t i = 0; i < group->size; ++i) {
+    rcl_lifecycle_state_machine_t * state_machine = group->state_machines[i];
+    rcl_ret_t ret = rcl_lifecycle_com_interface_publish_notification(
+      &state_machine->com_interface,
+      group->pending_transitions[i]->start, state_machine->current_state);
+    if (ret != RCL_RET_OK && RCL_RET_OK == fcn_ret) {
+      rcl_error_string_t error_string = rcl_get_error_string();
+      rcutils_reset_error();
+      RCL_SET_ERROR_MSG_WITH_FORMAT_STRING("Could not publish transition: %s", error_string.str);
+      fcn_ret = RCL_RET_ERROR;
+    }
+  }
+
+  return fcn_ret;
+}
+
+rcl_ret_t
+rcl_lifecycle_trigger_group_transition_by_id(
+  rcl_lifecycle_group_t * group,
+  uint8_t id,
+  bool publish_notification)
+{
+  RCL_CHECK_FOR_NULL_WITH_MSG(
+    group, "group pointer is null.", return RCL_RET_INVALID_ARGUMENT);
+
+  // resolve the transition for every machine before any machine moves
+  for (size_t i = 0; i < group->size; ++i) {
+    const rcl_lifecycle_transition_t * transition = rcl_lifecycle_get_transition_by_id(
+      group->state_machines[i]->current_state, id);
+    if (NULL == transition || NULL == transition->goal) {
+      RCL_SET_ERROR_MSG_WITH_FORMAT_STRING(
+        "state machine %zu has no valid transition matching %u; no machine was transitioned",
+        i, id);
+      return RCL_RET_ERROR;
+    }
+    group->pending_transitions[i] = transition;
+  }
+
+  return _trigger_group_transition(group, publish_notification);
+}
+
+rcl_ret_t
+rcl_lifecycle_trigger_group_transition_by_label(
+  rcl_lifecycle_group_t * group,
+  const char * label,
+  bool publish_notification)
+{
+  RCL_CHECK_FOR_NULL_WITH_MSG(
+    group, "group pointer is null.", return RCL_RET_INVALID_ARGUMENT);
+  RCL_CHECK_FOR_NULL_WITH_MSG(
+    label, "label pointer is null.", return RCL_RET_INVALID_ARGUMENT);
+
+  // resolve the transition for every machine before any machine moves
+  for (size_t i = 0; i < group->size; ++i) {
+    const rcl_lifecycle_transition_t * transition = rcl_lifecycle_get_transition_by_label(
+      group->state_machines[i]->current_state, label);
+    if (NULL == transition || NULL == transition->goal) {
+      RCL_SET_ERROR_MSG_WITH_FORMAT_STRING(
+        "state machine %zu has no valid transition matching '%s'; no machine was transitioned",
+        i, label);
+      return RCL_RET_ERROR;
+    }
+    group->pending_transitions[i] = transition;
+  }
+
+  return _trigger_group_transition(group, publish_notification);
+}
+
+rcl_ret_t
+rcl_lifecycle_state_machine_get_available_states_response(
+  rcl_lifecycle_state_machine_t * state_machine,
+  const lifecycle_msgs__srv__GetAvailableStates_Response ** response)
+{
+  RCL_CHECK_FOR_NULL_WITH_MSG(
+    state_machine, "state machine pointer is null.", return RCL_RET_INVALID_ARGUMENT);
+  RCL_CHECK_ARGUMENT_FOR_NULL(response, RCL_RET_INVALID_ARGUMENT);
+  if (!state_machine->options.enable_com_interface) {
+    RCL_SET_ERROR_MSG("state machine was initialized without a com interface");
+    return RCL_RET_INVALID_ARGUMENT;
+  }
+
+  return rcl_lifecycle_com_interface_get_available_states_response(
+    &state_machine->com_interface, &state_machine->transition_map, response);
+}
+
+rcl_ret_t
+rcl_lifecycle_state_machine_get_available_transitions_response(
+  rcl_lifecycle_state_machine_t * state_machine,
+  const lifecycle_msgs__srv__GetAvailableTransitions_Response ** response)
+{
+  RCL_CHECK_FOR_NULL_WITH_MSG(
+    state_machine, "state machine pointer is null.", return RCL_RET_INVALID_ARGUMENT);
+  RCL_CHECK_ARGUMENT_FOR_NULL(response, RCL_RET_INVALID_ARGUMENT);
+  if (!state_machine->options.enable_com_interface) {
+    RCL_SET_ERROR_MSG("state machine was initialized without a com interface");
+    return RCL_RET_INVALID_ARGUMENT;
+  }
+
+  return rcl_lifecycle_com_interface_get_available_transitions_response(
+    &state_machine->com_interface, &state_machine->transition_map, response);
+}
+
+rcl_ret_t
+rcl_lifecycle_state_machine_wait_set_get_num_entities(
+  const rcl_lifecycle_state_machine_t * state_machine,
+  size_t * num_services)
+{
+  RCL_CHECK_FOR_NULL_WITH_MSG(
+    state_machine, "state machine pointer is null.", return RCL_RET_INVALID_ARGUMENT);
+  RCL_CHECK_FOR_NULL_WITH_MSG(
+    num_services, "num_services pointer is null.", return RCL_RET_INVALID_ARGUMENT);
+  if (!state_machine->options.enable_com_interface) {
+    RCL_SET_ERROR_MSG("state machine was initialized without a com interface");
+    return RCL_RET_INVALID_ARGUMENT;
+  }
+
+  *num_services = 5;
+  return RCL_RET_OK;
+}
+
+rcl_ret_t
+rcl_lifecycle_wait_set_add_state_machine(
+  rcl_wait_set_t * wait_set,
+  rcl_lifecycle_state_machine_t * state_machine)
+{
+  RCL_CHECK_FOR_NULL_WITH_MSG(
+    wait_set, "wait set pointer is null.", return RCL_RET_INVALID_ARGUMENT);
+  RCL_CHECK_FOR_NULL_WITH_MSG(
+    state_machine, "state machine pointer is null.", return RCL_RET_INVALID_ARGUMENT);
+  if (!state_machine->options.enable_com_interface) {
+    RCL_SET_ERROR_MSG("state machine was initialized without a com interface");
+    return RCL_RET_INVALID_ARGUMENT;
+  }
+
+  rcl_lifecycle_com_interface_t * com_interface = &state_machine->com_interface;
+  rcl_ret_t ret = rcl_wait_set_add_service(
+    wait_set, &com_interface->srv_change_state,
+    &com_interface->wait_set_change_state_service_index);
+  if (ret != RCL_RET_OK) {
+    return ret;
+  }
+  ret = rcl_wait_set_add_service(
+    wait_set, &com_interface->srv_get_state,
+    &com_interface->wait_set_get_state_service_index);
+  if (ret != RCL_RET_OK) {
+    return ret;
+  }
+  ret = rcl_wait_set_add_service(
+    wait_set, &com_interface->srv_get_available_states,
+    &com_interface->wait_set_get_available_states_service_index);
+  if (ret != RCL_RET_OK) {
+    return ret;
+  }
+  ret = rcl_wait_set_add_service(
+    wait_set, &com_interface->srv_get_available_transitions,
+    &com_interface->wait_set_get_available_transitions_service_index);
+  if (ret != RCL_RET_OK) {
+    return ret;
+  }
+  return rcl_wait_set_add_service(
+    wait_set, &com_interface->srv_get_transition_graph,
+    &com_interface->wait_set_get_transition_graph_service_index);
+}
+
+rcl_ret_t
+rcl_lifecycle_state_machine_wait_set_get_entities_ready(
+  const rcl_wait_set_t * wait_set,
+  const rcl_lifecycle_state_machine_t * state_machine,
+  bool * change_state_ready,
+  bool * get_state_ready,
+  bool * get_available_states_ready,
+  bool * get_available_transitions_ready,
+  bool * get_transition_graph_ready)
+{
+  RCL_CHECK_FOR_NULL_WITH_MSG(
+    wait_set, "wait set pointer is null.", return RCL_RET_INVALID_ARGUMENT);
+  RCL_CHECK_FOR_NULL_WITH_MSG(
+    state_machine, "state machine pointer is null.", return RCL_RET_INVALID_ARGUMENT);
+  RCL_CHECK_ARGUMENT_FOR_NULL(change_state_ready, RCL_RET_INVALID_ARGUMENT);
+  RCL_CHECK_ARGUMENT_FOR_NULL(get_state_ready, RCL_RET_INVALID_ARGUMENT);
+  RCL_CHECK_ARGUMENT_FOR_NULL(get_available_states_ready, RCL_RET_INVALID_ARGUMENT);
+  RCL_CHECK_ARGUMENT_FOR_NULL(get_available_transitions_ready, RCL_RET_INVALID_ARGUMENT);
+  RCL_CHECK_ARGUMENT_FOR_NULL(get_transition_graph_ready, RCL_RET_INVALID_ARGUMENT);
+  if (!state_machine->options.enable_com_interface) {
+    RCL_SET_ERROR_MSG("state machine was initialized without a com interface");
+    return RCL_RET_INVALID_ARGUMENT;
+  }
+
+  // rcl_wait() nulls out entries for entities that are not ready, so a service
+  // is ready exactly when its recorded slot still holds its handle
+  const rcl_lifecycle_com_interface_t * com_interface = &state_machine->com_interface;
+  *change_state_ready =
+    com_interface->wait_set_change_state_service_index < wait_set->size_of_services &&
+    wait_set->services[com_interface->wait_set_change_state_service_index] ==
+    &com_interface->srv_change_state;
+  *get_state_ready =
+    com_interface->wait_set_get_state_service_index < wait_set->size_of_services &&
+    wait_set->services[com_interface->wait_set_get_state_service_index] ==
+    &com_interface->srv_get_state;
+  *get_available_states_ready =
+    com_interface->wait_set_get_available_states_service_index < wait_set->size_of_services &&
+    wait_set->services[com_interface->wait_set_get_available_states_service_index] ==
+    &com_interface->srv_get_available_states;
+  *get_available_transitions_ready =
+    com_interface->wait_set_get_available_transitions_service_index < wait_set->size_of_services &&
+    wait_set->services[com_interface->wait_set_get_available_transitions_service_index] ==
+    &com_interface->srv_get_available_transitions;
+  *get_transition_graph_ready =
+    com_interface->wait_set_get_transition_graph_service_index < wait_set->size_of_services &&
+    wait_set->services[com_interface->wait_set_get_transition_graph_service_index] ==
+    &com_interface->srv_get_transition_graph;
+  return RCL_RET_OK;
+}
+
 void
 rcl_print_state_machine(const rcl_lifecycle_state_machine_t * state_machine)
 {
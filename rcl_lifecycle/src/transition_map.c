@@ -17,6 +17,7 @@ extern "C"
 {
 #endif
 
+#include <stdint.h>
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
@@ -27,6 +28,59 @@ extern "C"
 
 #include "rcl_lifecycle/transition_map.h"
 
+#include "./default_state_machine_internal.h"
+
+// Largest id kept in the direct-index arrays; maps registering larger ids
+// drop the index and fall back to scanning on lookup
+#define LIFECYCLE_MAX_INDEXED_ID 1024u
+
+// Frees a direct id index and marks it as unavailable
+static void
+_index_drop(size_t ** index, unsigned int * index_size, const rcutils_allocator_t * allocator)
+{
+  if (NULL != *index) {
+    allocator->deallocate(*index, allocator->state);
+    *index = NULL;
+  }
+  *index_size = 0;
+}
+
+// Records the position of an id in a direct index, growing the index as
+// needed. The index is only useful while it covers every registered id, so it
+// is dropped entirely when an id is out of range or growing fails; lookups
+// then fall back to scanning.
+static void
+_index_insert(
+  size_t ** index, unsigned int * index_size,
+  unsigned int id, size_t position,
+  const rcutils_allocator_t * allocator)
+{
+  if (id >= LIFECYCLE_MAX_INDEXED_ID) {
+    _index_drop(index, index_size, allocator);
+    return;
+  }
+  if (id >= *index_size) {
+    unsigned int new_size = (0 == *index_size) ? 16u : *index_size;
+    while (new_size <= id) {
+      new_size *= 2u;
+    }
+    size_t * new_index = allocator->reallocate(
+      *index, new_size * sizeof(size_t), allocator->state);
+    if (NULL == new_index) {
+      _index_drop(index, index_size, allocator);
+      return;
+    }
+    memset(new_index + *index_size, 0, (new_size - *index_size) * sizeof(size_t));
+    *index = new_index;
+    *index_size = new_size;
+  }
+  // Keep the first registration when an id is registered twice, matching the
+  // first-match semantics of the scanning lookup
+  if (0 == (*index)[id]) {
+    (*index)[id] = position + 1u;
+  }
+}
+
 rcl_lifecycle_transition_map_t
 rcl_lifecycle_get_zero_initialized_transition_map()
 {
@@ -35,10 +89,177 @@ rcl_lifecycle_get_zero_initialized_transition_map()
   transition_map.states_size = 0;
   transition_map.transitions = NULL;
   transition_map.transitions_size = 0;
+  transition_map.state_index = NULL;
+  transition_map.state_index_size = 0;
+  transition_map.transition_index = NULL;
+  transition_map.transition_index_size = 0;
+  transition_map.states_capacity = 0;
+  transition_map.transitions_capacity = 0;
+  transition_map.shared = false;
+  transition_map.detached_from_shared = false;
 
   return transition_map;
 }
 
+// Replaces storage borrowed from the process-wide shared default machine with
+// a private copy, so that the map can be mutated without affecting the other
+// maps sharing it. All internal pointers are rebased onto the private arrays.
+// On failure the map is left unchanged and keeps borrowing the shared storage.
+static rcl_ret_t
+_transition_map_detach(
+  rcl_lifecycle_transition_map_t * transition_map,
+  const rcutils_allocator_t * allocator)
+{
+  const rcl_lifecycle_state_t * old_states = transition_map->states;
+  rcl_lifecycle_state_t * new_states = NULL;
+  rcl_lifecycle_transition_t * new_transitions = NULL;
+  size_t * new_state_index = NULL;
+  unsigned int new_state_index_size = 0;
+  size_t * new_transition_index = NULL;
+  unsigned int new_transition_index_size = 0;
+  unsigned int states_copied = 0;
+
+  if (transition_map->states_size > 0) {
+    new_states = allocator->allocate(
+      transition_map->states_size * sizeof(rcl_lifecycle_state_t), allocator->state);
+    if (NULL == new_states) {
+      goto fail;
+    }
+    memcpy(
+      new_states, old_states, transition_map->states_size * sizeof(rcl_lifecycle_state_t));
+    for (; states_copied < transition_map->states_size; ++states_copied) {
+      rcl_lifecycle_state_t * state = &new_states[states_copied];
+      if (state->valid_transition_size > 0) {
+        rcl_lifecycle_transition_t * valid_transitions = allocator->allocate(
+          state->valid_transition_size * sizeof(rcl_lifecycle_transition_t), allocator->state);
+        if (NULL == valid_transitions) {
+          goto fail;
+        }
+        memcpy(
+          valid_transitions, state->valid_transitions,
+          state->valid_transition_size * sizeof(rcl_lifecycle_transition_t));
+        for (unsigned int i = 0; i < state->valid_transition_size; ++i) {
+          valid_transitions[i].start = &new_states[valid_transitions[i].start - old_states];
+          valid_transitions[i].goal = &new_states[valid_transitions[i].goal - old_states];
+        }
+        state->valid_transitions = valid_transitions;
+      } else {
+        state->valid_transitions = NULL;
+      }
+      state->valid_transition_capacity = state->valid_transition_size;
+    }
+  }
+
+  if (transition_map->transitions_size > 0) {
+    new_transitions = allocator->allocate(
+      transition_map->transitions_size * sizeof(rcl_lifecycle_transition_t), allocator->state);
+    if (NULL == new_transitions) {
+      goto fail;
+    }
+    memcpy(
+      new_transitions, transition_map->transitions,
+      transition_map->transitions_size * sizeof(rcl_lifecycle_transition_t));
+    for (unsigned int i = 0; i < transition_map->transitions_size; ++i) {
+      new_transitions[i].start = &new_states[new_transitions[i].start - old_states];
+      new_transitions[i].goal = &new_states[new_transitions[i].goal - old_states];
+    }
+  }
+
+  // the direct id indexes are optional; when copying one fails the lookups
+  // simply fall back to scanning
+  if (NULL != transition_map->state_index) {
+    new_state_index = allocator->allocate(
+      transition_map->state_index_size * sizeof(size_t), allocator->state);
+    if (NULL != new_state_index) {
+      memcpy(
+        new_state_index, transition_map->state_index,
+        transition_map->state_index_size * sizeof(size_t));
+      new_state_index_size = transition_map->state_index_size;
+    }
+  }
+  if (NULL != transition_map->transition_index) {
+    new_transition_index = allocator->allocate(
+      transition_map->transition_index_size * sizeof(size_t), allocator->state);
+    if (NULL != new_transition_index) {
+      memcpy(
+        new_transition_index, transition_map->transition_index,
+        transition_map->transition_index_size * sizeof(size_t));
+      new_transition_index_size = transition_map->transition_index_size;
+    }
+  }
+
+  // the reference to the shared storage is kept until this map is finalized,
+  // because the enclosing state machine's current state may still point into
+  // the shared states array
+  transition_map->detached_from_shared = true;
+  transition_map->states = new_states;
+  transition_map->states_capacity = transition_map->states_size;
+  transition_map->transitions = new_transitions;
+  transition_map->transitions_capacity = transition_map->transitions_size;
+  transition_map->state_index = new_state_index;
+  transition_map->state_index_size = new_state_index_size;
+  transition_map->transition_index = new_transition_index;
+  transition_map->transition_index_size = new_transition_index_size;
+  transition_map->shared = false;
+  return RCL_RET_OK;
+
+fail:
+  if (NULL != new_states) {
+    for (unsigned int i = 0; i < states_copied; ++i) {
+      if (NULL != new_states[i].valid_transitions) {
+        allocator->deallocate(new_states[i].valid_transitions, allocator->state);
+      }
+    }
+    allocator->deallocate(new_states, allocator->state);
+  }
+  if (NULL != new_transitions) {
+    allocator->deallocate(new_transitions, allocator->state);
+  }
+  RCL_SET_ERROR_MSG("failed to allocate memory to detach shared transition map");
+  return RCL_RET_BAD_ALLOC;
+}
+
+rcl_ret_t
+rcl_lifecycle_transition_map_reserve(
+  rcl_lifecycle_transition_map_t * transition_map,
+  unsigned int states_capacity,
+  unsigned int transitions_capacity,
+  const rcutils_allocator_t * allocator)
+{
+  RCUTILS_CAN_RETURN_WITH_ERROR_OF(RCL_RET_INVALID_ARGUMENT);
+  RCUTILS_CAN_RETURN_WITH_ERROR_OF(RCL_RET_BAD_ALLOC);
+
+  RCL_CHECK_FOR_NULL_WITH_MSG(
+    transition_map, "transition_map pointer is null\n", return RCL_RET_INVALID_ARGUMENT);
+  RCL_CHECK_ALLOCATOR_WITH_MSG(
+    allocator, "invalid allocator", return RCL_RET_INVALID_ARGUMENT);
+
+  if (states_capacity > transition_map->states_capacity) {
+    rcl_lifecycle_state_t * new_states = allocator->reallocate(
+      transition_map->states,
+      states_capacity * sizeof(rcl_lifecycle_state_t),
+      allocator->state);
+    RCL_CHECK_FOR_NULL_WITH_MSG(
+      new_states, "failed to reallocate memory for new states\n", return RCL_RET_BAD_ALLOC);
+    transition_map->states = new_states;
+    transition_map->states_capacity = states_capacity;
+  }
+
+  if (transitions_capacity > transition_map->transitions_capacity) {
+    rcl_lifecycle_transition_t * new_transitions = allocator->reallocate(
+      transition_map->transitions,
+      transitions_capacity * sizeof(rcl_lifecycle_transition_t),
+      allocator->state);
+    RCL_CHECK_FOR_NULL_WITH_MSG(
+      new_transitions, "failed to reallocate memory for new transitions\n",
+      return RCL_RET_BAD_ALLOC);
+    transition_map->transitions = new_transitions;
+    transition_map->transitions_capacity = transitions_capacity;
+  }
+
+  return RCL_RET_OK;
+}
+
 rcl_ret_t
 rcl_lifecycle_transition_map_is_initialized(const rcl_lifecycle_transition_map_t * transition_map)
 {
@@ -66,6 +287,14 @@ rcl_lifecycle_transition_map_fini(
 
   rcl_ret_t fcn_ret = RCL_RET_OK;
 
+  // storage borrowed from the shared default machine belongs to the process
+  // wide owner; drop this map's reference instead of freeing the arrays
+  if (transition_map->shared) {
+    *transition_map = rcl_lifecycle_get_zero_initialized_transition_map();
+    rcl_lifecycle_shared_default_map_release();
+    return fcn_ret;
+  }
+
   // free valid transitions for all states
   for (unsigned int i = 0; i < transition_map->states_size; ++i) {
     if (transition_map->states[i].valid_transitions != NULL) {
@@ -77,10 +306,22 @@ rcl_lifecycle_transition_map_fini(
   allocator->deallocate(transition_map->states, allocator->state);
   transition_map->states = NULL;
   transition_map->states_size = 0;
+  transition_map->states_capacity = 0;
   // free the tansitions
   allocator->deallocate(transition_map->transitions, allocator->state);
   transition_map->transitions = NULL;
   transition_map->transitions_size = 0;
+  transition_map->transitions_capacity = 0;
+  // free the direct id indexes
+  _index_drop(&transition_map->state_index, &transition_map->state_index_size, allocator);
+  _index_drop(
+    &transition_map->transition_index, &transition_map->transition_index_size, allocator);
+  // a map detached from the shared default machine kept a reference to the
+  // shared storage; release it now
+  if (transition_map->detached_from_shared) {
+    transition_map->detached_from_shared = false;
+    rcl_lifecycle_shared_default_map_release();
+  }
 
   return fcn_ret;
 }
@@ -104,18 +345,42 @@ rcl_lifecycle_register_state(
 
   RCL_CHECK_ALLOCATOR_WITH_MSG(
     allocator, "invalid allocator", return RCL_RET_INVALID_ARGUMENT)
-  // add new primary state memory
+
+  // storage borrowed from the shared default machine is copied before the
+  // first mutation (copy-on-write)
+  if (transition_map->shared) {
+    rcl_ret_t detach_ret = _transition_map_detach(transition_map, allocator);
+    if (detach_ret != RCL_RET_OK) {
+      return detach_ret;
+    }
+  }
+
+  // add new primary state memory, growing geometrically so repeated
+  // registration does not reallocate once per state
   unsigned int new_states_size = transition_map->states_size + 1;
-  rcl_lifecycle_state_t * new_states = allocator->reallocate(
-    transition_map->states,
-    new_states_size * sizeof(rcl_lifecycle_state_t),
-    allocator->state);
-  RCL_CHECK_FOR_NULL_WITH_MSG(
-    new_states, "failed to reallocate memory for new states\n", return RCL_RET_BAD_ALLOC);
+  if (new_states_size > transition_map->states_capacity) {
+    unsigned int new_capacity =
+      (0 == transition_map->states_capacity) ? 1u : 2u * transition_map->states_capacity;
+    rcl_lifecycle_state_t * new_states = allocator->reallocate(
+      transition_map->states,
+      new_capacity * sizeof(rcl_lifecycle_state_t),
+      allocator->state);
+    RCL_CHECK_FOR_NULL_WITH_MSG(
+      new_states, "failed to reallocate memory for new states\n", return RCL_RET_BAD_ALLOC);
+    transition_map->states = new_states;
+    transition_map->states_capacity = new_capacity;
+  }
   transition_map->states_size = new_states_size;
-  transition_map->states = new_states;
   transition_map->states[transition_map->states_size - 1] = state;
 
+  // keep the direct id index in step with the states array; positions stay
+  // valid across reallocation
+  if (NULL != transition_map->state_index || 1u == transition_map->states_size) {
+    _index_insert(
+      &transition_map->state_index, &transition_map->state_index_size,
+      state.id, transition_map->states_size - 1u, allocator);
+  }
+
   return RCL_RET_OK;
 }
 
@@ -135,6 +400,16 @@ rcl_lifecycle_register_transition(
   RCL_CHECK_ALLOCATOR_WITH_MSG(
     allocator, "invalid allocator", return RCL_RET_INVALID_ARGUMENT);
 
+  // storage borrowed from the shared default machine is copied before the
+  // first mutation (copy-on-write); detach before looking up the start and
+  // goal states so the returned pointers are into the private copy
+  if (transition_map->shared) {
+    rcl_ret_t detach_ret = _transition_map_detach(transition_map, allocator);
+    if (detach_ret != RCL_RET_OK) {
+      return detach_ret;
+    }
+  }
+
   rcl_lifecycle_state_t * state = rcl_lifecycle_get_state(transition_map, transition.start->id);
   if (!state) {
     RCL_SET_ERROR_MSG_WITH_FORMAT_STRING("state %u is not registered\n", transition.start->id);
@@ -146,38 +421,84 @@ rcl_lifecycle_register_transition(
     RCL_SET_ERROR_MSG_WITH_FORMAT_STRING("state %u is not registered\n", transition.goal->id);
     return RCL_RET_LIFECYCLE_STATE_NOT_REGISTERED;
   }
-  // Attempt to add new transition, don't update map if it fails
+  // store map-owned state pointers so the registered transition never
+  // references storage outside this map (e.g. a shared map it detached from)
+  transition.start = state;
+  transition.goal = goal;
+  // Attempt to add new transition, don't update map if it fails. The array
+  // grows geometrically so repeated registration does not reallocate once
+  // per transition.
   unsigned int new_transitions_size = transition_map->transitions_size + 1;
-  rcl_lifecycle_transition_t * new_transitions = allocator->reallocate(
-    transition_map->transitions,
-    new_transitions_size * sizeof(rcl_lifecycle_transition_t),
-    allocator->state);
-  if (!new_transitions) {
-    RCL_SET_ERROR_MSG("failed to reallocate memory for new transitions");
-    return RCL_RET_BAD_ALLOC;
+  if (new_transitions_size > transition_map->transitions_capacity) {
+    unsigned int new_capacity =
+      (0 == transition_map->transitions_capacity) ?
+      1u : 2u * transition_map->transitions_capacity;
+    rcl_lifecycle_transition_t * new_transitions = allocator->reallocate(
+      transition_map->transitions,
+      new_capacity * sizeof(rcl_lifecycle_transition_t),
+      allocator->state);
+    if (!new_transitions) {
+      RCL_SET_ERROR_MSG("failed to reallocate memory for new transitions");
+      return RCL_RET_BAD_ALLOC;
+    }
+    transition_map->transitions = new_transitions;
+    transition_map->transitions_capacity = new_capacity;
   }
   transition_map->transitions_size = new_transitions_size;
-  transition_map->transitions = new_transitions;
   // finally set the new transition to the end of the array
   transition_map->transitions[transition_map->transitions_size - 1] = transition;
 
+  // keep the direct id index in step with the transitions array
+  if (NULL != transition_map->transition_index || 1u == transition_map->transitions_size) {
+    _index_insert(
+      &transition_map->transition_index, &transition_map->transition_index_size,
+      transition.id, transition_map->transitions_size - 1u, allocator);
+  }
+
   // we have to copy the transitons here once more to the actual state
   // as we can't assign only the pointer. This pointer gets invalidated whenever
   // we add a new transition and re-shuffle/re-allocate new memory for it.
   unsigned int new_valid_transitions_size = state->valid_transition_size + 1;
-  rcl_lifecycle_transition_t * new_valid_transitions = allocator->reallocate(
-    state->valid_transitions,
-    new_valid_transitions_size * sizeof(rcl_lifecycle_transition_t),
-    allocator->state);
-  if (!new_valid_transitions) {
-    RCL_SET_ERROR_MSG("failed to reallocate memory for new transitions on state");
-    return RCL_RET_BAD_ALLOC;
+  if (new_valid_transitions_size > state->valid_transition_capacity) {
+    unsigned int new_capacity =
+      (0 == state->valid_transition_capacity) ? 2u : 2u * state->valid_transition_capacity;
+    rcl_lifecycle_transition_t * new_valid_transitions = allocator->reallocate(
+      state->valid_transitions,
+      new_capacity * sizeof(rcl_lifecycle_transition_t),
+      allocator->state);
+    if (!new_valid_transitions) {
+      RCL_SET_ERROR_MSG("failed to reallocate memory for new transitions on state");
+      return RCL_RET_BAD_ALLOC;
+    }
+    state->valid_transitions = new_valid_transitions;
+    state->valid_transition_capacity = new_capacity;
   }
   state->valid_transition_size = new_valid_transitions_size;
-  state->valid_transitions = new_valid_transitions;
 
   state->valid_transitions[state->valid_transition_size - 1] = transition;
 
+  // keep the per-state direct transition lookup in step, so validity checks
+  // are one bit test and id lookups one indexed load; ids or counts that do
+  // not fit drop the direct lookup and leave id lookups scanning
+  if (state->valid_transition_direct || 1u == state->valid_transition_size) {
+    if (transition.id < RCL_LIFECYCLE_MAX_TRANSITION_KEYS &&
+      state->valid_transition_size <= UINT8_MAX)
+    {
+      state->valid_transition_mask[transition.id / 64u] |= 1ull << (transition.id % 64u);
+      // keep the first registration when an id is registered twice, matching
+      // the first-match semantics of the scanning lookup
+      if (0 == state->valid_transition_position[transition.id]) {
+        state->valid_transition_position[transition.id] =
+          (uint8_t)state->valid_transition_size;
+      }
+      state->valid_transition_direct = true;
+    } else {
+      memset(state->valid_transition_mask, 0, sizeof(state->valid_transition_mask));
+      memset(state->valid_transition_position, 0, sizeof(state->valid_transition_position));
+      state->valid_transition_direct = false;
+    }
+  }
+
   return RCL_RET_OK;
 }
 
@@ -188,6 +509,14 @@ rcl_lifecycle_get_state(
 {
   RCL_CHECK_FOR_NULL_WITH_MSG(
     transition_map, "transition_map pointer is null\n", return NULL);
+  // the direct index covers every registered state while it exists
+  if (NULL != transition_map->state_index) {
+    if (state_id >= transition_map->state_index_size) {
+      return NULL;
+    }
+    const size_t position = transition_map->state_index[state_id];
+    return (0 == position) ? NULL : &transition_map->states[position - 1u];
+  }
   for (unsigned int i = 0; i < transition_map->states_size; ++i) {
     if (transition_map->states[i].id == state_id) {
       return &transition_map->states[i];
@@ -203,6 +532,14 @@ rcl_lifecycle_get_transitions(
 {
   RCL_CHECK_FOR_NULL_WITH_MSG(
     transition_map, "transition_map pointer is null\n", return NULL);
+  // the direct index covers every registered transition while it exists
+  if (NULL != transition_map->transition_index) {
+    if (transition_id >= transition_map->transition_index_size) {
+      return NULL;
+    }
+    const size_t position = transition_map->transition_index[transition_id];
+    return (0 == position) ? NULL : &transition_map->transitions[position - 1u];
+  }
   for (unsigned int i = 0; i < transition_map->transitions_size; ++i) {
     if (transition_map->transitions[i].id == transition_id) {
       return &transition_map->transitions[i];
@@ -138,3 +138,55 @@ TEST_F(TestMultipleInstances, default_sequence_error_unresolved) {
   ret = rcl_lifecycle_state_machine_fini(&state_machine3, this->node_ptr);
   EXPECT_EQ(RCL_RET_OK, ret) << rcl_get_error_string().str;
 }
+
+TEST_F(TestMultipleInstances, shared_default_machine_copy_on_write) {
+  rcl_ret_t ret;
+
+  rcl_lifecycle_state_machine_t state_machine1 =
+    rcl_lifecycle_get_zero_initialized_state_machine();
+  state_machine1.options = this->state_machine_options;
+  ret =
+    rcl_lifecycle_init_default_state_machine(&state_machine1, &state_machine1.options.allocator);
+  EXPECT_EQ(RCL_RET_OK, ret) << rcl_get_error_string().str;
+
+  rcl_lifecycle_state_machine_t state_machine2 =
+    rcl_lifecycle_get_zero_initialized_state_machine();
+  state_machine2.options = this->state_machine_options;
+  ret =
+    rcl_lifecycle_init_default_state_machine(&state_machine2, &state_machine2.options.allocator);
+  EXPECT_EQ(RCL_RET_OK, ret) << rcl_get_error_string().str;
+
+  // structurally identical default machines share one process-wide map
+  EXPECT_TRUE(state_machine1.transition_map.shared);
+  EXPECT_TRUE(state_machine2.transition_map.shared);
+  EXPECT_EQ(state_machine1.transition_map.states, state_machine2.transition_map.states);
+  EXPECT_EQ(state_machine1.transition_map.transitions, state_machine2.transition_map.transitions);
+
+  // registering a custom state detaches a private copy and leaves the other
+  // machine on the shared map
+  rcl_lifecycle_state_t custom_state = {"custom", 200, NULL, 0, 0};
+  ret = rcl_lifecycle_register_state(
+    &state_machine2.transition_map, custom_state, &state_machine2.options.allocator);
+  EXPECT_EQ(RCL_RET_OK, ret) << rcl_get_error_string().str;
+  EXPECT_FALSE(state_machine2.transition_map.shared);
+  EXPECT_NE(state_machine1.transition_map.states, state_machine2.transition_map.states);
+  EXPECT_TRUE(state_machine1.transition_map.shared);
+  EXPECT_EQ(nullptr, rcl_lifecycle_get_state(&state_machine1.transition_map, custom_state.id));
+  EXPECT_NE(nullptr, rcl_lifecycle_get_state(&state_machine2.transition_map, custom_state.id));
+
+  // the detached copy carries all default states and stays fully functional
+  EXPECT_EQ(
+    state_machine1.transition_map.states_size + 1u, state_machine2.transition_map.states_size);
+  test_trigger_transition(
+    &state_machine2,
+    lifecycle_msgs__msg__Transition__TRANSITION_CONFIGURE,
+    lifecycle_msgs__msg__State__PRIMARY_STATE_UNCONFIGURED,
+    lifecycle_msgs__msg__State__TRANSITION_STATE_CONFIGURING);
+  EXPECT_EQ(
+    lifecycle_msgs__msg__State__PRIMARY_STATE_UNCONFIGURED, state_machine1.current_state->id);
+
+  ret = rcl_lifecycle_state_machine_fini(&state_machine1, this->node_ptr);
+  EXPECT_EQ(RCL_RET_OK, ret) << rcl_get_error_string().str;
+  ret = rcl_lifecycle_state_machine_fini(&state_machine2, this->node_ptr);
+  EXPECT_EQ(RCL_RET_OK, ret) << rcl_get_error_string().str;
+}
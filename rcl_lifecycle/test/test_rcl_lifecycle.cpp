@@ -19,12 +19,15 @@
 #include <gtest/gtest.h>
 
 #include "rcl_lifecycle/rcl_lifecycle.h"
+#include "rcl_lifecycle/transition_map.h"
 
 #include "osrf_testing_tools_cpp/memory_tools/memory_tools.hpp"
 #include "osrf_testing_tools_cpp/scope_exit.hpp"
 #include "rcl/error_handling.h"
 #include "rcutils/testing/fault_injection.h"
 
+#include "lifecycle_msgs/msg/state.h"
+#include "lifecycle_msgs/msg/transition.h"
 #include "lifecycle_msgs/msg/transition_event.h"
 #include "lifecycle_msgs/srv/change_state.h"
 #include "lifecycle_msgs/srv/get_available_states.h"
@@ -551,3 +554,474 @@ TEST(TestRclLifecycle, init_fini_maybe_fail) {
     }
   });
 }
+
+TEST(TestRclLifecycle, lifecycle_group) {
+  rcl_allocator_t allocator = rcl_get_default_allocator();
+  rcl_lifecycle_group_t group = rcl_lifecycle_get_zero_initialized_group();
+
+  rcl_ret_t ret = rcl_lifecycle_group_init(nullptr, 2u, &allocator);
+  EXPECT_EQ(RCL_RET_INVALID_ARGUMENT, ret);
+  rcutils_reset_error();
+
+  ret = rcl_lifecycle_group_init(&group, 2u, nullptr);
+  EXPECT_EQ(RCL_RET_INVALID_ARGUMENT, ret);
+  rcutils_reset_error();
+
+  ret = rcl_lifecycle_group_init(&group, 2u, &allocator);
+  ASSERT_EQ(RCL_RET_OK, ret) << rcl_get_error_string().str;
+
+  rcl_lifecycle_state_machine_t state_machine1 =
+    rcl_lifecycle_get_zero_initialized_state_machine();
+  state_machine1.options.enable_com_interface = false;
+  ASSERT_EQ(
+    RCL_RET_OK,
+    rcl_lifecycle_init_default_state_machine(&state_machine1, &state_machine1.options.allocator));
+  rcl_lifecycle_state_machine_t state_machine2 =
+    rcl_lifecycle_get_zero_initialized_state_machine();
+  state_machine2.options.enable_com_interface = false;
+  ASSERT_EQ(
+    RCL_RET_OK,
+    rcl_lifecycle_init_default_state_machine(&state_machine2, &state_machine2.options.allocator));
+
+  EXPECT_EQ(RCL_RET_OK, rcl_lifecycle_group_add(&group, &state_machine1));
+  EXPECT_EQ(RCL_RET_OK, rcl_lifecycle_group_add(&group, &state_machine2));
+  // a machine can only be registered once per group
+  EXPECT_EQ(RCL_RET_INVALID_ARGUMENT, rcl_lifecycle_group_add(&group, &state_machine1));
+  rcutils_reset_error();
+
+  // one call moves every machine in the group
+  ret = rcl_lifecycle_trigger_group_transition_by_label(
+    &group, rcl_lifecycle_configure_label, false);
+  EXPECT_EQ(RCL_RET_OK, ret) << rcl_get_error_string().str;
+  EXPECT_EQ(
+    lifecycle_msgs__msg__State__TRANSITION_STATE_CONFIGURING, state_machine1.current_state->id);
+  EXPECT_EQ(
+    lifecycle_msgs__msg__State__TRANSITION_STATE_CONFIGURING, state_machine2.current_state->id);
+
+  // a transition not valid for the current states blocks the whole group
+  ret = rcl_lifecycle_trigger_group_transition_by_label(
+    &group, rcl_lifecycle_configure_label, false);
+  EXPECT_EQ(RCL_RET_ERROR, ret);
+  rcutils_reset_error();
+  EXPECT_EQ(
+    lifecycle_msgs__msg__State__TRANSITION_STATE_CONFIGURING, state_machine1.current_state->id);
+  EXPECT_EQ(
+    lifecycle_msgs__msg__State__TRANSITION_STATE_CONFIGURING, state_machine2.current_state->id);
+
+  // triggering by id works the same way
+  ret = rcl_lifecycle_trigger_group_transition_by_id(
+    &group, lifecycle_msgs__msg__Transition__TRANSITION_ON_CONFIGURE_SUCCESS, false);
+  EXPECT_EQ(RCL_RET_OK, ret) << rcl_get_error_string().str;
+  EXPECT_EQ(
+    lifecycle_msgs__msg__State__PRIMARY_STATE_INACTIVE, state_machine1.current_state->id);
+  EXPECT_EQ(
+    lifecycle_msgs__msg__State__PRIMARY_STATE_INACTIVE, state_machine2.current_state->id);
+
+  EXPECT_EQ(RCL_RET_OK, rcl_lifecycle_group_fini(&group));
+  EXPECT_EQ(
+    RCL_RET_OK,
+    rcl_lifecycle_transition_map_fini(
+      &state_machine1.transition_map, &state_machine1.options.allocator));
+  EXPECT_EQ(
+    RCL_RET_OK,
+    rcl_lifecycle_transition_map_fini(
+      &state_machine2.transition_map, &state_machine2.options.allocator));
+}
+
+TEST(TestRclLifecycle, get_current_state) {
+  EXPECT_EQ(nullptr, rcl_lifecycle_state_machine_get_current_state(nullptr));
+  rcutils_reset_error();
+
+  rcl_lifecycle_state_machine_t state_machine =
+    rcl_lifecycle_get_zero_initialized_state_machine();
+  state_machine.options.enable_com_interface = false;
+  ASSERT_EQ(
+    RCL_RET_OK,
+    rcl_lifecycle_init_default_state_machine(&state_machine, &state_machine.options.allocator));
+
+  EXPECT_EQ(
+    state_machine.current_state, rcl_lifecycle_state_machine_get_current_state(&state_machine));
+
+  rcl_ret_t ret = rcl_lifecycle_trigger_transition_by_label(
+    &state_machine, rcl_lifecycle_configure_label, false);
+  EXPECT_EQ(RCL_RET_OK, ret) << rcl_get_error_string().str;
+  const rcl_lifecycle_state_t * current =
+    rcl_lifecycle_state_machine_get_current_state(&state_machine);
+  ASSERT_NE(nullptr, current);
+  EXPECT_EQ(lifecycle_msgs__msg__State__TRANSITION_STATE_CONFIGURING, current->id);
+
+  EXPECT_EQ(
+    RCL_RET_OK,
+    rcl_lifecycle_transition_map_fini(
+      &state_machine.transition_map, &state_machine.options.allocator));
+}
+
+TEST(TestRclLifecycle, transition_validity_bitmask) {
+  EXPECT_FALSE(rcl_lifecycle_state_transition_is_valid(nullptr, 0u));
+  rcutils_reset_error();
+
+  // a hand-built state without registered transitions falls back to scanning
+  rcl_lifecycle_state_t empty_state = rcl_lifecycle_get_zero_initialized_state();
+  EXPECT_FALSE(empty_state.valid_transition_direct);
+  EXPECT_FALSE(
+    rcl_lifecycle_state_transition_is_valid(
+      &empty_state, lifecycle_msgs__msg__Transition__TRANSITION_CONFIGURE));
+
+  rcl_lifecycle_state_machine_t state_machine =
+    rcl_lifecycle_get_zero_initialized_state_machine();
+  state_machine.options.enable_com_interface = false;
+  ASSERT_EQ(
+    RCL_RET_OK,
+    rcl_lifecycle_init_default_state_machine(&state_machine, &state_machine.options.allocator));
+
+  // registered states carry the precomputed mask and direct lookup
+  EXPECT_TRUE(state_machine.current_state->valid_transition_direct);
+  EXPECT_TRUE(
+    rcl_lifecycle_state_transition_is_valid(
+      state_machine.current_state, lifecycle_msgs__msg__Transition__TRANSITION_CONFIGURE));
+  EXPECT_FALSE(
+    rcl_lifecycle_state_transition_is_valid(
+      state_machine.current_state, lifecycle_msgs__msg__Transition__TRANSITION_ACTIVATE));
+
+  // the direct lookup returns the same transition as the scan used to
+  const rcl_lifecycle_transition_t * transition = rcl_lifecycle_get_transition_by_id(
+    state_machine.current_state, lifecycle_msgs__msg__Transition__TRANSITION_CONFIGURE);
+  ASSERT_NE(nullptr, transition);
+  EXPECT_EQ(
+    lifecycle_msgs__msg__Transition__TRANSITION_CONFIGURE,
+    static_cast<uint8_t>(transition->id));
+
+  EXPECT_EQ(
+    RCL_RET_OK,
+    rcl_lifecycle_transition_map_fini(
+      &state_machine.transition_map, &state_machine.options.allocator));
+}
+
+TEST(TestRclLifecycle, wait_set_bundle) {
+  rcl_lifecycle_state_machine_t state_machine =
+    rcl_lifecycle_get_zero_initialized_state_machine();
+
+  rcl_node_t node = rcl_get_zero_initialized_node();
+  rcl_allocator_t allocator = rcl_get_default_allocator();
+  rcl_lifecycle_state_machine_options_t state_machine_options =
+    rcl_lifecycle_get_default_state_machine_options();
+
+  rcl_context_t context = rcl_get_zero_initialized_context();
+  rcl_node_options_t options = rcl_node_get_default_options();
+  OSRF_TESTING_TOOLS_CPP_SCOPE_EXIT(
+  {
+    EXPECT_EQ(RCL_RET_OK, rcl_node_options_fini(&options));
+  });
+
+  rcl_init_options_t init_options = rcl_get_zero_initialized_init_options();
+  rcl_ret_t ret = rcl_init_options_init(&init_options, allocator);
+  ASSERT_EQ(RCL_RET_OK, ret) << rcl_get_error_string().str;
+  OSRF_TESTING_TOOLS_CPP_SCOPE_EXIT(
+  {
+    EXPECT_EQ(RCL_RET_OK, rcl_init_options_fini(&init_options));
+  });
+
+  ret = rcl_init(0, nullptr, &init_options, &context);
+  ASSERT_EQ(RCL_RET_OK, ret) << rcl_get_error_string().str;
+  OSRF_TESTING_TOOLS_CPP_SCOPE_EXIT(
+  {
+    EXPECT_EQ(RCL_RET_OK, rcl_shutdown(&context));
+    EXPECT_EQ(RCL_RET_OK, rcl_context_fini(&context));
+  });
+
+  ret = rcl_node_init(&node, "node", "namespace", &context, &options);
+  ASSERT_EQ(RCL_RET_OK, ret) << rcl_get_error_string().str;
+  OSRF_TESTING_TOOLS_CPP_SCOPE_EXIT(
+  {
+    EXPECT_EQ(RCL_RET_OK, rcl_node_fini(&node));
+  });
+
+  const rosidl_message_type_support_t * pn =
+    ROSIDL_GET_MSG_TYPE_SUPPORT(lifecycle_msgs, msg, TransitionEvent);
+  const rosidl_service_type_support_t * cs =
+    ROSIDL_GET_SRV_TYPE_SUPPORT(lifecycle_msgs, srv, ChangeState);
+  const rosidl_service_type_support_t * gs =
+    ROSIDL_GET_SRV_TYPE_SUPPORT(lifecycle_msgs, srv, GetState);
+  const rosidl_service_type_support_t * gas =
+    ROSIDL_GET_SRV_TYPE_SUPPORT(lifecycle_msgs, srv, GetAvailableStates);
+  const rosidl_service_type_support_t * gat =
+    ROSIDL_GET_SRV_TYPE_SUPPORT(lifecycle_msgs, srv, GetAvailableTransitions);
+  const rosidl_service_type_support_t * gtg =
+    ROSIDL_GET_SRV_TYPE_SUPPORT(lifecycle_msgs, srv, GetAvailableTransitions);
+
+  ret = rcl_lifecycle_state_machine_init(
+    &state_machine, &node, pn, cs, gs, gas, gat, gtg, &state_machine_options);
+  ASSERT_EQ(RCL_RET_OK, ret) << rcl_get_error_string().str;
+  OSRF_TESTING_TOOLS_CPP_SCOPE_EXIT(
+  {
+    EXPECT_EQ(RCL_RET_OK, rcl_lifecycle_state_machine_fini(&state_machine, &node));
+  });
+
+  size_t num_services = 0u;
+  ret = rcl_lifecycle_state_machine_wait_set_get_num_entities(nullptr, &num_services);
+  EXPECT_EQ(RCL_RET_INVALID_ARGUMENT, ret);
+  rcutils_reset_error();
+  ret = rcl_lifecycle_state_machine_wait_set_get_num_entities(&state_machine, nullptr);
+  EXPECT_EQ(RCL_RET_INVALID_ARGUMENT, ret);
+  rcutils_reset_error();
+
+  ret = rcl_lifecycle_state_machine_wait_set_get_num_entities(&state_machine, &num_services);
+  EXPECT_EQ(RCL_RET_OK, ret) << rcl_get_error_string().str;
+  EXPECT_EQ(5u, num_services);
+
+  rcl_wait_set_t wait_set = rcl_get_zero_initialized_wait_set();
+  ret = rcl_wait_set_init(
+    &wait_set, 0, 0, 0, 0, num_services, 0, &context, allocator);
+  ASSERT_EQ(RCL_RET_OK, ret) << rcl_get_error_string().str;
+  OSRF_TESTING_TOOLS_CPP_SCOPE_EXIT(
+  {
+    EXPECT_EQ(RCL_RET_OK, rcl_wait_set_fini(&wait_set));
+  });
+
+  ret = rcl_lifecycle_wait_set_add_state_machine(nullptr, &state_machine);
+  EXPECT_EQ(RCL_RET_INVALID_ARGUMENT, ret);
+  rcutils_reset_error();
+  ret = rcl_lifecycle_wait_set_add_state_machine(&wait_set, nullptr);
+  EXPECT_EQ(RCL_RET_INVALID_ARGUMENT, ret);
+  rcutils_reset_error();
+
+  ret = rcl_lifecycle_wait_set_add_state_machine(&wait_set, &state_machine);
+  EXPECT_EQ(RCL_RET_OK, ret) << rcl_get_error_string().str;
+
+  // no clients exist, so waiting has to time out with no service ready
+  ret = rcl_wait(&wait_set, RCL_MS_TO_NS(100));
+  EXPECT_EQ(RCL_RET_TIMEOUT, ret) << rcl_get_error_string().str;
+  rcutils_reset_error();
+
+  bool change_state_ready = true;
+  bool get_state_ready = true;
+  bool get_available_states_ready = true;
+  bool get_available_transitions_ready = true;
+  bool get_transition_graph_ready = true;
+  ret = rcl_lifecycle_state_machine_wait_set_get_entities_ready(
+    nullptr, &state_machine, &change_state_ready, &get_state_ready,
+    &get_available_states_ready, &get_available_transitions_ready,
+    &get_transition_graph_ready);
+  EXPECT_EQ(RCL_RET_INVALID_ARGUMENT, ret);
+  rcutils_reset_error();
+  ret = rcl_lifecycle_state_machine_wait_set_get_entities_ready(
+    &wait_set, &state_machine, &change_state_ready, &get_state_ready,
+    &get_available_states_ready, &get_available_transitions_ready,
+    nullptr);
+  EXPECT_EQ(RCL_RET_INVALID_ARGUMENT, ret);
+  rcutils_reset_error();
+
+  ret = rcl_lifecycle_state_machine_wait_set_get_entities_ready(
+    &wait_set, &state_machine, &change_state_ready, &get_state_ready,
+    &get_available_states_ready, &get_available_transitions_ready,
+    &get_transition_graph_ready);
+  EXPECT_EQ(RCL_RET_OK, ret) << rcl_get_error_string().str;
+  EXPECT_FALSE(change_state_ready);
+  EXPECT_FALSE(get_state_ready);
+  EXPECT_FALSE(get_available_states_ready);
+  EXPECT_FALSE(get_available_transitions_ready);
+  EXPECT_FALSE(get_transition_graph_ready);
+}
+
+TEST(TestRclLifecycle, cached_introspection_responses) {
+  rcl_lifecycle_state_machine_t state_machine =
+    rcl_lifecycle_get_zero_initialized_state_machine();
+
+  rcl_node_t node = rcl_get_zero_initialized_node();
+  rcl_allocator_t allocator = rcl_get_default_allocator();
+  rcl_lifecycle_state_machine_options_t state_machine_options =
+    rcl_lifecycle_get_default_state_machine_options();
+
+  rcl_context_t context = rcl_get_zero_initialized_context();
+  rcl_node_options_t options = rcl_node_get_default_options();
+  OSRF_TESTING_TOOLS_CPP_SCOPE_EXIT(
+  {
+    EXPECT_EQ(RCL_RET_OK, rcl_node_options_fini(&options));
+  });
+
+  rcl_init_options_t init_options = rcl_get_zero_initialized_init_options();
+  rcl_ret_t ret = rcl_init_options_init(&init_options, allocator);
+  ASSERT_EQ(RCL_RET_OK, ret) << rcl_get_error_string().str;
+  OSRF_TESTING_TOOLS_CPP_SCOPE_EXIT(
+  {
+    EXPECT_EQ(RCL_RET_OK, rcl_init_options_fini(&init_options));
+  });
+
+  ret = rcl_init(0, nullptr, &init_options, &context);
+  ASSERT_EQ(RCL_RET_OK, ret) << rcl_get_error_string().str;
+  OSRF_TESTING_TOOLS_CPP_SCOPE_EXIT(
+  {
+    EXPECT_EQ(RCL_RET_OK, rcl_shutdown(&context));
+    EXPECT_EQ(RCL_RET_OK, rcl_context_fini(&context));
+  });
+
+  ret = rcl_node_init(&node, "node", "namespace", &context, &options);
+  ASSERT_EQ(RCL_RET_OK, ret) << rcl_get_error_string().str;
+  OSRF_TESTING_TOOLS_CPP_SCOPE_EXIT(
+  {
+    EXPECT_EQ(RCL_RET_OK, rcl_node_fini(&node));
+  });
+
+  const rosidl_message_type_support_t * pn =
+    ROSIDL_GET_MSG_TYPE_SUPPORT(lifecycle_msgs, msg, TransitionEvent);
+  const rosidl_service_type_support_t * cs =
+    ROSIDL_GET_SRV_TYPE_SUPPORT(lifecycle_msgs, srv, ChangeState);
+  const rosidl_service_type_support_t * gs =
+    ROSIDL_GET_SRV_TYPE_SUPPORT(lifecycle_msgs, srv, GetState);
+  const rosidl_service_type_support_t * gas =
+    ROSIDL_GET_SRV_TYPE_SUPPORT(lifecycle_msgs, srv, GetAvailableStates);
+  const rosidl_service_type_support_t * gat =
+    ROSIDL_GET_SRV_TYPE_SUPPORT(lifecycle_msgs, srv, GetAvailableTransitions);
+  const rosidl_service_type_support_t * gtg =
+    ROSIDL_GET_SRV_TYPE_SUPPORT(lifecycle_msgs, srv, GetAvailableTransitions);
+
+  ret = rcl_lifecycle_state_machine_init(
+    &state_machine, &node, pn, cs, gs, gas, gat, gtg, &state_machine_options);
+  ASSERT_EQ(RCL_RET_OK, ret) << rcl_get_error_string().str;
+  OSRF_TESTING_TOOLS_CPP_SCOPE_EXIT(
+  {
+    EXPECT_EQ(RCL_RET_OK, rcl_lifecycle_state_machine_fini(&state_machine, &node));
+  });
+
+  const lifecycle_msgs__srv__GetAvailableStates_Response * states_response = nullptr;
+  ret = rcl_lifecycle_state_machine_get_available_states_response(nullptr, &states_response);
+  EXPECT_EQ(RCL_RET_INVALID_ARGUMENT, ret);
+  rcutils_reset_error();
+  ret = rcl_lifecycle_state_machine_get_available_states_response(&state_machine, nullptr);
+  EXPECT_EQ(RCL_RET_INVALID_ARGUMENT, ret);
+  rcutils_reset_error();
+
+  ret = rcl_lifecycle_state_machine_get_available_states_response(
+    &state_machine, &states_response);
+  EXPECT_EQ(RCL_RET_OK, ret) << rcl_get_error_string().str;
+  ASSERT_NE(nullptr, states_response);
+  EXPECT_EQ(
+    state_machine.transition_map.states_size, states_response->available_states.size);
+  for (size_t i = 0; i < states_response->available_states.size; ++i) {
+    EXPECT_EQ(
+      state_machine.transition_map.states[i].id,
+      states_response->available_states.data[i].id);
+    EXPECT_STREQ(
+      state_machine.transition_map.states[i].label,
+      states_response->available_states.data[i].label.data);
+  }
+
+  // a second request has to be answered from the cache
+  const lifecycle_msgs__srv__GetAvailableStates_Response * cached_response = nullptr;
+  ret = rcl_lifecycle_state_machine_get_available_states_response(
+    &state_machine, &cached_response);
+  EXPECT_EQ(RCL_RET_OK, ret) << rcl_get_error_string().str;
+  EXPECT_EQ(states_response, cached_response);
+
+  const lifecycle_msgs__srv__GetAvailableTransitions_Response * transitions_response = nullptr;
+  ret = rcl_lifecycle_state_machine_get_available_transitions_response(
+    &state_machine, &transitions_response);
+  EXPECT_EQ(RCL_RET_OK, ret) << rcl_get_error_string().str;
+  ASSERT_NE(nullptr, transitions_response);
+  EXPECT_EQ(
+    state_machine.transition_map.transitions_size,
+    transitions_response->available_transitions.size);
+  for (size_t i = 0; i < transitions_response->available_transitions.size; ++i) {
+    const rcl_lifecycle_transition_t * transition =
+      &state_machine.transition_map.transitions[i];
+    EXPECT_EQ(
+      transition->id, transitions_response->available_transitions.data[i].transition.id);
+    EXPECT_STREQ(
+      transition->label,
+      transitions_response->available_transitions.data[i].transition.label.data);
+    EXPECT_EQ(
+      transition->start->id,
+      transitions_response->available_transitions.data[i].start_state.id);
+    EXPECT_EQ(
+      transition->goal->id,
+      transitions_response->available_transitions.data[i].goal_state.id);
+  }
+
+  const lifecycle_msgs__srv__GetAvailableTransitions_Response * cached_transitions = nullptr;
+  ret = rcl_lifecycle_state_machine_get_available_transitions_response(
+    &state_machine, &cached_transitions);
+  EXPECT_EQ(RCL_RET_OK, ret) << rcl_get_error_string().str;
+  EXPECT_EQ(transitions_response, cached_transitions);
+
+  // registering a new state invalidates the cached states response
+  size_t cached_size = states_response->available_states.size;
+  rcl_lifecycle_state_t custom_state = {"custom", 200, NULL, 0, 0};
+  ret = rcl_lifecycle_register_state(
+    &state_machine.transition_map, custom_state, &state_machine.options.allocator);
+  EXPECT_EQ(RCL_RET_OK, ret) << rcl_get_error_string().str;
+
+  ret = rcl_lifecycle_state_machine_get_available_states_response(
+    &state_machine, &states_response);
+  EXPECT_EQ(RCL_RET_OK, ret) << rcl_get_error_string().str;
+  EXPECT_EQ(cached_size + 1u, states_response->available_states.size);
+  EXPECT_STREQ(
+    "custom",
+    states_response->available_states.data[states_response->available_states.size - 1].label.data);
+}
+
+TEST(TestRclLifecycle, transition_stats) {
+  rcl_lifecycle_state_machine_t state_machine =
+    rcl_lifecycle_get_zero_initialized_state_machine();
+  state_machine.options.enable_com_interface = false;
+  state_machine.options.enable_transition_stats = true;
+  ASSERT_EQ(
+    RCL_RET_OK,
+    rcl_lifecycle_init_default_state_machine(&state_machine, &state_machine.options.allocator));
+
+  rcl_lifecycle_transition_stats_t stats;
+  rcl_ret_t ret = rcl_lifecycle_state_machine_get_transition_stats(
+    nullptr, lifecycle_msgs__msg__Transition__TRANSITION_CONFIGURE, &stats);
+  EXPECT_EQ(RCL_RET_INVALID_ARGUMENT, ret);
+  rcutils_reset_error();
+  ret = rcl_lifecycle_state_machine_get_transition_stats(
+    &state_machine, lifecycle_msgs__msg__Transition__TRANSITION_CONFIGURE, nullptr);
+  EXPECT_EQ(RCL_RET_INVALID_ARGUMENT, ret);
+  rcutils_reset_error();
+
+  // nothing has been triggered yet
+  ret = rcl_lifecycle_state_machine_get_transition_stats(
+    &state_machine, lifecycle_msgs__msg__Transition__TRANSITION_CONFIGURE, &stats);
+  EXPECT_EQ(RCL_RET_ERROR, ret);
+  rcutils_reset_error();
+
+  ret = rcl_lifecycle_trigger_transition_by_id(
+    &state_machine, lifecycle_msgs__msg__Transition__TRANSITION_CONFIGURE, false);
+  EXPECT_EQ(RCL_RET_OK, ret) << rcl_get_error_string().str;
+
+  ret = rcl_lifecycle_state_machine_get_transition_stats(
+    &state_machine, lifecycle_msgs__msg__Transition__TRANSITION_CONFIGURE, &stats);
+  EXPECT_EQ(RCL_RET_OK, ret) << rcl_get_error_string().str;
+  EXPECT_EQ(
+    static_cast<unsigned int>(lifecycle_msgs__msg__Transition__TRANSITION_CONFIGURE),
+    stats.transition_id);
+  EXPECT_EQ(1u, stats.count);
+  EXPECT_EQ(stats.last_duration_ns, stats.max_duration_ns);
+  EXPECT_EQ(stats.last_duration_ns, stats.avg_duration_ns);
+
+  ret = rcl_lifecycle_trigger_transition_by_label(
+    &state_machine, "transition_success", false);
+  EXPECT_EQ(RCL_RET_OK, ret) << rcl_get_error_string().str;
+  ret = rcl_lifecycle_trigger_transition_by_id(
+    &state_machine, lifecycle_msgs__msg__Transition__TRANSITION_CLEANUP, false);
+  EXPECT_EQ(RCL_RET_OK, ret) << rcl_get_error_string().str;
+  ret = rcl_lifecycle_trigger_transition_by_id(
+    &state_machine, lifecycle_msgs__msg__Transition__TRANSITION_CONFIGURE, false);
+  EXPECT_EQ(RCL_RET_OK, ret) << rcl_get_error_string().str;
+
+  ret = rcl_lifecycle_state_machine_get_transition_stats(
+    &state_machine, lifecycle_msgs__msg__Transition__TRANSITION_CONFIGURE, &stats);
+  EXPECT_EQ(RCL_RET_OK, ret) << rcl_get_error_string().str;
+  EXPECT_EQ(2u, stats.count);
+  EXPECT_GE(stats.max_duration_ns, stats.last_duration_ns);
+
+  rcl_lifecycle_transition_stats_t cleanup_stats;
+  ret = rcl_lifecycle_state_machine_get_transition_stats(
+    &state_machine, lifecycle_msgs__msg__Transition__TRANSITION_CLEANUP, &cleanup_stats);
+  EXPECT_EQ(RCL_RET_OK, ret) << rcl_get_error_string().str;
+  EXPECT_EQ(1u, cleanup_stats.count);
+
+  EXPECT_EQ(
+    RCL_RET_OK,
+    rcl_lifecycle_transition_map_fini(
+      &state_machine.transition_map, &state_machine.options.allocator));
+}
@@ -162,3 +162,83 @@ TEST_F(TestTransitionMap, initialized) {
 
   EXPECT_EQ(RCL_RET_OK, rcl_lifecycle_transition_map_fini(&transition_map, &allocator));
 }
+
+TEST_F(TestTransitionMap, reserve) {
+  rcl_lifecycle_transition_map_t transition_map =
+    rcl_lifecycle_get_zero_initialized_transition_map();
+
+  rcl_allocator_t allocator = rcl_get_default_allocator();
+  ASSERT_EQ(
+    RCL_RET_OK, rcl_lifecycle_transition_map_reserve(&transition_map, 2u, 2u, &allocator));
+  EXPECT_EQ(0u, transition_map.states_size);
+  EXPECT_EQ(0u, transition_map.transitions_size);
+
+  // registrations within the reserved capacities must not reallocate
+  rcl_lifecycle_state_t * reserved_states = transition_map.states;
+  rcl_lifecycle_transition_t * reserved_transitions = transition_map.transitions;
+  rcl_lifecycle_state_t state0 = {"my_state_0", 0, NULL, 0, 0};
+  ASSERT_EQ(RCL_RET_OK, rcl_lifecycle_register_state(&transition_map, state0, &allocator));
+  rcl_lifecycle_state_t state1 = {"my_state_1", 1, NULL, 0, 0};
+  ASSERT_EQ(RCL_RET_OK, rcl_lifecycle_register_state(&transition_map, state1, &allocator));
+  EXPECT_EQ(reserved_states, transition_map.states);
+
+  rcl_lifecycle_state_t * start_state = rcl_lifecycle_get_state(&transition_map, state0.id);
+  rcl_lifecycle_state_t * goal_state = rcl_lifecycle_get_state(&transition_map, state1.id);
+  rcl_lifecycle_transition_t transition01 = {"from0to1", 0, start_state, goal_state};
+  ASSERT_EQ(
+    RCL_RET_OK, rcl_lifecycle_register_transition(&transition_map, transition01, &allocator));
+  rcl_lifecycle_transition_t transition10 = {"from1to0", 1, goal_state, start_state};
+  ASSERT_EQ(
+    RCL_RET_OK, rcl_lifecycle_register_transition(&transition_map, transition10, &allocator));
+  EXPECT_EQ(reserved_transitions, transition_map.transitions);
+
+  // reserving less than what is already allocated is a no-op
+  ASSERT_EQ(
+    RCL_RET_OK, rcl_lifecycle_transition_map_reserve(&transition_map, 1u, 1u, &allocator));
+  EXPECT_EQ(reserved_states, transition_map.states);
+  EXPECT_EQ(2u, transition_map.states_size);
+  EXPECT_EQ(2u, transition_map.transitions_size);
+
+  EXPECT_EQ(
+    RCL_RET_INVALID_ARGUMENT,
+    rcl_lifecycle_transition_map_reserve(nullptr, 1u, 1u, &allocator));
+  rcutils_reset_error();
+
+  EXPECT_EQ(RCL_RET_OK, rcl_lifecycle_transition_map_fini(&transition_map, &allocator));
+}
+
+TEST_F(TestTransitionMap, direct_index_fallback) {
+  rcl_lifecycle_transition_map_t transition_map =
+    rcl_lifecycle_get_zero_initialized_transition_map();
+
+  rcl_allocator_t allocator = rcl_get_default_allocator();
+
+  rcl_lifecycle_state_t state0 = {"my_state_0", 0, NULL, 0};
+  ASSERT_EQ(RCL_RET_OK, rcl_lifecycle_register_state(&transition_map, state0, &allocator));
+  rcl_lifecycle_state_t state1 = {"my_state_1", 1, NULL, 0};
+  ASSERT_EQ(RCL_RET_OK, rcl_lifecycle_register_state(&transition_map, state1, &allocator));
+
+  rcl_lifecycle_state_t * start_state = rcl_lifecycle_get_state(&transition_map, state0.id);
+  rcl_lifecycle_state_t * goal_state = rcl_lifecycle_get_state(&transition_map, state1.id);
+  ASSERT_NE(nullptr, start_state);
+  ASSERT_NE(nullptr, goal_state);
+
+  // A transition id beyond the indexable range drops the direct index, so
+  // lookups fall back to scanning and still find every transition
+  rcl_lifecycle_transition_t transition01 = {"from0to1", 0, start_state, goal_state};
+  ASSERT_EQ(
+    RCL_RET_OK, rcl_lifecycle_register_transition(&transition_map, transition01, &allocator));
+  rcl_lifecycle_transition_t big_transition = {"from1to0", 100000u, goal_state, start_state};
+  ASSERT_EQ(
+    RCL_RET_OK, rcl_lifecycle_register_transition(&transition_map, big_transition, &allocator));
+
+  rcl_lifecycle_transition_t * trans = rcl_lifecycle_get_transitions(&transition_map, 0);
+  ASSERT_NE(nullptr, trans);
+  EXPECT_EQ(0u, trans->id);
+  trans = rcl_lifecycle_get_transitions(&transition_map, 100000u);
+  ASSERT_NE(nullptr, trans);
+  EXPECT_EQ(100000u, trans->id);
+  EXPECT_EQ(nullptr, rcl_lifecycle_get_transitions(&transition_map, 5));
+
+  EXPECT_EQ(RCL_RET_OK, rcl_lifecycle_transition_map_fini(&transition_map, &allocator));
+}
@@ -97,6 +97,59 @@ bool rcl_parse_yaml_file(
   const char * file_path,
   rcl_params_t * params_st);
 
+/// \brief Parse the YAML file, keeping only the sections that apply to one node
+/// Sections of nodes other than \p node_fqn are skipped at the YAML event
+/// level, without allocating node, parameter, or value storage for them.
+/// Sections whose name contains a wildcard (`*`) can apply to any node and
+/// are always parsed.
+/// \pre Given \p params_st must be a valid parameter struct
+///   as returned by `rcl_yaml_node_struct_init()`
+/// \param[in] file_path is the path to the YAML file
+/// \param[in] node_fqn is the node name as it appears in the file,
+///   e.g. `/namespace/node_name`
+/// \param[inout] params_st points to the struct to be populated
+/// \return true on success and false on failure
+RCL_YAML_PARAM_PARSER_PUBLIC
+bool rcl_parse_yaml_file_for_node(
+  const char * file_path,
+  const char * node_fqn,
+  rcl_params_t * params_st);
+
+/// \brief Re-parse the YAML file into an already populated \p params_st
+/// The file is parsed into a scratch structure first and then merged:
+/// parameters whose value is unchanged keep their existing allocations
+/// untouched, changed and new values are moved over, and parameters absent
+/// from the file are left alone. Callers serializing access to \p params_st
+/// only need to hold their lock around the merge, not the parse.
+/// \pre Given \p params_st must be a valid parameter struct
+///   as returned by `rcl_yaml_node_struct_init()`
+/// \param[in] file_path is the path to the YAML file
+/// \param[inout] params_st points to the struct to be updated
+/// \param[out] changed_params if not NULL, a zero initialized string array
+///   that receives one `<node_name>.<parameter_name>` entry per changed or
+///   added parameter; the caller finalizes it with `rcutils_string_array_fini()`
+/// \return true on success and false on failure, in which case \p params_st
+///   may hold a partial update
+RCL_YAML_PARAM_PARSER_PUBLIC
+bool rcl_parse_yaml_file_update(
+  const char * file_path,
+  rcl_params_t * params_st,
+  rcutils_string_array_t * changed_params);
+
+/// \brief Compile a YAML file into a binary parameter image
+/// The image records the YAML file's size and modification time; while those
+/// still match, `rcl_parse_yaml_file()` loads the image placed at
+/// `<file_path>.compiled` instead of re-parsing the YAML.
+/// The image is a host-local cache in native endianness, not an interchange
+/// format.
+/// \param[in] yaml_file_path is the path to the YAML file to compile
+/// \param[in] compiled_file_path is the path the binary image is written to
+/// \return true on success and false on failure
+RCL_YAML_PARAM_PARSER_PUBLIC
+bool rcl_yaml_params_compile(
+  const char * yaml_file_path,
+  const char * compiled_file_path);
+
 /// \brief Parse a parameter value as a YAML string, updating params_st accordingly
 /// \param[in] node_name is the name of the node to which the parameter belongs
 /// \param[in] param_name is the name of the parameter whose value will be parsed
@@ -27,6 +27,8 @@ typedef struct rcl_bool_array_s
   bool * values;
   /// Number of values in the array
   size_t size;
+  /// Allocated capacity of values; always >= size
+  size_t capacity;
 } rcl_bool_array_t;
 
 /// Array of int64_t values
@@ -39,6 +41,8 @@ typedef struct rcl_int64_array_s
   int64_t * values;
   /// Number of values in the array
   size_t size;
+  /// Allocated capacity of values; always >= size
+  size_t capacity;
 } rcl_int64_array_t;
 
 /// Array of double values
@@ -51,6 +55,8 @@ typedef struct rcl_double_array_s
   double * values;
   /// Number of values in the array
   size_t size;
+  /// Allocated capacity of values; always >= size
+  size_t capacity;
 } rcl_double_array_t;
 
 /// Array of byte values
@@ -93,6 +99,12 @@ typedef struct rcl_node_params_s
   rcl_variant_t * parameter_values;  ///< Array of coressponding parameter values
   size_t num_params;  ///< Number of parameters in the node
   size_t capacity_params;  ///< Capacity of parameters in the node
+  /// Internal hash index over parameter names, lazily built for
+  /// parameter-heavy nodes; may be NULL.  Buckets hold parameter index + 1,
+  /// 0 marks an empty bucket.
+  size_t * param_index_buckets;
+  size_t param_index_capacity;  ///< Number of buckets in the hash index
+  size_t param_index_num_indexed;  ///< Parameters currently reflected in the index
 } rcl_node_params_t;
 
 /// stores all the parameters of all nodes of a process
@@ -19,27 +19,34 @@
 
 #include "./impl/add_to_arrays.h"
 
-#define ADD_VALUE_TO_SIMPLE_ARRAY(val_array, value, value_type, allocator) \
+/// Initial number of elements reserved when the first value of a sequence arrives
+#define PARAM_ARRAY_INIT_CAPACITY 8U
+
+#define APPEND_TO_SIMPLE_ARRAY(val_array, scalar, value_type, allocator) \
   do { \
-    if (NULL == val_array->values) { \
-      val_array->values = value; \
-      val_array->size = 1; \
-    } else { \
-      /* Increase the array size by one and add the new value */ \
-      value_type * tmp_arr = val_array->values; \
-      val_array->values = allocator.zero_allocate( \
-        val_array->size + 1U, sizeof(value_type), allocator.state); \
-      if (NULL == val_array->values) { \
-        val_array->values = tmp_arr; \
+    if (val_array->size >= val_array->capacity) { \
+      /* Grow geometrically so long sequences don't reallocate per element */ \
+      size_t new_capacity = 2U * val_array->size; \
+      if (new_capacity < PARAM_ARRAY_INIT_CAPACITY) { \
+        new_capacity = PARAM_ARRAY_INIT_CAPACITY; \
+      } \
+      value_type * new_values = allocator.reallocate( \
+        val_array->values, new_capacity * sizeof(value_type), allocator.state); \
+      if (NULL == new_values) { \
         RCUTILS_SAFE_FWRITE_TO_STDERR("Error allocating mem\n"); \
         return RCUTILS_RET_BAD_ALLOC; \
       } \
-      memcpy(val_array->values, tmp_arr, (val_array->size * sizeof(value_type))); \
-      val_array->values[val_array->size] = *value; \
-      val_array->size++; \
-      allocator.deallocate(value, allocator.state); \
-      allocator.deallocate(tmp_arr, allocator.state); \
+      val_array->values = new_values; \
+      val_array->capacity = new_capacity; \
     } \
+    val_array->values[val_array->size] = scalar; \
+    val_array->size++; \
+  } while (0)
+
+#define ADD_VALUE_TO_SIMPLE_ARRAY(val_array, value, value_type, allocator) \
+  do { \
+    APPEND_TO_SIMPLE_ARRAY(val_array, *value, value_type, allocator); \
+    allocator.deallocate(value, allocator.state); \
     return RCUTILS_RET_OK; \
   } while (0)
 
@@ -88,6 +95,38 @@ rcutils_ret_t add_val_to_double_arr(
   ADD_VALUE_TO_SIMPLE_ARRAY(val_array, value, double, allocator);
 }
 
+///
+/// Append an already converted integer to an integer array
+///
+rcutils_ret_t add_int_to_int_arr(
+  rcl_int64_array_t * const val_array,
+  int64_t value,
+  const rcutils_allocator_t allocator)
+{
+  RCUTILS_CHECK_ARGUMENT_FOR_NULL(val_array, RCUTILS_RET_INVALID_ARGUMENT);
+  RCUTILS_CHECK_ALLOCATOR_WITH_MSG(
+    &allocator, "invalid allocator", return RCUTILS_RET_INVALID_ARGUMENT);
+
+  APPEND_TO_SIMPLE_ARRAY(val_array, value, int64_t, allocator);
+  return RCUTILS_RET_OK;
+}
+
+///
+/// Append an already converted double to a double array
+///
+rcutils_ret_t add_double_to_double_arr(
+  rcl_double_array_t * const val_array,
+  double value,
+  const rcutils_allocator_t allocator)
+{
+  RCUTILS_CHECK_ARGUMENT_FOR_NULL(val_array, RCUTILS_RET_INVALID_ARGUMENT);
+  RCUTILS_CHECK_ALLOCATOR_WITH_MSG(
+    &allocator, "invalid allocator", return RCUTILS_RET_INVALID_ARGUMENT);
+
+  APPEND_TO_SIMPLE_ARRAY(val_array, value, double, allocator);
+  return RCUTILS_RET_OK;
+}
+
 ///
 /// Add a value to a string array. Create the array if it does not exist
 ///
@@ -102,21 +141,31 @@ rcutils_ret_t add_val_to_string_arr(
     &allocator, "invalid allocator", return RCUTILS_RET_INVALID_ARGUMENT);
 
   if (NULL == val_array->data) {
-    rcutils_ret_t ret = rcutils_string_array_init(val_array, 1, &allocator);
+    /// Over-allocate up front; size tracks the number of strings actually stored
+    rcutils_ret_t ret = rcutils_string_array_init(
+      val_array, PARAM_ARRAY_INIT_CAPACITY, &allocator);
     if (RCUTILS_RET_OK != ret) {
       return ret;
     }
     val_array->data[0U] = value;
+    val_array->size = 1U;
   } else {
-    /// Increase the array size by one and add the new value
-    char ** new_string_arr_ptr = allocator.reallocate(
-      val_array->data,
-      ((val_array->size + 1U) * sizeof(char *)), allocator.state);
-    if (NULL == new_string_arr_ptr) {
-      RCUTILS_SAFE_FWRITE_TO_STDERR("Error allocating mem\n");
-      return RCUTILS_RET_BAD_ALLOC;
+    /// rcutils_string_array_t has no capacity field, so the allocated length is
+    /// kept implicitly at the largest power of two reached so far (at least
+    /// PARAM_ARRAY_INIT_CAPACITY).  Arrays appended to here are always built
+    /// from empty by this function, so growing only at those boundaries is safe.
+    if (val_array->size >= PARAM_ARRAY_INIT_CAPACITY &&
+      0U == (val_array->size & (val_array->size - 1U)))
+    {
+      char ** new_string_arr_ptr = allocator.reallocate(
+        val_array->data,
+        (2U * val_array->size * sizeof(char *)), allocator.state);
+      if (NULL == new_string_arr_ptr) {
+        RCUTILS_SAFE_FWRITE_TO_STDERR("Error allocating mem\n");
+        return RCUTILS_RET_BAD_ALLOC;
+      }
+      val_array->data = new_string_arr_ptr;
     }
-    val_array->data = new_string_arr_ptr;
     val_array->data[val_array->size] = value;
     val_array->size++;
   }
@@ -0,0 +1,460 @@
+// Copyright 2026 Open Source Robotics Foundation, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+#include <sys/stat.h>
+
+#include "rcutils/allocator.h"
+#include "rcutils/error_handling.h"
+#include "rcutils/types/rcutils_ret.h"
+#include "rcutils/types/string_array.h"
+
+#include "rcl_yaml_param_parser/parser.h"
+#include "rcl_yaml_param_parser/types.h"
+
+#include "./impl/compiled_params.h"
+#include "./impl/parse.h"
+#include "./impl/types.h"
+#include "./impl/yaml_variant.h"
+
+/// The image is a host-local cache, not an interchange format: fields are
+/// written in native endianness and only ever read back on the same machine.
+#define COMPILED_PARAMS_MAGIC "RCLC"
+#define COMPILED_PARAMS_VERSION 1U
+
+/// Sanity caps applied while reading, so a corrupt image can't trigger huge
+/// allocations; anything larger falls back to parsing the YAML file
+#define COMPILED_PARAMS_MAX_STRING_LEN (16U * 1024U * 1024U)
+#define COMPILED_PARAMS_MAX_COUNT (16U * 1024U * 1024U)
+
+typedef enum compiled_value_tag_e
+{
+  COMPILED_VALUE_NONE = 0U,
+  COMPILED_VALUE_BOOL = 1U,
+  COMPILED_VALUE_INT64 = 2U,
+  COMPILED_VALUE_DOUBLE = 3U,
+  COMPILED_VALUE_STRING = 4U,
+  COMPILED_VALUE_BOOL_ARRAY = 5U,
+  COMPILED_VALUE_INT64_ARRAY = 6U,
+  COMPILED_VALUE_DOUBLE_ARRAY = 7U,
+  COMPILED_VALUE_STRING_ARRAY = 8U,
+} compiled_value_tag_t;
+
+static bool get_file_info(const char * path, uint64_t * size, int64_t * mtime)
+{
+  struct stat file_stat;
+  if (0 != stat(path, &file_stat)) {
+    return false;
+  }
+  *size = (uint64_t)file_stat.st_size;
+  *mtime = (int64_t)file_stat.st_mtime;
+  return true;
+}
+
+static bool write_bytes(FILE * out, const void * data, size_t length)
+{
+  return length == fwrite(data, 1U, length, out);
+}
+
+static bool write_u64(FILE * out, uint64_t value)
+{
+  return write_bytes(out, &value, sizeof(value));
+}
+
+static bool write_string(FILE * out, const char * str)
+{
+  const uint64_t length = (uint64_t)strlen(str);
+  return write_u64(out, length) && write_bytes(out, str, (size_t)length);
+}
+
+static bool read_bytes(FILE * in, void * data, size_t length)
+{
+  return length == fread(data, 1U, length, in);
+}
+
+static bool read_u64(FILE * in, uint64_t * value)
+{
+  return read_bytes(in, value, sizeof(*value));
+}
+
+static char * read_string(FILE * in, const rcutils_allocator_t allocator)
+{
+  uint64_t length = 0U;
+  if (!read_u64(in, &length) || length > COMPILED_PARAMS_MAX_STRING_LEN) {
+    return NULL;
+  }
+  char * str = allocator.allocate((size_t)length + 1U, allocator.state);
+  if (NULL == str) {
+    return NULL;
+  }
+  if (!read_bytes(in, str, (size_t)length)) {
+    allocator.deallocate(str, allocator.state);
+    return NULL;
+  }
+  str[length] = '\0';
+  return str;
+}
+
+static bool write_variant(FILE * out, const rcl_variant_t * variant)
+{
+  uint8_t tag = COMPILED_VALUE_NONE;
+  if (NULL != variant->bool_value) {
+    tag = COMPILED_VALUE_BOOL;
+    const uint8_t value = *variant->bool_value ? 1U : 0U;
+    return write_bytes(out, &tag, 1U) && write_bytes(out, &value, 1U);
+  } else if (NULL != variant->integer_value) {
+    tag = COMPILED_VALUE_INT64;
+    return write_bytes(out, &tag, 1U) &&
+           write_bytes(out, variant->integer_value, sizeof(int64_t));
+  } else if (NULL != variant->double_value) {
+    tag = COMPILED_VALUE_DOUBLE;
+    return write_bytes(out, &tag, 1U) &&
+           write_bytes(out, variant->double_value, sizeof(double));
+  } else if (NULL != variant->string_value) {
+    tag = COMPILED_VALUE_STRING;
+    return write_bytes(out, &tag, 1U) && write_string(out, variant->string_value);
+  } else if (NULL != variant->bool_array_value) {
+    tag = COMPILED_VALUE_BOOL_ARRAY;
+    const rcl_bool_array_t * array = variant->bool_array_value;
+    if (!write_bytes(out, &tag, 1U) || !write_u64(out, (uint64_t)array->size)) {
+      return false;
+    }
+    for (size_t i = 0U; i < array->size; ++i) {
+      const uint8_t value = array->values[i] ? 1U : 0U;
+      if (!write_bytes(out, &value, 1U)) {
+        return false;
+      }
+    }
+    return true;
+  } else if (NULL != variant->integer_array_value) {
+    tag = COMPILED_VALUE_INT64_ARRAY;
+    const rcl_int64_array_t * array = variant->integer_array_value;
+    return write_bytes(out, &tag, 1U) && write_u64(out, (uint64_t)array->size) &&
+           write_bytes(out, array->values, array->size * sizeof(int64_t));
+  } else if (NULL != variant->double_array_value) {
+    tag = COMPILED_VALUE_DOUBLE_ARRAY;
+    const rcl_double_array_t * array = variant->double_array_value;
+    return write_bytes(out, &tag, 1U) && write_u64(out, (uint64_t)array->size) &&
+           write_bytes(out, array->values, array->size * sizeof(double));
+  } else if (NULL != variant->string_array_value) {
+    tag = COMPILED_VALUE_STRING_ARRAY;
+    const rcutils_string_array_t * array = variant->string_array_value;
+    if (!write_bytes(out, &tag, 1U) || !write_u64(out, (uint64_t)array->size)) {
+      return false;
+    }
+    for (size_t i = 0U; i < array->size; ++i) {
+      if (!write_string(out, array->data[i])) {
+        return false;
+      }
+    }
+    return true;
+  }
+  /// Parameter exists but no value was ever assigned
+  return write_bytes(out, &tag, 1U);
+}
+
+#define READ_SIMPLE_ARRAY_VALUE(variant, field, array_type, value_type) \
+  do { \
+    uint64_t count = 0U; \
+    if (!read_u64(in, &count) || count > COMPILED_PARAMS_MAX_COUNT) { \
+      return false; \
+    } \
+    array_type * array = allocator.zero_allocate( \
+      1U, sizeof(array_type), allocator.state); \
+    if (NULL == array) { \
+      return false; \
+    } \
+    variant->field = array; \
+    if (count > 0U) { \
+      array->values = allocator.allocate( \
+        (size_t)count * sizeof(value_type), allocator.state); \
+      if (NULL == array->values) { \
+        return false; \
+      } \
+      if (!read_bytes(in, array->values, (size_t)count * sizeof(value_type))) { \
+        return false; \
+      } \
+      array->size = (size_t)count; \
+      array->capacity = (size_t)count; \
+    } \
+  } while (0)
+
+/// On failure the variant is left with whatever was populated so far; the
+/// caller finalizes the whole parameter struct through the usual fini path.
+static bool read_variant(
+  FILE * in, rcl_variant_t * variant, const rcutils_allocator_t allocator)
+{
+  uint8_t tag = COMPILED_VALUE_NONE;
+  if (!read_bytes(in, &tag, 1U)) {
+    return false;
+  }
+  switch (tag) {
+    case COMPILED_VALUE_NONE:
+      return true;
+    case COMPILED_VALUE_BOOL:
+      {
+        uint8_t value = 0U;
+        if (!read_bytes(in, &value, 1U)) {
+          return false;
+        }
+        variant->bool_value = allocator.allocate(sizeof(bool), allocator.state);
+        if (NULL == variant->bool_value) {
+          return false;
+        }
+        *variant->bool_value = (0U != value);
+        return true;
+      }
+    case COMPILED_VALUE_INT64:
+      variant->integer_value = allocator.allocate(sizeof(int64_t), allocator.state);
+      return NULL != variant->integer_value &&
+             read_bytes(in, variant->integer_value, sizeof(int64_t));
+    case COMPILED_VALUE_DOUBLE:
+      variant->double_value = allocator.allocate(sizeof(double), allocator.state);
+      return NULL != variant->double_value &&
+             read_bytes(in, variant->double_value, sizeof(double));
+    case COMPILED_VALUE_STRING:
+      variant->string_value = read_string(in, allocator);
+      return NULL != variant->string_value;
+    case COMPILED_VALUE_BOOL_ARRAY:
+      {
+        uint64_t count = 0U;
+        if (!read_u64(in, &count) || count > COMPILED_PARAMS_MAX_COUNT) {
+          return false;
+        }
+        rcl_bool_array_t * array = allocator.zero_allocate(
+          1U, sizeof(rcl_bool_array_t), allocator.state);
+        if (NULL == array) {
+          return false;
+        }
+        variant->bool_array_value = array;
+        if (count > 0U) {
+          array->values = allocator.allocate(
+            (size_t)count * sizeof(bool), allocator.state);
+          if (NULL == array->values) {
+            return false;
+          }
+          for (uint64_t i = 0U; i < count; ++i) {
+            uint8_t value = 0U;
+            if (!read_bytes(in, &value, 1U)) {
+              return false;
+            }
+            array->values[i] = (0U != value);
+            array->size = (size_t)(i + 1U);
+          }
+          array->capacity = (size_t)count;
+        }
+        return true;
+      }
+    case COMPILED_VALUE_INT64_ARRAY:
+      READ_SIMPLE_ARRAY_VALUE(variant, integer_array_value, rcl_int64_array_t, int64_t);
+      return true;
+    case COMPILED_VALUE_DOUBLE_ARRAY:
+      READ_SIMPLE_ARRAY_VALUE(variant, double_array_value, rcl_double_array_t, double);
+      return true;
+    case COMPILED_VALUE_STRING_ARRAY:
+      {
+        uint64_t count = 0U;
+        if (!read_u64(in, &count) || count > COMPILED_PARAMS_MAX_COUNT) {
+          return false;
+        }
+        rcutils_string_array_t * array = allocator.allocate(
+          sizeof(rcutils_string_array_t), allocator.state);
+        if (NULL == array) {
+          return false;
+        }
+        *array = rcutils_get_zero_initialized_string_array();
+        variant->string_array_value = array;
+        if (count > 0U) {
+          rcutils_allocator_t string_allocator = allocator;
+          if (RCUTILS_RET_OK !=
+            rcutils_string_array_init(array, (size_t)count, &string_allocator))
+          {
+            return false;
+          }
+          for (uint64_t i = 0U; i < count; ++i) {
+            array->data[i] = read_string(in, allocator);
+            if (NULL == array->data[i]) {
+              return false;
+            }
+          }
+        }
+        return true;
+      }
+    default:
+      return false;
+  }
+}
+
+static bool write_compiled_image(
+  FILE * out, const rcl_params_t * params_st,
+  uint64_t source_size, int64_t source_mtime)
+{
+  const uint32_t version = COMPILED_PARAMS_VERSION;
+  if (!write_bytes(out, COMPILED_PARAMS_MAGIC, 4U) ||
+    !write_bytes(out, &version, sizeof(version)) ||
+    !write_u64(out, source_size) ||
+    !write_bytes(out, &source_mtime, sizeof(source_mtime)) ||
+    !write_u64(out, (uint64_t)params_st->num_nodes))
+  {
+    return false;
+  }
+  for (size_t node_idx = 0U; node_idx < params_st->num_nodes; ++node_idx) {
+    const rcl_node_params_t * node_params = &(params_st->params[node_idx]);
+    if (!write_string(out, params_st->node_names[node_idx]) ||
+      !write_u64(out, (uint64_t)node_params->num_params))
+    {
+      return false;
+    }
+    for (size_t parameter_idx = 0U; parameter_idx < node_params->num_params; ++parameter_idx) {
+      if (!write_string(out, node_params->parameter_names[parameter_idx]) ||
+        !write_variant(out, &(node_params->parameter_values[parameter_idx])))
+      {
+        return false;
+      }
+    }
+  }
+  return true;
+}
+
+bool rcl_yaml_params_compile(
+  const char * yaml_file_path,
+  const char * compiled_file_path)
+{
+  RCUTILS_CHECK_ARGUMENT_FOR_NULL(yaml_file_path, false);
+  RCUTILS_CHECK_ARGUMENT_FOR_NULL(compiled_file_path, false);
+
+  uint64_t source_size = 0U;
+  int64_t source_mtime = 0;
+  if (!get_file_info(yaml_file_path, &source_size, &source_mtime)) {
+    RCUTILS_SET_ERROR_MSG("Error getting YAML file info");
+    return false;
+  }
+
+  rcutils_allocator_t allocator = rcutils_get_default_allocator();
+  rcl_params_t * params_st = rcl_yaml_node_struct_init(allocator);
+  if (NULL == params_st) {
+    return false;
+  }
+  if (!rcl_parse_yaml_file(yaml_file_path, params_st)) {
+    rcl_yaml_node_struct_fini(params_st);
+    // error already set
+    return false;
+  }
+
+  FILE * out = fopen(compiled_file_path, "wb");
+  if (NULL == out) {
+    rcl_yaml_node_struct_fini(params_st);
+    RCUTILS_SET_ERROR_MSG("Error opening compiled parameter file for writing");
+    return false;
+  }
+  const bool ok = write_compiled_image(out, params_st, source_size, source_mtime);
+  fclose(out);
+  rcl_yaml_node_struct_fini(params_st);
+  if (!ok) {
+    remove(compiled_file_path);
+    RCUTILS_SET_ERROR_MSG("Error writing compiled parameter file");
+  }
+  return ok;
+}
+
+bool rcl_yaml_params_load_compiled(
+  const char * yaml_file_path,
+  rcl_params_t * params_st)
+{
+  if (NULL == yaml_file_path || NULL == params_st) {
+    return false;
+  }
+  rcutils_allocator_t allocator = params_st->allocator;
+
+  uint64_t source_size = 0U;
+  int64_t source_mtime = 0;
+  if (!get_file_info(yaml_file_path, &source_size, &source_mtime)) {
+    return false;
+  }
+
+  const size_t path_len =
+    strlen(yaml_file_path) + strlen(RCL_YAML_COMPILED_PARAMS_SUFFIX) + 1U;
+  char * compiled_path = allocator.allocate(path_len, allocator.state);
+  if (NULL == compiled_path) {
+    return false;
+  }
+  snprintf(
+    compiled_path, path_len, "%s%s", yaml_file_path, RCL_YAML_COMPILED_PARAMS_SUFFIX);
+  FILE * in = fopen(compiled_path, "rb");
+  allocator.deallocate(compiled_path, allocator.state);
+  if (NULL == in) {
+    return false;
+  }
+
+  bool ok = false;
+  char magic[4];
+  uint32_t version = 0U;
+  uint64_t image_source_size = 0U;
+  int64_t image_source_mtime = 0;
+  uint64_t num_nodes = 0U;
+  if (read_bytes(in, magic, 4U) &&
+    0 == memcmp(magic, COMPILED_PARAMS_MAGIC, 4U) &&
+    read_bytes(in, &version, sizeof(version)) &&
+    COMPILED_PARAMS_VERSION == version &&
+    read_u64(in, &image_source_size) &&
+    image_source_size == source_size &&
+    read_bytes(in, &image_source_mtime, sizeof(image_source_mtime)) &&
+    image_source_mtime == source_mtime &&
+    read_u64(in, &num_nodes) &&
+    num_nodes <= COMPILED_PARAMS_MAX_COUNT)
+  {
+    /// A truncated image can leave behind the entries read so far, but they
+    /// were compiled from this exact YAML file, so the fallback parse simply
+    /// overwrites them with identical values.
+    ok = true;
+    for (uint64_t i = 0U; ok && i < num_nodes; ++i) {
+      char * node_name = read_string(in, allocator);
+      if (NULL == node_name) {
+        ok = false;
+        break;
+      }
+      size_t node_idx = 0U;
+      ok = RCUTILS_RET_OK == find_node(node_name, params_st, &node_idx);
+      allocator.deallocate(node_name, allocator.state);
+      uint64_t num_params = 0U;
+      if (!ok || !read_u64(in, &num_params) || num_params > COMPILED_PARAMS_MAX_COUNT) {
+        ok = false;
+        break;
+      }
+      for (uint64_t j = 0U; ok && j < num_params; ++j) {
+        char * param_name = read_string(in, allocator);
+        if (NULL == param_name) {
+          ok = false;
+          break;
+        }
+        size_t parameter_idx = 0U;
+        ok = RCUTILS_RET_OK ==
+          find_parameter(node_idx, param_name, params_st, &parameter_idx);
+        allocator.deallocate(param_name, allocator.state);
+        if (ok) {
+          rcl_variant_t * variant =
+            &(params_st->params[node_idx].parameter_values[parameter_idx]);
+          rcl_yaml_variant_fini(variant, allocator);
+          memset(variant, 0, sizeof(rcl_variant_t));
+          ok = read_variant(in, variant, allocator);
+        }
+      }
+    }
+  }
+  fclose(in);
+  return ok;
+}
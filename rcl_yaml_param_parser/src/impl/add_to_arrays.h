@@ -59,6 +59,28 @@ rcutils_ret_t add_val_to_double_arr(
   double * value,
   const rcutils_allocator_t allocator);
 
+///
+/// Append an already converted integer, without the per-element heap
+/// round-trip of add_val_to_int_arr
+///
+RCL_YAML_PARAM_PARSER_PUBLIC
+RCUTILS_WARN_UNUSED
+rcutils_ret_t add_int_to_int_arr(
+  rcl_int64_array_t * const val_array,
+  int64_t value,
+  const rcutils_allocator_t allocator);
+
+///
+/// Append an already converted double, without the per-element heap
+/// round-trip of add_val_to_double_arr
+///
+RCL_YAML_PARAM_PARSER_PUBLIC
+RCUTILS_WARN_UNUSED
+rcutils_ret_t add_double_to_double_arr(
+  rcl_double_array_t * const val_array,
+  double value,
+  const rcutils_allocator_t allocator);
+
 ///
 /// Add a value to a string array. Create the array if it does not exist
 ///
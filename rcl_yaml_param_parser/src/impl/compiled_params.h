@@ -0,0 +1,49 @@
+// Copyright 2026 Open Source Robotics Foundation, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef IMPL__COMPILED_PARAMS_H_
+#define IMPL__COMPILED_PARAMS_H_
+
+#include <stdbool.h>
+
+#include "rcutils/macros.h"
+
+#include "rcl_yaml_param_parser/types.h"
+#include "rcl_yaml_param_parser/visibility_control.h"
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+/// Suffix appended to a YAML file path to locate its compiled image
+#define RCL_YAML_COMPILED_PARAMS_SUFFIX ".compiled"
+
+///
+/// Populate params_st from the compiled image next to yaml_file_path, if one
+/// exists and still matches the YAML file's size and modification time.
+/// Returns false on any mismatch or read error, in which case the caller
+/// should parse the YAML file normally.
+///
+RCL_YAML_PARAM_PARSER_PUBLIC
+RCUTILS_WARN_UNUSED
+bool rcl_yaml_params_load_compiled(
+  const char * yaml_file_path,
+  rcl_params_t * params_st);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif  // IMPL__COMPILED_PARAMS_H_
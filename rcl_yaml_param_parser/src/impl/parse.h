@@ -67,6 +67,14 @@ rcutils_ret_t parse_file_events(
   namespace_tracker_t * ns_tracker,
   rcl_params_t * params_st);
 
+RCL_YAML_PARAM_PARSER_PUBLIC
+RCUTILS_WARN_UNUSED
+rcutils_ret_t parse_file_events_filtered(
+  yaml_parser_t * parser,
+  namespace_tracker_t * ns_tracker,
+  const char * node_fqn,
+  rcl_params_t * params_st);
+
 RCL_YAML_PARAM_PARSER_PUBLIC
 RCUTILS_WARN_UNUSED
 rcutils_ret_t parse_value_events(
@@ -59,8 +59,13 @@ typedef struct namespace_tracker_s
 {
   char * node_ns;
   uint32_t num_node_ns;
+  /// Allocated size of node_ns; 0 means the buffer, if any, is assumed to be
+  /// exactly strlen(node_ns) + 1 bytes
+  size_t node_ns_capacity;
   char * parameter_ns;
   uint32_t num_parameter_ns;
+  /// Allocated size of parameter_ns; same convention as node_ns_capacity
+  size_t parameter_ns_capacity;
 } namespace_tracker_t;
 
 #ifdef __cplusplus
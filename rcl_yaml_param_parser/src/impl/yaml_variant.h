@@ -35,6 +35,23 @@ void rcl_yaml_variant_fini(
   rcl_variant_t * param_var,
   const rcutils_allocator_t allocator);
 
+///
+/// Release the growth slack left behind by sequence parsing, trimming each
+/// array value down to its exact size
+///
+RCL_YAML_PARAM_PARSER_PUBLIC
+void rcl_yaml_variant_shrink_to_fit(
+  rcl_variant_t * param_var,
+  const rcutils_allocator_t allocator);
+
+///
+/// Check whether two rcl_yaml_variant_t hold the same value
+///
+RCL_YAML_PARAM_PARSER_PUBLIC
+RCUTILS_WARN_UNUSED
+bool rcl_yaml_variant_equal(
+  const rcl_variant_t * param_var, const rcl_variant_t * other_param_var);
+
 ///
 /// Copy a yaml_variant_t from param_var to out_param_var
 ///
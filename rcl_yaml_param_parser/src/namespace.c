@@ -22,6 +22,42 @@
 #include "rcutils/strdup.h"
 #include "rcutils/types/rcutils_ret.h"
 
+/// Smallest buffer allocated for a composed namespace string
+#define NS_MIN_CAPACITY 64U
+
+///
+/// Grow the namespace buffer geometrically so composing deeply nested
+/// namespaces doesn't reallocate on every appended name
+///
+static rcutils_ret_t ensure_ns_capacity(
+  char ** cur_ns,
+  size_t * cur_capacity,
+  size_t cur_len,
+  size_t needed,
+  rcutils_allocator_t allocator)
+{
+  /// A capacity of 0 means the buffer came from elsewhere (e.g. strdup) and
+  /// is assumed to hold exactly the current string
+  size_t capacity = (0U != *cur_capacity) ? *cur_capacity : (cur_len + 1U);
+  if (needed <= capacity && 0U != *cur_capacity) {
+    return RCUTILS_RET_OK;
+  }
+  size_t new_capacity = 2U * capacity;
+  if (new_capacity < needed) {
+    new_capacity = needed;
+  }
+  if (new_capacity < NS_MIN_CAPACITY) {
+    new_capacity = NS_MIN_CAPACITY;
+  }
+  char * tmp_ns_ptr = allocator.reallocate(*cur_ns, new_capacity, allocator.state);
+  if (NULL == tmp_ns_ptr) {
+    return RCUTILS_RET_BAD_ALLOC;
+  }
+  *cur_ns = tmp_ns_ptr;
+  *cur_capacity = new_capacity;
+  return RCUTILS_RET_OK;
+}
+
 rcutils_ret_t add_name_to_ns(
   namespace_tracker_t * ns_tracker,
   const char * name,
@@ -30,6 +66,7 @@ rcutils_ret_t add_name_to_ns(
 {
   char * cur_ns;
   uint32_t * cur_count;
+  size_t * cur_capacity;
   char * sep_str;
   size_t name_len;
   size_t ns_len;
@@ -40,11 +77,13 @@ rcutils_ret_t add_name_to_ns(
     case NS_TYPE_NODE:
       cur_ns = ns_tracker->node_ns;
       cur_count = &(ns_tracker->num_node_ns);
+      cur_capacity = &(ns_tracker->node_ns_capacity);
       sep_str = NODE_NS_SEPERATOR;
       break;
     case NS_TYPE_PARAM:
       cur_ns = ns_tracker->parameter_ns;
       cur_count = &(ns_tracker->num_parameter_ns);
+      cur_capacity = &(ns_tracker->parameter_ns_capacity);
       sep_str = PARAMETER_NS_SEPERATOR;
       break;
     default:
@@ -56,10 +95,16 @@ rcutils_ret_t add_name_to_ns(
     return RCUTILS_RET_INVALID_ARGUMENT;
   }
   if (0U == *cur_count) {
-    cur_ns = rcutils_strdup(name, allocator);
+    name_len = strlen(name);
     if (NULL == cur_ns) {
-      return RCUTILS_RET_BAD_ALLOC;
+      *cur_capacity = 0U;
+    }
+    rcutils_ret_t ret = ensure_ns_capacity(
+      &cur_ns, cur_capacity, 0U, name_len + 1U, allocator);
+    if (RCUTILS_RET_OK != ret) {
+      return ret;
     }
+    memcpy(cur_ns, name, name_len + 1U);
   } else {
     ns_len = strlen(cur_ns);
     name_len = strlen(name);
@@ -73,11 +118,11 @@ rcutils_ret_t add_name_to_ns(
 
     tot_len = ns_len + sep_len + name_len + 1U;
 
-    char * tmp_ns_ptr = allocator.reallocate(cur_ns, tot_len, allocator.state);
-    if (NULL == tmp_ns_ptr) {
-      return RCUTILS_RET_BAD_ALLOC;
+    rcutils_ret_t ret = ensure_ns_capacity(
+      &cur_ns, cur_capacity, ns_len, tot_len, allocator);
+    if (RCUTILS_RET_OK != ret) {
+      return ret;
     }
-    cur_ns = tmp_ns_ptr;
     memcpy((cur_ns + ns_len), sep_str, sep_len);
     memcpy((cur_ns + ns_len + sep_len), name, name_len);
     cur_ns[tot_len - 1U] = '\0';
@@ -103,15 +148,18 @@ rcutils_ret_t rem_name_from_ns(
   size_t ns_len;
   size_t tot_len;
 
+  size_t * cur_capacity;
   switch (namespace_type) {
     case NS_TYPE_NODE:
       cur_ns = ns_tracker->node_ns;
       cur_count = &(ns_tracker->num_node_ns);
+      cur_capacity = &(ns_tracker->node_ns_capacity);
       sep_str = NODE_NS_SEPERATOR;
       break;
     case NS_TYPE_PARAM:
       cur_ns = ns_tracker->parameter_ns;
       cur_count = &(ns_tracker->num_parameter_ns);
+      cur_capacity = &(ns_tracker->parameter_ns_capacity);
       sep_str = PARAMETER_NS_SEPERATOR;
       break;
     default:
@@ -123,6 +171,7 @@ rcutils_ret_t rem_name_from_ns(
     if (1U == *cur_count) {
       allocator.deallocate(cur_ns, allocator.state);
       cur_ns = NULL;
+      *cur_capacity = 0U;
     } else {
       ns_len = strlen(cur_ns);
       char * last_idx = NULL;
@@ -140,12 +189,8 @@ rcutils_ret_t rem_name_from_ns(
         next_str = strstr(next_str, sep_str);
       }
       if (NULL != last_idx) {
+        /// Truncate in place; the slack is reused by the next appended name
         tot_len = ((size_t)(last_idx - cur_ns) + 1U);
-        char * tmp_ns_ptr = allocator.reallocate(cur_ns, tot_len, allocator.state);
-        if (NULL == tmp_ns_ptr) {
-          return RCUTILS_RET_BAD_ALLOC;
-        }
-        cur_ns = tmp_ns_ptr;
         cur_ns[tot_len - 1U] = '\0';
       }
     }
@@ -168,25 +213,42 @@ rcutils_ret_t replace_ns(
 {
   rcutils_ret_t res = RCUTILS_RET_OK;
 
-  /// Remove the old namespace and point to the new namespace
+  const size_t new_ns_len = strlen(new_ns);
+
+  /// Remove the old namespace and point to the new namespace, reusing the
+  /// existing buffer whenever it is known to be large enough
   switch (namespace_type) {
     case NS_TYPE_NODE:
-      if (NULL != ns_tracker->node_ns) {
-        allocator.deallocate(ns_tracker->node_ns, allocator.state);
-      }
-      ns_tracker->node_ns = rcutils_strdup(new_ns, allocator);
-      if (NULL == ns_tracker->node_ns) {
-        return RCUTILS_RET_BAD_ALLOC;
+      if (NULL != ns_tracker->node_ns &&
+        ns_tracker->node_ns_capacity >= (new_ns_len + 1U))
+      {
+        memcpy(ns_tracker->node_ns, new_ns, new_ns_len + 1U);
+      } else {
+        if (NULL != ns_tracker->node_ns) {
+          allocator.deallocate(ns_tracker->node_ns, allocator.state);
+        }
+        ns_tracker->node_ns = rcutils_strdup(new_ns, allocator);
+        ns_tracker->node_ns_capacity = 0U;
+        if (NULL == ns_tracker->node_ns) {
+          return RCUTILS_RET_BAD_ALLOC;
+        }
       }
       ns_tracker->num_node_ns = new_ns_count;
       break;
     case NS_TYPE_PARAM:
-      if (NULL != ns_tracker->parameter_ns) {
-        allocator.deallocate(ns_tracker->parameter_ns, allocator.state);
-      }
-      ns_tracker->parameter_ns = rcutils_strdup(new_ns, allocator);
-      if (NULL == ns_tracker->parameter_ns) {
-        return RCUTILS_RET_BAD_ALLOC;
+      if (NULL != ns_tracker->parameter_ns &&
+        ns_tracker->parameter_ns_capacity >= (new_ns_len + 1U))
+      {
+        memcpy(ns_tracker->parameter_ns, new_ns, new_ns_len + 1U);
+      } else {
+        if (NULL != ns_tracker->parameter_ns) {
+          allocator.deallocate(ns_tracker->parameter_ns, allocator.state);
+        }
+        ns_tracker->parameter_ns = rcutils_strdup(new_ns, allocator);
+        ns_tracker->parameter_ns_capacity = 0U;
+        if (NULL == ns_tracker->parameter_ns) {
+          return RCUTILS_RET_BAD_ALLOC;
+        }
       }
       ns_tracker->num_parameter_ns = new_ns_count;
       break;
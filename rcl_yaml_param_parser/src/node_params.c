@@ -62,6 +62,9 @@ rcutils_ret_t node_params_init_with_capacity(
 
   node_params->num_params = 0U;
   node_params->capacity_params = capacity;
+  node_params->param_index_buckets = NULL;
+  node_params->param_index_capacity = 0U;
+  node_params->param_index_num_indexed = 0U;
   return RCUTILS_RET_OK;
 }
 
@@ -146,6 +149,13 @@ void rcl_yaml_node_params_fini(
     node_params_st->parameter_values = NULL;
   }
 
+  if (NULL != node_params_st->param_index_buckets) {
+    allocator.deallocate(node_params_st->param_index_buckets, allocator.state);
+    node_params_st->param_index_buckets = NULL;
+  }
+  node_params_st->param_index_capacity = 0U;
+  node_params_st->param_index_num_indexed = 0U;
+
   node_params_st->num_params = 0;
   node_params_st->capacity_params = 0;
 }
@@ -72,6 +72,63 @@ RCL_YAML_PARAM_PARSER_LOCAL
 rcutils_ret_t
 _validate_name(const char * name, rcutils_allocator_t allocator);
 
+/// Character-class summary of an unquoted scalar, gathered in one pass
+typedef enum scalar_class_e
+{
+  /// Needs the full literal ladder (bool literals, .inf/.nan, 0x..., strings)
+  SCALAR_CLASS_OTHER = 0,
+  /// Optional sign followed by decimal digits only
+  SCALAR_CLASS_INT,
+  /// Optional sign with digits and a dot and/or exponent
+  SCALAR_CLASS_FLOAT,
+} scalar_class_t;
+
+///
+/// Classify a scalar by its byte pattern so the converters that cannot match
+/// it are skipped; anything unusual falls back to SCALAR_CLASS_OTHER, which
+/// takes the unabridged path
+///
+static scalar_class_t classify_scalar(const char * value)
+{
+  const char * str = value;
+  if (('+' == *str) || ('-' == *str)) {
+    str++;
+  }
+  if ('\0' == *str) {
+    return SCALAR_CLASS_OTHER;
+  }
+  /// Leave hex/octal/binary prefixes to strtol with base detection
+  if (('0' == str[0]) && (('x' == str[1]) || ('X' == str[1]))) {
+    return SCALAR_CLASS_OTHER;
+  }
+  bool has_digit = false;
+  bool has_dot = false;
+  bool has_exp = false;
+  for (; '\0' != *str; ++str) {
+    const char c = *str;
+    if ((c >= '0') && (c <= '9')) {
+      has_digit = true;
+      continue;
+    }
+    if (('.' == c) && !has_dot && !has_exp) {
+      has_dot = true;
+      continue;
+    }
+    if ((('e' == c) || ('E' == c)) && has_digit && !has_exp) {
+      has_exp = true;
+      if (('+' == str[1]) || ('-' == str[1])) {
+        ++str;
+      }
+      continue;
+    }
+    return SCALAR_CLASS_OTHER;
+  }
+  if (!has_digit) {
+    return SCALAR_CLASS_OTHER;
+  }
+  return (has_dot || has_exp) ? SCALAR_CLASS_FLOAT : SCALAR_CLASS_INT;
+}
+
 ///
 /// Determine the type of the value and return the converted value
 /// NOTE: Only canonical forms supported as of now
@@ -99,9 +156,18 @@ void * get_value(
     return rcutils_strdup(value, allocator);
   }
 
-  /// Check if it is bool
+  /// One pass over the bytes decides which converters can possibly apply
+  scalar_class_t scalar_class = SCALAR_CLASS_OTHER;
   if (style != YAML_SINGLE_QUOTED_SCALAR_STYLE &&
     style != YAML_DOUBLE_QUOTED_SCALAR_STYLE)
+  {
+    scalar_class = classify_scalar(value);
+  }
+
+  /// Check if it is bool
+  if (style != YAML_SINGLE_QUOTED_SCALAR_STYLE &&
+    style != YAML_DOUBLE_QUOTED_SCALAR_STYLE &&
+    SCALAR_CLASS_OTHER == scalar_class)
   {
     if ((0 == strcmp(value, "Y")) ||
       (0 == strcmp(value, "y")) ||
@@ -146,9 +212,10 @@ void * get_value(
     }
   }
 
-  /// Check for int
+  /// Check for int; a scalar classified as a float can never consume fully
   if (style != YAML_SINGLE_QUOTED_SCALAR_STYLE &&
-    style != YAML_DOUBLE_QUOTED_SCALAR_STYLE)
+    style != YAML_DOUBLE_QUOTED_SCALAR_STYLE &&
+    SCALAR_CLASS_FLOAT != scalar_class)
   {
     errno = 0;
     ival = strtol(value, &endptr, 0);
@@ -174,7 +241,8 @@ void * get_value(
     errno = 0;
     endptr = NULL;
     const char * iter_ptr = NULL;
-    if ((0 == strcmp(value, ".nan")) ||
+    if (SCALAR_CLASS_OTHER == scalar_class &&
+      ((0 == strcmp(value, ".nan")) ||
       (0 == strcmp(value, ".NaN")) ||
       (0 == strcmp(value, ".NAN")) ||
       (0 == strcmp(value, ".inf")) ||
@@ -185,7 +253,7 @@ void * get_value(
       (0 == strcmp(value, "+.INF")) ||
       (0 == strcmp(value, "-.inf")) ||
       (0 == strcmp(value, "-.Inf")) ||
-      (0 == strcmp(value, "-.INF")))
+      (0 == strcmp(value, "-.INF"))))
     {
       for (iter_ptr = value; !isalpha(*iter_ptr); ) {
         iter_ptr += 1;
@@ -266,6 +334,37 @@ rcutils_ret_t parse_value(
 
   rcl_variant_t * param_value = &(params_st->params[node_idx].parameter_values[parameter_idx]);
 
+  /// Elements of homogeneous numeric sequences convert straight into the
+  /// typed array, skipping the per-element scalar allocation of get_value();
+  /// anything that doesn't convert cleanly falls through to the full path
+  if (is_seq && NULL == tag &&
+    style != YAML_SINGLE_QUOTED_SCALAR_STYLE &&
+    style != YAML_DOUBLE_QUOTED_SCALAR_STYLE)
+  {
+    if (DATA_TYPE_INT64 == *seq_data_type &&
+      NULL != param_value->integer_array_value &&
+      SCALAR_CLASS_INT == classify_scalar(value))
+    {
+      errno = 0;
+      char * endptr = NULL;
+      const int64_t int_value = strtol(value, &endptr, 0);
+      if ((0 == errno) && (NULL != endptr) && (endptr != value) && ('\0' == *endptr)) {
+        return add_int_to_int_arr(param_value->integer_array_value, int_value, allocator);
+      }
+    } else if (DATA_TYPE_DOUBLE == *seq_data_type &&
+      NULL != param_value->double_array_value &&
+      SCALAR_CLASS_FLOAT == classify_scalar(value))
+    {
+      errno = 0;
+      char * endptr = NULL;
+      const double double_value = strtod(value, &endptr);
+      if ((0 == errno) && (NULL != endptr) && (endptr != value) && ('\0' == *endptr)) {
+        return add_double_to_double_arr(
+          param_value->double_array_value, double_value, allocator);
+      }
+    }
+  }
+
   data_types_t val_type;
   void * ret_val = get_value(value, style, tag, &val_type, allocator);
   if (NULL == ret_val) {
@@ -735,6 +834,8 @@ rcutils_ret_t parse_key(
               params_st->params[*node_idx].parameter_names[*parameter_idx], allocator.state);
           }
           params_st->params[*node_idx].parameter_names[*parameter_idx] = param_name;
+          // the name under this index changed, force an index rebuild
+          params_st->params[*node_idx].param_index_num_indexed = 0U;
         }
       }
       break;
@@ -746,6 +847,47 @@ rcutils_ret_t parse_key(
   return ret;
 }
 
+///
+/// Consume the value following a key (scalar, sequence, or mapping) without
+/// processing it, leaving the parser positioned after the value's subtree
+///
+static rcutils_ret_t skip_value_events(yaml_parser_t * parser, uint32_t * line_num)
+{
+  uint32_t depth = 0U;
+  do {
+    yaml_event_t event;
+    if (0 == yaml_parser_parse(parser, &event)) {
+      RCUTILS_SET_ERROR_MSG_WITH_FORMAT_STRING(
+        "Error parsing a event near line %d", *line_num);
+      return RCUTILS_RET_ERROR;
+    }
+    *line_num = ((uint32_t)(event.start_mark.line) + 1U);
+    const yaml_event_type_t event_type = event.type;
+    yaml_event_delete(&event);
+    switch (event_type) {
+      case YAML_MAPPING_START_EVENT:
+      case YAML_SEQUENCE_START_EVENT:
+        depth++;
+        break;
+      case YAML_MAPPING_END_EVENT:
+      case YAML_SEQUENCE_END_EVENT:
+        depth--;
+        break;
+      case YAML_SCALAR_EVENT:
+        break;
+      case YAML_ALIAS_EVENT:
+        RCUTILS_SET_ERROR_MSG_WITH_FORMAT_STRING(
+          "Will not support aliasing at line %d\n", *line_num);
+        return RCUTILS_RET_ERROR;
+      default:
+        RCUTILS_SET_ERROR_MSG_WITH_FORMAT_STRING(
+          "Unexpected YAML event while skipping a node section at line %d", *line_num);
+        return RCUTILS_RET_ERROR;
+    }
+  } while (depth > 0U);
+  return RCUTILS_RET_OK;
+}
+
 ///
 /// Get events from parsing a parameter YAML file and process them
 ///
@@ -753,6 +895,19 @@ rcutils_ret_t parse_file_events(
   yaml_parser_t * parser,
   namespace_tracker_t * ns_tracker,
   rcl_params_t * params_st)
+{
+  return parse_file_events_filtered(parser, ns_tracker, NULL, params_st);
+}
+
+///
+/// Get events from parsing a parameter YAML file and process them, skipping
+/// the sections of nodes other than node_fqn when node_fqn is not NULL
+///
+rcutils_ret_t parse_file_events_filtered(
+  yaml_parser_t * parser,
+  namespace_tracker_t * ns_tracker,
+  const char * node_fqn,
+  rcl_params_t * params_st)
 {
   int32_t done_parsing = 0;
   bool is_key = true;
@@ -794,6 +949,20 @@ rcutils_ret_t parse_file_events(
         {
           /// Need to toggle between key and value at params level
           if (is_key) {
+            /// A foreign node's section is consumed at the event level without
+            /// allocating node, parameter, or variant storage; sections whose
+            /// name carries a wildcard can apply to node_fqn and are kept
+            if (NULL != node_fqn &&
+              (uint32_t)MAP_NODE_NAME_LVL == map_level &&
+              NULL != event.data.scalar.value &&
+              0 == strncmp(PARAMS_KEY, (char *)event.data.scalar.value, strlen(PARAMS_KEY)) &&
+              NULL != ns_tracker->node_ns &&
+              NULL == strchr(ns_tracker->node_ns, '*') &&
+              0 != strcmp(ns_tracker->node_ns, node_fqn))
+            {
+              ret = skip_value_events(parser, &line_num);
+              break;
+            }
             ret = parse_key(
               event, &map_level, &is_new_map, &node_idx, &parameter_idx, ns_tracker, params_st);
             if (RCUTILS_RET_OK != ret) {
@@ -971,6 +1140,88 @@ rcutils_ret_t parse_value_events(
   return ret;
 }
 
+/// Parameter count at which the per-node hash index kicks in; smaller nodes
+/// keep the allocation-free linear scan.
+#define PARAM_INDEX_MIN_PARAMS 32U
+
+static size_t param_index_hash(const char * name)
+{
+  // FNV-1a
+  size_t hash = (size_t)0xcbf29ce484222325ULL;
+  for (const char * c = name; '\0' != *c; ++c) {
+    hash = (hash ^ (size_t)(unsigned char)*c) * (size_t)0x100000001b3ULL;
+  }
+  return hash;
+}
+
+/// Insert a parameter index into the hash buckets; buckets hold index + 1
+/// and 0 marks an empty bucket.  Capacity is a power of two.
+static void param_index_insert(
+  rcl_node_params_t * node_param_st,
+  const size_t parameter_idx)
+{
+  size_t mask = node_param_st->param_index_capacity - 1U;
+  size_t bucket = param_index_hash(node_param_st->parameter_names[parameter_idx]) & mask;
+  while (0U != node_param_st->param_index_buckets[bucket]) {
+    bucket = (bucket + 1U) & mask;
+  }
+  node_param_st->param_index_buckets[bucket] = parameter_idx + 1U;
+}
+
+/// Make sure the hash index reflects all current parameters, (re)building it
+/// if it is missing, stale, or too loaded.  Returns false if the index is
+/// unavailable, in which case the caller falls back to the linear scan.
+static bool param_index_ensure(
+  rcl_node_params_t * node_param_st,
+  const rcutils_allocator_t * allocator)
+{
+  if (NULL != node_param_st->param_index_buckets &&
+    node_param_st->param_index_num_indexed == node_param_st->num_params &&
+    node_param_st->num_params < node_param_st->param_index_capacity / 2U)
+  {
+    return true;
+  }
+  // size for twice the current population, at a power of two for cheap masking
+  size_t desired_capacity = 2U * PARAM_INDEX_MIN_PARAMS;
+  while (desired_capacity < 2U * node_param_st->num_params) {
+    desired_capacity *= 2U;
+  }
+  size_t * buckets = allocator->zero_allocate(
+    desired_capacity, sizeof(size_t), allocator->state);
+  if (NULL == buckets) {
+    return false;  // the index is an optimization, stay on the linear scan
+  }
+  if (NULL != node_param_st->param_index_buckets) {
+    allocator->deallocate(node_param_st->param_index_buckets, allocator->state);
+  }
+  node_param_st->param_index_buckets = buckets;
+  node_param_st->param_index_capacity = desired_capacity;
+  for (size_t i = 0U; i < node_param_st->num_params; ++i) {
+    param_index_insert(node_param_st, i);
+  }
+  node_param_st->param_index_num_indexed = node_param_st->num_params;
+  return true;
+}
+
+/// Look a parameter up through the hash index.  Returns true on hit.
+static bool param_index_find(
+  const rcl_node_params_t * node_param_st,
+  const char * parameter_name,
+  size_t * parameter_idx)
+{
+  size_t mask = node_param_st->param_index_capacity - 1U;
+  size_t bucket = param_index_hash(parameter_name) & mask;
+  while (0U != node_param_st->param_index_buckets[bucket]) {
+    size_t candidate = node_param_st->param_index_buckets[bucket] - 1U;
+    if (0 == strcmp(node_param_st->parameter_names[candidate], parameter_name)) {
+      *parameter_idx = candidate;
+      return true;
+    }
+    bucket = (bucket + 1U) & mask;
+  }
+  return false;
+}
+
 ///
 /// Find parameter entry index in node parameters' structure
 ///
@@ -987,11 +1238,23 @@ rcutils_ret_t find_parameter(
   assert(node_idx < param_st->num_nodes);
 
   rcl_node_params_t * node_param_st = &(param_st->params[node_idx]);
-  for (*parameter_idx = 0U; *parameter_idx < node_param_st->num_params; (*parameter_idx)++) {
-    if (0 == strcmp(node_param_st->parameter_names[*parameter_idx], parameter_name)) {
+  // Parameter-heavy nodes get a hash index so lookups stay O(1) instead of
+  // strcmp-scanning thousands of names; small nodes keep the linear scan.
+  bool indexed = node_param_st->num_params >= PARAM_INDEX_MIN_PARAMS &&
+    param_index_ensure(node_param_st, &param_st->allocator);
+  if (indexed) {
+    if (param_index_find(node_param_st, parameter_name, parameter_idx)) {
       // Parameter found.
       return RCUTILS_RET_OK;
     }
+    *parameter_idx = node_param_st->num_params;
+  } else {
+    for (*parameter_idx = 0U; *parameter_idx < node_param_st->num_params; (*parameter_idx)++) {
+      if (0 == strcmp(node_param_st->parameter_names[*parameter_idx], parameter_name)) {
+        // Parameter found.
+        return RCUTILS_RET_OK;
+      }
+    }
   }
   // Parameter not found, add it.
   rcutils_allocator_t allocator = param_st->allocator;
@@ -1012,6 +1275,15 @@ rcutils_ret_t find_parameter(
     return RCUTILS_RET_BAD_ALLOC;
   }
   node_param_st->num_params++;
+  // Keep the index current while it has headroom; otherwise it is rebuilt on
+  // the next indexed lookup.
+  if (NULL != node_param_st->param_index_buckets &&
+    node_param_st->param_index_num_indexed == node_param_st->num_params - 1U &&
+    node_param_st->num_params < node_param_st->param_index_capacity / 2U)
+  {
+    param_index_insert(node_param_st, node_param_st->num_params - 1U);
+    node_param_st->param_index_num_indexed = node_param_st->num_params;
+  }
   return RCUTILS_RET_OK;
 }
 
@@ -21,6 +21,13 @@
 #include <stdlib.h>
 #include <string.h>
 
+#ifndef _WIN32
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
 #include <yaml.h>
 
 #include "rcl_yaml_param_parser/parser.h"
@@ -30,7 +37,9 @@
 #include "rcutils/error_handling.h"
 #include "rcutils/strdup.h"
 #include "rcutils/types/rcutils_ret.h"
+#include "rcutils/types/string_array.h"
 
+#include "./impl/compiled_params.h"
 #include "./impl/types.h"
 #include "./impl/parse.h"
 #include "./impl/node_params.h"
@@ -147,8 +156,10 @@ rcl_params_t * rcl_yaml_node_struct_copy(
   RCUTILS_CHECK_ARGUMENT_FOR_NULL(params_st, NULL);
 
   rcutils_allocator_t allocator = params_st->allocator;
+  /// Snapshot copies are sized to what they hold, not to the source's growth
+  /// slack; they regrow on their own if ever appended to
   rcl_params_t * out_params_st = rcl_yaml_node_struct_init_with_capacity(
-    params_st->capacity_nodes,
+    (0U != params_st->num_nodes) ? params_st->num_nodes : 1U,
     allocator);
 
   if (NULL == out_params_st) {
@@ -170,7 +181,7 @@ rcl_params_t * rcl_yaml_node_struct_copy(
     rcl_node_params_t * out_node_params_st = &(out_params_st->params[node_idx]);
     ret = node_params_init_with_capacity(
       out_node_params_st,
-      node_params_st->capacity_params,
+      (0U != node_params_st->num_params) ? node_params_st->num_params : 1U,
       allocator);
     if (RCUTILS_RET_OK != ret) {
       if (RCUTILS_RET_BAD_ALLOC == ret) {
@@ -244,20 +255,14 @@ void rcl_yaml_node_struct_fini(
 /// TODO (anup.pemmaiah): Support Mutiple yaml files
 ///
 ///
-/// Parse the YAML file and populate params_st
+/// Parse the YAML file and populate params_st, keeping only node_fqn's
+/// sections when node_fqn is not NULL
 ///
-bool rcl_parse_yaml_file(
+static bool parse_yaml_file_with_filter(
   const char * file_path,
+  const char * node_fqn,
   rcl_params_t * params_st)
 {
-  RCUTILS_CHECK_FOR_NULL_WITH_MSG(
-    file_path, "YAML file path is NULL", return false);
-
-  if (NULL == params_st) {
-    RCUTILS_SAFE_FWRITE_TO_STDERR("Pass an initialized parameter structure");
-    return false;
-  }
-
   yaml_parser_t parser;
   int success = yaml_parser_initialize(&parser);
   if (0 == success) {
@@ -265,7 +270,34 @@ bool rcl_parse_yaml_file(
     return false;
   }
 
-  FILE * yaml_file = fopen(file_path, "r");
+  FILE * yaml_file = NULL;
+#ifndef _WIN32
+  /// Map regular files read-only so libyaml lexes straight out of the page
+  /// cache instead of going through buffered stdio reads; fall back to stdio
+  /// whenever the mapping can't be established
+  void * mapped_file = NULL;
+  size_t mapped_size = 0U;
+  int fd = open(file_path, O_RDONLY);
+  if (-1 != fd) {
+    struct stat file_stat;
+    if (0 == fstat(fd, &file_stat) && S_ISREG(file_stat.st_mode) && file_stat.st_size > 0) {
+      mapped_file = mmap(NULL, (size_t)file_stat.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+      if (MAP_FAILED == mapped_file) {
+        mapped_file = NULL;
+      } else {
+        mapped_size = (size_t)file_stat.st_size;
+        yaml_parser_set_input_string(
+          &parser, (const unsigned char *)mapped_file, mapped_size);
+      }
+    }
+    if (NULL == mapped_file) {
+      close(fd);
+      fd = -1;
+    }
+  }
+  if (NULL == mapped_file) {
+#endif
+  yaml_file = fopen(file_path, "r");
   if (NULL == yaml_file) {
     yaml_parser_delete(&parser);
     RCUTILS_SET_ERROR_MSG("Error opening YAML file");
@@ -273,12 +305,23 @@ bool rcl_parse_yaml_file(
   }
 
   yaml_parser_set_input_file(&parser, yaml_file);
+#ifndef _WIN32
+  }
+#endif
 
   namespace_tracker_t ns_tracker;
   memset(&ns_tracker, 0, sizeof(namespace_tracker_t));
-  rcutils_ret_t ret = parse_file_events(&parser, &ns_tracker, params_st);
+  rcutils_ret_t ret = parse_file_events_filtered(&parser, &ns_tracker, node_fqn, params_st);
 
-  fclose(yaml_file);
+  if (NULL != yaml_file) {
+    fclose(yaml_file);
+  }
+#ifndef _WIN32
+  if (NULL != mapped_file) {
+    munmap(mapped_file, mapped_size);
+    close(fd);
+  }
+#endif
 
   yaml_parser_delete(&parser);
 
@@ -290,9 +333,183 @@ bool rcl_parse_yaml_file(
     allocator.deallocate(ns_tracker.parameter_ns, allocator.state);
   }
 
+  if (RCUTILS_RET_OK == ret) {
+    /// Parsing is done appending; trim the arrays down to their exact sizes
+    for (size_t node_idx = 0U; node_idx < params_st->num_nodes; node_idx++) {
+      rcl_node_params_t * node_params_st = &(params_st->params[node_idx]);
+      for (size_t parameter_idx = 0U; parameter_idx < node_params_st->num_params;
+        parameter_idx++)
+      {
+        rcl_yaml_variant_shrink_to_fit(
+          &(node_params_st->parameter_values[parameter_idx]), allocator);
+      }
+    }
+  }
+
   return RCUTILS_RET_OK == ret;
 }
 
+///
+/// Parse the YAML file and populate params_st
+///
+bool rcl_parse_yaml_file(
+  const char * file_path,
+  rcl_params_t * params_st)
+{
+  RCUTILS_CHECK_FOR_NULL_WITH_MSG(
+    file_path, "YAML file path is NULL", return false);
+
+  if (NULL == params_st) {
+    RCUTILS_SAFE_FWRITE_TO_STDERR("Pass an initialized parameter structure");
+    return false;
+  }
+
+  /// Prefer a compiled image of this file when a current one exists; any
+  /// mismatch or read error falls through to parsing the YAML itself
+  if (rcl_yaml_params_load_compiled(file_path, params_st)) {
+    return true;
+  }
+
+  return parse_yaml_file_with_filter(file_path, NULL, params_st);
+}
+
+///
+/// Parse only the sections applying to node_fqn and populate params_st
+///
+bool rcl_parse_yaml_file_for_node(
+  const char * file_path,
+  const char * node_fqn,
+  rcl_params_t * params_st)
+{
+  RCUTILS_CHECK_FOR_NULL_WITH_MSG(
+    file_path, "YAML file path is NULL", return false);
+  RCUTILS_CHECK_FOR_NULL_WITH_MSG(
+    node_fqn, "node name is NULL", return false);
+
+  if (NULL == params_st) {
+    RCUTILS_SAFE_FWRITE_TO_STDERR("Pass an initialized parameter structure");
+    return false;
+  }
+
+  return parse_yaml_file_with_filter(file_path, node_fqn, params_st);
+}
+
+///
+/// Re-parse the YAML file into an already populated params_st
+///
+bool rcl_parse_yaml_file_update(
+  const char * file_path,
+  rcl_params_t * params_st,
+  rcutils_string_array_t * changed_params)
+{
+  RCUTILS_CHECK_FOR_NULL_WITH_MSG(
+    file_path, "YAML file path is NULL", return false);
+
+  if (NULL == params_st) {
+    RCUTILS_SAFE_FWRITE_TO_STDERR("Pass an initialized parameter structure");
+    return false;
+  }
+
+  rcutils_allocator_t allocator = params_st->allocator;
+
+  /// Parse into a scratch structure so existing entries are only touched where
+  /// their value actually changed
+  rcl_params_t * new_params_st = rcl_yaml_node_struct_init(allocator);
+  if (NULL == new_params_st) {
+    return false;
+  }
+  if (!parse_yaml_file_with_filter(file_path, NULL, new_params_st)) {
+    rcl_yaml_node_struct_fini(new_params_st);
+    return false;
+  }
+
+  size_t total_params = 0U;
+  for (size_t node_idx = 0U; node_idx < new_params_st->num_nodes; node_idx++) {
+    total_params += new_params_st->params[node_idx].num_params;
+  }
+
+  /// Collect changed keys into scratch sized for the worst case (every parsed
+  /// entry changed), then hand them to the output array once the count is known
+  char ** changed_names = NULL;
+  if (NULL != changed_params && total_params > 0U) {
+    changed_names = allocator.zero_allocate(total_params, sizeof(char *), allocator.state);
+    if (NULL == changed_names) {
+      RCUTILS_SAFE_FWRITE_TO_STDERR("Error allocating mem\n");
+      rcl_yaml_node_struct_fini(new_params_st);
+      return false;
+    }
+  }
+
+  bool success = true;
+  size_t num_changed = 0U;
+  for (size_t node_idx = 0U; success && node_idx < new_params_st->num_nodes; node_idx++) {
+    const char * node_name = new_params_st->node_names[node_idx];
+    rcl_node_params_t * new_node_params_st = &(new_params_st->params[node_idx]);
+    size_t dest_node_idx = 0U;
+    if (RCUTILS_RET_OK != find_node(node_name, params_st, &dest_node_idx)) {
+      success = false;
+      break;
+    }
+    for (size_t parameter_idx = 0U; parameter_idx < new_node_params_st->num_params;
+      parameter_idx++)
+    {
+      const char * param_name = new_node_params_st->parameter_names[parameter_idx];
+      rcl_variant_t * new_param_value =
+        &(new_node_params_st->parameter_values[parameter_idx]);
+      size_t dest_parameter_idx = 0U;
+      if (RCUTILS_RET_OK !=
+        find_parameter(dest_node_idx, param_name, params_st, &dest_parameter_idx))
+      {
+        success = false;
+        break;
+      }
+      rcl_variant_t * dest_param_value =
+        &(params_st->params[dest_node_idx].parameter_values[dest_parameter_idx]);
+      if (rcl_yaml_variant_equal(dest_param_value, new_param_value)) {
+        /// Unchanged entries keep their existing allocations untouched
+        continue;
+      }
+      /// Move the freshly parsed value over; both structures share an allocator
+      rcl_yaml_variant_fini(dest_param_value, allocator);
+      *dest_param_value = *new_param_value;
+      memset(new_param_value, 0, sizeof(rcl_variant_t));
+      if (NULL != changed_names) {
+        const size_t key_len = strlen(node_name) + strlen(param_name) + 2U;
+        changed_names[num_changed] = allocator.allocate(key_len, allocator.state);
+        if (NULL == changed_names[num_changed]) {
+          RCUTILS_SAFE_FWRITE_TO_STDERR("Error allocating mem\n");
+          success = false;
+          break;
+        }
+        snprintf(changed_names[num_changed], key_len, "%s.%s", node_name, param_name);
+      }
+      num_changed++;
+    }
+  }
+
+  if (success && NULL != changed_params) {
+    if (RCUTILS_RET_OK != rcutils_string_array_init(changed_params, num_changed, &allocator)) {
+      success = false;
+    } else {
+      for (size_t idx = 0U; idx < num_changed; idx++) {
+        changed_params->data[idx] = changed_names[idx];
+        changed_names[idx] = NULL;
+      }
+    }
+  }
+
+  if (NULL != changed_names) {
+    for (size_t idx = 0U; idx < num_changed; idx++) {
+      if (NULL != changed_names[idx]) {
+        allocator.deallocate(changed_names[idx], allocator.state);
+      }
+    }
+    allocator.deallocate(changed_names, allocator.state);
+  }
+  rcl_yaml_node_struct_fini(new_params_st);
+  return success;
+}
+
 ///
 /// Parse a YAML string and populate params_st
 ///
@@ -341,6 +558,12 @@ bool rcl_parse_yaml_value(
 
   yaml_parser_delete(&parser);
 
+  if (RCUTILS_RET_OK == ret) {
+    rcl_yaml_variant_shrink_to_fit(
+      &(params_st->params[node_idx].parameter_values[parameter_idx]),
+      params_st->allocator);
+  }
+
   return RCUTILS_RET_OK == ret;
 }
 
@@ -12,6 +12,8 @@
 // See the License for the specific language governing permissions and
 // limitations under the License.
 
+#include <string.h>
+
 #include "rcutils/allocator.h"
 #include "rcutils/error_handling.h"
 #include "rcutils/strdup.h"
@@ -58,6 +60,20 @@
       dest_array->values = NULL; \
     } \
     dest_array->size = src_array->size; \
+    /* Copies are exact-size; appends will regrow from here if needed */ \
+    dest_array->capacity = src_array->size; \
+  } while (0)
+
+#define RCL_YAML_VARIANT_SHRINK_ARRAY_VALUE(val_array, allocator, var_type) \
+  do { \
+    if (NULL != val_array->values && val_array->capacity > val_array->size) { \
+      var_type * trimmed = allocator.reallocate( \
+        val_array->values, val_array->size * sizeof(var_type), allocator.state); \
+      if (NULL != trimmed) { \
+        val_array->values = trimmed; \
+        val_array->capacity = val_array->size; \
+      } \
+    } \
   } while (0)
 
 void rcl_yaml_variant_fini(
@@ -110,6 +126,110 @@ void rcl_yaml_variant_fini(
   }
 }
 
+void rcl_yaml_variant_shrink_to_fit(
+  rcl_variant_t * param_var,
+  const rcutils_allocator_t allocator)
+{
+  if (NULL == param_var) {
+    return;
+  }
+
+  if (NULL != param_var->bool_array_value) {
+    RCL_YAML_VARIANT_SHRINK_ARRAY_VALUE(param_var->bool_array_value, allocator, bool);
+  } else if (NULL != param_var->integer_array_value) {
+    RCL_YAML_VARIANT_SHRINK_ARRAY_VALUE(param_var->integer_array_value, allocator, int64_t);
+  } else if (NULL != param_var->double_array_value) {
+    RCL_YAML_VARIANT_SHRINK_ARRAY_VALUE(param_var->double_array_value, allocator, double);
+  } else if (NULL != param_var->string_array_value) {
+    rcutils_string_array_t * string_array = param_var->string_array_value;
+    if (NULL != string_array->data && string_array->size > 0U) {
+      /// The parser grows the data allocation geometrically without a capacity
+      /// field; trimming to the exact size is always safe
+      char ** trimmed = string_array->allocator.reallocate(
+        string_array->data,
+        string_array->size * sizeof(char *),
+        string_array->allocator.state);
+      if (NULL != trimmed) {
+        string_array->data = trimmed;
+      }
+    }
+  }
+}
+
+#define RCL_YAML_VARIANT_EQUAL_VALUE(lhs_ptr, rhs_ptr) \
+  ((NULL == lhs_ptr) ? (NULL == rhs_ptr) : \
+  ((NULL != rhs_ptr) && (*(lhs_ptr) == *(rhs_ptr))))
+
+#define RCL_YAML_VARIANT_EQUAL_ARRAY_VALUE(lhs_array, rhs_array, var_type) \
+  ((NULL == lhs_array) ? (NULL == rhs_array) : \
+  ((NULL != rhs_array) && (lhs_array->size == rhs_array->size) && \
+  ((0U == lhs_array->size) || \
+  (0 == memcmp(lhs_array->values, rhs_array->values, lhs_array->size * sizeof(var_type))))))
+
+bool rcl_yaml_variant_equal(
+  const rcl_variant_t * param_var, const rcl_variant_t * other_param_var)
+{
+  if (NULL == param_var || NULL == other_param_var) {
+    return param_var == other_param_var;
+  }
+  if (!RCL_YAML_VARIANT_EQUAL_VALUE(param_var->bool_value, other_param_var->bool_value)) {
+    return false;
+  }
+  if (!RCL_YAML_VARIANT_EQUAL_VALUE(param_var->integer_value, other_param_var->integer_value)) {
+    return false;
+  }
+  /// Doubles are compared bitwise: a value is unchanged only if its exact
+  /// representation is, and NaN payloads never compare equal to themselves
+  if ((NULL == param_var->double_value) != (NULL == other_param_var->double_value)) {
+    return false;
+  }
+  if (NULL != param_var->double_value &&
+    0 != memcmp(param_var->double_value, other_param_var->double_value, sizeof(double)))
+  {
+    return false;
+  }
+  if ((NULL == param_var->string_value) != (NULL == other_param_var->string_value)) {
+    return false;
+  }
+  if (NULL != param_var->string_value &&
+    0 != strcmp(param_var->string_value, other_param_var->string_value))
+  {
+    return false;
+  }
+  if (!RCL_YAML_VARIANT_EQUAL_ARRAY_VALUE(
+      param_var->bool_array_value, other_param_var->bool_array_value, bool))
+  {
+    return false;
+  }
+  if (!RCL_YAML_VARIANT_EQUAL_ARRAY_VALUE(
+      param_var->integer_array_value, other_param_var->integer_array_value, int64_t))
+  {
+    return false;
+  }
+  if (!RCL_YAML_VARIANT_EQUAL_ARRAY_VALUE(
+      param_var->double_array_value, other_param_var->double_array_value, double))
+  {
+    return false;
+  }
+  if ((NULL == param_var->string_array_value) != (NULL == other_param_var->string_array_value)) {
+    return false;
+  }
+  if (NULL != param_var->string_array_value) {
+    if (param_var->string_array_value->size != other_param_var->string_array_value->size) {
+      return false;
+    }
+    for (size_t str_idx = 0U; str_idx < param_var->string_array_value->size; ++str_idx) {
+      if (0 != strcmp(
+          param_var->string_array_value->data[str_idx],
+          other_param_var->string_array_value->data[str_idx]))
+      {
+        return false;
+      }
+    }
+  }
+  return true;
+}
+
 bool rcl_yaml_variant_copy(
   rcl_variant_t * out_param_var, const rcl_variant_t * param_var, rcutils_allocator_t allocator)
 {
@@ -0,0 +1,136 @@
+// Copyright 2022 Open Source Robotics Foundation, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <fstream>
+#include <sstream>
+#include <string>
+
+#include "performance_test_fixture/performance_test_fixture.hpp"
+
+#include "rcl_yaml_param_parser/parser.h"
+
+#include "rcpputils/filesystem_helper.hpp"
+
+#include "rcutils/allocator.h"
+#include "rcutils/error_handling.h"
+
+using performance_test_fixture::PerformanceTest;
+
+// Generated corpora sized after the parameter files our users complain about.
+// Each shape stresses a different phase of the parser: scalar-heavy files are
+// dominated by value parsing, array-heavy files by the per-element array
+// growth in add_to_arrays.c, deep namespaces by namespace bookkeeping, and
+// many node sections by node lookup and map handling.
+
+namespace
+{
+
+std::string
+write_corpus(const std::string & name, const std::string & contents)
+{
+  std::string path = (rcpputils::fs::temp_directory_path() / name).string();
+  std::ofstream out(path, std::ios::trunc);
+  out << contents;
+  return path;
+}
+
+void
+parse_file_in_loop(benchmark::State & st, const std::string & path)
+{
+  for (auto _ : st) {
+    RCUTILS_UNUSED(_);
+    rcl_params_t * params_hdl = rcl_yaml_node_struct_init(rcutils_get_default_allocator());
+    if (NULL == params_hdl) {
+      st.SkipWithError(rcutils_get_error_string().str);
+      break;
+    }
+    if (!rcl_parse_yaml_file(path.c_str(), params_hdl)) {
+      st.SkipWithError(rcutils_get_error_string().str);
+      break;
+    }
+    rcl_yaml_node_struct_fini(params_hdl);
+  }
+}
+
+}  // namespace
+
+BENCHMARK_F(PerformanceTest, parse_scalar_params_10k)(benchmark::State & st)
+{
+  std::ostringstream corpus;
+  corpus << "scalar_node:\n  ros__parameters:\n";
+  for (int i = 0; i < 10000; ++i) {
+    corpus << "    param_" << i << ": " << i << "\n";
+  }
+  std::string path = write_corpus("benchmark_scalar_params.yaml", corpus.str());
+
+  reset_heap_counters();
+  parse_file_in_loop(st, path);
+}
+
+BENCHMARK_F(PerformanceTest, parse_large_double_arrays)(benchmark::State & st)
+{
+  std::ostringstream corpus;
+  corpus << "array_node:\n  ros__parameters:\n";
+  for (int array_idx = 0; array_idx < 16; ++array_idx) {
+    corpus << "    array_" << array_idx << ": [";
+    for (int i = 0; i < 4096; ++i) {
+      if (i > 0) {
+        corpus << ", ";
+      }
+      corpus << i << ".5";
+    }
+    corpus << "]\n";
+  }
+  std::string path = write_corpus("benchmark_double_arrays.yaml", corpus.str());
+
+  reset_heap_counters();
+  parse_file_in_loop(st, path);
+}
+
+BENCHMARK_F(PerformanceTest, parse_deep_namespaces)(benchmark::State & st)
+{
+  constexpr int depth = 10;
+  constexpr int chains = 100;
+  std::ostringstream corpus;
+  corpus << "deep_node:\n  ros__parameters:\n";
+  for (int chain = 0; chain < chains; ++chain) {
+    std::string indent = "    ";
+    for (int level = 0; level < depth; ++level) {
+      corpus << indent << "chain" << chain << "_level" << level << ":\n";
+      indent += "  ";
+    }
+    for (int leaf = 0; leaf < 5; ++leaf) {
+      corpus << indent << "leaf_" << leaf << ": " << leaf << "\n";
+    }
+  }
+  std::string path = write_corpus("benchmark_deep_namespaces.yaml", corpus.str());
+
+  reset_heap_counters();
+  parse_file_in_loop(st, path);
+}
+
+BENCHMARK_F(PerformanceTest, parse_many_node_sections)(benchmark::State & st)
+{
+  std::ostringstream corpus;
+  for (int node = 0; node < 500; ++node) {
+    corpus << "node_" << node << ":\n  ros__parameters:\n";
+    for (int i = 0; i < 10; ++i) {
+      corpus << "    param_" << i << ": value_" << node << "_" << i << "\n";
+    }
+  }
+  std::string path = write_corpus("benchmark_many_nodes.yaml", corpus.str());
+
+  reset_heap_counters();
+  parse_file_in_loop(st, path);
+}
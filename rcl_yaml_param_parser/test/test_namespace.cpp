@@ -30,6 +30,8 @@ TEST(TestNamespace, add_name_to_ns) {
   ns_tracker.parameter_ns = nullptr;
   ns_tracker.num_node_ns = 0;
   ns_tracker.num_parameter_ns = 0;
+  ns_tracker.node_ns_capacity = 0;
+  ns_tracker.parameter_ns_capacity = 0;
 
   rcutils_ret_t ret = add_name_to_ns(&ns_tracker, nullptr, NS_TYPE_NODE, allocator);
   EXPECT_EQ(RCUTILS_RET_INVALID_ARGUMENT, ret) << rcutils_get_error_string().str;
@@ -73,6 +75,9 @@ TEST(TestNamespace, replace_ns) {
   ASSERT_STREQ("initial_param1.initial_param2", ns_tracker.parameter_ns);
   ns_tracker.num_node_ns = 2;
   ns_tracker.num_parameter_ns = 2;
+  // strdup'd buffers are exact fit, which a capacity of 0 stands for
+  ns_tracker.node_ns_capacity = 0;
+  ns_tracker.parameter_ns_capacity = 0;
 
   char * expected_ns = rcutils_strdup("new_ns1/new_ns2/new_ns3", allocator);
   ASSERT_STREQ("new_ns1/new_ns2/new_ns3", expected_ns);
@@ -112,6 +117,8 @@ TEST(TestNamespace, replace_ns_maybe_fail) {
   ASSERT_STREQ("param1.param2", ns_tracker.parameter_ns);
   ns_tracker.num_node_ns = 2;
   ns_tracker.num_parameter_ns = 2;
+  ns_tracker.node_ns_capacity = 0;
+  ns_tracker.parameter_ns_capacity = 0;
   OSRF_TESTING_TOOLS_CPP_SCOPE_EXIT(
   {
     allocator.deallocate(ns_tracker.node_ns, allocator.state);
@@ -369,6 +369,7 @@ TEST(TestParse, parse_key_bad_args)
   size_t node_idx = 0;
   size_t parameter_idx = 0;
   namespace_tracker_t ns_tracker;
+  memset(&ns_tracker, 0, sizeof(namespace_tracker_t));
 
   rcl_params_t * params_st = rcl_yaml_node_struct_init(allocator);
   ASSERT_NE(nullptr, params_st);
@@ -14,6 +14,8 @@
 
 #include <yaml.h>
 
+#include <cstdio>
+#include <fstream>
 #include <string>
 #include <vector>
 
@@ -342,6 +344,269 @@ TEST(RclYamlParamParser, test_yaml_node_struct_get) {
   rcl_yaml_node_struct_fini(params_st);
 }
 
+TEST(RclYamlParamParser, test_yaml_node_struct_get_many_params) {
+  const char node_name[] = "node name";
+  rcutils_allocator_t allocator = rcutils_get_default_allocator();
+
+  rcl_params_t * params_st = rcl_yaml_node_struct_init(allocator);
+  ASSERT_NE(params_st, nullptr);
+
+  // enough parameters to push the node onto the hash-indexed lookup path
+  constexpr size_t num_params = 200;
+  for (size_t i = 0; i < num_params; ++i) {
+    std::string param_name = "param_" + std::to_string(i);
+    std::string yaml_value = std::to_string(i);
+    EXPECT_TRUE(
+      rcl_parse_yaml_value(node_name, param_name.c_str(), yaml_value.c_str(), params_st));
+  }
+
+  for (size_t i = 0; i < num_params; ++i) {
+    std::string param_name = "param_" + std::to_string(i);
+    rcl_variant_t * result =
+      rcl_yaml_node_struct_get(node_name, param_name.c_str(), params_st);
+    ASSERT_NE(nullptr, result);
+    ASSERT_NE(nullptr, result->integer_value);
+    EXPECT_EQ(static_cast<int64_t>(i), *result->integer_value);
+  }
+
+  // a fresh name is appended, not matched against an existing entry
+  rcl_variant_t * added =
+    rcl_yaml_node_struct_get(node_name, "param_never_set", params_st);
+  ASSERT_NE(nullptr, added);
+  EXPECT_EQ(nullptr, added->integer_value);
+  EXPECT_EQ(num_params + 1, params_st->params[0].num_params);
+
+  rcl_yaml_node_struct_fini(params_st);
+}
+
+TEST(RclYamlParamParser, test_parse_yaml_value_long_sequences) {
+  const char node_name[] = "node name";
+  rcutils_allocator_t allocator = rcutils_get_default_allocator();
+
+  rcl_params_t * params_st = rcl_yaml_node_struct_init(allocator);
+  ASSERT_NE(params_st, nullptr);
+
+  // long enough to force several rounds of geometric growth while parsing
+  constexpr size_t num_values = 100;
+  std::string int_sequence = "[";
+  std::string double_sequence = "[";
+  std::string str_sequence = "[";
+  for (size_t i = 0; i < num_values; ++i) {
+    if (i > 0) {
+      int_sequence += ", ";
+      double_sequence += ", ";
+      str_sequence += ", ";
+    }
+    int_sequence += std::to_string(i);
+    double_sequence += std::to_string(i) + ".5";
+    str_sequence += "str_" + std::to_string(i);
+  }
+  int_sequence += "]";
+  double_sequence += "]";
+  str_sequence += "]";
+
+  EXPECT_TRUE(rcl_parse_yaml_value(node_name, "int_seq", int_sequence.c_str(), params_st));
+  EXPECT_TRUE(
+    rcl_parse_yaml_value(node_name, "double_seq", double_sequence.c_str(), params_st));
+  EXPECT_TRUE(rcl_parse_yaml_value(node_name, "str_seq", str_sequence.c_str(), params_st));
+
+  rcl_variant_t * int_result = rcl_yaml_node_struct_get(node_name, "int_seq", params_st);
+  ASSERT_NE(nullptr, int_result);
+  ASSERT_NE(nullptr, int_result->integer_array_value);
+  ASSERT_EQ(num_values, int_result->integer_array_value->size);
+  // the array was trimmed back to its exact size once parsing finished
+  EXPECT_EQ(num_values, int_result->integer_array_value->capacity);
+  for (size_t i = 0; i < num_values; ++i) {
+    EXPECT_EQ(static_cast<int64_t>(i), int_result->integer_array_value->values[i]);
+  }
+
+  rcl_variant_t * double_result = rcl_yaml_node_struct_get(node_name, "double_seq", params_st);
+  ASSERT_NE(nullptr, double_result);
+  ASSERT_NE(nullptr, double_result->double_array_value);
+  ASSERT_EQ(num_values, double_result->double_array_value->size);
+  EXPECT_EQ(num_values, double_result->double_array_value->capacity);
+  for (size_t i = 0; i < num_values; ++i) {
+    EXPECT_EQ(static_cast<double>(i) + 0.5, double_result->double_array_value->values[i]);
+  }
+
+  rcl_variant_t * str_result = rcl_yaml_node_struct_get(node_name, "str_seq", params_st);
+  ASSERT_NE(nullptr, str_result);
+  ASSERT_NE(nullptr, str_result->string_array_value);
+  ASSERT_EQ(num_values, str_result->string_array_value->size);
+  for (size_t i = 0; i < num_values; ++i) {
+    std::string expected = "str_" + std::to_string(i);
+    EXPECT_STREQ(expected.c_str(), str_result->string_array_value->data[i]);
+  }
+
+  rcl_yaml_node_struct_fini(params_st);
+}
+
+TEST(RclYamlParamParser, test_compiled_params_roundtrip) {
+  const char yaml_path[] = "compiled_params_test.yaml";
+  const char compiled_path[] = "compiled_params_test.yaml.compiled";
+  {
+    std::ofstream yaml_file(yaml_path);
+    ASSERT_TRUE(yaml_file.good());
+    yaml_file <<
+      "compiled_node:\n"
+      "  ros__parameters:\n"
+      "    answer: 42\n"
+      "    gain: 1.5\n"
+      "    flag: true\n"
+      "    label: hello\n"
+      "    offsets: [1, 2, 3]\n"
+      "    names: [alpha, beta]\n";
+  }
+  OSRF_TESTING_TOOLS_CPP_SCOPE_EXIT(
+  {
+    std::remove(yaml_path);
+    std::remove(compiled_path);
+  });
+
+  EXPECT_FALSE(rcl_yaml_params_compile(nullptr, compiled_path));
+  rcutils_reset_error();
+  EXPECT_FALSE(rcl_yaml_params_compile(yaml_path, nullptr));
+  rcutils_reset_error();
+  EXPECT_FALSE(rcl_yaml_params_compile("not_a_file.yaml", compiled_path));
+  rcutils_reset_error();
+
+  ASSERT_TRUE(rcl_yaml_params_compile(yaml_path, compiled_path)) <<
+    rcutils_get_error_string().str;
+
+  // the parse should now be served from the compiled image
+  rcutils_allocator_t allocator = rcutils_get_default_allocator();
+  rcl_params_t * params_st = rcl_yaml_node_struct_init(allocator);
+  ASSERT_NE(nullptr, params_st);
+  EXPECT_TRUE(rcl_parse_yaml_file(yaml_path, params_st));
+
+  rcl_variant_t * result = rcl_yaml_node_struct_get("compiled_node", "answer", params_st);
+  ASSERT_NE(nullptr, result);
+  ASSERT_NE(nullptr, result->integer_value);
+  EXPECT_EQ(42, *result->integer_value);
+
+  result = rcl_yaml_node_struct_get("compiled_node", "gain", params_st);
+  ASSERT_NE(nullptr, result);
+  ASSERT_NE(nullptr, result->double_value);
+  EXPECT_EQ(1.5, *result->double_value);
+
+  result = rcl_yaml_node_struct_get("compiled_node", "flag", params_st);
+  ASSERT_NE(nullptr, result);
+  ASSERT_NE(nullptr, result->bool_value);
+  EXPECT_TRUE(*result->bool_value);
+
+  result = rcl_yaml_node_struct_get("compiled_node", "label", params_st);
+  ASSERT_NE(nullptr, result);
+  ASSERT_NE(nullptr, result->string_value);
+  EXPECT_STREQ("hello", result->string_value);
+
+  result = rcl_yaml_node_struct_get("compiled_node", "offsets", params_st);
+  ASSERT_NE(nullptr, result);
+  ASSERT_NE(nullptr, result->integer_array_value);
+  ASSERT_EQ(3u, result->integer_array_value->size);
+  EXPECT_EQ(1, result->integer_array_value->values[0]);
+  EXPECT_EQ(3, result->integer_array_value->values[2]);
+
+  result = rcl_yaml_node_struct_get("compiled_node", "names", params_st);
+  ASSERT_NE(nullptr, result);
+  ASSERT_NE(nullptr, result->string_array_value);
+  ASSERT_EQ(2u, result->string_array_value->size);
+  EXPECT_STREQ("alpha", result->string_array_value->data[0]);
+  EXPECT_STREQ("beta", result->string_array_value->data[1]);
+  rcl_yaml_node_struct_fini(params_st);
+
+  // a corrupt image must fall back to parsing the YAML file itself
+  {
+    std::ofstream compiled_file(compiled_path, std::ios::binary | std::ios::trunc);
+    ASSERT_TRUE(compiled_file.good());
+    compiled_file << "garbage";
+  }
+  params_st = rcl_yaml_node_struct_init(allocator);
+  ASSERT_NE(nullptr, params_st);
+  EXPECT_TRUE(rcl_parse_yaml_file(yaml_path, params_st));
+  result = rcl_yaml_node_struct_get("compiled_node", "answer", params_st);
+  ASSERT_NE(nullptr, result);
+  ASSERT_NE(nullptr, result->integer_value);
+  EXPECT_EQ(42, *result->integer_value);
+  rcl_yaml_node_struct_fini(params_st);
+}
+
+TEST(RclYamlParamParser, test_parse_yaml_file_update) {
+  const char yaml_path[] = "update_params_test.yaml";
+  {
+    std::ofstream yaml_file(yaml_path);
+    ASSERT_TRUE(yaml_file.good());
+    yaml_file <<
+      "update_node:\n"
+      "  ros__parameters:\n"
+      "    stable: keep\n"
+      "    tunable: 1\n";
+  }
+  OSRF_TESTING_TOOLS_CPP_SCOPE_EXIT(
+  {
+    std::remove(yaml_path);
+  });
+
+  rcutils_allocator_t allocator = rcutils_get_default_allocator();
+  rcl_params_t * params_st = rcl_yaml_node_struct_init(allocator);
+  ASSERT_NE(nullptr, params_st);
+  OSRF_TESTING_TOOLS_CPP_SCOPE_EXIT(
+  {
+    rcl_yaml_node_struct_fini(params_st);
+  });
+  ASSERT_TRUE(rcl_parse_yaml_file(yaml_path, params_st)) << rcutils_get_error_string().str;
+
+  rcl_variant_t * stable = rcl_yaml_node_struct_get("update_node", "stable", params_st);
+  ASSERT_NE(nullptr, stable);
+  ASSERT_NE(nullptr, stable->string_value);
+  const char * stable_value_before = stable->string_value;
+
+  EXPECT_FALSE(rcl_parse_yaml_file_update(nullptr, params_st, nullptr));
+  rcutils_reset_error();
+  EXPECT_FALSE(rcl_parse_yaml_file_update(yaml_path, nullptr, nullptr));
+  rcutils_reset_error();
+
+  // an identical file must report no changes and leave values untouched
+  rcutils_string_array_t changed_params = rcutils_get_zero_initialized_string_array();
+  ASSERT_TRUE(rcl_parse_yaml_file_update(yaml_path, params_st, &changed_params)) <<
+    rcutils_get_error_string().str;
+  EXPECT_EQ(0u, changed_params.size);
+  EXPECT_EQ(RCUTILS_RET_OK, rcutils_string_array_fini(&changed_params));
+
+  {
+    std::ofstream yaml_file(yaml_path, std::ios::trunc);
+    ASSERT_TRUE(yaml_file.good());
+    yaml_file <<
+      "update_node:\n"
+      "  ros__parameters:\n"
+      "    stable: keep\n"
+      "    tunable: 2\n"
+      "    added: 3.5\n";
+  }
+
+  changed_params = rcutils_get_zero_initialized_string_array();
+  ASSERT_TRUE(rcl_parse_yaml_file_update(yaml_path, params_st, &changed_params)) <<
+    rcutils_get_error_string().str;
+  ASSERT_EQ(2u, changed_params.size);
+  EXPECT_STREQ("update_node.tunable", changed_params.data[0]);
+  EXPECT_STREQ("update_node.added", changed_params.data[1]);
+  EXPECT_EQ(RCUTILS_RET_OK, rcutils_string_array_fini(&changed_params));
+
+  // the unchanged entry kept its original allocation
+  stable = rcl_yaml_node_struct_get("update_node", "stable", params_st);
+  ASSERT_NE(nullptr, stable);
+  EXPECT_EQ(stable_value_before, stable->string_value);
+
+  rcl_variant_t * tunable = rcl_yaml_node_struct_get("update_node", "tunable", params_st);
+  ASSERT_NE(nullptr, tunable);
+  ASSERT_NE(nullptr, tunable->integer_value);
+  EXPECT_EQ(2, *tunable->integer_value);
+
+  rcl_variant_t * added = rcl_yaml_node_struct_get("update_node", "added", params_st);
+  ASSERT_NE(nullptr, added);
+  ASSERT_NE(nullptr, added->double_value);
+  EXPECT_EQ(3.5, *added->double_value);
+}
+
 // Just testing basic parameters, this is exercised more in test_parse_yaml.cpp
 TEST(RclYamlParamParser, test_yaml_node_struct_print) {
   rcl_yaml_node_struct_print(nullptr);
@@ -66,6 +66,48 @@ TEST(RclYamlParamParserMultipleNodes, multiple_number_nodes) {
   }
 }
 
+TEST(RclYamlParamParserMultipleNodes, single_node_filtered) {
+  rcutils_reset_error();
+  EXPECT_TRUE(rcutils_get_cwd(cur_dir, 1024)) << rcutils_get_error_string().str;
+  rcutils_allocator_t allocator = rcutils_get_default_allocator();
+  char * test_path = rcutils_join_path(cur_dir, "test", allocator);
+  ASSERT_TRUE(NULL != test_path) << rcutils_get_error_string().str;
+  OSRF_TESTING_TOOLS_CPP_SCOPE_EXIT(
+  {
+    allocator.deallocate(test_path, allocator.state);
+  });
+  char * path = rcutils_join_path(test_path, "multiple_nodes.yaml", allocator);
+  ASSERT_TRUE(NULL != path) << rcutils_get_error_string().str;
+  OSRF_TESTING_TOOLS_CPP_SCOPE_EXIT(
+  {
+    allocator.deallocate(path, allocator.state);
+  });
+  ASSERT_TRUE(rcutils_exists(path)) << "No test YAML file found at " << path;
+  rcl_params_t * params_hdl = rcl_yaml_node_struct_init(allocator);
+  ASSERT_TRUE(NULL != params_hdl) << rcutils_get_error_string().str;
+  OSRF_TESTING_TOOLS_CPP_SCOPE_EXIT(
+  {
+    rcl_yaml_node_struct_fini(params_hdl);
+  });
+
+  EXPECT_FALSE(rcl_parse_yaml_file_for_node(nullptr, "foo_ns/foo_name7", params_hdl));
+  rcutils_reset_error();
+  EXPECT_FALSE(rcl_parse_yaml_file_for_node(path, nullptr, params_hdl));
+  rcutils_reset_error();
+  EXPECT_FALSE(rcl_parse_yaml_file_for_node(path, "foo_ns/foo_name7", nullptr));
+  rcutils_reset_error();
+
+  // only the matching node's section may materialize
+  ASSERT_TRUE(rcl_parse_yaml_file_for_node(path, "foo_ns/foo_name7", params_hdl));
+  ASSERT_EQ(1u, params_hdl->num_nodes);
+  EXPECT_STREQ("foo_ns/foo_name7", params_hdl->node_names[0]);
+  rcl_node_params_t * node_params = &params_hdl->params[0];
+  ASSERT_EQ(1U, node_params->num_params);
+  EXPECT_STREQ("param7", node_params->parameter_names[0]);
+  ASSERT_TRUE(NULL != node_params->parameter_values[0].integer_value);
+  EXPECT_EQ(7, *node_params->parameter_values[0].integer_value);
+}
+
 TEST(RclYamlParamParserMultipleNodes, test_multiple_nodes_with_bad_allocator) {
   char cur_dir[1024];
   rcutils_reset_error();